@@ -28,9 +28,31 @@
 #include <sys/types.h>
 #endif
 
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#ifdef HAVE_OPENSSL
+#include <openssl/evp.h>
+#endif
+
 #include "monit.h"
 #include "md5.h"
 #include "sha1.h"
+#include "sha256.h"
+#include "xxh64.h"
 #include "checksum.h"
 
 // libmonit
@@ -41,6 +63,88 @@
 #define T ChecksumContext_T
 
 
+// Read size used for file checksums. Large reads amortize the syscall overhead and let the kernel readahead keep up with the hash
+#define CHECKSUM_BUFFER_SIZE (1024 * 1024)
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+#ifdef HAVE_OPENSSL
+static const EVP_MD *_getEvpDigest(Hash_Type type) {
+        switch (type) {
+                case Hash_Md5:
+                        return EVP_md5();
+                case Hash_Sha1:
+                        return EVP_sha1();
+                case Hash_Sha256:
+                        return EVP_sha256();
+                default:
+                        return NULL;
+        }
+}
+#endif
+
+
+static void _dropCache(int fd, off_t offset, off_t length) {
+#ifdef POSIX_FADV_DONTNEED
+        posix_fadvise(fd, offset, length, POSIX_FADV_DONTNEED);
+#endif
+}
+
+
+// Read the whole file and feed it to the hash. Uses OpenSSL EVP if available and falls back to the bundled implementation (e.g. MD5 in FIPS mode)
+static bool _hashFile(int fd, const char *file, Hash_Type type, unsigned char *digest) {
+        bool rv = true;
+        off_t offset = 0;
+        struct T context;
+        unsigned char *buffer = ALLOC(CHECKSUM_BUFFER_SIZE);
+#ifdef HAVE_OPENSSL
+        const EVP_MD *md = _getEvpDigest(type);
+        EVP_MD_CTX *evp = md ? EVP_MD_CTX_create() : NULL;
+        if (evp && ! EVP_DigestInit_ex(evp, md, NULL)) {
+                EVP_MD_CTX_destroy(evp);
+                evp = NULL;
+        }
+        if (! evp)
+#endif
+                Checksum_init(&context, type);
+#ifdef POSIX_FADV_SEQUENTIAL
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+        while (true) {
+                ssize_t n = read(fd, buffer, CHECKSUM_BUFFER_SIZE);
+                if (n > 0) {
+#ifdef HAVE_OPENSSL
+                        if (evp)
+                                EVP_DigestUpdate(evp, buffer, n);
+                        else
+#endif
+                                Checksum_append(&context, (const char *)buffer, (int)n);
+                        _dropCache(fd, offset, n);
+                        offset += n;
+                } else if (n == 0) {
+                        break;
+                } else if (errno != EINTR) {
+                        Log_error("checksum: file %s read error -- %s\n", file, STRERROR);
+                        rv = false;
+                        break;
+                }
+        }
+#ifdef HAVE_OPENSSL
+        if (evp) {
+                if (rv)
+                        EVP_DigestFinal_ex(evp, digest, NULL);
+                EVP_MD_CTX_destroy(evp);
+        } else
+#endif
+                memcpy(digest, Checksum_finish(&context), Checksum_length(type));
+        FREE(buffer);
+        return rv;
+}
+
+
+
 /* ------------------------------------------------------------------ Public */
 
 
@@ -53,6 +157,12 @@ void Checksum_init(T context, Hash_Type type) {
                 case Hash_Sha1:
                         sha1_init(&(context->data.sha1));
                         break;
+                case Hash_Sha256:
+                        sha256_init(&(context->data.sha256));
+                        break;
+                case Hash_Xxh64:
+                        xxh64_init(&(context->data.xxh64));
+                        break;
                 default:
                         THROW(AssertException, "Checksum error: Unknown hash type");
                         break;
@@ -72,6 +182,12 @@ unsigned char *Checksum_finish(T context) {
                         case Hash_Sha1:
                                 sha1_finish(&(context->data.sha1), (unsigned char *)context->hash);
                                 break;
+                        case Hash_Sha256:
+                                sha256_finish(&(context->data.sha256), (unsigned char *)context->hash);
+                                break;
+                        case Hash_Xxh64:
+                                xxh64_finish(&(context->data.xxh64), (unsigned char *)context->hash);
+                                break;
                         default:
                                 THROW(AssertException, "Checksum error: Unknown hash type");
                                 break;
@@ -94,6 +210,12 @@ void Checksum_append(T context, const char *input, int inputLength) {
                 case Hash_Sha1:
                         sha1_append(&(context->data.sha1), (const unsigned char *)input, inputLength);
                         break;
+                case Hash_Sha256:
+                        sha256_append(&(context->data.sha256), (const unsigned char *)input, inputLength);
+                        break;
+                case Hash_Xxh64:
+                        xxh64_append(&(context->data.xxh64), (const unsigned char *)input, inputLength);
+                        break;
                 default:
                         THROW(AssertException, "Checksum error: Unknown hash type");
                         break;
@@ -105,21 +227,28 @@ void Checksum_verify(T context, const char *checksum) {
         ASSERT(context);
         ASSERT(checksum);
         // Compare with string
-        int keyLength = 0; // Raw key bytes, not string chars
-        switch (context->type) {
+        int keyLength = Checksum_length(context->type); // Raw key bytes, not string chars
+        if (! keyLength)
+                THROW(AssertException, "Checksum error: Unknown hash type");
+        MD_T hashString = {};
+        if (strncasecmp(Checksum_digest2Bytes(Checksum_finish(context), keyLength, hashString), checksum, keyLength * 2) != 0)
+                THROW(AssertException, "Checksum error: %s mismatch (expected %s got %s)", checksumnames[context->type], checksum, hashString);
+}
+
+
+int Checksum_length(Hash_Type type) {
+        switch (type) {
                 case Hash_Md5:
-                        keyLength = 16;
-                        break;
+                        return 16;
                 case Hash_Sha1:
-                        keyLength = 20;
-                        break;
+                        return SHA1_DIGEST_SIZE;
+                case Hash_Sha256:
+                        return SHA256_DIGEST_SIZE;
+                case Hash_Xxh64:
+                        return XXH64_DIGEST_SIZE;
                 default:
-                        THROW(AssertException, "Checksum error: Unknown hash type");
-                        break;
+                        return 0;
         }
-        MD_T hashString = {};
-        if (strncasecmp(Checksum_digest2Bytes(Checksum_finish(context), keyLength, hashString), checksum, keyLength * 2) != 0)
-                THROW(AssertException, "Checksum error: %s mismatch (expected %s got %s)", checksumnames[context->type], checksum, hashString);
 }
 
 
@@ -137,132 +266,60 @@ char *Checksum_digest2Bytes(unsigned char *digest, int mdlen, MD_T result) {
 }
 
 
-bool Checksum_getStreamDigests(FILE *stream, void *sha1_resblock, void *md5_resblock) {
-#define HASHBLOCKSIZE 4096
-        md5_context_t ctx_md5;
-        sha1_context_t ctx_sha1;
-        unsigned char buffer[HASHBLOCKSIZE + 72];
-        size_t sum;
-
-        /* Initialize the computation contexts */
-        if (md5_resblock)
-                md5_init(&ctx_md5);
-        if (sha1_resblock)
-                sha1_init(&ctx_sha1);
-
-        /* Iterate over full file contents */
-        while (1)  {
-                /* We read the file in blocks of HASHBLOCKSIZE bytes. One call of the computation function processes the whole buffer so that with the next round of the loop another block can be read */
-                size_t n;
-                sum = 0;
-
-                /* Read block. Take care for partial reads */
-                while (1) {
-                        n = fread(buffer + sum, 1, HASHBLOCKSIZE - sum, stream);
-                        sum += n;
-                        if (sum == HASHBLOCKSIZE)
-                                break;
-                        if (n == 0) {
-                                /* Check for the error flag IFF N == 0, so that we don't exit the loop after a partial read due to e.g., EAGAIN or EWOULDBLOCK */
-                                if (ferror(stream))
-                                        return false;
-                                goto process_partial_block;
-                        }
-
-                        /* We've read at least one byte, so ignore errors. But always check for EOF, since feof may be true even though N > 0. Otherwise, we could end up calling fread after EOF */
-                        if (feof(stream))
-                                goto process_partial_block;
-                }
-
-                /* Process buffer with HASHBLOCKSIZE bytes. Note that HASHBLOCKSIZE % 64 == 0 */
-                if (md5_resblock)
-                        md5_append(&ctx_md5, (const md5_byte_t *)buffer, HASHBLOCKSIZE);
-                if (sha1_resblock)
-                        sha1_append(&ctx_sha1, buffer, HASHBLOCKSIZE);
-        }
-
-process_partial_block:
-        /* Process any remaining bytes */
-        if (sum > 0) {
-                if (md5_resblock)
-                        md5_append(&ctx_md5, (const md5_byte_t *)buffer, (int)sum);
-                if (sha1_resblock)
-                        sha1_append(&ctx_sha1, buffer, sum);
-        }
-        /* Construct result in desired memory */
-        if (md5_resblock)
-                md5_finish(&ctx_md5, md5_resblock);
-        if (sha1_resblock)
-                sha1_finish(&ctx_sha1, sha1_resblock);
-        return true;
-}
-
-
 void Checksum_printHash(char *file) {
-        MD_T hash;
-        unsigned char sha1[STRLEN], md5[STRLEN];
+        struct T context[4];
+        Hash_Type types[4] = {Hash_Sha256, Hash_Sha1, Hash_Md5, Hash_Xxh64};
         FILE *fhandle = NULL;
-
-        if (! (fhandle = file ? fopen(file, "r") : stdin) || ! Checksum_getStreamDigests(fhandle, sha1, md5) || (file && fclose(fhandle))) {
+        if (! (fhandle = file ? fopen(file, "r") : stdin)) {
                 printf("%s: %s\n", file, STRERROR);
                 exit(1);
         }
-        printf("SHA1(%s) = %s\n", file ? file : "stdin", Checksum_digest2Bytes(sha1, 20, hash));
-        printf("MD5(%s)  = %s\n", file ? file : "stdin", Checksum_digest2Bytes(md5, 16, hash));
+        for (int i = 0; i < 4; i++)
+                Checksum_init(&context[i], types[i]);
+        size_t n;
+        char *buffer = ALLOC(CHECKSUM_BUFFER_SIZE);
+        while ((n = fread(buffer, 1, CHECKSUM_BUFFER_SIZE, fhandle)) > 0)
+                for (int i = 0; i < 4; i++)
+                        Checksum_append(&context[i], buffer, (int)n);
+        FREE(buffer);
+        if (ferror(fhandle) || (file && fclose(fhandle))) {
+                printf("%s: %s\n", file, STRERROR);
+                exit(1);
+        }
+        for (int i = 0; i < 4; i++) {
+                MD_T hash;
+                printf("%s(%s)%*s = %s\n", checksumnames[types[i]], file ? file : "stdin", (int)(6 - strlen(checksumnames[types[i]])), "", Checksum_digest2Bytes(Checksum_finish(&context[i]), Checksum_length(types[i]), hash));
+        }
 }
 
 
 bool Checksum_getChecksum(char *file, Hash_Type hashtype, char *buf, unsigned long bufsize) {
-        int hashlength = 16;
-
         ASSERT(file);
         ASSERT(buf);
         ASSERT(bufsize >= sizeof(MD_T));
 
-        switch (hashtype) {
-                case Hash_Md5:
-                        hashlength = 16;
-                        break;
-                case Hash_Sha1:
-                        hashlength = 20;
-                        break;
-                default:
-                        Log_error("checksum: invalid hash type: 0x%x\n", hashtype);
-                        return false;
+        int hashlength = Checksum_length(hashtype);
+        if (! hashlength) {
+                Log_error("checksum: invalid hash type: 0x%x\n", hashtype);
+                return false;
         }
 
-        if (File_isFile(file)) {
-                FILE *f = fopen(file, "r");
-                if (f) {
-                        bool fresult = false;
+        int fd = open(file, O_RDONLY | O_NONBLOCK | O_CLOEXEC); // Non-blocking so we don't hang on a fifo before the regular file test
+        if (fd >= 0) {
+                bool rv = false;
+                struct stat st;
+                if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
                         MD_T sum;
-
-                        switch (hashtype) {
-                                case Hash_Md5:
-                                        fresult = Checksum_getStreamDigests(f, NULL, sum);
-                                        break;
-                                case Hash_Sha1:
-                                        fresult = Checksum_getStreamDigests(f, sum, NULL);
-                                        break;
-                                default:
-                                        break;
-                        }
-
-                        if (fclose(f))
-                                Log_error("checksum: error closing file '%s' -- %s\n", file, STRERROR);
-
-                        if (! fresult) {
-                                Log_error("checksum: file %s stream error (0x%x)\n", file, fresult);
-                                return false;
-                        }
-
-                        Checksum_digest2Bytes((unsigned char *)sum, hashlength, buf);
-                        return true;
-
-                } else
-                        Log_error("checksum: failed to open file %s -- %s\n", file, STRERROR);
-        } else
-                Log_error("checksum: file %s is not regular file\n", file);
+                        if ((rv = _hashFile(fd, file, hashtype, (unsigned char *)sum)))
+                                Checksum_digest2Bytes((unsigned char *)sum, hashlength, buf);
+                } else {
+                        Log_error("checksum: file %s is not regular file\n", file);
+                }
+                if (close(fd))
+                        Log_error("checksum: error closing file '%s' -- %s\n", file, STRERROR);
+                return rv;
+        }
+        Log_error("checksum: failed to open file %s -- %s\n", file, STRERROR);
         return false;
 }
 
@@ -42,8 +42,10 @@ typedef struct T {
         Hash_Type type;
         MD_T      hash;
         union {
-                md5_context_t  md5;
-                sha1_context_t sha1;
+                md5_context_t    md5;
+                sha1_context_t   sha1;
+                sha256_context_t sha256;
+                xxh64_context_t  xxh64;
         } data;
 } *T;
 
@@ -52,7 +54,7 @@ typedef struct T {
  * Initialize the checksum context
  * @param context The checksum context
  * @param type Type of hash to initialize
- * @exception AssertException if context is NULL or hash type not MD5 not SHA1
+ * @exception AssertException if context is NULL or hash type is unknown
  */
 void Checksum_init(T context, Hash_Type type);
 
@@ -85,40 +87,41 @@ void Checksum_append(T context, const char *input, int inputLength);
 void Checksum_verify(T context, const char *checksum);
 
 
+/**
+ * Get the digest length of the given hash type
+ * @param type The hash type
+ * @return Raw digest length in bytes (the hex string is twice as long)
+ * or 0 if the hash type is unknown
+ */
+int Checksum_length(Hash_Type type);
+
+
 /**
  * Convert a digest buffer to a char string
  * @param digest buffer containing a MD digest
  * @param mdlen digest length
- * @param result buffer to write the result to. Must be at least 41 bytes long.
+ * @param result buffer to write the result to. Must be at least 65 bytes long.
  * @return pointer to result buffer
  */
 char *Checksum_digest2Bytes(unsigned char *digest, int mdlen, MD_T result);
 
 
 /**
- * Compute SHA1 and MD5 message digests simultaneously for bytes read
- * from STREAM (suitable for stdin, which is not always rewindable).
- * The resulting message digest numbers will be written into the first
- * bytes of resblock buffers.
- * @param stream The stream from where the digests are computed
- * @param sha_resblock The buffer to write the SHA1 result to or NULL to skip the SHA1
- * @param md5_resblock The buffer to write the MD5 result to or NULL to skip the MD5
- * @return false if failed, otherwise true
- */
-bool Checksum_getStreamDigests(FILE *stream, void *sha_resblock, void *md5_resblock);
-
-
-/**
- * Print MD5 and SHA1 hashes to standard output for given file or standard input
+ * Print SHA256, SHA1, MD5 and XXH64 hashes to standard output for given file or standard input
  * @param file The file for which the hashes will be printed or NULL for stdin
  */
 void Checksum_printHash(char *file);
 
 
 /**
- * Store the checksum of given file in supplied buffer
+ * Store the checksum of given file in supplied buffer. The file is read
+ * with large unbuffered reads and the kernel is advised about sequential
+ * access; pages are dropped from the page cache once they were hashed, so
+ * checksumming large files doesn't evict the working set of other
+ * processes. If Monit was built with OpenSSL, its EVP implementation is
+ * used for MD5, SHA1 and SHA256 (taking advantage of CPU extensions).
  * @param file The file for which to compute the checksum
- * @param hashtype The hash type (Hash_Md5 or Hash_Sha1)
+ * @param hashtype The hash type (Hash_Md5, Hash_Sha1, Hash_Sha256 or Hash_Xxh64)
  * @param buf The buffer where the result will be stored
  * @param bufsize The size of the buffer
  * @return false if failed, otherwise true
@@ -56,6 +56,7 @@
 #include "ProcessTree.h"
 #include "event.h"
 #include "util.h"
+#include "statcache.h"
 #include "system/Time.h"
 
 // libmonit
@@ -159,6 +160,8 @@ static int _commandExecute(Service_T S, command_t c, char *msg, int msglen, long
                         } while (n > 0 && Run.debug && total < 2048); // Limit the debug output (if the program will have endless output, such as 'yes' utility, we have to stop at some point to not spin here forever)
                         Process_free(&P); // Will kill the program if still running
                 }
+                // The program may have changed the files we test
+                StatCache_invalidate();
         }
         return status;
 }
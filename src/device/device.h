@@ -29,6 +29,10 @@
 bool filesystem_usage(Service_T);
 bool Filesystem_getByMountpoint(Info_T inf, const char *path);
 bool Filesystem_getByDevice(Info_T inf, const char *path);
+double Filesystem_getUtilization(Info_T inf);
+double Filesystem_getQueueDepth(Info_T inf);
+double Filesystem_getLatency(IOStatistics_T io, Statistics_T time);
+double Filesystem_getIOPS(Info_T inf);
 
 
 #endif
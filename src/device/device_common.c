@@ -61,25 +61,21 @@
 
 #include "monit.h"
 #include "device.h"
+#include "probe.h"
 
 
 bool filesystem_usage(Service_T s) {
         ASSERT(s);
         struct stat sb;
         bool rv = false;
-        int st = lstat(s->path, &sb);
-        if (st == 0) {
-                if (S_ISLNK(sb.st_mode)) {
-                        // Symbolic link: dereference
-                        char buf[PATH_MAX] = {};
-                        if (! realpath(s->path, buf)) {
-                                Log_error("Cannot dereference filesystem '%s' (symlink) -- %s\n", s->path, STRERROR);
-                                return false;
-                        }
-                        st = stat(buf, &sb);
-                }
-        }
-        if (st != 0) {
+        char buf[PATH_MAX] = {};
+        s->inf.filesystem->timeout = false;
+        // Resolve the path (dereference symbolic link) and stat the target. The probe is bounded by the filesystem timeout, so a hung network mount cannot block the validation.
+        // The per-cycle stat cache is not used here: a cache miss would call stat() without the bound
+        int st = Probe_resolve(s->path, buf, &sb);
+        if (st != 0 && errno == ETIMEDOUT) {
+                s->inf.filesystem->timeout = true;
+        } else if (st != 0) {
                 // The path string is not existing block/character device nor mountpoint - could be:
                 //   1. either a filesystem connection string such as NFS/CIFS/SSHFS path
                 //   2. or it is mountpoint which doesn't exist (subdirectory of parent filesystem which is not mounted itself or the mountpoint was deleted)
@@ -87,20 +83,19 @@ bool filesystem_usage(Service_T s) {
                 // Try to use the Filesystem_getByDevice() which will find case #1 above and keep the error for cases #2 and #3
                 if (Filesystem_getByDevice(&(s->inf), s->path)) {
                         // If the device connection string was found, get uid/gid/mode of the mountpoint (connection string itself cannot be stated)
-                        if (stat(s->inf.filesystem->object.mountpoint, &sb) == 0) {
+                        if (Probe_stat(s->inf.filesystem->object.mountpoint, &sb) == 0) {
                                 rv = true;
+                        } else if (errno == ETIMEDOUT) {
+                                s->inf.filesystem->timeout = true;
                         }
                 }
         } else {
-                char buf[PATH_MAX] = {};
-                if (realpath(s->path, buf)) {
-                        if (S_ISDIR(sb.st_mode)) {
-                                // Directory -> mountpoint
-                                rv = Filesystem_getByMountpoint(&(s->inf), buf);
-                        } else if (S_ISBLK(sb.st_mode) || S_ISCHR(sb.st_mode)) {
-                                // Block or character device
-                                rv = Filesystem_getByDevice(&(s->inf), buf);
-                        }
+                if (S_ISDIR(sb.st_mode)) {
+                        // Directory -> mountpoint
+                        rv = Filesystem_getByMountpoint(&(s->inf), buf);
+                } else if (S_ISBLK(sb.st_mode) || S_ISCHR(sb.st_mode)) {
+                        // Block or character device
+                        rv = Filesystem_getByDevice(&(s->inf), buf);
                 }
         }
         if (rv) {
@@ -112,16 +107,67 @@ bool filesystem_usage(Service_T s) {
                 s->inf.filesystem->inode_percent = s->inf.filesystem->f_files > 0 ? 100. * (double)s->inf.filesystem->f_filesused / (double)s->inf.filesystem->f_files : 0.;
                 s->inf.filesystem->space_percent = s->inf.filesystem->f_blocks > 0 ? 100. * (double)s->inf.filesystem->f_blocksused / (double)s->inf.filesystem->f_blocks : 0.;
         } else {
+                s->inf.filesystem->inFlight = -1LL;
+                s->inf.filesystem->timeToFull.space = -1LL;
+                s->inf.filesystem->timeToFull.inode = -1LL;
                 Statistics_reset(&(s->inf.filesystem->read.bytes));
                 Statistics_reset(&(s->inf.filesystem->read.operations));
                 Statistics_reset(&(s->inf.filesystem->write.bytes));
                 Statistics_reset(&(s->inf.filesystem->write.operations));
+                Statistics_reset(&(s->inf.filesystem->discard.bytes));
+                Statistics_reset(&(s->inf.filesystem->discard.operations));
+                Statistics_reset(&(s->inf.filesystem->flush.operations));
                 Statistics_reset(&(s->inf.filesystem->time.read));
                 Statistics_reset(&(s->inf.filesystem->time.write));
+                Statistics_reset(&(s->inf.filesystem->time.discard));
+                Statistics_reset(&(s->inf.filesystem->time.flush));
                 Statistics_reset(&(s->inf.filesystem->time.wait));
                 Statistics_reset(&(s->inf.filesystem->time.run));
-                Log_error("Filesystem '%s' not mounted\n", s->path);
+                Statistics_reset(&(s->inf.filesystem->time.io));
+                Statistics_reset(&(s->inf.filesystem->time.weighted));
+                if (! s->inf.filesystem->timeout)
+                        Log_error("Filesystem '%s' not mounted\n", s->path);
         }
         return rv;
 }
 
+
+
+/* Derived I/O metrics, computed from the delta between the last two samples. All return -1 if the platform doesn't provide the underlying counter */
+
+
+double Filesystem_getUtilization(Info_T inf) {
+        ASSERT(inf);
+        if (! Statistics_initialized(&(inf->filesystem->time.io)))
+                return -1.;
+        // Busy time [ms] per second -> percent of wall clock time
+        double utilization = Statistics_deltaNormalize(&(inf->filesystem->time.io)) / 10.;
+        return utilization > 100. ? 100. : utilization;
+}
+
+
+double Filesystem_getQueueDepth(Info_T inf) {
+        ASSERT(inf);
+        if (! Statistics_initialized(&(inf->filesystem->time.weighted)))
+                return -1.;
+        // Weighted I/O time [ms] per second = average number of requests in flight
+        return Statistics_deltaNormalize(&(inf->filesystem->time.weighted)) / 1000.;
+}
+
+
+double Filesystem_getLatency(IOStatistics_T io, Statistics_T time) {
+        ASSERT(io);
+        ASSERT(time);
+        if (! Statistics_initialized(time) || ! Statistics_initialized(&(io->operations)))
+                return -1.;
+        double deltaOperations = Statistics_delta(&(io->operations));
+        return deltaOperations > 0. ? (double)Statistics_delta(time) / deltaOperations : 0.;
+}
+
+
+double Filesystem_getIOPS(Info_T inf) {
+        ASSERT(inf);
+        if (! Statistics_initialized(&(inf->filesystem->read.operations)) && ! Statistics_initialized(&(inf->filesystem->write.operations)))
+                return -1.;
+        return Statistics_deltaNormalize(&(inf->filesystem->read.operations)) + Statistics_deltaNormalize(&(inf->filesystem->write.operations));
+}
@@ -0,0 +1,347 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#include "config.h"
+
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
+
+#ifdef HAVE_SYS_SYSMACROS_H
+#include <sys/sysmacros.h>
+#endif
+
+#include "monit.h"
+#include "mounttable.h"
+#include "probe.h"
+
+
+/**
+ * The mounts are kept in an array in the mount order, with two arrays of
+ * indexes sorted by device id and by mountpoint (ties are kept in mount
+ * order, so the last matching index is the topmost mount).
+ *
+ * @file
+ */
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+#define MOUNTINFO "/proc/self/mountinfo"
+
+
+static struct {
+        bool check;                                // Test the mount table for changes on next lookup
+        bool loaded;
+        int fd;                                    // /proc/self/mountinfo filedescriptor (needed for mount/unmount notification)
+        int generation;                            // Increment each time the mount table is reloaded
+        int count;
+        struct Mount_T *mounts;
+        int *byDevice;
+        int *byMountpoint;
+} _table = {.fd = -1};
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+static void _free(void) {
+        for (int i = 0; i < _table.count; i++) {
+                FREE(_table.mounts[i].source);
+                FREE(_table.mounts[i].mountpoint);
+                FREE(_table.mounts[i].type);
+                FREE(_table.mounts[i].options);
+        }
+        FREE(_table.mounts);
+        FREE(_table.byDevice);
+        FREE(_table.byMountpoint);
+        _table.count = 0;
+}
+
+
+#ifdef LINUX
+static int _compareDevice(const void *a, const void *b) {
+        int x = *(const int *)a, y = *(const int *)b;
+        dev_t dx = _table.mounts[x].device, dy = _table.mounts[y].device;
+        return dx < dy ? -1 : dx > dy ? 1 : x - y;
+}
+
+
+static int _compareMountpoint(const void *a, const void *b) {
+        int x = *(const int *)a, y = *(const int *)b;
+        int rv = strcmp(_table.mounts[x].mountpoint, _table.mounts[y].mountpoint);
+        return rv ? rv : x - y;
+}
+
+
+// Filesystems without regular file content (file size is not meaningful)
+static const char *_pseudo[] = {"proc", "sysfs", "debugfs", "tracefs", "securityfs", "cgroup", "cgroup2", "configfs", "pstore", "bpf", "efivarfs", "fusectl", NULL};
+
+
+// Decode the octal escapes used in mountinfo for space, tab, newline and backslash
+static char *_unescape(char *s) {
+        char *r = s, *w = s;
+        while (*r) {
+                if (r[0] == '\\' && r[1] >= '0' && r[1] <= '3' && r[2] >= '0' && r[2] <= '7' && r[3] >= '0' && r[3] <= '7') {
+                        *w++ = (char)((r[1] - '0') * 64 + (r[2] - '0') * 8 + (r[3] - '0'));
+                        r += 4;
+                } else {
+                        *w++ = *r++;
+                }
+        }
+        *w = 0;
+        return s;
+}
+
+
+// Compose the options the same way as /proc/self/mounts does: per-mount options followed by the superblock options (without the duplicate rw/ro flag)
+static char *_options(const char *mountOptions, char *superOptions) {
+        StringBuffer_T sb = StringBuffer_create(64);
+        StringBuffer_append(sb, "%s", mountOptions);
+        char *saveptr = NULL;
+        for (char *option = strtok_r(superOptions, ",", &saveptr); option; option = strtok_r(NULL, ",", &saveptr)) {
+                if (! IS(option, "rw") && ! IS(option, "ro"))
+                        StringBuffer_append(sb, ",%s", option);
+        }
+        char *options = Str_dup(StringBuffer_toString(sb));
+        StringBuffer_free(&sb);
+        return options;
+}
+
+
+static void _load(void) {
+        FILE *f = fopen(MOUNTINFO, "r");
+        if (! f) {
+                Log_error("Cannot open %s -- %s\n", MOUNTINFO, STRERROR);
+                return;
+        }
+        int capacity = 64;
+        struct Mount_T *mounts = CALLOC(capacity, sizeof(struct Mount_T));
+        int count = 0;
+        char *line = NULL;
+        size_t length = 0;
+        while (getline(&line, &length, f) != -1) {
+                // Format: <id> <parent> <major>:<minor> <root> <mountpoint> <options> [<optional fields>...] - <type> <source> <super options>
+                unsigned int major, minor;
+                char *fields[6] = {};
+                char *saveptr = NULL;
+                char *token = strtok_r(line, " \n", &saveptr);
+                for (int i = 0; token && i < 6; i++, token = strtok_r(NULL, " \n", &saveptr))
+                        fields[i] = token;
+                while (token && ! IS(token, "-"))
+                        token = strtok_r(NULL, " \n", &saveptr);
+                char *type = strtok_r(NULL, " \n", &saveptr);
+                char *source = strtok_r(NULL, " \n", &saveptr);
+                char *superOptions = strtok_r(NULL, " \n", &saveptr);
+                if (! fields[5] || ! superOptions || sscanf(fields[2], "%u:%u", &major, &minor) != 2) {
+                        DEBUG("Invalid line in %s\n", MOUNTINFO);
+                        continue;
+                }
+                if (count == capacity) {
+                        capacity *= 2;
+                        RESIZE(mounts, capacity * sizeof(struct Mount_T));
+                }
+                Mount_T m = &mounts[count++];
+                m->device = makedev(major, minor);
+                m->source = Str_dup(_unescape(source));
+                m->mountpoint = Str_dup(_unescape(fields[4]));
+                m->type = Str_dup(type);
+                m->options = _options(fields[5], superOptions);
+                m->pseudo = false;
+                for (int i = 0; _pseudo[i]; i++) {
+                        if (IS(type, _pseudo[i])) {
+                                m->pseudo = true;
+                                break;
+                        }
+                }
+        }
+        FREE(line);
+        fclose(f);
+        _free();
+        _table.mounts = mounts;
+        _table.count = count;
+        _table.byDevice = CALLOC(count ? count : 1, sizeof(int));
+        _table.byMountpoint = CALLOC(count ? count : 1, sizeof(int));
+        for (int i = 0; i < count; i++)
+                _table.byDevice[i] = _table.byMountpoint[i] = i;
+        qsort(_table.byDevice, count, sizeof(int), _compareDevice);
+        qsort(_table.byMountpoint, count, sizeof(int), _compareMountpoint);
+        _table.loaded = true;
+        _table.generation++;
+        DEBUG("Mount table loaded: %d mounts\n", count);
+}
+#else
+static void _load(void) {
+        _table.loaded = true;
+        _table.generation++;
+}
+#endif
+
+
+static void _refresh(void) {
+        if (_table.loaded && ! _table.check)
+                return;
+        _table.check = false;
+        bool changed = ! _table.loaded;
+#ifdef LINUX
+        // Mount/unmount notification: open the mountinfo file if we're in daemon mode and keep it open until monit stops, so we can poll for mount table changes
+        if (_table.fd == -1 && (Run.flags & Run_Daemon) && ! (Run.flags & Run_Once)) {
+                if ((_table.fd = open(MOUNTINFO, O_RDONLY | O_CLOEXEC)) != -1)
+                        changed = true; // Changes before the descriptor was opened are not signalled
+        }
+        if (_table.fd != -1) {
+                struct pollfd mountNotify = {.fd = _table.fd, .events = POLLPRI, .revents = 0};
+                if (poll(&mountNotify, 1, 0) != -1) {
+                        if (mountNotify.revents & POLLERR) {
+                                DEBUG("Mount table change detected\n");
+                                changed = true;
+                        }
+                } else {
+                        Log_error("Mount table polling failed -- %s\n", STRERROR);
+                        changed = true;
+                }
+        } else {
+                // No notification available: read the table once per cycle
+                changed = true;
+        }
+#endif
+        if (changed)
+                _load();
+}
+
+
+// Binary search for the last index in the sorted array whose mount matches the key (compare returns <0, 0, >0 like strcmp for mount vs. key)
+static Mount_T _find(int *index, int (*compare)(Mount_T m, const void *key), const void *key) {
+        int low = 0, high = _table.count;
+        while (low < high) {
+                int middle = low + (high - low) / 2;
+                if (compare(&_table.mounts[index[middle]], key) <= 0)
+                        low = middle + 1;
+                else
+                        high = middle;
+        }
+        if (low > 0 && compare(&_table.mounts[index[low - 1]], key) == 0)
+                return &_table.mounts[index[low - 1]];
+        return NULL;
+}
+
+
+static int _matchDevice(Mount_T m, const void *key) {
+        dev_t device = *(const dev_t *)key;
+        return m->device < device ? -1 : m->device > device ? 1 : 0;
+}
+
+
+static int _matchMountpoint(Mount_T m, const void *key) {
+        return strcmp(m->mountpoint, key);
+}
+
+
+/* --------------------------------------- Static constructor and destructor */
+
+
+static void __attribute__ ((destructor)) _destructor(void) {
+        if (_table.fd > -1)
+                close(_table.fd);
+        _free();
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+void MountTable_check(void) {
+        _table.check = true;
+}
+
+
+int MountTable_generation(void) {
+        _refresh();
+        return _table.generation;
+}
+
+
+Mount_T MountTable_getByDevice(dev_t device) {
+        _refresh();
+        return _find(_table.byDevice, _matchDevice, &device);
+}
+
+
+Mount_T MountTable_getByMountpoint(const char *mountpoint) {
+        ASSERT(mountpoint);
+        _refresh();
+        return _find(_table.byMountpoint, _matchMountpoint, mountpoint);
+}
+
+
+Mount_T MountTable_getBySource(const char *source) {
+        ASSERT(source);
+        _refresh();
+        for (int i = _table.count - 1; i >= 0; i--) {
+                if (IS(_table.mounts[i].source, source))
+                        return &_table.mounts[i];
+        }
+        return NULL;
+}
+
+
+Mount_T MountTable_getBySourcePath(const char *path) {
+        ASSERT(path);
+        _refresh();
+        // The paths may be on a hung network filesystem, resolve them with the bounded probe
+        struct stat sb;
+        char device[PATH_MAX];
+        if (Probe_resolve(path, device, &sb) != 0)
+                return NULL;
+        for (int i = _table.count - 1; i >= 0; i--) {
+                char source[PATH_MAX];
+                if (*_table.mounts[i].source == '/' && Probe_resolve(_table.mounts[i].source, source, &sb) == 0 && IS(source, device))
+                        return &_table.mounts[i];
+        }
+        return NULL;
+}
+
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#ifndef MONIT_MOUNTTABLE_H
+#define MONIT_MOUNTTABLE_H
+
+#include <sys/types.h>
+
+#include "monit.h"
+
+
+/**
+ * Central mount table shared by the filesystem, file and content tests.
+ * The system mount table is parsed once per change (on Linux the change
+ * is detected by polling /proc/self/mountinfo in daemon mode, otherwise
+ * the table is read once per validate cycle) and indexed by the device
+ * id and by the mountpoint, so the lookups don't need to scan the mount
+ * list.
+ *
+ * On platforms without /proc/self/mountinfo the table is empty and the
+ * lookups return NULL.
+ *
+ * @file
+ */
+
+
+typedef struct Mount_T {
+        dev_t device;              /**< Device id (st_dev of files on the mount) */
+        bool pseudo;          /**< Pseudo filesystem such as procfs or sysfs */
+        char *source;                                 /**< Mount source */
+        char *mountpoint;                                 /**< Mountpoint */
+        char *type;                                  /**< Filesystem type */
+        char *options;                                 /**< Mount options */
+} *Mount_T;
+
+
+/**
+ * Start a new validate cycle: the next lookup checks whether the mount
+ * table changed and reloads it if necessary
+ */
+void MountTable_check(void);
+
+
+/**
+ * Get the mount table generation, which is incremented each time the
+ * table is reloaded
+ * @return The generation number
+ */
+int MountTable_generation(void);
+
+
+/**
+ * Find the mount for the given device id. If the device is mounted
+ * multiple times, the last mount is returned
+ * @param device The device id
+ * @return The mount or NULL if not found
+ */
+Mount_T MountTable_getByDevice(dev_t device);
+
+
+/**
+ * Find the mount for the given mountpoint. If there are stacked mounts
+ * on the mountpoint, the topmost one is returned
+ * @param mountpoint The mountpoint path
+ * @return The mount or NULL if not found
+ */
+Mount_T MountTable_getByMountpoint(const char *mountpoint);
+
+
+/**
+ * Find the last mount of the given source (e.g. device path or NFS
+ * connection string)
+ * @param source The mount source
+ * @return The mount or NULL if not found
+ */
+Mount_T MountTable_getBySource(const char *source);
+
+
+/**
+ * Find the last mount whose source resolves to the same path as the
+ * given device path, after following symbolic links (e.g. the device
+ * mapper link /dev/mapper/root and the device node /dev/dm-0)
+ * @param path The device path
+ * @return The mount or NULL if not found
+ */
+Mount_T MountTable_getBySourcePath(const char *path);
+
+
+#endif
+
@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#include "config.h"
+
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+
+#ifdef HAVE_SYS_STATVFS_H
+#include <sys/statvfs.h>
+#endif
+
+#include "monit.h"
+#include "probe.h"
+
+// libmonit
+#include "system/Time.h"
+#include "exceptions/AssertException.h"
+
+
+/**
+ * Deadline-bounded filesystem probes.
+ *
+ * Each probe is executed by a detached helper thread. The caller waits
+ * on the probe's condition until the probe is done or the deadline
+ * expires. A timed out probe is moved to the stuck list and released
+ * by its helper thread when the blocked call eventually returns. The
+ * stuck list is protected by the same mutex as the probe state.
+ *
+ * @file
+ */
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+// Maximum number of abandoned probes (blocked helper threads)
+#define PROBE_STUCK_MAX 32
+
+
+typedef enum {
+        Probe_Resolve = 0,
+        Probe_Stat,
+        Probe_Statvfs
+} __attribute__((__packed__)) Probe_Type;
+
+
+typedef struct Probe_T {
+        Probe_Type type;
+        bool done;
+        bool abandoned;
+        int rv;
+        int error;
+        char *path;
+        char resolved[PATH_MAX];
+        struct stat sb;
+        struct statvfs usage;
+        Sem_T cond;
+        struct Probe_T *next;
+} *Probe_T;
+
+
+static struct {
+        int count;
+        Probe_T list;
+        Mutex_T mutex;
+} stuck = {.mutex = PTHREAD_MUTEX_INITIALIZER};
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+static void _free(Probe_T *probe) {
+        Sem_destroy((*probe)->cond);
+        FREE((*probe)->path);
+        FREE(*probe);
+}
+
+
+static void _execute(Probe_T probe) {
+        switch (probe->type) {
+                case Probe_Resolve:
+                        if (! realpath(probe->path, probe->resolved))
+                                probe->rv = -1;
+                        else
+                                probe->rv = stat(probe->resolved, &(probe->sb));
+                        break;
+                case Probe_Stat:
+                        probe->rv = stat(probe->path, &(probe->sb));
+                        break;
+                case Probe_Statvfs:
+                        probe->rv = statvfs(probe->path, &(probe->usage));
+                        break;
+        }
+        probe->error = probe->rv != 0 ? errno : 0;
+}
+
+
+static void _unlink(Probe_T probe) {
+        for (Probe_T *p = &(stuck.list); *p; p = &((*p)->next)) {
+                if (*p == probe) {
+                        *p = probe->next;
+                        stuck.count--;
+                        return;
+                }
+        }
+}
+
+
+static bool _isStuck(const char *path) {
+        for (Probe_T p = stuck.list; p; p = p->next)
+                if (IS(p->path, path))
+                        return true;
+        return false;
+}
+
+
+static void *_worker(void *args) {
+        set_signal_block();
+        Probe_T probe = args;
+        _execute(probe);
+        Mutex_lock(stuck.mutex);
+        probe->done = true;
+        if (probe->abandoned) {
+                Log_info("Filesystem probe for '%s' returned after the timeout\n", probe->path);
+                _unlink(probe);
+                _free(&probe);
+        } else {
+                Sem_signal(probe->cond);
+        }
+        Mutex_unlock(stuck.mutex);
+        return NULL;
+}
+
+
+static void _skip(Probe_T probe) {
+        probe->done = true;
+        probe->rv = -1;
+        probe->error = ETIMEDOUT;
+}
+
+
+/**
+ * Execute the probe and wait for the result
+ * @return true if the probe is done, false if it timed out and was
+ * handed over to the helper thread
+ */
+static bool _run(Probe_T probe) {
+        if (Run.limits.filesystemTimeout == 0) {
+                _execute(probe);
+                return true;
+        }
+        Mutex_lock(stuck.mutex);
+        if (_isStuck(probe->path)) {
+                DEBUG("Filesystem probe for '%s' skipped -- the previous probe is still blocked\n", probe->path);
+                _skip(probe);
+        } else if (stuck.count >= PROBE_STUCK_MAX) {
+                Log_error("Filesystem probe for '%s' skipped -- too many blocked probes (%d)\n", probe->path, stuck.count);
+                _skip(probe);
+        } else {
+                Thread_T thread;
+                Thread_create(thread, _worker, probe);
+                Thread_detach(thread);
+                long long deadline = Time_milli() + Run.limits.filesystemTimeout;
+                while (! probe->done) {
+                        Sem_timeWait(probe->cond, stuck.mutex, ((struct timespec){.tv_sec = deadline / 1000, .tv_nsec = (deadline % 1000) * 1000000}));
+                        if (! probe->done && Time_milli() >= deadline) {
+                                probe->abandoned = true;
+                                probe->next = stuck.list;
+                                stuck.list = probe;
+                                stuck.count++;
+                                Mutex_unlock(stuck.mutex);
+                                return false;
+                        }
+                }
+        }
+        Mutex_unlock(stuck.mutex);
+        return true;
+}
+
+
+static Probe_T _probe(Probe_Type type, const char *path) {
+        Probe_T probe;
+        NEW(probe);
+        probe->type = type;
+        probe->path = Str_dup(path);
+        Sem_init(probe->cond);
+        if (! _run(probe)) {
+                errno = ETIMEDOUT;
+                return NULL;
+        }
+        if (probe->rv != 0) {
+                int error = probe->error;
+                _free(&probe);
+                errno = error;
+                return NULL;
+        }
+        return probe;
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+int Probe_resolve(const char *path, char *resolved, struct stat *sb) {
+        ASSERT(path);
+        ASSERT(resolved);
+        ASSERT(sb);
+        Probe_T probe = _probe(Probe_Resolve, path);
+        if (! probe)
+                return -1;
+        snprintf(resolved, PATH_MAX, "%s", probe->resolved);
+        *sb = probe->sb;
+        _free(&probe);
+        return 0;
+}
+
+
+int Probe_stat(const char *path, struct stat *sb) {
+        ASSERT(path);
+        ASSERT(sb);
+        Probe_T probe = _probe(Probe_Stat, path);
+        if (! probe)
+                return -1;
+        *sb = probe->sb;
+        _free(&probe);
+        return 0;
+}
+
+
+int Probe_statvfs(const char *path, struct statvfs *usage) {
+        ASSERT(path);
+        ASSERT(usage);
+        Probe_T probe = _probe(Probe_Statvfs, path);
+        if (! probe)
+                return -1;
+        *usage = probe->usage;
+        _free(&probe);
+        return 0;
+}
+
+
+int Probe_stuck(void) {
+        Mutex_lock(stuck.mutex);
+        int count = stuck.count;
+        Mutex_unlock(stuck.mutex);
+        return count;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#ifndef MONIT_PROBE_H
+#define MONIT_PROBE_H
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+
+
+/**
+ * Filesystem probes bounded by a deadline. A hung network filesystem
+ * (NFS, CIFS, ...) can block stat() or statvfs() indefinitely, so the
+ * calls are executed in a short-lived helper thread and the caller
+ * waits at most Run.limits.filesystemTimeout. A probe which didn't
+ * finish in time is abandoned: the helper thread is left blocked in
+ * the kernel and releases the probe itself once the call returns.
+ *
+ * At most one abandoned probe is tracked per path and the number of
+ * abandoned probes is capped, so a dead mount doesn't accumulate
+ * blocked threads: while a previous probe for the same path is still
+ * stuck, new probes fail immediately.
+ *
+ * If the filesystem timeout is 0, the calls are executed directly.
+ *
+ * All functions return 0 on success, otherwise -1 and set errno.
+ * errno is ETIMEDOUT if the probe timed out or a previous probe for
+ * the path is still stuck.
+ *
+ * @file
+ */
+
+
+/**
+ * Resolve the path to an absolute canonical path and stat the target
+ * (symbolic links are followed)
+ * @param path The path to probe
+ * @param resolved Buffer of PATH_MAX bytes for the resolved path
+ * @param sb Stat result of the resolved path
+ * @return 0 on success, otherwise -1
+ */
+int Probe_resolve(const char *path, char *resolved, struct stat *sb);
+
+
+/**
+ * Stat the path (symbolic links are followed)
+ * @param path The path to probe
+ * @param sb Stat result
+ * @return 0 on success, otherwise -1
+ */
+int Probe_stat(const char *path, struct stat *sb);
+
+
+/**
+ * Get the filesystem statistics for the path
+ * @param path The path to probe
+ * @param usage Statvfs result
+ * @return 0 on success, otherwise -1
+ */
+int Probe_statvfs(const char *path, struct statvfs *usage);
+
+
+/**
+ * Get the number of abandoned probes which are still blocked
+ * @return The number of stuck probes
+ */
+int Probe_stuck(void);
+
+
+#endif
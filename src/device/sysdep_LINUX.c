@@ -58,24 +58,14 @@
 # include <unistd.h>
 #endif
 
-#ifdef HAVE_MNTENT_H
-#include <mntent.h>
-#endif
-
-#ifdef HAVE_POLL_H
-#include <poll.h>
-#endif
-
-#ifdef HAVE_FCNTL_H
-#include <fcntl.h>
-#endif
-
 #ifdef HAVE_SYS_SYSMACROS_H
 #include <sys/sysmacros.h>
 #endif
 
 #include "monit.h"
 #include "device.h"
+#include "mounttable.h"
+#include "probe.h"
 
 // libmonit
 #include "io/File.h"
@@ -86,27 +76,53 @@
 /* ------------------------------------------------------------- Definitions */
 
 
-#define MOUNTS   "/proc/self/mounts"
 #define CIFSSTAT "/proc/fs/cifs/Stats"
 #define DISKSTAT "/proc/diskstats"
 #define NFSSTAT  "/proc/self/mountstats"
 
 
 static struct {
-        int fd;                                    // /proc/self/mounts filedescriptor (needed for mount/unmount notification)
-        int generation;                            // Increment each time the mount table is changed
-        bool (*getBlockDiskActivity)(void *); // Disk activity callback: _getProcfsBlockDiskActivity or _getSysfsBlockDiskActivity (if sysfs is mounted)
         bool (*getCifsDiskActivity)(void *);  // Disk activity callback: _getCifsDiskActivity if /proc/fs/cifs/Stats is present, otherwise _getDummyDiskActivity
 } _statistics = {};
 
 
+typedef struct BlockStatistics_T {
+        unsigned int major;
+        unsigned int minor;
+        int fields;                                // Number of statistics fields provided by the kernel (11, 15 or 17)
+        struct {
+                unsigned long long operations;
+                unsigned long long sectors;
+                unsigned long long time;           // [ms]
+        } read, write, discard;
+        struct {
+                unsigned long long operations;
+                unsigned long long time;           // [ms]
+        } flush;
+        unsigned long long inFlight;               // I/O requests currently in progress
+        unsigned long long ioTime;                 // Time the device had I/O in progress (io_ticks) [ms]
+        unsigned long long weightedTime;           // Time spent doing I/O weighted by the number of requests in progress [ms]
+} *BlockStatistics_T;
+
+
+static struct {
+        bool valid;
+        struct timeval cycle;                      // Validate cycle the snapshot belongs to (systeminfo.collected)
+        unsigned long long timestamp;              // Snapshot time [ms]
+        int count;
+        int capacity;
+        struct BlockStatistics_T *devices;         // Sorted by major:minor
+} _diskstats = {};
+
+
 /* ----------------------------------------------------------------- Private */
 
 
 static bool _getDiskUsage(void *_inf) {
         Info_T inf = _inf;
         struct statvfs usage;
-        if (statvfs(inf->filesystem->object.mountpoint, &usage) != 0) {
+        if (Probe_statvfs(inf->filesystem->object.mountpoint, &usage) != 0) {
+                inf->filesystem->timeout = errno == ETIMEDOUT;
                 Log_error("Error getting usage statistics for filesystem '%s' -- %s\n", inf->filesystem->object.mountpoint, STRERROR);
                 return false;
         }
@@ -234,66 +250,89 @@ static bool _getZfsDiskActivity(void *_inf) {
 }
 
 
-// See https://www.kernel.org/doc/Documentation/block/stat.txt
-static bool _getSysfsBlockDiskActivity(void *_inf) {
-        Info_T inf = _inf;
-        char path[2 * PATH_MAX];
-        snprintf(path, sizeof(path), "/sys/dev/block/%u:%u/stat", inf->filesystem->object.number.major, inf->filesystem->object.number.minor);
-        FILE *f = fopen(path, "r");
-        if (f) {
-                unsigned long long now = Time_milli();
-                unsigned long long readOperations = 0ULL, readSectors = 0ULL, readTime = 0ULL;
-                unsigned long long writeOperations = 0ULL, writeSectors = 0ULL, writeTime = 0ULL;
-                if (fscanf(f, "%llu %*u %llu %llu %llu %*u %llu %llu", &readOperations, &readSectors, &readTime, &writeOperations, &writeSectors, &writeTime) != 6) {
-                        fclose(f);
-                        Log_error("filesystem statistic error: cannot parse %s -- %s\n", path, STRERROR);
-                        return false;
+static int _compareBlockStatistics(const void *a, const void *b) {
+        const struct BlockStatistics_T *x = a, *y = b;
+        if (x->major != y->major)
+                return x->major < y->major ? -1 : 1;
+        return x->minor < y->minor ? -1 : x->minor > y->minor ? 1 : 0;
+}
+
+
+// Parse /proc/diskstats once per validate cycle, all filesystem services are served from the snapshot. See https://www.kernel.org/doc/Documentation/ABI/testing/procfs-diskstats
+static bool _updateBlockStatistics(void) {
+        if (_diskstats.cycle.tv_sec == systeminfo.collected.tv_sec && _diskstats.cycle.tv_usec == systeminfo.collected.tv_usec)
+                return _diskstats.valid;
+        _diskstats.cycle = systeminfo.collected;
+        _diskstats.valid = false;
+        _diskstats.count = 0;
+        FILE *f = fopen(DISKSTAT, "r");
+        if (! f) {
+                Log_error("filesystem statistic error: cannot read %s -- %s\n", DISKSTAT, STRERROR);
+                return false;
+        }
+        _diskstats.timestamp = Time_milli();
+        char line[PATH_MAX];
+        while (fgets(line, sizeof(line), f)) {
+                struct BlockStatistics_T b = {};
+                // 11 statistics fields in kernel 2.6+, 15 with discard statistics in 4.18+, 17 with flush statistics in 5.5+
+                int rv = sscanf(line, " %u %u %*s %llu %*u %llu %llu %llu %*u %llu %llu %llu %llu %llu %llu %*u %llu %llu %llu %llu",
+                                &b.major, &b.minor,
+                                &b.read.operations, &b.read.sectors, &b.read.time,
+                                &b.write.operations, &b.write.sectors, &b.write.time,
+                                &b.inFlight, &b.ioTime, &b.weightedTime,
+                                &b.discard.operations, &b.discard.sectors, &b.discard.time,
+                                &b.flush.operations, &b.flush.time);
+                if (rv < 11)
+                        continue;
+                b.fields = rv == 16 ? 17 : rv >= 14 ? 15 : 11;
+                if (_diskstats.count == _diskstats.capacity) {
+                        _diskstats.capacity = _diskstats.capacity ? _diskstats.capacity * 2 : 64;
+                        RESIZE(_diskstats.devices, _diskstats.capacity * sizeof(struct BlockStatistics_T));
                 }
-                Statistics_update(&(inf->filesystem->time.read), now, readTime);
-                Statistics_update(&(inf->filesystem->read.bytes), now, readSectors * 512);
-                Statistics_update(&(inf->filesystem->read.operations), now, readOperations);
-                Statistics_update(&(inf->filesystem->time.write), now, writeTime);
-                Statistics_update(&(inf->filesystem->write.bytes), now, writeSectors * 512);
-                Statistics_update(&(inf->filesystem->write.operations), now, writeOperations);
-                fclose(f);
-                return true;
+                _diskstats.devices[_diskstats.count++] = b;
         }
-        Log_error("filesystem statistic error: cannot read %s -- %s\n", path, STRERROR);
-        return false;
+        fclose(f);
+        qsort(_diskstats.devices, _diskstats.count, sizeof(struct BlockStatistics_T), _compareBlockStatistics);
+        _diskstats.valid = true;
+        return true;
 }
 
 
-// See https://www.kernel.org/doc/Documentation/ABI/testing/procfs-diskstats
-static bool _getProcfsBlockDiskActivity(void *_inf) {
+static BlockStatistics_T _getBlockStatistics(int major, int minor) {
+        if (major < 0 || minor < 0 || ! _updateBlockStatistics())
+                return NULL;
+        struct BlockStatistics_T key = {.major = major, .minor = minor};
+        return bsearch(&key, _diskstats.devices, _diskstats.count, sizeof(struct BlockStatistics_T), _compareBlockStatistics);
+}
+
+
+static bool _getBlockDiskActivity(void *_inf) {
         Info_T inf = _inf;
-        FILE *f = fopen(DISKSTAT, "r");
-        if (f) {
-                unsigned long long now = Time_milli();
-                unsigned long long readOperations = 0ULL, readSectors = 0ULL, readTime = 0ULL;
-                unsigned long long writeOperations = 0ULL, writeSectors = 0ULL, writeTime = 0ULL;
-                char line[PATH_MAX];
-                while (fgets(line, sizeof(line), f)) {
-                        int rv;
-                        int major;
-                        int minor;
-                        char name[256] = {};
-                        // Note: There are 17 fields in kernel 5.5+, we may use them in the future
-                        rv = fscanf(f, " %d %d %255s %llu %*u %llu %llu %llu %*u %llu %llu", &major, &minor, name, &readOperations, &readSectors, &readTime, &writeOperations, &writeSectors, &writeTime);
-                        if (rv == 9 && major == inf->filesystem->object.number.major && minor == inf->filesystem->object.number.minor) {
-                                Statistics_update(&(inf->filesystem->time.read), now, readTime);
-                                Statistics_update(&(inf->filesystem->read.bytes), now, readSectors * 512);
-                                Statistics_update(&(inf->filesystem->read.operations), now, readOperations);
-                                Statistics_update(&(inf->filesystem->time.write), now, writeTime);
-                                Statistics_update(&(inf->filesystem->write.bytes), now, writeSectors * 512);
-                                Statistics_update(&(inf->filesystem->write.operations), now, writeOperations);
-                                break;
-                        }
-                }
-                fclose(f);
-                return true;
+        BlockStatistics_T b = _getBlockStatistics(inf->filesystem->object.number.major, inf->filesystem->object.number.minor);
+        if (! b) {
+                Log_error("filesystem statistic error: device %d:%d not found in %s\n", inf->filesystem->object.number.major, inf->filesystem->object.number.minor, DISKSTAT);
+                return false;
         }
-        Log_error("filesystem statistic error: cannot read %s -- %s\n", DISKSTAT, STRERROR);
-        return false;
+        unsigned long long now = _diskstats.timestamp;
+        Statistics_update(&(inf->filesystem->time.read), now, b->read.time);
+        Statistics_update(&(inf->filesystem->read.bytes), now, b->read.sectors * 512);
+        Statistics_update(&(inf->filesystem->read.operations), now, b->read.operations);
+        Statistics_update(&(inf->filesystem->time.write), now, b->write.time);
+        Statistics_update(&(inf->filesystem->write.bytes), now, b->write.sectors * 512);
+        Statistics_update(&(inf->filesystem->write.operations), now, b->write.operations);
+        Statistics_update(&(inf->filesystem->time.io), now, b->ioTime);
+        Statistics_update(&(inf->filesystem->time.weighted), now, b->weightedTime);
+        inf->filesystem->inFlight = b->inFlight;
+        if (b->fields >= 15) {
+                Statistics_update(&(inf->filesystem->time.discard), now, b->discard.time);
+                Statistics_update(&(inf->filesystem->discard.bytes), now, b->discard.sectors * 512);
+                Statistics_update(&(inf->filesystem->discard.operations), now, b->discard.operations);
+        }
+        if (b->fields >= 17) {
+                Statistics_update(&(inf->filesystem->time.flush), now, b->flush.time);
+                Statistics_update(&(inf->filesystem->flush.operations), now, b->flush.operations);
+        }
+        return true;
 }
 
 
@@ -309,115 +348,85 @@ static bool _getDeviceNumbers(const char *device, int *major, int *minor) {
 }
 
 
-static bool _compareMountpoint(const char *mountpoint, struct mntent *mnt) {
-        return IS(mountpoint, mnt->mnt_dir);
+static Mount_T _getByMountpoint(const char *mountpoint) {
+        return MountTable_getByMountpoint(mountpoint);
 }
 
 
-static bool _compareDevice(const char *device, struct mntent *mnt) {
-        int mnt_major, mnt_minor;
-        int device_major, device_minor;
-        char target[PATH_MAX] = {};
-        return (
-                // lookup the device as is first (support for NFS/CIFS/SSHFS/etc.)
-                Str_isEqual(device, mnt->mnt_fsname) ||
-                // The device listed in /etc/mtab can be a device mapper symlink (e.g. /dev/mapper/centos-root -> /dev/dm-1), i.e. try realpath
-                (realpath(mnt->mnt_fsname, target) && Str_isEqual(device, target)) ||
-                // The same filesystem may have multiple independent device nodes with the same major+minor number (e.g. block devices /dev/root and /dev/xvda1 for the same filesystem) => if path didn't match, compare major+minor
-                (_getDeviceNumbers(device, &device_major, &device_minor) && _getDeviceNumbers(mnt->mnt_fsname, &mnt_major, &mnt_minor) && (mnt_major == device_major) && (mnt_minor == device_minor))
-        );
+static Mount_T _getByDevice(const char *device) {
+        // lookup the device as is first (support for NFS/CIFS/SSHFS/etc.)
+        Mount_T mnt = MountTable_getBySource(device);
+        if (! mnt) {
+                // The device listed in the mount table can be a device mapper symlink (e.g. /dev/mapper/centos-root -> /dev/dm-1) and the same filesystem may have
+                // multiple independent device nodes (e.g. block devices /dev/root and /dev/xvda1) => lookup the mount by the device number
+                struct stat sb;
+                if (Probe_stat(device, &sb) == 0 && S_ISBLK(sb.st_mode))
+                        mnt = MountTable_getByDevice(sb.st_rdev);
+                // The device number of the mount doesn't have to match the block device (e.g. btrfs uses an anonymous device number) => compare the resolved device paths
+                if (! mnt)
+                        mnt = MountTable_getBySourcePath(device);
+        }
+        return mnt;
 }
 
 
-static bool _setDevice(Info_T inf, const char *path, bool (*compare)(const char *path, struct mntent *mnt)) {
-        FILE *f = setmntent(MOUNTS, "r");
-        if (! f) {
-                Log_error("Cannot open %s\n", MOUNTS);
+static bool _setDevice(Info_T inf, const char *path, Mount_T (*lookup)(const char *path)) {
+        inf->filesystem->object.generation = MountTable_generation();
+        Mount_T mnt = lookup(path);
+        inf->filesystem->object.mounted = mnt ? true : false;
+        if (! mnt) {
+                Log_error("Lookup for '%s' filesystem failed  -- not found in the mount table\n", path);
                 return false;
         }
-        inf->filesystem->object.generation = _statistics.generation;
-        bool mounted = false;
-        struct mntent *mnt;
-        char flags[STRLEN];
-        while ((mnt = getmntent(f))) {
-                // Scan all entries for overlay mounts (common for rootfs)
-                if (compare(path, mnt)) {
-                        snprintf(inf->filesystem->object.device, sizeof(inf->filesystem->object.device), "%s", mnt->mnt_fsname);
-                        snprintf(inf->filesystem->object.mountpoint, sizeof(inf->filesystem->object.mountpoint), "%s", mnt->mnt_dir);
-                        snprintf(inf->filesystem->object.type, sizeof(inf->filesystem->object.type), "%s", mnt->mnt_type);
-                        snprintf(flags, sizeof(flags), "%s", mnt->mnt_opts);
-                        inf->filesystem->object.getDiskUsage = _getDiskUsage; // The disk usage method is common for all filesystem types
-                        inf->filesystem->object.getDiskActivity = _getDummyDiskActivity; // Set to dummy IO statistics method by default (can be overridden bellow if statistics method is available for this filesystem)
-                        // Get the major and minor device number
-                        _getDeviceNumbers(inf->filesystem->object.device, &(inf->filesystem->object.number.major), &(inf->filesystem->object.number.minor));
-                        // Set filesystem-dependent callbacks
-                        if (Str_startsWith(mnt->mnt_type, "nfs")) {
-                                // NFS
-                                inf->filesystem->object.getDiskActivity = _getNfsDiskActivity;
-                        } else if (IS(mnt->mnt_type, "cifs")) {
-                                // CIFS
-                                inf->filesystem->object.getDiskActivity = _statistics.getCifsDiskActivity;
-                                // Need Windows style name - replace '/' with '\' so we can lookup the filesystem activity in /proc/fs/cifs/Stats
-                                snprintf(inf->filesystem->object.key, sizeof(inf->filesystem->object.key), "%s", inf->filesystem->object.device);
-                                Str_replaceChar(inf->filesystem->object.key, '/', '\\');
-                        } else if (IS(mnt->mnt_type, "zfs")) {
-                                // ZFS
-                                inf->filesystem->object.getDiskActivity = _getZfsDiskActivity;
-                                // Need base zpool name for /proc/spl/kstat/zfs/<NAME>/io lookup:
-                                snprintf(inf->filesystem->object.key, sizeof(inf->filesystem->object.key), "%s", inf->filesystem->object.device);
-                                Str_replaceChar(inf->filesystem->object.key, '/', 0);
-                        } else {
-                                if (realpath(mnt->mnt_fsname, inf->filesystem->object.key)) {
-                                        // Need base name for /sys/class/block/<NAME>/stat or /proc/diskstats lookup:
-                                        snprintf(inf->filesystem->object.key, sizeof(inf->filesystem->object.key), "%s", File_basename(inf->filesystem->object.key));
-                                        // Test if block device statistics are available for the given filesystem
-                                        if (_statistics.getBlockDiskActivity(inf)) {
-                                                // Block device
-                                                inf->filesystem->object.getDiskActivity = _statistics.getBlockDiskActivity;
-                                        }
-                                }
+        snprintf(inf->filesystem->object.device, sizeof(inf->filesystem->object.device), "%s", mnt->source);
+        snprintf(inf->filesystem->object.mountpoint, sizeof(inf->filesystem->object.mountpoint), "%s", mnt->mountpoint);
+        snprintf(inf->filesystem->object.type, sizeof(inf->filesystem->object.type), "%s", mnt->type);
+        inf->filesystem->object.getDiskUsage = _getDiskUsage; // The disk usage method is common for all filesystem types
+        inf->filesystem->object.getDiskActivity = _getDummyDiskActivity; // Set to dummy IO statistics method by default (can be overridden bellow if statistics method is available for this filesystem)
+        // Get the major and minor device number
+        _getDeviceNumbers(inf->filesystem->object.device, &(inf->filesystem->object.number.major), &(inf->filesystem->object.number.minor));
+        // Set filesystem-dependent callbacks
+        if (Str_startsWith(mnt->type, "nfs")) {
+                // NFS
+                inf->filesystem->object.getDiskActivity = _getNfsDiskActivity;
+        } else if (IS(mnt->type, "cifs")) {
+                // CIFS
+                inf->filesystem->object.getDiskActivity = _statistics.getCifsDiskActivity;
+                // Need Windows style name - replace '/' with '\' so we can lookup the filesystem activity in /proc/fs/cifs/Stats
+                snprintf(inf->filesystem->object.key, sizeof(inf->filesystem->object.key), "%s", inf->filesystem->object.device);
+                Str_replaceChar(inf->filesystem->object.key, '/', '\\');
+        } else if (IS(mnt->type, "zfs")) {
+                // ZFS
+                inf->filesystem->object.getDiskActivity = _getZfsDiskActivity;
+                // Need base zpool name for /proc/spl/kstat/zfs/<NAME>/io lookup:
+                snprintf(inf->filesystem->object.key, sizeof(inf->filesystem->object.key), "%s", inf->filesystem->object.device);
+                Str_replaceChar(inf->filesystem->object.key, '/', 0);
+        } else {
+                if (realpath(mnt->source, inf->filesystem->object.key)) {
+                        // Need base name for /sys/class/block/<NAME>/stat or /proc/diskstats lookup:
+                        snprintf(inf->filesystem->object.key, sizeof(inf->filesystem->object.key), "%s", File_basename(inf->filesystem->object.key));
+                        // Test if block device statistics are available for the given filesystem
+                        if (_getBlockStatistics(inf->filesystem->object.number.major, inf->filesystem->object.number.minor)) {
+                                // Block device
+                                inf->filesystem->object.getDiskActivity = _getBlockDiskActivity;
                         }
-                        mounted = true;
                 }
         }
-        endmntent(f);
-        inf->filesystem->object.mounted = mounted;
-        if (! mounted) {
-                Log_error("Lookup for '%s' filesystem failed  -- not found in %s\n", path, MOUNTS);
-        } else {
-                // Evaluate filesystem flags for the last matching mount (overlay mounts for the same filesystem may have different mount flags)
-                if (! IS(flags, inf->filesystem->flags)) {
-                        if (*(inf->filesystem->flags)) {
-                                inf->filesystem->flagsChanged = true;
-                        }
-                        snprintf(inf->filesystem->flags, sizeof(inf->filesystem->flags), "%s", flags);
+        // Evaluate filesystem flags for the topmost mount (overlay mounts for the same filesystem may have different mount flags)
+        if (! IS(mnt->options, inf->filesystem->flags)) {
+                if (*(inf->filesystem->flags)) {
+                        inf->filesystem->flagsChanged = true;
                 }
+                snprintf(inf->filesystem->flags, sizeof(inf->filesystem->flags), "%s", mnt->options);
         }
-        return mounted;
+        return true;
 }
 
 
-static bool _getDevice(Info_T inf, const char *path, bool (*compare)(const char *path, struct mntent *mnt)) {
-        // Mount/unmount notification: open the /proc/self/mounts file if we're in daemon mode and keep it open until monit
-        // stops, so we can poll for mount table changes
-        // FIXME: when libev is added register the mount table handler in libev and stop polling here
-        if (_statistics.fd == -1 && (Run.flags & Run_Daemon) && ! (Run.flags & Run_Once)) {
-                _statistics.fd = open(MOUNTS, O_RDONLY);
-        }
-        if (_statistics.fd != -1) {
-                struct pollfd mountNotify = {.fd = _statistics.fd, .events = POLLPRI, .revents = 0};
-                if (poll(&mountNotify, 1, 0) != -1) {
-                        if (mountNotify.revents & POLLERR) {
-                                DEBUG("Mount table change detected\n");
-                                _statistics.generation++;
-                        }
-                } else {
-                        Log_error("Mount table polling failed -- %s\n", STRERROR);
-                }
-        }
-        if (inf->filesystem->object.generation != _statistics.generation || _statistics.fd == -1) {
+static bool _getDevice(Info_T inf, const char *path, Mount_T (*lookup)(const char *path)) {
+        if (inf->filesystem->object.generation != MountTable_generation()) {
                 DEBUG("Reloading mount information for filesystem '%s'\n", path);
-                _setDevice(inf, path, compare);
+                _setDevice(inf, path, lookup);
         }
         if (inf->filesystem->object.mounted) {
                 return (inf->filesystem->object.getDiskUsage(inf) && inf->filesystem->object.getDiskActivity(inf));
@@ -431,33 +440,23 @@ static bool _getDevice(Info_T inf, const char *path, bool (*compare)(const char
 
 static void __attribute__ ((constructor)) _constructor(void) {
         struct stat sb;
-        _statistics.fd = -1;
-        _statistics.generation++; // First generation
-        _statistics.getBlockDiskActivity = stat("/sys/class/block", &sb) == 0 ? _getSysfsBlockDiskActivity : _getProcfsBlockDiskActivity;
         _statistics.getCifsDiskActivity = stat(CIFSSTAT, &sb) == 0 ? _getCifsDiskActivity : _getDummyDiskActivity;
 }
 
 
-static void __attribute__ ((destructor)) _destructor(void) {
-        if (_statistics.fd > -1) {
-                  close(_statistics.fd);
-        }
-}
-
-
 /* ------------------------------------------------------------------ Public */
 
 
 bool Filesystem_getByMountpoint(Info_T inf, const char *path) {
         ASSERT(inf);
         ASSERT(path);
-        return _getDevice(inf, path, _compareMountpoint);
+        return _getDevice(inf, path, _getByMountpoint);
 }
 
 
 bool Filesystem_getByDevice(Info_T inf, const char *path) {
         ASSERT(inf);
         ASSERT(path);
-        return _getDevice(inf, path, _compareDevice);
+        return _getDevice(inf, path, _getByDevice);
 }
 
@@ -0,0 +1,429 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#include "config.h"
+
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+
+#ifdef HAVE_DIRENT_H
+#include <dirent.h>
+#endif
+
+#ifdef LINUX
+#include <sys/inotify.h>
+#endif
+
+#include "monit.h"
+#include "dirindex.h"
+
+
+/**
+ * The entries are kept in a chained hash table keyed by name, which is
+ * resized as the directory grows. The entries count and the total size
+ * are maintained incrementally, the oldest timestamp is recomputed from
+ * the table only if the oldest entry was removed or modified.
+ *
+ * On Linux all indexes share one inotify descriptor with a watch per
+ * directory, so the number of monitored directories is not limited by
+ * the per-user inotify instances limit. Pending events are read by the
+ * first index updated in a cycle and dispatched to the owning indexes
+ * by watch descriptor.
+ *
+ * @file
+ */
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+#define T DirIndex_T
+
+
+#define INITIAL_BUCKETS 64
+
+
+typedef struct Entry_T {
+        char *name;
+        long long size;
+        time_t mtime;
+        struct Entry_T *next;
+} *Entry_T;
+
+
+struct T {
+        char *path;
+        bool initialized;
+        bool oldestDirty;
+        bool noWatch;                      // inotify is not available, fallback to rescan on change
+        bool lost;                         // The watch was lost (directory replaced, event queue overflow), the index must be rebuilt
+        int wd;                            // inotify watch descriptor or -1 if not used
+        time_t mtime;                      // Directory modification time at last scan (no inotify)
+        time_t ctime;                      // Directory change time at last scan (no inotify)
+        unsigned int buckets;
+        Entry_T *table;
+        long long entries;
+        long long size;
+        time_t oldest;
+        T next;                            // Next index with an active watch
+};
+
+
+#ifdef LINUX
+static struct {
+        int fd;                            // Shared inotify descriptor or -1 if not open
+        T watches;                         // Indexes with an active watch
+} _inotify = {.fd = -1};
+#endif
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+static unsigned int _hash(const char *name) {
+        unsigned int h = 5381;
+        while (*name)
+                h = h * 33 + (unsigned char)*name++;
+        return h;
+}
+
+
+static void _clear(T I) {
+        for (unsigned int i = 0; i < I->buckets; i++) {
+                while (I->table[i]) {
+                        Entry_T e = I->table[i];
+                        I->table[i] = e->next;
+                        FREE(e->name);
+                        FREE(e);
+                }
+        }
+        I->entries = 0;
+        I->size = 0;
+        I->oldest = 0;
+        I->oldestDirty = false;
+}
+
+
+static void _resize(T I) {
+        unsigned int buckets = I->buckets * 4;
+        Entry_T *table = CALLOC(buckets, sizeof(Entry_T));
+        for (unsigned int i = 0; i < I->buckets; i++) {
+                while (I->table[i]) {
+                        Entry_T e = I->table[i];
+                        I->table[i] = e->next;
+                        unsigned int h = _hash(e->name) % buckets;
+                        e->next = table[h];
+                        table[h] = e;
+                }
+        }
+        FREE(I->table);
+        I->table = table;
+        I->buckets = buckets;
+}
+
+
+static void _remove(T I, const char *name) {
+        for (Entry_T *p = &I->table[_hash(name) % I->buckets]; *p; p = &(*p)->next) {
+                if (Str_isEqual((*p)->name, name)) {
+                        Entry_T e = *p;
+                        *p = e->next;
+                        I->entries--;
+                        I->size -= e->size;
+                        if (e->mtime == I->oldest)
+                                I->oldestDirty = true;
+                        FREE(e->name);
+                        FREE(e);
+                        return;
+                }
+        }
+}
+
+
+static void _set(T I, const char *name, struct stat *sb) {
+        unsigned int h = _hash(name) % I->buckets;
+        Entry_T e;
+        for (e = I->table[h]; e; e = e->next) {
+                if (Str_isEqual(e->name, name)) {
+                        I->size -= e->size;
+                        if (e->mtime == I->oldest && sb->st_mtime != e->mtime)
+                                I->oldestDirty = true;
+                        break;
+                }
+        }
+        if (! e) {
+                if (I->entries >= 2 * (long long)I->buckets) {
+                        _resize(I);
+                        h = _hash(name) % I->buckets;
+                }
+                NEW(e);
+                e->name = Str_dup(name);
+                e->next = I->table[h];
+                I->table[h] = e;
+                I->entries++;
+        }
+        e->size = sb->st_size;
+        e->mtime = sb->st_mtime;
+        I->size += e->size;
+        if (! I->oldestDirty && (I->oldest == 0 || e->mtime < I->oldest))
+                I->oldest = e->mtime;
+}
+
+
+// Stat a single entry and update the index accordingly
+static void _refresh(T I, const char *name) {
+        char path[PATH_MAX];
+        struct stat sb;
+        if (snprintf(path, sizeof(path), "%s/%s", I->path, name) < (int)sizeof(path) && lstat(path, &sb) == 0)
+                _set(I, name, &sb);
+        else
+                _remove(I, name);
+}
+
+
+static bool _scan(T I) {
+        DIR *dir = opendir(I->path);
+        if (! dir) {
+                DEBUG("Cannot open directory %s -- %s\n", I->path, STRERROR);
+                return false;
+        }
+        _clear(I);
+        int fd = dirfd(dir);
+        struct dirent *de;
+        while ((de = readdir(dir))) {
+                if (Str_isEqual(de->d_name, ".") || Str_isEqual(de->d_name, ".."))
+                        continue;
+                struct stat sb;
+                if (fstatat(fd, de->d_name, &sb, AT_SYMLINK_NOFOLLOW) == 0)
+                        _set(I, de->d_name, &sb);
+        }
+        closedir(dir);
+        I->initialized = true;
+        return true;
+}
+
+
+static void _updateOldest(T I) {
+        I->oldest = 0;
+        for (unsigned int i = 0; i < I->buckets; i++)
+                for (Entry_T e = I->table[i]; e; e = e->next)
+                        if (I->oldest == 0 || e->mtime < I->oldest)
+                                I->oldest = e->mtime;
+        I->oldestDirty = false;
+}
+
+
+#ifdef LINUX
+static void _closeWatch(T I) {
+        if (I->wd >= 0) {
+                bool shared = false;
+                for (T *p = &_inotify.watches; *p; ) {
+                        if (*p == I) {
+                                *p = I->next;
+                                continue;
+                        }
+                        // The same directory may be watched by another index, inotify returns the same watch descriptor then
+                        if ((*p)->wd == I->wd)
+                                shared = true;
+                        p = &(*p)->next;
+                }
+                if (! shared)
+                        inotify_rm_watch(_inotify.fd, I->wd);
+                I->wd = -1;
+                I->next = NULL;
+        }
+        if (! _inotify.watches && _inotify.fd >= 0) {
+                close(_inotify.fd);
+                _inotify.fd = -1;
+        }
+}
+
+
+// Add a watch and read the directory. The watch is set first, so changes made while scanning are not lost (re-applying them is harmless)
+static bool _startWatch(T I) {
+        if ((_inotify.fd < 0 && (_inotify.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) < 0) || (I->wd = inotify_add_watch(_inotify.fd, I->path, IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR | IN_EXCL_UNLINK)) < 0) {
+                // Don't retry if we're out of inotify resources, the directory will be rescanned on change instead
+                if (errno == EMFILE || errno == ENFILE || errno == ENOSPC || errno == ENOMEM || errno == ENOSYS) {
+                        Log_warning("Cannot watch directory %s, falling back to rescan on change -- %s\n", I->path, STRERROR);
+                        I->noWatch = true;
+                }
+                I->wd = -1;
+                _closeWatch(I);
+                return false;
+        }
+        I->lost = false;
+        I->next = _inotify.watches;
+        _inotify.watches = I;
+        return true;
+}
+
+
+// Read pending inotify events and apply them to the indexes owning the watch descriptors
+static void _applyEvents(void) {
+        char buf[65536] __attribute__((aligned(__alignof__(struct inotify_event))));
+        char last[NAME_MAX + 1] = {};
+        int lastWd = -1;
+        ssize_t n;
+        while ((n = read(_inotify.fd, buf, sizeof(buf))) > 0) {
+                for (char *p = buf; p < buf + n; p += sizeof(struct inotify_event) + ((struct inotify_event *)p)->len) {
+                        struct inotify_event *event = (struct inotify_event *)p;
+                        if (event->mask & IN_Q_OVERFLOW) {
+                                for (T I = _inotify.watches; I; I = I->next)
+                                        I->lost = true;
+                                continue;
+                        }
+                        // Coalesce bursts of events for the same entry (e.g. a file being written)
+                        if (event->len && event->wd == lastWd && Str_isEqual(last, event->name))
+                                continue;
+                        for (T I = _inotify.watches; I; I = I->next) {
+                                if (I->wd != event->wd || I->lost)
+                                        continue;
+                                if (event->mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF))
+                                        I->lost = true;
+                                else if (event->len)
+                                        _refresh(I, event->name);
+                        }
+                        if (event->len) {
+                                lastWd = event->wd;
+                                snprintf(last, sizeof(last), "%s", event->name);
+                        }
+                }
+        }
+}
+#endif
+
+
+// Fallback without change notification: rescan if the directory itself changed
+static bool _rescanIfChanged(T I) {
+        struct stat sb;
+        if (stat(I->path, &sb) != 0)
+                return false;
+        if (! I->initialized || sb.st_mtime != I->mtime || sb.st_ctime != I->ctime) {
+                if (! _scan(I))
+                        return false;
+                I->mtime = sb.st_mtime;
+                I->ctime = sb.st_ctime;
+        }
+        return true;
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+T DirIndex_new(const char *path) {
+        ASSERT(path);
+        T I;
+        NEW(I);
+        I->path = Str_dup(path);
+        I->wd = -1;
+        I->buckets = INITIAL_BUCKETS;
+        I->table = CALLOC(I->buckets, sizeof(Entry_T));
+        return I;
+}
+
+
+void DirIndex_free(T *I) {
+        ASSERT(I && *I);
+#ifdef LINUX
+        _closeWatch(*I);
+#endif
+        _clear(*I);
+        FREE((*I)->table);
+        FREE((*I)->path);
+        FREE(*I);
+}
+
+
+bool DirIndex_update(T I) {
+        ASSERT(I);
+        bool rv;
+#ifdef LINUX
+        if (I->noWatch) {
+                rv = _rescanIfChanged(I);
+        } else if (I->wd >= 0 && (_applyEvents(), ! I->lost)) {
+                rv = true;
+        } else {
+                // First run or the watch was lost (directory replaced, event queue overflow): start over
+                _closeWatch(I);
+                I->initialized = false;
+                if (_startWatch(I)) {
+                        if (! (rv = _scan(I)))
+                                _closeWatch(I);
+                } else {
+                        rv = _rescanIfChanged(I);
+                }
+        }
+#else
+        rv = _rescanIfChanged(I);
+#endif
+        if (rv && I->oldestDirty)
+                _updateOldest(I);
+        return rv;
+}
+
+
+long long DirIndex_entries(T I) {
+        ASSERT(I);
+        return I->entries;
+}
+
+
+long long DirIndex_size(T I) {
+        ASSERT(I);
+        return I->size;
+}
+
+
+time_t DirIndex_oldest(T I) {
+        ASSERT(I);
+        return I->oldest;
+}
+
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#ifndef MONIT_DIRINDEX_H
+#define MONIT_DIRINDEX_H
+
+#include "monit.h"
+
+
+/**
+ * Incremental index of directory entries used by the directory
+ * aggregate tests (number of entries, total size and age of the oldest
+ * entry). The directory is read in full once and the index is then
+ * kept up to date from inotify events (Linux): only the entries named
+ * by the events are stat'ed again. If inotify is not available, the
+ * directory is rescanned when its modification or change time changes.
+ *
+ * The index is not recursive, only direct entries of the directory are
+ * accounted.
+ *
+ * @file
+ */
+
+
+#define T DirIndex_T
+typedef struct T *T;
+
+
+/**
+ * Create a new directory index. No I/O is performed until the first
+ * call to DirIndex_update()
+ * @param path The directory path
+ * @return A new index object
+ */
+T DirIndex_new(const char *path);
+
+
+/**
+ * Destroy the index and release the inotify watch
+ * @param I The index object reference
+ */
+void DirIndex_free(T *I);
+
+
+/**
+ * Bring the index up to date. The first call reads the whole directory,
+ * subsequent calls only apply the changes.
+ * @param I The index object
+ * @return true on success, false if the directory cannot be read
+ */
+bool DirIndex_update(T I);
+
+
+/**
+ * Get the number of directory entries (excluding "." and "..")
+ * @param I The index object
+ * @return Number of entries
+ */
+long long DirIndex_entries(T I);
+
+
+/**
+ * Get the total size of directory entries
+ * @param I The index object
+ * @return Sum of entry sizes [B]
+ */
+long long DirIndex_size(T I);
+
+
+/**
+ * Get the modification time of the oldest entry
+ * @param I The index object
+ * @return Oldest modification time or 0 if the directory is empty
+ */
+time_t DirIndex_oldest(T I);
+
+
+#undef T
+#endif
+
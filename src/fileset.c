@@ -0,0 +1,380 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#include "config.h"
+
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_STRINGS_H
+#include <strings.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+
+#ifdef HAVE_GLOB_H
+#include <glob.h>
+#endif
+
+#include "monit.h"
+#include "md5.h"
+#include "sha1.h"
+#include "sha256.h"
+#include "xxh64.h"
+#include "checksum.h"
+#include "hashpool.h"
+#include "fileset.h"
+
+// libmonit
+#include "io/File.h"
+
+
+/**
+ * The entries are stored in one array sorted by path, the paths in one
+ * buffer and the checksums (if a checksum test needs the previous value)
+ * in a third array of fixed-size binary digests. On update, the sorted
+ * result of glob(3) is merged with the previous entries in one pass.
+ *
+ * If the checksum worker pool is running, the checksums are computed in
+ * the background: the jobs in progress are kept in a short list sorted
+ * by path, which is merged along with the entries, and a result is
+ * evaluated in the first update after the job finished. Until then the
+ * entry keeps the checksum state of the last completed computation.
+ *
+ * @file
+ */
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+#define T FileSet_T
+
+
+typedef struct Pending_T {
+        char *path;
+        bool first;                        // No reference checksum was collected yet
+        struct HashJob_T *job;
+} *Pending_T;
+
+
+struct T {
+        char *pattern;
+        int count;
+        int digestLength;                  // Binary digest length per entry (0 if not stored)
+        size_t namesLength;
+        char *names;
+        struct FileSetEntry_T *entries;
+        unsigned char *digests;
+        int pendingCount;
+        struct Pending_T *pending;         // Checksum jobs in progress, sorted by path
+};
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+static int _compare(const void *a, const void *b) {
+        return strcmp(*(char * const *)a, *(char * const *)b);
+}
+
+
+static void _hex2bin(const char *hex, unsigned char *bin, int length) {
+        for (int i = 0; i < length; i++) {
+                unsigned int byte = 0;
+                sscanf(hex + 2 * i, "%2x", &byte);
+                bin[i] = (unsigned char)byte;
+        }
+}
+
+
+static void _checksum(T S, FileSetEntry_T e, unsigned char *digest, Checksum_T cs, bool first, bool succeeded, const char *hash) {
+        if (! succeeded) {
+                e->flags |= FileSet_ChecksumError;
+                return;
+        }
+        e->flags &= ~FileSet_ChecksumError;
+        if (S->digestLength) {
+                unsigned char current[S->digestLength];
+                _hex2bin(hash, current, S->digestLength);
+                if (cs->test_changes) {
+                        if (! first && memcmp(current, digest, S->digestLength))
+                                e->flags |= FileSet_ChecksumChanged;
+                        memcpy(digest, current, S->digestLength);
+                } else if (first) {
+                        // No expected value was given: the checksum seen first is the reference
+                        memcpy(digest, current, S->digestLength);
+                        e->flags &= ~FileSet_ChecksumMismatch;
+                } else if (memcmp(current, digest, S->digestLength)) {
+                        e->flags |= FileSet_ChecksumMismatch;
+                } else {
+                        e->flags &= ~FileSet_ChecksumMismatch;
+                }
+        } else if (strncasecmp(hash, cs->hash, Checksum_length(cs->type) * 2)) {
+                e->flags |= FileSet_ChecksumMismatch;
+        } else {
+                e->flags &= ~FileSet_ChecksumMismatch;
+        }
+}
+
+
+static void _cancelPending(T S) {
+        for (int i = 0; i < S->pendingCount; i++) {
+                if (S->pending[i].job)
+                        HashPool_cancel(S->pending[i].job);
+                FREE(S->pending[i].path);
+        }
+        FREE(S->pending);
+        S->pendingCount = 0;
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+T FileSet_new(const char *pattern) {
+        ASSERT(pattern);
+        T S;
+        NEW(S);
+        if (! strpbrk(pattern, "*?[") && File_isDirectory(pattern))
+                S->pattern = Str_cat("%s%s*", pattern, pattern[strlen(pattern) - 1] == '/' ? "" : "/");
+        else
+                S->pattern = Str_dup(pattern);
+        return S;
+}
+
+
+void FileSet_free(T *S) {
+        ASSERT(S && *S);
+        _cancelPending(*S);
+        FREE((*S)->pattern);
+        FREE((*S)->names);
+        FREE((*S)->entries);
+        FREE((*S)->digests);
+        FREE(*S);
+}
+
+
+int FileSet_update(T S, Checksum_T cs) {
+        ASSERT(S);
+        glob_t g = {};
+        int rv = glob(S->pattern, GLOB_NOSORT, NULL, &g);
+        if (rv != 0 && rv != GLOB_NOMATCH) {
+                globfree(&g);
+                return -1;
+        }
+        int digestLength = cs && (cs->test_changes || ! cs->initialized) ? Checksum_length(cs->type) : 0;
+        if (digestLength != S->digestLength) {
+                // The checksum test was changed: start with fresh reference values
+                FREE(S->digests);
+                S->digestLength = digestLength;
+                S->count = 0;
+        }
+        int count = 0;
+        size_t namesLength = 0;
+        char *names = NULL;
+        struct FileSetEntry_T *entries = NULL;
+        unsigned char *digests = NULL;
+        int pendingCount = 0;
+        struct Pending_T *pending = NULL;
+        if (rv == 0 && g.gl_pathc > 0) {
+                qsort(g.gl_pathv, g.gl_pathc, sizeof(char *), _compare);
+                size_t length = 0;
+                for (size_t k = 0; k < g.gl_pathc; k++)
+                        length += strlen(g.gl_pathv[k]) + 1;
+                names = ALLOC(length);
+                entries = CALLOC(g.gl_pathc, sizeof(struct FileSetEntry_T));
+                if (digestLength)
+                        digests = CALLOC(g.gl_pathc, digestLength);
+                if (cs)
+                        pending = CALLOC(g.gl_pathc, sizeof(struct Pending_T));
+                int i = 0, j = 0;
+                for (size_t k = 0; k < g.gl_pathc; k++) {
+                        const char *path = g.gl_pathv[k];
+                        struct stat sb;
+                        if (stat(path, &sb) != 0 || ! S_ISREG(sb.st_mode))
+                                continue;
+                        FileSetEntry_T old = NULL;
+                        while (i < S->count) {
+                                int c = strcmp(S->names + S->entries[i].name, path);
+                                if (c < 0) {
+                                        i++;
+                                } else {
+                                        if (c == 0)
+                                                old = &S->entries[i];
+                                        break;
+                                }
+                        }
+                        FileSetEntry_T e = &entries[count];
+                        size_t len = strlen(path) + 1;
+                        memcpy(names + namesLength, path, len);
+                        e->name = (uint32_t)namesLength;
+                        namesLength += len;
+                        if (old) {
+                                e->flags = old->flags & (FileSet_ChecksumMismatch | FileSet_ChecksumError | FileSet_Failed);
+                                if (old->size != sb.st_size)
+                                        e->flags |= FileSet_SizeChanged;
+                                if (old->mode != (uint32_t)sb.st_mode)
+                                        e->flags |= FileSet_ModeChanged;
+                                if (old->atime != sb.st_atime)
+                                        e->flags |= FileSet_AccessChanged;
+                                if (old->ctime != sb.st_ctime)
+                                        e->flags |= FileSet_ChangeChanged;
+                                if (old->mtime != sb.st_mtime)
+                                        e->flags |= FileSet_ModifyChanged;
+                                if (digestLength)
+                                        memcpy(digests + count * digestLength, S->digests + i * digestLength, digestLength);
+                        } else {
+                                e->flags = FileSet_New;
+                        }
+                        e->size = sb.st_size;
+                        e->atime = sb.st_atime;
+                        e->ctime = sb.st_ctime;
+                        e->mtime = sb.st_mtime;
+                        e->mode = sb.st_mode;
+                        e->uid = sb.st_uid;
+                        e->gid = sb.st_gid;
+                        if (cs) {
+                                unsigned char *digest = digestLength ? digests + count * digestLength : NULL;
+                                Pending_T p = NULL;
+                                while (j < S->pendingCount) {
+                                        int c = strcmp(S->pending[j].path, path);
+                                        if (c < 0) {
+                                                j++;
+                                        } else {
+                                                if (c == 0)
+                                                        p = &S->pending[j];
+                                                break;
+                                        }
+                                }
+                                bool first = ! old || ((old->flags & FileSet_ChecksumError) && ! cs->test_changes && ! cs->initialized);
+                                if (p) {
+                                        // Evaluate the result of the job queued in a previous update, if it's done
+                                        MD_T hash;
+                                        bool succeeded;
+                                        first = first || p->first;
+                                        if (HashPool_poll(p->job, hash, &succeeded)) {
+                                                p->job = NULL;
+                                                _checksum(S, e, digest, cs, first, succeeded, hash);
+                                                first = (e->flags & FileSet_ChecksumError) && ! cs->test_changes && ! cs->initialized;
+                                        }
+                                }
+                                if (! old || (e->flags & (FileSet_SizeChanged | FileSet_ChangeChanged | FileSet_ModifyChanged)) || ((e->flags & FileSet_ChecksumError) && ! (p && p->job))) {
+                                        if (p && p->job) {
+                                                // The file changed while the job was in progress, the result may be stale
+                                                HashPool_cancel(p->job);
+                                                p->job = NULL;
+                                        }
+                                        if (HashPool_isRunning()) {
+                                                pending[pendingCount].path = Str_dup(path);
+                                                pending[pendingCount].first = first;
+                                                pending[pendingCount].job = HashPool_submit(path, cs->type);
+                                                pendingCount++;
+                                        } else {
+                                                MD_T hash;
+                                                bool succeeded = Checksum_getChecksum((char *)path, cs->type, hash, sizeof(hash));
+                                                _checksum(S, e, digest, cs, first, succeeded, hash);
+                                        }
+                                } else if (p && p->job) {
+                                        // Still in progress: move the job to the new list
+                                        pending[pendingCount] = *p;
+                                        p->path = NULL;
+                                        p->job = NULL;
+                                        pendingCount++;
+                                }
+                        }
+                        count++;
+                }
+        }
+        globfree(&g);
+        // Release the jobs of vanished files
+        _cancelPending(S);
+        if (pendingCount) {
+                S->pending = RESIZE(pending, pendingCount * sizeof(struct Pending_T));
+                S->pendingCount = pendingCount;
+        } else {
+                FREE(pending);
+        }
+        FREE(S->names);
+        FREE(S->entries);
+        FREE(S->digests);
+        if (count) {
+                // Trim the arrays to the regular files actually found
+                S->names = RESIZE(names, namesLength);
+                S->entries = RESIZE(entries, count * sizeof(struct FileSetEntry_T));
+                if (digestLength)
+                        S->digests = RESIZE(digests, count * digestLength);
+        } else {
+                FREE(names);
+                FREE(entries);
+                FREE(digests);
+        }
+        S->count = count;
+        S->namesLength = namesLength;
+        return count;
+}
+
+
+int FileSet_count(T S) {
+        ASSERT(S);
+        return S->count;
+}
+
+
+FileSetEntry_T FileSet_get(T S, int index) {
+        ASSERT(S);
+        ASSERT(index >= 0 && index < S->count);
+        return &S->entries[index];
+}
+
+
+const char *FileSet_path(T S, FileSetEntry_T e) {
+        ASSERT(S);
+        ASSERT(e);
+        return S->names + e->name;
+}
+
+
+size_t FileSet_memory(T S) {
+        ASSERT(S);
+        return sizeof(*S) + strlen(S->pattern) + 1 + S->namesLength + S->count * (sizeof(struct FileSetEntry_T) + S->digestLength) + S->pendingCount * sizeof(struct Pending_T);
+}
+
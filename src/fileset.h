@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#ifndef MONIT_FILESET_H
+#define MONIT_FILESET_H
+
+#include "monit.h"
+
+
+/**
+ * Compact state of a set of files selected by a glob pattern, used by
+ * the fileset service. Instead of one service object per file, every
+ * matching path is described by a small fixed-size entry and the paths
+ * themselves are packed in one shared buffer. The pattern is expanded
+ * again on each update: new files are added, vanished files are
+ * dropped and the entries of the remaining files are carried over.
+ *
+ * If the pattern has no wildcard and refers to a directory, all files
+ * in the directory are selected. Only regular files are kept.
+ *
+ * @file
+ */
+
+
+#define T FileSet_T
+typedef struct T *T;
+
+
+/** Entry flags. The change flags are valid for the last update only */
+typedef enum {
+        FileSet_New              = 0x1,    /**< Entry appeared in the last update */
+        FileSet_SizeChanged      = 0x2,
+        FileSet_ModeChanged      = 0x4,
+        FileSet_AccessChanged    = 0x8,
+        FileSet_ChangeChanged    = 0x10,
+        FileSet_ModifyChanged    = 0x20,
+        FileSet_ChecksumChanged  = 0x40,   /**< Checksum differs from the previous one */
+        FileSet_ChecksumMismatch = 0x80,   /**< Checksum differs from the expected one */
+        FileSet_ChecksumError    = 0x100,  /**< Checksum cannot be computed */
+        FileSet_Failed           = 0x200   /**< Entry failed at least one test */
+} FileSet_Flags;
+
+
+typedef struct FileSetEntry_T {
+        off_t size;
+        time_t atime;
+        time_t ctime;
+        time_t mtime;
+        uint32_t name;                        /**< Path offset in the name buffer */
+        uint32_t mode;
+        uint32_t uid;
+        uint32_t gid;
+        uint16_t flags;
+} *FileSetEntry_T;
+
+
+/**
+ * Create a new fileset. No I/O is performed until the first call to
+ * FileSet_update()
+ * @param pattern The glob pattern or directory path
+ * @return A new fileset object
+ */
+T FileSet_new(const char *pattern);
+
+
+/**
+ * Destroy the fileset
+ * @param S The fileset object reference
+ */
+void FileSet_free(T *S);
+
+
+/**
+ * Expand the pattern and refresh the entries. If a checksum test is
+ * given, the checksum of an entry is only computed when the file is
+ * seen for the first time or its size or timestamps changed. If the
+ * checksum worker pool is running, the computation is queued and its
+ * result is evaluated by a later update.
+ * @param S The fileset object
+ * @param cs The checksum test or NULL
+ * @return Number of entries or -1 if the pattern cannot be expanded
+ */
+int FileSet_update(T S, Checksum_T cs);
+
+
+/**
+ * @param S The fileset object
+ * @return Number of entries
+ */
+int FileSet_count(T S);
+
+
+/**
+ * Get the entry at the given index. Entries are sorted by path
+ * @param S The fileset object
+ * @param index The entry index in the range 0..FileSet_count()-1
+ * @return The entry
+ */
+FileSetEntry_T FileSet_get(T S, int index);
+
+
+/**
+ * @param S The fileset object
+ * @param e The entry
+ * @return The entry path
+ */
+const char *FileSet_path(T S, FileSetEntry_T e);
+
+
+/**
+ * Get the memory used by the fileset state
+ * @param S The fileset object
+ * @return Allocated size [B]
+ */
+size_t FileSet_memory(T S);
+
+
+#undef T
+#endif
+
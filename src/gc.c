@@ -39,6 +39,10 @@
 #include "protocol.h"
 #include "ProcessTree.h"
 #include "engine.h"
+#include "hashpool.h"
+#include "dirindex.h"
+#include "trend.h"
+#include "fileset.h"
 
 
 /* Private prototypes */
@@ -47,6 +51,8 @@ static void _gc_service(Service_T *);
 static void _gc_servicegroup(ServiceGroup_T *);
 static void _gc_mail_server(MailServer_T *);
 static void _gcportlist(Port_T *);
+static void _gctiminglist(TimingLimit_T *);
+static void _gchttp2streams(Http2Stream_T *);
 static void _gcfilesystem(FileSystem_T *);
 static void _gcicmp(Icmp_T *);
 static void _gcpql(Resource_T *);
@@ -79,6 +85,7 @@ static void _gc_request(Request_T *);
 static void _gcssloptions(SslOptions_T o);
 static void _gcsecattr(SecurityAttribute_T *);
 static void _gcfiledescriptors(Filedescriptors_T *);
+static void _gclisten(Listen_T *);
 
 
 /**
@@ -226,6 +233,8 @@ static void _gc_service(Service_T *s) {
                 _gcbandwidth(&(*s)->downloadbyteslist);
         if ((*s)->downloadpacketslist)
                 _gcbandwidth(&(*s)->downloadpacketslist);
+        if ((*s)->linkcounterlist)
+                _gcbandwidth(&(*s)->linkcounterlist);
         if ((*s)->matchlist)
                 _gcmatch(&(*s)->matchlist);
         if ((*s)->matchignorelist)
@@ -280,8 +289,12 @@ static void _gc_service(Service_T *s) {
                 _gcsecattr(&(*s)->secattrlist);
         if ((*s)->filedescriptorslist)
                 _gcfiledescriptors(&(*s)->filedescriptorslist);
+        if ((*s)->listenlist)
+                _gclisten(&(*s)->listenlist);
         switch ((*s)->type) {
                 case Service_Directory:
+                        if ((*s)->inf.directory->index)
+                                DirIndex_free(&((*s)->inf.directory->index));
                         FREE((*s)->inf.directory);
                         break;
                 case Service_Fifo:
@@ -290,7 +303,16 @@ static void _gc_service(Service_T *s) {
                 case Service_File:
                         FREE((*s)->inf.file);
                         break;
+                case Service_Fileset:
+                        if ((*s)->inf.fileset->set)
+                                FileSet_free(&((*s)->inf.fileset->set));
+                        FREE((*s)->inf.fileset);
+                        break;
                 case Service_Filesystem:
+                        if ((*s)->inf.filesystem->trend.space)
+                                Trend_free(&((*s)->inf.filesystem->trend.space));
+                        if ((*s)->inf.filesystem->trend.inode)
+                                Trend_free(&((*s)->inf.filesystem->trend.inode));
                         FREE((*s)->inf.filesystem);
                         break;
                 case Service_Net:
@@ -383,13 +405,19 @@ static void _gcportlist(Port_T *p) {
                 _gc_eventaction(&(*p)->action);
         if ((*p)->url_request)
                 _gc_request(&(*p)->url_request);
+        if ((*p)->connection)
+                Socket_free(&(*p)->connection);
+        if ((*p)->timinglist)
+                _gctiminglist(&(*p)->timinglist);
+        if ((*p)->probe && --(*p)->probe->references == 0)
+                FREE((*p)->probe);
         if ((*p)->family == Socket_Unix)
                 FREE((*p)->target.unix.pathname);
         else
                 _gcssloptions(&((*p)->target.net.ssl.options));
         FREE((*p)->hostname);
         FREE((*p)->outgoing.ip);
-        if ((*p)->protocol->check == check_http) {
+        if ((*p)->protocol->check == check_http || (*p)->protocol->check == check_http2) {
                 FREE((*p)->parameters.http.username);
                 FREE((*p)->parameters.http.password);
                 FREE((*p)->parameters.http.request);
@@ -402,6 +430,8 @@ static void _gcportlist(Port_T *p) {
                         }
                         List_free(&(*p)->parameters.http.headers);
                 }
+                if ((*p)->parameters.http.streams)
+                        _gchttp2streams(&(*p)->parameters.http.streams);
         } else if ((*p)->protocol->check == check_generic) {
                 if ((*p)->parameters.generic.sendexpect)
                         _gcgeneric(&(*p)->parameters.generic.sendexpect);
@@ -432,6 +462,23 @@ static void _gcportlist(Port_T *p) {
 }
 
 
+static void _gctiminglist(TimingLimit_T *t) {
+        ASSERT(t&&*t);
+        if ((*t)->next)
+                _gctiminglist(&(*t)->next);
+        FREE(*t);
+}
+
+
+static void _gchttp2streams(Http2Stream_T *s) {
+        ASSERT(s&&*s);
+        if ((*s)->next)
+                _gchttp2streams(&(*s)->next);
+        FREE((*s)->request);
+        FREE(*s);
+}
+
+
 static void _gcfilesystem(FileSystem_T *d) {
         ASSERT(d&&*d);
         if ((*d)->next)
@@ -549,6 +596,8 @@ static void _gcmatch(Match_T *s) {
 
 static void _gcchecksum(Checksum_T *s) {
         ASSERT(s);
+        if ((*s)->job)
+                HashPool_cancel((*s)->job);
         if ((*s)->action)
                 _gc_eventaction(&(*s)->action);
         FREE(*s);
@@ -658,6 +707,7 @@ static void _gcgeneric(Generic_T *g) {
         if ((*g)->expect != NULL)
                 regfree((*g)->expect);
         FREE((*g)->expect);
+        FREE((*g)->bytes);
         FREE(*g);
 
 }
@@ -704,3 +754,16 @@ static void _gcfiledescriptors(Filedescriptors_T *o) {
         FREE(*o);
 }
 
+
+static void _gclisten(Listen_T *o) {
+        ASSERT(o && *o);
+        if ((*o)->next)
+                _gclisten(&(*o)->next);
+        if ((*o)->action)
+                _gc_eventaction(&(*o)->action);
+        if ((*o)->addresses)
+                freeaddrinfo((*o)->addresses);
+        FREE((*o)->address);
+        FREE(*o);
+}
+
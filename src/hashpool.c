@@ -0,0 +1,259 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#include "config.h"
+
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#ifdef LINUX
+#include <sys/syscall.h>
+#endif
+
+#include "monit.h"
+#include "md5.h"
+#include "sha1.h"
+#include "sha256.h"
+#include "xxh64.h"
+#include "checksum.h"
+#include "hashpool.h"
+
+// libmonit
+#include "exceptions/AssertException.h"
+
+
+/**
+ * Background checksum computation.
+ *
+ * Jobs are kept in a FIFO queue protected by a single mutex. A job
+ * transitions Queued -> Running -> Done. The owner (the validate thread)
+ * only reads the result of a done job and releases it, a cancelled job
+ * which is running is released by the worker.
+ *
+ * @file
+ */
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+#ifdef SYS_ioprio_set
+#define IOPRIO_CLASS_SHIFT 13
+#define IOPRIO_CLASS_IDLE  3
+#define IOPRIO_WHO_PROCESS 1
+#endif
+
+
+typedef enum {
+        Job_Queued = 0,
+        Job_Running,
+        Job_Done
+} __attribute__((__packed__)) Job_State;
+
+
+#define T HashJob_T
+struct T {
+        char *path;
+        Hash_Type type;
+        Job_State state;
+        bool cancelled;
+        bool succeeded;
+        MD_T hash;
+        T next;
+};
+
+
+static struct {
+        bool running;
+        bool stop;
+        int count;
+        Thread_T *workers;
+        T head;
+        T tail;
+        Mutex_T mutex;
+        Sem_T cond;
+} pool = {.mutex = PTHREAD_MUTEX_INITIALIZER, .cond = PTHREAD_COND_INITIALIZER};
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+static void _free(T *job) {
+        FREE((*job)->path);
+        FREE(*job);
+}
+
+
+static void _setIdlePriority(void) {
+#ifdef SYS_ioprio_set
+        // The "who" 0 applies the priority to the calling thread only
+        if (syscall(SYS_ioprio_set, IOPRIO_WHO_PROCESS, 0, IOPRIO_CLASS_IDLE << IOPRIO_CLASS_SHIFT) == -1)
+                Log_warning("Cannot set idle I/O priority for checksum worker -- %s\n", STRERROR);
+#else
+        Log_warning("Idle I/O priority for checksum workers is not supported on this platform\n");
+#endif
+}
+
+
+static void *_worker(__attribute__ ((unused)) void *args) {
+        set_signal_block();
+        if (Run.limits.checksumIdleIO)
+                _setIdlePriority();
+        Mutex_lock(pool.mutex);
+        while (true) {
+                while (! pool.stop && ! pool.head)
+                        Sem_wait(pool.cond, pool.mutex);
+                if (pool.stop)
+                        break;
+                T job = pool.head;
+                pool.head = job->next;
+                if (! pool.head)
+                        pool.tail = NULL;
+                job->next = NULL;
+                job->state = Job_Running;
+                Mutex_unlock(pool.mutex);
+                MD_T hash = {};
+                bool succeeded = Checksum_getChecksum(job->path, job->type, hash, sizeof(hash));
+                Mutex_lock(pool.mutex);
+                if (job->cancelled) {
+                        _free(&job);
+                } else {
+                        snprintf(job->hash, sizeof(job->hash), "%s", hash);
+                        job->succeeded = succeeded;
+                        job->state = Job_Done;
+                }
+        }
+        Mutex_unlock(pool.mutex);
+        return NULL;
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+void HashPool_start(void) {
+        ASSERT(! pool.running);
+        if (Run.limits.checksumWorkers == 0)
+                return;
+        pool.stop = false;
+        pool.count = Run.limits.checksumWorkers;
+        pool.workers = CALLOC(pool.count, sizeof(Thread_T));
+        for (int i = 0; i < pool.count; i++)
+                Thread_create(pool.workers[i], _worker, NULL);
+        pool.running = true;
+        DEBUG("Checksum pool started with %d worker%s\n", pool.count, pool.count > 1 ? "s" : "");
+}
+
+
+void HashPool_stop(void) {
+        if (! pool.running)
+                return;
+        Mutex_lock(pool.mutex);
+        pool.stop = true;
+        Sem_broadcast(pool.cond);
+        Mutex_unlock(pool.mutex);
+        for (int i = 0; i < pool.count; i++)
+                Thread_join(pool.workers[i]);
+        FREE(pool.workers);
+        pool.count = 0;
+        pool.running = false;
+}
+
+
+bool HashPool_isRunning(void) {
+        return pool.running;
+}
+
+
+T HashPool_submit(const char *path, Hash_Type type) {
+        ASSERT(path);
+        T job;
+        NEW(job);
+        job->path = Str_dup(path);
+        job->type = type;
+        Mutex_lock(pool.mutex);
+        if (pool.tail)
+                pool.tail->next = job;
+        else
+                pool.head = job;
+        pool.tail = job;
+        Sem_signal(pool.cond);
+        Mutex_unlock(pool.mutex);
+        return job;
+}
+
+
+bool HashPool_poll(T job, MD_T hash, bool *succeeded) {
+        ASSERT(job);
+        ASSERT(succeeded);
+        bool done = false;
+        Mutex_lock(pool.mutex);
+        if (job->state == Job_Done) {
+                snprintf(hash, sizeof(MD_T), "%s", job->hash);
+                *succeeded = job->succeeded;
+                _free(&job);
+                done = true;
+        }
+        Mutex_unlock(pool.mutex);
+        return done;
+}
+
+
+void HashPool_cancel(T job) {
+        ASSERT(job);
+        Mutex_lock(pool.mutex);
+        if (job->state == Job_Queued) {
+                // Unlink from the queue
+                T prev = NULL;
+                for (T j = pool.head; j; prev = j, j = j->next) {
+                        if (j == job) {
+                                if (prev)
+                                        prev->next = j->next;
+                                else
+                                        pool.head = j->next;
+                                if (pool.tail == j)
+                                        pool.tail = prev;
+                                break;
+                        }
+                }
+                _free(&job);
+        } else if (job->state == Job_Running) {
+                job->cancelled = true;
+        } else {
+                _free(&job);
+        }
+        Mutex_unlock(pool.mutex);
+}
+
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#ifndef MONIT_HASHPOOL_H
+#define MONIT_HASHPOOL_H
+
+#include "monit.h"
+
+
+/**
+ * A bounded pool of worker threads computing file checksums in the
+ * background, so the validate cycle doesn't wait for large files to be
+ * read. A service submits a job and polls for the result in subsequent
+ * cycles. Jobs are owned by the pool: a job is released either by
+ * HashPool_poll() once its result was collected or by HashPool_cancel().
+ *
+ * @file
+ */
+
+
+#define T HashJob_T
+typedef struct T *T;
+
+
+/**
+ * Start the worker threads. The pool size and I/O priority are taken
+ * from Run.limits. If the number of workers is 0, the pool is not
+ * started and HashPool_isRunning() returns false.
+ */
+void HashPool_start(void);
+
+
+/**
+ * Stop and join the worker threads. A job which is being processed is
+ * finished first, queued jobs are kept and must be released with
+ * HashPool_cancel()
+ */
+void HashPool_stop(void);
+
+
+/**
+ * Test if the pool accepts jobs
+ * @return true if the worker threads are running, otherwise false
+ */
+bool HashPool_isRunning(void);
+
+
+/**
+ * Queue a checksum computation for the given file
+ * @param path The file for which to compute the checksum
+ * @param type The hash type
+ * @return A job handle to be used with HashPool_poll()
+ */
+T HashPool_submit(const char *path, Hash_Type type);
+
+
+/**
+ * Collect the result of a job. If the job is done, it is released and
+ * must not be used anymore.
+ * @param job The job handle
+ * @param hash Buffer for the hex encoded checksum
+ * @param succeeded Set to true if the checksum was computed, false on error
+ * @return true if the job is done, false if it's still pending
+ */
+bool HashPool_poll(T job, MD_T hash, bool *succeeded);
+
+
+/**
+ * Release a job regardless of its state. A job which is being processed
+ * is released by the worker when it finishes.
+ * @param job The job handle
+ */
+void HashPool_cancel(T job);
+
+
+#undef T
+#endif
+
@@ -85,6 +85,7 @@
 #include "protocol.h"
 #include "Color.h"
 #include "Box.h"
+#include "net/Resolver.h"
 
 
 #define ACTION(c) ! strncasecmp(req->url, c, sizeof(c))
@@ -125,6 +126,7 @@ static void do_home_filesystem(HttpResponse);
 static void do_home_directory(HttpResponse);
 static void do_home_file(HttpResponse);
 static void do_home_fifo(HttpResponse);
+static void do_home_fileset(HttpResponse);
 static void do_home_net(HttpResponse);
 static void do_home_process(HttpResponse);
 static void do_home_program(HttpResponse);
@@ -164,6 +166,7 @@ static void print_service_rules_uploadbytes(HttpResponse, Service_T);
 static void print_service_rules_uploadpackets(HttpResponse, Service_T);
 static void print_service_rules_downloadbytes(HttpResponse, Service_T);
 static void print_service_rules_downloadpackets(HttpResponse, Service_T);
+static void print_service_rules_linkcounters(HttpResponse, Service_T);
 static void print_service_rules_uptime(HttpResponse, Service_T);
 static void print_service_rules_content(HttpResponse, Service_T);
 static void print_service_rules_checksum(HttpResponse, Service_T);
@@ -173,6 +176,7 @@ static void print_service_rules_program(HttpResponse, Service_T);
 static void print_service_rules_resource(HttpResponse, Service_T);
 static void print_service_rules_secattr(HttpResponse, Service_T);
 static void print_service_rules_filedescriptors(HttpResponse, Service_T);
+static void print_service_rules_listen(HttpResponse, Service_T);
 static void print_status(HttpRequest, HttpResponse, int);
 static void print_summary(HttpRequest, HttpResponse);
 static void _printReport(HttpRequest req, HttpResponse res);
@@ -339,6 +343,15 @@ static void _printStatus(Output_Type type, HttpResponse res, Service_T s) {
                                                 else
                                                         _formatStatus("filedescriptors", Event_Resource, type, res, s, true, "N/A");
                                         }
+                                        if (systeminfo.statisticsAvailable & Statistics_NetworkStack) {
+                                                unsigned long long segments = Statistics_delta(&(systeminfo.netstack.tcp.segments));
+                                                _formatStatus("tcp retransmits", Event_Resource, type, res, s, Statistics_initialized(&(systeminfo.netstack.tcp.retransmits)), "%.1f/s [%.1f%% of sent segments]", Statistics_deltaNormalize(&(systeminfo.netstack.tcp.retransmits)), segments ? 100. * (double)Statistics_delta(&(systeminfo.netstack.tcp.retransmits)) / (double)segments : 0.);
+                                                _formatStatus("tcp listen overflows", Event_Resource, type, res, s, Statistics_initialized(&(systeminfo.netstack.tcp.listenOverflows)), "%.1f/s", Statistics_deltaNormalize(&(systeminfo.netstack.tcp.listenOverflows)));
+                                                _formatStatus("tcp listen drops", Event_Resource, type, res, s, Statistics_initialized(&(systeminfo.netstack.tcp.listenDrops)), "%.1f/s", Statistics_deltaNormalize(&(systeminfo.netstack.tcp.listenDrops)));
+                                                _formatStatus("tcp syn cookies", Event_Resource, type, res, s, Statistics_initialized(&(systeminfo.netstack.tcp.synCookies)), "%.1f/s", Statistics_deltaNormalize(&(systeminfo.netstack.tcp.synCookies)));
+                                                _formatStatus("tcp sockets", Event_Resource, type, res, s, systeminfo.netstack.tcp.orphans >= 0, "%lld orphaned, %lld time-wait", systeminfo.netstack.tcp.orphans, systeminfo.netstack.tcp.timeWait);
+                                                _formatStatus("udp receive buffer errors", Event_Resource, type, res, s, Statistics_initialized(&(systeminfo.netstack.udp.receiveBufferErrors)), "%.1f/s", Statistics_deltaNormalize(&(systeminfo.netstack.udp.receiveBufferErrors)));
+                                        }
                                 }
                                 break;
 
@@ -363,6 +376,19 @@ static void _printStatus(Output_Type type, HttpResponse res, Service_T s) {
                                 _formatStatus("access timestamp", Event_Timestamp, type, res, s, s->inf.directory->timestamp.access > 0, "%s", Time_string(s->inf.directory->timestamp.access, (char[32]){}));
                                 _formatStatus("change timestamp", Event_Timestamp, type, res, s, s->inf.directory->timestamp.change > 0, "%s", Time_string(s->inf.directory->timestamp.change, (char[32]){}));
                                 _formatStatus("modify timestamp", Event_Timestamp, type, res, s, s->inf.directory->timestamp.modify > 0, "%s", Time_string(s->inf.directory->timestamp.modify, (char[32]){}));
+                                if (s->resourcelist) {
+                                        _formatStatus("entries", Event_Resource, type, res, s, s->inf.directory->entries >= 0, "%lld", s->inf.directory->entries);
+                                        _formatStatus("total size", Event_Resource, type, res, s, s->inf.directory->size >= 0, "%s", Convert_bytes2str(s->inf.directory->size, (char[10]){}));
+                                        _formatStatus("oldest entry", Event_Resource, type, res, s, s->inf.directory->oldest > 0, "%s", Time_string(s->inf.directory->oldest, (char[32]){}));
+                                }
+                                break;
+
+                        case Service_Fileset:
+                                _formatStatus("files", Event_NonExist, type, res, s, s->inf.fileset->entries >= 0, "%d", s->inf.fileset->entries);
+                                _formatStatus("failed files", Event_Null, type, res, s, s->inf.fileset->entries >= 0, "%d", s->inf.fileset->failed);
+                                _formatStatus("total size", Event_Size, type, res, s, s->inf.fileset->size >= 0, "%s", Convert_bytes2str(s->inf.fileset->size, (char[10]){}));
+                                if (s->checksum)
+                                        _formatStatus("checksum", Event_Checksum, type, res, s, s->inf.fileset->entries >= 0, "%s", checksumnames[s->checksum->type]);
                                 break;
 
                         case Service_Fifo:
@@ -390,6 +416,11 @@ static void _printStatus(Output_Type type, HttpResponse res, Service_T s) {
                                         }
                                         _formatStatus("download packets", Event_PacketIn, type, res, s, Link_getState(s->inf.net->stats) == 1, "%lld per second", Link_getPacketsInPerSecond(s->inf.net->stats));
                                         _formatStatus("upload packets", Event_PacketOut, type, res, s, Link_getState(s->inf.net->stats) == 1, "%lld per second", Link_getPacketsOutPerSecond(s->inf.net->stats));
+                                        for (LinkCounter_Type i = 0; i < LinkCounter_Count; i++) {
+                                                long long value = Link_getCounterPerSecond(s->inf.net->stats, i);
+                                                if (value >= 0)
+                                                        _formatStatus(Link_getCounterName(i), i == LinkCounter_DropsIn || i == LinkCounter_MissedIn || i == LinkCounter_FifoIn || i == LinkCounter_MulticastIn ? Event_PacketIn : Event_PacketOut, type, res, s, true, "%lld per second", value);
+                                        }
                                 }
                                 break;
 
@@ -409,10 +440,14 @@ static void _printStatus(Output_Type type, HttpResponse res, Service_T s) {
                                 _formatStatus("space free total", Event_Resource, type, res, s, true, "%s [%.1f%%]",
                                         s->inf.filesystem->f_bsize > 0 ? Convert_bytes2str(s->inf.filesystem->f_blocksfreetotal * s->inf.filesystem->f_bsize, (char[10]){}) : "0 MB",
                                         s->inf.filesystem->f_blocks > 0 ? ((float)100 * (float)s->inf.filesystem->f_blocksfreetotal / (float)s->inf.filesystem->f_blocks) : 0);
+                                if (s->inf.filesystem->timeToFull.space >= 0)
+                                        _formatStatus("space time-to-full", Event_Resource, type, res, s, true, "%s", Convert_time2str(s->inf.filesystem->timeToFull.space * 1000., (char[11]){}));
                                 if (s->inf.filesystem->f_files > 0) {
                                         _formatStatus("inodes total", Event_Null, type, res, s, true, "%lld", s->inf.filesystem->f_files);
                                         if (s->inf.filesystem->f_filesfree > 0)
                                                 _formatStatus("inodes free", Event_Resource, type, res, s, true, "%lld [%.1f%%]", s->inf.filesystem->f_filesfree, (float)100 * (float)s->inf.filesystem->f_filesfree / (float)s->inf.filesystem->f_files);
+                                        if (s->inf.filesystem->timeToFull.inode >= 0)
+                                                _formatStatus("inodes time-to-full", Event_Resource, type, res, s, true, "%s", Convert_time2str(s->inf.filesystem->timeToFull.inode * 1000., (char[11]){}));
                                 }
                                 _printIOStatistics(type, res, s, &(s->inf.filesystem->read), "read");
                                 _printIOStatistics(type, res, s, &(s->inf.filesystem->write), "write");
@@ -436,6 +471,23 @@ static void _printStatus(Output_Type type, HttpResponse res, Service_T s) {
                                         double runTime = deltaOperations > 0. ? Statistics_deltaNormalize(&(s->inf.filesystem->time.run)) / deltaOperations : 0.;
                                         _formatStatus("service time", Event_Null, type, res, s, true, "%.3fms/operation", runTime);
                                 }
+                                double readLatency = Filesystem_getLatency(&(s->inf.filesystem->read), &(s->inf.filesystem->time.read));
+                                double writeLatency = Filesystem_getLatency(&(s->inf.filesystem->write), &(s->inf.filesystem->time.write));
+                                if (readLatency >= 0. && writeLatency >= 0.)
+                                        _formatStatus("latency", Event_Resource, type, res, s, true, "read %.3fms/operation, write %.3fms/operation", readLatency, writeLatency);
+                                else if (readLatency >= 0.)
+                                        _formatStatus("latency", Event_Resource, type, res, s, true, "read %.3fms/operation", readLatency);
+                                else if (writeLatency >= 0.)
+                                        _formatStatus("latency", Event_Resource, type, res, s, true, "write %.3fms/operation", writeLatency);
+                                double iops = Filesystem_getIOPS(&(s->inf));
+                                if (iops >= 0.)
+                                        _formatStatus("iops", Event_Resource, type, res, s, true, "%.1f operations/s", iops);
+                                double utilization = Filesystem_getUtilization(&(s->inf));
+                                if (utilization >= 0.)
+                                        _formatStatus("utilization", Event_Resource, type, res, s, true, "%.1f%%", utilization);
+                                double queueDepth = Filesystem_getQueueDepth(&(s->inf));
+                                if (queueDepth >= 0.)
+                                        _formatStatus("queue depth", Event_Resource, type, res, s, true, "%.2f (%lld in flight)", queueDepth, s->inf.filesystem->inFlight);
                                 break;
 
                         case Service_Process:
@@ -480,7 +532,7 @@ static void _printStatus(Output_Type type, HttpResponse res, Service_T s) {
                         if (i->is_available == Connection_Failed)
                                 _formatStatus("ping response time", Event_Icmp, type, res, s, true, "connection failed");
                         else
-                                _formatStatus("ping response time", Event_Null, type, res, s, i->is_available != Connection_Init && i->response >= 0., "%s", Convert_time2str(i->response, (char[11]){}));
+                                _formatStatus("ping response time", Event_Null, type, res, s, i->is_available != Connection_Init && i->response >= 0., "%s [jitter %s, loss %.0f%%]", Convert_time2str(i->response, (char[11]){}), Convert_time2str(i->jitter, (char[11]){}), i->loss);
                 }
                 for (Port_T p = s->portlist; p; p = p->next) {
                         if (p->is_available == Connection_Failed) {
@@ -491,6 +543,26 @@ static void _printStatus(Output_Type type, HttpResponse res, Service_T s) {
                                         snprintf(buf, sizeof(buf), "using TLS (certificate valid for %d days) ", p->target.net.ssl.certificate.validDays);
                                 _formatStatus("port response time", p->target.net.ssl.certificate.validDays < p->target.net.ssl.certificate.minimumDays ? Event_Timestamp : Event_Null, type, res, s, p->is_available != Connection_Init, "%s to %s:%d%s type %s/%s %sprotocol %s", Convert_time2str(p->response, (char[11]){}), p->hostname, p->target.net.port, Util_portRequestDescription(p), Util_portTypeDescription(p), Util_portIpDescription(p), buf, p->protocol->name);
                         }
+                        char timing[STRLEN];
+                        if (*Util_portTiming(p, timing, sizeof(timing)))
+                                _formatStatus("port timing", Event_Null, type, res, s, true, "%s", timing);
+                        if (p->protocol->check == check_http2 && p->is_available != Connection_Init)
+                                for (Http2Stream_T stream = p->parameters.http.streams; stream; stream = stream->next)
+                                        _formatStatus("port stream", Event_Null, type, res, s, true, "%s", Util_http2StreamDescription(stream, (char[STRLEN]){}, STRLEN));
+                }
+                for (Listen_T l = s->listenlist; l; l = l->next) {
+                        // Show each listening socket once, even if there are several rules for it
+                        bool shown = false;
+                        for (Listen_T p = s->listenlist; p != l && ! shown; p = p->next)
+                                shown = p->port == l->port && (p->address == l->address || IS(p->address, l->address));
+                        if (shown)
+                                continue;
+                        char where[STRLEN];
+                        Util_listenDescription(l, where, sizeof(where));
+                        if (l->found)
+                                _formatStatus("listen", Event_Null, type, res, s, true, "%s accept queue %lld of %lld, %lld established", where, l->info.queue, l->info.backlog, l->info.established);
+                        else
+                                _formatStatus("listen", Event_Connection, type, res, s, l->info.established >= 0, "%s not listening", where);
                 }
                 for (Port_T p = s->socketlist; p; p = p->next) {
                         if (p->is_available == Connection_Failed) {
@@ -498,6 +570,12 @@ static void _printStatus(Output_Type type, HttpResponse res, Service_T s) {
                         } else {
                                 _formatStatus("unix socket response time", Event_Null, type, res, s, p->is_available != Connection_Init, "%s to %s type %s protocol %s", Convert_time2str(p->response, (char[11]){}), p->target.unix.pathname, Util_portTypeDescription(p), p->protocol->name);
                         }
+                        char timing[STRLEN];
+                        if (*Util_portTiming(p, timing, sizeof(timing)))
+                                _formatStatus("unix socket timing", Event_Null, type, res, s, true, "%s", timing);
+                        if (p->protocol->check == check_http2 && p->is_available != Connection_Init)
+                                for (Http2Stream_T stream = p->parameters.http.streams; stream; stream = stream->next)
+                                        _formatStatus("unix socket stream", Event_Null, type, res, s, true, "%s", Util_http2StreamDescription(stream, (char[STRLEN]){}, STRLEN));
                 }
         }
         _formatStatus("data collected", Event_Null, type, res, s, true, "%s", Time_string(s->collected.tv_sec, (char[32]){}));
@@ -741,6 +819,7 @@ static void do_home(HttpResponse res) {
         do_home_filesystem(res);
         do_home_file(res);
         do_home_fifo(res);
+        do_home_fileset(res);
         do_home_directory(res);
         do_home_net(res);
         do_home_host(res);
@@ -887,6 +966,14 @@ static void do_runtime(HttpRequest req, HttpResponse res) {
         _displayTableRow(res, false, NULL, "Limit for service stop timeout",    "%s", Convert_time2str(Run.limits.stopTimeout, (char[11]){}));
         _displayTableRow(res, false, NULL, "Limit for service start timeout",   "%s", Convert_time2str(Run.limits.startTimeout, (char[11]){}));
         _displayTableRow(res, false, NULL, "Limit for service restart timeout", "%s", Convert_time2str(Run.limits.restartTimeout, (char[11]){}));
+        if (Run.limits.dnsTtl) {
+                Resolver_Statistics_T dns;
+                Resolver_statistics(&dns);
+                _displayTableRow(res, false, NULL, "DNS cache time to live",    "%s (failures %s)", Convert_time2str(Run.limits.dnsTtl * 1000., (char[11]){}), Convert_time2str(Run.limits.dnsNegativeTtl * 1000., (char[11]){}));
+                _displayTableRow(res, false, NULL, "DNS cache",                 "%d names, %llu hits, %llu misses, %llu negative hits, %llu refreshes", dns.entries, dns.hits, dns.misses, dns.negativeHits, dns.refreshes);
+        } else {
+                _displayTableRow(res, false, NULL, "DNS cache",                 "disabled");
+        }
         _displayTableRow(res, false, NULL, "On reboot",                         "%s", onrebootnames[Run.onreboot]);
         _displayTableRow(res, false, NULL, "Poll time",                         "%d seconds with start delay %d seconds", Run.polltime, Run.startdelay);
         if (Run.httpd.flags & Httpd_Net) {
@@ -1155,6 +1242,7 @@ static void do_service(HttpRequest req, HttpResponse res, Service_T s) {
         print_service_rules_icmp(res, s);
         print_service_rules_port(res, s);
         print_service_rules_socket(res, s);
+        print_service_rules_listen(res, s);
         print_service_rules_perm(res, s);
         print_service_rules_uid(res, s);
         print_service_rules_euid(res, s);
@@ -1172,6 +1260,7 @@ static void do_service(HttpRequest req, HttpResponse res, Service_T s) {
         print_service_rules_uploadpackets(res, s);
         print_service_rules_downloadbytes(res, s);
         print_service_rules_downloadpackets(res, s);
+        print_service_rules_linkcounters(res, s);
         print_service_rules_uptime(res, s);
         print_service_rules_content(res, s);
         print_service_rules_checksum(res, s);
@@ -1530,6 +1619,46 @@ static void do_home_file(HttpResponse res) {
 }
 
 
+static void do_home_fileset(HttpResponse res) {
+        char buf[STRLEN];
+        bool on = true;
+        bool header = true;
+
+        for (Service_T s = servicelist_conf; s; s = s->next_conf) {
+                if (s->type != Service_Fileset)
+                        continue;
+                if (header) {
+                        StringBuffer_append(res->outputbuffer,
+                                            "<table id='header-row'>"
+                                            "<tr>"
+                                            "<th class='left first'>Fileset</th>"
+                                            "<th class='left'>Status</th>"
+                                            "<th class='right'>Files</th>"
+                                            "<th class='right'>Failed</th>"
+                                            "<th class='right'>Total size</th>"
+                                            "</tr>");
+
+                        header = false;
+                }
+                StringBuffer_append(res->outputbuffer,
+                                    "<tr %s>"
+                                    "<td class='left'><a href='%s'>%s</a></td>"
+                                    "<td class='left'>%s</td>",
+                                    on ? "class='stripe'" : "",
+                                    s->name_urlescaped, StringBuffer_toString(s->name_htmlescaped),
+                                    get_service_status(HTML, s, buf, sizeof(buf)));
+                if (! Util_hasServiceStatus(s) || s->inf.fileset->entries < 0)
+                        StringBuffer_append(res->outputbuffer, "<td class='right'>-</td><td class='right'>-</td><td class='right'>-</td>");
+                else
+                        StringBuffer_append(res->outputbuffer, "<td class='right'>%d</td><td class='right'>%d</td><td class='right'>%s</td>", s->inf.fileset->entries, s->inf.fileset->failed, Convert_bytes2str(s->inf.fileset->size, (char[10]){}));
+                StringBuffer_append(res->outputbuffer, "</tr>");
+                on = ! on;
+        }
+        if (! header)
+                StringBuffer_append(res->outputbuffer, "</table>");
+}
+
+
 static void do_home_fifo(HttpResponse res) {
         char buf[STRLEN];
         bool on = true;
@@ -1868,10 +1997,16 @@ static void print_service_rules_port(HttpResponse res, Service_T s) {
                         p->hostname, p->target.net.port, Util_portRequestDescription(p));
                 if (p->outgoing.ip)
                         StringBuffer_append(buf, " via address %s", p->outgoing.ip);
-                StringBuffer_append(buf, " type %s/%s protocol %s with timeout %s",
-                        Util_portTypeDescription(p), Util_portIpDescription(p), p->protocol->name, Convert_time2str(p->timeout, (char[11]){}));
+                StringBuffer_append(buf, " type %s/%s protocol %s%s with timeout %s",
+                        Util_portTypeDescription(p), Util_portIpDescription(p), p->protocol->name, Util_portHttp2Requests(p, (char[STRLEN]){}, STRLEN), Convert_time2str(p->timeout, (char[11]){}));
                 if (p->retry > 1)
                         StringBuffer_append(buf, " and retry %d times", p->retry);
+                if (p->timinglist)
+                        StringBuffer_append(buf, "%s", Util_portTimingLimits(p, (char[STRLEN]){}, STRLEN));
+                if (p->persistent)
+                        StringBuffer_append(buf, " using persistent connection");
+                if (p->probe)
+                        StringBuffer_append(buf, " (probe shared by %d tests)", p->probe->references);
 #ifdef HAVE_OPENSSL
                 if (p->target.net.ssl.options.flags) {
                         StringBuffer_append(buf, " using TLS");
@@ -1895,9 +2030,9 @@ static void print_service_rules_socket(HttpResponse res, Service_T s) {
         for (Port_T p = s->socketlist; p; p = p->next) {
                 StringBuffer_T sb = StringBuffer_create(256);
                 if (p->retry > 1)
-                        Util_printRule(sb, p->action, "If failed %s type %s protocol %s with timeout %s and retry %d time(s)", p->target.unix.pathname, Util_portTypeDescription(p), p->protocol->name, Convert_time2str(p->timeout, (char[11]){}), p->retry);
+                        Util_printRule(sb, p->action, "If failed %s type %s protocol %s with timeout %s and retry %d time(s)%s%s", p->target.unix.pathname, Util_portTypeDescription(p), p->protocol->name, Convert_time2str(p->timeout, (char[11]){}), p->retry, Util_portTimingLimits(p, (char[STRLEN]){}, STRLEN), p->persistent ? " using persistent connection" : "");
                 else
-                        Util_printRule(sb, p->action, "If failed %s type %s protocol %s with timeout %s", p->target.unix.pathname, Util_portTypeDescription(p), p->protocol->name, Convert_time2str(p->timeout, (char[11]){}));
+                        Util_printRule(sb, p->action, "If failed %s type %s protocol %s with timeout %s%s%s", p->target.unix.pathname, Util_portTypeDescription(p), p->protocol->name, Convert_time2str(p->timeout, (char[11]){}), Util_portTimingLimits(p, (char[STRLEN]){}, STRLEN), p->persistent ? " using persistent connection" : "");
                 _displayTableRow(res, true, "rule", "Unix Socket", "%s", StringBuffer_toString(sb));
                 StringBuffer_free(&sb);
         }
@@ -1972,6 +2107,24 @@ static void print_service_rules_filedescriptors(HttpResponse res, Service_T s) {
 }
 
 
+static void print_service_rules_listen(HttpResponse res, Service_T s) {
+        for (Listen_T o = s->listenlist; o; o = o->next) {
+                char where[STRLEN];
+                StringBuffer_T sb = StringBuffer_create(256);
+                Util_listenDescription(o, where, sizeof(where));
+                if (o->type == ListenTest_Exist)
+                        _displayTableRow(res, true, "rule", "Listen", "%s", StringBuffer_toString(Util_printRule(sb, o->action, "If not listening on %s", where)));
+                else if (o->type == ListenTest_Established)
+                        _displayTableRow(res, true, "rule", "Established", "%s", StringBuffer_toString(Util_printRule(sb, o->action, "If on %s %s %lld", where, operatornames[o->operator], o->limit_absolute)));
+                else if (o->limit_absolute > -1LL)
+                        _displayTableRow(res, true, "rule", "Listen queue", "%s", StringBuffer_toString(Util_printRule(sb, o->action, "If on %s %s %lld", where, operatornames[o->operator], o->limit_absolute)));
+                else
+                        _displayTableRow(res, true, "rule", "Listen queue", "%s", StringBuffer_toString(Util_printRule(sb, o->action, "If on %s %s %.1f%% of backlog", where, operatornames[o->operator], o->limit_percent)));
+                StringBuffer_free(&sb);
+        }
+}
+
+
 static void print_service_rules_gid(HttpResponse res, Service_T s) {
         if (s->gid) {
                 StringBuffer_T sb = StringBuffer_create(256);
@@ -2061,6 +2214,27 @@ static void print_service_rules_filesystem(HttpResponse res, Service_T s) {
                 case Resource_ServiceTime:
                         _displayTableRow(res, true, "rule", "Service time limit", "%s", StringBuffer_toString(Util_printRule(sb, dl->action, "If service time %s %s/operation", operatornames[dl->operator], Convert_time2str(dl->limit_absolute, (char[11]){}))));
                         break;
+                case Resource_ReadLatency:
+                        _displayTableRow(res, true, "rule", "Read latency limit", "%s", StringBuffer_toString(Util_printRule(sb, dl->action, "If read latency %s %s/operation", operatornames[dl->operator], Convert_time2str(dl->limit_absolute, (char[11]){}))));
+                        break;
+                case Resource_WriteLatency:
+                        _displayTableRow(res, true, "rule", "Write latency limit", "%s", StringBuffer_toString(Util_printRule(sb, dl->action, "If write latency %s %s/operation", operatornames[dl->operator], Convert_time2str(dl->limit_absolute, (char[11]){}))));
+                        break;
+                case Resource_Utilization:
+                        _displayTableRow(res, true, "rule", "Utilization limit", "%s", StringBuffer_toString(Util_printRule(sb, dl->action, "If utilization %s %.1f%%", operatornames[dl->operator], dl->limit_percent)));
+                        break;
+                case Resource_QueueDepth:
+                        _displayTableRow(res, true, "rule", "Queue depth limit", "%s", StringBuffer_toString(Util_printRule(sb, dl->action, "If queue depth %s %.2f", operatornames[dl->operator], dl->limit_percent)));
+                        break;
+                case Resource_SpaceTimeToFull:
+                        _displayTableRow(res, true, "rule", "Space time-to-full", "%s", StringBuffer_toString(Util_printRule(sb, dl->action, "If space time-to-full %s %s over %s", operatornames[dl->operator], Convert_time2str(dl->limit_absolute * 1000., (char[11]){}), Convert_time2str(dl->window * 1000., (char[11]){}))));
+                        break;
+                case Resource_InodeTimeToFull:
+                        _displayTableRow(res, true, "rule", "Inode time-to-full", "%s", StringBuffer_toString(Util_printRule(sb, dl->action, "If inode time-to-full %s %s over %s", operatornames[dl->operator], Convert_time2str(dl->limit_absolute * 1000., (char[11]){}), Convert_time2str(dl->window * 1000., (char[11]){}))));
+                        break;
+                case Resource_Iops:
+                        _displayTableRow(res, true, "rule", "IOPS limit", "%s", StringBuffer_toString(Util_printRule(sb, dl->action, "If iops %s %llu operations/s", operatornames[dl->operator], dl->limit_absolute)));
+                        break;
                 default:
                         break;
                 }
@@ -2157,6 +2331,18 @@ static void print_service_rules_downloadpackets(HttpResponse res, Service_T s) {
 }
 
 
+static void print_service_rules_linkcounters(HttpResponse res, Service_T s) {
+        for (Bandwidth_T bl = s->linkcounterlist; bl; bl = bl->next) {
+                StringBuffer_T sb = StringBuffer_create(256);
+                if (bl->range == Time_Second)
+                        _displayTableRow(res, true, "rule", "Link counter", "%s", StringBuffer_toString(Util_printRule(sb, bl->action, "If %s %s %lld/s", Link_getCounterName(bl->counter), operatornames[bl->operator], bl->limit)));
+                else
+                        _displayTableRow(res, true, "rule", "Total link counter", "%s", StringBuffer_toString(Util_printRule(sb, bl->action, "If %s %s %lld in last %d %s(s)", Link_getCounterName(bl->counter), operatornames[bl->operator], bl->limit, bl->rangecount, Util_timestr(bl->range))));
+                StringBuffer_free(&sb);
+        }
+}
+
+
 static void print_service_rules_uptime(HttpResponse res, Service_T s) {
         for (Uptime_T ul = s->uptimelist; ul; ul = ul->next) {
                 StringBuffer_T sb = StringBuffer_create(256);
@@ -2350,6 +2536,47 @@ static void print_service_rules_resource(HttpResponse res, Service_T s) {
                                 key = "Disk write limit";
                                 break;
 
+                        case Resource_DirectoryEntries:
+                                key = "Entries limit";
+                                break;
+
+                        case Resource_DirectorySize:
+                                key = "Total size limit";
+                                break;
+
+                        case Resource_DirectoryOldest:
+                                key = "Oldest entry limit";
+                                break;
+
+                        case Resource_TcpRetransmits:
+                        case Resource_TcpRetransmitsPercent:
+                                key = "TCP retransmits limit";
+                                break;
+
+                        case Resource_TcpListenOverflows:
+                                key = "TCP listen overflows limit";
+                                break;
+
+                        case Resource_TcpListenDrops:
+                                key = "TCP listen drops limit";
+                                break;
+
+                        case Resource_TcpSynCookies:
+                                key = "TCP SYN cookies limit";
+                                break;
+
+                        case Resource_TcpOrphans:
+                                key = "TCP orphaned sockets limit";
+                                break;
+
+                        case Resource_TcpTimeWait:
+                                key = "TCP TIME_WAIT sockets limit";
+                                break;
+
+                        case Resource_UdpReceiveBufferErrors:
+                                key = "UDP receive buffer errors limit";
+                                break;
+
                         default:
                                 break;
                 }
@@ -2388,6 +2615,32 @@ static void print_service_rules_resource(HttpResponse res, Service_T s) {
 
                         case Resource_Threads:
                         case Resource_Children:
+                        case Resource_DirectoryEntries:
+                                Util_printRule(sb, q->action, "If %s %.0f", operatornames[q->operator], q->limit);
+                                break;
+
+                        case Resource_DirectorySize:
+                                Util_printRule(sb, q->action, "If %s %s", operatornames[q->operator], Convert_bytes2str(q->limit, buf));
+                                break;
+
+                        case Resource_DirectoryOldest:
+                                Util_printRule(sb, q->action, "If %s %s", operatornames[q->operator], Convert_time2str(q->limit * 1000., buf));
+                                break;
+
+                        case Resource_TcpRetransmitsPercent:
+                                Util_printRule(sb, q->action, "If %s %.1f%%", operatornames[q->operator], q->limit);
+                                break;
+
+                        case Resource_TcpRetransmits:
+                        case Resource_TcpListenOverflows:
+                        case Resource_TcpListenDrops:
+                        case Resource_TcpSynCookies:
+                        case Resource_UdpReceiveBufferErrors:
+                                Util_printRule(sb, q->action, "If %s %.0f/s", operatornames[q->operator], q->limit);
+                                break;
+
+                        case Resource_TcpOrphans:
+                        case Resource_TcpTimeWait:
                                 Util_printRule(sb, q->action, "If %s %.0f", operatornames[q->operator], q->limit);
                                 break;
 
@@ -2528,6 +2781,7 @@ static void print_summary(HttpRequest req, HttpResponse res) {
                 found += _printServiceSummaryByType(t, Service_Process);
                 found += _printServiceSummaryByType(t, Service_File);
                 found += _printServiceSummaryByType(t, Service_Fifo);
+                found += _printServiceSummaryByType(t, Service_Fileset);
                 found += _printServiceSummaryByType(t, Service_Directory);
                 found += _printServiceSummaryByType(t, Service_Filesystem);
                 found += _printServiceSummaryByType(t, Service_Host);
@@ -57,6 +57,7 @@
 #include "event.h"
 #include "ProcessTree.h"
 #include "protocol.h"
+#include "device.h"
 
 
 /**
@@ -189,6 +190,47 @@ static void _ioStatistics(StringBuffer_T B, const char *name, IOStatistics_T sta
 }
 
 
+static void _printTiming(StringBuffer_T B, Port_T p) {
+        if (p->is_available == Connection_Init)
+                return;
+        StringBuffer_append(B,
+                "<timing>"
+                "<dns>%.3f</dns>"             // milliseconds, -1 if not measured
+                "<connect>%.3f</connect>"
+                "<tls>%.3f</tls>"
+                "<request>%.3f</request>"
+                "<firstbyte>%.3f</firstbyte>"
+                "<total>%.3f</total>"
+                "<rtt>%.3f</rtt>"
+                "<retransmits>%.0f</retransmits>" // -1 if not measured
+                "</timing>",
+                p->timing[Timing_Dns],
+                p->timing[Timing_Connect],
+                p->timing[Timing_Tls],
+                p->timing[Timing_Request],
+                p->timing[Timing_FirstByte],
+                p->timing[Timing_Total],
+                p->timing[Timing_Rtt],
+                p->timing[Timing_Retransmits]);
+}
+
+
+static void _printStreams(StringBuffer_T B, Port_T p) {
+        if (p->protocol->check != check_http2 || p->is_available == Connection_Init)
+                return;
+        for (Http2Stream_T stream = p->parameters.http.streams; stream; stream = stream->next)
+                StringBuffer_append(B,
+                        "<stream>"
+                        "<request><![CDATA[%s]]></request>"
+                        "<status>%d</status>"             // -1 if not received
+                        "<responsetime>%.6f</responsetime>" // seconds, -1 if not completed
+                        "</stream>",
+                        stream->request,
+                        stream->status,
+                        stream->response >= 0 ? stream->response / 1000. : -1.);
+}
+
+
 /**
  * Prints a service status into the given buffer.
  * @param S Service object
@@ -237,6 +279,36 @@ static void status_service(Service_T S, StringBuffer_T B, int V) {
                                         systeminfo.filedescriptors.allocated,
                                         systeminfo.filedescriptors.unused,
                                         systeminfo.filedescriptors.maximum);
+                                if (systeminfo.statisticsAvailable & Statistics_NetworkStack)
+                                        StringBuffer_append(B,
+                                                "<netstack>"
+                                                "<tcp>"
+                                                "<segments><now>%.1f</now><total>%llu</total></segments>"
+                                                "<retransmits><now>%.1f</now><total>%llu</total></retransmits>"
+                                                "<listenoverflows><now>%.1f</now><total>%llu</total></listenoverflows>"
+                                                "<listendrops><now>%.1f</now><total>%llu</total></listendrops>"
+                                                "<syncookies><now>%.1f</now><total>%llu</total></syncookies>"
+                                                "<orphans>%lld</orphans>"
+                                                "<timewait>%lld</timewait>"
+                                                "</tcp>"
+                                                "<udp>"
+                                                "<receivebuffererrors><now>%.1f</now><total>%llu</total></receivebuffererrors>"
+                                                "</udp>"
+                                                "</netstack>",
+                                                Statistics_deltaNormalize(&(systeminfo.netstack.tcp.segments)),
+                                                Statistics_raw(&(systeminfo.netstack.tcp.segments)),
+                                                Statistics_deltaNormalize(&(systeminfo.netstack.tcp.retransmits)),
+                                                Statistics_raw(&(systeminfo.netstack.tcp.retransmits)),
+                                                Statistics_deltaNormalize(&(systeminfo.netstack.tcp.listenOverflows)),
+                                                Statistics_raw(&(systeminfo.netstack.tcp.listenOverflows)),
+                                                Statistics_deltaNormalize(&(systeminfo.netstack.tcp.listenDrops)),
+                                                Statistics_raw(&(systeminfo.netstack.tcp.listenDrops)),
+                                                Statistics_deltaNormalize(&(systeminfo.netstack.tcp.synCookies)),
+                                                Statistics_raw(&(systeminfo.netstack.tcp.synCookies)),
+                                                systeminfo.netstack.tcp.orphans,
+                                                systeminfo.netstack.tcp.timeWait,
+                                                Statistics_deltaNormalize(&(systeminfo.netstack.udp.receiveBufferErrors)),
+                                                Statistics_raw(&(systeminfo.netstack.udp.receiveBufferErrors)));
                                 break;
 
                         case Service_File:
@@ -277,6 +349,24 @@ static void status_service(Service_T S, StringBuffer_T B, int V) {
                                         S->inf.directory->timestamp.access,
                                         S->inf.directory->timestamp.change,
                                         S->inf.directory->timestamp.modify);
+                                if (S->inf.directory->entries >= 0)
+                                        StringBuffer_append(B,
+                                                "<entries>%lld</entries>"
+                                                "<totalsize>%lld</totalsize>"
+                                                "<oldest>%lld</oldest>",
+                                                S->inf.directory->entries,
+                                                S->inf.directory->size,
+                                                (long long)S->inf.directory->oldest);
+                                break;
+
+                        case Service_Fileset:
+                                StringBuffer_append(B,
+                                        "<files>%d</files>"
+                                        "<failed>%d</failed>"
+                                        "<totalsize>%lld</totalsize>",
+                                        S->inf.fileset->entries,
+                                        S->inf.fileset->failed,
+                                        S->inf.fileset->size);
                                 break;
 
                         case Service_Fifo:
@@ -328,6 +418,14 @@ static void status_service(Service_T S, StringBuffer_T B, int V) {
                                                 S->inf.filesystem->f_filesused,
                                                 S->inf.filesystem->f_files);
                                 }
+                                if (S->inf.filesystem->timeToFull.space >= 0 || S->inf.filesystem->timeToFull.inode >= 0) {
+                                        StringBuffer_append(B, "<timetofull>");
+                                        if (S->inf.filesystem->timeToFull.space >= 0)
+                                                StringBuffer_append(B, "<space>%lld</space>", S->inf.filesystem->timeToFull.space);
+                                        if (S->inf.filesystem->timeToFull.inode >= 0)
+                                                StringBuffer_append(B, "<inode>%lld</inode>", S->inf.filesystem->timeToFull.inode);
+                                        StringBuffer_append(B, "</timetofull>");
+                                }
                                 _ioStatistics(B, "read", &(S->inf.filesystem->read));
                                 _ioStatistics(B, "write", &(S->inf.filesystem->write));
                                 bool hasReadTime = Statistics_initialized(&(S->inf.filesystem->time.read));
@@ -346,6 +444,25 @@ static void status_service(Service_T S, StringBuffer_T B, int V) {
                                                 StringBuffer_append(B, "<run>%.3f</run>", Statistics_deltaNormalize(&(S->inf.filesystem->time.run)));
                                         StringBuffer_append(B, "</servicetime>");
                                 }
+                                double readLatency = Filesystem_getLatency(&(S->inf.filesystem->read), &(S->inf.filesystem->time.read));
+                                double writeLatency = Filesystem_getLatency(&(S->inf.filesystem->write), &(S->inf.filesystem->time.write));
+                                if (readLatency >= 0. || writeLatency >= 0.) {
+                                        StringBuffer_append(B, "<latency>");
+                                        if (readLatency >= 0.)
+                                                StringBuffer_append(B, "<read>%.3f</read>", readLatency);
+                                        if (writeLatency >= 0.)
+                                                StringBuffer_append(B, "<write>%.3f</write>", writeLatency);
+                                        StringBuffer_append(B, "</latency>");
+                                }
+                                double iops = Filesystem_getIOPS(&(S->inf));
+                                if (iops >= 0.)
+                                        StringBuffer_append(B, "<iops>%.1f</iops>", iops);
+                                double utilization = Filesystem_getUtilization(&(S->inf));
+                                if (utilization >= 0.)
+                                        StringBuffer_append(B, "<utilization>%.1f</utilization>", utilization);
+                                double queueDepth = Filesystem_getQueueDepth(&(S->inf));
+                                if (queueDepth >= 0.)
+                                        StringBuffer_append(B, "<queue><depth>%.2f</depth><inflight>%lld</inflight></queue>", queueDepth, S->inf.filesystem->inFlight);
                                 break;
 
                         case Service_Net:
@@ -381,8 +498,7 @@ static void status_service(Service_T S, StringBuffer_T B, int V) {
                                         "<now>%lld</now>"
                                         "<total>%lld</total>"
                                         "</errors>"
-                                        "</upload>"
-                                        "</link>",
+                                        "</upload>",
                                         Link_getState(S->inf.net->stats),
                                         Link_getSpeed(S->inf.net->stats),
                                         Link_getDuplex(S->inf.net->stats),
@@ -398,6 +514,12 @@ static void status_service(Service_T S, StringBuffer_T B, int V) {
                                         Link_getBytesOutTotal(S->inf.net->stats),
                                         Link_getErrorsOutPerSecond(S->inf.net->stats),
                                         Link_getErrorsOutTotal(S->inf.net->stats));
+                                for (LinkCounter_Type i = 0; i < LinkCounter_Count; i++) {
+                                        long long total = Link_getCounterTotal(S->inf.net->stats, i);
+                                        if (total >= 0)
+                                                StringBuffer_append(B, "<counter name=\"%s\"><now>%lld</now><total>%lld</total></counter>", Link_getCounterName(i), Link_getCounterPerSecond(S->inf.net->stats, i), total);
+                                }
+                                StringBuffer_append(B, "</link>");
                                 break;
 
                         case Service_Process:
@@ -461,9 +583,13 @@ static void status_service(Service_T S, StringBuffer_T B, int V) {
                                             "<icmp>"
                                             "<type>%s</type>"
                                             "<responsetime>%.6f</responsetime>"
+                                            "<jitter>%.6f</jitter>"
+                                            "<loss>%.1f</loss>"
                                             "</icmp>",
                                             icmpnames[i->type],
-                                            i->is_available == Connection_Ok ? i->response / 1000. : -1.); // We send the response time in [s] for backward compatibility (with microseconds precision)
+                                            i->is_available == Connection_Ok ? i->response / 1000. : -1., // We send the response time in [s] for backward compatibility (with microseconds precision)
+                                            i->is_available == Connection_Ok ? i->jitter / 1000. : -1.,
+                                            i->is_available != Connection_Init ? i->loss : -1.);
                 }
                 for (Port_T p = S->portlist; p; p = p->next) {
                         StringBuffer_append(B,
@@ -486,6 +612,8 @@ static void status_service(Service_T S, StringBuffer_T B, int V) {
                                             "<valid>%d</valid>"
                                             "</certificate>",
                                             p->target.net.ssl.certificate.validDays);
+                        _printTiming(B, p);
+                        _printStreams(B, p);
                         StringBuffer_append(B,
                                             "</port>");
                 }
@@ -494,11 +622,36 @@ static void status_service(Service_T S, StringBuffer_T B, int V) {
                                             "<unix>"
                                             "<path>%s</path>"
                                             "<protocol>%s</protocol>"
-                                            "<responsetime>%.6f</responsetime>"
-                                            "</unix>",
+                                            "<responsetime>%.6f</responsetime>",
                                             p->target.unix.pathname ? p->target.unix.pathname : "",
                                             p->protocol->name ? p->protocol->name : "",
                                             p->is_available == Connection_Ok ? p->response / 1000. : -1.); // We send the response time in [s] for backward compatibility (with microseconds precision)
+                        _printTiming(B, p);
+                        _printStreams(B, p);
+                        StringBuffer_append(B,
+                                            "</unix>");
+                }
+                for (Listen_T l = S->listenlist; l; l = l->next) {
+                        bool shown = false;
+                        for (Listen_T p = S->listenlist; p != l && ! shown; p = p->next)
+                                shown = p->port == l->port && (p->address == l->address || IS(p->address, l->address));
+                        if (shown || l->info.established < 0)
+                                continue;
+                        StringBuffer_append(B,
+                                            "<listen>"
+                                            "<address>%s</address>"
+                                            "<portnumber>%d</portnumber>"
+                                            "<listening>%d</listening>"
+                                            "<queue>%lld</queue>"
+                                            "<backlog>%lld</backlog>"
+                                            "<established>%lld</established>"
+                                            "</listen>",
+                                            l->address ? l->address : "",
+                                            l->port,
+                                            l->found ? 1 : 0,
+                                            l->info.queue,
+                                            l->info.backlog,
+                                            l->info.established);
                 }
                 if (S->type == Service_System) {
                         StringBuffer_append(B,
@@ -1,6587 +1,2926 @@
-#line 2 "src/lex.yy.c"
+/* generated by miniflex from src/l.l -- do not edit */
 
-#line 4 "src/lex.yy.c"
-
-#define  YY_INT_ALIGNED short int
-
-/* A lexical scanner generated by flex */
-
-#define FLEX_SCANNER
-#define YY_FLEX_MAJOR_VERSION 2
-#define YY_FLEX_MINOR_VERSION 6
-#define YY_FLEX_SUBMINOR_VERSION 4
-#if YY_FLEX_SUBMINOR_VERSION > 0
-#define FLEX_BETA
-#endif
-
-/* First, we deal with  platform-specific or compiler-specific issues. */
-
-/* begin standard C headers. */
 #include <stdio.h>
-#include <string.h>
-#include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
-/* end standard C headers. */
-
-/* flex integer type definitions */
-
-#ifndef FLEXINT_H
-#define FLEXINT_H
-
-/* C99 systems have <inttypes.h>. Non-C99 systems may or may not. */
-
-#if defined (__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
-
-/* C99 says to define __STDC_LIMIT_MACROS before including stdint.h,
- * if you want the limit (max/min) macros for int types. 
- */
-#ifndef __STDC_LIMIT_MACROS
-#define __STDC_LIMIT_MACROS 1
-#endif
-
-#include <inttypes.h>
-typedef int8_t flex_int8_t;
-typedef uint8_t flex_uint8_t;
-typedef int16_t flex_int16_t;
-typedef uint16_t flex_uint16_t;
-typedef int32_t flex_int32_t;
-typedef uint32_t flex_uint32_t;
-#else
-typedef signed char flex_int8_t;
-typedef short int flex_int16_t;
-typedef int flex_int32_t;
-typedef unsigned char flex_uint8_t; 
-typedef unsigned short int flex_uint16_t;
-typedef unsigned int flex_uint32_t;
-
-/* Limits of integral types. */
-#ifndef INT8_MIN
-#define INT8_MIN               (-128)
-#endif
-#ifndef INT16_MIN
-#define INT16_MIN              (-32767-1)
-#endif
-#ifndef INT32_MIN
-#define INT32_MIN              (-2147483647-1)
-#endif
-#ifndef INT8_MAX
-#define INT8_MAX               (127)
-#endif
-#ifndef INT16_MAX
-#define INT16_MAX              (32767)
-#endif
-#ifndef INT32_MAX
-#define INT32_MAX              (2147483647)
-#endif
-#ifndef UINT8_MAX
-#define UINT8_MAX              (255U)
-#endif
-#ifndef UINT16_MAX
-#define UINT16_MAX             (65535U)
-#endif
-#ifndef UINT32_MAX
-#define UINT32_MAX             (4294967295U)
-#endif
-
-#ifndef SIZE_MAX
-#define SIZE_MAX               (~(size_t)0)
-#endif
-
-#endif /* ! C99 */
-
-#endif /* ! FLEXINT_H */
-
-/* begin standard C++ headers. */
-
-/* TODO: this is always defined, so inline it */
-#define yyconst const
-
-#if defined(__GNUC__) && __GNUC__ >= 3
-#define yynoreturn __attribute__((__noreturn__))
-#else
-#define yynoreturn
-#endif
-
-/* Returned upon end-of-file. */
-#define YY_NULL 0
-
-/* Promotes a possibly negative, possibly signed char to an
- *   integer in range [0..255] for use as an array index.
- */
-#define YY_SC_TO_UI(c) ((YY_CHAR) (c))
-
-/* Enter a start condition.  This macro really ought to take a parameter,
- * but we do it the disgusting crufty way forced on us by the ()-less
- * definition of BEGIN.
- */
-#define BEGIN (yy_start) = 1 + 2 *
-/* Translate the current start state into a value that can be later handed
- * to BEGIN to return to the state.  The YYSTATE alias is for lex
- * compatibility.
- */
-#define YY_START (((yy_start) - 1) / 2)
-#define YYSTATE YY_START
-/* Action number for EOF rule of a given start state. */
-#define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
-/* Special action meaning "start processing a new file". */
-#define YY_NEW_FILE yyrestart( yyin  )
-#define YY_END_OF_BUFFER_CHAR 0
-
-/* Size of default input buffer. */
-#ifndef YY_BUF_SIZE
-#ifdef __ia64__
-/* On IA-64, the buffer size is 16k, not 8k.
- * Moreover, YY_BUF_SIZE is 2*YY_READ_BUF_SIZE in the general case.
- * Ditto for the __ia64__ case accordingly.
- */
-#define YY_BUF_SIZE 32768
-#else
+#define FLEX_SCANNER
 #define YY_BUF_SIZE 16384
-#endif /* __ia64__ */
-#endif
-
-/* The state buf must be large enough to hold one state per character in the main buffer.
- */
-#define YY_STATE_BUF_SIZE   ((YY_BUF_SIZE + 2) * sizeof(yy_state_type))
+#define YY_NULL 0
 
-#ifndef YY_TYPEDEF_YY_BUFFER_STATE
-#define YY_TYPEDEF_YY_BUFFER_STATE
 typedef struct yy_buffer_state *YY_BUFFER_STATE;
-#endif
-
-#ifndef YY_TYPEDEF_YY_SIZE_T
-#define YY_TYPEDEF_YY_SIZE_T
-typedef size_t yy_size_t;
-#endif
 
+extern char *yytext;
 extern int yyleng;
-
 extern FILE *yyin, *yyout;
 
-#define EOB_ACT_CONTINUE_SCAN 0
-#define EOB_ACT_END_OF_FILE 1
-#define EOB_ACT_LAST_MATCH 2
-    
-    #define YY_LESS_LINENO(n)
-    #define YY_LINENO_REWIND_TO(ptr)
-    
-/* Return all but the first "n" matched characters back to the input stream. */
-#define yyless(n) \
-	do \
-		{ \
-		/* Undo effects of setting up yytext. */ \
-        int yyless_macro_arg = (n); \
-        YY_LESS_LINENO(yyless_macro_arg);\
-		*yy_cp = (yy_hold_char); \
-		YY_RESTORE_YY_MORE_OFFSET \
-		(yy_c_buf_p) = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
-		YY_DO_BEFORE_ACTION; /* set up yytext again */ \
-		} \
-	while ( 0 )
-#define unput(c) yyunput( c, (yytext_ptr)  )
-
-#ifndef YY_STRUCT_YY_BUFFER_STATE
-#define YY_STRUCT_YY_BUFFER_STATE
-struct yy_buffer_state
-	{
-	FILE *yy_input_file;
-
-	char *yy_ch_buf;		/* input buffer */
-	char *yy_buf_pos;		/* current position in input buffer */
-
-	/* Size of input buffer in bytes, not including room for EOB
-	 * characters.
-	 */
-	int yy_buf_size;
-
-	/* Number of characters read into yy_ch_buf, not including EOB
-	 * characters.
-	 */
-	int yy_n_chars;
-
-	/* Whether we "own" the buffer - i.e., we know we created it,
-	 * and can realloc() it to grow it, and should free() it to
-	 * delete it.
-	 */
-	int yy_is_our_buffer;
-
-	/* Whether this is an "interactive" input source; if so, and
-	 * if we're using stdio for input, then we want to use getc()
-	 * instead of fread(), to make sure we stop fetching input after
-	 * each newline.
-	 */
-	int yy_is_interactive;
-
-	/* Whether we're considered to be at the beginning of a line.
-	 * If so, '^' rules will be active on the next match, otherwise
-	 * not.
-	 */
-	int yy_at_bol;
-
-    int yy_bs_lineno; /**< The line count. */
-    int yy_bs_column; /**< The column count. */
-
-	/* Whether to try to fill the input buffer when we reach the
-	 * end of it.
-	 */
-	int yy_fill_buffer;
+int yylex(void);
+void yyrestart(FILE *file);
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size);
+void yy_switch_to_buffer(YY_BUFFER_STATE b);
+void yy_delete_buffer(YY_BUFFER_STATE b);
 
-	int yy_buffer_status;
+static YY_BUFFER_STATE yy_current_buffer = NULL;
+#define YY_CURRENT_BUFFER yy_current_buffer
 
-#define YY_BUFFER_NEW 0
-#define YY_BUFFER_NORMAL 1
-	/* When an EOF's been seen but there's still some text to process
-	 * then we mark the buffer as YY_EOF_PENDING, to indicate that we
-	 * shouldn't try reading from the input source any more.  We might
-	 * still have a bunch of tokens to match, though, because of
-	 * possible backing-up.
-	 *
-	 * When we actually see the EOF, we change the status to "new"
-	 * (via yyrestart()), so that the user can continue scanning by
-	 * just pointing yyin at a new input file.
-	 */
-#define YY_BUFFER_EOF_PENDING 2
+static int yy_start = 0;
+#define BEGIN yy_start =
+#define YY_START yy_start
+#define YYSTATE YY_START
+#define INITIAL 0
+#define ARGUMENT_COND 1
+#define DEPEND_COND 2
+#define SERVICE_COND 3
+#define URL_COND 4
+#define ADDRESS_COND 5
+#define STRING_COND 6
+#define EVERY_COND 7
+#define HTTP_HEADER_COND 8
+#define INCLUDE 9
 
-	};
-#endif /* !YY_STRUCT_YY_BUFFER_STATE */
+#define yyterminate() return YY_NULL
+#define ECHO (void)fwrite(yytext, (size_t)yyleng, 1, yyout)
 
-/* Stack of input buffers. */
-static size_t yy_buffer_stack_top = 0; /**< index of top of stack. */
-static size_t yy_buffer_stack_max = 0; /**< capacity of stack. */
-static YY_BUFFER_STATE * yy_buffer_stack = NULL; /**< Stack as an array. */
+static void yyunput(int c);
+#define unput(c) yyunput(c)
+static void yy_less(int n);
+#define yyless(n) yy_less(n)
 
-/* We provide macros for accessing buffer states in case in the
- * future we want to put the buffer states in a more general
- * "scanner state".
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
  *
- * Returns the top of the stack, or NULL.
- */
-#define YY_CURRENT_BUFFER ( (yy_buffer_stack) \
-                          ? (yy_buffer_stack)[(yy_buffer_stack_top)] \
-                          : NULL)
-/* Same as previous macro, but useful when we know that the buffer stack is not
- * NULL or when we need an lvalue. For internal use only.
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
  */
-#define YY_CURRENT_BUFFER_LVALUE (yy_buffer_stack)[(yy_buffer_stack_top)]
-
-/* yy_hold_char holds the character lost when yytext is formed. */
-static char yy_hold_char;
-static int yy_n_chars;		/* number of characters read into yy_ch_buf */
-int yyleng;
 
-/* Points to current character in buffer. */
-static char *yy_c_buf_p = NULL;
-static int yy_init = 0;		/* whether we need to initialize */
-static int yy_start = 0;	/* start state number */
-
-/* Flag which is used to allow yywrap()'s to do buffer switches
- * instead of setting up a fresh yyin.  A bit of a hack ...
+/*
+ * DESCRIPTION
+ *
+ *   Lexical grammar for tokenizing the control file.
+ *
  */
-static int yy_did_buffer_switch_on_eof;
-
-void yyrestart ( FILE *input_file  );
-void yy_switch_to_buffer ( YY_BUFFER_STATE new_buffer  );
-YY_BUFFER_STATE yy_create_buffer ( FILE *file, int size  );
-void yy_delete_buffer ( YY_BUFFER_STATE b  );
-void yy_flush_buffer ( YY_BUFFER_STATE b  );
-void yypush_buffer_state ( YY_BUFFER_STATE new_buffer  );
-void yypop_buffer_state ( void );
-
-static void yyensure_buffer_stack ( void );
-static void yy_load_buffer_state ( void );
-static void yy_init_buffer ( YY_BUFFER_STATE b, FILE *file  );
-#define YY_FLUSH_BUFFER yy_flush_buffer( YY_CURRENT_BUFFER )
-
-YY_BUFFER_STATE yy_scan_buffer ( char *base, yy_size_t size  );
-YY_BUFFER_STATE yy_scan_string ( const char *yy_str  );
-YY_BUFFER_STATE yy_scan_bytes ( const char *bytes, int len  );
-
-void *yyalloc ( yy_size_t  );
-void *yyrealloc ( void *, yy_size_t  );
-void yyfree ( void *  );
-
-#define yy_new_buffer yy_create_buffer
-#define yy_set_interactive(is_interactive) \
-	{ \
-	if ( ! YY_CURRENT_BUFFER ){ \
-        yyensure_buffer_stack (); \
-		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer( yyin, YY_BUF_SIZE ); \
-	} \
-	YY_CURRENT_BUFFER_LVALUE->yy_is_interactive = is_interactive; \
-	}
-#define yy_set_bol(at_bol) \
-	{ \
-	if ( ! YY_CURRENT_BUFFER ){\
-        yyensure_buffer_stack (); \
-		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer( yyin, YY_BUF_SIZE ); \
-	} \
-	YY_CURRENT_BUFFER_LVALUE->yy_at_bol = at_bol; \
-	}
-#define YY_AT_BOL() (YY_CURRENT_BUFFER_LVALUE->yy_at_bol)
-
-/* Begin user sect3 */
 
-#define yywrap() (/*CONSTCOND*/1)
-#define YY_SKIP_YYWRAP
-typedef flex_uint8_t YY_CHAR;
-
-FILE *yyin = NULL, *yyout = NULL;
-
-typedef int yy_state_type;
-
-extern int yylineno;
-int yylineno = 1;
+#include "config.h"
 
-extern char *yytext;
-#ifdef yytext_ptr
-#undef yytext_ptr
+#ifdef HAVE_STRING_H
+#include <string.h>
 #endif
-#define yytext_ptr yytext
-
-static yy_state_type yy_get_previous_state ( void );
-static yy_state_type yy_try_NUL_trans ( yy_state_type current_state  );
-static int yy_get_next_buffer ( void );
-static void yynoreturn yy_fatal_error ( const char* msg  );
-
-/* Done after the current pattern has been matched and before the
- * corresponding action - sets up yytext.
- */
-#define YY_DO_BEFORE_ACTION \
-	(yytext_ptr) = yy_bp; \
-	yyleng = (int) (yy_cp - yy_bp); \
-	(yy_hold_char) = *yy_cp; \
-	*yy_cp = '\0'; \
-	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 400
-#define YY_END_OF_BUFFER 401
-/* This struct is not used in this scanner,
-   but its presence is necessary. */
-struct yy_trans_info
-	{
-	flex_int32_t yy_verify;
-	flex_int32_t yy_nxt;
-	};
-static const flex_int16_t yy_acclist[4273] =
-    {   0,
-        2,    2,  396,  396,  401,  395,  400,    1,  395,  400,
-        2,  400,  395,  400,  347,  395,  400,    2,  344,  395,
-      400,  344,  395,  400,  331,  395,  400,  347,  395,  400,
-      344,  395,  400,  339,  344,  395,  400,  329,  330,  344,
-      395,  400,  329,  330,  344,  395,  400,  329,  330,  344,
-      395,  400,  329,  330,  344,  395,  400,  395,  400,  298,
-      344,  395,  400,  300,  344,  395,  400,  296,  344,  395,
-      400,  344,  395,  400,  280,  344,  395,  400,  344,  395,
-      400,  344,  395,  400,  344,  395,  400,  344,  395,  400,
-      344,  395,  400,  305,  344,  395,  400,  344,  395,  400,
-
-      344,  395,  400,  344,  395,  400,  344,  395,  400,  304,
-      344,  395,  400,  344,  395,  400,  344,  395,  400,  344,
-      395,  400,  344,  395,  400,  303,  344,  395,  400,  344,
-      395,  400,  344,  395,  400,  344,  395,  400,  344,  395,
-      400,    2,  344,  395,  400,  365,  395,  400,  360,  395,
-      400,  361,  400,  360,  365,  395,  400,  362,  395,  400,
-      364,  365,  395,  400,  354,  395,  400,  355,  400,  395,
-      400,  356,  395,  400,  395,  400,  354,  395,  400,  348,
-      395,  400,  349,  400,  353,  395,  400,  350,  395,  400,
-      353,  395,  400,  395,  400,16751,  366,  395,  400,16751,
-
-      366,  400,16751,  366,  395,  400,  374,  395,  400,16751,
-      369,  395,  400,16751,  372,  395,  400,16751,  395,  400,
-      373,  395,  400,16751,  395,  400,16751,  379,  395,  400,
-      375,  400,  377,  379,  395,  400,  376,  377,  379,  395,
-      400,  376,  377,  378,  379,  395,  400,  378,  379,  395,
-      400,  376,  379,  395,  400,  375,  379,  395,  400,  400,
-      383,  395,  400,  380,  395,  400,  383,  395,  400,  387,
-      395,  400,  384,  387,  395,  400,  387,  395,  400,  385,
-      387,  395,  400,  394,  395,  400,  388,  394,  395,  400,
-      390,  400,  388,  394,  395,  400,  394,  395,  400,  389,
-
-      394,  395,  400,  393,  394,  395,  400,  399,  400,  396,
-      400,  399,  400,  399,  400,    1,  301,  335,    2,    2,
-        2,  344,    2,  344,    2,    2,  344,  344,  344,  336,
-      344,  344,  338,  344,  338,  344,  332,  344,  332,  344,
-      329,  330,  332,  344,  332,  344,  332,  344,  329,  330,
-      332,  344,  329,  330,  332,  344,  329,  330,  332,  344,
-      329,  330,  332,  344,  346,  299,  344,  300,  344,  297,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,    4,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  300,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  283,
-      332,  344,  297,  332,  344,  332,  344,  332,  344,  332,
-      344,  296,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,   40,  332,  344,  332,
-      344,  332,  344,   27,  332,  344,  332,  344,    3,  332,
-
-      344,  281,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  299,  332,  344,  332,  344,  332,  344,  332,
-      344,  298,  332,  344,  332,  344,  282,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  302,  332,  344,  332,  344,  332,  344,  301,  332,
-      344,  332,  344,  332,  344,  332,  344,   23,  332,  344,
-      332,  344,    8,  332,  344,  332,  344,   24,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
 
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-       16,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  365,  360,  360,  365,  365,  363,  365,  359,  354,
-      359,  355,  359,  354,  359,  354,  355,  359,  359,  355,
-      359,  355,  356,  355,  348,  350,16751,  366,16751,  366,
-      374,16751,  374,  374,  369,16751,16751,  372,16751,  372,
-
-      372,  371,  373,16751,  373,  373,16751,  377,  376,  377,
-      376,  380,  384,  385,  391,  388,  388,  392,  392,  392,
-      392,  399,  396,  399,  399,  333,  335,    2,    2,  344,
-        2,  344,    2,  337,    2,  337,  344,  337,  334,  336,
-      344,  344,  338,  344,  332,  344,  330,  332,  344,  330,
-      332,  344,  330,  332,  344,  330,  332,  344,  332,  344,
-      329,  330,  332,  344,  332,  344,  346,  329,  330,  332,
-      344,  346,  346,  346,  346,  346,  346,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,   11,  332,  344,
-      332,  344,    5,  332,  344,  332,  344,  332,  344,  332,
-
-      344,  280,  332,  344,  332,  344,  332,  344,   22,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  195,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  306,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  138,  332,  344,
-      332,  344,  332,  344,  149,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-
-      344,  332,  344,    6,  332,  344,  332,  344,  332,  344,
-      332,  344,  129,  332,  344,  332,  344,  122,  332,  344,
-      178,  332,  344,  332,  344,  162,  332,  344,  332,  344,
-      332,  344,  332,  344,   12,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,   59,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-
-      251,  332,  344,  332,  344,  191,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  227,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,   26,  332,  344,
-      332,  344,  266,  332,  344,  332,  344,  133,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,   54,  332,
-      344,  332,  344,  332,  344,  332,  344,  161,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      143,  332,  344,   44,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,   17,  332,  344,  332,  344,  332,
-      344,  332,  344,  106,  332,  344,  332,  344,  332,  344,
-       15,  332,  344,  332,  344,  332,  344,   43,  332,  344,
-      155,  332,  344,  332,  344,  332,  344,  108,  332,  344,
-
-      174,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  264,  332,  344,  332,  344,   14,  332,  344,  332,
-      344,  332,  344,  332,  344,    7,  332,  344,  332,  344,
-       20,  332,  344,  332,  344,  332,  344,  332,  344,  363,
-      357,  358,  351,  352,  374,  369,16751,  372,  368,  373,
-      370,16751,  370,  381,  382,  392,  392,  397,  399,  397,
-      398,  399,  398,  344,  344,  332,  344,  330,  332,  344,
-      330,  332,  344,  330,  332,  344,  330,  332,  344,  329,
-      330,  332,  344,  332,  344,  328,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  332,
-
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  214,  332,  344,  332,  344,
-      332,  344,  280,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  194,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  258,  332,
-      344,  306,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,   89,  332,  344,  332,  344,   25,  332,  344,
-      332,  344,  236,  332,  344,  262,  332,  344,  332,  344,
-
-      332,  344,  175,  332,  344,  332,  344,  332,  344,  220,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  278,  332,  344,  218,  332,  344,  332,  344,
-      332,  344,  283,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  123,  332,  344,  119,  332,  344,  305,
-      332,  344,  126,  332,  344,  232,  332,  344,  332,  344,
-      332,  344,  135,  332,  344,  332,  344,   85,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  102,  332,
-      344,  103,  332,  344,  281,  332,  344,  332,  344,  332,
-      344,   28,  332,  344,  332,  344,  298,  332,  344,  332,
-
-      344,   66,  332,  344,  153,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  282,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      167,  332,  344,  332,  344,  332,  344,  332,  344,  296,
-      332,  344,  158,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  141,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  142,  332,  344,  332,  344,    8,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,   97,  332,  344,  332,  344,  332,
-
-      344,  332,  344,  332,  344,  219,  332,  344,  332,  344,
-      332,  344,  233,  332,  344,  134,  332,  344,  100,  332,
-      344,  332,  344,  267,  332,  344,  332,  344,  332,  344,
-      332,  344,   29,  332,  344,  332,  344,   90,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  237,  332,  344,  332,
-      344,  252,  332,  344,  332,  344,  332,  344,  221,  332,
-      344,  224,  332,  344,  130,  332,  344,  332,  344,  332,
-
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,   99,  332,  344,  332,  344,  332,  344,  192,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,   18,
-      332,  344,   41,  332,  344,  332,  344,  199,  332,  344,
-      332,  344,  332,  344,  104,  332,  344,  101,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,    9,  332,  344,  332,  344, 8559, 8559,  374,
-     8559,  372, 8559,  373,  370,  392,  344,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  329,  330,  332,  344,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  332,  344,
-      332,  344,  332,  344,  332,  344,  109,  332,  344,   86,
-      332,  344,  332,  344,  308,  332,  344,  332,  344,  332,
-      344,   58,  332,  344,  332,  344,  332,  344,  280,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  197,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  268,  332,  344,  287,  288,  289,  332,  344,
-      332,  344,  253,  332,  344,  309,  332,  344,  114,  332,
-
-      344,  332,  344,  332,  344,   56,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  300,  332,
-      344,  332,  344,  313,  332,  344,   38,  332,  344,  256,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  340,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  305,
-      332,  344,  332,  344,   63,  332,  344,  127,  332,  344,
-      332,  344,  332,  344,  136,  332,  344,  332,  344,  216,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  150,  332,  344,  151,  332,  344,
-
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  226,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  307,
-      332,  344,  310,  332,  344,  139,  332,  344,  332,  344,
-      298,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  296,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-       39,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  156,  332,  344,  332,  344,  234,  332,  344,  235,
-
-      332,  344,  332,  344,  332,  344,  332,  344,  105,  332,
-      344,  332,  344,  152,  332,  344,  332,  344,  332,  344,
-      332,  344,  144,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  116,  332,  344,  332,  344,  154,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  147,  332,  344,  332,  344,  224,  332,
-      344,  131,  332,  344,  217,  332,  344,  332,  344,   75,
-      332,  344,  332,  344,  207,  332,  344,  208,  332,  344,
-       98,  332,  344,  332,  344,  332,  344,   36,  332,  344,
-
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-       21,  332,  344,  209,  332,  344,   76,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,   19,  332,  344,
-      332,  344,   13,  332,  344,   50,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-       91,  332,  344,  201,  344,  202,  344,  203,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  332,  344,  231,  332,  344,  168,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,   68,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  315,  316,  332,  344,
-      332,  344,  213,  332,  344,  137,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  114,  332,  344,   55,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-       47,  332,  344,  332,  344,  332,  344,  256,  332,  344,
-      238,  332,  344,  332,  344,  332,  344,   42,  332,  344,
-
-      332,  344,  332,  344,  340,  277,  332,  344,  332,  344,
-      332,  344,  332,  344,  326,  332,  344,  332,  344,  332,
-      344,   95,  332,  344,  228,  332,  344,  332,  344,  216,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  240,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  170,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  191,  332,
-      344,  332,  344,  121,  332,  344,  332,  344,  304,  332,
-      344,  263,  332,  344,  332,  344,  332,  344,  332,  344,
-      307,  332,  344,  140,  332,  344,  332,  344,  332,  344,
-
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-       32,  332,  344,  159,  332,  344,   67,  332,  344,  260,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-       83,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  163,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,   87,  332,
-      344,  332,  344,  269,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,   84,  332,  344,  332,
-      344,  303,  332,  344,  180,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-
-      344,   35,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  124,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,   61,  332,  344,  165,  332,  344,  107,
-      332,  344,  332,  344,  198,  332,  344,  332,  344,  332,
-      344,  210,  332,  344,  211,  332,  344,  212,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,   72,  332,
-      344,  222,  332,  344,  332,  344,   49,  332,  344,  332,
-      344,  332,  344,  332,  344,    9,  332,  344,  332,  344,
-      204,  344,  205,  344,  206,  344,  332,  344,  345,  332,
-      344,  345,  332,  344,  345,  332,  344,  345,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  332,  344,   64,  332,  344,
-      332,  344,  332,  344,  332,  344,  223,  332,  344,   69,
-      332,  344,  332,  344,  332,  344,  332,  344,   80,  332,
-      344,  200,  332,  344,  332,  344,  332,  344,  213,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  265,  332,  344,  288,  287,  289,  332,  344,  332,
-      344,  125,  332,  344,  314,  332,  344,   48,  332,  344,
-      332,  344,  332,  344,  332,  344,  220,  332,  344,  332,
-
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  277,
-      332,  344,  332,  344,  332,  344,  296,  332,  344,  332,
-      344,  332,  344,  332,  344,  311,  332,  344,  332,  344,
-      332,  344,  257,  332,  344,  332,  344,  332,  344,  332,
-      344,  284,  332,  344,   60,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  304,  332,  344,  332,  344,
-      145,  332,  344,  332,  344,  110,  332,  344,  332,  344,
-      172,  332,  344,  332,  344,  332,  344,  332,  344,   32,
-      332,  344,  332,  344,  332,  344,  332,  344,   67,  332,
-
-      344,  169,  332,  344,  332,  344,  332,  344,   81,  332,
-      344,  331,  332,  344,  332,  344,   94,  332,  344,  332,
-      344,  332,  344,   10,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  179,  332,  344,  332,  344,  113,  332,  344,
-      332,  344,  303,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,  215,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  198,  332,
-      344,  115,  332,  344,  332,  344,  332,  344,  332,  344,
-
-      332,  344,  332,  344,  332,  344,  332,  344,  160,  332,
-      344,  332,  344,  332,  344,    9,  332,  344,  332,  344,
-      345,  332,  344,  345,  332,  344,  345,  332,  344,  345,
-      332,  344,  345,  332,  344,  345,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,   31,  332,
-      344,  332,  344,  332,  344,  332,  344,  332,  344,   30,
-      332,  344,  332,  344,  117,  332,  344,  197,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-
-      332,  344,  332,  344,  183,  332,  344,   73,  332,  344,
-      332,  344,  332,  344,   62,  332,  344,  146,  332,  344,
-      332,  344,  332,  344,  283,  332,  344,  332,  344,  332,
-      344,  272,  332,  344,  332,  344,  271,  332,  344,  332,
-      344,  332,  344,  281,  332,  344,  332,  344,  284,  181,
-      332,  344,  332,  344,  332,  344,  226,  332,  344,  332,
-      344,  282,  332,  344,  164,  332,  344,  343,  332,  344,
-      332,  344,  332,  344,  255,  332,  344,  301,  332,  344,
-      171,  332,  344,  332,  344,   67,  332,  344,   70,  332,
-      344,  332,  344,  274,  332,  344,   82,  332,  344,  332,
-
-      344,  332,  344,  332,  344,  332,  344,   10,  332,  344,
-      332,  344,  105,  332,  344,  332,  344,   88,  332,  344,
-      332,  344,  276,  332,  344,  270,  332,  344,  332,  344,
-      332,  344,  332,  344,  112,  332,  344,   37,  332,  344,
-      332,  344,  113,  332,  344,  332,  344,  332,  344,  176,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  342,  332,  344,   57,  332,  344,
-      332,  344,  196,  332,  344,  193,  332,  344,  332,  344,
-      332,  344,   72,  332,  344,  273,  332,  344,  332,  344,
-
-      332,  344,  332,  344,  345,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  332,  344,  332,  344,  177,  332,
-      344,  332,  344,  332,  344,  332,  344,  250,  332,  344,
-      332,  344,  332,  344,  332,  344,  290,  332,  344,  314,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      283,  332,  344,  332,  344,  332,  344,  332,  344,   65,
-      332,  344,  332,  344,  281,  332,  344,  173,  332,  344,
-
-      332,  344,  332,  344,  332,  344,  282,  332,  344,  343,
-      343,  332,  344,  332,  344,  332,  344,  255,  332,  344,
-      312,   93,  332,  344,   71,  332,  344,  332,  344,  332,
-      344,  332,  344,  332,  344,  332,  344,   88,  332,  344,
-      259,  332,  344,  341,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      254,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,   96,  332,  344,  332,  344,  332,  344,  342,  342,
-      261,  332,  344,  199,  332,  344,  196,  193,  332,  344,
-      332,  344,  230,  332,  344,  188,  332,  344,  157,  332,
-
-      344,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  332,  344,  332,  344,
-      177,  332,  344,  332,  344,  332,  344,  323,  319,  321,
-      332,  344,  332,  344,  182,  332,  344,  229,  332,  344,
-      294,  293,  332,  344,  314,   73,  332,  344,   46,  225,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      120,  332,  344,  332,  344,  332,  344,  284,  285,  332,
-
-      344,  118,  332,  344,  166,  332,  344,  328,  343,  332,
-      344,  332,  344,  332,  344,  332,  344,   93,  332,  344,
-      219,  332,  344,  100,  332,  344,  332,  344,  332,  344,
-      332,  344,  341,  185,  332,  344,  332,  344,  332,  344,
-      332,  344,   74,  332,  344,   79,  332,  344,  332,  344,
-      332,  344,  332,  344,   45,  187,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  328,  342,  332,  344,
-      101,  332,  344,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  308,  332,  344,  332,  344,  332,  344,   51,
-      332,  344,  309,  332,  344,  332,  344,  275,  332,  344,
-       34,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  286,  111,  332,  344,  302,  332,  344,
-      332,  344,  310,  332,  344,   93,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,   92,  332,  344,  332,  344,   33,  332,  344,
-      332,  344,  332,  344,  247,  332,  344,  193,  332,  344,
-
-      386,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  332,  344,  332,  344,  332,
-      344,  317,  325,  190,  332,  344,  332,  344,  291,  292,
-      239,  332,  344,  332,  344,  332,  344,  332,  344,  332,
-      344,  332,  344,  302,  332,  344,  332,  344,  332,  344,
-      332,  344,  332,  344,  332,  344,  186,  332,  344,  332,
-
-      344,  332,  344,  332,  344,   92,  148,  332,  344,  332,
-      344,  248,  332,  344,  193,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  332,  344,  128,  332,  344,  332,  344,
-      322,  324,   77,  332,  344,  332,  344,  332,  344,  189,
-      332,  344,  327,  332,  344,  332,  344,  332,  344,  332,
-
-      344,  244,  332,  344,  332,  344,  332,  344,  332,  344,
-      332,  344,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  332,  344,  332,  344,  332,  344,  315,  316,
-      295,  332,  344,  332,  344,  332,  344,  184,  332,  344,
-      245,  332,  344,  132,  332,  344,  246,  332,  344,  332,
-      344,  249,  332,  344,  332,  344,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  332,  344,  332,  344,
-      332,  344,  320,  332,  344,  279,  332,  344,  332,  344,
-      332,  344,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  308,  332,  344,  332,  344,  332,  344,  309,  318,
-      332,  344,  332,  344,  310,  241,  332,  344,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  346,  332,  344,   52,
-      332,  344,   53,  332,  344,  242,  332,  344,  243,  332,
-      344,  310,  346,  346,  346,  346,  346,  346,  346,  346,
-      346,  332,  344,  346,  346,  346,  346,  346,  346,  346,
-      346,  346,  332,  344,  346,  346,  346,  346,  346,  346,
-      346,  346,  332,  344,  346,  346,  332,  344,   78,  332,
-      344,  310
-    } ;
-
-static const flex_int16_t yy_accept[2704] =
-    {   0,
-        1,    2,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    4,
-        5,    6,    8,   11,   13,   15,   18,   22,   25,   28,
-       31,   34,   38,   43,   48,   53,   58,   60,   64,   68,
-       72,   75,   79,   82,   85,   88,   91,   94,   98,  101,
-      104,  107,  110,  114,  117,  120,  123,  126,  130,  133,
-      136,  139,  142,  146,  149,  152,  154,  158,  161,  165,
-      168,  170,  172,  175,  177,  180,  183,  185,  188,  191,
-      194,  197,  201,  204,  207,  211,  215,  219,  221,  225,
-      228,  231,  233,  237,  242,  248,  252,  256,  260,  261,
-
-      264,  267,  270,  273,  277,  280,  284,  287,  291,  293,
-      297,  300,  304,  308,  310,  312,  314,  316,  317,  318,
-      318,  319,  319,  320,  321,  323,  325,  326,  328,  329,
-      330,  330,  330,  331,  331,  332,  333,  335,  337,  339,
-      341,  345,  345,  347,  349,  353,  357,  361,  365,  366,
-      368,  370,  372,  374,  376,  378,  380,  382,  384,  386,
-      389,  391,  393,  395,  397,  399,  401,  403,  405,  407,
-      409,  411,  413,  415,  417,  419,  421,  423,  425,  427,
-      429,  431,  433,  435,  437,  439,  442,  444,  446,  448,
-      450,  452,  454,  456,  458,  460,  460,  463,  466,  468,
-
-      470,  472,  475,  477,  479,  481,  483,  485,  487,  490,
-      492,  494,  497,  499,  502,  505,  507,  509,  511,  513,
-      516,  518,  520,  522,  525,  527,  530,  532,  534,  536,
-      538,  540,  542,  545,  547,  549,  552,  554,  556,  558,
-      561,  563,  566,  568,  571,  573,  575,  577,  579,  581,
-      583,  585,  587,  589,  591,  593,  595,  597,  599,  601,
-      603,  605,  607,  609,  611,  613,  615,  617,  619,  621,
-      623,  625,  627,  629,  631,  634,  636,  638,  640,  642,
-      644,  646,  648,  650,  652,  654,  656,  658,  660,  662,
-      663,  664,  666,  667,  667,  669,  670,  672,  674,  676,
-
-      677,  679,  680,  682,  683,  683,  684,  684,  685,  686,
-      686,  687,  687,  688,  688,  690,  691,  693,  694,  695,
-      697,  698,  700,  701,  702,  702,  703,  705,  706,  707,
-      708,  708,  709,  711,  712,  712,  713,  713,  714,  714,
-      714,  715,  715,  716,  717,  718,  719,  720,  720,  721,
-      722,  723,  724,  725,  725,  726,  726,  726,  728,  729,
-      731,  733,  735,  737,  738,  739,  739,  741,  742,  743,
-      745,  747,  750,  753,  756,  759,  761,  765,  767,  767,
-      767,  768,  772,  773,  774,  775,  776,  777,  778,  780,
-      782,  784,  786,  788,  791,  793,  796,  798,  800,  802,
-
-      805,  807,  809,  812,  814,  816,  818,  820,  822,  824,
-      826,  828,  830,  832,  834,  836,  838,  840,  842,  845,
-      847,  849,  851,  853,  855,  857,  860,  862,  864,  866,
-      868,  871,  873,  875,  878,  880,  882,  884,  886,  888,
-      890,  892,  894,  896,  898,  900,  902,  904,  907,  909,
-      911,  913,  916,  918,  921,  924,  926,  929,  931,  933,
-      935,  938,  940,  942,  944,  946,  948,  950,  952,  954,
-      956,  958,  960,  962,  964,  966,  968,  970,  972,  974,
-      976,  978,  980,  982,  984,  986,  988,  991,  993,  995,
-      997,  999, 1001, 1004, 1006, 1009, 1011, 1013, 1015, 1017,
-
-     1019, 1021, 1023, 1025, 1027, 1029, 1031, 1033, 1035, 1037,
-     1039, 1041, 1043, 1046, 1048, 1050, 1052, 1054, 1056, 1058,
-     1060, 1062, 1064, 1066, 1068, 1071, 1073, 1076, 1078, 1081,
-     1083, 1085, 1087, 1089, 1091, 1093, 1095, 1097, 1099, 1101,
-     1103, 1105, 1107, 1109, 1111, 1113, 1115, 1117, 1119, 1121,
-     1123, 1125, 1127, 1129, 1132, 1134, 1136, 1138, 1141, 1143,
-     1145, 1147, 1149, 1151, 1154, 1157, 1159, 1161, 1163, 1165,
-     1168, 1170, 1172, 1174, 1177, 1179, 1181, 1184, 1186, 1188,
-     1191, 1194, 1196, 1198, 1201, 1204, 1206, 1208, 1210, 1212,
-     1215, 1217, 1220, 1222, 1224, 1226, 1229, 1231, 1234, 1236,
-
-     1238, 1240, 1241, 1242, 1243, 1244, 1245, 1245, 1246, 1248,
-     1249, 1250, 1251, 1253, 1253, 1253, 1254, 1255, 1256, 1256,
-     1256, 1256, 1257, 1257, 1258, 1258, 1260, 1261, 1263, 1264,
-     1265, 1266, 1268, 1271, 1274, 1277, 1280, 1284, 1286, 1287,
-     1287, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1293, 1294,
-     1294, 1295, 1296, 1297, 1298, 1299, 1300, 1302, 1304, 1306,
-     1308, 1310, 1312, 1314, 1316, 1319, 1321, 1323, 1326, 1328,
-     1330, 1332, 1334, 1336, 1338, 1340, 1342, 1344, 1346, 1348,
-     1350, 1352, 1355, 1357, 1357, 1357, 1359, 1361, 1363, 1365,
-     1367, 1369, 1372, 1375, 1377, 1379, 1381, 1383, 1386, 1388,
-
-     1391, 1393, 1396, 1399, 1401, 1403, 1406, 1408, 1410, 1413,
-     1415, 1417, 1419, 1421, 1423, 1426, 1429, 1431, 1433, 1436,
-     1438, 1440, 1442, 1444, 1447, 1450, 1453, 1456, 1459, 1461,
-     1463, 1466, 1468, 1471, 1473, 1475, 1477, 1479, 1482, 1485,
-     1488, 1490, 1492, 1495, 1497, 1500, 1502, 1505, 1508, 1510,
-     1512, 1514, 1516, 1518, 1520, 1522, 1525, 1527, 1529, 1531,
-     1533, 1535, 1537, 1539, 1541, 1544, 1546, 1548, 1550, 1553,
-     1556, 1558, 1560, 1562, 1564, 1567, 1569, 1571, 1573, 1573,
-     1575, 1578, 1580, 1583, 1585, 1587, 1589, 1591, 1593, 1595,
-     1598, 1600, 1602, 1604, 1606, 1609, 1611, 1613, 1616, 1619,
-
-     1622, 1624, 1627, 1629, 1631, 1633, 1636, 1638, 1641, 1643,
-     1645, 1647, 1649, 1651, 1653, 1655, 1657, 1659, 1661, 1663,
-     1665, 1667, 1669, 1671, 1673, 1675, 1677, 1680, 1682, 1685,
-     1687, 1689, 1692, 1695, 1698, 1700, 1702, 1704, 1704, 1706,
-     1708, 1710, 1712, 1715, 1717, 1719, 1722, 1724, 1726, 1728,
-     1730, 1733, 1736, 1738, 1741, 1743, 1745, 1748, 1751, 1753,
-     1755, 1757, 1759, 1761, 1763, 1765, 1767, 1769, 1771, 1773,
-     1776, 1778, 1779, 1781, 1783, 1785, 1786, 1786, 1787, 1788,
-     1789, 1791, 1793, 1795, 1797, 1801, 1801, 1801, 1802, 1803,
-     1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1810, 1810,
-
-     1810, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818,
-     1819, 1821, 1823, 1825, 1827, 1830, 1833, 1835, 1838, 1840,
-     1842, 1845, 1847, 1849, 1852, 1854, 1856, 1858, 1860, 1862,
-     1864, 1867, 1869, 1871, 1873, 1875, 1877, 1879, 1881, 1883,
-     1886, 1886, 1886, 1889, 1889, 1889, 1889, 1889, 1889, 1889,
-     1891, 1893, 1896, 1899, 1902, 1904, 1906, 1909, 1911, 1913,
-     1915, 1917, 1919, 1922, 1924, 1927, 1927, 1928, 1930, 1933,
-     1935, 1937, 1939, 1941, 1943, 1945, 1946, 1948, 1950, 1952,
-     1954, 1956, 1958, 1960, 1963, 1963, 1965, 1968, 1971, 1973,
-     1975, 1978, 1980, 1983, 1985, 1987, 1989, 1991, 1993, 1995,
-
-     1998, 2001, 2003, 2005, 2007, 2009, 2011, 2013, 2015, 2018,
-     2020, 2022, 2024, 2026, 2028, 2030, 2032, 2034, 2036, 2038,
-     2040, 2043, 2046, 2049, 2051, 2054, 2056, 2058, 2060, 2060,
-     2062, 2065, 2067, 2069, 2071, 2073, 2075, 2077, 2079, 2081,
-     2081, 2082, 2084, 2086, 2088, 2090, 2092, 2095, 2097, 2100,
-     2103, 2105, 2107, 2109, 2112, 2114, 2117, 2119, 2121, 2123,
-     2126, 2128, 2130, 2132, 2134, 2136, 2138, 2140, 2142, 2145,
-     2147, 2150, 2152, 2154, 2156, 2158, 2160, 2162, 2164, 2167,
-     2169, 2172, 2175, 2178, 2180, 2183, 2183, 2183, 2185, 2188,
-     2191, 2194, 2196, 2198, 2198, 2199, 2201, 2203, 2205, 2207,
-
-     2209, 2211, 2213, 2215, 2217, 2219, 2221, 2224, 2227, 2230,
-     2232, 2234, 2236, 2238, 2241, 2243, 2246, 2249, 2251, 2253,
-     2255, 2257, 2259, 2261, 2264, 2264, 2266, 2268, 2270, 2272,
-     2274, 2276, 2278, 2278, 2278, 2278, 2279, 2280, 2281, 2282,
-     2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292,
-     2293, 2293, 2293, 2293, 2293, 2294, 2295, 2296, 2296, 2297,
-     2297, 2298, 2299, 2300, 2301, 2302, 2304, 2307, 2310, 2312,
-     2314, 2316, 2318, 2320, 2322, 2325, 2327, 2329, 2331, 2333,
-     2335, 2337, 2339, 2341, 2343, 2346, 2349, 2351, 2353, 2355,
-     2357, 2359, 2361, 2361, 2361, 2361, 2361, 2361, 2361, 2361,
-
-     2361, 2361, 2363, 2365, 2368, 2371, 2373, 2375, 2377, 2379,
-     2381, 2384, 2386, 2388, 2391, 2394, 2396, 2398, 2401, 2403,
-     2405, 2406, 2409, 2411, 2413, 2415, 2416, 2418, 2420, 2420,
-     2422, 2425, 2428, 2430, 2433, 2435, 2437, 2439, 2441, 2443,
-     2445, 2448, 2450, 2452, 2454, 2456, 2458, 2461, 2463, 2465,
-     2467, 2469, 2472, 2474, 2477, 2479, 2482, 2485, 2487, 2489,
-     2491, 2494, 2497, 2499, 2501, 2503, 2505, 2505, 2507, 2509,
-     2511, 2514, 2517, 2520, 2523, 2525, 2527, 2529, 2531, 2534,
-     2536, 2538, 2540, 2542, 2544, 2546, 2548, 2551, 2553, 2555,
-     2557, 2559, 2562, 2564, 2567, 2569, 2571, 2573, 2575, 2577,
-
-     2580, 2582, 2585, 2588, 2590, 2592, 2594, 2596, 2598, 2600,
-     2600, 2600, 2602, 2602, 2603, 2605, 2607, 2609, 2611, 2613,
-     2616, 2616, 2616, 2616, 2618, 2620, 2622, 2624, 2627, 2630,
-     2633, 2635, 2638, 2640, 2642, 2645, 2648, 2651, 2651, 2653,
-     2655, 2657, 2659, 2662, 2665, 2667, 2670, 2672, 2674, 2676,
-     2679, 2681, 2681, 2683, 2685, 2687, 2690, 2693, 2696, 2699,
-     2699, 2699, 2700, 2701, 2701, 2702, 2703, 2704, 2705, 2706,
-     2707, 2708, 2709, 2710, 2711, 2711, 2712, 2713, 2714, 2715,
-     2716, 2716, 2716, 2716, 2716, 2717, 2717, 2717, 2717, 2717,
-     2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2726,
-
-     2728, 2731, 2733, 2735, 2737, 2740, 2743, 2745, 2747, 2749,
-     2752, 2752, 2755, 2755, 2755, 2755, 2755, 2755, 2755, 2757,
-     2759, 2762, 2764, 2766, 2768, 2770, 2772, 2775, 2775, 2775,
-     2775, 2775, 2775, 2775, 2775, 2776, 2776, 2776, 2777, 2777,
-     2777, 2777, 2778, 2778, 2780, 2782, 2785, 2786, 2788, 2791,
-     2793, 2795, 2795, 2797, 2800, 2802, 2804, 2806, 2808, 2810,
-     2813, 2815, 2817, 2820, 2822, 2824, 2824, 2826, 2829, 2831,
-     2833, 2836, 2838, 2840, 2842, 2845, 2848, 2850, 2852, 2854,
-     2856, 2858, 2860, 2862, 2864, 2866, 2869, 2871, 2871, 2874,
-     2876, 2879, 2881, 2884, 2884, 2886, 2888, 2890, 2893, 2895,
-
-     2897, 2899, 2902, 2905, 2907, 2909, 2912, 2915, 2917, 2920,
-     2922, 2924, 2927, 2929, 2931, 2933, 2935, 2937, 2939, 2941,
-     2943, 2946, 2948, 2951, 2953, 2956, 2958, 2960, 2962, 2964,
-     2966, 2968, 2968, 2968, 2971, 2971, 2971, 2971, 2973, 2975,
-     2977, 2979, 2979, 2981, 2983, 2985, 2987, 2989, 2992, 2995,
-     2997, 2997, 2997, 2999, 3001, 3003, 3005, 3007, 3009, 3012,
-     3014, 3016, 3019, 3019, 3022, 3025, 3028, 3031, 3034, 3037,
-     3037, 3037, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044,
-     3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054,
-     3055, 3056, 3057, 3058, 3059, 3060, 3060, 3060, 3060, 3060,
-
-     3060, 3060, 3060, 3060, 3061, 3062, 3063, 3063, 3064, 3064,
-     3065, 3066, 3067, 3068, 3069, 3069, 3072, 3074, 3076, 3078,
-     3080, 3083, 3085, 3085, 3085, 3085, 3085, 3085, 3085, 3085,
-     3085, 3088, 3091, 3093, 3095, 3097, 3099, 3101, 3101, 3101,
-     3101, 3101, 3101, 3101, 3101, 3101, 3101, 3103, 3105, 3105,
-     3105, 3108, 3111, 3111, 3113, 3115, 3118, 3121, 3123, 3125,
-     3128, 3130, 3132, 3135, 3135, 3137, 3140, 3142, 3144, 3147,
-     3149, 3150, 3150, 3153, 3155, 3157, 3160, 3162, 3165, 3168,
-     3169, 3171, 3173, 3173, 3175, 3178, 3178, 3181, 3184, 3186,
-     3189, 3192, 3194, 3197, 3200, 3202, 3204, 3206, 3208, 3211,
+#ifdef HAVE_GLOB_H
+#include <glob.h>
+#endif
 
-     3213, 3216, 3218, 3221, 3223, 3226, 3229, 3231, 3233, 3235,
-     3238, 3238, 3239, 3241, 3243, 3246, 3248, 3250, 3253, 3255,
-     3257, 3257, 3259, 3261, 3263, 3263, 3263, 3263, 3265, 3267,
-     3269, 3271, 3271, 3273, 3275, 3276, 3278, 3281, 3283, 3283,
-     3283, 3286, 3289, 3291, 3293, 3296, 3299, 3301, 3303, 3303,
-     3306, 3306, 3306, 3307, 3308, 3308, 3309, 3310, 3311, 3312,
-     3313, 3314, 3315, 3316, 3317, 3318, 3318, 3319, 3320, 3321,
-     3322, 3323, 3324, 3325, 3326, 3327, 3327, 3328, 3329, 3330,
-     3331, 3332, 3333, 3334, 3335, 3336, 3336, 3336, 3336, 3336,
-     3336, 3336, 3336, 3336, 3337, 3338, 3339, 3340, 3341, 3342,
+#ifdef HAVE_STRINGS_H
+#include <strings.h>
+#endif
 
-     3343, 3344, 3345, 3345, 3347, 3349, 3352, 3354, 3356, 3356,
-     3356, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3358, 3361,
-     3363, 3365, 3367, 3367, 3367, 3367, 3367, 3368, 3368, 3368,
-     3368, 3368, 3370, 3371, 3371, 3373, 3373, 3375, 3377, 3379,
-     3381, 3384, 3386, 3388, 3388, 3390, 3393, 3395, 3398, 3401,
-     3401, 3401, 3401, 3403, 3405, 3407, 3410, 3411, 3412, 3414,
-     3416, 3416, 3418, 3421, 3422, 3425, 3428, 3430, 3432, 3434,
-     3436, 3438, 3441, 3444, 3445, 3447, 3449, 3449, 3449, 3449,
-     3451, 3453, 3455, 3457, 3459, 3459, 3461, 3464, 3466, 3466,
-     3466, 3466, 3468, 3470, 3472, 3475, 3475, 3477, 3479, 3480,
+#include "monit.h"
+#include "y.tab.h"
 
-     3481, 3484, 3487, 3488, 3489, 3491, 3493, 3496, 3499, 3502,
-     3502, 3502, 3502, 3502, 3503, 3504, 3505, 3506, 3507, 3508,
-     3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517, 3518,
-     3519, 3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528,
-     3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536, 3537, 3538,
-     3538, 3538, 3538, 3538, 3538, 3538, 3538, 3538, 3539, 3540,
-     3541, 3541, 3542, 3542, 3543, 3544, 3545, 3546, 3547, 3547,
-     3549, 3551, 3554, 3556, 3558, 3558, 3558, 3558, 3559, 3560,
-     3561, 3561, 3561, 3561, 3561, 3563, 3565, 3568, 3571, 3571,
-     3572, 3572, 3572, 3572, 3572, 3573, 3573, 3575, 3576, 3576,
+// libmonit
+#include "util/Str.h"
 
-     3579, 3580, 3583, 3585, 3587, 3589, 3591, 3594, 3594, 3596,
-     3598, 3598, 3599, 3599, 3599, 3599, 3600, 3600, 3602, 3605,
-     3608, 3610, 3612, 3614, 3614, 3616, 3618, 3621, 3624, 3627,
-     3629, 3631, 3633, 3634, 3637, 3639, 3639, 3641, 3643, 3646,
-     3649, 3651, 3651, 3653, 3655, 3655, 3656, 3656, 3659, 3661,
-     3663, 3663, 3665, 3667, 3669, 3669, 3671, 3674, 3674, 3674,
-     3674, 3675, 3676, 3676, 3677, 3678, 3679, 3680, 3681, 3682,
-     3683, 3684, 3685, 3686, 3686, 3687, 3688, 3689, 3690, 3691,
-     3692, 3693, 3694, 3695, 3695, 3696, 3697, 3698, 3699, 3700,
-     3701, 3702, 3703, 3704, 3704, 3705, 3706, 3707, 3708, 3709,
 
-     3710, 3711, 3712, 3713, 3714, 3714, 3714, 3714, 3714, 3714,
-     3714, 3714, 3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721,
-     3722, 3723, 3724, 3726, 3728, 3730, 3733, 3734, 3734, 3734,
-     3734, 3734, 3734, 3734, 3734, 3736, 3738, 3738, 3738, 3738,
-     3741, 3742, 3744, 3746, 3748, 3750, 3750, 3752, 3754, 3754,
-     3755, 3755, 3755, 3755, 3755, 3755, 3758, 3761, 3763, 3764,
-     3766, 3769, 3771, 3773, 3775, 3777, 3777, 3779, 3781, 3783,
-     3783, 3786, 3788, 3789, 3789, 3791, 3793, 3793, 3795, 3798,
-     3798, 3801, 3801, 3802, 3802, 3802, 3802, 3803, 3804, 3805,
-     3806, 3807, 3808, 3809, 3810, 3811, 3812, 3813, 3814, 3815,
+// we don't use yyinput => do not generate it
+#define YY_NO_INPUT
 
-     3816, 3817, 3818, 3819, 3820, 3821, 3822, 3823, 3824, 3825,
-     3826, 3827, 3828, 3829, 3830, 3831, 3832, 3833, 3834, 3835,
-     3836, 3837, 3838, 3839, 3840, 3841, 3842, 3843, 3844, 3845,
-     3846, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847, 3847,
-     3848, 3849, 3850, 3850, 3851, 3851, 3852, 3853, 3854, 3855,
-     3856, 3856, 3858, 3860, 3862, 3862, 3863, 3863, 3863, 3863,
-     3863, 3863, 3864, 3867, 3869, 3869, 3869, 3870, 3870, 3871,
-     3874, 3876, 3878, 3880, 3880, 3882, 3884, 3884, 3884, 3884,
-     3884, 3887, 3889, 3889, 3891, 3893, 3895, 3897, 3900, 3900,
-     3902, 3904, 3906, 3907, 3910, 3910, 3912, 3915, 3915, 3915,
+#define MAX_STACK_DEPTH 512
 
-     3916, 3916, 3916, 3916, 3916, 3916, 3917, 3917, 3918, 3918,
-     3919, 3920, 3921, 3922, 3923, 3924, 3925, 3926, 3927, 3928,
-     3928, 3929, 3930, 3931, 3932, 3933, 3934, 3935, 3936, 3937,
-     3937, 3938, 3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946,
-     3946, 3947, 3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955,
-     3955, 3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963, 3964,
-     3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3965, 3966,
-     3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3974, 3976,
-     3979, 3981, 3981, 3981, 3981, 3982, 3982, 3983, 3986, 3986,
-     3988, 3990, 3993, 3994, 3996, 3998, 3998, 3998, 3998, 4000,
+int buffer_stack_ptr = 0;
 
-     4002, 4005, 4007, 4007, 4009, 4011, 4013, 4013, 4013, 4013,
-     4013, 4013, 4013, 4013, 4013, 4013, 4013, 4014, 4015, 4016,
-     4017, 4018, 4019, 4020, 4021, 4022, 4023, 4024, 4025, 4026,
-     4027, 4028, 4029, 4030, 4031, 4032, 4033, 4034, 4035, 4036,
-     4037, 4038, 4039, 4040, 4041, 4042, 4043, 4044, 4044, 4044,
-     4044, 4044, 4044, 4044, 4044, 4044, 4045, 4046, 4047, 4047,
-     4048, 4048, 4049, 4050, 4051, 4052, 4053, 4053, 4055, 4057,
-     4059, 4059, 4059, 4059, 4060, 4061, 4061, 4062, 4064, 4066,
-     4068, 4071, 4071, 4071, 4074, 4077, 4080, 4080, 4082, 4085,
-     4087, 4087, 4087, 4087, 4087, 4087, 4088, 4089, 4089, 4090,
+struct buffer_stack_s {
+        int             lineno;
+        char           *currentfile;
+        YY_BUFFER_STATE buffer;
+} buffer_stack[MAX_STACK_DEPTH];
 
-     4091, 4092, 4093, 4094, 4095, 4096, 4097, 4098, 4099, 4100,
-     4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108, 4109, 4110,
-     4111, 4112, 4113, 4114, 4115, 4116, 4117, 4118, 4119, 4120,
-     4121, 4122, 4122, 4122, 4122, 4122, 4122, 4122, 4122, 4122,
-     4123, 4124, 4125, 4126, 4127, 4127, 4129, 4131, 4133, 4133,
-     4134, 4134, 4136, 4139, 4141, 4141, 4141, 4141, 4141, 4143,
-     4143, 4143, 4143, 4143, 4143, 4144, 4145, 4146, 4147, 4148,
-     4149, 4150, 4151, 4152, 4153, 4154, 4155, 4156, 4157, 4158,
-     4159, 4160, 4161, 4162, 4163, 4164, 4165, 4166, 4167, 4167,
-     4167, 4167, 4167, 4167, 4167, 4167, 4167, 4168, 4169, 4170,
+int lineno = 1;
+int arglineno = 1;
+char *currentfile = NULL;
+char *argcurrentfile = NULL;
+char *argyytext = NULL;
+typedef enum {
+        Proc_State,
+        File_State,
+        FileSys_State,
+        Dir_State,
+        Host_State,
+        System_State,
+        Fifo_State,
+        Program_State,
+        Net_State,
+        Fileset_State,
+        None_State
+} __attribute__((__packed__)) Check_State;
 
-     4171, 4172, 4173, 4175, 4177, 4179, 4180, 4181, 4183, 4185,
-     4185, 4186, 4189, 4189, 4189, 4189, 4189, 4190, 4191, 4192,
-     4193, 4194, 4195, 4196, 4197, 4198, 4199, 4200, 4201, 4202,
-     4203, 4204, 4205, 4206, 4207, 4208, 4209, 4210, 4211, 4212,
-     4213, 4214, 4215, 4215, 4215, 4215, 4215, 4216, 4217, 4218,
-     4220, 4223, 4226, 4229, 4232, 4233, 4233, 4233, 4233, 4233,
-     4234, 4235, 4236, 4237, 4238, 4239, 4239, 4239, 4239, 4239,
-     4240, 4241, 4242, 4244, 4244, 4245, 4246, 4247, 4248, 4249,
-     4250, 4251, 4252, 4253, 4255, 4255, 4256, 4257, 4258, 4259,
-     4260, 4261, 4262, 4263, 4265, 4265, 4266, 4267, 4269, 4269,
+static Check_State check_state = None_State;
 
-     4272, 4273, 4273
-    } ;
+/* Prototypes */
+extern void yyerror(const char *,...);
+extern void yyerror2(const char *,...);
+extern void yywarning(const char *,...);
+extern void yywarning2(const char *,...);
+static void steplinenobycr(char *);
+static void save_arg(void);
+static void include_file(char *);
+static char *handle_quoted_string(char *);
+static void push_buffer_state(YY_BUFFER_STATE, char*);
+static int  pop_buffer_state(void);
+static URL_T create_URL(char *proto);
 
-static const YY_CHAR yy_ec[256] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
-        1,    1,    4,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    5,    6,    7,    8,    9,   10,    9,   11,   12,
-       13,   14,    9,   15,   16,   17,   18,   19,   20,   21,
-       22,   23,   24,   25,   26,   26,   26,   27,   28,   29,
-       30,   31,   32,   33,   34,   35,   36,   37,   38,   39,
-       40,   41,   42,   43,   44,   45,   46,   47,   48,   49,
-       50,   51,   52,   53,   54,   55,   56,   57,   58,   59,
-       60,   61,   62,    9,    9,    9,   63,   64,   65,   66,
 
-       67,   68,   69,   70,   71,   72,   73,   74,   75,   76,
-       77,   78,   79,   80,   81,   82,   83,   84,   85,   86,
-       87,   88,   89,    9,   90,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+#define YY_NUM_RULES 442
+#define YY_NUM_STATES 3221
+#define YY_NUM_CLASSES 65
+
+static const unsigned char yy_ec[256] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 5, 6, 7, 8, 9, 8, 10, 11, 12, 13, 8, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 25, 25, 26, 27, 28, 29, 30, 31,
+        32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 8, 62,
+        8, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 63, 8, 64, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+};
+
+static const short yy_accept[3221] = {
+        0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 439, 0, 0, 0, 0, 1, 1, 0, 0, 1,
+        1, 439, 442, 442, 442, 442, 0, 441, 441, 442, 0, 440, 440, 437, 431, 431, 437, 432, 436, 433,
+        435, 0, 435, 435, 435, 435, 0, 435, 435, 435, 0, 435, 435, 0, 0, 431, 431, 0, 434, 430,
+        427, 430, 428, 428, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 429, 427, 438, 426, 423,
+        426, 0, 425, 423, 0, 424, 422, 420, 419, 419, 421, 419, 418, 418, 419, 419, 420, 416, 438, 412,
+        438, 409, 409, 417, 415, 438, 409, 0, 0, 0, 410, 0, 0, 0, 413, 0, 413, 413, 415, 415,
+        415, 415, 410, 417, 417, 417, 417, 410, 409, 409, 412, 0, 412, 414, 0, 411, 416, 416, 416, 416,
+        410, 396, 391, 396, 393, 392, 393, 0, 394, 391, 0, 395, 397, 438, 399, 438, 397, 398, 398, 402,
+        402, 398, 398, 397, 398, 0, 401, 399, 0, 400, 397, 397, 398, 405, 407, 408, 403, 403, 404, 403,
+        403, 408, 408, 0, 406, 406, 345, 387, 346, 1, 2, 322, 2, 2, 387, 387, 387, 387, 387, 387,
+        387, 387, 387, 372, 372, 372, 372, 387, 387, 387, 347, 438, 387, 387, 387, 387, 387, 387, 387, 374,
+        390, 390, 387, 387, 382, 340, 342, 338, 438, 343, 387, 387, 339, 0, 380, 387, 387, 342, 341, 381,
+        381, 381, 381, 387, 387, 387, 387, 387, 233, 234, 387, 387, 387, 235, 237, 236, 238, 0, 0, 379,
+        0, 377, 0, 0, 378, 0, 376, 375, 375, 375, 375, 0, 0, 371, 375, 375, 375, 375, 0, 0,
+        0, 0, 0, 101, 375, 375, 375, 101, 375, 375, 375, 323, 375, 375, 375, 375, 375, 375, 375, 375,
+        375, 375, 375, 375, 216, 375, 323, 375, 375, 375, 375, 375, 323, 323, 338, 339, 325, 375, 375, 375,
+        375, 375, 375, 375, 375, 369, 375, 375, 375, 338, 375, 375, 375, 375, 375, 375, 375, 375, 375, 221,
+        194, 210, 375, 375, 375, 375, 375, 325, 375, 325, 325, 153, 375, 375, 375, 294, 375, 375, 375, 375,
+        375, 375, 73, 146, 375, 375, 375, 186, 375, 375, 90, 375, 375, 375, 375, 375, 0, 0, 0, 0,
+        146, 0, 0, 0, 0, 146, 375, 375, 146, 375, 375, 375, 146, 375, 375, 184, 375, 375, 29, 375,
+        375, 195, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 138, 375, 375, 375, 375, 375, 147,
+        375, 375, 375, 375, 147, 147, 147, 375, 375, 375, 375, 312, 375, 375, 93, 375, 176, 375, 375, 375,
+        375, 375, 301, 375, 375, 375, 375, 375, 375, 375, 375, 217, 375, 375, 384, 384, 375, 311, 375, 375,
+        375, 375, 318, 375, 375, 375, 375, 375, 135, 135, 375, 375, 375, 0, 37, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 375, 375, 375, 375, 375, 282, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+        375, 0, 0, 0, 0, 145, 375, 375, 375, 134, 375, 375, 375, 211, 375, 0, 0, 0, 0, 0,
+        0, 143, 0, 0, 143, 375, 375, 375, 218, 96, 375, 375, 375, 375, 94, 375, 375, 375, 94, 375,
+        375, 375, 375, 375, 375, 375, 375, 16, 72, 375, 375, 116, 375, 375, 82, 0, 375, 375, 375, 228,
+        375, 225, 375, 375, 225, 0, 0, 0, 228, 0, 225, 0, 0, 225, 187, 375, 375, 375, 375, 375,
+        57, 375, 375, 375, 197, 128, 0, 375, 375, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 118, 0, 0, 0, 0, 118, 118, 118, 0, 0, 0, 0, 122, 0, 122, 0, 122,
+        0, 0, 0, 0, 0, 122, 122, 0, 0, 0, 0, 0, 0, 0, 123, 0, 0, 0, 0, 0,
+        0, 123, 123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 119, 0,
+        0, 120, 120, 0, 0, 0, 0, 0, 0, 0, 0, 121, 121, 375, 144, 43, 375, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 142, 241, 243, 242, 244, 375, 231, 0, 375, 375, 375, 21, 375, 375,
+        375, 375, 123, 375, 375, 375, 231, 375, 137, 375, 375, 375, 0, 0, 0, 0, 103, 375, 375, 103,
+        375, 375, 375, 103, 375, 375, 0, 0, 15, 375, 375, 375, 375, 230, 230, 18, 41, 389, 389, 389,
+        389, 389, 389, 389, 389, 389, 389, 389, 389, 0, 389, 389, 389, 389, 389, 389, 389, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        389, 389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 389, 389, 389, 389, 389, 389,
+        389, 0, 389, 389, 389, 389, 389, 389, 389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 389, 389, 389, 389, 389, 389, 0, 389, 0, 389, 389, 389, 389, 389,
+        389, 389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 389, 389, 389, 389, 389,
+        389, 389, 389, 389, 389, 389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 389,
+        389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 389, 389, 389, 389, 389, 389, 389,
+        389, 389, 389, 389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 389, 389, 389, 389,
+        389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 389, 389, 389, 389, 389,
+        389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 389, 389, 389, 389, 389, 389, 375,
+        375, 375, 375, 375, 375, 347, 347, 150, 375, 375, 375, 375, 314, 375, 375, 375, 375, 151, 375, 271,
+        154, 12, 375, 157, 63, 375, 159, 158, 0, 0, 0, 0, 0, 0, 0, 0, 370, 375, 375, 375,
+        375, 375, 375, 375, 375, 375, 375, 375, 276, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 117,
+        375, 375, 117, 375, 375, 10, 375, 10, 375, 375, 375, 375, 375, 375, 279, 375, 375, 375, 375, 277,
+        375, 309, 165, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 164, 112, 375, 375, 375,
+        375, 375, 112, 166, 308, 375, 265, 266, 267, 375, 375, 375, 106, 375, 375, 188, 375, 375, 375, 109,
+        39, 0, 375, 375, 67, 67, 375, 375, 375, 70, 67, 375, 71, 375, 375, 375, 375, 375, 375, 316,
+        302, 375, 201, 375, 26, 375, 251, 375, 375, 375, 375, 375, 375, 139, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 139, 375, 375, 375, 375, 375, 251, 375, 375, 374, 375, 375, 375, 375, 375, 87,
+        375, 375, 375, 88, 375, 89, 343, 375, 375, 375, 375, 174, 259, 375, 375, 375, 375, 375, 375, 204,
+        375, 375, 375, 375, 297, 297, 375, 375, 375, 132, 0, 375, 375, 375, 375, 343, 0, 0, 0, 0,
+        354, 375, 173, 375, 375, 375, 340, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 278, 375, 375,
+        375, 341, 375, 375, 340, 375, 185, 375, 375, 375, 375, 375, 126, 375, 0, 0, 0, 0, 0, 125,
+        375, 126, 66, 375, 375, 273, 375, 340, 375, 375, 182, 183, 375, 375, 28, 375, 375, 375, 375, 205,
+        375, 375, 375, 99, 375, 59, 375, 375, 375, 375, 375, 213, 375, 375, 60, 375, 375, 375, 326, 326,
+        0, 0, 0, 0, 0, 0, 326, 0, 0, 0, 328, 0, 0, 0, 0, 0, 0, 0, 0, 327,
+        0, 0, 0, 375, 372, 375, 0, 0, 389, 389, 389, 389, 389, 389, 389, 389, 0, 389, 389, 389,
+        389, 389, 389, 389, 0, 389, 389, 389, 389, 389, 389, 389, 0, 389, 389, 389, 389, 389, 389, 389,
+        0, 389, 389, 389, 389, 389, 389, 389, 0, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 0, 0, 0, 389, 389, 389, 389, 389, 389,
+        389, 389, 0, 389, 389, 389, 389, 389, 389, 389, 0, 389, 389, 389, 389, 389, 389, 389, 0, 389,
+        389, 389, 389, 389, 389, 389, 0, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 0, 0,
+        0, 389, 389, 389, 389, 389, 389, 389, 389, 0, 389, 389, 389, 389, 389, 389, 389, 0, 389, 389,
+        389, 389, 389, 389, 389, 0, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        389, 389, 389, 389, 389, 389, 0, 0, 0, 389, 389, 389, 389, 389, 389, 389, 389, 0, 389, 389,
+        389, 389, 389, 389, 389, 0, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 0, 0, 0, 0, 0,
+        389, 389, 389, 389, 389, 389, 389, 389, 0, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        389, 389, 389, 389, 389, 389, 389, 0, 0, 0, 0, 0, 0, 0, 389, 389, 389, 389, 389, 389,
+        389, 389, 389, 0, 0, 0, 0, 389, 389, 389, 389, 389, 389, 389, 389, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389, 389,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 375, 375, 372, 372, 375, 373, 372, 373, 373, 373, 373, 375, 373, 375,
+        375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+        375, 375, 375, 375, 375, 373, 373, 373, 373, 373, 373, 372, 372, 372, 372, 372, 372, 372, 375, 375,
+        375, 375, 375, 375, 375, 375, 74, 74, 375, 375, 74, 375, 375, 375, 375, 375, 375, 73, 375, 73,
+        25, 170, 0, 375, 375, 375, 375, 286, 375, 375, 375, 375, 375, 375, 375, 375, 375, 287, 375, 375,
+        375, 215, 0, 0, 0, 0, 140, 0, 0, 0, 0, 0, 0, 0, 0, 140, 375, 375, 95, 375,
+        375, 48, 0, 0, 0, 34, 375, 375, 375, 375, 375, 375, 375, 356, 0, 356, 356, 375, 56, 375,
+        375, 375, 156, 375, 375, 348, 348, 300, 375, 375, 55, 181, 375, 375, 375, 375, 375, 375, 375, 375,
+        375, 375, 375, 375, 136, 136, 375, 375, 351, 375, 375, 375, 295, 375, 375, 375, 375, 375, 375, 375,
+        317, 227, 0, 375, 0, 0, 329, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        335, 0, 330, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 334, 0, 0, 0, 329, 0, 0,
+        0, 0, 0, 0, 0, 0, 333, 0, 0, 0, 0, 0, 332, 0, 0, 0, 331, 0, 0, 0,
+        0, 0, 0, 0, 336, 0, 0, 0, 0, 337, 375, 375, 375, 375, 0, 0, 0, 0, 0, 0,
+        375, 375, 375, 375, 375, 310, 226, 375, 375, 375, 375, 307, 375, 375, 375, 375, 0, 0, 0, 0,
+        141, 375, 261, 375, 375, 375, 375, 375, 79, 79, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+        214, 375, 375, 375, 375, 375, 375, 290, 375, 375, 375, 375, 375, 375, 222, 375, 375, 169, 375, 375,
+        375, 375, 375, 375, 375, 375, 375, 83, 375, 375, 375, 245, 245, 375, 375, 375, 375, 229, 375, 375,
+        229, 375, 375, 375, 232, 0, 0, 0, 0, 351, 0, 0, 0, 0, 351, 375, 375, 357, 375, 375,
+        148, 375, 375, 375, 375, 375, 375, 375, 283, 375, 375, 375, 375, 284, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 365, 0, 0, 364, 0, 0, 0, 0, 368, 0, 0, 0, 0, 0, 0,
+        0, 0, 363, 0, 0, 0, 359, 0, 0, 0, 0, 0, 0, 367, 358, 0, 0, 0, 357, 0,
+        0, 0, 366, 361, 0, 0, 0, 0, 0, 0, 360, 362, 375, 375, 375, 375, 375, 86, 375, 375,
+        375, 375, 375, 51, 375, 375, 375, 375, 375, 375, 77, 0, 0, 0, 0, 0, 77, 77, 375, 375,
+        375, 375, 30, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 53, 375, 375,
+        52, 375, 375, 375, 375, 375, 375, 97, 375, 375, 375, 375, 375, 375, 189, 375, 20, 375, 375, 375,
+        375, 375, 220, 375, 9, 375, 375, 375, 9, 9, 24, 375, 375, 8, 23, 375, 375, 104, 375, 375,
+        375, 375, 375, 375, 203, 8, 375, 375, 338, 375, 289, 375, 375, 375, 375, 375, 375, 375, 105, 105,
+        375, 105, 375, 375, 32, 32, 375, 375, 375, 375, 122, 375, 122, 122, 375, 375, 191, 375, 375, 375,
+        7, 375, 375, 375, 375, 375, 192, 375, 49, 375, 375, 50, 375, 375, 375, 342, 375, 375, 375, 375,
+        375, 375, 375, 375, 375, 270, 375, 375, 375, 375, 375, 272, 252, 375, 0, 38, 375, 252, 375, 298,
+        298, 375, 375, 375, 355, 375, 375, 375, 375, 375, 257, 375, 207, 375, 375, 375, 375, 375, 375, 375,
+        375, 127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 127, 375, 375, 342, 375, 375, 375,
+        375, 375, 288, 375, 375, 47, 0, 0, 0, 46, 375, 304, 375, 268, 375, 375, 375, 375, 375, 375,
+        161, 375, 375, 375, 383, 383, 250, 6, 375, 375, 375, 375, 320, 76, 0, 0, 0, 0, 0, 76,
+        76, 375, 375, 0, 0, 0, 0, 144, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+        375, 321, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 275, 375, 375, 375, 375, 375, 375,
+        375, 375, 375, 375, 375, 285, 375, 375, 375, 375, 375, 42, 375, 375, 178, 375, 375, 375, 375, 62,
+        375, 375, 375, 319, 319, 4, 375, 375, 375, 375, 375, 375, 375, 375, 375, 246, 375, 375, 375, 375,
+        375, 375, 375, 209, 209, 375, 350, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 160, 11, 375,
+        375, 375, 92, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 84,
+        375, 131, 375, 375, 375, 375, 64, 375, 375, 375, 375, 375, 263, 375, 200, 375, 31, 375, 375, 375,
+        375, 0, 0, 0, 0, 350, 0, 0, 0, 0, 350, 375, 0, 5, 375, 40, 375, 27, 375, 3,
+        375, 375, 375, 375, 114, 115, 375, 375, 375, 260, 375, 375, 375, 107, 375, 264, 375, 375, 375, 375,
+        375, 375, 375, 375, 375, 299, 375, 375, 375, 375, 375, 65, 375, 375, 375, 375, 313, 91, 375, 375,
+        375, 353, 375, 248, 248, 375, 167, 168, 375, 102, 375, 375, 375, 375, 375, 322, 375, 375, 322, 375,
+        69, 68, 22, 322, 375, 375, 375, 58, 375, 375, 375, 255, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 1, 375, 375, 375, 344, 375, 324, 375, 375, 375, 375, 375, 375, 375, 375, 171, 172,
+        375, 375, 375, 375, 375, 375, 78, 78, 375, 190, 375, 375, 375, 338, 375, 375, 349, 349, 375, 375,
+        177, 375, 199, 375, 375, 375, 375, 375, 375, 375, 375, 375, 0, 0, 0, 0, 352, 0, 0, 0,
+        0, 352, 0, 0, 0, 0, 352, 0, 0, 0, 0, 352, 375, 375, 375, 305, 291, 375, 324, 375,
+        375, 352, 375, 223, 375, 375, 375, 375, 152, 375, 375, 375, 375, 386, 386, 386, 371, 375, 375, 375,
+        223, 375, 375, 375, 196, 375, 375, 375, 375, 324, 324, 375, 375, 375, 375, 375, 75, 0, 0, 0,
+        0, 0, 75, 75, 375, 375, 375, 375, 375, 375, 375, 344, 344, 375, 375, 346, 346, 375, 375, 375,
+        375, 375, 375, 375, 375, 375, 375, 198, 375, 375, 375, 375, 375, 375, 375, 149, 375, 375, 375, 375,
+        375, 133, 375, 375, 202, 375, 258, 375, 375, 258, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+        375, 375, 375, 375, 375, 100, 306, 375, 375, 113, 375, 375, 375, 375, 375, 113, 375, 375, 375, 375,
+        375, 262, 206, 375, 375, 375, 375, 254, 375, 375, 72, 375, 72, 130, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 124, 0, 0, 0,
+        0, 14, 375, 375, 375, 13, 375, 19, 375, 375, 375, 375, 315, 375, 375, 375, 375, 375, 375, 375,
+        375, 375, 375, 375, 375, 375, 224, 375, 162, 163, 375, 292, 375, 375, 293, 375, 375, 375, 375, 375,
+        375, 375, 80, 375, 375, 375, 375, 61, 375, 256, 256, 44, 175, 0, 375, 375, 239, 240, 375, 375,
+        247, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 33, 375, 375, 111, 0, 375, 375,
+        36, 375, 375, 375, 375, 375, 375, 280, 0, 375, 375, 375, 375, 375, 375, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 375, 375, 110, 375, 375, 375, 375, 0, 35, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 375, 375, 375, 375, 375, 281, 375, 375, 375, 375, 375, 375, 375, 375, 375, 219, 375,
+        375, 375, 375, 375, 108, 155, 375, 375, 375, 81, 375, 375, 375, 375, 375, 375, 375, 375, 375, 180,
+        249, 375, 375, 375, 375, 54, 375, 375, 375, 375, 375, 0, 0, 0, 0, 98, 375, 375, 98, 375,
+        375, 375, 375, 375, 375, 208, 375, 212, 375, 345, 345, 375, 375, 375, 375, 375, 375, 85, 269, 375,
+        375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 274, 375, 375, 17, 375, 375, 375, 375, 375, 303,
+        375, 375, 375, 375, 385, 385, 385, 371, 375, 375, 375, 193, 375, 375, 375, 375, 375, 296, 375, 179,
+        253,
+};
+
+static const unsigned short yy_base[3221] = {
+        0, 65, 130, 195, 260, 325, 390, 455, 520, 585, 650, 715, 5037, 780, 5152, 0,
+        0, 845, 6711, 0, 0, 6800, 910, 975, 5169, 6771, 1040, 0, 0, 6817, 1105, 0,
+        0, 1170, 9180, 10867, 1235, 0, 0, 0, 0, 8631, 1300, 1365, 8727, 6859, 1430, 0,
+        0, 6942, 1495, 0, 0, 7031, 7149, 0, 0, 0, 0, 0, 5061, 6044, 6056, 0,
+        0, 6862, 8638, 6883, 6069, 6904, 8651, 6925, 6094, 10853, 11096, 0, 0, 0, 1560, 1625,
+        1690, 7276, 0, 0, 7386, 0, 0, 1755, 1820, 0, 0, 1885, 0, 0, 0, 0,
+        0, 1950, 2015, 2080, 2145, 6946, 6967, 2210, 2275, 2340, 0, 0, 2405, 7402, 0, 7499,
+        2470, 7758, 0, 2535, 0, 0, 0, 2600, 2665, 7800, 0, 0, 2730, 2795, 7842, 0,
+        0, 0, 0, 2860, 7921, 8115, 6081, 0, 0, 2925, 2990, 8157, 0, 3055, 6988, 3120,
+        3185, 0, 0, 8435, 0, 0, 8473, 0, 3250, 3315, 3380, 3445, 9162, 9166, 0, 10871,
+        0, 10902, 0, 0, 0, 8534, 0, 0, 8625, 0, 0, 0, 0, 0, 3510, 3575,
+        7009, 7030, 0, 0, 0, 0, 0, 3640, 0, 0, 3705, 5110, 5135, 10919, 3770, 3835,
+        3900, 0, 8552, 3965, 8575, 8594, 8743, 8764, 8749, 8644, 8770, 8561, 9195, 9203, 4998, 5112,
+        11006, 9149, 11072, 8752, 8665, 10888, 11107, 10904, 8767, 8645, 6790, 0, 4030, 4095, 8871, 6034,
+        4160, 9146, 9174, 11040, 11082, 0, 0, 4225, 0, 4290, 0, 0, 0, 0, 0, 0,
+        4355, 0, 0, 11091, 11121, 11346, 11434, 6952, 0, 0, 11493, 11543, 11658, 6741, 0, 0,
+        0, 11778, 4420, 0, 0, 0, 12254, 4485, 0, 0, 0, 4550, 4615, 12295, 6874, 12785,
+        13084, 0, 6937, 6958, 8873, 7125, 13142, 13142, 13145, 13142, 13159, 0, 9131, 6959, 6913, 13144,
+        0, 0, 8624, 7019, 7147, 11423, 4973, 8806, 6005, 5135, 7167, 10899, 6723, 11419, 7395, 7064,
+        13145, 13151, 0, 5988, 6960, 7165, 7211, 7228, 9155, 7208, 13147, 7317, 7271, 6996, 7379, 8656,
+        6099, 5065, 7294, 11428, 11229, 7367, 7337, 7354, 7422, 13148, 7375, 7292, 7399, 11141, 11434, 7458,
+        11435, 7479, 7401, 13149, 13150, 13151, 6834, 7251, 7252, 7421, 7376, 11217, 13157, 7437, 0, 13153,
+        7500, 8757, 11426, 13155, 8690, 6812, 7063, 7441, 7020, 7463, 13156, 13157, 8833, 8923, 6141, 13158,
+        7377, 7418, 13159, 8943, 7334, 11106, 13164, 7527, 13165, 13168, 13178, 13172, 7494, 13169, 13181, 13178,
+        13187, 0, 7563, 11437, 11234, 13175, 13185, 13179, 7535, 7485, 7501, 13172, 7584, 7522, 13173, 7505,
+        7547, 13174, 7420, 7526, 11035, 7605, 11223, 10915, 7626, 7525, 7647, 7674, 7022, 13175, 8963, 7653,
+        11438, 7710, 7043, 7694, 7716, 7752, 10998, 8983, 7736, 13176, 13177, 9003, 7460, 7543, 7779, 13178,
+        6183, 7568, 13179, 7758, 13180, 7546, 7585, 7800, 7586, 7565, 13181, 7065, 7461, 11254, 13186, 7836,
+        11441, 7857, 7610, 13183, 13193, 13215, 7682, 0, 7673, 13186, 7820, 7778, 7607, 7884, 13187, 7631,
+        11270, 7652, 7905, 7799, 8823, 13188, 7053, 7926, 7962, 5038, 0, 7114, 13195, 13199, 13208, 13198,
+        13216, 13205, 6736, 0, 13245, 11442, 7608, 11449, 7693, 7841, 13196, 11452, 7732, 7989, 7672, 11444,
+        11045, 9023, 7863, 7670, 11238, 8544, 13212, 13209, 13218, 0, 8010, 6225, 7733, 13200, 7754, 7946,
+        7883, 8611, 8046, 8635, 13216, 13208, 13218, 13208, 13224, 0, 13217, 13226, 0, 11450, 8067, 7904,
+        13208, 8577, 13218, 9043, 11458, 7691, 13210, 13221, 13224, 13212, 0, 11127, 11456, 7968, 7775, 11455,
+        8094, 8115, 8030, 7925, 13214, 11459, 7796, 13215, 7839, 11465, 8732, 9074, 7817, 11462, 7862, 13216,
+        11471, 11470, 8136, 7712, 13217, 13237, 13227, 13223, 0, 13232, 13231, 13229, 13223, 0, 13225, 11474,
+        8172, 9083, 7861, 11476, 13226, 7984, 7901, 8009, 13227, 10876, 10946, 8073, 11478, 13228, 13228, 13245,
+        13246, 13238, 13252, 13238, 13241, 13259, 13247, 13243, 13250, 13255, 7760, 13246, 13247, 13258, 13253, 13255,
+        13251, 0, 0, 13255, 13264, 13272, 13260, 10957, 8706, 13256, 13272, 0, 13262, 13275, 13268, 13275,
+        13261, 13263, 0, 13270, 13279, 6912, 13262, 13285, 13278, 13268, 7997, 13270, 13275, 13288, 13281, 13288,
+        13274, 13276, 0, 13277, 13277, 13293, 13285, 8040, 11488, 13282, 13279, 13297, 13285, 13298, 13293, 13291,
+        13284, 13289, 0, 13294, 13294, 13292, 0, 13298, 8081, 13310, 13299, 13300, 13305, 13308, 13313, 13300,
+        0, 7609, 13296, 11138, 8151, 7096, 13320, 13308, 13319, 13305, 13317, 13325, 13316, 13323, 0, 11146,
+        13305, 13306, 13307, 7922, 10913, 13312, 8051, 11481, 8051, 8093, 13310, 13333, 13326, 13316, 8124, 7966,
+        11480, 11475, 13313, 8135, 13314, 11165, 13333, 8113, 13334, 13320, 13330, 13331, 0, 11485, 11489, 13320,
+        13324, 13334, 13335, 0, 13333, 11534, 13334, 11535, 11496, 11497, 8006, 8134, 7860, 8178, 13326, 13327,
+        13328, 5176, 4989, 9211, 9219, 5090, 13369, 9227, 9235, 9243, 0, 6102, 6123, 6144, 5197, 13370,
+        9251, 9259, 9267, 6165, 6186, 6207, 9275, 8812, 13371, 9283, 5113, 0, 9291, 13372, 9299, 9307,
+        5184, 0, 9315, 8821, 9323, 5206, 13372, 0, 9331, 5227, 0, 0, 9339, 0, 9347, 5248,
+        0, 0, 9355, 0, 9363, 0, 9371, 5269, 0, 0, 5012, 9379, 9387, 5290, 13374, 6228,
+        6249, 6270, 5035, 8835, 13375, 9395, 5311, 6291, 13376, 6312, 9403, 8845, 9411, 5332, 13377, 9419,
+        8862, 13378, 9427, 5353, 0, 9435, 0, 9443, 9451, 5374, 0, 9459, 5395, 0, 0, 9467,
+        0, 9475, 0, 9483, 5416, 0, 0, 0, 9491, 5437, 0, 0, 9499, 0, 5058, 8872,
+        13379, 9507, 5458, 6333, 9515, 13380, 6354, 5081, 8882, 13381, 9523, 5479, 6375, 13382, 6396, 9531,
+        13383, 9539, 9547, 5500, 0, 9555, 8892, 9563, 5521, 13384, 9571, 9579, 9587, 0, 5542, 0,
+        9595, 5563, 0, 0, 9603, 0, 0, 9611, 0, 5584, 9619, 0, 0, 9627, 5605, 0,
+        0, 9635, 0, 6417, 6438, 0, 6459, 0, 0, 0, 6480, 6501, 13375, 0, 9643, 6522,
+        13386, 9651, 5626, 0, 0, 6543, 6564, 13377, 0, 8902, 13388, 9659, 5647, 0, 9667, 13389,
+        9675, 9683, 5668, 0, 9691, 9699, 9707, 0, 5689, 0, 9715, 0, 9723, 5710, 0, 0,
+        5731, 9731, 0, 0, 9739, 0, 9747, 0, 9755, 5752, 0, 0, 9763, 6585, 13390, 9771,
+        5773, 0, 0, 6606, 6627, 13381, 0, 9779, 5794, 6648, 0, 13392, 9787, 0, 6669, 6690,
+        13383, 0, 6711, 9795, 8912, 9803, 5815, 13394, 9811, 8922, 9819, 5836, 13395, 9827, 9835, 9843,
+        5857, 0, 0, 9851, 5878, 0, 0, 9859, 0, 0, 9867, 5899, 0, 0, 9875, 0,
+        0, 9883, 5920, 0, 0, 9891, 0, 9899, 5941, 6732, 0, 9907, 0, 6753, 0, 13386,
+        0, 8932, 10958, 13397, 13398, 8942, 13399, 0, 6774, 6795, 13390, 0, 6816, 9915, 13401, 9923,
+        9931, 5962, 0, 9939, 8952, 9947, 13402, 5983, 0, 9955, 9963, 0, 9971, 6004, 0, 9979,
+        0, 9987, 6110, 0, 0, 6131, 9995, 0, 0, 10003, 0, 6152, 10011, 0, 0, 10019,
+        0, 10027, 6173, 6837, 0, 10035, 0, 8156, 8198, 8155, 7086, 8199, 8220, 8240, 13363, 8678,
+        8027, 8176, 11495, 8090, 13364, 8177, 7944, 8194, 8262, 13365, 8112, 13366, 13367, 13368, 11498, 11020,
+        13369, 11500, 13370, 13371, 13388, 13392, 13397, 13395, 13395, 13383, 13383, 7137, 0, 11502, 8219, 8216,
+        11509, 8241, 7819, 8239, 8277, 8278, 8257, 8304, 13379, 8742, 6707, 8324, 8903, 11103, 8340, 11510,
+        8688, 8367, 11512, 6267, 11513, 11517, 13380, 8281, 11518, 11132, 8282, 13381, 8403, 11519, 8280, 11515,
+        8302, 8345, 13382, 8346, 11522, 8303, 8366, 13383, 8321, 13384, 8387, 8408, 8409, 8383, 8445, 13385,
+        7964, 13394, 13396, 13400, 13404, 13411, 13390, 0, 11521, 8323, 11527, 7902, 8363, 8472, 13392, 13393,
+        8424, 8446, 11119, 13394, 13395, 8508, 11532, 8426, 13396, 11530, 11536, 13397, 8598, 10817, 8467, 11114,
+        0, 5084, 8447, 8491, 9154, 8322, 8471, 13403, 11535, 13399, 0, 9146, 13400, 11149, 8386, 8469,
+        11537, 8750, 8470, 13401, 13402, 11545, 13403, 11158, 11154, 11548, 10835, 11093, 11538, 11543, 11550, 11544,
+        11546, 11273, 11283, 13413, 13415, 13416, 13426, 13429, 13413, 13425, 13420, 13422, 0, 11552, 11554, 11555,
+        11560, 11563, 13413, 11566, 11561, 13414, 11577, 10976, 11574, 11576, 11581, 13415, 8448, 11580, 11578, 13416,
+        8217, 13417, 6854, 11571, 11081, 11583, 11073, 13418, 11268, 11582, 11588, 11589, 8513, 11579, 11590, 13419,
+        13420, 11587, 11596, 11597, 11599, 13421, 11603, 11598, 11604, 13422, 11647, 11608, 8553, 8533, 11614, 13423,
+        13426, 13444, 13432, 13426, 0, 11613, 13428, 8792, 11625, 11615, 13429, 11616, 11617, 11623, 11622, 11627,
+        11630, 11639, 11633, 11629, 11635, 13430, 7124, 7127, 8816, 11637, 11161, 11638, 13431, 11644, 13432, 11655,
+        11654, 11646, 11662, 11657, 11170, 11658, 7198, 13436, 13453, 13438, 13455, 0, 11666, 13437, 13438, 11656,
+        11650, 13439, 11664, 13440, 11661, 11052, 13441, 13442, 11670, 11667, 11665, 11672, 11692, 11675, 11693, 13443,
+        11683, 6309, 11676, 13444, 8863, 11253, 11694, 11695, 11689, 11696, 11686, 13445, 11697, 11703, 13446, 11710,
+        11690, 11708, 11284, 11750, 7201, 0, 10914, 11196, 11038, 13480, 0, 11289, 11292, 0, 0, 13458,
+        13464, 0, 13460, 13466, 0, 0, 11295, 0, 13462, 13468, 0, 10043, 6858, 8962, 5218, 5239,
+        6879, 5260, 10051, 10059, 10067, 13494, 5281, 0, 6900, 5302, 13495, 10075, 10083, 10091, 6921, 6942,
+        6963, 5323, 10099, 10107, 10115, 13496, 5344, 0, 6984, 5365, 8972, 10123, 10131, 10139, 7005, 5386,
+        7026, 5407, 8982, 10147, 10155, 6194, 7047, 5428, 7068, 7089, 7110, 0, 7131, 0, 0, 0,
+        7152, 0, 13487, 0, 8992, 13498, 0, 10163, 10966, 13499, 13500, 7173, 0, 13491, 0, 9002,
+        10983, 13502, 13503, 0, 10171, 13504, 7194, 0, 13495, 0, 13506, 10179, 6215, 13507, 13508, 10187,
+        13509, 7215, 0, 13500, 0, 9012, 10991, 13511, 13512, 9022, 13513, 0, 7236, 0, 13504, 0,
+        13515, 10195, 6236, 13516, 13517, 10203, 13518, 7257, 5449, 5470, 7278, 5491, 10211, 10219, 10227, 13519,
+        5512, 0, 7299, 5533, 13520, 10235, 10243, 10251, 7320, 7341, 7362, 5554, 10259, 10267, 10275, 13521,
+        5575, 0, 7383, 5596, 10283, 10291, 10299, 9032, 5617, 0, 7404, 7425, 7446, 0, 7467, 0,
+        0, 0, 7488, 0, 13512, 0, 13523, 10307, 6257, 13524, 13525, 10315, 13526, 7509, 0, 13517,
+        0, 13528, 10323, 6278, 13529, 13530, 10331, 13531, 7530, 0, 13522, 0, 9042, 10999, 13533, 13534,
+        9052, 13535, 0, 7551, 0, 13526, 0, 13537, 10339, 6299, 13538, 13539, 10347, 13540, 7572, 5638,
+        5659, 7593, 5680, 10355, 10363, 10371, 13541, 5701, 0, 7614, 5722, 13542, 10379, 10387, 10395, 7635,
+        7656, 7677, 5743, 10403, 10411, 10419, 13543, 5764, 0, 7698, 7719, 7740, 0, 7761, 0, 0,
+        0, 7782, 0, 13534, 0, 13545, 10427, 6320, 13546, 13547, 10435, 13548, 7803, 0, 13539, 0,
+        9062, 11007, 13550, 13551, 9072, 13552, 0, 7824, 0, 13543, 0, 13554, 10443, 6341, 13555, 13556,
+        10451, 13557, 7845, 5785, 5806, 7866, 5827, 10459, 10467, 10475, 13558, 5848, 0, 7887, 5869, 13559,
+        10483, 10491, 10499, 7908, 7929, 7950, 7971, 7992, 0, 8013, 0, 0, 0, 8034, 0, 13550,
+        0, 9082, 11015, 13561, 13562, 9092, 13563, 0, 8055, 0, 13554, 0, 13565, 10507, 6362, 13566,
+        13567, 10515, 13568, 5890, 8076, 8097, 13559, 5911, 8118, 5932, 10523, 10531, 10539, 13570, 5953, 0,
+        8139, 8160, 8181, 0, 8202, 0, 0, 0, 8223, 0, 13561, 0, 13572, 10547, 6383, 13573,
+        13574, 10555, 13575, 8244, 5974, 5104, 10563, 9102, 13576, 6404, 8265, 8286, 0, 8307, 0, 8328,
+        0, 0, 0, 8349, 10571, 13577, 5995, 0, 8370, 8391, 0, 8412, 0, 0, 0, 8433,
+        13568, 13579, 10579, 10587, 6425, 0, 10595, 9112, 10603, 13580, 6446, 0, 10611, 10619, 0, 10627,
+        6467, 0, 10635, 0, 10643, 6488, 0, 0, 6509, 10651, 0, 0, 10659, 0, 6530, 10667,
+        0, 0, 10675, 0, 10683, 13581, 10691, 6551, 13582, 13583, 8454, 13574, 8475, 13575, 8496, 13576,
+        8517, 13577, 8538, 11729, 6018, 8729, 10699, 0, 8740, 13588, 10707, 10715, 6572, 10723, 0, 9122,
+        13589, 10731, 6593, 10739, 0, 9131, 10747, 10755, 6614, 13589, 0, 10763, 0, 10771, 6635, 0,
+        0, 10779, 0, 10787, 0, 6656, 10795, 0, 0, 10803, 6677, 0, 0, 10811, 0, 10819,
+        6698, 13591, 0, 10827, 0, 13592, 11709, 7189, 11143, 11707, 11711, 7145, 11713, 11720, 10944, 13553,
+        11719, 11390, 13554, 11721, 11724, 11727, 11726, 11741, 11742, 11744, 11743, 13555, 13556, 11040, 11172, 11745,
+        11747, 11735, 11746, 13557, 11749, 11756, 11740, 11752, 11750, 11757, 11755, 11758, 11765, 13558, 11770, 11775,
+        11766, 13559, 13579, 13576, 13573, 13582, 0, 13569, 13574, 13578, 13570, 13572, 13584, 13579, 13581, 0,
+        11269, 8196, 13572, 11773, 11782, 11299, 11307, 13578, 13586, 0, 8750, 11787, 11786, 11778, 11789, 11194,
+        11312, 6884, 13585, 11826, 0, 11776, 13576, 11288, 11784, 11783, 13577, 11803, 11804, 11790, 13578, 13579,
+        11797, 11801, 13580, 13581, 11271, 13588, 11211, 11802, 11190, 10840, 11796, 6895, 11810, 6351, 11811, 11817,
+        11805, 13583, 11814, 11825, 13584, 11827, 11816, 11813, 13585, 11831, 11828, 11819, 11835, 11844, 11834, 11829,
+        13586, 11205, 11311, 11837, 10849, 0, 0, 13590, 13611, 13604, 13613, 13596, 11280, 13610, 11316, 13612,
+        13617, 13607, 11882, 0, 0, 13601, 0, 13601, 13617, 13610, 0, 13604, 13616, 13608, 13610, 11885,
+        0, 0, 5140, 13610, 11891, 0, 0, 0, 13611, 13626, 13622, 13614, 13616, 11892, 0, 0,
+        13631, 13630, 11894, 0, 0, 11319, 13616, 13628, 0, 0, 13633, 13620, 13620, 5162, 13632, 13628,
+        0, 13640, 13639, 11895, 0, 0, 11846, 11853, 11845, 11209, 11901, 13626, 13645, 13640, 13643, 13677,
+        11864, 11293, 11873, 11865, 11861, 13626, 13627, 11877, 11878, 11870, 11866, 13628, 6393, 11867, 11214, 11880,
+        9157, 13644, 13641, 13650, 0, 11879, 13632, 11883, 11881, 11887, 11884, 11892, 11890, 13633, 11893, 11897,
+        11911, 11894, 11910, 11907, 11913, 11912, 11914, 11900, 13634, 11292, 11905, 11908, 11922, 13635, 11919, 13636,
+        11917, 11918, 11931, 11932, 11935, 11927, 13637, 11947, 11928, 13638, 11939, 11934, 11933, 11955, 11948, 11956,
+        11957, 11952, 11960, 13639, 11959, 11963, 11951, 11954, 13640, 6435, 11968, 11962, 11966, 11967, 11972, 11974,
+        13641, 11982, 11988, 11326, 13642, 13647, 13659, 13656, 13665, 13652, 13652, 13672, 13661, 13659, 0, 11983,
+        11224, 10861, 11976, 11986, 6055, 11991, 11987, 11985, 11990, 11999, 11995, 11997, 13652, 11993, 12003, 12009,
+        12005, 13653, 13669, 13661, 12017, 13655, 13666, 13677, 13663, 13661, 13670, 13668, 13676, 0, 13669, 13669,
+        0, 13671, 13671, 13687, 13680, 0, 13672, 13677, 13691, 13694, 13678, 13684, 13682, 13676, 0, 13693,
+        13700, 13699, 0, 13690, 12021, 13701, 13689, 13707, 13696, 12062, 0, 13691, 13692, 12063, 0, 12024,
+        13707, 13698, 0, 13695, 12020, 13695, 13697, 13697, 13713, 13706, 0, 0, 12017, 11305, 12032, 12035,
+        12049, 13696, 12033, 6477, 12042, 12024, 12041, 13697, 12046, 12048, 12034, 12044, 12045, 12036, 11350, 11352,
+        13704, 13705, 13709, 13707, 13707, 0, 6519, 12046, 12043, 12037, 13703, 8657, 12051, 12055, 12068, 12067,
+        6561, 12076, 12058, 12075, 10935, 12072, 12082, 12064, 12077, 13704, 12074, 12084, 13705, 12070, 11318, 11222,
+        12078, 12073, 12090, 13706, 12085, 12088, 6603, 12094, 12102, 12091, 13707, 12093, 13708, 12098, 12107, 12106,
+        12111, 12101, 13709, 12115, 11316, 12110, 12108, 12113, 13710, 13711, 11325, 7231, 12123, 11321, 13712, 12131,
+        12120, 13713, 12116, 12137, 12126, 12128, 12130, 12129, 13714, 13715, 12141, 7254, 13716, 12136, 13717, 12139,
+        12133, 12157, 12142, 12150, 12149, 12153, 11335, 12183, 13723, 0, 12154, 12156, 12152, 13719, 12165, 12167,
+        12178, 12168, 11094, 12179, 11374, 11375, 12175, 12171, 13720, 12174, 12169, 12187, 13721, 11329, 12184, 12185,
+        12181, 12186, 13722, 12188, 13723, 12192, 12193, 13724, 13741, 12195, 7210, 12194, 12200, 12197, 12199, 11199,
+        12203, 6645, 12220, 7671, 12206, 12226, 12208, 12225, 12227, 12229, 12217, 13726, 8564, 12216, 6779, 0,
+        12232, 11122, 12218, 12224, 13727, 11337, 12234, 12221, 13728, 12235, 12236, 12242, 12240, 12250, 13729, 12258,
+        13730, 12262, 12263, 12255, 12259, 12251, 12261, 12266, 12268, 11391, 11393, 13740, 13742, 13743, 13753, 13756,
+        13740, 13752, 13747, 13749, 13745, 0, 12272, 12264, 13741, 12275, 12260, 12271, 12276, 12270, 13742, 12279,
+        12288, 12325, 12326, 13748, 13756, 0, 12296, 13745, 12287, 13746, 12298, 12304, 8557, 12290, 11351, 12293,
+        13747, 12300, 12297, 12312, 12346, 13787, 13749, 13750, 12311, 12304, 12310, 12307, 13751, 11395, 11399, 13758,
+        13759, 13763, 13761, 13761, 0, 12309, 11400, 11401, 13756, 13762, 13778, 0, 6770, 12313, 12315, 12322,
+        12323, 7986, 12326, 12331, 12327, 12328, 12317, 12335, 12337, 13760, 12340, 12338, 12352, 12346, 12343, 12363,
+        12345, 12362, 12365, 12367, 12355, 13761, 12356, 12354, 12372, 12368, 12364, 12373, 12370, 12380, 12375, 12374,
+        12381, 13762, 12399, 12390, 7269, 12391, 12399, 13763, 12405, 12393, 13764, 12397, 12401, 12392, 12394, 13765,
+        12408, 12410, 12406, 12403, 13766, 13767, 12419, 12425, 13788, 11371, 12422, 12430, 8663, 12413, 12420, 13769,
+        12423, 12424, 12429, 12437, 12428, 12431, 12435, 12438, 13770, 12436, 13771, 8028, 12442, 12451, 12475, 13777,
+        13777, 13797, 13779, 13779, 13782, 0, 13778, 12445, 12449, 12444, 12446, 12466, 12460, 12468, 8070, 12471,
+        12459, 12458, 12470, 12474, 12472, 8364, 12484, 12467, 12477, 12473, 12479, 13779, 12480, 13780, 12488, 12497,
+        12486, 12488, 13781, 12508, 12502, 11034, 11376, 12500, 13782, 12495, 13783, 12492, 13784, 11203, 12498, 12501,
+        12551, 13789, 13801, 13798, 13807, 13794, 13794, 13814, 13803, 13801, 0, 11410, 7345, 13794, 12511, 13795,
+        12527, 10916, 12516, 13796, 12524, 12517, 12510, 11388, 13797, 13798, 12518, 12519, 12531, 13799, 12529, 12532,
+        12534, 13800, 12530, 13801, 12541, 12535, 12537, 12540, 12544, 12549, 12550, 12543, 12559, 13802, 12548, 12563,
+        12569, 12568, 12571, 13803, 12576, 12564, 12577, 12574, 13804, 13805, 12560, 12578, 12580, 13806, 12581, 12570,
+        13807, 12575, 12584, 13808, 12587, 13809, 12577, 13815, 12589, 12590, 12602, 11105, 12598, 12594, 12605, 12596,
+        13811, 13812, 13813, 0, 12612, 12616, 12613, 13814, 12619, 12615, 12607, 13815, 0, 4680, 0, 4745,
+        4810, 0, 0, 0, 0, 0, 0, 0, 8763, 11220, 10897, 13816, 12618, 12643, 12639, 12617,
+        11207, 12614, 12621, 12625, 12629, 12623, 12631, 13817, 12628, 12642, 12651, 12655, 12638, 12640, 12646, 13818,
+        12648, 13819, 12664, 11377, 12653, 13820, 12656, 12666, 12657, 13821, 12674, 12659, 13822, 12676, 13823, 7017,
+        12687, 12681, 12684, 12667, 12677, 12673, 12675, 12720, 13828, 13840, 13837, 13846, 13833, 13833, 13853, 13842,
+        13840, 0, 13837, 13849, 13846, 13855, 13842, 13842, 13862, 13851, 13849, 0, 12679, 12685, 12682, 13842,
+        13843, 13849, 0, 12683, 12690, 13845, 12703, 11385, 12691, 12704, 12698, 12712, 13846, 12716, 12711, 12714,
+        12726, 4875, 13886, 13887, 0, 12722, 12706, 12701, 13849, 12718, 12721, 12727, 13850, 12729, 12709, 12717,
+        12734, 11367, 12758, 12728, 12735, 12736, 12743, 12750, 11418, 11420, 13857, 13858, 13862, 13860, 13860, 0,
+        12747, 12738, 12756, 12760, 12749, 12751, 12762, 12753, 13856, 12759, 12763, 12757, 13857, 12766, 12764, 12777,
+        12772, 12776, 12774, 12770, 12794, 12779, 12795, 13858, 7316, 13877, 12797, 12786, 12783, 12801, 12790, 13860,
+        13870, 13868, 13874, 13887, 13869, 0, 12808, 12799, 13866, 12804, 12806, 12802, 12810, 13867, 11401, 12811,
+        11291, 12809, 11398, 12812, 12813, 12817, 12822, 11394, 12819, 12818, 12830, 12825, 12831, 13868, 13869, 12829,
+        13870, 12828, 12833, 12847, 12840, 12851, 12838, 13871, 12845, 12852, 12843, 12850, 12842, 13872, 13873, 12853,
+        12861, 12859, 12868, 13874, 12877, 12875, 12876, 12878, 13875, 11436, 5039, 12881, 13878, 13898, 13897, 13894,
+        13882, 13900, 12918, 13904, 13886, 13902, 13903, 13905, 13893, 12919, 13907, 13895, 13896, 13900, 13898, 13898,
+        0, 13916, 13898, 13914, 0, 12871, 12873, 12879, 12887, 13897, 12891, 13898, 12884, 12903, 12892, 12901,
+        13899, 11099, 6015, 8664, 11422, 5019, 11409, 12894, 11416, 12890, 12906, 12893, 12911, 12904, 13900, 12905,
+        12900, 13901, 7332, 13902, 12931, 10910, 13903, 12902, 12913, 12932, 12912, 12925, 12923, 12926, 13904, 11457,
+        12927, 12928, 12934, 13905, 12922, 12929, 13906, 10854, 13907, 11245, 12933, 11448, 13908, 13909, 12939, 12945,
+        13910, 13926, 13922, 13936, 13936, 13927, 13935, 0, 13922, 13941, 13941, 13932, 13940, 0, 7359, 12946,
+        10863, 11056, 12943, 7157, 0, 12955, 12952, 12961, 12953, 12950, 12958, 13922, 6821, 12957, 12966, 12962,
+        12974, 12970, 11060, 6799, 13973, 13930, 13934, 13943, 13933, 13951, 13940, 0, 6685, 12964, 9156, 12978,
+        7241, 12971, 12982, 11064, 0, 13936, 7325, 13981, 13941, 13950, 13940, 13958, 13947, 6841, 0, 12979,
+        12988, 12981, 12976, 12984, 13937, 12986, 12992, 12989, 13008, 12998, 11074, 13001, 13006, 12997, 13938, 12999,
+        13013, 13011, 13012, 13021, 13939, 13940, 11425, 13022, 13024, 13941, 13026, 13028, 13014, 13015, 13039, 13023,
+        13025, 13032, 13029, 13942, 13943, 13047, 13048, 11236, 13033, 13944, 13049, 13056, 13055, 11421, 13052, 13949,
+        13961, 13958, 13967, 0, 13051, 13057, 13949, 13053, 13060, 13050, 13061, 13058, 12920, 13950, 13063, 13951,
+        13062, 13069, 13952, 13070, 13081, 13084, 13078, 13090, 13092, 13953, 13093, 13954, 13083, 13095, 13094, 13086,
+        13099, 13088, 13097, 13098, 13106, 13102, 13955, 13103, 13112, 13956, 13119, 13120, 13124, 13126, 13125, 13957,
+        13127, 13130, 13114, 13141, 4940, 13997, 13998, 0, 13132, 13117, 13128, 13960, 13139, 13133, 13134, 13142,
+        13140, 13961, 13154, 13962, 13963,
+};
+
+static const short yy_def[3221] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 13, 0, 0, 13, 17, 17, 0,
+        11, 0, 22, 23, 10, 23, 26, 0, 24, 22, 30, 0, 24, 33, 0, 33, 36, 0, 0, 0,
+        36, 0, 42, 43, 36, 43, 46, 0, 44, 42, 50, 0, 44, 50, 46, 34, 35, 33, 0, 0,
+        0, 0, 0, 62, 61, 61, 65, 66, 0, 68, 69, 70, 0, 72, 0, 0, 60, 0, 78, 79,
+        80, 80, 0, 79, 78, 0, 0, 87, 88, 88, 0, 91, 0, 0, 91, 88, 87, 97, 98, 99,
+        100, 100, 0, 103, 104, 105, 100, 100, 108, 108, 0, 105, 112, 112, 109, 115, 0, 100, 104, 119,
+        120, 119, 120, 103, 124, 125, 124, 125, 102, 101, 99, 131, 131, 98, 133, 0, 97, 137, 138, 137,
+        138, 141, 0, 143, 144, 0, 144, 143, 0, 142, 141, 150, 152, 153, 154, 155, 0, 152, 157, 157,
+        0, 0, 161, 156, 161, 155, 165, 154, 153, 0, 152, 156, 157, 0, 174, 175, 0, 175, 0, 176,
+        177, 175, 174, 183, 175, 0, 186, 186, 187, 0, 190, 191, 192, 0, 187, 195, 195, 195, 187, 198,
+        198, 196, 196, 191, 203, 203, 205, 198, 198, 198, 198, 0, 198, 210, 198, 198, 214, 198, 214, 0,
+        220, 221, 192, 222, 224, 222, 222, 222, 0, 0, 222, 231, 222, 233, 233, 231, 231, 222, 222, 224,
+        240, 240, 240, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 221, 258, 0,
+        258, 0, 220, 263, 0, 263, 0, 267, 268, 214, 214, 0, 0, 0, 214, 214, 214, 214, 0, 0,
+        0, 0, 0, 0, 214, 214, 214, 214, 268, 268, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 267, 267, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 198,
+        214, 214, 214, 214, 214, 0, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 267, 214, 267, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 267, 214, 0, 0, 0, 0,
+        0, 380, 0, 0, 0, 0, 214, 214, 214, 267, 267, 267, 267, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 267, 214, 214, 214, 214, 214, 267, 267, 0, 454, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 267, 214, 214, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 473, 482, 475, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 0, 0, 0, 0, 0, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 214, 214, 214, 214, 214, 267, 214, 214, 214, 214, 267, 267, 267, 267, 198,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 0, 214, 214, 214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 615, 616, 0, 617,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 634, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 647, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 664, 0, 0, 0, 0, 0, 0, 0, 214, 214, 214, 214, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 214, 214, 214, 214, 214, 214, 0, 267, 214, 214, 214, 267, 267,
+        267, 267, 267, 214, 214, 214, 214, 214, 214, 214, 267, 214, 0, 0, 0, 0, 0, 214, 214, 214,
+        267, 267, 267, 267, 267, 710, 0, 712, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0, 737, 738,
+        738, 740, 738, 0, 0, 0, 0, 742, 742, 0, 737, 750, 751, 751, 751, 751, 750, 0, 0, 0,
+        0, 759, 759, 760, 0, 0, 765, 765, 767, 765, 0, 0, 771, 772, 743, 774, 771, 774, 774, 774,
+        771, 774, 765, 765, 765, 765, 765, 765, 759, 760, 759, 760, 760, 760, 737, 794, 794, 796, 794, 798,
+        798, 0, 737, 802, 803, 802, 805, 802, 807, 0, 0, 0, 811, 812, 0, 0, 0, 0, 816, 816,
+        817, 0, 774, 771, 771, 824, 774, 771, 774, 774, 774, 771, 774, 816, 817, 816, 817, 817, 817, 814,
+        811, 814, 814, 814, 811, 814, 737, 846, 847, 846, 846, 846, 0, 851, 0, 737, 855, 856, 855, 855,
+        855, 860, 0, 0, 0, 864, 864, 866, 864, 0, 0, 870, 870, 0, 0, 771, 771, 774, 876, 774,
+        771, 774, 774, 774, 771, 774, 873, 870, 873, 873, 870, 873, 873, 864, 864, 864, 864, 864, 864, 737,
+        737, 900, 737, 902, 774, 774, 856, 856, 774, 908, 860, 855, 860, 860, 860, 911, 911, 847, 847, 774,
+        919, 0, 0, 921, 921, 922, 0, 0, 927, 927, 929, 927, 0, 771, 771, 774, 933, 774, 771, 774,
+        771, 774, 774, 774, 927, 927, 927, 927, 927, 927, 921, 922, 921, 922, 922, 922, 851, 846, 851, 851,
+        851, 957, 957, 803, 803, 774, 965, 807, 807, 802, 969, 807, 807, 969, 798, 798, 774, 976, 794, 0,
+        0, 980, 981, 0, 0, 0, 985, 986, 0, 0, 771, 771, 991, 774, 774, 771, 774, 774, 774, 771,
+        774, 988, 985, 988, 988, 988, 985, 988, 983, 980, 983, 983, 983, 980, 983, 978, 978, 794, 1017, 978,
+        1017, 750, 1021, 774, 1023, 756, 756, 1021, 1021, 756, 1021, 756, 742, 742, 774, 1034, 738, 0, 0, 1038,
+        1038, 1040, 1038, 0, 0, 1044, 0, 1045, 1046, 0, 771, 774, 771, 1050, 774, 771, 774, 771, 774, 774,
+        774, 1046, 1044, 1046, 1046, 1044, 1046, 1038, 1038, 1038, 1038, 1038, 1038, 1036, 1036, 738, 1075, 1036, 1075, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 0, 0, 0, 0, 0, 0, 0, 0, 1115, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 267, 267, 267, 267, 267, 267, 267, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        0, 0, 214, 214, 214, 214, 214, 267, 214, 214, 267, 214, 214, 198, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0, 214, 214, 214, 214, 214, 0, 0, 0, 0,
+        0, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 648, 0, 0, 0, 0, 0,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0,
+        0, 1380, 0, 0, 0, 1383, 0, 0, 0, 1387, 0, 0, 1388, 1392, 0, 1384, 1395, 1382, 0, 0,
+        0, 1398, 1401, 268, 203, 1404, 271, 0, 737, 738, 1409, 1409, 1409, 1409, 737, 1414, 0, 737, 1417, 1418,
+        1418, 1418, 1418, 1417, 0, 794, 1425, 1425, 1425, 1425, 737, 1430, 0, 802, 1433, 1433, 1433, 1433, 1433, 737,
+        0, 846, 1441, 1441, 1441, 1441, 1441, 737, 0, 737, 737, 1450, 737, 1452, 774, 774, 1447, 1456, 774, 1458,
+        1447, 1456, 1447, 1460, 1447, 1456, 1456, 1439, 1467, 774, 1469, 1439, 1439, 1467, 1467, 1439, 1471, 1467, 1430, 1478,
+        774, 1480, 1430, 1482, 1482, 1478, 1478, 1482, 1478, 1417, 1489, 774, 1491, 1423, 1423, 1489, 1489, 1423, 1489, 1423,
+        1414, 1500, 774, 1502, 1414, 1504, 1504, 1500, 1500, 1504, 1500, 1407, 0, 0, 737, 738, 1515, 1515, 1515, 1515,
+        737, 1520, 0, 737, 1523, 1524, 1524, 1524, 1524, 1523, 0, 794, 1531, 1531, 1531, 1531, 737, 1536, 0, 802,
+        1539, 1539, 1539, 1539, 737, 1544, 0, 737, 737, 1548, 737, 1550, 774, 774, 1544, 1554, 774, 1556, 1544, 1558,
+        1558, 1554, 1554, 1558, 1554, 1536, 1565, 774, 1567, 1536, 1569, 1569, 1565, 1565, 1569, 1565, 1523, 1576, 774, 1578,
+        1529, 1529, 1576, 1576, 1529, 1576, 1529, 1520, 1587, 774, 1589, 1520, 1591, 1591, 1587, 1587, 1591, 1587, 1513, 0,
+        0, 737, 738, 1602, 1602, 1602, 1602, 737, 1607, 0, 737, 1610, 1611, 1611, 1611, 1611, 1610, 0, 794, 1618,
+        1618, 1618, 1618, 737, 1623, 0, 737, 737, 1627, 737, 1629, 774, 774, 1623, 1633, 774, 1635, 1623, 1637, 1637,
+        1633, 1633, 1637, 1633, 1610, 1644, 774, 1646, 1616, 1616, 1644, 1644, 1616, 1644, 1616, 1607, 1655, 774, 1657, 1607,
+        1659, 1659, 1655, 1655, 1659, 1655, 1600, 0, 0, 737, 738, 1670, 1670, 1670, 1670, 737, 1675, 0, 737, 1678,
+        1679, 1679, 1679, 1679, 1678, 0, 737, 737, 1687, 737, 1689, 774, 774, 1678, 1693, 774, 1695, 1684, 1684, 1693,
+        1693, 1684, 1693, 1684, 1675, 1704, 774, 1706, 1675, 1708, 1708, 1704, 1704, 1708, 1704, 0, 1668, 1668, 0, 0,
+        737, 738, 1721, 1721, 1721, 1721, 737, 1726, 0, 737, 737, 1730, 737, 1732, 774, 774, 1726, 1736, 774, 1738,
+        1726, 1740, 1740, 1736, 1736, 1740, 1736, 1719, 0, 0, 1749, 1749, 1751, 1749, 737, 737, 1755, 737, 1757, 737,
+        1759, 774, 774, 1749, 0, 1763, 0, 774, 737, 737, 1769, 737, 1771, 774, 774, 1751, 0, 0, 1777, 1777,
+        1779, 1777, 0, 0, 1783, 0, 1784, 1785, 0, 771, 774, 771, 1789, 774, 771, 774, 771, 774, 774, 774,
+        1785, 1783, 1785, 1785, 1783, 1785, 1777, 1777, 1777, 1777, 1777, 1777, 1763, 1775, 1763, 1763, 1775, 1775, 1719, 0,
+        1600, 0, 1513, 0, 1407, 0, 1405, 214, 203, 214, 268, 1830, 214, 1830, 1833, 1833, 1835, 268, 1833, 268,
+        268, 1839, 1839, 268, 1840, 268, 1845, 1845, 1847, 1845, 1845, 268, 268, 1845, 1845, 1845, 1845, 1845, 1845, 1839,
+        1840, 1840, 1839, 1840, 1840, 1833, 1833, 1833, 1833, 1833, 1833, 1404, 1404, 1828, 1873, 1404, 1873, 1404, 214, 1405,
+        1405, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 0, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 214, 214, 214, 214,
+        214, 214, 0, 0, 0, 0, 1828, 214, 214, 214, 214, 214, 214, 0, 0, 0, 1955, 214, 214, 214,
+        214, 214, 214, 1946, 214, 214, 214, 214, 214, 214, 214, 214, 1405, 1405, 198, 214, 198, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 0, 214, 0, 2004, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2018,
+        0, 2014, 0, 2021, 0, 0, 2021, 0, 0, 0, 0, 0, 2031, 0, 0, 0, 0, 0, 2036, 2036,
+        0, 0, 0, 0, 0, 0, 0, 2045, 0, 0, 0, 2050, 0, 0, 0, 2053, 0, 2055, 0, 0,
+        0, 0, 0, 2061, 0, 0, 0, 0, 2067, 0, 214, 214, 214, 214, 0, 0, 0, 0, 0, 2002,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0, 0, 0, 0,
+        0, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 214, 214, 0, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 1946, 214, 214, 214, 214, 214, 214, 0, 0, 0, 0, 0, 0, 0, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        267, 267, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 1405, 214, 214, 214, 214, 214, 214, 198,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0, 0, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 0, 0, 0, 0, 214, 214, 214, 214, 214, 1405, 214, 214, 214, 214,
+        214, 214, 214, 214, 271, 2484, 214, 214, 214, 214, 214, 214, 214, 214, 0, 0, 0, 0, 0, 0,
+        0, 214, 214, 0, 0, 0, 0, 0, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 1946, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 1405, 1405, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 267, 267, 267, 267, 267, 267, 267, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 1946, 214, 214, 214, 214, 1946, 214, 214, 198, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 214, 0, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 1405, 267, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 267, 214, 214, 214, 214, 214, 214, 214, 214, 190, 2733, 190, 2735, 2736, 2736, 2735, 2735,
+        2733, 2733, 2733, 189, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 2630, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 214, 214, 214, 214, 214, 267, 267, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 2833, 2833, 2833, 2834, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0, 0, 0,
+        0, 0, 0, 0, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 267, 214, 214, 214, 214, 214, 214, 267, 267, 267, 267,
+        267, 267, 214, 214, 214, 214, 214, 214, 214, 214, 198, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2962, 0, 0, 0, 0, 0, 0, 2969, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2969, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 198, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 677, 214, 214, 214, 214, 214, 214,
+        214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 214, 214, 214, 0, 214, 267,
+        0, 214, 214, 214, 214, 214, 214, 214, 0, 214, 214, 214, 214, 214, 214, 3057, 3068, 0, 0, 0,
+        0, 0, 0, 3075, 214, 214, 214, 214, 267, 214, 214, 0, 0, 0, 0, 3094, 0, 0, 0, 0,
+        0, 3091, 3101, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0, 0, 0, 0, 0, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214, 214, 214, 214, 3204, 3204, 3204, 3205, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+        214,
+};
+
+static const short yy_nxt[14063] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 77, 189, 193, 189, 189, 228, 220, 190, 222, 219, 221, 189, 189, 222, 189,
+        223, 222, 224, 203, 204, 205, 206, 206, 206, 206, 206, 211, 189, 225, 226, 227,
+        222, 77, 195, 191, 201, 202, 197, 196, 215, 210, 194, 216, 217, 207, 188, 208,
+        199, 209, 218, 213, 186, 212, 187, 198, 200, 214, 216, 216, 222, 192, 222, 222,
+        77, 77, 175, 176, 178, 177, 176, 175, 173, 175, 175, 175, 174, 175, 175, 175,
+        175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+        175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+        175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+        175, 175, 175, 77, 152, 157, 152, 152, 77, 153, 154, 154, 77, 155, 156, 156,
+        154, 156, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 77, 156, 154,
+        154, 154, 154, 77, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 77, 77, 77, 142, 145, 142, 142, 77, 143, 144, 144, 77, 141, 77,
+        77, 144, 77, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 77, 77,
+        144, 144, 144, 144, 77, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 77, 77, 100, 101, 106, 101, 102, 100, 100, 103, 100, 100, 100,
+        100, 100, 100, 100, 99, 100, 104, 99, 99, 99, 99, 99, 99, 99, 99, 98,
+        100, 100, 100, 100, 97, 77, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+        105, 100, 100, 100, 100, 100, 86, 86, 93, 86, 87, 87, 88, 88, 88, 88,
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+        89, 88, 90, 88, 90, 88, 91, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+        88, 90, 88, 90, 88, 86, 92, 77, 77, 0, 77, 77, 77, 78, 79, 79,
+        77, 80, 77, 77, 79, 77, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 77, 77, 79, 79, 79, 79, 77, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 77, 77, 59, 60, 0, 60, 60, 59, 61, 59,
+        59, 59, 61, 59, 59, 59, 59, 59, 59, 59, 62, 62, 62, 62, 62, 62,
+        62, 62, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+        59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+        59, 59, 59, 59, 59, 59, 59, 59, 59, 33, 34, 39, 34, 35, 33, 33,
+        33, 33, 33, 33, 35, 35, 33, 34, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 36, 35, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 37, 33, 38, 33, 33, 33, 24, 21, 0, 0, 21, 24,
+        22, 24, 24, 24, 23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+        24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 20, 20, 20, 20, 0,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 16, 0, 0, 0,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 0, 16, 0, 16, 16, 16, 18, 18, 18,
+        18, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 18, 18, 0, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 29, 30,
+        0, 0, 30, 29, 24, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 25,
+        26, 0, 0, 26, 25, 25, 25, 25, 25, 24, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+        26, 26, 0, 0, 26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 30, 30, 0, 0, 30, 30, 31, 30, 30, 30, 30, 30, 30, 30, 30,
+        30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        30, 30, 57, 0, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+        0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 58, 57, 57, 57,
+        57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+        57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 0, 57, 0,
+        57, 57, 57, 44, 40, 0, 41, 40, 44, 42, 44, 44, 44, 43, 44, 44,
+        44, 0, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 0, 44, 44,
+        44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+        44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+        0, 44, 44, 44, 49, 49, 50, 50, 49, 49, 44, 49, 49, 49, 49, 49,
+        49, 49, 50, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 50, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+        49, 50, 49, 49, 49, 45, 45, 46, 46, 45, 45, 45, 45, 45, 45, 44,
+        45, 45, 45, 46, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 46,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 46, 45, 45, 45, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+        47, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+        46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+        46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+        46, 46, 46, 46, 46, 46, 46, 50, 50, 50, 50, 50, 50, 51, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 84,
+        84, 0, 0, 0, 0, 84, 0, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+        84, 84, 0, 0, 84, 84, 84, 84, 0, 84, 84, 84, 84, 84, 84, 84,
+        84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+        84, 84, 84, 84, 84, 84, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        83, 83, 0, 0, 0, 0, 83, 0, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 0, 0, 83, 83, 83, 83, 0, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 81, 81, 0, 0, 0, 0, 81, 0, 81, 81, 81, 81, 81, 81, 81,
+        81, 81, 81, 81, 0, 0, 81, 81, 81, 81, 0, 81, 81, 81, 81, 81,
+        81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+        81, 81, 81, 81, 81, 81, 81, 81, 81, 0, 0, 0, 0, 0, 0, 96,
+        96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+        96, 96, 96, 96, 96, 96, 96, 0, 96, 0, 96, 0, 96, 96, 96, 96,
+        96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+        96, 96, 96, 96, 96, 96, 0, 96, 0, 96, 0, 0, 0, 0, 0, 0,
+        96, 96, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+        95, 95, 95, 95, 95, 95, 95, 95, 0, 95, 0, 95, 94, 95, 95, 95,
+        95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+        95, 95, 95, 95, 95, 95, 95, 0, 95, 0, 95, 0, 0, 0, 0, 0,
+        0, 0, 0, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+        94, 94, 94, 94, 94, 94, 94, 94, 94, 0, 94, 0, 94, 94, 94, 94,
+        94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+        94, 94, 94, 94, 94, 94, 94, 94, 0, 94, 0, 94, 0, 0, 136, 136,
+        107, 107, 0, 136, 136, 107, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+        136, 136, 136, 136, 136, 136, 136, 136, 137, 136, 136, 136, 136, 136, 138, 136,
+        136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+        136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 134,
+        134, 134, 134, 0, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+        134, 133, 133, 133, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 134, 0,
+        134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+        134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+        107, 107, 107, 107, 0, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 130,
+        131, 107, 130, 130, 130, 130, 130, 130, 130, 130, 108, 107, 107, 107, 107, 107,
+        0, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+        130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 0, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 108, 107, 107, 107, 107,
+        107, 0, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+        107, 107, 123, 123, 107, 107, 0, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+        123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 124, 123, 123, 123,
+        123, 123, 125, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+        123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+        123, 123, 123, 118, 118, 107, 107, 0, 118, 118, 107, 118, 118, 118, 118, 118,
+        118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 119, 118, 118,
+        118, 118, 107, 120, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+        118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+        118, 118, 118, 118, 107, 107, 107, 107, 0, 107, 107, 107, 107, 111, 107, 107,
+        107, 107, 107, 107, 111, 107, 111, 111, 111, 111, 111, 111, 111, 111, 112, 107,
+        107, 107, 107, 107, 0, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 107,
+        107, 107, 107, 107, 107, 109, 109, 109, 109, 0, 109, 109, 109, 109, 109, 109,
+        109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 0,
+        109, 109, 109, 109, 109, 0, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+        109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+        109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 0, 109, 109, 109, 109, 113,
+        109, 109, 109, 109, 109, 109, 113, 109, 113, 113, 113, 113, 113, 113, 113, 113,
+        115, 109, 109, 109, 109, 109, 0, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+        113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+        113, 109, 109, 114, 109, 109, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        115, 0, 0, 0, 0, 0, 0, 115, 0, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 0, 0, 0, 0, 0, 0, 115, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 0, 0, 116, 0, 0, 0, 121, 121, 109, 109, 0, 121, 121, 109,
+        121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+        121, 121, 120, 121, 121, 121, 121, 109, 120, 121, 121, 121, 121, 121, 121, 121,
+        121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+        121, 121, 121, 121, 121, 121, 121, 121, 121, 120, 120, 0, 0, 0, 120, 120,
+        0, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+        120, 120, 120, 120, 120, 120, 120, 120, 0, 120, 120, 120, 120, 120, 120, 120,
+        120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+        120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 126, 126, 109, 109, 0, 126,
+        126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+        126, 126, 126, 126, 125, 126, 126, 126, 126, 126, 125, 126, 126, 126, 126, 126,
+        126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+        126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 125, 0, 0, 0,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 107, 107, 107, 107,
+        0, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 132, 107, 107, 132, 132,
+        132, 132, 132, 132, 132, 132, 108, 107, 107, 107, 107, 107, 0, 132, 132, 132,
+        132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+        132, 132, 132, 132, 132, 132, 132, 107, 107, 107, 107, 107, 107, 139, 139, 109,
+        109, 0, 139, 139, 109, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+        139, 139, 139, 139, 139, 139, 139, 138, 139, 139, 139, 139, 139, 138, 139, 139,
+        139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+        139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 138, 138,
+        0, 0, 0, 138, 138, 0, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+        138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+        138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+        138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 0,
+        0, 0, 0, 150, 150, 0, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+        150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+        150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+        150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+        0, 0, 0, 0, 147, 147, 0, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+        147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+        147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+        147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+        147, 0, 0, 0, 0, 0, 0, 0, 146, 146, 0, 0, 0, 0, 146, 0,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 0, 0, 146, 146, 146,
+        146, 0, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        0, 0, 160, 170, 172, 170, 170, 160, 160, 160, 160, 160, 160, 171, 171, 160,
+        163, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 171, 160, 160,
+        160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+        160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+        160, 160, 160, 0, 0, 0, 0, 168, 168, 0, 168, 168, 168, 168, 168, 168,
+        168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+        168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+        168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+        168, 168, 168, 168, 0, 0, 0, 0, 0, 0, 0, 167, 167, 0, 0, 0,
+        0, 167, 0, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 0, 0,
+        167, 167, 167, 167, 0, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+        167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+        167, 167, 167, 0, 0, 0, 0, 0, 0, 165, 165, 0, 165, 165, 165, 165,
+        165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+        165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+        165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+        165, 165, 165, 165, 165, 165, 182, 183, 183, 182, 183, 182, 183, 182, 182, 182,
+        184, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 181, 0, 0, 181, 0, 181, 0, 181, 181,
+        181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+        181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+        181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+        181, 181, 181, 181, 181, 181, 181, 181, 183, 183, 183, 183, 183, 183, 183, 183,
+        183, 183, 185, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+        183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+        183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+        183, 183, 183, 183, 183, 183, 183, 183, 183, 0, 0, 0, 0, 0, 0, 0,
+        267, 267, 0, 0, 0, 0, 267, 0, 267, 268, 267, 269, 269, 269, 269, 269,
+        269, 269, 269, 271, 0, 267, 267, 267, 267, 233, 3001, 269, 269, 269, 2995, 269,
+        269, 3002, 2993, 269, 269, 2999, 3003, 269, 269, 2996, 269, 269, 2998, 2997, 2994, 269,
+        3004, 269, 3000, 269, 267, 267, 267, 267, 0, 0, 2736, 2736, 193, 2736, 2736, 2736,
+        2736, 2732, 2732, 2736, 2736, 2736, 2736, 2732, 2736, 2732, 2733, 2732, 2732, 2732, 2732, 2732,
+        2732, 2732, 2732, 2732, 2736, 2736, 2732, 2732, 2732, 2732, 2735, 2732, 2732, 2732, 2732, 2732,
+        2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732,
+        2732, 2732, 2732, 2732, 2732, 2732, 2734, 2732, 2732, 2736, 2736, 0, 0, 0, 0, 0,
+        0, 0, 267, 267, 0, 0, 0, 0, 267, 0, 267, 268, 2711, 1405, 1405, 1405,
+        1405, 1405, 1405, 1405, 1405, 1406, 0, 267, 267, 267, 267, 233, 2710, 1405, 1405, 1405,
+        1405, 1405, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269,
+        2712, 269, 269, 269, 2713, 269, 267, 267, 267, 267, 0, 0, 0, 0, 193, 0,
+        0, 0, 0, 230, 230, 0, 0, 0, 0, 230, 0, 230, 231, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 233, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 267, 267, 0, 0, 0, 0, 267, 0, 267, 268, 267, 1405,
+        1405, 1405, 1405, 1405, 1405, 1405, 1405, 1406, 0, 267, 267, 267, 267, 233, 1405, 1405,
+        2567, 2568, 1405, 1405, 269, 269, 269, 269, 269, 2569, 269, 2570, 269, 2571, 269, 2566,
+        2565, 2572, 2573, 269, 269, 269, 269, 269, 267, 267, 267, 267, 0, 0, 262, 262,
+        262, 262, 262, 262, 264, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 263,
+        262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262,
+        262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262,
+        262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 257,
+        257, 257, 257, 257, 257, 257, 257, 257, 257, 259, 257, 257, 257, 257, 257, 257,
+        258, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+        257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+        257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+        0, 0, 0, 0, 0, 0, 0, 239, 239, 0, 0, 0, 0, 239, 0, 239,
+        240, 239, 239, 239, 239, 239, 239, 239, 239, 239, 0, 0, 239, 239, 239, 239,
+        233, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+        239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 235, 235, 0, 0, 0, 0, 235, 0,
+        235, 236, 235, 235, 235, 235, 235, 235, 235, 235, 235, 0, 0, 235, 235, 235,
+        235, 233, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+        235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 234, 234, 0, 0, 0, 0, 234,
+        0, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 0, 0, 234, 234,
+        234, 234, 0, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+        234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+        234, 0, 0, 0, 0, 0, 0, 0, 0, 0, 241, 241, 0, 0, 0, 0,
+        241, 0, 241, 242, 241, 241, 241, 241, 241, 241, 241, 241, 241, 0, 0, 241,
+        241, 241, 241, 233, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+        241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+        241, 241, 0, 0, 260, 260, 257, 260, 260, 260, 260, 260, 260, 260, 261, 260,
+        260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260,
+        260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260,
+        260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260, 260,
+        260, 260, 260, 260, 260, 265, 265, 262, 265, 265, 265, 266, 265, 265, 265, 265,
+        265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+        265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+        265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+        265, 265, 265, 265, 265, 265, 0, 0, 0, 0, 0, 0, 0, 267, 267, 0,
+        0, 0, 0, 267, 0, 267, 268, 267, 267, 267, 267, 267, 267, 267, 267, 267,
+        0, 0, 267, 267, 267, 267, 233, 267, 267, 267, 267, 267, 267, 267, 267, 267,
+        267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267,
+        267, 267, 267, 267, 267, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 288,
+        0, 0, 0, 0, 288, 0, 288, 289, 288, 288, 288, 288, 288, 288, 288, 288,
+        288, 0, 0, 288, 288, 288, 288, 233, 288, 288, 288, 288, 288, 288, 288, 288,
+        288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+        288, 288, 288, 288, 288, 288, 0, 0, 2736, 2736, 193, 2736, 2736, 2736, 2736, 2740,
+        2740, 2736, 2736, 2736, 2736, 2740, 2736, 2740, 2741, 2740, 2740, 2740, 2740, 2740, 2740, 2740,
+        2740, 2740, 2736, 2736, 2740, 2740, 2740, 2740, 2735, 2740, 2740, 2740, 2740, 2740, 2740, 2740,
+        2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740, 2740,
+        2740, 2740, 2740, 2740, 2742, 2740, 2740, 2736, 2736, 2736, 2736, 193, 2736, 2736, 2736, 2736,
+        2738, 2738, 2736, 2736, 2736, 2736, 2738, 2736, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738,
+        2738, 2738, 2738, 2736, 2736, 2738, 2738, 2738, 2738, 2736, 2738, 2738, 2738, 2738, 2738, 2738,
+        2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738, 2738,
+        2738, 2738, 2738, 2738, 2738, 2739, 2738, 2738, 2736, 2736, 2736, 2736, 193, 2736, 2736, 2736,
+        2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736,
+        2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736,
+        2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736,
+        2736, 2736, 2736, 2736, 2736, 2736, 2737, 2736, 2736, 2736, 2736, 2834, 2834, 2834, 2834, 2834,
+        2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2835, 2834, 2834, 2834,
+        2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834,
+        2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834,
+        2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 0, 3205, 3205, 0, 3205,
+        3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3206, 3205, 3205,
+        3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205,
+        3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205,
+        3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 3205, 0, 1037, 295, 747,
+        747, 747, 747, 747, 747, 747, 747, 749, 1404, 1404, 1404, 1404, 1404, 1404, 748, 748,
+        748, 748, 748, 748, 979, 269, 799, 799, 799, 799, 799, 799, 799, 799, 801, 473,
+        2954, 473, 473, 2954, 474, 800, 800, 800, 800, 800, 800, 810, 3054, 972, 972, 972,
+        972, 972, 972, 972, 972, 809, 76, 17, 76, 76, 3055, 475, 808, 808, 808, 808,
+        808, 808, 852, 269, 959, 959, 959, 959, 959, 960, 851, 851, 854, 1201, 476, 1201,
+        1201, 2955, 1200, 853, 853, 853, 853, 853, 853, 863, 326, 913, 913, 913, 913, 913,
+        914, 860, 860, 862, 1036, 1036, 1036, 1036, 1036, 1036, 861, 861, 861, 861, 861, 861,
+        1764, 269, 1814, 1814, 1814, 1814, 1814, 1815, 1763, 1763, 1766, 763, 763, 763, 763, 763,
+        763, 1765, 1765, 1765, 1765, 1765, 1765, 269, 2036, 1319, 2911, 269, 1320, 1321, 269, 2913,
+        2037, 1322, 269, 269, 2914, 1323, 2912, 1318, 2915, 2910, 2916, 269, 1324, 269, 2063, 269,
+        2744, 2749, 0, 2750, 2746, 0, 2064, 24, 2745, 2035, 15, 24, 2751, 269, 2752, 269,
+        2753, 269, 2747, 2748, 2754, 298, 2038, 269, 2755, 743, 738, 739, 740, 741, 741, 741,
+        741, 741, 769, 769, 769, 769, 769, 769, 2062, 742, 742, 742, 742, 742, 742, 1031,
+        1031, 1031, 1031, 1031, 1031, 1031, 1031, 757, 775, 775, 775, 775, 775, 775, 756, 756,
+        756, 756, 756, 756, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1408, 778, 778, 778,
+        778, 778, 778, 1407, 1407, 1407, 1407, 1407, 1407, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+        1511, 1512, 784, 784, 784, 784, 784, 784, 1511, 1511, 1511, 1511, 1511, 1511, 1414, 1414,
+        1414, 1414, 1414, 1414, 1414, 1414, 1416, 792, 792, 792, 792, 792, 792, 1415, 1415, 1415,
+        1415, 1415, 1415, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1416, 978, 978, 978, 978,
+        978, 978, 1501, 1501, 1501, 1501, 1501, 1501, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499,
+        1424, 807, 807, 807, 807, 807, 807, 1423, 1423, 1423, 1423, 1423, 1423, 1430, 1430, 1430,
+        1430, 1430, 1430, 1430, 1430, 1432, 839, 839, 839, 839, 839, 839, 1431, 1431, 1431, 1431,
+        1431, 1431, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1432, 820, 820, 820, 820, 820,
+        820, 1479, 1479, 1479, 1479, 1479, 1479, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1440,
+        826, 826, 826, 826, 826, 826, 1439, 1439, 1439, 1439, 1439, 1439, 1467, 1467, 1467, 1467,
+        1467, 1467, 1467, 1467, 1440, 829, 829, 829, 829, 829, 829, 1468, 1468, 1468, 1468, 1468,
+        1468, 1463, 1463, 1463, 1463, 1463, 1464, 1446, 1446, 1448, 837, 837, 837, 837, 837, 837,
+        1447, 1447, 1447, 1447, 1447, 1447, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1448, 842,
+        842, 842, 842, 842, 842, 1457, 1457, 1457, 1457, 1457, 1457, 1513, 1513, 1513, 1513, 1513,
+        1513, 1513, 1513, 1514, 851, 851, 851, 851, 851, 851, 1513, 1513, 1513, 1513, 1513, 1513,
+        1598, 1598, 1598, 1598, 1598, 1598, 1598, 1598, 1599, 860, 860, 860, 860, 860, 860, 1598,
+        1598, 1598, 1598, 1598, 1598, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1522, 868, 868,
+        868, 868, 868, 868, 1521, 1521, 1521, 1521, 1521, 1521, 1587, 1587, 1587, 1587, 1587, 1587,
+        1587, 1587, 1522, 886, 886, 886, 886, 886, 886, 1588, 1588, 1588, 1588, 1588, 1588, 1586,
+        1586, 1586, 1586, 1586, 1586, 1586, 1586, 1530, 879, 879, 879, 879, 879, 879, 1529, 1529,
+        1529, 1529, 1529, 1529, 1536, 1536, 1536, 1536, 1536, 1536, 1536, 1536, 1538, 882, 882, 882,
+        882, 882, 882, 1537, 1537, 1537, 1537, 1537, 1537, 1565, 1565, 1565, 1565, 1565, 1565, 1565,
+        1565, 1538, 892, 892, 892, 892, 892, 892, 1566, 1566, 1566, 1566, 1566, 1566, 1563, 1563,
+        1563, 1563, 1563, 1563, 1563, 1563, 1546, 895, 895, 895, 895, 895, 895, 1545, 1545, 1545,
+        1545, 1545, 1545, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1546, 915, 915, 915, 915,
+        915, 915, 1555, 1555, 1555, 1555, 1555, 1555, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600,
+        1601, 925, 925, 925, 925, 925, 925, 1600, 1600, 1600, 1600, 1600, 1600, 1666, 1666, 1666,
+        1666, 1666, 1666, 1666, 1666, 1667, 931, 931, 931, 931, 931, 931, 1666, 1666, 1666, 1666,
+        1666, 1666, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1609, 937, 937, 937, 937, 937,
+        937, 1607, 1607, 1607, 1607, 1607, 1607, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1609,
+        942, 942, 942, 942, 942, 942, 1655, 1655, 1655, 1655, 1655, 1655, 1654, 1654, 1654, 1654,
+        1654, 1654, 1654, 1654, 1617, 947, 947, 947, 947, 947, 947, 1616, 1616, 1616, 1616, 1616,
+        1616, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1625, 954, 954, 954, 954, 954, 954,
+        1624, 1624, 1624, 1624, 1624, 1624, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1625, 961,
+        961, 961, 961, 961, 961, 1634, 1634, 1634, 1634, 1634, 1634, 1668, 1668, 1668, 1668, 1668,
+        1668, 1668, 1668, 1669, 969, 969, 969, 969, 969, 969, 1668, 1668, 1668, 1668, 1668, 1668,
+        1716, 1716, 1716, 1716, 1716, 1716, 1716, 1716, 1715, 1008, 1008, 1008, 1008, 1008, 1008, 1716,
+        1716, 1716, 1716, 1716, 1716, 1676, 1676, 1676, 1676, 1676, 1676, 1676, 1676, 1677, 1001, 1001,
+        1001, 1001, 1001, 1001, 1675, 1675, 1675, 1675, 1675, 1675, 1705, 1705, 1705, 1705, 1705, 1705,
+        1705, 1705, 1677, 994, 994, 994, 994, 994, 994, 1704, 1704, 1704, 1704, 1704, 1704, 1703,
+        1703, 1703, 1703, 1703, 1703, 1703, 1703, 1685, 997, 997, 997, 997, 997, 997, 1684, 1684,
+        1684, 1684, 1684, 1684, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1720, 1004, 1004, 1004,
+        1004, 1004, 1004, 1719, 1719, 1719, 1719, 1719, 1719, 1747, 1747, 1747, 1747, 1747, 1747, 1747,
+        1747, 1748, 1011, 1011, 1011, 1011, 1011, 1011, 1747, 1747, 1747, 1747, 1747, 1747, 1727, 1727,
+        1727, 1727, 1727, 1727, 1727, 1727, 1728, 1017, 1017, 1017, 1017, 1017, 1017, 1726, 1726, 1726,
+        1726, 1726, 1726, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1728, 1042, 1042, 1042, 1042,
+        1042, 1042, 1737, 1737, 1737, 1737, 1737, 1737, 1752, 1750, 1749, 1753, 1753, 1753, 1753, 1753,
+        1754, 1048, 1048, 1048, 1048, 1048, 1048, 1751, 1751, 1751, 1751, 1751, 1751, 1768, 1768, 1768,
+        1768, 1768, 1768, 1768, 1768, 1767, 1054, 1054, 1054, 1054, 1054, 1054, 1768, 1768, 1768, 1768,
+        1768, 1768, 1830, 308, 1829, 1829, 1829, 1829, 1829, 1829, 1829, 1829, 269, 64, 297, 64,
+        64, 3191, 3192, 1827, 1827, 1827, 1827, 1827, 1827, 65, 65, 65, 3193, 269, 65, 65,
+        65, 65, 65, 65, 65, 65, 68, 269, 68, 68, 63, 63, 63, 63, 63, 63,
+        63, 63, 69, 69, 69, 244, 243, 69, 69, 69, 69, 69, 69, 69, 69, 72,
+        2181, 72, 72, 134, 134, 134, 134, 134, 134, 134, 134, 73, 73, 73, 2182, 269,
+        73, 73, 73, 73, 73, 73, 73, 73, 1032, 1032, 1032, 1032, 1032, 1032, 1032, 1032,
+        1059, 1059, 1059, 1059, 1059, 1059, 330, 1033, 1033, 1033, 1033, 1033, 1033, 1032, 1032, 1032,
+        1032, 1032, 1032, 1032, 1032, 1064, 1064, 1064, 1064, 1064, 1064, 269, 1033, 1033, 1033, 1033,
+        1033, 1033, 751, 752, 753, 754, 754, 754, 754, 754, 1070, 1070, 1070, 1070, 1070, 1070,
+        367, 750, 750, 750, 750, 750, 750, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1075,
+        1075, 1075, 1075, 1075, 1075, 269, 1022, 1022, 1022, 1022, 1022, 1022, 1021, 1021, 1021, 1021,
+        1021, 1021, 1021, 1021, 1446, 1446, 1446, 1446, 1446, 1446, 433, 1022, 1022, 1022, 1022, 1022,
+        1022, 794, 795, 796, 797, 797, 797, 797, 797, 1485, 1485, 1485, 1485, 1485, 1485, 269,
+        798, 798, 798, 798, 798, 798, 974, 974, 974, 974, 974, 974, 974, 974, 1507, 1507,
+        1507, 1507, 1507, 1507, 508, 975, 975, 975, 975, 975, 975, 974, 974, 974, 974, 974,
+        974, 974, 974, 1561, 1561, 1561, 1561, 1561, 1561, 269, 975, 975, 975, 975, 975, 975,
+        804, 802, 805, 806, 806, 806, 806, 806, 1572, 1572, 1572, 1572, 1572, 1572, 1140, 803,
+        803, 803, 803, 803, 803, 963, 963, 963, 963, 963, 963, 963, 963, 1594, 1594, 1594,
+        1594, 1594, 1594, 269, 964, 964, 964, 964, 964, 964, 848, 849, 846, 850, 850, 850,
+        850, 850, 1640, 1640, 1640, 1640, 1640, 1640, 1362, 847, 847, 847, 847, 847, 847, 917,
+        917, 917, 917, 917, 917, 917, 917, 1662, 1662, 1662, 1662, 1662, 1662, 269, 918, 918,
+        918, 918, 918, 918, 857, 858, 855, 859, 859, 859, 859, 859, 1711, 1711, 1711, 1711,
+        1711, 1711, 1982, 856, 856, 856, 856, 856, 856, 906, 906, 906, 906, 906, 906, 906,
+        906, 1743, 1743, 1743, 1743, 1743, 1743, 269, 907, 907, 907, 907, 907, 907, 899, 899,
+        899, 899, 899, 899, 899, 899, 1763, 1763, 1763, 1763, 1763, 1763, 2093, 899, 899, 899,
+        899, 899, 899, 900, 900, 900, 900, 900, 900, 900, 900, 1781, 1781, 1781, 1781, 1781,
+        1781, 269, 901, 901, 901, 901, 901, 901, 902, 902, 902, 902, 902, 902, 902, 902,
+        1787, 1787, 1787, 1787, 1787, 1787, 2175, 903, 903, 903, 903, 903, 903, 904, 904, 904,
+        904, 904, 904, 904, 904, 1793, 1793, 1793, 1793, 1793, 1793, 269, 905, 905, 905, 905,
+        905, 905, 908, 908, 908, 908, 908, 908, 908, 908, 1798, 1798, 1798, 1798, 1798, 1798,
+        2260, 909, 909, 909, 909, 909, 909, 908, 908, 908, 908, 908, 908, 908, 908, 1803,
+        1803, 1803, 1803, 1803, 1803, 269, 909, 909, 909, 909, 909, 909, 908, 908, 908, 908,
+        908, 908, 908, 908, 1809, 1809, 1809, 1809, 1809, 1809, 2279, 909, 909, 909, 909, 909,
+        909, 919, 919, 919, 919, 919, 919, 919, 919, 1816, 1816, 1816, 1816, 1816, 1816, 269,
+        920, 920, 920, 920, 920, 920, 919, 919, 919, 919, 919, 919, 919, 919, 1838, 1838,
+        1838, 1838, 1838, 1838, 2289, 920, 920, 920, 920, 920, 920, 919, 919, 919, 919, 919,
+        919, 919, 919, 1844, 1844, 1844, 1844, 1844, 1844, 269, 920, 920, 920, 920, 920, 920,
+        965, 965, 965, 965, 965, 965, 965, 965, 1850, 1850, 1850, 1850, 1850, 1850, 2311, 966,
+        966, 966, 966, 966, 966, 965, 965, 965, 965, 965, 965, 965, 965, 1855, 1855, 1855,
+        1855, 1855, 1855, 269, 966, 966, 966, 966, 966, 966, 965, 965, 965, 965, 965, 965,
+        965, 965, 1864, 1864, 1864, 1864, 1864, 1864, 2412, 966, 966, 966, 966, 966, 966, 976,
+        976, 976, 976, 976, 976, 976, 976, 1867, 1867, 1867, 1867, 1867, 1867, 269, 977, 977,
+        977, 977, 977, 977, 976, 976, 976, 976, 976, 976, 976, 976, 1873, 1873, 1873, 1873,
+        1873, 1873, 3120, 977, 977, 977, 977, 977, 977, 974, 974, 974, 974, 974, 974, 974,
+        974, 483, 3119, 483, 483, 269, 1197, 19, 975, 975, 975, 975, 975, 975, 976, 976,
+        976, 976, 976, 976, 976, 976, 1196, 1198, 255, 254, 256, 269, 301, 977, 977, 977,
+        977, 977, 977, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 269, 2414, 28, 2414, 2414,
+        0, 2415, 1024, 1024, 1024, 1024, 1024, 1024, 1035, 1035, 1035, 1035, 1035, 1035, 1035, 1035,
+        3075, 21, 3075, 3075, 21, 2510, 2511, 1034, 1034, 1034, 1034, 1034, 1034, 1035, 1035, 1035,
+        1035, 1035, 1035, 1035, 1035, 2509, 3068, 32, 3068, 3068, 269, 3060, 1034, 1034, 1034, 1034,
+        1034, 1034, 1032, 1032, 1032, 1032, 1032, 1032, 1032, 1032, 3102, 270, 3102, 3102, 269, 0,
+        396, 1033, 1033, 1033, 1033, 1033, 1033, 1035, 1035, 1035, 1035, 1035, 1035, 1035, 1035, 66,
+        397, 66, 66, 343, 269, 48, 1034, 1034, 1034, 1034, 1034, 1034, 1828, 1828, 1828, 1828,
+        1828, 1828, 1828, 1828, 68, 1953, 68, 68, 1953, 0, 269, 1826, 1826, 1826, 1826, 1826,
+        1826, 1409, 1410, 1411, 1412, 1412, 1412, 1412, 1412, 70, 1303, 70, 70, 1304, 269, 274,
+        1413, 1413, 1413, 1413, 1413, 1413, 1418, 1419, 1420, 1421, 1421, 1421, 1421, 1421, 72, 630,
+        72, 72, 269, 1954, 1989, 1417, 1417, 1417, 1417, 1417, 1417, 1489, 1489, 1489, 1489, 1489,
+        1489, 1489, 1489, 129, 52, 129, 128, 269, 1990, 287, 1490, 1490, 1490, 1490, 1490, 1490,
+        1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 128, 269, 128, 128, 248, 249, 630, 1490,
+        1490, 1490, 1490, 1490, 1490, 1425, 1426, 1427, 1428, 1428, 1428, 1428, 1428, 149, 275, 149,
+        149, 269, 309, 276, 1429, 1429, 1429, 1429, 1429, 1429, 1435, 1433, 1436, 1437, 1437, 1437,
+        1437, 1437, 179, 286, 179, 179, 269, 269, 269, 1434, 1434, 1434, 1434, 1434, 1434, 1467,
+        1467, 1467, 1467, 1467, 1467, 1467, 1467, 179, 341, 180, 179, 342, 305, 0, 1468, 1468,
+        1468, 1468, 1468, 1468, 1443, 1444, 1441, 1445, 1445, 1445, 1445, 1445, 269, 364, 484, 414,
+        484, 484, 2785, 1442, 1442, 1442, 1442, 1442, 1442, 1456, 1456, 1456, 1456, 1456, 1456, 1456,
+        1456, 269, 2784, 269, 269, 365, 269, 413, 1457, 1457, 1457, 1457, 1457, 1457, 1449, 1449,
+        1449, 1449, 1449, 1449, 1449, 1449, 420, 419, 393, 677, 456, 269, 677, 1449, 1449, 1449,
+        1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 484, 304, 484, 484, 269,
+        269, 269, 1451, 1451, 1451, 1451, 1451, 1451, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
+        678, 1083, 1116, 1084, 1116, 1116, 269, 1453, 1453, 1453, 1453, 1453, 1453, 1454, 1454, 1454,
+        1454, 1454, 1454, 1454, 1454, 1364, 3068, 0, 3068, 3068, 284, 1365, 1455, 1455, 1455, 1455,
+        1455, 1455, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1353, 1352, 269, 269, 1891, 269,
+        293, 1459, 1459, 1459, 1459, 1459, 1459, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1334,
+        1892, 269, 1334, 269, 299, 1381, 1470, 1470, 1470, 1470, 1470, 1470, 1480, 1480, 1480, 1480,
+        1480, 1480, 1480, 1480, 1383, 269, 310, 269, 1382, 305, 1963, 1481, 1481, 1481, 1481, 1481,
+        1481, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1964, 3095, 2457, 3095, 3095, 1965, 1335,
+        1492, 1492, 1492, 1492, 1492, 1492, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 2458, 311,
+        269, 312, 269, 269, 2352, 1502, 1502, 1502, 1502, 1502, 1502, 1824, 1824, 1824, 1824, 1824,
+        1824, 1824, 1824, 2351, 269, 344, 82, 269, 348, 2549, 1824, 1824, 1824, 1824, 1824, 1824,
+        1515, 1516, 1517, 1518, 1518, 1518, 1518, 1518, 2348, 2349, 2550, 269, 269, 345, 269, 1519,
+        1519, 1519, 1519, 1519, 1519, 1524, 1525, 1526, 1527, 1527, 1527, 1527, 1527, 269, 3095, 269,
+        3095, 3095, 332, 2889, 1523, 1523, 1523, 1523, 1523, 1523, 1576, 1576, 1576, 1576, 1576, 1576,
+        1576, 1576, 2652, 323, 269, 2652, 269, 3011, 3012, 1577, 1577, 1577, 1577, 1577, 1577, 1576,
+        1576, 1576, 1576, 1576, 1576, 1576, 1576, 2890, 325, 351, 373, 325, 269, 269, 1577, 1577,
+        1577, 1577, 1577, 1577, 1531, 1532, 1533, 1534, 1534, 1534, 1534, 1534, 269, 327, 269, 328,
+        85, 269, 1335, 1535, 1535, 1535, 1535, 1535, 1535, 1541, 1539, 1540, 1542, 1542, 1542, 1542,
+        1542, 3085, 269, 3084, 331, 347, 369, 269, 1543, 1543, 1543, 1543, 1543, 1543, 1547, 1547,
+        1547, 1547, 1547, 1547, 1547, 1547, 340, 269, 269, 269, 110, 269, 303, 1547, 1547, 1547,
+        1547, 1547, 1547, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 269, 333, 339, 348, 269,
+        529, 269, 1549, 1549, 1549, 1549, 1549, 1549, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+        329, 346, 269, 370, 269, 269, 269, 1551, 1551, 1551, 1551, 1551, 1551, 1552, 1552, 1552,
+        1552, 1552, 1552, 1552, 1552, 269, 371, 381, 429, 269, 381, 336, 1553, 1553, 1553, 1553,
+        1553, 1553, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 269, 363, 269, 269, 445, 269,
+        338, 1557, 1557, 1557, 1557, 1557, 1557, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 269,
+        381, 394, 395, 381, 353, 269, 1568, 1568, 1568, 1568, 1568, 1568, 1578, 1578, 1578, 1578,
+        1578, 1578, 1578, 1578, 269, 269, 400, 398, 117, 269, 432, 1579, 1579, 1579, 1579, 1579,
+        1579, 1590, 1590, 1590, 1590, 1590, 1590, 1590, 1590, 386, 269, 510, 430, 269, 269, 269,
+        1589, 1589, 1589, 1589, 1589, 1589, 1822, 1822, 1822, 1822, 1822, 1822, 1822, 1822, 401, 269,
+        438, 442, 269, 269, 387, 1822, 1822, 1822, 1822, 1822, 1822, 1602, 1603, 1604, 1605, 1605,
+        1605, 1605, 1605, 269, 434, 269, 439, 441, 269, 399, 1606, 1606, 1606, 1606, 1606, 1606,
+        1611, 1612, 1613, 1614, 1614, 1614, 1614, 1614, 269, 269, 269, 674, 461, 487, 458, 1610,
+        1610, 1610, 1610, 1610, 1610, 1644, 1644, 1644, 1644, 1644, 1644, 1644, 1644, 269, 451, 269,
+        269, 269, 269, 435, 1645, 1645, 1645, 1645, 1645, 1645, 1644, 1644, 1644, 1644, 1644, 1644,
+        1644, 1644, 269, 455, 506, 466, 455, 269, 427, 1645, 1645, 1645, 1645, 1645, 1645, 1618,
+        1619, 1620, 1621, 1621, 1621, 1621, 1621, 269, 416, 495, 2404, 500, 269, 269, 1622, 1622,
+        1622, 1622, 1622, 1622, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 412, 457, 269, 269,
+        269, 269, 269, 1626, 1626, 1626, 1626, 1626, 1626, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+        1627, 426, 489, 269, 534, 269, 269, 418, 1628, 1628, 1628, 1628, 1628, 1628, 1629, 1629,
+        1629, 1629, 1629, 1629, 1629, 1629, 269, 421, 269, 564, 509, 493, 269, 1630, 1630, 1630,
+        1630, 1630, 1630, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 425, 269, 269, 110, 511,
+        269, 422, 1632, 1632, 1632, 1632, 1632, 1632, 1635, 1635, 1635, 1635, 1635, 1635, 1635, 1635,
+        269, 436, 269, 604, 603, 673, 269, 1636, 1636, 1636, 1636, 1636, 1636, 1646, 1646, 1646,
+        1646, 1646, 1646, 1646, 1646, 431, 460, 269, 122, 551, 269, 269, 1647, 1647, 1647, 1647,
+        1647, 1647, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 440, 468, 269, 1123, 560, 269,
+        269, 1657, 1657, 1657, 1657, 1657, 1657, 1820, 1820, 1820, 1820, 1820, 1820, 1820, 1820, 459,
+        553, 269, 127, 269, 269, 448, 1820, 1820, 1820, 1820, 1820, 1820, 1670, 1671, 1672, 1673,
+        1673, 1673, 1673, 1673, 269, 490, 579, 269, 733, 269, 450, 1674, 1674, 1674, 1674, 1674,
+        1674, 1679, 1680, 1681, 1682, 1682, 1682, 1682, 1682, 269, 499, 559, 269, 269, 269, 269,
+        1678, 1678, 1678, 1678, 1678, 1678, 1693, 1693, 1693, 1693, 1693, 1693, 1693, 1693, 462, 513,
+        1180, 131, 583, 269, 269, 1694, 1694, 1694, 1694, 1694, 1694, 1693, 1693, 1693, 1693, 1693,
+        1693, 1693, 1693, 467, 528, 269, 269, 692, 269, 269, 1694, 1694, 1694, 1694, 1694, 1694,
+        1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 491, 552, 269, 1169, 1095, 269, 269, 1686,
+        1686, 1686, 1686, 1686, 1686, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 512, 635, 704,
+        269, 635, 269, 485, 1688, 1688, 1688, 1688, 1688, 1688, 1689, 1689, 1689, 1689, 1689, 1689,
+        1689, 1689, 269, 675, 269, 2514, 269, 582, 269, 1690, 1690, 1690, 1690, 1690, 1690, 1691,
+        1691, 1691, 1691, 1691, 1691, 1691, 1691, 494, 269, 648, 269, 731, 648, 269, 1692, 1692,
+        1692, 1692, 1692, 1692, 1695, 1695, 1695, 1695, 1695, 1695, 1695, 1695, 507, 584, 269, 2588,
+        1093, 269, 269, 1696, 1696, 1696, 1696, 1696, 1696, 1707, 1707, 1707, 1707, 1707, 1707, 1707,
+        1707, 574, 665, 269, 269, 665, 269, 525, 1706, 1706, 1706, 1706, 1706, 1706, 1717, 1717,
+        1717, 1717, 1717, 1717, 1717, 1717, 269, 724, 707, 2607, 699, 269, 527, 1717, 1717, 1717,
+        1717, 1717, 1717, 1718, 1718, 1718, 1718, 1718, 1718, 1718, 1718, 269, 588, 635, 269, 1092,
+        635, 269, 1718, 1718, 1718, 1718, 1718, 1718, 1721, 1722, 1723, 1724, 1724, 1724, 1724, 1724,
+        581, 703, 269, 135, 1100, 269, 269, 1725, 1725, 1725, 1725, 1725, 1725, 1729, 1729, 1729,
+        1729, 1729, 1729, 1729, 1729, 575, 717, 732, 269, 269, 687, 269, 1729, 1729, 1729, 1729,
+        1729, 1729, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 563, 708, 1098, 140, 269, 269,
+        269, 1731, 1731, 1731, 1731, 1731, 1731, 1732, 1732, 1732, 1732, 1732, 1732, 1732, 1732, 269,
+        1102, 1090, 1094, 1099, 269, 577, 1733, 1733, 1733, 1733, 1733, 1733, 1734, 1734, 1734, 1734,
+        1734, 1734, 1734, 1734, 269, 734, 1939, 1096, 269, 269, 269, 1735, 1735, 1735, 1735, 1735,
+        1735, 1738, 1738, 1738, 1738, 1738, 1738, 1738, 1738, 1101, 269, 1087, 269, 1120, 269, 269,
+        1739, 1739, 1739, 1739, 1739, 1739, 1818, 1818, 1818, 1818, 1818, 1818, 1818, 1818, 1085, 1119,
+        269, 269, 1265, 269, 269, 1818, 1818, 1818, 1818, 1818, 1818, 1755, 1755, 1755, 1755, 1755,
+        1755, 1755, 1755, 1086, 1124, 1122, 1127, 269, 269, 269, 1756, 1756, 1756, 1756, 1756, 1756,
+        1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1097, 269, 1144, 1125, 1126, 1151, 269, 1758,
+        1758, 1758, 1758, 1758, 1758, 1759, 1759, 1759, 1759, 1759, 1759, 1759, 1759, 269, 269, 1155,
+        269, 269, 269, 1207, 1760, 1760, 1760, 1760, 1760, 1760, 1761, 1761, 1761, 1761, 1761, 1761,
+        1761, 1761, 1128, 1153, 1158, 1161, 269, 269, 269, 1762, 1762, 1762, 1762, 1762, 1762, 1775,
+        1775, 1775, 1775, 1775, 1775, 1775, 1775, 1193, 1178, 269, 269, 269, 269, 1160, 1775, 1775,
+        1775, 1775, 1775, 1775, 1769, 1769, 1769, 1769, 1769, 1769, 1769, 1769, 269, 1154, 1156, 2614,
+        1181, 269, 269, 1770, 1770, 1770, 1770, 1770, 1770, 1771, 1771, 1771, 1771, 1771, 1771, 1771,
+        1771, 1143, 1159, 269, 269, 1166, 269, 269, 1772, 1772, 1772, 1772, 1772, 1772, 1773, 1773,
+        1773, 1773, 1773, 1773, 1773, 1773, 1183, 269, 1221, 148, 269, 269, 1149, 1774, 1774, 1774,
+        1774, 1774, 1774, 1776, 1776, 1776, 1776, 1776, 1776, 1776, 1776, 269, 1176, 1165, 1189, 1192,
+        269, 269, 1776, 1776, 1776, 1776, 1776, 1776, 1819, 1819, 1819, 1819, 1819, 1819, 1819, 1819,
+        269, 1261, 269, 151, 1203, 1186, 1167, 1819, 1819, 1819, 1819, 1819, 1819, 1821, 1821, 1821,
+        1821, 1821, 1821, 1821, 1821, 269, 269, 269, 269, 1220, 1219, 1199, 1821, 1821, 1821, 1821,
+        1821, 1821, 1823, 1823, 1823, 1823, 1823, 1823, 1823, 1823, 1182, 269, 1211, 269, 269, 269,
+        269, 1823, 1823, 1823, 1823, 1823, 1823, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1204,
+        166, 501, 1277, 269, 501, 1190, 1825, 1825, 1825, 1825, 1825, 1825, 1827, 1827, 1827, 1827,
+        1827, 1827, 1827, 1827, 269, 2414, 1294, 2414, 2414, 269, 2415, 1827, 1827, 1827, 1827, 1827,
+        1827, 1403, 267, 1877, 1877, 1877, 1877, 1877, 1877, 1877, 1877, 2658, 2660, 269, 2655, 2661,
+        530, 269, 1405, 2490, 502, 2656, 2657, 2654, 2662, 2488, 269, 2659, 269, 2491, 1293, 2489,
+        2475, 269, 1405, 1405, 515, 269, 269, 515, 2476, 2413, 269, 269, 269, 269, 2477, 269,
+        531, 2478, 2474, 2479, 269, 2392, 1405, 169, 41, 269, 41, 41, 515, 53, 2393, 515,
+        2394, 54, 269, 2395, 269, 2396, 269, 2397, 2398, 1213, 2399, 67, 67, 67, 269, 514,
+        67, 67, 67, 67, 67, 67, 67, 67, 71, 71, 71, 269, 307, 71, 71, 71,
+        71, 71, 71, 71, 71, 1972, 269, 291, 269, 1973, 292, 1406, 1974, 1975, 290, 516,
+        1976, 320, 517, 1977, 1978, 321, 1979, 269, 1980, 269, 544, 3143, 543, 1981, 545, 322,
+        2576, 539, 540, 2284, 3142, 541, 3141, 546, 547, 269, 3144, 2577, 3145, 542, 1088, 269,
+        269, 548, 549, 402, 1089, 407, 408, 1137, 44, 405, 0, 44, 409, 44, 269, 410,
+        555, 44, 406, 403, 1138, 404, 411, 0, 269, 1830, 269, 1832, 1832, 1832, 1832, 1832,
+        1832, 1832, 1832, 1406, 1830, 620, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 268, 557,
+        1827, 1827, 1827, 1827, 1827, 1827, 1827, 1827, 2377, 556, 737, 269, 2378, 354, 2302, 1959,
+        2379, 269, 2303, 1223, 269, 269, 2301, 269, 1224, 269, 269, 269, 269, 269, 269, 2304,
+        1218, 269, 2334, 1879, 2879, 269, 269, 1880, 2332, 2878, 2333, 1881, 2331, 269, 2330, 2877,
+        1882, 1883, 2335, 2880, 1884, 269, 269, 269, 473, 1878, 473, 473, 764, 474, 790, 790,
+        790, 790, 790, 791, 763, 763, 743, 780, 780, 780, 780, 780, 780, 780, 780, 1307,
+        269, 1348, 296, 0, 470, 971, 971, 971, 971, 971, 971, 971, 971, 815, 269, 844,
+        844, 844, 844, 844, 844, 844, 844, 471, 269, 0, 469, 472, 368, 278, 821, 269,
+        835, 835, 835, 835, 835, 836, 820, 820, 0, 269, 958, 958, 958, 958, 958, 958,
+        958, 958, 0, 1375, 912, 912, 912, 912, 912, 912, 912, 912, 874, 277, 890, 890,
+        890, 890, 890, 889, 886, 886, 926, 269, 952, 952, 952, 952, 952, 953, 925, 925,
+        984, 269, 1013, 1013, 1013, 1013, 1013, 1013, 1013, 1013, 989, 1184, 1006, 1006, 1006, 1006,
+        1006, 1006, 1006, 1006, 758, 1185, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 758, 269,
+        1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1049, 366, 1065, 1065, 1065, 1065, 1065, 1065,
+        1065, 1065, 268, 269, 1826, 1826, 1826, 1826, 1826, 1826, 1826, 1826, 0, 372, 1475, 1475,
+        1475, 1475, 1475, 1475, 1475, 1475, 0, 269, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
+        852, 415, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 810, 269, 1474, 1474, 1474, 1474,
+        1474, 1474, 1474, 1474, 758, 424, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 758, 269,
+        1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 0, 428, 1544, 1544, 1544, 1544, 1544, 1544,
+        1544, 1544, 758, 269, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 758, 498, 1585, 1585,
+        1585, 1585, 1585, 1585, 1585, 1585, 758, 269, 1651, 1651, 1651, 1651, 1651, 1651, 1651, 1651,
+        758, 532, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 758, 269, 1700, 1700, 1700, 1700,
+        1700, 1700, 1700, 1700, 758, 566, 1702, 1702, 1702, 1702, 1702, 1702, 1702, 1702, 0, 565,
+        1765, 1765, 1765, 1765, 1765, 1765, 1765, 1765, 1788, 578, 1804, 1804, 1804, 1804, 1804, 1804,
+        1804, 1804, 1843, 269, 1862, 1862, 1862, 1862, 1862, 1861, 1844, 1844, 1849, 1851, 1851, 1851,
+        1851, 1851, 1851, 1851, 1851, 3091, 2096, 3091, 3091, 2096, 3092, 163, 164, 163, 163, 158,
+        159, 158, 158, 1207, 305, 163, 163, 238, 163, 161, 161, 285, 162, 55, 1130, 55,
+        55, 3088, 1129, 269, 1131, 163, 1132, 55, 55, 161, 55, 1208, 1133, 1134, 1212, 1135,
+        3087, 1206, 269, 237, 3089, 1205, 313, 55, 3090, 2097, 269, 269, 269, 1875, 1875, 1875,
+        1875, 1875, 1875, 1875, 1875, 1871, 1871, 1871, 1871, 1871, 1872, 1404, 1404, 1077, 1077, 1077,
+        1077, 1077, 1077, 1077, 1077, 1073, 1073, 1073, 1073, 1073, 1074, 1036, 1036, 744, 744, 744,
+        744, 744, 744, 744, 744, 745, 745, 745, 745, 745, 745, 745, 745, 746, 746, 746,
+        746, 746, 746, 746, 746, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1025, 1025, 1025,
+        1025, 1025, 1026, 755, 755, 755, 755, 755, 755, 755, 755, 755, 755, 760, 761, 759,
+        762, 762, 762, 762, 762, 788, 788, 788, 788, 788, 788, 788, 788, 765, 766, 767,
+        768, 768, 768, 768, 768, 786, 786, 786, 786, 786, 786, 786, 786, 782, 782, 782,
+        782, 782, 783, 769, 769, 774, 771, 772, 773, 773, 773, 773, 773, 776, 776, 776,
+        776, 776, 777, 775, 775, 779, 779, 779, 779, 779, 779, 779, 779, 781, 781, 781,
+        781, 781, 781, 781, 781, 785, 785, 785, 785, 785, 785, 785, 785, 787, 787, 787,
+        787, 787, 787, 787, 787, 789, 789, 789, 789, 789, 789, 789, 789, 793, 793, 793,
+        793, 793, 793, 793, 793, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1015, 1015, 1015,
+        1015, 1015, 1016, 978, 978, 967, 967, 967, 967, 967, 968, 807, 807, 814, 811, 812,
+        813, 813, 813, 813, 813, 840, 840, 840, 840, 840, 841, 839, 839, 817, 818, 816,
+        819, 819, 819, 819, 819, 833, 833, 833, 833, 833, 833, 833, 833, 822, 823, 824,
+        825, 825, 825, 825, 825, 831, 831, 831, 831, 831, 831, 831, 831, 827, 827, 827,
+        827, 827, 828, 826, 826, 830, 830, 830, 830, 830, 830, 830, 830, 832, 832, 832,
+        832, 832, 832, 832, 832, 834, 834, 834, 834, 834, 834, 834, 834, 838, 838, 838,
+        838, 838, 838, 838, 838, 843, 843, 843, 843, 843, 843, 843, 843, 845, 845, 845,
+        845, 845, 845, 845, 845, 956, 956, 956, 956, 956, 956, 956, 956, 922, 923, 921,
+        924, 924, 924, 924, 924, 910, 910, 910, 910, 910, 910, 910, 910, 864, 865, 866,
+        867, 867, 867, 867, 867, 897, 897, 897, 897, 897, 897, 897, 897, 893, 893, 893,
+        893, 893, 894, 868, 868, 873, 871, 870, 872, 872, 872, 872, 872, 887, 887, 887,
+        887, 887, 887, 887, 887, 877, 875, 876, 878, 878, 878, 878, 878, 884, 884, 884,
+        884, 884, 884, 884, 884, 880, 880, 880, 880, 880, 881, 879, 879, 883, 883, 883,
+        883, 883, 883, 883, 883, 885, 885, 885, 885, 885, 885, 885, 885, 888, 888, 888,
+        888, 888, 888, 888, 888, 891, 891, 891, 891, 891, 891, 891, 891, 896, 896, 896,
+        896, 896, 896, 896, 896, 898, 898, 898, 898, 898, 898, 898, 898, 911, 911, 911,
+        911, 911, 911, 911, 911, 916, 916, 916, 916, 916, 916, 916, 916, 950, 950, 950,
+        950, 950, 950, 950, 950, 927, 928, 929, 930, 930, 930, 930, 930, 948, 948, 948,
+        948, 948, 948, 948, 948, 945, 945, 945, 945, 945, 944, 931, 931, 935, 934, 933,
+        936, 936, 936, 936, 936, 940, 940, 940, 940, 940, 941, 937, 937, 938, 938, 938,
+        938, 938, 938, 938, 938, 939, 939, 939, 939, 939, 939, 939, 939, 943, 943, 943,
+        943, 943, 943, 943, 943, 946, 946, 946, 946, 946, 946, 946, 946, 949, 949, 949,
+        949, 949, 949, 949, 949, 951, 951, 951, 951, 951, 951, 951, 951, 955, 955, 955,
+        955, 955, 955, 955, 955, 957, 957, 957, 957, 957, 957, 957, 957, 962, 962, 962,
+        962, 962, 962, 962, 962, 970, 970, 970, 970, 970, 970, 970, 970, 973, 973, 973,
+        973, 973, 973, 973, 973, 983, 980, 981, 982, 982, 982, 982, 982, 1009, 1009, 1009,
+        1009, 1009, 1010, 1008, 1008, 988, 985, 986, 987, 987, 987, 987, 987, 1002, 1002, 1002,
+        1002, 1002, 1003, 1001, 1001, 993, 990, 991, 992, 992, 992, 992, 992, 999, 999, 999,
+        999, 999, 999, 999, 999, 995, 995, 995, 995, 995, 996, 994, 994, 998, 998, 998,
+        998, 998, 998, 998, 998, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1005, 1005, 1005,
+        1005, 1005, 1005, 1005, 1005, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1012, 1012, 1012,
+        1012, 1012, 1012, 1012, 1012, 1014, 1014, 1014, 1014, 1014, 1014, 1014, 1014, 1018, 1018, 1018,
+        1018, 1018, 1018, 1018, 1018, 1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020, 1038, 1039, 1040,
+        1041, 1041, 1041, 1041, 1041, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 1068, 1068, 1068,
+        1068, 1068, 1067, 1042, 1042, 1046, 1044, 1045, 1047, 1047, 1047, 1047, 1047, 1062, 1062, 1062,
+        1062, 1062, 1061, 1048, 1048, 1051, 1052, 1050, 1053, 1053, 1053, 1053, 1053, 1057, 1057, 1057,
+        1057, 1057, 1058, 1054, 1054, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1056, 1056, 1056,
+        1056, 1056, 1056, 1056, 1056, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1063, 1063, 1063,
+        1063, 1063, 1063, 1063, 1063, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1069, 1069, 1069,
+        1069, 1069, 1069, 1069, 1069, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1076, 1076, 1076,
+        1076, 1076, 1076, 1076, 1076, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1833, 1834, 1835,
+        1836, 1836, 1836, 1836, 1836, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1505, 1505, 1505,
+        1505, 1505, 1506, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1497, 1497, 1497,
+        1497, 1497, 1497, 1497, 1497, 1493, 1493, 1493, 1493, 1493, 1494, 1422, 1422, 1422, 1422, 1422,
+        1422, 1422, 1422, 1422, 1422, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1483, 1483, 1483,
+        1483, 1483, 1484, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1475, 1475, 1475,
+        1475, 1475, 1475, 1475, 1475, 1471, 1471, 1471, 1471, 1471, 1472, 1438, 1438, 1438, 1438, 1438,
+        1438, 1438, 1438, 1438, 1438, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1460, 1460, 1460,
+        1460, 1460, 1460, 1460, 1460, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1477, 1477, 1477,
+        1477, 1477, 1477, 1477, 1477, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1488, 1488, 1488,
+        1488, 1488, 1488, 1488, 1488, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1510, 1510, 1510,
+        1510, 1510, 1510, 1510, 1510, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1592, 1592, 1592,
+        1592, 1592, 1593, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1584, 1584, 1584,
+        1584, 1584, 1584, 1584, 1584, 1580, 1580, 1580, 1580, 1580, 1581, 1528, 1528, 1528, 1528, 1528,
+        1528, 1528, 1528, 1528, 1528, 1574, 1574, 1574, 1574, 1574, 1574, 1574, 1574, 1570, 1570, 1570,
+        1570, 1570, 1571, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1559, 1559, 1559,
+        1559, 1559, 1560, 1558, 1558, 1544, 1544, 1544, 1544, 1544, 1544, 1544, 1544, 1558, 1558, 1558,
+        1558, 1558, 1558, 1558, 1558, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1564, 1564, 1564,
+        1564, 1564, 1564, 1564, 1564, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1575, 1575, 1575,
+        1575, 1575, 1575, 1575, 1575, 1595, 1595, 1595, 1595, 1595, 1595, 1595, 1595, 1597, 1597, 1597,
+        1597, 1597, 1597, 1597, 1597, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1660, 1660, 1660,
+        1660, 1660, 1661, 1659, 1659, 1659, 1659, 1659, 1659, 1659, 1659, 1659, 1659, 1652, 1652, 1652,
+        1652, 1652, 1652, 1652, 1652, 1648, 1648, 1648, 1648, 1648, 1649, 1615, 1615, 1615, 1615, 1615,
+        1615, 1615, 1615, 1615, 1615, 1642, 1642, 1642, 1642, 1642, 1642, 1642, 1642, 1638, 1638, 1638,
+        1638, 1638, 1639, 1637, 1637, 1637, 1637, 1637, 1637, 1637, 1637, 1637, 1637, 1641, 1641, 1641,
+        1641, 1641, 1641, 1641, 1641, 1643, 1643, 1643, 1643, 1643, 1643, 1643, 1643, 1663, 1663, 1663,
+        1663, 1663, 1663, 1663, 1663, 1665, 1665, 1665, 1665, 1665, 1665, 1665, 1665, 1713, 1713, 1713,
+        1713, 1713, 1713, 1713, 1713, 1709, 1709, 1709, 1709, 1709, 1710, 1708, 1708, 1708, 1708, 1708,
+        1708, 1708, 1708, 1708, 1708, 1701, 1701, 1701, 1701, 1701, 1701, 1701, 1701, 1697, 1697, 1697,
+        1697, 1697, 1698, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1712, 1712, 1712,
+        1712, 1712, 1712, 1712, 1712, 1714, 1714, 1714, 1714, 1714, 1714, 1714, 1714, 1745, 1745, 1745,
+        1745, 1745, 1745, 1745, 1745, 1741, 1741, 1741, 1741, 1741, 1742, 1740, 1740, 1740, 1740, 1740,
+        1740, 1740, 1740, 1740, 1740, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1746, 1746, 1746,
+        1746, 1746, 1746, 1746, 1746, 1812, 1812, 1812, 1812, 1812, 1812, 1812, 1812, 1777, 1778, 1779,
+        1780, 1780, 1780, 1780, 1780, 1810, 1810, 1810, 1810, 1810, 1810, 1810, 1810, 1807, 1807, 1807,
+        1807, 1807, 1806, 1781, 1781, 1785, 1783, 1784, 1786, 1786, 1786, 1786, 1786, 1801, 1801, 1801,
+        1801, 1801, 1800, 1787, 1787, 1790, 1791, 1789, 1792, 1792, 1792, 1792, 1792, 1796, 1796, 1796,
+        1796, 1796, 1797, 1793, 1793, 1794, 1794, 1794, 1794, 1794, 1794, 1794, 1794, 1795, 1795, 1795,
+        1795, 1795, 1795, 1795, 1795, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1802, 1802, 1802,
+        1802, 1802, 1802, 1802, 1802, 1805, 1805, 1805, 1805, 1805, 1805, 1805, 1805, 1808, 1808, 1808,
+        1808, 1808, 1808, 1808, 1808, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1813, 1813, 1813,
+        1813, 1813, 1813, 1813, 1813, 1817, 1817, 1817, 1817, 1817, 1817, 1817, 1817, 1831, 1831, 1831,
+        1831, 1831, 1831, 1831, 1831, 1869, 1869, 1869, 1869, 1869, 1869, 1869, 1869, 1865, 1865, 1865,
+        1865, 1865, 1866, 1838, 1838, 1840, 1841, 1839, 1842, 1842, 1842, 1842, 1842, 1859, 1859, 1859,
+        1859, 1859, 1859, 1859, 1859, 1845, 1846, 1847, 1848, 1848, 1848, 1848, 1848, 1857, 1857, 1857,
+        1857, 1857, 1857, 1857, 1857, 1853, 1853, 1853, 1853, 1853, 1854, 1850, 1850, 1852, 1852, 1852,
+        1852, 1852, 1852, 1852, 1852, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1856, 1858, 1858, 1858,
+        1858, 1858, 1858, 1858, 1858, 1860, 1860, 1860, 1860, 1860, 1860, 1860, 1860, 1863, 1863, 1863,
+        1863, 1863, 1863, 1863, 1863, 1868, 1868, 1868, 1868, 1868, 1868, 1868, 1868, 1870, 1870, 1870,
+        1870, 1870, 1870, 1870, 1870, 1874, 1874, 1874, 1874, 1874, 1874, 1874, 1874, 1876, 1876, 1876,
+        1876, 1876, 1876, 1876, 1876, 2005, 74, 3033, 74, 74, 3033, 75, 1202, 2006, 2177, 75,
+        3057, 2177, 3057, 3057, 55, 3060, 55, 56, 159, 269, 159, 159, 1245, 586, 56, 56,
+        586, 55, 160, 160, 2080, 0, 2081, 3034, 2007, 2010, 2082, 269, 3059, 2083, 56, 2009,
+        269, 2196, 160, 2194, 2012, 2198, 2011, 162, 2008, 162, 162, 2199, 3035, 2195, 269, 3058,
+        2197, 162, 162, 3061, 162, 693, 1397, 269, 2743, 357, 2743, 2743, 358, 356, 1399, 587,
+        694, 162, 2743, 2743, 269, 2743, 3014, 359, 2822, 269, 316, 360, 361, 315, 2823, 300,
+        362, 317, 2743, 586, 2824, 2825, 586, 2677, 318, 269, 319, 269, 314, 2678, 616, 1398,
+        696, 616, 437, 2676, 697, 695, 269, 2679, 2680, 269, 2681, 269, 269, 2293, 758, 698,
+        1027, 1027, 1027, 1027, 1027, 1027, 852, 2294, 1465, 1465, 1465, 1465, 1465, 1465, 591, 269,
+        1888, 593, 618, 1887, 594, 590, 592, 810, 269, 1473, 1473, 1473, 1473, 1473, 1473, 758,
+        617, 1495, 1495, 1495, 1495, 1495, 1495, 758, 1260, 1582, 1582, 1582, 1582, 1582, 1582, 758,
+        1108, 1650, 1650, 1650, 1650, 1650, 1650, 758, 269, 1699, 1699, 1699, 1699, 1699, 1699, 269,
+        1106, 1902, 1395, 1266, 1902, 423, 483, 269, 483, 483, 1386, 474, 1267, 1268, 269, 1105,
+        1104, 3057, 1269, 3057, 3057, 3075, 3060, 3075, 3075, 3091, 3060, 3091, 3091, 232, 3092, 1107,
+        1350, 1351, 470, 3102, 269, 3102, 3102, 1394, 3092, 2631, 463, 464, 1903, 3076, 1904, 465,
+        2630, 3059, 269, 269, 1905, 3094, 1271, 616, 269, 74, 616, 74, 74, 269, 75, 3088,
+        3077, 1080, 75, 376, 269, 1081, 376, 229, 3093, 269, 1273, 1201, 269, 1201, 1201, 1082,
+        1200, 374, 2711, 2414, 1079, 2414, 2414, 1274, 2415, 269, 269, 2371, 1275, 1272, 1228, 250,
+        3209, 269, 3210, 677, 269, 1187, 677, 1188, 269, 2372, 2716, 3211, 269, 269, 269, 1162,
+        2717, 1163, 1164, 269, 2718, 3208, 375, 269, 729, 269, 269, 352, 728, 689, 688, 690,
+        269, 712, 269, 1334, 245, 1902, 1334, 269, 1902, 730, 269, 1146, 710, 1946, 269, 1147,
+        1148, 334, 1215, 1947, 269, 1225, 1214, 1948, 676, 1255, 269, 1953, 1256, 269, 1953, 1226,
+        1385, 1254, 269, 711, 1216, 1227, 1327, 1328, 1386, 2002, 269, 1333, 1329, 2074, 269, 2096,
+        2004, 269, 2096, 1387, 2004, 269, 1922, 2111, 1923, 2177, 269, 2112, 2177, 1406, 325, 2110,
+        269, 325, 348, 381, 2401, 2113, 381, 501, 2400, 1384, 501, 2770, 2154, 1952, 3033, 2402,
+        2153, 3033, 269, 2638, 2155, 2771, 2639, 2095, 2308, 2772, 2003, 269, 443, 269, 2003, 269,
+        2852, 269, 2851, 444, 349, 446, 269, 2853, 1290, 269, 1234, 2178, 269, 1234, 269, 269,
+        269, 3041, 3042, 3159, 1234, 269, 3160, 1234, 1379, 3161, 269, 1366, 269, 1389, 269, 1380,
+        1392, 1367, 447, 1401, 1942, 1390, 1937, 1942, 1390, 1291, 2264, 1399, 1942, 269, 269, 1942,
+        1938, 1953, 1406, 2002, 1953, 497, 1235, 2265, 2021, 2266, 2004, 2055, 269, 269, 269, 2013,
+        2022, 269, 2165, 2056, 2015, 1391, 1388, 2943, 1400, 2014, 2122, 2087, 269, 1960, 2123, 2944,
+        269, 2088, 2254, 269, 269, 269, 2255, 2271, 2360, 2271, 2271, 269, 2271, 2325, 1943, 2315,
+        2054, 269, 2164, 2326, 2075, 2338, 2366, 2023, 269, 2316, 2382, 2339, 269, 2367, 269, 616,
+        616, 269, 616, 616, 2383, 269, 269, 2422, 2817, 269, 2359, 2423, 2481, 2272, 246, 269,
+        2442, 269, 2442, 2442, 2494, 2442, 2482, 2494, 2494, 2503, 2503, 2494, 2503, 2503, 269, 269,
+        2599, 269, 2664, 2652, 2665, 2634, 2652, 2600, 2774, 2633, 2850, 2857, 2837, 2857, 2857, 269,
+        2857, 3151, 1890, 269, 2443, 2775, 269, 269, 2838, 269, 2982, 2504, 2495, 2954, 2981, 2928,
+        2954, 269, 2983, 2927, 269, 2920, 269, 269, 355, 3032, 269, 269, 2920, 3031, 269, 3126,
+        269, 2858, 665, 3127, 3130, 665, 3023, 269, 302, 269, 269, 3024, 3036, 3037, 3131, 294,
+        269, 3150, 269, 269, 324, 269, 335, 269, 337, 269, 269, 417, 269, 388, 449, 486,
+        247, 496, 269, 269, 269, 269, 269, 526, 488, 269, 269, 492, 269, 691, 533, 585,
+        269, 269, 269, 550, 269, 554, 558, 269, 269, 269, 269, 269, 561, 562, 269, 576,
+        580, 269, 589, 706, 649, 705, 269, 269, 709, 718, 269, 269, 269, 719, 269, 650,
+        269, 269, 712, 712, 1091, 269, 736, 735, 251, 269, 1103, 1117, 1118, 710, 712, 269,
+        269, 269, 269, 1121, 269, 1136, 269, 1139, 1141, 1142, 1152, 1145, 1150, 269, 269, 1177,
+        269, 269, 1157, 269, 1179, 269, 269, 269, 1191, 269, 269, 1194, 1195, 1209, 1222, 269,
+        1217, 1251, 269, 1231, 269, 1229, 1232, 269, 269, 269, 269, 1230, 1248, 252, 1233, 269,
+        269, 269, 269, 1246, 269, 1247, 269, 1249, 269, 1250, 269, 269, 1252, 1253, 1264, 1257,
+        269, 269, 1259, 269, 1258, 1262, 269, 1301, 1263, 1280, 1286, 269, 1282, 1278, 269, 1270,
+        269, 269, 269, 269, 269, 269, 269, 269, 1287, 1276, 1279, 269, 269, 269, 269, 1283,
+        1288, 1284, 1285, 1290, 269, 269, 269, 269, 1289, 1292, 1295, 269, 269, 1302, 1305, 1308,
+        269, 1306, 1310, 1309, 1312, 269, 269, 269, 269, 269, 1311, 1313, 1314, 253, 269, 269,
+        1315, 269, 1316, 269, 1296, 269, 269, 1317, 1346, 269, 1325, 269, 1326, 269, 269, 269,
+        1343, 1342, 1330, 1331, 269, 1345, 269, 1332, 1340, 1341, 269, 1360, 1344, 1349, 269, 269,
+        269, 269, 269, 1347, 1355, 269, 269, 1354, 269, 269, 269, 269, 1356, 1357, 269, 1358,
+        269, 1361, 1359, 269, 269, 1363, 1369, 1372, 1368, 1370, 1371, 269, 1374, 1373, 269, 1376,
+        1377, 269, 269, 1378, 269, 269, 269, 269, 269, 269, 1379, 1406, 1889, 1971, 1936, 269,
+        1885, 1380, 1901, 269, 269, 269, 269, 269, 1886, 269, 1893, 1894, 1900, 1895, 1896, 269,
+        269, 269, 1897, 1899, 269, 1898, 269, 269, 1908, 269, 1918, 1906, 1909, 1910, 1907, 269,
+        1911, 1912, 1914, 257, 269, 269, 269, 269, 269, 269, 269, 269, 1913, 269, 269, 1915,
+        269, 1917, 1916, 269, 269, 269, 269, 1919, 1920, 1940, 1921, 1941, 1957, 269, 269, 1949,
+        1950, 1951, 269, 1956, 1961, 269, 1956, 269, 269, 1958, 269, 1962, 1827, 1967, 269, 269,
+        269, 1966, 269, 269, 1969, 269, 269, 1970, 1968, 2001, 2148, 1986, 269, 269, 1984, 1983,
+        1985, 269, 269, 1987, 269, 269, 1988, 1993, 1991, 1992, 269, 269, 1994, 269, 269, 1996,
+        269, 269, 1995, 269, 1997, 1998, 1999, 2071, 2000, 269, 2073, 269, 269, 269, 2019, 269,
+        2070, 2032, 269, 269, 2072, 269, 2020, 2036, 2047, 2033, 2051, 2068, 269, 269, 269, 2037,
+        2046, 2074, 2052, 2069, 2103, 269, 2086, 2084, 2004, 2085, 2092, 2089, 2090, 269, 2091, 2094,
+        269, 269, 269, 269, 2104, 2102, 269, 2101, 2106, 269, 2138, 2107, 2105, 269, 269, 269,
+        269, 269, 2108, 269, 269, 2109, 2135, 269, 2121, 2114, 269, 2115, 269, 269, 269, 2116,
+        2120, 269, 2117, 2119, 269, 2118, 2128, 2125, 2124, 269, 2130, 269, 269, 2129, 269, 269,
+        269, 269, 269, 2127, 2131, 269, 269, 269, 2133, 2132, 269, 2134, 2136, 2141, 2137, 269,
+        269, 2139, 2140, 269, 269, 269, 269, 269, 2142, 2143, 2144, 269, 2146, 2147, 2145, 2149,
+        2150, 2151, 2157, 269, 269, 2152, 2156, 269, 269, 2159, 269, 269, 269, 269, 2161, 269,
+        269, 2158, 269, 269, 2160, 2162, 269, 269, 269, 2163, 2176, 2189, 269, 2179, 269, 2180,
+        269, 2185, 2183, 2184, 2186, 2190, 269, 269, 2191, 269, 269, 269, 269, 2187, 269, 269,
+        2188, 269, 2192, 269, 2193, 269, 2214, 269, 2229, 2245, 2215, 269, 2230, 269, 2241, 2234,
+        2238, 269, 2234, 2238, 2240, 2253, 2258, 2256, 2257, 269, 2259, 2261, 2262, 2246, 2263, 1827,
+        269, 2278, 2269, 2283, 2267, 2268, 2270, 2280, 269, 269, 269, 269, 269, 269, 2282, 2281,
+        2286, 269, 269, 269, 269, 269, 269, 2285, 269, 269, 2287, 269, 2288, 2290, 2291, 269,
+        2292, 2298, 269, 2295, 2296, 2297, 2299, 2305, 269, 2300, 2323, 269, 269, 2306, 269, 2307,
+        269, 269, 269, 269, 269, 269, 269, 2310, 2309, 2312, 269, 2313, 269, 269, 2318, 2314,
+        269, 2317, 269, 269, 2319, 269, 269, 2320, 2321, 2322, 269, 2324, 2329, 269, 269, 2346,
+        2341, 2327, 269, 269, 269, 2328, 269, 269, 2336, 269, 2337, 269, 269, 2345, 2340, 2342,
+        269, 2343, 2347, 269, 2362, 2344, 269, 2353, 269, 269, 269, 269, 2350, 269, 2354, 2356,
+        269, 269, 2355, 269, 2357, 269, 269, 2358, 2360, 2363, 2364, 2365, 2374, 269, 269, 2368,
+        269, 269, 269, 2369, 269, 269, 2370, 2373, 2375, 2376, 2389, 2381, 2380, 269, 2387, 269,
+        269, 269, 2384, 269, 2385, 2391, 269, 269, 2386, 2390, 269, 269, 2421, 269, 2431, 269,
+        269, 269, 269, 269, 269, 2388, 2470, 2454, 269, 269, 269, 269, 2433, 269, 2418, 269,
+        269, 2403, 2405, 269, 2406, 2407, 269, 2408, 269, 2409, 2410, 2411, 2416, 2417, 2419, 262,
+        269, 269, 269, 2420, 269, 269, 2424, 2428, 269, 269, 269, 269, 2426, 269, 2425, 2430,
+        269, 2427, 269, 269, 269, 2429, 2432, 2434, 269, 2435, 269, 2436, 2437, 2439, 2438, 2440,
+        2441, 2455, 269, 269, 2456, 2463, 2459, 269, 2460, 2461, 269, 269, 269, 269, 269, 269,
+        269, 2462, 269, 2464, 269, 2465, 269, 269, 269, 2466, 2466, 269, 269, 2471, 2473, 269,
+        2560, 2486, 2484, 2546, 2487, 2480, 2483, 269, 269, 2547, 269, 2485, 2508, 269, 2485, 269,
+        269, 269, 269, 2501, 269, 2493, 2492, 2512, 269, 2502, 2522, 269, 2519, 269, 269, 269,
+        269, 269, 2534, 269, 2516, 269, 2513, 2517, 2515, 2467, 269, 269, 2518, 269, 269, 269,
+        269, 2520, 2523, 269, 2521, 2525, 2524, 269, 2526, 269, 269, 2527, 269, 2528, 2529, 269,
+        2530, 269, 269, 2531, 2532, 2533, 2536, 2535, 269, 2537, 269, 269, 269, 2538, 2540, 2541,
+        2539, 2542, 269, 269, 269, 269, 2543, 269, 269, 2552, 269, 2544, 269, 269, 269, 269,
+        1827, 2545, 2548, 2551, 269, 269, 2553, 2554, 2555, 2556, 2557, 2562, 2558, 2563, 269, 269,
+        269, 269, 269, 2559, 2561, 269, 2564, 269, 2653, 269, 2598, 269, 2627, 269, 269, 2587,
+        269, 2574, 269, 2575, 2585, 269, 2579, 2580, 2583, 2586, 2578, 269, 269, 2628, 269, 269,
+        269, 2581, 2589, 2582, 269, 269, 269, 269, 2590, 2584, 2591, 269, 269, 269, 269, 2620,
+        2601, 2603, 269, 2602, 269, 269, 269, 2604, 2605, 269, 2606, 269, 2608, 2609, 2610, 2611,
+        2612, 2613, 269, 269, 269, 2615, 2617, 2616, 2618, 1827, 269, 269, 269, 2619, 269, 269,
+        269, 269, 269, 269, 2621, 269, 2624, 269, 269, 2625, 2623, 2626, 269, 1827, 269, 2629,
+        269, 2637, 2632, 2635, 269, 2636, 2651, 269, 2640, 269, 269, 2641, 269, 269, 269, 2708,
+        2705, 2674, 2670, 2666, 2663, 2667, 269, 269, 2669, 2668, 2671, 2673, 269, 269, 269, 269,
+        2672, 2702, 2675, 2698, 269, 2686, 2682, 269, 2684, 269, 269, 269, 269, 2697, 269, 269,
+        2692, 269, 2683, 2685, 269, 269, 2687, 269, 269, 2688, 2689, 2690, 269, 269, 269, 269,
+        2691, 2693, 2694, 2696, 2695, 2699, 2700, 269, 269, 2701, 2703, 269, 269, 2704, 2711, 2706,
+        269, 269, 269, 269, 2724, 2725, 269, 269, 269, 269, 269, 2707, 269, 269, 2709, 2715,
+        269, 2722, 2714, 269, 2721, 269, 269, 2719, 2720, 2728, 269, 2726, 269, 2727, 269, 2729,
+        2730, 2731, 269, 2819, 2817, 269, 2816, 269, 2812, 2760, 2768, 2758, 269, 269, 269, 269,
+        269, 269, 269, 269, 2756, 269, 2757, 269, 2761, 269, 2759, 2762, 269, 269, 2763, 269,
+        2764, 2765, 2773, 2802, 2766, 2780, 269, 269, 269, 2767, 269, 269, 2769, 2782, 269, 2778,
+        269, 2781, 2776, 269, 2777, 269, 2779, 269, 269, 269, 2783, 269, 2786, 2787, 2789, 2788,
+        2790, 2791, 269, 269, 2792, 2813, 2814, 2821, 2820, 269, 269, 269, 269, 269, 2815, 269,
+        2845, 269, 269, 269, 269, 269, 2829, 269, 2826, 2827, 269, 269, 2828, 2830, 2831, 2832,
+        2833, 2842, 269, 2841, 2839, 269, 2840, 269, 269, 2843, 269, 2846, 2844, 269, 2847, 269,
+        269, 2848, 269, 2849, 269, 269, 269, 2817, 269, 269, 269, 2864, 2855, 2873, 269, 269,
+        269, 269, 2856, 2854, 2865, 2866, 269, 269, 269, 2867, 269, 2868, 2869, 2870, 2871, 269,
+        2875, 2905, 272, 269, 2872, 269, 269, 269, 2876, 269, 2881, 2874, 269, 269, 269, 269,
+        269, 2902, 269, 269, 269, 2888, 269, 2882, 2883, 2884, 269, 2885, 269, 2886, 269, 2887,
+        269, 269, 2891, 269, 2892, 2893, 2894, 269, 2895, 2903, 269, 2904, 2906, 2942, 269, 2907,
+        2908, 2909, 269, 269, 2921, 269, 2917, 269, 2926, 269, 269, 2953, 269, 2918, 269, 2919,
+        269, 269, 269, 269, 269, 269, 2922, 2923, 2924, 269, 269, 269, 2936, 2925, 269, 2930,
+        2931, 269, 2932, 2933, 269, 269, 269, 269, 2934, 269, 2935, 2937, 2941, 2938, 269, 2939,
+        269, 2940, 269, 269, 2948, 269, 2945, 269, 2946, 2947, 269, 269, 269, 269, 2949, 2950,
+        2986, 2951, 2952, 269, 2956, 269, 2957, 2963, 2970, 2988, 2963, 2970, 269, 2984, 2985, 269,
+        2987, 269, 2989, 269, 269, 269, 269, 269, 2990, 2991, 2992, 3010, 269, 3028, 3015, 269,
+        3005, 3007, 269, 269, 269, 269, 269, 3009, 3006, 3008, 3013, 3016, 269, 269, 269, 269,
+        269, 269, 269, 3017, 3019, 3018, 3020, 269, 269, 269, 3021, 3025, 3022, 3027, 3029, 3026,
+        269, 3165, 269, 269, 3030, 269, 269, 269, 269, 269, 3038, 269, 269, 269, 269, 3039,
+        3040, 3069, 3056, 269, 3062, 3063, 3064, 269, 3065, 269, 269, 3066, 3070, 3071, 269, 3073,
+        269, 269, 3067, 269, 3072, 269, 269, 3074, 3086, 269, 269, 3115, 269, 3109, 269, 3103,
+        3104, 3105, 269, 269, 3106, 3107, 269, 3111, 269, 3110, 269, 269, 3108, 269, 269, 3112,
+        269, 3113, 269, 3114, 269, 269, 3116, 3117, 269, 3118, 3125, 3121, 3122, 269, 269, 269,
+        3123, 269, 3124, 3128, 3129, 3132, 269, 3140, 269, 3133, 3134, 269, 269, 269, 269, 269,
+        3135, 3138, 3136, 3139, 3137, 269, 269, 269, 269, 269, 269, 3178, 269, 269, 3171, 3146,
+        269, 269, 3147, 3148, 3149, 3156, 3158, 269, 3157, 3166, 3169, 3168, 3162, 273, 3163, 269,
+        269, 269, 269, 269, 269, 269, 3164, 269, 269, 269, 269, 3167, 269, 269, 269, 269,
+        3170, 3172, 3173, 3174, 3175, 269, 269, 3176, 3177, 3183, 3179, 3181, 3182, 3185, 269, 3187,
+        3188, 269, 3184, 269, 269, 3186, 269, 3189, 269, 3200, 269, 3194, 269, 269, 269, 269,
+        3190, 269, 269, 269, 3195, 3196, 269, 269, 3197, 3199, 269, 3198, 3201, 3202, 3203, 3204,
+        269, 3220, 269, 3218, 3213, 269, 3212, 269, 269, 3217, 279, 280, 269, 269, 269, 269,
+        269, 3214, 269, 3215, 269, 269, 269, 3219, 3216, 281, 282, 269, 269, 269, 269, 283,
+        269, 269, 306, 269, 269, 269, 269, 269, 350, 269, 269, 269, 269, 269, 269, 269,
+        389, 377, 378, 379, 380, 382, 383, 384, 385, 390, 391, 392, 269, 269, 269, 269,
+        269, 269, 269, 269, 269, 269, 452, 269, 453, 454, 269, 269, 269, 477, 478, 479,
+        480, 481, 482, 474, 269, 503, 504, 505, 269, 522, 518, 519, 520, 521, 523, 524,
+        269, 535, 269, 536, 537, 538, 269, 269, 269, 269, 569, 567, 568, 570, 571, 572,
+        573, 269, 269, 269, 269, 663, 643, 627, 611, 595, 596, 597, 598, 599, 600, 601,
+        602, 610, 605, 606, 607, 608, 609, 612, 613, 614, 615, 0, 619, 621, 622, 623,
+        624, 625, 626, 628, 629, 631, 632, 633, 634, 636, 637, 638, 639, 640, 641, 642,
+        644, 645, 646, 647, 659, 651, 652, 653, 654, 655, 656, 657, 658, 660, 661, 662,
+        664, 666, 667, 668, 669, 670, 671, 672, 269, 679, 680, 681, 682, 683, 684, 685,
+        686, 269, 269, 269, 726, 699, 700, 701, 702, 269, 269, 720, 713, 714, 715, 716,
+        269, 721, 722, 723, 725, 727, 269, 269, 269, 0, 758, 764, 770, 743, 0, 810,
+        0, 815, 821, 852, 0, 863, 0, 869, 874, 862, 0, 854, 926, 932, 0, 809,
+        0, 801, 984, 989, 757, 758, 758, 758, 749, 1043, 1049, 269, 269, 269, 269, 269,
+        269, 269, 269, 269, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 269, 269, 269, 269, 269,
+        269, 1168, 1170, 1171, 1172, 1173, 1174, 1175, 269, 269, 269, 269, 269, 269, 1210, 269,
+        269, 269, 269, 269, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 269, 269, 269,
+        269, 269, 269, 269, 1281, 269, 269, 269, 1297, 1298, 1299, 1300, 269, 269, 269, 269,
+        269, 1336, 1337, 1338, 1339, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 0,
+        1393, 0, 1396, 0, 1402, 0, 0, 758, 0, 1448, 852, 852, 852, 1440, 810, 810,
+        810, 1432, 979, 979, 979, 979, 1424, 758, 758, 758, 1416, 1037, 1037, 1037, 1037, 0,
+        758, 0, 1546, 810, 810, 810, 810, 1538, 979, 979, 979, 979, 1530, 758, 758, 758,
+        1522, 1037, 1037, 1037, 1037, 0, 758, 0, 1625, 979, 979, 979, 979, 1617, 758, 758,
+        758, 1609, 1037, 1037, 1037, 1037, 0, 758, 1685, 758, 758, 758, 1677, 1037, 1037, 1037,
+        1037, 1715, 0, 1728, 1037, 1037, 1037, 1037, 1764, 0, 1766, 1782, 1788, 1764, 1764, 1764,
+        1748, 1667, 1599, 1512, 1837, 1843, 288, 1403, 1830, 269, 269, 269, 269, 269, 269, 269,
+        1927, 1924, 1925, 1926, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 269, 1944, 1945, 1955,
+        269, 269, 269, 269, 269, 269, 2252, 269, 269, 269, 269, 2058, 2053, 2048, 2040, 2034,
+        2027, 2016, 2017, 2018, 0, 2024, 2025, 2026, 2028, 2029, 2030, 2031, 2039, 2041, 2042, 2043,
+        2044, 2045, 2049, 2050, 2057, 0, 2059, 2060, 2061, 2065, 0, 2066, 2067, 2076, 2077, 2078,
+        2079, 2074, 269, 269, 269, 2098, 2099, 2100, 269, 269, 269, 2126, 269, 269, 269, 269,
+        269, 269, 269, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 269, 269, 2239, 2227,
+        2209, 2206, 2200, 2201, 2202, 2203, 2204, 2205, 2207, 2208, 2210, 2211, 2212, 2213, 2223, 2216,
+        2217, 2218, 2219, 2220, 2221, 2222, 2224, 2225, 2226, 2228, 2235, 2231, 2232, 2233, 2236, 2237,
+        2243, 2242, 2244, 2251, 2247, 2248, 2249, 2250, 269, 269, 2273, 2274, 2275, 2276, 2277, 269,
+        269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 2361, 269,
+        269, 269, 269, 269, 269, 2472, 269, 269, 269, 269, 269, 2444, 2445, 2446, 2447, 2448,
+        2449, 2450, 2451, 2452, 2453, 269, 269, 2468, 2469, 269, 269, 269, 0, 269, 269, 269,
+        2496, 2497, 2498, 2499, 2500, 2505, 2506, 2507, 269, 269, 269, 269, 269, 269, 269, 269,
+        2622, 269, 269, 269, 2592, 2593, 2594, 2595, 2596, 2597, 269, 269, 269, 269, 269, 269,
+        269, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 269, 269, 269, 269, 269, 269,
+        269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 2723, 269, 269, 269, 269, 269,
+        269, 269, 269, 269, 269, 269, 269, 269, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800,
+        2801, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 269, 269, 2818, 269, 269, 2834,
+        2836, 269, 269, 2859, 2860, 2861, 2862, 2863, 269, 269, 269, 2896, 269, 2897, 2898, 2899,
+        2900, 2901, 269, 269, 269, 269, 2929, 269, 269, 269, 269, 269, 2977, 2958, 2959, 2960,
+        2961, 2962, 2964, 2965, 2966, 2967, 2968, 2969, 2971, 2972, 2973, 2974, 2975, 2976, 2978, 2979,
+        2980, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 3048,
+        3043, 3044, 3045, 3046, 3047, 3049, 3050, 3051, 3052, 3053, 269, 0, 3078, 3079, 3080, 3081,
+        3082, 3083, 3096, 3092, 3097, 3098, 3099, 3100, 3101, 269, 269, 269, 269, 269, 269, 269,
+        269, 3152, 3153, 3154, 3155, 269, 269, 269, 269, 269, 3180, 269, 269, 269, 3205, 3207,
+        269, 269, 269, 269, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const short yy_chk[14063] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11,
+        11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+        11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+        11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+        11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23,
+        23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+        23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+        30, 30, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+        36, 36, 36, 36, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+        42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+        42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+        42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+        42, 42, 42, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+        43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+        43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+        43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+        43, 43, 43, 43, 43, 43, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+        46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+        46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+        46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+        46, 46, 46, 46, 46, 46, 46, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+        50, 50, 50, 50, 50, 50, 50, 50, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+        78, 78, 78, 78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+        79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 80, 80, 80, 80, 80, 80,
+        80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+        80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+        80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+        80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 87, 87, 87, 87, 87,
+        87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+        87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+        87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+        87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 88, 88, 88, 88,
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 91, 91, 91,
+        91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+        91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+        91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+        91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 97, 97,
+        97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+        97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+        97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+        97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 98,
+        98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+        98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+        98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+        98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+        99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+        99, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+        103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+        103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+        103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+        103, 103, 103, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+        104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+        104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+        104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+        104, 104, 104, 104, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+        105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+        105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+        105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+        105, 105, 105, 105, 105, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+        108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+        108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+        108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+        108, 108, 108, 108, 108, 108, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+        112, 112, 112, 112, 112, 112, 112, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+        115, 115, 115, 115, 115, 115, 115, 115, 119, 119, 119, 119, 119, 119, 119, 119,
+        119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+        119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+        119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+        119, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120, 120, 120, 120, 120, 120,
+        120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+        120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+        120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+        120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 124, 124, 124, 124, 124, 124,
+        124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124,
+        124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124,
+        124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124,
+        124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+        125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+        131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 137, 137, 137,
+        137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+        137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+        137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+        137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138,
+        138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+        138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+        138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+        138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 141,
+        141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+        141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+        141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+        141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+        143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+        143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+        143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+        143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+        143, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+        144, 144, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+        152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+        152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+        152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+        152, 152, 152, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+        155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+        155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+        155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+        155, 155, 155, 155, 155, 155, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+        174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+        174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+        174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+        174, 174, 174, 174, 174, 174, 174, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+        175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+        175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+        175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+        175, 175, 175, 175, 175, 175, 175, 175, 183, 183, 183, 183, 183, 183, 183, 183,
+        183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+        183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+        183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+        183, 183, 183, 183, 183, 183, 183, 183, 183, 186, 186, 186, 186, 186, 186, 186,
+        186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+        186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+        186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+        186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 190, 190, 190, 190, 190, 190,
+        190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+        190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+        190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+        190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191,
+        191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+        191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+        191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+        191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 192, 192, 192, 192,
+        192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+        192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+        192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+        192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 195, 195, 195,
+        195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+        195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+        195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+        195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 220, 220,
+        220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+        220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+        220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+        220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 221,
+        221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+        221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+        221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+        221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+        224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+        224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+        224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+        224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+        224, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+        231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+        231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+        231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+        231, 231, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+        233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+        233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+        233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+        233, 233, 233, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+        240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+        240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+        240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+        240, 240, 240, 240, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+        258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+        258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+        258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+        258, 258, 258, 258, 258, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263,
+        263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263,
+        263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263,
+        263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263,
+        263, 263, 263, 263, 263, 263, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267,
+        267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267,
+        267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267,
+        267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267,
+        267, 267, 267, 267, 267, 267, 267, 268, 268, 268, 268, 268, 268, 268, 268, 268,
+        268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268,
+        268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268,
+        268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268, 268,
+        268, 268, 268, 268, 268, 268, 268, 268, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733,
+        2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733,
+        2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733,
+        2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733,
+        2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733, 2735, 2735, 2735, 2735, 2735, 2735, 2735,
+        2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735,
+        2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735,
+        2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735,
+        2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2736, 2736, 2736, 2736, 2736, 2736,
+        2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736,
+        2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736,
+        2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736,
+        2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2833, 2833, 2833, 2833, 2833,
+        2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833,
+        2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833,
+        2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833,
+        2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 3204, 3204, 3204, 3204,
+        3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204,
+        3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204,
+        3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204,
+        3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 3204, 738, 294, 738,
+        738, 738, 738, 738, 738, 738, 738, 738, 206, 206, 206, 206, 206, 206, 738, 738,
+        738, 738, 738, 738, 794, 294, 794, 794, 794, 794, 794, 794, 794, 794, 794, 473,
+        2954, 473, 473, 2954, 473, 794, 794, 794, 794, 794, 794, 802, 2997, 802, 802, 802,
+        802, 802, 802, 802, 802, 802, 60, 12, 60, 60, 2997, 473, 802, 802, 802, 802,
+        802, 802, 846, 2997, 846, 846, 846, 846, 846, 846, 846, 846, 846, 1201, 473, 1201,
+        1201, 2954, 1201, 846, 846, 846, 846, 846, 846, 855, 321, 855, 855, 855, 855, 855,
+        855, 855, 855, 855, 741, 741, 741, 741, 741, 741, 855, 855, 855, 855, 855, 855,
+        1749, 321, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 762, 762, 762, 762, 762,
+        762, 1749, 1749, 1749, 1749, 1749, 1749, 187, 2034, 207, 187, 187, 207, 207, 187, 187,
+        2034, 207, 187, 187, 187, 207, 187, 207, 187, 187, 187, 187, 207, 187, 2061, 187,
+        188, 188, 24, 188, 188, 24, 2061, 24, 188, 2034, 14, 24, 188, 188, 188, 188,
+        188, 188, 188, 188, 188, 297, 2034, 297, 188, 737, 737, 737, 737, 737, 737, 737,
+        737, 737, 768, 768, 768, 768, 768, 768, 2061, 737, 737, 737, 737, 737, 737, 750,
+        750, 750, 750, 750, 750, 750, 750, 750, 773, 773, 773, 773, 773, 773, 750, 750,
+        750, 750, 750, 750, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 777, 777, 777,
+        777, 777, 777, 1406, 1406, 1406, 1406, 1406, 1406, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+        1407, 1407, 783, 783, 783, 783, 783, 783, 1407, 1407, 1407, 1407, 1407, 1407, 1409, 1409,
+        1409, 1409, 1409, 1409, 1409, 1409, 1409, 791, 791, 791, 791, 791, 791, 1409, 1409, 1409,
+        1409, 1409, 1409, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 797, 797, 797, 797,
+        797, 797, 1414, 1414, 1414, 1414, 1414, 1414, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+        1417, 806, 806, 806, 806, 806, 806, 1417, 1417, 1417, 1417, 1417, 1417, 1425, 1425, 1425,
+        1425, 1425, 1425, 1425, 1425, 1425, 813, 813, 813, 813, 813, 813, 1425, 1425, 1425, 1425,
+        1425, 1425, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 819, 819, 819, 819, 819,
+        819, 1430, 1430, 1430, 1430, 1430, 1430, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
+        825, 825, 825, 825, 825, 825, 1433, 1433, 1433, 1433, 1433, 1433, 1439, 1439, 1439, 1439,
+        1439, 1439, 1439, 1439, 1439, 828, 828, 828, 828, 828, 828, 1439, 1439, 1439, 1439, 1439,
+        1439, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 836, 836, 836, 836, 836, 836,
+        1441, 1441, 1441, 1441, 1441, 1441, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 841,
+        841, 841, 841, 841, 841, 1447, 1447, 1447, 1447, 1447, 1447, 1512, 1512, 1512, 1512, 1512,
+        1512, 1512, 1512, 1512, 850, 850, 850, 850, 850, 850, 1512, 1512, 1512, 1512, 1512, 1512,
+        1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 859, 859, 859, 859, 859, 859, 1513,
+        1513, 1513, 1513, 1513, 1513, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 867, 867,
+        867, 867, 867, 867, 1515, 1515, 1515, 1515, 1515, 1515, 1520, 1520, 1520, 1520, 1520, 1520,
+        1520, 1520, 1520, 872, 872, 872, 872, 872, 872, 1520, 1520, 1520, 1520, 1520, 1520, 1523,
+        1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 878, 878, 878, 878, 878, 878, 1523, 1523,
+        1523, 1523, 1523, 1523, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 881, 881, 881,
+        881, 881, 881, 1531, 1531, 1531, 1531, 1531, 1531, 1536, 1536, 1536, 1536, 1536, 1536, 1536,
+        1536, 1536, 889, 889, 889, 889, 889, 889, 1536, 1536, 1536, 1536, 1536, 1536, 1539, 1539,
+        1539, 1539, 1539, 1539, 1539, 1539, 1539, 894, 894, 894, 894, 894, 894, 1539, 1539, 1539,
+        1539, 1539, 1539, 1544, 1544, 1544, 1544, 1544, 1544, 1544, 1544, 1544, 914, 914, 914, 914,
+        914, 914, 1544, 1544, 1544, 1544, 1544, 1544, 1599, 1599, 1599, 1599, 1599, 1599, 1599, 1599,
+        1599, 924, 924, 924, 924, 924, 924, 1599, 1599, 1599, 1599, 1599, 1599, 1600, 1600, 1600,
+        1600, 1600, 1600, 1600, 1600, 1600, 930, 930, 930, 930, 930, 930, 1600, 1600, 1600, 1600,
+        1600, 1600, 1602, 1602, 1602, 1602, 1602, 1602, 1602, 1602, 1602, 936, 936, 936, 936, 936,
+        936, 1602, 1602, 1602, 1602, 1602, 1602, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607,
+        941, 941, 941, 941, 941, 941, 1607, 1607, 1607, 1607, 1607, 1607, 1610, 1610, 1610, 1610,
+        1610, 1610, 1610, 1610, 1610, 944, 944, 944, 944, 944, 944, 1610, 1610, 1610, 1610, 1610,
+        1610, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 953, 953, 953, 953, 953, 953,
+        1618, 1618, 1618, 1618, 1618, 1618, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 960,
+        960, 960, 960, 960, 960, 1623, 1623, 1623, 1623, 1623, 1623, 1667, 1667, 1667, 1667, 1667,
+        1667, 1667, 1667, 1667, 968, 968, 968, 968, 968, 968, 1667, 1667, 1667, 1667, 1667, 1667,
+        1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 982, 982, 982, 982, 982, 982, 1668,
+        1668, 1668, 1668, 1668, 1668, 1670, 1670, 1670, 1670, 1670, 1670, 1670, 1670, 1670, 987, 987,
+        987, 987, 987, 987, 1670, 1670, 1670, 1670, 1670, 1670, 1675, 1675, 1675, 1675, 1675, 1675,
+        1675, 1675, 1675, 992, 992, 992, 992, 992, 992, 1675, 1675, 1675, 1675, 1675, 1675, 1678,
+        1678, 1678, 1678, 1678, 1678, 1678, 1678, 1678, 996, 996, 996, 996, 996, 996, 1678, 1678,
+        1678, 1678, 1678, 1678, 1715, 1715, 1715, 1715, 1715, 1715, 1715, 1715, 1715, 1003, 1003, 1003,
+        1003, 1003, 1003, 1715, 1715, 1715, 1715, 1715, 1715, 1719, 1719, 1719, 1719, 1719, 1719, 1719,
+        1719, 1719, 1010, 1010, 1010, 1010, 1010, 1010, 1719, 1719, 1719, 1719, 1719, 1719, 1721, 1721,
+        1721, 1721, 1721, 1721, 1721, 1721, 1721, 1016, 1016, 1016, 1016, 1016, 1016, 1721, 1721, 1721,
+        1721, 1721, 1721, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1041, 1041, 1041, 1041,
+        1041, 1041, 1726, 1726, 1726, 1726, 1726, 1726, 1748, 1748, 1748, 1748, 1748, 1748, 1748, 1748,
+        1748, 1047, 1047, 1047, 1047, 1047, 1047, 1748, 1748, 1748, 1748, 1748, 1748, 1766, 1766, 1766,
+        1766, 1766, 1766, 1766, 1766, 1766, 1053, 1053, 1053, 1053, 1053, 1053, 1766, 1766, 1766, 1766,
+        1766, 1766, 1828, 307, 1828, 1828, 1828, 1828, 1828, 1828, 1828, 1828, 307, 61, 296, 61,
+        61, 2994, 2994, 1828, 1828, 1828, 1828, 1828, 1828, 61, 61, 61, 2994, 296, 61, 61,
+        61, 61, 61, 61, 61, 61, 68, 2994, 68, 68, 62, 62, 62, 62, 62, 62,
+        62, 62, 68, 68, 68, 223, 223, 68, 68, 68, 68, 68, 68, 68, 68, 72,
+        2180, 72, 72, 134, 134, 134, 134, 134, 134, 134, 134, 72, 72, 72, 2180, 2180,
+        72, 72, 72, 72, 72, 72, 72, 72, 747, 747, 747, 747, 747, 747, 747, 747,
+        1058, 1058, 1058, 1058, 1058, 1058, 320, 747, 747, 747, 747, 747, 747, 748, 748, 748,
+        748, 748, 748, 748, 748, 1061, 1061, 1061, 1061, 1061, 1061, 320, 748, 748, 748, 748,
+        748, 748, 749, 749, 749, 749, 749, 749, 749, 749, 1067, 1067, 1067, 1067, 1067, 1067,
+        366, 749, 749, 749, 749, 749, 749, 755, 755, 755, 755, 755, 755, 755, 755, 1074,
+        1074, 1074, 1074, 1074, 1074, 366, 755, 755, 755, 755, 755, 755, 756, 756, 756, 756,
+        756, 756, 756, 756, 1445, 1445, 1445, 1445, 1445, 1445, 432, 756, 756, 756, 756, 756,
+        756, 757, 757, 757, 757, 757, 757, 757, 757, 1484, 1484, 1484, 1484, 1484, 1484, 432,
+        757, 757, 757, 757, 757, 757, 799, 799, 799, 799, 799, 799, 799, 799, 1506, 1506,
+        1506, 1506, 1506, 1506, 507, 799, 799, 799, 799, 799, 799, 800, 800, 800, 800, 800,
+        800, 800, 800, 1560, 1560, 1560, 1560, 1560, 1560, 507, 800, 800, 800, 800, 800, 800,
+        801, 801, 801, 801, 801, 801, 801, 801, 1571, 1571, 1571, 1571, 1571, 1571, 1139, 801,
+        801, 801, 801, 801, 801, 807, 807, 807, 807, 807, 807, 807, 807, 1593, 1593, 1593,
+        1593, 1593, 1593, 1139, 807, 807, 807, 807, 807, 807, 809, 809, 809, 809, 809, 809,
+        809, 809, 1639, 1639, 1639, 1639, 1639, 1639, 1361, 809, 809, 809, 809, 809, 809, 851,
+        851, 851, 851, 851, 851, 851, 851, 1661, 1661, 1661, 1661, 1661, 1661, 1361, 851, 851,
+        851, 851, 851, 851, 854, 854, 854, 854, 854, 854, 854, 854, 1710, 1710, 1710, 1710,
+        1710, 1710, 1981, 854, 854, 854, 854, 854, 854, 860, 860, 860, 860, 860, 860, 860,
+        860, 1742, 1742, 1742, 1742, 1742, 1742, 1981, 860, 860, 860, 860, 860, 860, 862, 862,
+        862, 862, 862, 862, 862, 862, 1753, 1753, 1753, 1753, 1753, 1753, 2092, 862, 862, 862,
+        862, 862, 862, 899, 899, 899, 899, 899, 899, 899, 899, 1780, 1780, 1780, 1780, 1780,
+        1780, 2092, 899, 899, 899, 899, 899, 899, 900, 900, 900, 900, 900, 900, 900, 900,
+        1786, 1786, 1786, 1786, 1786, 1786, 2153, 900, 900, 900, 900, 900, 900, 902, 902, 902,
+        902, 902, 902, 902, 902, 1792, 1792, 1792, 1792, 1792, 1792, 2153, 902, 902, 902, 902,
+        902, 902, 906, 906, 906, 906, 906, 906, 906, 906, 1797, 1797, 1797, 1797, 1797, 1797,
+        2259, 906, 906, 906, 906, 906, 906, 907, 907, 907, 907, 907, 907, 907, 907, 1800,
+        1800, 1800, 1800, 1800, 1800, 2259, 907, 907, 907, 907, 907, 907, 911, 911, 911, 911,
+        911, 911, 911, 911, 1806, 1806, 1806, 1806, 1806, 1806, 2278, 911, 911, 911, 911, 911,
+        911, 917, 917, 917, 917, 917, 917, 917, 917, 1815, 1815, 1815, 1815, 1815, 1815, 2278,
+        917, 917, 917, 917, 917, 917, 918, 918, 918, 918, 918, 918, 918, 918, 1836, 1836,
+        1836, 1836, 1836, 1836, 2288, 918, 918, 918, 918, 918, 918, 957, 957, 957, 957, 957,
+        957, 957, 957, 1842, 1842, 1842, 1842, 1842, 1842, 2288, 957, 957, 957, 957, 957, 957,
+        963, 963, 963, 963, 963, 963, 963, 963, 1848, 1848, 1848, 1848, 1848, 1848, 2310, 963,
+        963, 963, 963, 963, 963, 964, 964, 964, 964, 964, 964, 964, 964, 1854, 1854, 1854,
+        1854, 1854, 1854, 2310, 964, 964, 964, 964, 964, 964, 969, 969, 969, 969, 969, 969,
+        969, 969, 1861, 1861, 1861, 1861, 1861, 1861, 2401, 969, 969, 969, 969, 969, 969, 974,
+        974, 974, 974, 974, 974, 974, 974, 1866, 1866, 1866, 1866, 1866, 1866, 2401, 974, 974,
+        974, 974, 974, 974, 975, 975, 975, 975, 975, 975, 975, 975, 1872, 1872, 1872, 1872,
+        1872, 1872, 3084, 975, 975, 975, 975, 975, 975, 978, 978, 978, 978, 978, 978, 978,
+        978, 482, 3084, 482, 482, 3084, 1130, 18, 978, 978, 978, 978, 978, 978, 1017, 1017,
+        1017, 1017, 1017, 1017, 1017, 1017, 1130, 1130, 253, 253, 253, 1130, 300, 1017, 1017, 1017,
+        1017, 1017, 1017, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 300, 2414, 25, 2414, 2414,
+        482, 2414, 1021, 1021, 1021, 1021, 1021, 1021, 1032, 1032, 1032, 1032, 1032, 1032, 1032, 1032,
+        3075, 21, 3075, 3075, 21, 2508, 2508, 1032, 1032, 1032, 1032, 1032, 1032, 1033, 1033, 1033,
+        1033, 1033, 1033, 1033, 1033, 2508, 3068, 29, 3068, 3068, 2508, 3068, 1033, 1033, 1033, 1033,
+        1033, 1033, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 3101, 218, 3101, 3101, 218, 3075,
+        357, 1036, 1036, 1036, 1036, 1036, 1036, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 65,
+        357, 65, 65, 342, 357, 45, 1075, 1075, 1075, 1075, 1075, 1075, 1404, 1404, 1404, 1404,
+        1404, 1404, 1404, 1404, 67, 1953, 67, 67, 1953, 3101, 342, 1404, 1404, 1404, 1404, 1404,
+        1404, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 69, 1266, 69, 69, 1266, 1266, 270,
+        1408, 1408, 1408, 1408, 1408, 1408, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 71, 629,
+        71, 71, 270, 1953, 1979, 1416, 1416, 1416, 1416, 1416, 1416, 1422, 1422, 1422, 1422, 1422,
+        1422, 1422, 1422, 101, 49, 101, 101, 1979, 1979, 286, 1422, 1422, 1422, 1422, 1422, 1422,
+        1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 102, 286, 102, 102, 247, 247, 629, 1423,
+        1423, 1423, 1423, 1423, 1423, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 142, 274, 142,
+        142, 274, 308, 275, 1424, 1424, 1424, 1424, 1424, 1424, 1432, 1432, 1432, 1432, 1432, 1432,
+        1432, 1432, 176, 285, 176, 176, 275, 285, 308, 1432, 1432, 1432, 1432, 1432, 1432, 1438,
+        1438, 1438, 1438, 1438, 1438, 1438, 1438, 177, 317, 177, 177, 317, 291, 53, 1438, 1438,
+        1438, 1438, 1438, 1438, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 317, 360, 470, 412,
+        470, 470, 2783, 1440, 1440, 1440, 1440, 1440, 1440, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
+        1446, 2783, 2783, 291, 360, 360, 412, 412, 1446, 1446, 1446, 1446, 1446, 1446, 1448, 1448,
+        1448, 1448, 1448, 1448, 1448, 1448, 418, 418, 358, 677, 443, 418, 677, 1448, 1448, 1448,
+        1448, 1448, 1448, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 475, 303, 475, 475, 358,
+        303, 443, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
+        677, 1082, 1115, 1082, 1115, 1115, 1082, 1450, 1450, 1450, 1450, 1450, 1450, 1452, 1452, 1452,
+        1452, 1452, 1452, 1452, 1452, 1318, 3059, 54, 3059, 3059, 277, 1318, 1452, 1452, 1452, 1452,
+        1452, 1452, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1319, 1319, 1318, 277, 1883, 1319,
+        292, 1456, 1456, 1456, 1456, 1456, 1456, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1334,
+        1883, 1883, 1334, 292, 298, 1380, 1467, 1467, 1467, 1467, 1467, 1467, 1478, 1478, 1478, 1478,
+        1478, 1478, 1478, 1478, 1380, 309, 309, 298, 1380, 313, 1879, 1478, 1478, 1478, 1478, 1478,
+        1478, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1879, 3088, 2394, 3088, 3088, 1879, 1334,
+        1489, 1489, 1489, 1489, 1489, 1489, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 2394, 310,
+        313, 311, 2394, 310, 2331, 1500, 1500, 1500, 1500, 1500, 1500, 1511, 1511, 1511, 1511, 1511,
+        1511, 1511, 1511, 2331, 311, 343, 81, 2331, 316, 2548, 1511, 1511, 1511, 1511, 1511, 1511,
+        1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 2347, 2347, 2548, 343, 344, 344, 2347, 1514,
+        1514, 1514, 1514, 1514, 1514, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 2548, 3094, 316,
+        3094, 3094, 331, 2888, 1522, 1522, 1522, 1522, 1522, 1522, 1528, 1528, 1528, 1528, 1528, 1528,
+        1528, 1528, 2652, 322, 331, 2652, 322, 3010, 3010, 1528, 1528, 1528, 1528, 1528, 1528, 1529,
+        1529, 1529, 1529, 1529, 1529, 1529, 1529, 2888, 325, 315, 372, 325, 2888, 315, 1529, 1529,
+        1529, 1529, 1529, 1529, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 3010, 326, 372, 327,
+        84, 326, 2652, 1530, 1530, 1530, 1530, 1530, 1530, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+        1538, 3054, 327, 3054, 330, 346, 368, 3054, 1538, 1538, 1538, 1538, 1538, 1538, 1546, 1546,
+        1546, 1546, 1546, 1546, 1546, 1546, 318, 330, 346, 368, 109, 318, 302, 1546, 1546, 1546,
+        1546, 1546, 1546, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 302, 332, 338, 349, 332,
+        402, 338, 1547, 1547, 1547, 1547, 1547, 1547, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548,
+        328, 345, 369, 369, 402, 345, 328, 1548, 1548, 1548, 1548, 1548, 1548, 1550, 1550, 1550,
+        1550, 1550, 1550, 1550, 1550, 349, 359, 380, 428, 359, 380, 335, 1550, 1550, 1550, 1550,
+        1550, 1550, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 335, 361, 428, 444, 444, 361,
+        337, 1554, 1554, 1554, 1554, 1554, 1554, 1565, 1565, 1565, 1565, 1565, 1565, 1565, 1565, 337,
+        392, 393, 394, 392, 352, 393, 1565, 1565, 1565, 1565, 1565, 1565, 1576, 1576, 1576, 1576,
+        1576, 1576, 1576, 1576, 352, 394, 399, 397, 111, 399, 409, 1576, 1576, 1576, 1576, 1576,
+        1576, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 375, 397, 403, 429, 409, 403, 375,
+        1587, 1587, 1587, 1587, 1587, 1587, 1598, 1598, 1598, 1598, 1598, 1598, 1598, 1598, 400, 429,
+        437, 441, 437, 400, 386, 1598, 1598, 1598, 1598, 1598, 1598, 1601, 1601, 1601, 1601, 1601,
+        1601, 1601, 1601, 386, 433, 441, 438, 440, 433, 396, 1601, 1601, 1601, 1601, 1601, 1601,
+        1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 396, 438, 440, 673, 460, 486, 405, 1609,
+        1609, 1609, 1609, 1609, 1609, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 405, 450, 460,
+        486, 673, 450, 408, 1615, 1615, 1615, 1615, 1615, 1615, 1616, 1616, 1616, 1616, 1616, 1616,
+        1616, 1616, 408, 454, 463, 465, 454, 463, 410, 1616, 1616, 1616, 1616, 1616, 1616, 1617,
+        1617, 1617, 1617, 1617, 1617, 1617, 1617, 410, 415, 494, 2403, 499, 465, 415, 1617, 1617,
+        1617, 1617, 1617, 1617, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 411, 456, 499, 2403,
+        494, 456, 411, 1625, 1625, 1625, 1625, 1625, 1625, 1626, 1626, 1626, 1626, 1626, 1626, 1626,
+        1626, 419, 488, 533, 533, 488, 419, 417, 1626, 1626, 1626, 1626, 1626, 1626, 1627, 1627,
+        1627, 1627, 1627, 1627, 1627, 1627, 417, 420, 563, 563, 508, 492, 420, 1627, 1627, 1627,
+        1627, 1627, 1627, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 424, 492, 508, 113, 510,
+        424, 421, 1629, 1629, 1629, 1629, 1629, 1629, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
+        421, 435, 510, 602, 602, 542, 435, 1633, 1633, 1633, 1633, 1633, 1633, 1644, 1644, 1644,
+        1644, 1644, 1644, 1644, 1644, 430, 459, 542, 121, 550, 459, 430, 1644, 1644, 1644, 1644,
+        1644, 1644, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 439, 467, 550, 1122, 556, 467,
+        439, 1655, 1655, 1655, 1655, 1655, 1655, 1666, 1666, 1666, 1666, 1666, 1666, 1666, 1666, 458,
+        552, 556, 126, 1122, 458, 447, 1666, 1666, 1666, 1666, 1666, 1666, 1669, 1669, 1669, 1669,
+        1669, 1669, 1669, 1669, 447, 489, 578, 552, 732, 489, 449, 1669, 1669, 1669, 1669, 1669,
+        1669, 1677, 1677, 1677, 1677, 1677, 1677, 1677, 1677, 449, 498, 558, 732, 578, 558, 498,
+        1677, 1677, 1677, 1677, 1677, 1677, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 461, 512,
+        1179, 132, 582, 512, 461, 1683, 1683, 1683, 1683, 1683, 1683, 1684, 1684, 1684, 1684, 1684,
+        1684, 1684, 1684, 466, 527, 582, 1179, 691, 527, 466, 1684, 1684, 1684, 1684, 1684, 1684,
+        1685, 1685, 1685, 1685, 1685, 1685, 1685, 1685, 471, 547, 691, 1168, 1094, 547, 471, 1685,
+        1685, 1685, 1685, 1685, 1685, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 511, 634, 703,
+        1094, 634, 511, 472, 1686, 1686, 1686, 1686, 1686, 1686, 1687, 1687, 1687, 1687, 1687, 1687,
+        1687, 1687, 472, 541, 1168, 2513, 703, 581, 541, 1687, 1687, 1687, 1687, 1687, 1687, 1689,
+        1689, 1689, 1689, 1689, 1689, 1689, 1689, 493, 581, 647, 2513, 730, 647, 493, 1689, 1689,
+        1689, 1689, 1689, 1689, 1693, 1693, 1693, 1693, 1693, 1693, 1693, 1693, 506, 583, 730, 2587,
+        1088, 583, 506, 1693, 1693, 1693, 1693, 1693, 1693, 1704, 1704, 1704, 1704, 1704, 1704, 1704,
+        1704, 546, 664, 1088, 2587, 664, 546, 514, 1704, 1704, 1704, 1704, 1704, 1704, 1716, 1716,
+        1716, 1716, 1716, 1716, 1716, 1716, 514, 694, 696, 2606, 694, 696, 526, 1716, 1716, 1716,
+        1716, 1716, 1716, 1717, 1717, 1717, 1717, 1717, 1717, 1717, 1717, 526, 587, 702, 2606, 1091,
+        702, 587, 1717, 1717, 1717, 1717, 1717, 1717, 1720, 1720, 1720, 1720, 1720, 1720, 1720, 1720,
+        544, 697, 1091, 133, 1098, 697, 544, 1720, 1720, 1720, 1720, 1720, 1720, 1728, 1728, 1728,
+        1728, 1728, 1728, 1728, 1728, 545, 711, 731, 1098, 711, 676, 545, 1728, 1728, 1728, 1728,
+        1728, 1728, 1729, 1729, 1729, 1729, 1729, 1729, 1729, 1729, 562, 707, 1081, 139, 731, 707,
+        562, 1729, 1729, 1729, 1729, 1729, 1729, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 676,
+        1079, 1089, 1093, 1081, 1079, 576, 1730, 1730, 1730, 1730, 1730, 1730, 1732, 1732, 1732, 1732,
+        1732, 1732, 1732, 1732, 576, 733, 1937, 1095, 1089, 1093, 733, 1732, 1732, 1732, 1732, 1732,
+        1732, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1736, 1080, 1095, 1083, 1937, 1119, 1080, 1083,
+        1736, 1736, 1736, 1736, 1736, 1736, 1747, 1747, 1747, 1747, 1747, 1747, 1747, 1747, 1084, 1118,
+        1119, 1264, 1264, 1118, 1084, 1747, 1747, 1747, 1747, 1747, 1747, 1754, 1754, 1754, 1754, 1754,
+        1754, 1754, 1754, 1085, 1123, 1121, 1126, 1123, 1085, 1121, 1754, 1754, 1754, 1754, 1754, 1754,
+        1755, 1755, 1755, 1755, 1755, 1755, 1755, 1755, 1096, 1126, 1143, 1124, 1125, 1150, 1096, 1755,
+        1755, 1755, 1755, 1755, 1755, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1124, 1125, 1146,
+        1150, 1143, 1146, 1205, 1757, 1757, 1757, 1757, 1757, 1757, 1759, 1759, 1759, 1759, 1759, 1759,
+        1759, 1759, 1127, 1152, 1157, 1160, 1152, 1157, 1127, 1759, 1759, 1759, 1759, 1759, 1759, 1763,
+        1763, 1763, 1763, 1763, 1763, 1763, 1763, 1131, 1177, 1160, 1205, 1177, 1131, 1134, 1763, 1763,
+        1763, 1763, 1763, 1763, 1768, 1768, 1768, 1768, 1768, 1768, 1768, 1768, 1134, 1153, 1155, 2613,
+        1180, 1153, 1155, 1768, 1768, 1768, 1768, 1768, 1768, 1769, 1769, 1769, 1769, 1769, 1769, 1769,
+        1769, 1137, 1158, 1180, 2613, 1165, 1158, 1137, 1769, 1769, 1769, 1769, 1769, 1769, 1771, 1771,
+        1771, 1771, 1771, 1771, 1771, 1771, 1162, 1165, 1214, 147, 1214, 1162, 1148, 1771, 1771, 1771,
+        1771, 1771, 1771, 1775, 1775, 1775, 1775, 1775, 1775, 1775, 1775, 1148, 1163, 1164, 1184, 1191,
+        1163, 1164, 1775, 1775, 1775, 1775, 1775, 1775, 1818, 1818, 1818, 1818, 1818, 1818, 1818, 1818,
+        1184, 1260, 1191, 150, 1202, 1185, 1166, 1818, 1818, 1818, 1818, 1818, 1818, 1820, 1820, 1820,
+        1820, 1820, 1820, 1820, 1820, 1166, 1185, 1202, 1260, 1215, 1218, 1198, 1820, 1820, 1820, 1820,
+        1820, 1820, 1822, 1822, 1822, 1822, 1822, 1822, 1822, 1822, 1181, 1198, 1206, 1215, 1218, 1206,
+        1181, 1822, 1822, 1822, 1822, 1822, 1822, 1824, 1824, 1824, 1824, 1824, 1824, 1824, 1824, 1203,
+        165, 501, 1276, 1203, 501, 1189, 1824, 1824, 1824, 1824, 1824, 1824, 1826, 1826, 1826, 1826,
+        1826, 1826, 1826, 1826, 1189, 2412, 1293, 2412, 2412, 1276, 2412, 1826, 1826, 1826, 1826, 1826,
+        1826, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 194, 194, 1293, 194, 194,
+        529, 194, 203, 2476, 501, 194, 194, 194, 194, 2476, 194, 194, 194, 2476, 1292, 2476,
+        196, 1292, 196, 196, 513, 2476, 203, 513, 196, 2412, 203, 196, 2412, 196, 196, 196,
+        529, 196, 196, 196, 196, 197, 197, 168, 41, 529, 41, 41, 515, 41, 197, 515,
+        197, 41, 197, 197, 197, 197, 197, 197, 197, 1196, 197, 66, 66, 66, 1196, 513,
+        66, 66, 66, 66, 66, 66, 66, 66, 70, 70, 70, 513, 290, 70, 70, 70,
+        70, 70, 70, 70, 70, 201, 217, 217, 290, 201, 217, 2283, 201, 201, 217, 515,
+        201, 319, 515, 201, 201, 319, 201, 201, 201, 319, 212, 2995, 212, 201, 212, 319,
+        2572, 212, 212, 2283, 2995, 212, 2995, 212, 212, 2283, 2995, 2572, 2995, 212, 1087, 2572,
+        2995, 212, 212, 356, 1087, 356, 356, 1136, 44, 356, 44, 44, 356, 44, 1087, 356,
+        554, 44, 356, 356, 1136, 356, 356, 616, 1136, 1829, 356, 1829, 1829, 1829, 1829, 1829,
+        1829, 1829, 1829, 1829, 1832, 616, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1946, 554,
+        1946, 1946, 1946, 1946, 1946, 1946, 1946, 1946, 198, 554, 211, 198, 198, 353, 200, 1946,
+        198, 1829, 200, 1129, 554, 198, 200, 198, 1129, 198, 198, 198, 1832, 199, 1129, 200,
+        1217, 199, 199, 202, 2744, 199, 1217, 202, 199, 2744, 199, 202, 199, 353, 199, 2744,
+        202, 202, 199, 2744, 202, 202, 202, 216, 468, 202, 468, 468, 759, 468, 759, 759,
+        759, 759, 759, 759, 759, 759, 771, 771, 771, 771, 771, 771, 771, 771, 771, 1303,
+        1303, 1320, 295, 803, 468, 803, 803, 803, 803, 803, 803, 803, 803, 811, 295, 811,
+        811, 811, 811, 811, 811, 811, 811, 468, 1320, 222, 468, 468, 364, 276, 816, 468,
+        816, 816, 816, 816, 816, 816, 816, 816, 847, 364, 847, 847, 847, 847, 847, 847,
+        847, 847, 856, 1364, 856, 856, 856, 856, 856, 856, 856, 856, 870, 276, 870, 870,
+        870, 870, 870, 870, 870, 870, 921, 1364, 921, 921, 921, 921, 921, 921, 921, 921,
+        980, 276, 980, 980, 980, 980, 980, 980, 980, 980, 985, 1132, 985, 985, 985, 985,
+        985, 985, 985, 985, 1025, 1132, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1029, 1132,
+        1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1044, 365, 1044, 1044, 1044, 1044, 1044, 1044,
+        1044, 1044, 1405, 365, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1434, 371, 1434, 1434,
+        1434, 1434, 1434, 1434, 1434, 1434, 1442, 371, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
+        1460, 414, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1471, 414, 1471, 1471, 1471, 1471,
+        1471, 1471, 1471, 1471, 1493, 423, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1497, 423,
+        1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1543, 427, 1543, 1543, 1543, 1543, 1543, 1543,
+        1543, 1543, 1580, 427, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1580, 1584, 497, 1584, 1584,
+        1584, 1584, 1584, 1584, 1584, 1584, 1648, 497, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648,
+        1652, 531, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1697, 531, 1697, 1697, 1697, 1697,
+        1697, 1697, 1697, 1697, 1701, 555, 1701, 1701, 1701, 1701, 1701, 1701, 1701, 1701, 1751, 555,
+        1751, 1751, 1751, 1751, 1751, 1751, 1751, 1751, 1783, 577, 1783, 1783, 1783, 1783, 1783, 1783,
+        1783, 1783, 1839, 577, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1845, 1845, 1845, 1845,
+        1845, 1845, 1845, 1845, 1845, 3086, 2096, 3086, 3086, 2096, 3086, 156, 156, 156, 156, 157,
+        157, 157, 157, 1204, 312, 156, 156, 225, 156, 157, 157, 284, 157, 34, 209, 34,
+        34, 3086, 209, 284, 209, 156, 209, 34, 34, 157, 34, 1204, 209, 209, 1211, 209,
+        3086, 1204, 1211, 226, 3086, 1204, 312, 34, 3086, 2096, 1204, 312, 3086, 204, 204, 204,
+        204, 204, 204, 204, 204, 205, 205, 205, 205, 205, 205, 205, 205, 739, 739, 739,
+        739, 739, 739, 739, 739, 740, 740, 740, 740, 740, 740, 740, 740, 743, 743, 743,
+        743, 743, 743, 743, 743, 744, 744, 744, 744, 744, 744, 744, 744, 745, 745, 745,
+        745, 745, 745, 745, 745, 752, 752, 752, 752, 752, 752, 752, 752, 753, 753, 753,
+        753, 753, 753, 753, 753, 754, 754, 754, 754, 754, 754, 754, 754, 758, 758, 758,
+        758, 758, 758, 758, 758, 761, 761, 761, 761, 761, 761, 761, 761, 764, 764, 764,
+        764, 764, 764, 764, 764, 766, 766, 766, 766, 766, 766, 766, 766, 767, 767, 767,
+        767, 767, 767, 767, 767, 770, 770, 770, 770, 770, 770, 770, 770, 772, 772, 772,
+        772, 772, 772, 772, 772, 776, 776, 776, 776, 776, 776, 776, 776, 780, 780, 780,
+        780, 780, 780, 780, 780, 782, 782, 782, 782, 782, 782, 782, 782, 786, 786, 786,
+        786, 786, 786, 786, 786, 788, 788, 788, 788, 788, 788, 788, 788, 790, 790, 790,
+        790, 790, 790, 790, 790, 795, 795, 795, 795, 795, 795, 795, 795, 796, 796, 796,
+        796, 796, 796, 796, 796, 805, 805, 805, 805, 805, 805, 805, 805, 810, 810, 810,
+        810, 810, 810, 810, 810, 812, 812, 812, 812, 812, 812, 812, 812, 815, 815, 815,
+        815, 815, 815, 815, 815, 818, 818, 818, 818, 818, 818, 818, 818, 821, 821, 821,
+        821, 821, 821, 821, 821, 823, 823, 823, 823, 823, 823, 823, 823, 824, 824, 824,
+        824, 824, 824, 824, 824, 827, 827, 827, 827, 827, 827, 827, 827, 831, 831, 831,
+        831, 831, 831, 831, 831, 833, 833, 833, 833, 833, 833, 833, 833, 835, 835, 835,
+        835, 835, 835, 835, 835, 840, 840, 840, 840, 840, 840, 840, 840, 844, 844, 844,
+        844, 844, 844, 844, 844, 849, 849, 849, 849, 849, 849, 849, 849, 852, 852, 852,
+        852, 852, 852, 852, 852, 858, 858, 858, 858, 858, 858, 858, 858, 863, 863, 863,
+        863, 863, 863, 863, 863, 865, 865, 865, 865, 865, 865, 865, 865, 866, 866, 866,
+        866, 866, 866, 866, 866, 869, 869, 869, 869, 869, 869, 869, 869, 871, 871, 871,
+        871, 871, 871, 871, 871, 874, 874, 874, 874, 874, 874, 874, 874, 875, 875, 875,
+        875, 875, 875, 875, 875, 876, 876, 876, 876, 876, 876, 876, 876, 880, 880, 880,
+        880, 880, 880, 880, 880, 884, 884, 884, 884, 884, 884, 884, 884, 887, 887, 887,
+        887, 887, 887, 887, 887, 890, 890, 890, 890, 890, 890, 890, 890, 893, 893, 893,
+        893, 893, 893, 893, 893, 897, 897, 897, 897, 897, 897, 897, 897, 910, 910, 910,
+        910, 910, 910, 910, 910, 913, 913, 913, 913, 913, 913, 913, 913, 923, 923, 923,
+        923, 923, 923, 923, 923, 926, 926, 926, 926, 926, 926, 926, 926, 928, 928, 928,
+        928, 928, 928, 928, 928, 929, 929, 929, 929, 929, 929, 929, 929, 932, 932, 932,
+        932, 932, 932, 932, 932, 933, 933, 933, 933, 933, 933, 933, 933, 934, 934, 934,
+        934, 934, 934, 934, 934, 938, 938, 938, 938, 938, 938, 938, 938, 940, 940, 940,
+        940, 940, 940, 940, 940, 945, 945, 945, 945, 945, 945, 945, 945, 948, 948, 948,
+        948, 948, 948, 948, 948, 950, 950, 950, 950, 950, 950, 950, 950, 952, 952, 952,
+        952, 952, 952, 952, 952, 956, 956, 956, 956, 956, 956, 956, 956, 959, 959, 959,
+        959, 959, 959, 959, 959, 967, 967, 967, 967, 967, 967, 967, 967, 972, 972, 972,
+        972, 972, 972, 972, 972, 979, 979, 979, 979, 979, 979, 979, 979, 981, 981, 981,
+        981, 981, 981, 981, 981, 984, 984, 984, 984, 984, 984, 984, 984, 986, 986, 986,
+        986, 986, 986, 986, 986, 989, 989, 989, 989, 989, 989, 989, 989, 990, 990, 990,
+        990, 990, 990, 990, 990, 991, 991, 991, 991, 991, 991, 991, 991, 995, 995, 995,
+        995, 995, 995, 995, 995, 999, 999, 999, 999, 999, 999, 999, 999, 1002, 1002, 1002,
+        1002, 1002, 1002, 1002, 1002, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1009, 1009, 1009,
+        1009, 1009, 1009, 1009, 1009, 1013, 1013, 1013, 1013, 1013, 1013, 1013, 1013, 1015, 1015, 1015,
+        1015, 1015, 1015, 1015, 1015, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1037, 1037, 1037,
+        1037, 1037, 1037, 1037, 1037, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1040, 1040, 1040,
+        1040, 1040, 1040, 1040, 1040, 1043, 1043, 1043, 1043, 1043, 1043, 1043, 1043, 1045, 1045, 1045,
+        1045, 1045, 1045, 1045, 1045, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1050, 1050, 1050,
+        1050, 1050, 1050, 1050, 1050, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1055, 1055, 1055,
+        1055, 1055, 1055, 1055, 1055, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1062, 1062, 1062,
+        1062, 1062, 1062, 1062, 1062, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1068, 1068, 1068,
+        1068, 1068, 1068, 1068, 1068, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 1073, 1073, 1073,
+        1073, 1073, 1073, 1073, 1073, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1403, 1403, 1403,
+        1403, 1403, 1403, 1403, 1403, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 1411, 1411, 1411,
+        1411, 1411, 1411, 1411, 1411, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1412, 1419, 1419, 1419,
+        1419, 1419, 1419, 1419, 1419, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1421, 1421, 1421,
+        1421, 1421, 1421, 1421, 1421, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1427, 1427, 1427,
+        1427, 1427, 1427, 1427, 1427, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1435, 1435, 1435,
+        1435, 1435, 1435, 1435, 1435, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1437, 1437, 1437,
+        1437, 1437, 1437, 1437, 1437, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1444, 1444, 1444,
+        1444, 1444, 1444, 1444, 1444, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1476, 1476, 1476,
+        1476, 1476, 1476, 1476, 1476, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1487, 1487, 1487,
+        1487, 1487, 1487, 1487, 1487, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1509, 1509, 1509,
+        1509, 1509, 1509, 1509, 1509, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1517, 1517, 1517,
+        1517, 1517, 1517, 1517, 1517, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1525, 1525, 1525,
+        1525, 1525, 1525, 1525, 1525, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1527, 1527, 1527,
+        1527, 1527, 1527, 1527, 1527, 1532, 1532, 1532, 1532, 1532, 1532, 1532, 1532, 1533, 1533, 1533,
+        1533, 1533, 1533, 1533, 1533, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1540, 1540, 1540,
+        1540, 1540, 1540, 1540, 1540, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1542, 1542, 1542,
+        1542, 1542, 1542, 1542, 1542, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1563, 1563, 1563,
+        1563, 1563, 1563, 1563, 1563, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1574, 1574, 1574,
+        1574, 1574, 1574, 1574, 1574, 1592, 1592, 1592, 1592, 1592, 1592, 1592, 1592, 1596, 1596, 1596,
+        1596, 1596, 1596, 1596, 1596, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1604, 1604, 1604,
+        1604, 1604, 1604, 1604, 1604, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1612, 1612, 1612,
+        1612, 1612, 1612, 1612, 1612, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1614, 1614, 1614,
+        1614, 1614, 1614, 1614, 1614, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1620, 1620, 1620,
+        1620, 1620, 1620, 1620, 1620, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1638, 1638, 1638,
+        1638, 1638, 1638, 1638, 1638, 1642, 1642, 1642, 1642, 1642, 1642, 1642, 1642, 1660, 1660, 1660,
+        1660, 1660, 1660, 1660, 1660, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1671, 1671, 1671,
+        1671, 1671, 1671, 1671, 1671, 1672, 1672, 1672, 1672, 1672, 1672, 1672, 1672, 1673, 1673, 1673,
+        1673, 1673, 1673, 1673, 1673, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1681, 1681, 1681,
+        1681, 1681, 1681, 1681, 1681, 1682, 1682, 1682, 1682, 1682, 1682, 1682, 1682, 1709, 1709, 1709,
+        1709, 1709, 1709, 1709, 1709, 1713, 1713, 1713, 1713, 1713, 1713, 1713, 1713, 1722, 1722, 1722,
+        1722, 1722, 1722, 1722, 1722, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1724, 1724, 1724,
+        1724, 1724, 1724, 1724, 1724, 1741, 1741, 1741, 1741, 1741, 1741, 1741, 1741, 1745, 1745, 1745,
+        1745, 1745, 1745, 1745, 1745, 1750, 1750, 1750, 1750, 1750, 1750, 1750, 1750, 1764, 1764, 1764,
+        1764, 1764, 1764, 1764, 1764, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1779, 1779, 1779,
+        1779, 1779, 1779, 1779, 1779, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1784, 1784, 1784,
+        1784, 1784, 1784, 1784, 1784, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1789, 1789, 1789,
+        1789, 1789, 1789, 1789, 1789, 1791, 1791, 1791, 1791, 1791, 1791, 1791, 1791, 1794, 1794, 1794,
+        1794, 1794, 1794, 1794, 1794, 1796, 1796, 1796, 1796, 1796, 1796, 1796, 1796, 1801, 1801, 1801,
+        1801, 1801, 1801, 1801, 1801, 1804, 1804, 1804, 1804, 1804, 1804, 1804, 1804, 1807, 1807, 1807,
+        1807, 1807, 1807, 1807, 1807, 1810, 1810, 1810, 1810, 1810, 1810, 1810, 1810, 1812, 1812, 1812,
+        1812, 1812, 1812, 1812, 1812, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1830, 1830, 1830,
+        1830, 1830, 1830, 1830, 1830, 1834, 1834, 1834, 1834, 1834, 1834, 1834, 1834, 1835, 1835, 1835,
+        1835, 1835, 1835, 1835, 1835, 1837, 1837, 1837, 1837, 1837, 1837, 1837, 1837, 1841, 1841, 1841,
+        1841, 1841, 1841, 1841, 1841, 1843, 1843, 1843, 1843, 1843, 1843, 1843, 1843, 1846, 1846, 1846,
+        1846, 1846, 1846, 1846, 1846, 1847, 1847, 1847, 1847, 1847, 1847, 1847, 1847, 1851, 1851, 1851,
+        1851, 1851, 1851, 1851, 1851, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1857, 1857, 1857,
+        1857, 1857, 1857, 1857, 1857, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1859, 1862, 1862, 1862,
+        1862, 1862, 1862, 1862, 1862, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1865, 1869, 1869, 1869,
+        1869, 1869, 1869, 1869, 1869, 1871, 1871, 1871, 1871, 1871, 1871, 1871, 1871, 1875, 1875, 1875,
+        1875, 1875, 1875, 1875, 1875, 2004, 73, 3031, 73, 73, 3031, 73, 1197, 2004, 2177, 73,
+        3056, 2177, 3056, 3056, 35, 3056, 35, 35, 159, 1197, 159, 159, 1226, 585, 35, 35,
+        585, 35, 159, 159, 1977, 159, 1977, 3031, 2004, 2004, 1977, 1226, 3056, 1977, 35, 2004,
+        1977, 2177, 159, 2177, 2004, 2177, 2004, 161, 2004, 161, 161, 2177, 3031, 2177, 3031, 3056,
+        2177, 161, 161, 3056, 161, 692, 1382, 3056, 189, 213, 189, 189, 213, 213, 1382, 585,
+        692, 161, 189, 189, 585, 189, 3013, 213, 2746, 215, 215, 213, 213, 215, 2746, 299,
+        213, 215, 189, 586, 2746, 2746, 586, 2657, 215, 2746, 215, 299, 215, 2657, 615, 1382,
+        692, 615, 407, 2657, 692, 692, 3013, 2657, 2657, 692, 2657, 407, 2657, 2292, 1026, 692,
+        1026, 1026, 1026, 1026, 1026, 1026, 1464, 2292, 1464, 1464, 1464, 1464, 1464, 1464, 586, 2292,
+        1886, 586, 615, 1886, 586, 586, 586, 1472, 1886, 1472, 1472, 1472, 1472, 1472, 1472, 1494,
+        615, 1494, 1494, 1494, 1494, 1494, 1494, 1581, 1255, 1581, 1581, 1581, 1581, 1581, 1581, 1649,
+        1103, 1649, 1649, 1649, 1649, 1649, 1649, 1698, 1255, 1698, 1698, 1698, 1698, 1698, 1698, 208,
+        1103, 1901, 1384, 208, 1901, 422, 496, 208, 496, 496, 1384, 496, 208, 208, 422, 1103,
+        1103, 3057, 208, 3057, 3057, 3074, 3057, 3074, 3074, 3091, 3074, 3091, 3091, 227, 3091, 1103,
+        1349, 1349, 496, 3114, 1103, 3114, 3114, 1384, 3114, 2629, 404, 404, 1901, 3057, 1901, 404,
+        2629, 3074, 2629, 404, 1901, 3091, 1270, 2370, 1901, 74, 2370, 74, 74, 496, 74, 3114,
+        3057, 210, 74, 373, 1349, 210, 373, 228, 3091, 210, 1268, 1199, 3074, 1199, 1199, 210,
+        1199, 373, 2715, 2417, 210, 2417, 2417, 1268, 2417, 1270, 3114, 2370, 1268, 1268, 1227, 243,
+        2993, 1268, 2993, 675, 214, 1186, 675, 1186, 214, 2370, 2715, 2993, 214, 1227, 2370, 1133,
+        2715, 1133, 1133, 2993, 2715, 2993, 373, 1133, 539, 2715, 373, 214, 539, 687, 687, 687,
+        539, 709, 1199, 1332, 244, 1902, 1332, 1186, 1902, 539, 2417, 1145, 709, 1880, 1213, 1145,
+        1145, 333, 1213, 1880, 1145, 1224, 1213, 1880, 675, 1223, 675, 1951, 1223, 333, 1951, 1224,
+        1383, 1223, 687, 709, 1213, 1224, 1322, 1322, 1383, 2001, 1224, 1332, 1322, 2073, 1223, 2094,
+        2001, 1322, 2094, 1383, 2073, 709, 1902, 1976, 1902, 2176, 1332, 1976, 2176, 2637, 324, 1976,
+        2399, 324, 347, 388, 2399, 1976, 388, 500, 2399, 1383, 500, 2752, 1974, 1951, 3033, 2399,
+        1974, 3033, 1951, 2637, 1974, 2752, 2637, 2094, 2303, 2752, 2001, 2637, 406, 2001, 2073, 2752,
+        2745, 2073, 2745, 406, 347, 445, 2094, 2745, 1272, 347, 1233, 2176, 2745, 1233, 2303, 406,
+        2176, 3033, 3033, 3143, 1234, 324, 3143, 1234, 1378, 3143, 388, 1365, 3143, 1387, 500, 1378,
+        1388, 1365, 445, 1398, 1941, 1387, 1936, 1941, 1388, 1272, 1972, 1398, 1942, 1365, 445, 1942,
+        1936, 1952, 1959, 2002, 1952, 464, 1234, 1972, 2014, 1972, 2002, 2053, 1272, 1936, 464, 2012,
+        2014, 1233, 2163, 2053, 2012, 1388, 1387, 2912, 1398, 2012, 2121, 2081, 1378, 1959, 2121, 2912,
+        1959, 2081, 2253, 2912, 2121, 2081, 2253, 2270, 2358, 2271, 2270, 1941, 2271, 2324, 1942, 2302,
+        2053, 2253, 2163, 2324, 2002, 2333, 2330, 2014, 1952, 2302, 2381, 2333, 2324, 2330, 2302, 2372,
+        2373, 2333, 2372, 2373, 2381, 2330, 2163, 2421, 2849, 2381, 2358, 2421, 2478, 2271, 245, 2358,
+        2441, 2421, 2442, 2441, 2493, 2442, 2478, 2493, 2494, 2502, 2503, 2494, 2502, 2503, 2270, 2478,
+        2569, 2630, 2663, 2651, 2663, 2630, 2651, 2569, 2771, 2630, 2849, 2856, 2823, 2857, 2856, 2849,
+        2857, 3149, 1889, 2569, 2442, 2771, 2372, 2373, 2823, 2771, 2910, 2503, 2494, 2953, 2910, 2914,
+        2953, 2823, 2910, 2914, 2663, 2919, 1889, 2441, 354, 2998, 2919, 2493, 2919, 2998, 2914, 2996,
+        2502, 2857, 3023, 2996, 3126, 3023, 3000, 2996, 301, 2998, 2651, 3000, 3035, 3035, 3126, 293,
+        3000, 3149, 2856, 301, 323, 3149, 334, 293, 336, 3126, 354, 416, 323, 387, 448, 485,
+        246, 495, 334, 336, 2953, 387, 416, 525, 487, 448, 485, 491, 495, 540, 532, 543,
+        3035, 487, 525, 549, 491, 553, 557, 543, 540, 3023, 532, 549, 560, 561, 557, 575,
+        579, 553, 588, 705, 648, 704, 561, 560, 695, 717, 575, 705, 579, 718, 588, 648,
+        704, 695, 725, 727, 1090, 717, 728, 729, 250, 718, 1102, 1105, 1117, 725, 727, 1090,
+        728, 729, 1102, 1120, 1105, 1135, 1117, 1138, 1140, 1141, 1151, 1144, 1149, 1120, 1135, 1176,
+        1138, 1140, 1156, 1151, 1178, 1141, 1144, 1149, 1190, 1176, 1156, 1193, 1194, 1208, 1221, 1178,
+        1216, 1225, 1193, 1230, 1190, 1228, 1231, 1208, 1194, 1216, 1228, 1229, 1247, 251, 1232, 1229,
+        1231, 1221, 1232, 1245, 1225, 1246, 1230, 1248, 1245, 1249, 1246, 1247, 1251, 1252, 1254, 1256,
+        1248, 1252, 1258, 1249, 1257, 1261, 1251, 1267, 1262, 1274, 1273, 1267, 1281, 1277, 1256, 1269,
+        1257, 1254, 1262, 1277, 1261, 1258, 1273, 1269, 1286, 1275, 1278, 1281, 1274, 1275, 1278, 1282,
+        1287, 1283, 1284, 1290, 1282, 1283, 1287, 1284, 1288, 1291, 1294, 1286, 1288, 1301, 1304, 1307,
+        1291, 1305, 1309, 1308, 1311, 1301, 1294, 1305, 1307, 1308, 1310, 1312, 1313, 252, 1310, 1309,
+        1314, 1304, 1315, 1311, 1290, 1315, 1312, 1316, 1321, 1314, 1323, 1316, 1325, 1321, 1323, 1313,
+        1327, 1328, 1329, 1330, 1325, 1344, 1329, 1331, 1333, 1340, 1344, 1352, 1343, 1348, 1328, 1327,
+        1343, 1331, 1333, 1346, 1354, 1348, 1330, 1353, 1346, 1354, 1340, 1353, 1355, 1356, 1352, 1357,
+        1355, 1360, 1358, 1357, 1362, 1362, 1368, 1366, 1367, 1369, 1370, 1360, 1373, 1372, 1370, 1375,
+        1376, 1368, 1376, 1377, 1356, 1358, 1366, 1367, 1369, 1372, 1379, 1827, 1888, 1878, 1881, 1373,
+        1884, 1379, 1882, 1881, 1377, 1878, 1375, 1882, 1885, 1884, 1892, 1893, 1891, 1894, 1895, 1888,
+        1885, 1891, 1896, 1898, 1892, 1897, 1894, 1893, 1904, 1827, 1903, 1905, 1908, 1909, 1906, 1905,
+        1910, 1911, 1913, 257, 1910, 1895, 1896, 1898, 1897, 1903, 1906, 1904, 1912, 1908, 1912, 1914,
+        1911, 1916, 1915, 1914, 1909, 1913, 1915, 1918, 1919, 1939, 1920, 1940, 1947, 1916, 1920, 1948,
+        1949, 1950, 1918, 1955, 1960, 1939, 1955, 1919, 1957, 1957, 1949, 1961, 1963, 1964, 1940, 1961,
+        1960, 1965, 1948, 1947, 1968, 1950, 1965, 1969, 1963, 1978, 1975, 1980, 1978, 1968, 1983, 1982,
+        1984, 1969, 1975, 1986, 1964, 1984, 1987, 1989, 1990, 1991, 1980, 1982, 1993, 1991, 1986, 1995,
+        1990, 1983, 1994, 1995, 1996, 1997, 1998, 2070, 1999, 1987, 2072, 1989, 1994, 1999, 2018, 1993,
+        2003, 2031, 1998, 1996, 2071, 2003, 2018, 2036, 2045, 2031, 2050, 2067, 1997, 2072, 2070, 2036,
+        2045, 2074, 2050, 2067, 2080, 2071, 2082, 2083, 2074, 2084, 2087, 2088, 2089, 2084, 2090, 2093,
+        2080, 2083, 2090, 2093, 2103, 2101, 2089, 2095, 2105, 2082, 2110, 2106, 2104, 2087, 2088, 2101,
+        2095, 2104, 2107, 2103, 2106, 2108, 2111, 2105, 2112, 2113, 2108, 2114, 2107, 2110, 2113, 2115,
+        2119, 2111, 2116, 2118, 2119, 2117, 2122, 2124, 2123, 2122, 2129, 2115, 2123, 2128, 2114, 2112,
+        2117, 2116, 2118, 2126, 2130, 2128, 2129, 2126, 2132, 2131, 2124, 2133, 2135, 2140, 2136, 2133,
+        2136, 2138, 2139, 2130, 2131, 2140, 2139, 2132, 2141, 2142, 2143, 2138, 2145, 2146, 2144, 2148,
+        2149, 2150, 2156, 2135, 2142, 2151, 2155, 2150, 2145, 2158, 2151, 2141, 2143, 2144, 2154, 2148,
+        2146, 2157, 2155, 2149, 2159, 2161, 2156, 2157, 2154, 2162, 2175, 2181, 2158, 2178, 2159, 2179,
+        2178, 2184, 2182, 2183, 2185, 2189, 2161, 2175, 2190, 2183, 2179, 2182, 2162, 2186, 2184, 2181,
+        2187, 2189, 2191, 2186, 2192, 2187, 2196, 2185, 2228, 2244, 2196, 2190, 2228, 2192, 2239, 2233,
+        2237, 2191, 2233, 2237, 2239, 2252, 2254, 2255, 2256, 2252, 2258, 2260, 2261, 2244, 2262, 2264,
+        2261, 2265, 2268, 2264, 2266, 2267, 2269, 2279, 2254, 2258, 2266, 2255, 2269, 2281, 2281, 2280,
+        2285, 2262, 2260, 2280, 2267, 2268, 2279, 2284, 2265, 2256, 2286, 2284, 2287, 2289, 2290, 2285,
+        2291, 2293, 2290, 2294, 2295, 2296, 2298, 2304, 2295, 2299, 2301, 2287, 2286, 2305, 2301, 2306,
+        2293, 2305, 2298, 2291, 2289, 2296, 2304, 2309, 2308, 2311, 2294, 2312, 2299, 2308, 2317, 2313,
+        2309, 2315, 2306, 2313, 2318, 2315, 2311, 2319, 2320, 2321, 2317, 2323, 2325, 2321, 2312, 2332,
+        2340, 2326, 2319, 2318, 2326, 2327, 2325, 2320, 2335, 2327, 2336, 2323, 2338, 2338, 2339, 2341,
+        2336, 2342, 2346, 2332, 2351, 2343, 2340, 2352, 2341, 2343, 2342, 2335, 2349, 2352, 2353, 2355,
+        2349, 2339, 2354, 2351, 2356, 2346, 2354, 2357, 2359, 2362, 2363, 2364, 2366, 2356, 2355, 2367,
+        2364, 2357, 2362, 2368, 2363, 2353, 2369, 2371, 2374, 2375, 2377, 2378, 2379, 2366, 2382, 2367,
+        2369, 2378, 2383, 2375, 2384, 2390, 2377, 2374, 2385, 2389, 2368, 2371, 2398, 2384, 2397, 2359,
+        2382, 2383, 2385, 2379, 2387, 2387, 2393, 2395, 2389, 2390, 2395, 2393, 2396, 2397, 2400, 2398,
+        2396, 2402, 2404, 2400, 2405, 2406, 2404, 2407, 2406, 2408, 2409, 2410, 2413, 2416, 2418, 262,
+        2413, 2410, 2418, 2419, 2402, 2423, 2423, 2427, 2419, 2407, 2405, 2408, 2425, 2409, 2422, 2429,
+        2416, 2426, 2422, 2425, 2426, 2428, 2431, 2433, 2428, 2434, 2427, 2435, 2436, 2438, 2437, 2439,
+        2440, 2454, 2429, 2437, 2455, 2457, 2458, 2435, 2459, 2460, 2431, 2436, 2458, 2438, 2433, 2434,
+        2455, 2461, 2439, 2463, 2440, 2464, 2461, 2459, 2454, 2465, 2466, 2457, 2460, 2470, 2472, 2463,
+        2474, 2481, 2483, 2475, 2477, 2479, 2482, 2472, 2464, 2475, 2477, 2484, 2488, 2479, 2484, 269,
+        2470, 2482, 2474, 2489, 2481, 2490, 2491, 2511, 2489, 2501, 2510, 2491, 2518, 2501, 2490, 2488,
+        2483, 2509, 2509, 2510, 2515, 2518, 2512, 2516, 2514, 2466, 2511, 2512, 2517, 2465, 2514, 2516,
+        2517, 2519, 2522, 2515, 2520, 2524, 2523, 2519, 2525, 2520, 2523, 2526, 2522, 2527, 2528, 2526,
+        2529, 2528, 2525, 2530, 2531, 2532, 2535, 2534, 2524, 2536, 2535, 2532, 2534, 2537, 2539, 2540,
+        2538, 2541, 2529, 2527, 2538, 2530, 2542, 2531, 2537, 2549, 2540, 2543, 2536, 2539, 2543, 2542,
+        2546, 2544, 2547, 2550, 2541, 2544, 2552, 2553, 2546, 2555, 2556, 2561, 2557, 2562, 2547, 2549,
+        2557, 2553, 2558, 2558, 2560, 2555, 2563, 2550, 2566, 2556, 2570, 2563, 2567, 2552, 2562, 2571,
+        2560, 2573, 2561, 2574, 2576, 2573, 2578, 2579, 2582, 2585, 2577, 2566, 2574, 2567, 2570, 2576,
+        2577, 2580, 2588, 2581, 2580, 2578, 2571, 2581, 2589, 2583, 2590, 2582, 2585, 2579, 2583, 2599,
+        2600, 2602, 2588, 2601, 2601, 2599, 2602, 2603, 2604, 2600, 2605, 2589, 2607, 2608, 2609, 2610,
+        2611, 2612, 2609, 2608, 2604, 2614, 2616, 2615, 2617, 2622, 2603, 2615, 2605, 2618, 2610, 2607,
+        2612, 2617, 2611, 2590, 2620, 2616, 2623, 2618, 2620, 2624, 2622, 2625, 2614, 2627, 2624, 2628,
+        2625, 2627, 2631, 2633, 2635, 2635, 2638, 2633, 2639, 2623, 2638, 2640, 2631, 2639, 2628, 2654,
+        2656, 2658, 2660, 2661, 2662, 2666, 2662, 2654, 2668, 2667, 2670, 2672, 2658, 2661, 2666, 2667,
+        2671, 2676, 2674, 2677, 2660, 2680, 2681, 2656, 2683, 2670, 2674, 2668, 2671, 2678, 2672, 2677,
+        2679, 2678, 2682, 2684, 2679, 2676, 2686, 2683, 2680, 2687, 2688, 2689, 2686, 2681, 2682, 2640,
+        2690, 2692, 2693, 2695, 2694, 2698, 2699, 2684, 2698, 2700, 2702, 2687, 2693, 2703, 2718, 2705,
+        2689, 2688, 2703, 2690, 2710, 2710, 2695, 2705, 2692, 2694, 2699, 2706, 2700, 2702, 2708, 2714,
+        2706, 2712, 2713, 2708, 2716, 2712, 2713, 2717, 2719, 2724, 2717, 2725, 2719, 2726, 2716, 2728,
+        2729, 2730, 2714, 2748, 2749, 2718, 2750, 2730, 2751, 2754, 2753, 2757, 2724, 2726, 2753, 2729,
+        2725, 2751, 2748, 2728, 2755, 2754, 2756, 2757, 2760, 2755, 2758, 2761, 2760, 2756, 2762, 2758,
+        2763, 2764, 2772, 2784, 2765, 2779, 2764, 2750, 2765, 2766, 2761, 2749, 2768, 2770, 2766, 2774,
+        2768, 2770, 2775, 2762, 2776, 2772, 2778, 2763, 2774, 2776, 2781, 2779, 2785, 2786, 2788, 2787,
+        2789, 2790, 2775, 2787, 2791, 2812, 2813, 2820, 2819, 2789, 2778, 2790, 2781, 2788, 2814, 2812,
+        2822, 2785, 2814, 2819, 2786, 2813, 2824, 2784, 2825, 2826, 2820, 2824, 2827, 2829, 2830, 2831,
+        2832, 2841, 2826, 2837, 2838, 2839, 2839, 2822, 2825, 2842, 2838, 2845, 2843, 2846, 2846, 2830,
+        2827, 2847, 2831, 2848, 2829, 2847, 2841, 2850, 2791, 2842, 2837, 2852, 2854, 2851, 2832, 2843,
+        2851, 2845, 2855, 2853, 2864, 2865, 2848, 2852, 2853, 2866, 2865, 2867, 2868, 2869, 2870, 2854,
+        2874, 2877, 271, 2864, 2871, 2868, 2855, 2869, 2875, 2871, 2880, 2873, 2866, 2875, 2850, 2873,
+        2867, 2878, 2870, 2874, 2878, 2879, 2877, 2881, 2882, 2883, 2883, 2884, 2880, 2885, 2882, 2886,
+        2881, 2879, 2890, 2885, 2891, 2892, 2893, 2892, 2894, 2902, 2891, 2903, 2905, 2913, 2894, 2906,
+        2907, 2908, 2884, 2886, 2920, 2890, 2916, 2903, 2915, 2893, 2907, 2911, 2905, 2917, 2906, 2918,
+        2902, 2913, 2908, 2911, 2915, 2916, 2921, 2922, 2923, 2917, 2921, 2920, 2927, 2924, 2918, 2929,
+        2930, 2923, 2931, 2932, 2929, 2927, 2922, 2924, 2933, 2930, 2934, 2936, 2940, 2937, 2934, 2938,
+        2932, 2939, 2940, 2938, 2943, 2936, 2944, 2931, 2945, 2946, 2939, 2933, 2937, 2943, 2948, 2949,
+        2982, 2950, 2951, 2945, 2955, 2944, 2955, 2962, 2969, 2981, 2962, 2969, 2946, 2983, 2984, 2981,
+        2986, 2982, 2988, 2949, 2950, 2948, 2951, 2983, 2989, 2990, 2991, 3002, 2988, 2999, 3001, 2984,
+        3004, 3003, 3001, 2986, 2990, 3003, 2999, 3008, 3005, 3007, 3012, 3015, 3008, 2991, 3015, 2989,
+        3005, 3007, 3002, 3016, 3018, 3017, 3019, 3004, 3018, 3016, 3020, 3024, 3021, 3026, 3028, 3025,
+        3164, 3164, 3028, 3020, 3029, 3019, 3021, 3024, 3025, 3029, 3034, 3012, 3017, 3034, 3026, 3038,
+        3039, 3058, 3055, 3038, 3061, 3062, 3063, 3058, 3064, 3039, 3055, 3065, 3069, 3070, 3065, 3072,
+        3062, 3064, 3066, 3061, 3071, 3069, 3066, 3073, 3085, 3063, 3071, 3087, 3085, 3089, 3070, 3090,
+        3103, 3104, 3073, 3089, 3105, 3106, 3072, 3110, 3106, 3109, 3087, 3103, 3107, 3105, 3090, 3111,
+        3107, 3112, 3109, 3113, 3104, 3111, 3115, 3116, 3110, 3117, 3119, 3120, 3121, 3117, 3113, 3119,
+        3122, 3115, 3123, 3127, 3128, 3131, 3116, 3130, 3112, 3132, 3133, 3121, 3122, 3120, 3132, 3133,
+        3134, 3137, 3135, 3138, 3136, 3123, 3127, 3135, 3128, 3136, 3130, 3141, 3131, 3138, 3142, 3144,
+        3137, 3144, 3146, 3147, 3148, 3150, 3157, 3134, 3156, 3160, 3168, 3159, 3161, 272, 3162, 3141,
+        3142, 3146, 3161, 3156, 3150, 3159, 3163, 3148, 3147, 3157, 3163, 3166, 3160, 3162, 3168, 3166,
+        3169, 3171, 3172, 3173, 3174, 3169, 3171, 3175, 3176, 3182, 3178, 3180, 3181, 3184, 3174, 3186,
+        3187, 3172, 3183, 3180, 3173, 3185, 3183, 3188, 3185, 3191, 3175, 3192, 3176, 3178, 3182, 3181,
+        3189, 3186, 3187, 3184, 3194, 3195, 3189, 3191, 3196, 3198, 3188, 3197, 3200, 3201, 3202, 3203,
+        3192, 3208, 3202, 3209, 3212, 3209, 3210, 3194, 3195, 3216, 278, 279, 3196, 3198, 3197, 3200,
+        3210, 3213, 3201, 3214, 3208, 3213, 3214, 3218, 3215, 280, 281, 3212, 3216, 3203, 3215, 282,
+        287, 304, 305, 314, 329, 339, 340, 341, 348, 351, 3218, 355, 362, 363, 367, 370,
+        374, 376, 377, 378, 379, 381, 382, 383, 384, 389, 390, 391, 395, 398, 401, 413,
+        425, 426, 431, 434, 436, 442, 446, 451, 452, 453, 457, 462, 469, 476, 477, 478,
+        479, 480, 481, 484, 490, 502, 503, 504, 509, 516, 517, 518, 519, 520, 522, 523,
+        528, 530, 534, 535, 536, 537, 548, 551, 559, 564, 565, 566, 567, 569, 570, 571,
+        572, 574, 580, 584, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600,
+        601, 603, 604, 605, 606, 607, 608, 611, 612, 613, 614, 617, 618, 620, 621, 622,
+        623, 624, 625, 627, 628, 630, 631, 632, 633, 635, 636, 637, 638, 639, 640, 641,
+        643, 644, 645, 646, 649, 650, 651, 652, 653, 654, 655, 656, 657, 659, 660, 661,
+        663, 665, 666, 667, 668, 669, 670, 671, 674, 678, 679, 680, 681, 682, 683, 684,
+        685, 688, 689, 690, 693, 698, 699, 700, 701, 706, 708, 710, 712, 713, 714, 715,
+        719, 720, 721, 722, 724, 726, 734, 735, 736, 742, 751, 760, 765, 774, 798, 804,
+        808, 814, 817, 848, 853, 857, 861, 864, 873, 908, 912, 919, 922, 927, 958, 965,
+        971, 976, 983, 988, 1023, 1027, 1028, 1030, 1034, 1038, 1046, 1086, 1092, 1097, 1099, 1100,
+        1101, 1104, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1128, 1142, 1147, 1154, 1159,
+        1161, 1167, 1169, 1170, 1171, 1172, 1173, 1174, 1182, 1183, 1187, 1188, 1192, 1195, 1207, 1209,
+        1212, 1219, 1220, 1222, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1250, 1253, 1259,
+        1263, 1265, 1271, 1279, 1280, 1285, 1289, 1295, 1296, 1297, 1298, 1299, 1302, 1306, 1317, 1324,
+        1326, 1335, 1336, 1337, 1338, 1341, 1342, 1345, 1347, 1350, 1351, 1359, 1363, 1371, 1374, 1385,
+        1391, 1392, 1394, 1395, 1400, 1401, 1413, 1418, 1429, 1458, 1461, 1465, 1466, 1469, 1473, 1474,
+        1477, 1480, 1482, 1485, 1486, 1488, 1491, 1495, 1496, 1498, 1502, 1504, 1507, 1508, 1510, 1519,
+        1524, 1535, 1556, 1558, 1561, 1562, 1564, 1567, 1569, 1572, 1573, 1575, 1578, 1582, 1583, 1585,
+        1589, 1591, 1594, 1595, 1597, 1606, 1611, 1622, 1635, 1637, 1640, 1641, 1643, 1646, 1650, 1651,
+        1653, 1657, 1659, 1662, 1663, 1665, 1674, 1679, 1695, 1699, 1700, 1702, 1706, 1708, 1711, 1712,
+        1714, 1718, 1725, 1738, 1740, 1743, 1744, 1746, 1752, 1765, 1776, 1777, 1785, 1813, 1816, 1817,
+        1819, 1821, 1823, 1825, 1833, 1840, 1849, 1873, 1877, 1887, 1890, 1899, 1900, 1907, 1917, 1921,
+        1922, 1923, 1924, 1925, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1938, 1943, 1944, 1954,
+        1958, 1962, 1966, 1967, 1970, 1971, 1973, 1985, 1988, 1992, 2000, 2007, 2008, 2009, 2010, 2011,
+        2013, 2015, 2016, 2017, 2021, 2023, 2024, 2025, 2027, 2028, 2029, 2030, 2035, 2040, 2041, 2042,
+        2043, 2044, 2048, 2049, 2054, 2055, 2058, 2059, 2060, 2062, 2063, 2065, 2066, 2075, 2076, 2077,
+        2078, 2079, 2085, 2086, 2091, 2097, 2098, 2099, 2102, 2109, 2120, 2125, 2127, 2134, 2137, 2147,
+        2152, 2160, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2188, 2193, 2194, 2195,
+        2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2206, 2207, 2209, 2210, 2211, 2212, 2214, 2215,
+        2216, 2217, 2218, 2219, 2220, 2221, 2223, 2224, 2225, 2227, 2229, 2230, 2231, 2232, 2235, 2236,
+        2240, 2241, 2243, 2245, 2246, 2247, 2248, 2249, 2257, 2263, 2272, 2273, 2274, 2275, 2276, 2282,
+        2297, 2300, 2307, 2314, 2316, 2322, 2328, 2329, 2334, 2337, 2344, 2345, 2348, 2350, 2360, 2365,
+        2376, 2380, 2386, 2388, 2391, 2392, 2411, 2420, 2424, 2430, 2432, 2443, 2444, 2445, 2446, 2447,
+        2448, 2449, 2450, 2451, 2452, 2456, 2462, 2467, 2468, 2471, 2473, 2480, 2485, 2486, 2487, 2492,
+        2495, 2496, 2497, 2498, 2499, 2504, 2505, 2506, 2521, 2533, 2545, 2551, 2554, 2559, 2564, 2565,
+        2568, 2575, 2584, 2586, 2591, 2592, 2593, 2594, 2595, 2596, 2598, 2619, 2621, 2626, 2632, 2634,
+        2636, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2653, 2655, 2659, 2664, 2665, 2669,
+        2673, 2675, 2685, 2691, 2696, 2697, 2701, 2704, 2707, 2709, 2711, 2720, 2721, 2722, 2727, 2731,
+        2747, 2759, 2767, 2769, 2773, 2777, 2780, 2782, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799,
+        2800, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2815, 2816, 2817, 2821, 2828, 2834,
+        2835, 2840, 2844, 2858, 2859, 2860, 2861, 2862, 2872, 2876, 2887, 2889, 2895, 2896, 2897, 2898,
+        2899, 2900, 2904, 2909, 2925, 2926, 2928, 2935, 2941, 2942, 2947, 2952, 2956, 2957, 2958, 2959,
+        2960, 2961, 2963, 2964, 2965, 2966, 2967, 2968, 2970, 2971, 2972, 2973, 2974, 2975, 2977, 2978,
+        2979, 2985, 2987, 2992, 3006, 3009, 3011, 3014, 3022, 3027, 3030, 3032, 3036, 3037, 3040, 3041,
+        3042, 3043, 3044, 3045, 3046, 3048, 3049, 3050, 3051, 3052, 3067, 3076, 3077, 3078, 3079, 3080,
+        3081, 3082, 3093, 3095, 3096, 3097, 3098, 3099, 3100, 3108, 3118, 3124, 3125, 3129, 3139, 3140,
+        3145, 3151, 3152, 3153, 3154, 3158, 3165, 3167, 3170, 3177, 3179, 3190, 3193, 3199, 3205, 3206,
+        3211, 3217, 3219, 3220, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+};
+
+static const short yy_start_state[10] = {
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+};
+
+// Start states of the head and the tail of rules with trailing context
+static const short yy_trailing_head[442] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0,
+        0, 0,
+};
+
+static const short yy_trailing_tail[442] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0,
+        0, 0,
+};
+
+struct yy_buffer_state {
+        FILE *file;
+        char *buf;
+        size_t len;
+        size_t size;
+        size_t pos;
+};
+
+char *yytext = NULL;
+int yyleng = 0;
+FILE *yyin = NULL, *yyout = NULL;
 
-        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9
-    } ;
+static char yy_empty[1];
+static char *yy_hold_pos = NULL;
+static char yy_hold_char;
+static size_t yy_token_start = 0;
 
-static const YY_CHAR yy_meta[91] =
-    {   0,
-        1,    2,    3,    4,    5,    6,    7,    8,    9,   10,
-       11,   12,   12,   13,   14,   13,   15,   16,   17,   17,
-       17,   17,   17,   17,   17,   17,   18,   12,   19,    9,
-       19,   20,   21,   22,   22,   22,   22,   22,   22,   23,
-       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
-       23,   23,   23,   23,   23,   23,   23,   23,   23,   24,
-        9,   25,   22,   22,   22,   22,   22,   22,   23,   23,
-       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
-       23,   23,   23,   23,   23,   23,   23,   23,   26,   27
-    } ;
 
-static const flex_int16_t yy_base[2911] =
-    {   0,
-        0,    0,   89,   99,  110,  200,  290,  380,  470,  560,
-      650,  740,  830,  920, 1009, 1034,  127,  154,  142,  168,
-     3722,18566,  181,18566, 3682,   90, 1060,  101,18566,   87,
-      191,  102, 1143,  215,  226,  234, 3646,  131,  135,  244,
-     1215, 1282, 1352, 1422, 1492, 1562, 1633, 1682, 1731,  272,
-      273, 1780, 1829,  294, 1883, 1932,  362, 1981, 2035, 2086,
-      363,  385,  157,    0,  122,18566,  193,18566,  215,  360,
-      505,    0,    0,    0,  509,  227,18566,    0,    0,    0,
-     3639,  260, 3606,  264,  326, 2167,  414,  259,  549, 2257,
-    18566,18566,    0,  145,  186,18566,    0,18566,18566,    0,
+static inline int yy_next(int state, unsigned char c) {
+        int k = yy_ec[c];
+        while (yy_chk[yy_base[state] + k] != state)
+                state = yy_def[state];
+        return yy_nxt[yy_base[state] + k];
+}
 
-        0,    0,18566,  329,  341,  470, 3570,  523,18566,  596,
-      453,18566,18566,    0,  131,  307,  265,  600,18566, 3587,
-    18566,   92,  160,18566, 2347, 2437, 2527, 2617,  271, 3516,
-        0, 3524,18566,  173,  562,  361,  305, 3490,  334,  521,
-     2700,  342,  610, 2772,  640,  650,  665, 3491, 2823,  335,
-      341,  387, 3464,  673,  694,  481,  205,  264,  281,    0,
-      379,  349,  564,  757,  371,  384,  829,  767,  666,  437,
-      822,  674,  451,  581,  487,  520, 2875,  823,  544,  565,
-      667,  569,  876,  626,  667,  649,  664,  684,  831,  902,
-      721,  673,  727,  688,  719, 3467, 3464,  719,  834,  733,
 
-      903,    0,  744,  764,  823,  762,  813,  827,    0,  820,
-      845,  923,  827,    0, 3441,  845,  839,  834,  853,  876,
-      915,  886,  916,    0, 1027, 3429, 3400, 1043,  907,  897,
-     1031,  911,    0,  930,  925,  939,  933, 1047,  947,    0,
-      960,  972, 1038,  956, 1049, 1196,  966, 1069, 1194,  977,
-      974, 1089, 1016, 2929, 1224, 1033, 1212, 1056, 1272, 1056,
-     1055, 1216, 1268, 1280, 1283, 1083, 1075, 1193, 1200, 1204,
-     1286, 1210, 1209, 1263, 1264, 1273, 1274, 1288, 1284, 1282,
-     1287, 1341, 1288, 1283, 1333, 1336, 1338, 1327, 1340,    0,
-      636,  757,  817, 3394,    0,18566, 1439, 1469, 1499, 1517,
+/* Put back the character which was replaced by the yytext terminator */
+static void yy_restore(void) {
+        if (yy_hold_pos) {
+                *yy_hold_pos = yy_hold_char;
+                yy_hold_pos = NULL;
+        }
+}
 
-     1549, 1443, 1579, 1593, 3396,    0, 3385, 1661,  801, 3387,
-        0, 3326, 3306,    0, 1372, 1038, 1459, 1491,    0, 3011,
-     3101, 1540, 1555,    0, 3281, 1717, 1566, 1614,    0, 3191,
-     3281,    0, 1422,    0, 3284,    0, 3259, 1134, 1139, 1387,
-     1766, 3241,18566, 1675, 1825,    0, 1529, 1624, 1748, 1821,
-        0,  175,  806, 3252,  997, 3238,  456,18566,  546, 3371,
-     3461, 3551, 3641, 3204,    0,  313,18566, 1416, 1508, 3191,
-     3163, 1967, 2122, 2183, 2198, 1919, 3724, 2213, 3116, 3079,
-     3795, 3077, 2167, 3847, 2221, 2229, 1686, 2257, 2273, 3899,
-     2283, 1408, 1561, 1342, 1683, 1343, 1686, 1641, 1724,  506,
 
-     1778, 1740, 1345, 1818, 2303, 1577, 1676, 1797, 1823, 1827,
-     1395, 1828, 1651, 1838, 1435, 1844, 1887, 1877, 2033, 1931,
-     1927, 1933, 1975, 2370, 1893, 1925, 2398, 1979, 1940, 2023,
-     2036, 1989, 2032, 1353, 1836, 2047, 1983, 1990, 2053, 2050,
-     2274, 2290, 2094, 2434, 2327, 2335, 2326, 1514, 2343, 2358,
-     2421, 1559, 2082, 1620, 1652, 2342, 1685, 2426, 2433, 2429,
-     1702, 2435, 2130, 2078, 2431, 2432, 1732, 2436, 2437, 2440,
-     2482, 2451, 2494, 2452, 2507, 1779, 2528, 2501, 2504, 2514,
-     2520, 2506, 1819, 2294, 2524, 2526, 2565, 2529, 2571, 2570,
-     2569, 2614, 1876, 2604, 2615, 2601, 2273, 2610, 2606, 2614,
+static void yy_set_text(YY_BUFFER_STATE b, size_t start, size_t length) {
+        yytext = b->buf + start;
+        yyleng = (int)length;
+        yy_hold_pos = yytext + length;
+        yy_hold_char = *yy_hold_pos;
+        *yy_hold_pos = 0;
+}
 
-     2620, 2781, 2626, 2617, 2623, 2814, 2748, 2784, 2634, 2629,
-     2835, 2861, 2867, 2357, 2837, 2865, 2873, 2868, 1891, 2447,
-     2758, 2870, 2341, 2882, 2889, 2917, 2878, 2761, 2916, 2874,
-     2963, 2990, 2993, 2001, 2932, 2994, 3011, 2929, 2042, 2085,
-     3012, 2220, 3013, 2919, 3015, 3018, 3049, 3079, 2995, 3093,
-     3028, 3100, 3081, 2259, 3010, 3083, 3098, 2295, 3101, 3104,
-     3046, 3189, 3111, 2515, 3264, 3159, 3109, 2782, 3143, 2631,
-     3184, 3171, 3175, 3186, 3190, 3187, 3201, 3233, 3236, 3231,
-     2938, 3282, 3263, 3085, 3106, 3275, 3278, 3280, 3117, 3118,
-     3281, 3287, 3289, 3169, 3314, 3185, 3326, 3205, 3338, 3321,
 
-     3347,18566,18566, 3074,18566, 3048, 3011, 3384, 3970, 3398,
-    18566, 3412, 3004, 4060, 2931, 2958,18566,18566, 1416,    0,
-        0, 3419, 2982, 3475, 2926,    0,18566,    0,18566, 3420,
-     3425, 3491, 3506, 3548, 3566, 3581, 3596, 3298,18566, 2844,
-     2800, 4134, 3521, 3605, 2793, 3638, 3656, 3664, 4185, 3672,
-     3684, 3694,    0,  558, 2801,    0, 3875, 3962, 3784, 3886,
-     3365, 3386, 3785, 3208, 3276, 3838, 3399, 3971, 3963, 3412,
-     3782, 3465, 3538, 3949, 3954, 3898, 3965, 3964, 3980, 3986,
-     4012, 3322, 4028, 3494, 4249, 4013, 4044, 4043, 4059, 4060,
-     4058, 3372, 3413, 4053, 4061, 4062, 4070, 3449, 3450, 3566,
+/* Read the rest of yyin into the buffer, the consumed data are dropped */
+static void yy_fill(YY_BUFFER_STATE b) {
+        b->len = b->pos = 0;
+        if (! yyin)
+                return;
+        size_t n;
+        while ((n = fread(b->buf + b->len, 1, b->size - b->len, yyin)) > 0) {
+                b->len += n;
+                if (b->len == b->size) {
+                        b->size *= 2;
+                        if (! (b->buf = realloc(b->buf, b->size + 1))) {
+                                fprintf(stderr, "out of dynamic memory in yy_fill()\n");
+                                exit(2);
+                        }
+                }
+        }
+        b->buf[b->len] = 0;
+}
 
-     3805, 3568, 3594, 4071, 4120, 3628, 4143, 4105, 4173, 4175,
-     4190, 4142, 4197, 4194, 3629, 3630, 3966, 4195,  577, 4199,
-     4200, 4227, 4233, 3681, 4236, 4239, 4279, 3783, 4243, 4066,
-     4271, 4282, 3806, 4205, 4266, 4284, 4296, 3807, 3858,  609,
-     4305, 4298, 4304, 4122, 3859, 4301, 3889, 3967, 4315, 3985,
-     3987, 4306, 4317, 4332, 4342,  730, 4347, 4329, 4353, 4357,
-     4359, 4124, 4352, 4203, 4231, 4354, 4364, 4356, 4257, 4337,
-     4372, 4387, 4367, 4389, 4374, 4379, 4395, 4413, 4437, 4406,
-     4407, 4411, 4409, 4422, 4425, 4423, 4412, 4430, 4457, 4485,
-     4432, 4437, 4467, 4468, 4465, 4469, 4470, 4495, 4473, 4474,
 
-     4480, 4475, 4481, 4483, 4505, 4484, 4491, 4533, 4515, 4511,
-     4522, 4529, 4525, 4535, 4526, 4541, 4531, 4553, 4547, 4569,
-     4573, 4575, 4578, 4581, 4579, 4580, 4589, 4586, 4587, 4595,
-     4601, 4597, 4611, 4623, 4603, 4635, 4605, 4676, 4625, 4663,
-     4638, 4645, 4717, 4659, 4665, 4631, 4669, 4685, 4658, 4644,
-     4647, 4683, 4711, 4696, 4713, 4715, 4693, 4709, 4716, 4734,
-     4723, 4733, 4736, 4739, 4754, 4764, 4730, 4769, 4767, 4771,
-     4779,18566,    0,    0,    0,18566, 1632,18566, 2413, 2193,
-      731, 3870, 4832, 4847, 4862, 2778, 2701, 4916, 4967, 3816,
-     3928, 4872,    0,  791, 2696,    0, 4886, 2693, 4896, 4906,
+YY_BUFFER_STATE yy_create_buffer(FILE *file, int size) {
+        YY_BUFFER_STATE b = calloc(1, sizeof(*b));
+        if (! b || ! (b->buf = malloc((size_t)size + 1))) {
+                fprintf(stderr, "out of dynamic memory in yy_create_buffer()\n");
+                exit(2);
+        }
+        b->file = file;
+        b->size = (size_t)size;
+        return b;
+}
 
-     4939, 5018, 4947, 5070, 4988, 4996, 2846, 2687,    0, 2684,
-     5058, 4953, 4792, 5059, 4751, 5060, 4907, 4760, 5078, 4774,
-     4776, 5004, 5061, 4819, 5072, 4791, 4957, 5079, 5080, 5121,
-     5077, 5104, 5110, 5114, 5111, 5116, 5005, 5124, 5120, 4832,
-     4862,    0,18566, 4892, 4913, 4906, 5130, 4945, 4964, 5137,
-     5130, 5006, 5007, 5128, 5163, 5169, 5027, 5176, 5174, 5178,
-     5173, 5184, 5028, 5181, 5119, 2876,18566, 5183, 5185, 5188,
-     5132, 5193, 5196, 5221, 5230, 3433, 5231, 5216, 5236, 5238,
-     5277, 5239, 5249, 5190, 5243, 5246, 5243, 5244, 5251, 5257,
-     5254, 5274, 5279, 5285, 5287, 5266, 5288, 5293, 5294, 5292,
 
-     5296, 5297, 5299, 5301, 5311, 5352, 5335, 5329, 5310, 5337,
-     5347, 5348, 5351, 5352, 5359, 5345, 5357, 5362, 5356, 5370,
-     5387, 5369, 5390, 5395, 5389, 5403, 5393, 5405, 5393, 5408,
-     5407, 5409, 5410, 5423, 5425, 5431, 5445, 5448, 5447, 3491,
-    18566, 5463, 5462, 5451, 5468, 5417, 5458, 5472, 5464, 5466,
-     5486, 5470, 5489, 5485, 5478, 5483, 5525, 5506, 5509, 5503,
-     5513, 5519, 5525, 5522, 5547, 5526, 5528, 5543, 5529, 5545,
-     5539, 5564, 5546, 5567, 5544, 5563, 5569, 5577, 5580, 5583,
-     5582, 5586, 5587, 5589, 5588, 5591, 5590, 5597, 5601, 5602,
-     5673, 5622, 5629, 5681,18566, 5687, 5625, 5603, 5666, 5656,
+void yy_switch_to_buffer(YY_BUFFER_STATE b) {
+        yy_restore();
+        yy_current_buffer = b;
+        if (b)
+                yyin = b->file;
+}
 
-     5667, 5642, 5672, 5674, 5691, 5687, 5700, 5743, 5730, 5677,
-     5690, 5731, 5736, 5698, 5718, 5725, 5733, 5735, 5738, 5737,
-     5748, 5741, 5745, 5749, 2981,  790,  970, 3704, 5039, 5810,
-     5825, 5840, 2652, 2622, 2599, 5857, 5846, 5878, 5866, 5888,
-     5908, 5929, 5960, 5937, 5981, 5917, 2584,    0, 2577,18566,
-     5989, 6012, 6022, 6032, 6039, 6049, 6059, 6068, 6077, 6098,
-     6106, 6129,    0, 1122, 2567, 6105, 5750, 5752, 6114, 6116,
-     5950, 5782, 6115, 6119, 5768, 6118, 5769, 6120, 5783, 6135,
-     6167, 6237, 6124, 5951, 6122, 5784, 6139, 6067, 6152, 5948,
-     6163, 6166, 5957, 6068, 6056, 6072, 6124, 6144, 6170, 6208,
 
-     6219, 6172, 6173, 6176, 6178, 6183, 6258, 6214, 6186, 6216,
-     6222, 6226, 6224, 6198, 6235, 6230, 6260, 6211, 6269, 6256,
-      407, 6262, 6275, 6278, 6279,  449, 6292, 6296, 6229, 6277,
-     6280, 6283, 6314, 6293, 6305, 6302, 6332, 6316, 6324, 6326,
-     6320, 6338, 6337, 6330, 6366, 6342, 6340, 6358, 6346, 6368,
-     6374, 6348, 6382, 6352, 6388, 6376, 6354, 6391, 6427, 6400,
-     6370, 6394, 6404, 6410, 6409, 6425, 6399, 6426, 6428, 6412,
-     6430, 6416, 6461, 6431, 6453, 6443, 6444, 6462, 6446, 6466,
-     6464, 6480, 6479, 6470, 6484, 6486, 6468, 6519, 6498, 6502,
-     6520, 6489, 6523, 6504, 6547, 6507, 6526, 6534, 6532, 6525,
+void yy_delete_buffer(YY_BUFFER_STATE b) {
+        if (! b)
+                return;
+        yy_restore();
+        if (b == yy_current_buffer)
+                yy_current_buffer = NULL;
+        free(b->buf);
+        free(b);
+}
 
-     6535, 6541, 6539, 6556, 6544, 6562, 6578, 6547, 6550, 6555,
-     6585, 6584, 6637,18566, 6648, 6583, 6586, 6592, 6593, 6601,
-     3179, 6595, 4290, 6614, 6605, 6616, 6631, 6617, 6618, 6628,
-     6637, 6632, 6640, 6662, 6635, 6636, 6641, 6659, 6652, 6672,
-     6684, 6674, 6679, 6648, 6686, 6667, 6689, 6695, 6698, 6676,
-     6706, 3408, 1458, 1569, 1798, 6760, 6776, 6792, 6808, 2517,
-     2498, 6824, 6875, 6845, 6853, 6898,    0, 1128, 2482,    0,
-     6907, 6926, 6936, 6946, 6967, 6975, 6998,    0, 1346, 2452,
-     2414, 7008, 7018, 7028, 7036, 2410, 7046, 7056, 7066, 7075,
-     7096, 7127, 7104, 7148, 5945, 2392,    0, 2386, 6676, 6732,
 
-     6693, 6809, 6756, 7133, 6720, 6721, 6813, 7118, 7141, 6733,
-     6723, 6764, 6815, 6765, 6808, 6868, 6856, 6850, 6932, 7061,
-     6933, 6934, 7139, 7117, 7136, 6935, 7062, 7065, 7054, 7070,
-     7118, 7105, 7145, 1127,18566, 7196, 1495,18566, 7146, 1510,
-     1721,18566, 7145, 7161, 7158, 7160, 7211, 7212, 7216, 7180,
-     7182, 7215, 7197, 7238, 7192, 7194, 7208, 7218, 7205, 7195,
-     7219, 7227, 7202, 7240, 7253, 7222, 7250, 7251, 7266, 7263,
-     7252, 7255, 7274, 7260, 7302, 7275, 7276, 7302, 7283, 7308,
-     7309, 7298, 7314, 7288, 7313, 7315, 7326, 7308, 7320, 7321,
-     7322, 7334, 7324, 7319, 7356, 7341, 7354, 7329, 7387, 7364,
+void yyrestart(FILE *file) {
+        if (! yy_current_buffer)
+                yy_current_buffer = yy_create_buffer(file, YY_BUF_SIZE);
+        yy_restore();
+        yy_current_buffer->file = yyin = file;
+        yy_current_buffer->len = yy_current_buffer->pos = 0;
+}
 
-     7365, 7390, 7346, 7372, 7371, 7373, 7379, 7380, 7382, 7391,
-     7412, 7404, 7392, 7432, 7387, 7422, 7425, 7427, 7454, 7438,
-     7437, 7450, 7518, 7399, 7430, 7457, 7448, 7462, 7492, 7461,
-     7476, 7480, 7491, 7485, 3591, 7479, 4822, 7494, 7504, 7507,
-     7509, 7487, 7526, 7519, 7531, 7534, 7542, 7508, 7520, 7546,
-     7528, 7547, 7556, 7561, 7567, 7570, 7578, 7566, 7551, 7552,
-     7586, 7577, 3630, 7639, 7654, 7670, 7686, 7702, 7718, 2361,
-     2359, 2308, 7735, 7756, 7764, 7647, 7787, 7796, 7817, 7848,
-     7825, 7869, 7662, 2316,    0, 2314, 7899, 7877, 7951, 7920,
-     7928, 7678, 2304,    0, 2250, 7972, 7982, 8003, 8013, 8019,
 
-     8029, 8039, 8049, 8056, 8066, 8076, 8085, 8094, 8115, 8123,
-     8146,    0, 1598, 2208, 7583, 8165, 8220, 7712, 7679, 7724,
-     7587, 7790, 7722, 7712, 7717, 8139, 7773, 7773, 7779, 7776,
-     7813, 7837, 7838, 8136, 8141, 7888, 8137, 7840, 7826, 7886,
-     1829, 7887, 7886, 7894, 2023, 2146, 8194, 8088, 7908, 8150,
-     7941, 7943, 7931, 8147, 8085, 8086, 8125, 8152, 8193, 8203,
-     8172, 8218, 8171, 8175, 8225, 8204, 8227, 8229, 8206, 8231,
-      218, 1433, 8215, 8243, 8240, 8236, 8251, 8273, 8261, 2122,
-     8262, 8264, 8263, 8267, 8272, 8255, 8275, 8276, 8281, 1802,
-     8277, 8283, 8282, 8284, 8308, 8320, 8331, 8316, 8294, 8321,
+static void yyunput(int c) {
+        YY_BUFFER_STATE b = yy_current_buffer;
+        yy_restore();
+        if (b->pos == 0) {
+                if (b->len + 1 >= b->size) {
+                        b->size *= 2;
+                        if (! (b->buf = realloc(b->buf, b->size + 1))) {
+                                fprintf(stderr, "out of dynamic memory in yyunput()\n");
+                                exit(2);
+                        }
+                }
+                memmove(b->buf + 1, b->buf, b->len + 1);
+                b->len++;
+                b->pos = 1;
+        }
+        b->buf[--b->pos] = (char)c;
+}
 
-     8298, 8344, 8328, 8332, 8329, 8333, 2566, 8336, 8340, 8335,
-     8408,18566, 8389, 8366, 8351, 8379, 8375, 8356, 8387, 8391,
-     8363, 8390, 8397, 8381, 8402, 8394, 8392, 8402, 8432, 8436,
-     8438, 8411, 8428, 8439, 2073, 8444, 8414, 8445, 8406, 8417,
-     8446, 8449, 8452, 8460, 8454, 8456, 8476, 8479, 3841, 2007,
-     1989, 1967, 8544, 8595, 8529, 8565, 8575,    0, 2287, 1932,
-        0, 8617, 8627, 8646, 8656, 8677, 8685, 8708,    0, 2330,
-     1920, 8717, 8727, 8737, 8747, 8768, 8776, 8799,    0, 2400,
-     1906, 8808, 8817, 8826, 8835, 1897, 8845, 8855, 8865, 1841,
-     8875, 8885, 8895, 8904, 8925, 8956, 8933, 8977, 8514, 1837,
 
-        0, 1824, 8452, 9017, 8508, 9075, 8494, 8521, 8456, 8501,
-     8538, 8529, 8588, 8574, 8572, 8648, 8632, 8961, 8634, 8975,
-     8723, 8885, 9003, 9004, 8636, 2546,18566, 8638, 2577, 8731,
-      437, 8985,  601, 8726, 9015, 8734, 9020, 8993, 9018, 9043,
-     8987, 9048, 8882, 8742, 9063, 8883, 9064, 8988, 8884, 2691,
-     9107, 9108, 9100, 9071, 9066, 9045,    0, 1805, 9094, 9088,
-     8914, 9096, 8935,18566, 9110, 8960, 9103, 9106, 9132, 9108,
-     9120, 1938, 9112, 1533, 9115, 9142, 3903, 9122, 9201, 9133,
-     9146, 9152, 9163, 9159, 9136, 9167, 9164, 9166, 9175, 9184,
-     9184, 9173, 9179, 9184, 9182, 9184, 9204, 9185,    0, 1775,
+static void yy_less(int n) {
+        yy_restore();
+        yy_current_buffer->pos = yy_token_start + (size_t)n;
+        yy_set_text(yy_current_buffer, yy_token_start, (size_t)n);
+}
 
-     9191, 9194,18566, 9202, 9206, 9217, 9200, 9210, 9219, 3940,
-     1754, 1675, 1668, 9284, 9305, 9313, 9273, 9336, 9345, 9366,
-     9397, 9374, 9418, 9293, 1610,    0, 1595, 9448, 9426, 9500,
-     9469, 9477, 9321, 1548,    0, 1500, 9551, 9521, 9603, 9529,
-     9572, 9354, 1496,    0, 1479, 9581, 9625, 9634, 9654, 9662,
-     9672, 9682, 9692, 9698, 9708, 9718, 9728, 9735, 9745, 9755,
-     9764, 9773, 9794, 9802, 9825,    0, 2495, 1466, 9363, 9844,
-     9826, 9904, 9391, 9388, 9389, 9392, 9393,18566, 9424,18566,
-     9429, 9440, 9428, 9442, 9439, 9462,    0,    0, 2815,18566,
-     9486, 9479, 9480, 2869,18566, 2871, 9479, 1659, 9487,    0,
 
-    18566,    0, 9541, 9527, 9532, 9536,    0, 9532, 9531, 9590,
-     9850,18566, 9851, 9852, 9873,18566, 9867, 9850,    0,    0,
-        0, 9596, 9586, 9597, 9598, 9897, 1450,    0,    0, 9882,
-     9752, 9764, 1676,    0, 9761, 9756, 9765, 9768,    0,    0,
-     9831, 9823, 9843, 9845, 9850,18566, 9849,    0, 9890, 9874,
-     9905, 9894, 9888,    0, 9891, 9885,    0, 9956, 1404, 1398,
-     9961,10012, 9982, 9990,10035,    0, 2589, 1381,    0,10044,
-    10063,10073,10083,10104,10112,10135,    0, 2904, 1364,10144,
-    10154,10164,10174,10195,10203,10226,    0, 3475, 1351,10235,
-    10245,10255,10265,10286,10294,10317,    0, 3493, 1253,10326,
+/* Length of the head of a match of a rule with trailing context: the longest prefix matched by the head which leaves a suffix matched by the tail */
+static size_t yy_trailing(int rule, const char *text, size_t length) {
+        size_t head = length;
+        int state = yy_trailing_head[rule];
+        for (size_t i = 0; state; i++) {
+                if (yy_accept[state]) {
+                        int tail = yy_trailing_tail[rule];
+                        for (size_t j = i; tail && j < length; j++)
+                                tail = yy_next(tail, (unsigned char)text[j]);
+                        if (tail && yy_accept[tail])
+                                head = i;
+                }
+                if (i == length)
+                        break;
+                state = yy_next(state, (unsigned char)text[i]);
+        }
+        return head;
+}
 
-    10335,10344,10353,10362, 1236,10372,10382,10392, 1216,10402,
-    10412,10422,10431,10452,10483,10460,10504, 9383, 1141,    0,
-     1117, 9892,10544,10524,10617, 9892, 9894, 9909, 9906, 9904,
-     9938, 9938, 9958, 9947, 9941,10490,10007, 2971, 3439, 9991,
-    18566,10060,10481, 9992,10512,10060,10502,10533,10554,18566,
-    10526, 3722,10067, 3723,10068, 2572,10150,10534,10064,10245,
-     3057,10581,10151,10411,10153,10167,10243,10540,10407,10257,
-    10244,10556,18566,10428,10536,10410,10465,10635,10460,10457,
-    10503,10649,18566, 1095, 1065,10699,10751,10661,10670,10652,
-    10681,10802,10689,10854,10720,10728,10708,  965,    0,  932,
 
-    10905,10772,10957,10780,10823,10736,  925,    0,  919,11008,
-    10831,11060,10875,10883,10760,  901,    0,  875,11111,10926,
-    11163,10934,10978,10788,  795,    0,  741,10987,11030,11039,
-    11082,11090,11134,11144,11186,11192,11215,11225,11235,11242,
-    11252,11262,11271,11280,11301,11309,11332,    0, 3534,  732,
-    10517,11351,11333,11426,10537,18566,10543,10540,10557,10560,
-    10582,18566,10630,10792,10793, 3893,18566, 3990,18566,10794,
-    11323,11156,11326, 4177,11332,10844, 4274,10786, 4736, 4823,
-    10796,11157,10782,11333,11355,11336,11338,10820,10832,10899,
-    11356,10846,18566,10896,10889,11422,10898,11306,11443,18566,
+int yylex(void) {
+        if (! yyout)
+                yyout = stdout;
+        if (! yy_current_buffer)
+                yy_current_buffer = yy_create_buffer(yyin, YY_BUF_SIZE);
+        for (;;) {
+                yy_restore();
+                YY_BUFFER_STATE yy_b = yy_current_buffer;
+                if (yy_b->pos >= yy_b->len)
+                        yy_fill(yy_b);
+                if (yy_b->pos >= yy_b->len) {
+                        yytext = yy_empty;
+                        yyleng = 0;
+                        switch (yy_start) {
+                        case INITIAL:
+                        case ARGUMENT_COND:
+                        case DEPEND_COND:
+                        case SERVICE_COND:
+                        case URL_COND:
+                        case ADDRESS_COND:
+                        case STRING_COND:
+                        case EVERY_COND:
+                        case HTTP_HEADER_COND:
+                        case INCLUDE:
+                        {
+{
 
-      709,  339,11455,11475,10966,11484,  489,11535,    0,11505,
-    11515,    0, 3550,  685,    0,11557,11567,11586,11596,    0,
-    11617,11627,    0, 3624,  674,11647,11657,11667,11677,    0,
-    11698,11708,    0, 3933,  663,11728,11738,11748,11758,    0,
-    11779,11789,    0, 4114,  641,11809,11819,11829,11839,    0,
-    11860,11870,    0, 4163,  627,11890,11899,11908,11917,11926,
-      620,11936,11946,11956,  582,11966,11976,11986,11995,12016,
-    12047,12024,12068,10995,  569,    0,  563,10904,12108, 3416,
-    12172,11003,10987,10986,18566, 2148, 2209,11368, 5061,11383,
-    12079,12080, 4873,12084,12093, 6739,10987,11007,12114,12062,
-
-    12105,12138,11054,12161,12145,12117,11461,12021,  523,12077,
-      477,  441,12232,    0, 4565, 1573,12242,12222,12293,12263,
-    12344,    0,  372,12395,12271,12446,    0,  360,12497,12314,
-    12548,    0,  296,12599,12322,12650,    0,  282,12701,12365,
-    12752,    0,  269,12374,12417,12426,12468,12476,12520,12530,
-    12571,12577,12622,12632,12673,12680,12723,12733,12773,12803,
-        0,12781,12826,    0, 4874,  258,11043,12864,12925,11367,
-    11044,11033,11054,18566,18566, 7225,18566,11154,12833,11270,
-    11051,11100,11097,11102, 3470,11149,11146,12856,11331,11475,
-      246,12896,12949,12978,  198,12987,12958, 1885,13038,12886,
-
-        0,13009,13019,13060,13089,12925,13070,13111,13121,13140,
-    13161,13170,13191,13201,13211,13232,13241,13262,13272,13282,
-    13303,13312,13333,13343,13353,13374,13383,13404,13413,13422,
-    13431,  171,13441,13451,13461,  145,13471,13481,13491,13500,
-    13521,13551,    0,  124,11347,11399,11583,12155,11405,18566,
-    11439,11668,11473,11749,11470,11517,12050,12268,12094,13529,
-    13574,13584,13603,  101,13610,13631,13661,13639,    0,13712,
-    13682,    0,13763,13690,    0,13814,13733,    0,13865,13741,
-        0,13916,13784,    0,13793,13836,13845,13887,13895,13939,
-    13949,13968,13974,13984,13994,14004,14011,14021,14031,14041,
-
-    14062,18566,12539,11830,11526,18566,18566,13541,13906,11588,
-    18566,11585,   92,14072,14093,14103,14112,14133,    0,14142,
-    14163,14172,14181,14190,14199,14208,14217,14226,14235,14244,
-    14253,14262,14271,14280,14289,14298,14307,14316,14325,14334,
-    14343,14352,   90,14362,14372,14382,14391,14412,    0,14405,
-    11587,11665,11666,11667,11736,14441,14458,14468,14429,14477,
-    14486,14495,14504,14513,14522,14530,14540,14550,14560,14567,
-    14576,14585,14570,11736,14595,14606,14624,14635,14644,14653,
-    14662,14671,14680,11748,11835,14689,14698,14707,14716,14725,
-    14734,14743,14752,12737,11824,14761,14770,12279,11822,11982,
-
-    18566,18566,14796,14823,14850,14877,14904,14931,14958,14985,
-    15012,15039,15066,15086,15111,15131,15156,15183,15210,15233,
-    15253,15274,15297,15317,15338,15365,15392,15419,15446,15473,
-    15500,15527,15550,15569,15586,15602,15620,15638,15662,15679,
-    15706,15733,15760,15787,15814,15841,15868,15895,15922,15949,
-    15969,15987,16005,16030,16057,16077,16095,16113,16131, 7613,
-    16156,16183,16210,16237,16260,16280,16301,16324,16344,16365,
-    16392,16419,16446,16473,16500,16527,16554,16581,16608,16635,
-    16662,16689,16716,16743,16770,16797,16820,16839,16856,16873,
-    16891,16909,16933,16950,16977,17004,17031,17058,17085,17112,
-
-    17139,17166,17193,17220,17247,17274,17294,17312,17337,17357,
-    17375,17393, 6162,17411,17432,17455,17482,17509,17536,17563,
-    17590,17617,17644,17662,17686,17703,17730,17757,17784,17811,
-    17831,17849, 6750, 7520,  381,17867,17892,17919,17946,17972,
-     7628, 7634,  804,17988, 9256, 9266, 1027,17998,18022,18032,
-    18050, 9867, 9933, 1629, 3322,18074,10641,10644, 3337,18084,
-    18102,18127,18153,18178,18188,12087,12197, 3516, 3712, 4027,
-    18206,18224,18249,18275,18300,12200,12213, 4101,18310,18328,
-    18353,18379,18404,12282,12354, 4344, 4671, 4673, 5051,18414,
-    18432,12384, 5630,18450,18468,12406,12913, 5665, 5684, 5717,
-
-     8186, 8364,18486,18504,12456,12486, 9038,18522,18540,12508
-    } ;
-
-static const flex_int16_t yy_def[2911] =
-    {   0,
-     2702,    1, 2703, 2703, 2704, 2704, 2705, 2705, 2706, 2706,
-     2707, 2707, 2708, 2708, 2709, 2709, 2710, 2710, 2711, 2711,
-     2702, 2702, 2702, 2702, 2702, 2712, 2713, 2714, 2702, 2715,
-     2714, 2716, 2702,   33,   33,   33, 2702, 2714, 2714, 2714,
-       33,   33,   42,   42,   42,   42,   33,   47,   48,   48,
-       48,   48,   48,   48,   48,   48,   48,   48,   48,   55,
-       48,   48, 2714, 2717, 2702, 2702, 2717, 2702, 2718, 2719,
-     2719, 2720, 2721, 2722, 2702, 2702, 2702, 2723, 2724, 2725,
-     2726, 2726, 2726, 2702, 2727, 2728, 2729, 2730, 2731, 2732,
-     2702, 2702, 2733, 2734, 2734, 2702, 2735, 2702, 2702, 2736,
-
-     2737, 2738, 2702, 2702, 2739, 2702, 2740, 2702, 2702, 2740,
-     2741, 2702, 2702, 2742, 2702, 2743, 2744, 2702, 2702, 2745,
-     2702, 2746, 2747, 2702, 2748, 2749, 2750, 2748, 2751, 2752,
-     2753, 2754, 2702, 2755, 2751, 2751, 2756, 2757, 2758, 2759,
-     2702, 2760,  141,  141,  141,  141,  141,  141, 2702, 2751,
-     2751, 2751, 2759,  141,  141,  144,  144,  144,  144,  144,
-      144,  144, 2758,  141,  144,  144,  141,  141,  144,  144,
-      144,  144,  144,  144,  144,  144,  141,  177,  144,  144,
-      144,  144,  177,  144,  144,  144,  144,  144,  144,  177,
-      144,  144,  144,  144,  144, 2702,  144,  144,  144,  144,
-
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144, 2761,
-     2702, 2761, 2762, 2763, 2761, 2702, 2764, 2764, 2702, 2702,
-
-     2764, 2764, 2702, 2702, 2765, 2766, 2767, 2702, 2702, 2768,
-     2769, 2770, 2771, 2772, 2771, 2702, 2773, 2774, 2775, 2776,
-     2777, 2778, 2779, 2780, 2781, 2781, 2782, 2783, 2784, 2785,
-     2786, 2787, 2788, 2789, 2790, 2791, 2792, 2702, 2793, 2793,
-     2702, 2794, 2702, 2702, 2794, 2795, 2795, 2702, 2796, 2797,
-     2798, 2702, 2799, 2800, 2801, 2802, 2803, 2702, 2804, 2805,
-     2805, 2806, 2806, 2807, 2808, 2809, 2702, 2810, 2810, 2811,
-     2812, 2812, 2812, 2812, 2812, 2812, 2702,  377, 2702, 2813,
-     2702,  377, 2702, 2702,  384,  384,  386,  386,  377,  377,
-      377,  390,  390,  390,  390,  390,  390,  390,  390, 2814,
-
-      390,  390,  390,  390,  377,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  377,  390,  390,  377,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  377,  390,  390,  390,  390,  390,  390,
-      390,  390, 2814,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390, 2814,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390, 2814,  390,  390,  390,  390,  390,  390,  390,  390,
-
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-
-      390, 2702, 2702, 2815, 2702, 2816, 2817, 2818, 2819, 2820,
-     2702, 2821, 2822, 2823, 2824, 2817, 2702, 2702, 2825, 2826,
-     2827, 2828, 2826, 2829, 2827, 2830, 2702, 2830, 2702, 2831,
-     2831, 2832, 2832, 2832, 2832, 2832,  390,  390, 2702, 2833,
-     2834, 2702,  642,  642,  644,  644, 2702, 2702, 2702, 2835,
-      649,  649,  652,  652,  649,  649,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390, 2702, 2702,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390, 2836,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390, 2836,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390, 2836,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390, 2702,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390, 2702,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390, 2702, 2837, 2838, 2839, 2702, 2840, 2702, 2831, 2831,
-     2832, 2832, 2832, 2832,  390, 2841, 2842, 2702, 2702, 2843,
-      889,  889,  892,  892,  889,  889, 2702, 2702, 2702, 2702,
-
-     2702, 2702,  902, 2702,  904,  904,  906,  904,  902,  902,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-     2702,  685, 2702, 2702, 2702, 2702, 2702, 2702, 2702,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390, 2702, 2702,  390,  390,  390,
-      390,  390,  390,  390,  390, 2702,  390,  390,  390,  390,
-      390,  390,  390,  390, 2702,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-
-      390,  390,  390,  390,  390, 2836,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390, 2702,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390, 2702,
-     2702,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390, 2836,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390, 2702, 2702,  390,  390,  390,
-      390,  390,  390, 2702, 2702, 2836,  390,  390,  390,  390,
-
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390, 2844, 2831, 2831, 2831, 2832, 2832,
-     2832, 2832, 2702, 2845, 2846, 2702, 1136, 1136, 1138, 1138,
-     2702, 1141, 2702, 1143, 1143, 1145, 1143, 1141, 1141, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2847,
-     1159, 1159, 1162, 1162, 1159,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390, 2702,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-
-     2702,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-     2702,  390,  390,  390,  390, 2702,  390,  390, 2702,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390, 2848,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390, 2702,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390, 2848,  390,  390,
-      390,  390,  390,  390, 2848,  390,  390,  390,  390,  390,
-
-      390,  390,  390,  390,  390,  390,  390,  390,  390, 2702,
-     2702,  390, 2702, 2702, 2848,  390,  390,  390,  390,  390,
-     2702, 2702, 2702,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390, 2702,  390,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390, 2849, 2850, 2850, 2850, 2851, 2851, 2851, 2851, 2852,
-     2853, 2702, 2702, 2854, 1363, 1363, 1366, 1366, 1363, 1363,
-     2702, 2702, 2702, 2702, 2855, 1374, 1374, 1377, 1377, 1374,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     1390, 2702, 1392, 1392, 1394, 1392, 1390, 1390, 2702,  390,
-
-      390,  390, 2848,  390,  390,  390,  390,  390,  390,  390,
-     2702,  390, 2702, 2702, 2702, 2702, 2702, 2702,  390,  390,
-      390,  390,  390,  390,  390,  390,  390, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702,  390,  390,  390, 2702,  390,  390,  390,
-      390, 2702,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390,  390,  390, 2702,  390,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  390, 2848,  390,  390,
-      390,  390,  390,  390,  390,  390,  390, 2702,  390,  390,
-      390,  390,  390, 2702,  390,  390,  390,  390, 2848,  390,
-
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390,  390, 2848,  390,  390,  390,  390, 2848,  390,
-      390,  390,  390,  390,  390,  390,  390,  390,  390,  390,
-      390, 2702, 2702,  390, 2702, 2702, 2702,  390,  390,  390,
-      390, 2702,  390,  390,  390,  390,  390,  390,  390,  390,
-     2702, 2702,  390,  390,  390,  390,  390,  390,  390,  390,
-      390,  390, 2856, 2851, 2851, 2851, 2851, 2851, 2851, 2702,
-     2857, 2858, 2702, 1573, 1573, 1575, 1575, 2702, 1578, 2702,
-     1580, 1580, 1582, 1580, 1578, 1578, 2702, 1587, 2702, 1589,
-     1589, 1591, 1589, 1587, 1587, 2702, 2702, 2702, 2702, 2702,
-
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2859, 1608,
-     1608, 1611, 1611, 1608, 2702, 2860, 2860, 2861, 1617, 1617,
-     1617, 1617, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     1617, 1617, 1617, 1617, 1617, 1617, 1617, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 1617, 1617, 2702, 2702,
-     1617, 1617, 2702, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
-     1617, 1617, 1617, 2702, 1617, 1617, 1617, 1617, 1617, 1617,
-     2702, 2702, 1617, 2861, 1617, 1617, 1617, 1617, 1617, 2862,
-     1617, 1617, 2702, 1617, 1617, 2702, 1617, 1617, 1617, 2861,
-     1617, 1617, 1617, 1617, 1617, 1617, 2861, 1617, 1617, 1617,
-
-     1617, 2861, 1617, 1617, 1617, 1617, 2861, 1617, 1617, 1617,
-     2702, 2702, 2861, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
-     2702, 1617, 1617, 1617, 2702, 2702, 2702, 1617, 1617, 1617,
-     1617, 2702, 1617, 1617, 2863, 1617, 1617, 1617, 2702, 2702,
-     1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 2864, 2865,
-     2866, 2867, 2702, 2702, 2868, 1754, 1754, 1757, 1757, 1754,
-     1754, 2702, 2702, 2702, 2702, 2869, 1765, 1765, 1768, 1768,
-     1765, 2702, 2702, 2702, 2702, 2870, 1775, 1775, 1778, 1778,
-     1775, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 1794, 2702, 1796, 1796, 1798, 1796,
-
-     1794, 1794, 2702, 2871, 2872, 2871, 1806, 1806, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 1806, 1806, 1806,
-     1806, 1806, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 1806, 2702, 2702, 1806, 2702, 1806, 1806, 1806, 1806,
-     1806, 1806, 1806, 2702, 1806, 1806, 1806, 1806, 1806, 2702,
-     2702, 2702, 2872, 1806, 1806, 1806, 2873, 2873, 1806, 1806,
-     2702, 1806, 1806, 2702, 1806, 1806, 1806, 1806, 2872, 1806,
-     1806, 2872, 1806, 2702, 1806, 1806, 2702, 2702, 2702, 1806,
-     1806, 1806, 1806, 1806, 2702, 1806, 1806, 1806, 2702, 2702,
-     2702, 1806, 1806, 1806, 1806, 2702, 1806, 1806, 2874, 2874,
-
-     1806, 1806, 2702, 2702, 1806, 1806, 1806, 1806, 1806, 2875,
-     2702, 2876, 2877, 2702, 1914, 1914, 1916, 1916, 2702, 1919,
-     2702, 1921, 1921, 1923, 1921, 1919, 1919, 2702, 1928, 2702,
-     1930, 1930, 1932, 1930, 1928, 1928, 2702, 1937, 2702, 1939,
-     1939, 1941, 1939, 1937, 1937, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2878, 1962, 1962, 1965, 1965, 1962, 2702, 2879,
-     2880, 2879, 1972, 1972, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 1972, 1972, 1972, 1972, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 1972, 2702, 2702, 1972,
-
-     2702, 1972, 1972, 1972, 1972, 1972, 1972, 2702, 1972, 1972,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2880, 1972, 1972,
-     2881, 1972, 1972, 2702, 1972, 2880, 1972, 1972, 1972, 2880,
-     1972, 1972, 2702, 1972, 1972, 2702, 1972, 1972, 1972, 1972,
-     1972, 2702, 1972, 1972, 2702, 2702, 2702, 1972, 1972, 1972,
-     2702, 1972, 1972, 2882, 2702, 1972, 1972, 2883, 2884, 2885,
-     2702, 2702, 2886, 2062, 2062, 2065, 2065, 2062, 2062, 2702,
-     2702, 2702, 2702, 2887, 2073, 2073, 2076, 2076, 2073, 2702,
-     2702, 2702, 2702, 2888, 2083, 2083, 2086, 2086, 2083, 2702,
-     2702, 2702, 2702, 2889, 2093, 2093, 2096, 2096, 2093, 2702,
-
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2113, 2702, 2115, 2115, 2117, 2115, 2113,
-     2113, 2702, 2890, 2891, 2890, 2125, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2125, 2125, 2702, 2702, 2702, 2125,
-     2702, 2125, 2125, 2125, 2125, 2702, 2125, 2125, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2891, 2125, 2125, 2702, 2125,
-     2891, 2891, 2125, 2125, 2125, 2702, 2125, 2125, 2125, 2702,
-     2125, 2125, 2702, 2702, 2125, 2125, 2702, 2125, 2125, 2702,
-     2125, 2702, 2702, 2702, 2892, 2702, 2702, 2187, 2187, 2189,
-     2189, 2702, 2192, 2702, 2194, 2194, 2196, 2194, 2192, 2192,
-
-     2702, 2201, 2702, 2203, 2203, 2205, 2203, 2201, 2201, 2702,
-     2210, 2702, 2212, 2212, 2214, 2212, 2210, 2210, 2702, 2219,
-     2702, 2221, 2221, 2223, 2221, 2219, 2219, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2893, 2244, 2244, 2247, 2247, 2244,
-     2702, 2894, 2895, 2894, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2254, 2254, 2702, 2702, 2702, 2702, 2702, 2254,
-     2254, 2254, 2254, 2702, 2254, 2254, 2702, 2702, 2702, 2702,
-     2254, 2254, 2702, 2254, 2895, 2254, 2254, 2254, 2702, 2254,
-     2254, 2254, 2702, 2254, 2702, 2254, 2254, 2702, 2702, 2702,
-
-     2896, 2897, 2897, 2303, 2304, 2702, 2897, 2702, 2898, 2308,
-     2308, 2311, 2311, 2308, 2308, 2702, 2702, 2702, 2702, 2899,
-     2319, 2319, 2322, 2322, 2319, 2702, 2702, 2702, 2702, 2900,
-     2329, 2329, 2332, 2332, 2329, 2702, 2702, 2702, 2702, 2901,
-     2339, 2339, 2342, 2342, 2339, 2702, 2702, 2702, 2702, 2902,
-     2349, 2349, 2352, 2352, 2349, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2369,
-     2702, 2371, 2371, 2373, 2371, 2369, 2369, 2702, 2903, 2904,
-     2903, 2702, 2702, 2702, 2702, 2702, 2702, 2381, 2702, 2381,
-     2381, 2381, 2702, 2381, 2381, 2702, 2702, 2702, 2381, 2904,
-
-     2381, 2381, 2702, 2381, 2381, 2381, 2702, 2702, 2702, 2702,
-     2905, 2906, 2905, 2413, 2413, 2905, 2702, 2417, 2702, 2419,
-     2702, 2419, 2419, 2702, 2424, 2702, 2424, 2424, 2702, 2429,
-     2702, 2429, 2429, 2702, 2434, 2702, 2434, 2434, 2702, 2439,
-     2702, 2439, 2439, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2907, 2460, 2460, 2463, 2463, 2460, 2702, 2908, 2908, 2469,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2469, 2469, 2469,
-     2469, 2702, 2702, 2469, 2909, 2469, 2702, 2469, 2469, 2469,
-     2702, 2702, 2702, 2702, 2910, 2702, 2702, 2910, 2702, 2499,
-
-     2499, 2702, 2702, 2702, 2702, 2505, 2702, 2702, 2702, 2702,
-     2510, 2702, 2702, 2702, 2702, 2515, 2702, 2702, 2702, 2702,
-     2520, 2702, 2702, 2702, 2702, 2525, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2540, 2702, 2540, 2540, 2702, 2469, 2469, 2469, 2702, 2702,
-     2702, 2469, 2469, 2469, 2702, 2702, 2702, 2702, 2469, 2702,
-     2702, 2702, 2702, 2702, 2702, 2565, 2702, 2567, 2567, 2702,
-     2570, 2570, 2702, 2573, 2573, 2702, 2576, 2576, 2702, 2579,
-     2579, 2702, 2582, 2582, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-
-     2600, 2702, 2469, 2469, 2469, 2702, 2702, 2469, 2469, 2702,
-     2702, 2469, 2702, 2702, 2702, 2702, 2702, 2617, 2617, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2647, 2647, 2469,
-     2469, 2469, 2469, 2469, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2469, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2469, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2469, 2702, 2702, 2702, 2469, 2702, 2469,
-
-     2702,    0, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702
-    } ;
-
-static const flex_int16_t yy_nxt[18657] =
-    {   0,
-       22,   23,   24,   23,   23,   25,   26,   27,   28,   29,
-       30,   23,   23,   28,   23,   31,   28,   32,   33,   34,
-       35,   36,   36,   36,   36,   36,   37,   23,   38,   39,
-       40,   28,   22,   41,   42,   43,   44,   45,   46,   47,
-       48,   49,   50,   51,   52,   53,   54,   55,   56,   50,
-       57,   58,   59,   60,   61,   62,   50,   50,   50,   28,
-       63,   28,   41,   42,   43,   44,   45,   46,   47,   48,
-       49,   50,   51,   52,   53,   54,   55,   56,   50,   57,
-       58,   59,   60,   61,   62,   50,   50,   50,   22,   22,
-       65,   66,   67,   65,  120,   68,  121,  133,  358,   69,
-
-       65,   66,   67,   65,  134,   68, 2666,  122, 2656,   69,
-       22,   70,   71,   70,   70,   22,   72,  130,  138,   22,
-       74,   75,   75,  291,   75,  291,  291, 2412,  108,  109,
-      108,  110,  352,  131,  131,  352,   22,   75,  110,  110,
-     2459,  108,   22,  115,   99,   99,  115,  130,  116,  332,
-      332,  130,  117,  111,  110,  108,  109,  108,  110,  124,
-      150, 2593,  124,  131,  151,  110,  110,  131,  108,  115,
-       99,   99,  115,  130,  116,  132,  352,  334,  117,  352,
-      111,  110,  118,  367,  118,  118,  112, 2589,  113,  131,
-      332,  332,  118,  118,  291,  118,  292,  291,   22,   22,
-
-       22,   70,   71,   70,   70,   22,   72,  130,  118,   22,
-       74,   75,   75,  112,   75,  113,  294,  294,  334,  294,
-      359,  294, 1671,  131, 2412,  295,   22,   75,  309, 1672,
-      309,  309,   22,  145,  145,  145,  145,  145,  145,  145,
-      145,  394,  135,  136,  146,  146,  146,  146,  146,  147,
-      148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
-      130,  315, 2560,  315,  316,  316,  356,  316,  316,  356,
-      394,  135,  136,  152, 2459,  351,  131,  326,  326,  326,
-      326,  326,  326,  326,  326, 2243,  314,  130,   22,   22,
-       22,   76,   77,   76,   76,   22,   78,  395, 1961,   22,
-
-       80,   22,   22,  131,   22,  144,  144,  215,  354,  144,
-      216,  354, 1607,  351,  217,  132,   22,   22,  396,  144,
-      144,  138,   22,  367,  144,  144,  395,  144,  313,  313,
-      338,  236,  338,  338,  144,  144,  215,  131,  144,  216,
-      237,  238,  339,  217,  339,  339,  239,  396,  144,  144,
-      153,  130,  318,  144,  144, 2410,  144,  130,  319,  379,
-      236,  297,  298,  297,  297, 2412,  131,  131,  381,  237,
-      238,  299,  299,  131,  300,  239, 1158,  130,   22,   22,
-       22,   76,   77,   76,   76,   22,   78,  299,  648,   22,
-       80,   22,   22,  131,   22,  252,  283,  908,  253,  254,
-
-      284,  399,  908,  130,  285,  369,   22,   22, 1221,  144,
-      144, 1221,   22,  255,  144,  144,  313,  313,  286,  131,
-      397,  313,  287,  403,  252,  283,  288,  253,  254,  284,
-      399,  398,  144,  285,  369,  289,  404,  144,  144,  144,
-      323, 1831,  255,  144,  144,  313,  324,  286,  685,  397,
-     1226,  287,  403, 1226,  347,  288,  348,  347,  120,  349,
-      398,  144,  358,  350,  289,  404,  144, 2497,   22,   22,
-       81,   82,   83,   82,   84,   81,   81,   85,   81,   81,
-       81,   81,   81,   81,   81,  411,   81,   87,  341,  341,
-      341,  341,  341,  341,  341,  341,   88,   81,   81,   81,
-
-       81,   89,   22, 2412,  419, 2702,  301,  302,  301,  301,
-      300,  308,  300,  300,  411, 2412,  303,  303,  392,  304,
-      300,  300,  153,  300,  344,  393,  344,  344,  422,   90,
-       81,   81,  303,  419,  344,  344,  300,  344,  131,  372,
-      373,  374,  375,  375,  375,  375,  375,  392,  124, 2186,
-      344,  313,  313,  131,  393,  423,  313,  422,   81,   81,
-       81,   82,   83,   82,   84,   81,   81,   85,   81,   81,
-       81,   81,   81,   81,   81,  328,   81,   87,  130, 2243,
-      153,  329,  902,  902,  423, 2702,   88,   81,   81,   81,
-       81,   89,   22,  153,  131,  430,  131,  344, 2452,  344,
-
-      345,  118, 1998,  118,  118, 1998,  359,  345,  345,  131,
-      344,  118,  118,  368,  118,  400,  431,  434,  420,   90,
-       81,   81,  343,  345,  430,  153,  153,  118,  378,  378,
-      378,  378,  378,  378,  378,  378, 2448,  291,  421,  291,
-      291,  131,  368, 2243,  400,  431,  434,  420,   81,   81,
-       91,   91,   92,   91,   93,   93,  140, 1961,  382,  382,
-      382,  382,  382,  382,  382,  382,  140,  421,  382,  382,
-      382,  382,  382,  382,  382,  382,   95,  436,   96, 1607,
-       96,  140,   97,  382,  382,  382,  382,  382,  382,  153,
-     1158,  378,  378,  378,  378,  378,  378,  378,  378,  408,
-
-      437,  648,  438,  409,  432,  439,  436,  410,  389,   96,
-      153,   96,  378,  378,  378,  378,  378,  378,  378,  378,
-      416,  440,  433,  448,  417,  390,  451,  418,  408,  437,
-      391,  438,  409,  432,  439, 2186,  410,  389,   91,   98,
-       91,   91,   92,   91,   93,   93,  153, 1129, 2243,  416,
-      440,  433,  448,  417,  390,  451,  418, 1961,  291,  391,
-      292,  291,  131,  131,  449,  446,   95,  452,   96,  447,
-       96,  454,   97,  153,  450,  378,  378,  378,  378,  378,
-      378,  378,  378,  153,  457,  378,  378,  378,  378,  378,
-      378,  378,  378,  449,  446,  461,  452,  462,  447,   96,
-
-      454,   96,  309,  450,  309,  309,  130,  354,  401,  402,
-      354, 2702,  626,  457,  465, 1141, 1141,  407,  294,  294,
-     1147,  294,  131,  294,  461, 1147,  462,  295,   91,   98,
-       22,   22,   99,   22,   22,   22,  100,  401,  402,   22,
-      102,   22,   22,  465,   22,  153,  407,  378,  378,  378,
-      378,  378,  378,  378,  378,  412,   22,   22,  466,  413,
-      378,  427,   22,  414,  405,  467,  468,  428,  441,  415,
-      455,  429,  442,  456,  463,  144,  464,  406,  469,  443,
-      144,  476,  478,  479,  412,  480,  481,  466,  413,  378,
-      427, 1607,  414,  405,  467,  468,  428,  441,  415,  455,
-
-      429,  442,  456,  463,  144,  464,  406,  469,  443,  144,
-      476,  478,  479,  378,  480,  481,  435, 2702,   22,   22,
-       22,   22,   99,   22,   22,   22,  100,  482,  144,   22,
-      102,   22,   22,  144,   22, 1158,  458,  444,  485,  378,
-      459, 2702,  378,  445,  500,  435,   22,   22,  648,  486,
-      460,  498,   22,  499,  144,  487,  482,  144,  470,  144,
-      483,  484,  144,  504,  471,  458,  444,  485,  378,  459,
-      472,  505,  445,  500,  473,  474,  506,  475,  486,  460,
-      498, 2702,  499,  144,  487,  509,  130,  470,  144,  483,
-      484,  507,  504,  471,  508,  514,  515,  520,  356,  472,
-
-      505,  356,  131,  473,  474,  506,  475,  628,   22,   22,
-      104,   99,  104,  104,  509,  105,  516,  526,  532,  105,
-      507,  533,  517,  508,  514,  515,  520,  106,  106,  106,
-      106,  106,  106,  106,  106,  104,   99,  104,  104,  316,
-      105,  316,  316, 1396,  105,  516,  526,  532, 1396,  536,
-      533,  517,  106,  106,  106,  106,  106,  106,  106,  106,
-      123,  123,  124,  123,  123,  123,  123,  501,  488,  123,
-      123,  123,  123,  489,  123,  518,  126,  502,  536,  490,
-      510,  503,  494,  491,  521,  549,  123,  123,  495,  555,
-      519, 2186,  127,  511,  496,  497,  501,  488,  512,  513,
-
-      522,  523,  489,  560,  518,  527,  502,  561,  490,  510,
-      503,  494,  491,  521,  549,  528,  571,  495,  555,  519,
-      128, 1913,  511,  496,  497,  534,  572,  512,  513,  522,
-      523, 1434,  560, 1961,  527,  338,  561,  338,  338, 1435,
-      339,  535,  339,  339,  528,  571, 1390, 1390,  123,  123,
-      139,  139, 1578, 1578,  534,  572,  139, 2702,  139,  140,
-      139,  141,  141,  141,  141,  141,  141,  141,  141,  142,
-      535,  139,  139,  139,  139,  131,  143,  143,  143,  143,
-      143,  143,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-
-      144,  144,  139,  139,  139,  143,  143,  143,  143,  143,
-      143,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  153, 2236,  143,  143,  143,  143,  143,  143,  143,
-      143,  524,  529,  573,  530,  531,  525,  550,  574,  562,
-      154,  155, 2232,  563,  575,  579,  551,  547,  552,  156,
-      580,  157,  553,  158,  554,  159,  160,  161,  162, 1961,
-      524,  529,  573,  530,  531,  525,  550,  574,  562,  154,
-      155,  548,  563,  575,  579,  551,  547,  552,  156,  580,
-      157,  553,  158,  554,  159,  160,  161,  162,  153,  163,
-
-      143,  143,  143,  143,  143,  143,  143,  143,  564,  556,
-      548,  557,  565,  566,  581,  164,  582,  568,  569,  576,
-      558,  583,  584,  577,  585,  586,  588,  567,  570,  587,
-      559,  590,  594,  595,  589,  165,  578,  564,  556,  166,
-      557,  565,  566,  581,  164,  582,  568,  569,  576,  558,
-      583,  584,  577,  585,  586,  588,  567,  570,  587,  559,
-      590,  594,  595,  589,  165,  578,  596, 1607,  166,  139,
-     1587, 1587,  599,  315,  591,  315,  316,  597,  592,  600,
-     1158,  601,  593,  144,  144,  167,  144,  598,  619,  168,
-      619,  619,  169,  170,  144,  596,  171,  648,  314,  172,
-
-      173,  599,  174,  591,  175,  144,  597,  592,  600,  176,
-      601,  593,  144,  144,  167,  144,  598,  619,  168,  619,
-      619,  169,  170,  144, 2186,  171,  332,  332,  172,  173,
-     1913,  174,  130,  175,  144,  675,  144, 1850,  176,  139,
-      297,  298,  297,  297,  302,  302,  302,  302,  131,  144,
-      299,  299, 1851,  300,  334,  177, 1852, 2702,  660,  178,
-      630,  313,  313,  179,  675,  144,  299, 2026,  180,  181,
-      301,  302,  301,  301,  130,  144,  144,  182,  144,  144,
-      303,  303, 1961,  304,  177,  318,  679,  660,  178,  630,
-      131,  319,  179,  607,  607, 1607,  303,  180,  181, 1437,
-
-      300,  308,  300,  300,  144,  144,  182, 1438,  144,  139,
-      300,  300, 2702,  300, 1437,  679, 1158,  319,  300,  308,
-      300,  300, 1438,  319,  130,  143,  300,  183,  300,  300,
-      347,  300,  348,  347, 2033,  349,  184, 2033,  185,  350,
-      131,  186,  313,  313,  300,  187,  188,  313,  189,  144,
-      301,  302,  301,  301,  143,  144,  183,  607,  607,  631,
-      303,  303,  607,  304, 2702,  184,  323,  185,  313,  313,
-      186,  313,  324,  313,  187,  188,  303,  189,  144,  139,
-      304,  324,  304,  304,  144,  130,  607,  324,  631, 2410,
-      304,  304,  328,  304,  304,  190,  304,  304,  329, 2412,
-
-      144,  131,  144,  191,  304,  304,  304,  304,  661,  192,
-      670,  648,  193,  194,  195,  144,  607,  607,  144,  144,
-      304,  607, 1794, 1794,  190,  348, 2702,  348,  348,  144,
-      620,  144,  191, 1125,  621, 1125, 1125,  661,  192,  670,
-      329,  193,  194,  195,  144, 1584,  329,  144,  144,  153,
-     1584,  144,  144,  144,  144,  144,  144,  144,  144,  196,
-     1998,  144,  304, 1998,  304,  304,  144,  197,  144,  144,
-      198,  144,  304,  304,  199,  304,  344, 2033,  344,  344,
-     2033,  200,  144,  201,  677,  202,  344,  344,  304,  344,
-      144,  664,  144,  144, 2061,  144,  197,  144,  144,  198,
-
-      144, 1913,  344,  199,  655,  655,  655,  655,  655,  655,
-      200,  144,  201,  677,  202,  203,  144,  144,  662,  204,
-      664,  144,  144,  144,  144, 1441,  144,  144,  671,  205,
-      144,  663,  144, 1442,  206,  326,  326,  326,  326,  326,
-      326,  326,  326,  144,  203,  144,  144,  662,  204,  611,
-      623,  623,  144,  144,  346,  144,  144,  671,  205,  144,
-      663,  144,  623,  206,  144,  144,  207,  208,  144,  209,
-      210,  665,  144,  729,  623,  667,  211,  212,  144,  213,
-     1572,  144,  214,  144,  341,  341,  341,  341,  341,  341,
-      341,  341, 2054,  144,  144,  207,  208,  144,  209,  210,
-
-      665,  738,  729,  739,  667,  211,  212,  144,  213,  623,
-      144,  214,  144,  218,  130,  666,  219,  220,  153,  144,
-      144,  221, 2021,  625,  625,  222,  344,  223,  344,  345,
-      131,  346,  224, 1826,  131,  625,  345,  345,  144,  344,
-     1607, 1827,  218,  672,  666,  219,  220,  625,  144,  144,
-      221,  343,  345, 2702,  222,  668,  223, 1954,  673,  144,
-      746,  224,  225,  226,  144,  227,  228,  144,  144,  144,
-      229,  674,  672,  676,  230,  678,  231,  144,  232,  144,
-      233,  234,  625,  702,  668,  144,  235,  673,  144,  746,
-      680,  225,  226,  144,  227,  228,  681,  144,  144,  229,
-
-      674, 2410,  676,  230,  678,  231,  144,  232,  144,  233,
-      234, 2412,  702, 1950,  144,  235,  144,  144,  144,  680,
-      144,  240, 1607,  683,  682,  681,  692,  241,  144,  242,
-      144,  243,  786,  244,  144,  144, 1158,  633,  633,  633,
-      633,  633,  633,  633,  633,  144,  144,  144,  648,  144,
-      240,  131,  683,  682,  153,  692,  241,  144,  242,  144,
-      243,  786,  244,  144,  144,  245,  144,  687,  144,  246,
-      131,  247,  144,  248,  144,  688,  693,  696,  689,  249,
-      250,  144,  251,  632,  144,  633,  633,  633,  633,  633,
-      633,  633,  633, 1913,  245,  144,  687,  144,  246,  131,
-
-      247,  144,  248,  144,  688,  693,  696,  689,  249,  250,
-      144,  251,  695,  144,  256, 1572,  144,  704,  257,  690,
-      144,  258,  259,  705,  144,  260,  261, 1437,  144,  262,
-      144,  144,  263,  264,  265, 1438,  266,  684,  267,  131,
-      700,  695,  805,  256,  685,  144,  704,  257,  690,  144,
-      258,  259,  705,  144,  260,  261,  697,  144,  262,  144,
-      144,  263,  264,  265,  144,  266,  698,  267,  268,  700,
-      269,  805,  270,  144,  144,  271,  272,  144,  701,  273,
-      699,  274,  275,  810,  703,  697,  686,  144,  144,  706,
-     1900,  144,  276,  144,  144,  698,  707,  268,  153,  269,
-
-      708,  270,  144,  144,  271,  272,  144,  701,  273,  699,
-      274,  275,  810,  703,  131,  686,  144,  144,  706,  144,
-      144,  276,  277,  144,  144,  707,  811,  278,  726,  708,
-      144,  711,  279,  719,  280,  144,  281,  282,  632, 1858,
-      634,  634,  634,  634,  634,  634,  634,  634,  144, 2474,
-     1441,  277, 2474,  144,  131,  811,  278,  726, 1442,  144,
-      711,  279,  719,  280,  144,  281,  282,  313,  313,  313,
-      313,  144,  313,  313,  313,  313,  313,  313,  313,  313,
-      313,  313,  725,  321,  313,  647,  647,  647,  647,  647,
-      647,  647,  647,  314,  313,  313,  313,  313,  313,  632,
-
-      144,  635,  635,  635,  635,  635,  636,  372,  372,  130,
-     2475,  725, 1128, 2475,  632,  131,  372,  372,  372,  372,
-      372,  372,  372,  372, 1607,  131,  313,  313,  313,  153,
-      131,  638,  638,  638,  638,  638,  638,  638,  638,  652,
-      652,  652,  652,  652,  652,  652,  652,  653,  653,  653,
-      653,  653,  654,  655,  655,  313,  313,  313,  313,  313,
-      313,  813,  313,  313,  313,  313, 1158,  313,  313,  313,
-      313,  313,  313, 2702,  313,  656,  656,  656,  656,  656,
-      656,  656,  656,  331,  313,  313,  313,  313,  313,  153,
-      813,  638,  638,  638,  638,  638,  638,  638,  638,  153,
-
-      144,  638,  638,  638,  638,  638,  638,  638,  638,  709,
-      657, 1919, 1919,  761,  144,  144,  313,  313,  313,  153,
-     2702,  638,  638,  638,  638,  638,  638,  638,  638,  144,
-      648,  144, 2702,  659, 1753,  144,  144,  747,  709,  657,
-      669,  710,  761,  144,  144,  313,  313,  123,  123,  124,
-      123,  123,  123,  123, 1928, 1928,  123,  123,  123,  123,
-      144,  123,  659,  126,  144,  144,  747,  144,  144,  669,
-      710,  713,  714,  123,  123,  720,  144,  715,  781,  127,
-      716,  790,  144,  144,  144, 1572,  153, 1135,  638,  638,
-      638,  638,  638,  638,  638,  638,  144,  144,  144,  144,
-
-      713,  714, 1158,  717,  720,  144,  715,  128, 2702,  716,
-      790,  144,  144,  144,  153,  691,  638,  638,  638,  638,
-      638,  638,  638,  638, 1937, 1937, 1600,  144,  144,  130,
-     1596,  694,  717, 1126, 1127,  123,  123,  123,  123,  124,
-      123,  123,  123,  123,  691,  131,  123,  123,  123,  123,
-      153,  123,  638,  638,  638,  638,  638,  638,  638,  638,
-      694,  721,  144,  123,  123,  718,  722,  144, 1158,  127,
-      144,  724,  144,  144,  144,  712,  144,  144,  144,  727,
-      728,  144,  723,  730,  732,  731,  787,  734,  144,  736,
-      721,  144,  144,  144,  718,  722,  144,  361,  648,  144,
-
-      724,  144,  144,  144,  712,  144,  144,  144,  727,  728,
-      144,  723,  730,  732,  731,  787,  734,  144,  736, 2113,
-     2113,  144,  144,  144, 1572,  123,  123,  123,  123,  124,
-      123,  123,  123,  123,  733,  144,  123,  123,  123,  123,
-      737,  123,  144, 1135,  153,  144,  735,  144,  144,  741,
-     1826,  742,  144,  123,  123,  144,  144,  745, 1827,  123,
-      131,  144,  749,  733,  144,  144,  743,  144,  744,  737,
-      144,  144,  748,  752,  144,  735,  144,  144,  741,  740,
-      742, 1994,  153, 1158,  144,  144,  745,  363,  153, 1995,
-      144,  749, 1874,  648,  144,  743,  144,  744,  131,  144,
-
-     2702,  748,  752,  750,  131,  754,  144,  755,  740,  751,
-      144,  144,  144, 2192, 2192,  123,  123,  123,  123,  124,
-      123,  123,  123,  123,  753, 1362,  123,  123,  123,  123,
-      153,  123,  750,  126,  754,  144,  755,  757,  751,  144,
-      144,  144,  144,  123,  123,  144,  131,  144, 1135,  127,
-      758,  144,  760,  753,  762,  144,  144,  765,  144,  763,
-      764,  766,  759,  769,  144,  756,  757,  144,  771,  770,
-      144,  144,  144,  776,  144,  144,  144,  128,  641,  758,
-      144,  760,  775,  762,  144,  144,  765,  144,  763,  764,
-      766,  759,  769,  144,  756, 1850,  144,  771,  770,  144,
-
-      648,  144,  776, 2702,  144,  123,  123,  139,  139, 1151,
-     1851,  775,  648,  139, 1852,  139,  376,  139,  377,  377,
-      377,  377,  377,  377,  377,  377,  142, 1135,  139,  139,
-      139,  139,  131,  378,  378,  378,  378,  378,  378,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  139,
-      139,  139,  378,  378,  378,  378,  378,  378,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  153,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  196,  144,
-
-      798,  788,  144,  773,  641,  144,  144,  144,  144,  144,
-      144,  895,  895,  895,  895,  895,  895,  648,  144, 1989,
-      767,  774,  144,  144,  844,  144,  888, 1990,  144,  798,
-      788,  144,  773,  768,  144,  144,  144,  144,  144,  144,
-      383,  384,  385,  386,  387,  387,  387,  387,  387,  767,
-      774,  144,  144,  844,  144,  144,  388,  388,  388,  388,
-      388,  388,  768,  772, 1165, 1165, 1165, 1165, 1165, 1165,
-      641,  779,  777, 1994,  782, 1434,  144,  966,  144,  966,
-      966, 1995,  967, 1435,  144,  388,  388,  388,  388,  388,
-      388,  153,  772,  378,  378,  378,  378,  378,  378,  378,
-
-      378,  777,  144,  782,  780,  144,  144,  144,  144,  144,
-      784,  144,  424,  778,  144,  144,  797,  791,  785,  144,
-      792,  789,  783,  144,  794,  793,  800,  425, 2201, 2201,
-      144,  144,  426,  780,  795,  144,  878,  144,  144,  784,
-      144,  424,  778,  144,  144,  797,  791,  785,  144,  792,
-      789,  783,  144,  794,  793,  800,  425,  144,  144,  144,
-      144,  426,  537,  795,  538,  539,  796,  799,  540,  806,
-      144,  541,  816,  144,  542, 2266,  809,  543,  544,  144,
-      545,  546, 1125, 2267, 1125, 1125,  144,  144,  878,  144,
-      872,  537,  876,  538,  539,  796,  799,  540,  806,  144,
-
-      541,  816,  144,  542,  144,  809,  543,  544,  144,  545,
-      546,  313,  313,  313,  313,  801,  313,  313,  313,  313,
-      313,  313,  313,  313,  313,  313,  802,  321,  313,  829,
-      314,  144,  803,  144,  144,  144,  144,  314,  313,  313,
-      313,  313,  313,  872,  801,  804,  807,  808,  822,  812,
-      814,  144,  144,  144,  144,  802,  144,  815,  606,  144,
-      144,  803,  817,  144,  144,  144,  826,  818,  819,  144,
-      313,  313,  313,  153,  804,  807,  808,  822,  812,  814,
-      144,  144,  144,  144,  604,  144,  815,  144,  144,  131,
-      144,  817,  820,  140,  834,  826,  818,  819,  144,  313,
-
-      313,  313,  313,  313,  313,  641,  313,  313,  313,  313,
-      313,  313,  313,  313,  313,  313,  144,  313,  313,  144,
-      144,  820,  144,  834,  144,  821,  144,  314,  313,  313,
-      313,  313,  313,  639,  144,  828,  827,  830,  832,  144,
-      823,  144,  144,  824,  831,  144,  825,  144,  837,  144,
-      144,  144,  144,  144,  821,  144,  833,  843,  861,  144,
-      313,  313,  313,  144,  828,  827,  830,  832,  144,  823,
-      144,  144,  824,  831,  144,  825,  144,  837,  845,  144,
-     1323,  144, 1323, 1323,  144,  833,  843,  861,  144,  313,
-      313,  313,  313,  313,  313,  131,  313,  313,  313,  313,
-
-      144,  313,  313,  313,  313,  313,  313,  845,  313,  841,
-      865,  842,  144,  144,  848,  847,  144,  331,  313,  313,
-      313,  313,  313,  131,  835,  144,  144,  144,  144,  144,
-      144,  144,  846,  851,  836,  850,  131,  849,  841,  865,
-      842,  144,  144,  848,  847,  144,  144,  852,  629,  919,
-      313,  313,  613,  835,  144,  144,  144,  144,  627,  144,
-      144,  846,  851,  836,  850,  838,  849,  343,  838,  618,
-      853,  144,  144,  854,  144,  144,  852,  144,  919,  313,
-      313,  607,  607,  607,  607,  855,  607,  607,  607,  607,
-      617,  607,  607,  607,  607,  607,  607,  839,  607,  853,
-
-      857,  144,  854,  144,  144,  144,  144,  615,  607,  607,
-      607,  607,  607,  611,  855,  856,  144,  144,  840,  144,
-      862,  144,  144,  144,  142,  859,  839,  860,  144,  857,
-      144,  858,  314,  144,  144,  864,  606,  863, 1593,  144,
-      607,  607,  616, 1593,  856,  144,  144,  840,  144,  862,
-      144,  144,  144, 1800,  859,  866,  860,  144, 1800,  144,
-      858,  870,  144,  144,  864,  867,  863,  144,  144,  607,
-      607,  123,  123,  124,  123,  123,  123,  123,  868,  144,
-      123,  123,  123,  123,  866,  123,  607,  607,  144,  869,
-      870,  144,  144,  605,  867,  604,  144,  123,  123,  871,
-
-      607,  607,  603,  127,  602,  607,  144,  868,  144, 1563,
-      319, 1563, 1563,  144,  607,  607,  873,  144,  869,  607,
-      916,  623,  623,  493,  324,  346,  917,  144,  871,  607,
-      874,  361,  153,  623, 1221,  144,  130, 1221,  329,  921,
-      144,  130,  144, 2268,  875,  623,  492,  926,  131,  916,
-      379, 2269,  131,  144,  144,  917,  144,  131,  477,  123,
-      123,  123,  123,  124,  123,  123,  123,  123,  921,  144,
-      123,  123,  123,  123,  879,  123,  926,  625,  625,  880,
-      623,  453,  144,  144,  379,  346,  153,  123,  123,  625,
-      144,  960, 1040,  127, 1040, 1040,  131, 1041,  684, 2210,
-
-     2210,  625,  131,  879,  929,  685,  144,  140,  880,  881,
-      882,  883,  884,  884,  884,  884,  884, 2219, 2219,  144,
-      960,  361,  131,  131,  633,  633,  633,  633,  633,  633,
-      633,  633, 1925,  929,  133,  144,  625, 1925,  131,  892,
-      892,  892,  892,  892,  892,  892,  892,  941,  131,  123,
-      123,  123,  123,  124,  123,  123,  123,  123, 2369, 2369,
-      123,  123,  123,  123,  632,  123,  372,  372,  372,  372,
-      372,  372,  372,  372, 2419, 2419,  941,  123,  123,  144,
-      131,  930,  632,  123,  372,  372,  372,  372,  372,  372,
-      372,  372, 1537,  121, 1537, 1537,  343,  632,  131,  372,
-
-      372,  372,  372,  372,  372,  633,  633,  144,  144,  144,
-      930,  363,  376,  131,  885,  885,  885,  885,  885,  885,
-      885,  885,  142,  893,  893,  893,  893,  893,  894,  895,
-      895, 1563,  314, 1563, 1563,  144,  144,  144,  144,  123,
-      123,  123,  123,  124,  123,  123,  123,  123, 2424, 2424,
-      123,  123,  123,  123, 2702,  123,  896,  896,  896,  896,
-      896,  896,  896,  896,  144,  314,  144,  123,  123,  144,
-      144,  144,  149,  123,  897,  897,  897,  897,  897,  897,
-      897,  897,  898,  899,  900,  901,  901,  901,  901,  901,
-      904,  905,  906,  907,  907,  907,  907,  907,  144,  144,
-
-      144,  363,  909,  909,  909,  909,  909,  909,  909,  909,
-      648,  119,  910,  910,  910,  910,  910,  910,  910,  910,
-      130, 2702,  144, 1353, 1354, 1355, 2152, 2154, 1934,  123,
-      123,  139,  139, 1934, 2012, 2016,  131,  139, 2702,  139,
-      376,  139,  637,  637,  637,  637,  637,  637,  637,  637,
-      142,  144,  139,  139,  139,  139,  131,  638,  638,  638,
-      638,  638,  638,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  139,  139,  139,  638,  638,  638,  638,
-      638,  638,  144,  144,  144,  144,  144,  144,  144,  144,
-
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  144,  383,  642,  643,  644,  645,  645,  645,  645,
-      645,  914,  918,  927,  144,  144,  144,  928,  646,  646,
-      646,  646,  646,  646, 1143, 1144, 1145, 1146, 1146, 1146,
-     1146, 1146, 1910, 2702, 1910, 1910,  144,  144,  144,  961,
-      914,  918,  927,  144,  144,  144,  928,  646,  646,  646,
-      646,  646,  646,  648,  383,  649,  649,  649,  649,  649,
-      649,  649,  649,  650,  920,  144,  144,  144,  961,  144,
-      651,  651,  651,  651,  651,  651, 1129, 2702, 1130, 1130,
-     1130, 1130, 1130, 1130, 1130, 1130, 2702, 2266, 2702,  144,
-
-      144,  142,  131,  920, 1879, 2267, 1879, 1879,  144,  651,
-      651,  651,  651,  651,  651,  153,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  196,  911,  144,  144,  144,
-      144,  933,  144,  144,  144,  144,  144,  144,  915,  144,
-      658, 1910, 2702, 1910, 1910,  144, 1148, 1148, 1148, 1148,
-     1148, 1148, 1148, 1148, 2702,  911,  144, 2429, 2429,  144,
-      933,  144,  144,  144,  144,  144,  144,  915,  144,  658,
-      313,  313,  313,  313, 2702,  313,  313,  313,  313,  313,
-      313,  313,  313,  313,  313,  931,  321,  313,  163,  142,
-      144,  932,  976, 2702, 2268,  144,  314,  313,  313,  313,
-
-      313,  313, 2269,  144,  144,  144,  144,  144,  144,  912,
-      936,  934,  922,  925,  931,  935,  913,  937,  923,  144,
-      932,  144,  924,  938,  144, 2702, 1004,  144, 1005,  313,
-      313,  313,  144,  144,  144,  144,  144,  144,  912,  936,
-      934,  922,  925, 1943,  935,  913,  937,  923, 1943,  939,
-      144,  924,  938,  144,  144, 1004,  144, 1005,  313,  313,
-      607,  607,  607,  607,  950,  607,  607,  607,  607,  144,
-      607,  607,  607,  607,  607,  607, 2702,  607,  939,  142,
-      940,  951,  144,  144,  144,  144,  615,  607,  607,  607,
-      607,  607,  872,  950,  144,  952,  953,  954,  144,  144,
-
-      144,  144,  144,  144,  959,  955,  956,  144,  958,  940,
-      951,  144,  144,  144,  144,  962,  990, 2119,  957,  607,
-      607,  616, 2119,  144,  952,  953,  954, 2702,  144,  144,
-      144,  144,  144,  959,  955,  956,  144,  958, 2434, 2434,
-      144,  144, 1000, 1001,  962,  990,  144,  957,  607,  607,
-      648,  383,  889,  889,  889,  889,  889,  889,  889,  889,
-      890,  144,  965,  144,  963, 1016, 2702,  891,  891,  891,
-      891,  891,  891, 2702,  966,  144,  966,  966, 2393,  967,
-     2393, 2393, 2702,  144,  144, 2702,  971, 2439, 2439, 2702,
-      144,  965,  144,  963, 1016,  964,  891,  891,  891,  891,
-
-      891,  891,  383,  902,  902,  902,  902,  902,  902,  902,
-      902,  650,  144,  144,  144,  971,  144,  972,  903,  903,
-      903,  903,  903,  903,  964,  970,  968,  969,  977,  974,
-      975,  144, 2702,  978,  973,  144,  144,  979,  144, 2702,
-      144,  144,  993,  144, 1018,  144,  144,  903,  903,  903,
-      903,  903,  903,  942,  970,  968,  969,  977,  974,  975,
-      144,  943,  978,  973,  144,  144,  979,  144,  144,  144,
-      144,  993,  144, 1018,  144,  144,  982,  144, 2277,  980,
-      144,  981,  983,  985,  144, 2702, 2150,  989,  944,  945,
-      984, 1323, 2702, 1323, 1323,  946, 1095,  144,  144,  994,
-
-      947,  144,  948,  144,  949,  982,  144,  144,  980,  144,
-      981,  983,  144,  144,  986,  987,  989,  944,  945,  984,
-      144, 1006,  991,  144,  946,  144, 2702,  144,  994,  947,
-      988,  948,  998,  949,  995,  992,  144,  144,  997,  144,
-      996,  144,  144,  986,  987,  144,  144,  144, 1003,  144,
-     1008,  991,  144, 1002,  144,  999,  144, 1007,  144,  988,
-     2198,  998, 1012,  995,  992, 2198,  144,  997,  144,  996,
-      144,  144, 1009,  144,  144,  144,  144, 1003,  144, 1008,
-     2702, 1011, 1002,  144,  999,  144, 1007,  144,  144, 1010,
-     1014, 1012, 1019,  144,  144,  144, 1021,  144,  144,  144,
-
-      144, 1009,  144, 1013, 1017,  144, 1015,  144,  144, 1022,
-     1011, 1020,  144,  144, 1024,  144, 1026,  144, 1010, 1014,
-      144, 1019,  144,  144,  144, 1021,  144,  144,  144,  144,
-      144, 1023, 1013, 1017,  144, 1015,  144,  144, 1022, 1025,
-     1020,  779,  144, 1024,  144, 1026, 1028,  144,  144,  144,
-      144, 1027,  144, 1035,  144, 1030, 1032,  144, 1033,  144,
-     1023, 1031, 2702,  144,  144,  144,  144, 1036, 1025, 2702,
-     1034,  144, 1042,  144, 1029, 1028,  144,  144, 1043,  144,
-     1027,  144, 1035,  144, 1030, 1032, 1040, 1033, 1040, 1040,
-     1031, 1041,  144,  144, 1037,  144, 1036, 2702, 1038, 1034,
-
-      144, 1042,  144, 1029, 1044, 1045, 1046, 1043,  144,  144,
-      144, 1048, 1039, 1047,  144,  144,  144, 1049, 1052, 1050,
-     1051,  144,  144, 1037,  144,  144,  144, 1038, 1056, 2702,
-     1054, 1053,  144, 1044, 1045, 1046,  144,  144,  144,  144,
-     1048, 1039, 1047,  144,  144,  144,  144, 1052, 1057, 1051,
-      144,  144,  144,  144,  144,  144,  144, 1056, 1055, 1054,
-     1053,  144, 1060,  144, 1062,  144,  144,  144, 1064, 1059,
-      144, 1063,  144, 1061,  144,  144,  144, 2702, 1066, 2702,
-     1058,  144,  144, 1065, 1067,  144, 1068, 1055,  144, 2495,
-     2495, 1060,  144, 1062,  144,  144,  144, 1064, 1059,  144,
-
-     1063,  144, 1061,  144, 1069,  144, 1070, 1066, 1071, 1058,
-      144,  144, 1065, 1067,  144, 1068,  144,  144, 1074,  144,
-      144,  144,  144,  144, 1073, 1072, 1077, 1078,  144, 1075,
-      144, 1076, 1079, 1069, 1080, 1070,  144, 1071,  144,  144,
-     1083, 1085,  144,  144,  144,  144,  144, 1074,  144,  144,
-      144,  144,  144, 1073, 1072, 1077, 1078,  144, 1075,  144,
-     1076, 1079, 1081, 1080,  144,  144,  144,  144, 1084, 1083,
-     1085,  144,  144,  144, 1082,  144,  144,  838, 1088,  144,
-      838,  144, 1092, 1089, 1090, 1104,  144, 2207,  144, 2216,
-     1091, 1081, 2207,  144, 2216,  144, 1099, 1084, 1093,  144,
-
-      144,  144, 1100, 1082,  144,  144,  144, 1088,  144, 1103,
-      144, 1092, 1086, 1087, 1104,  144, 1101,  144, 1094, 1091,
-     1094, 1094, 1102, 1095,  144, 1099,  144, 1093,  144,  144,
-     2702, 1100, 1108,  144,  144,  144, 2702,  144, 1103,  144,
-     2152, 1086, 1087, 1106, 1105, 1101, 1096, 1107, 2012, 2702,
-      144, 1102,  144,  144,  144,  144,  144,  144,  144, 1109,
-     1110, 2702, 1111,  144,  144, 1097,  144, 1112, 1113, 1098,
-     1114, 1119, 1106, 1105,  144,  144, 1107,  144, 1116,  144,
-      144,  144, 1115,  144, 2702,  144,  144,  144, 1109, 1110,
-     1117, 1111,  144,  144, 1097,  144, 1112, 1113, 1098, 1114,
-
-     1119,  144, 1118,  144,  144,  144,  144, 1116,  144,  144,
-      144, 1115, 1122, 1120, 1121, 1174, 1124,  144, 1123, 1117,
-      144,  144, 2702, 1537,  144, 1537, 1537, 2154, 1314, 1168,
-      144, 1118, 1178, 1169,  144, 2016,  163,  144, 2702,  144,
-     2702, 1122, 1120, 1121, 1174, 1124,  144, 1123, 1129,  144,
-     1131, 1131, 1131, 1131, 1131, 1132,  881,  881, 1168, 2702,
-      144, 1178, 1169, 1129,  131,  881,  881,  881,  881,  881,
-      881,  881,  881,  144, 2393, 2702, 2393, 2393,  376,  131,
-      885,  885,  885,  885,  885,  885,  885,  885,  648,  144,
-     1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 2540, 2540,
-
-     2702, 2702,  144,  144, 1150, 1150, 1150, 1150, 1150, 1150,
-     1150, 1150, 1151, 1193, 1152, 1152, 1152, 1152, 1152, 1152,
-     1152, 1152, 1151, 2702, 1153, 1153, 1153, 1153, 1153, 1154,
-      898,  898,  144,  383, 1136, 1137, 1138, 1139, 1139, 1139,
-     1139, 1139, 1193, 2702, 1172, 1194, 1195, 1196,  144, 1140,
-     1140, 1140, 1140, 1140, 1140, 1151, 2702,  898,  898,  898,
-      898,  898,  898,  898,  898, 1157, 1157, 1157, 1157, 1157,
-     1157, 1157, 1157, 1172, 1194, 1195, 1196,  144, 1140, 1140,
-     1140, 1140, 1140, 1140,  383, 1141, 1141, 1141, 1141, 1141,
-     1141, 1141, 1141,  890,  144, 1179, 1200, 1201,  144, 1167,
-
-     1142, 1142, 1142, 1142, 1142, 1142, 1162, 1162, 1162, 1162,
-     1162, 1162, 1162, 1162, 1163, 1163, 1163, 1163, 1163, 1164,
-     1165, 1165, 2702,  144, 1179, 1200, 1201,  144, 1167, 1142,
-     1142, 1142, 1142, 1142, 1142,  383, 1155, 1155, 1155, 1155,
-     1155, 1155, 1155, 1155,  650,  144,  144,  144,  144, 1190,
-     1175, 1156, 1156, 1156, 1156, 1156, 1156, 1356, 1357, 1358,
-     1359, 1359, 1359, 1359, 1359, 2476, 2702, 2225,  144,  144,
-     2702,  131, 2225, 2477,  144,  144,  144,  144, 1190, 1175,
-     1156, 1156, 1156, 1156, 1156, 1156, 1158,  383, 1159, 1159,
-     1159, 1159, 1159, 1159, 1159, 1159, 1160,  144,  144,  144,
-
-      144,  144,  144, 1161, 1161, 1161, 1161, 1161, 1161, 1166,
-     1170, 1171, 1173,  144, 1176, 1180, 2702, 1181,  144,  144,
-      144,  144, 1182, 2702, 1177, 1182, 2702, 1184,  144,  144,
-      144,  144, 1161, 1161, 1161, 1161, 1161, 1161, 1166, 1170,
-     1171, 1173,  144, 1176, 1180,  144, 1181,  144,  144,  144,
-      144,  144,  144, 1177, 1185,  144, 1184,  144, 2702, 1191,
-      144,  144,  144, 1188, 1186,  144, 1192, 1187, 1189,  144,
-     1202,  144, 1183, 1216,  144, 2702, 1203, 1197,  144, 1204,
-      144,  144, 1198, 1185,  144, 2702,  144, 1199, 1191,  144,
-      144,  144, 1188, 1186,  144, 1192, 1187, 1189,  144, 1202,
-
-      144, 1183, 1216, 2702,  144, 1203, 1197,  144, 1204, 1205,
-      144, 1198, 1207, 1206,  144,  144, 1199,  144, 1208,  144,
-     1210, 1211,  144, 1209,  144,  144,  144, 1217, 2702,  144,
-     1212,  144, 1218,  144,  144, 1213, 1214,  144, 1205,  144,
-     1215, 1207, 1206,  144,  144, 2702,  144, 1208,  144, 1210,
-     1211,  144, 1209,  144,  144,  144, 1217,  144,  144, 1212,
-      144, 1218,  144,  144, 1213, 1214,  144, 1220, 1219, 1215,
-     1222,  144,  144, 1223, 1224, 1225, 1227,  144, 1226,  144,
-      144, 1226, 1228, 1229,  144,  144,  144,  144, 1231, 2702,
-      144,  144,  144, 1230, 1232,  144, 1220, 1219,  144, 1222,
-
-      144,  144, 1223, 1224, 1225, 1227,  144, 1237,  144,  144,
-     1233, 1228, 1229,  144,  144,  144,  144, 1231,  144,  144,
-      144,  144, 1230, 1232,  144, 1236,  144,  144,  144,  144,
-     1234, 1235, 1238,  144,  144,  144, 1237,  144,  144, 1233,
-      144, 2702,  144, 2702,  144, 1243, 1240,  144, 1241,  144,
-     1239, 1248,  144, 1242, 1236,  144, 1244,  144,  144, 1234,
-     1235, 1238,  144,  144,  144, 2702,  144,  144,  153,  144,
-      144,  144, 1246, 1247, 1243, 1240,  144, 1241,  144, 1239,
-     1248,  144, 1242, 1251,  131, 1244,  144, 1249,  144,  144,
-     1245, 1253,  144,  144, 1256, 1254, 1255, 1258,  144,  144,
-
-      144, 1246, 1247,  144, 1250,  144, 1260,  144, 1252, 2702,
-      144,  144, 1251, 1259, 1257,  144, 1249,  144,  144, 1245,
-     1253,  144,  144, 1256, 1254, 1255, 1258,  144,  144,  144,
-      144,  144,  144, 1250, 1265, 1260,  144, 1252, 1261,  144,
-      144, 1262, 1259, 1257,  144, 1263,  144, 1267,  144,  144,
-      144,  144, 2702, 1264, 2702, 1266, 1269,  144,  144,  144,
-      144, 1268, 1270, 1265,  144,  144,  144, 1261, 1281, 1271,
-     1262, 1272,  144,  144, 1263,  144, 1267,  144,  144,  144,
-      144, 1274, 1264, 1273, 1266, 1269,  144,  144,  144,  144,
-     1268, 1270,  144,  144, 1276,  144, 1277, 1281, 1271,  144,
-
-     1272,  144, 1275,  144,  144,  144, 1278,  144, 1279,  144,
-     1274, 1284, 1273,  144, 1280,  144, 1282,  144,  144,  144,
-     1286,  144, 1285, 1276,  144, 1277,  144,  144,  144, 1287,
-      144, 1275,  144,  144,  144, 1278,  144, 1279,  144, 1283,
-     1284,  153,  144, 1280,  144, 1282, 1290,  144,  144, 1286,
-      144, 1285, 1289,  144,  144,  144,  144,  131, 1287,  144,
-      144, 1293, 1295,  144, 2702, 1291,  144,  144, 1283,  144,
-      144, 1292, 1288,  144, 1294, 1290,  144, 1297, 1298,  144,
-      144, 1289, 1302,  144,  144, 1304,  144,  144,  144,  144,
-     1293, 1296,  144, 1299, 1291,  144,  144, 1301,  144,  144,
-
-     1292, 1288, 1300, 1294, 1305,  144, 1297, 1298,  144,  144,
-      144, 1302, 1307,  144, 1304,  144,  144,  144,  144, 1303,
-     1296,  144, 1299,  144,  144, 1306, 1301,  144,  144,  144,
-      144, 1300, 1310, 1305,  144, 1308, 1311,  144,  144,  144,
-     1309, 1307,  144,  144, 1325, 2702, 2375,  144, 1303, 1312,
-      144, 2375,  144,  144, 1306, 2702,  144,  144,  144,  144,
-     1319, 1310, 2702,  144, 1308, 1311,  144,  144, 2702, 1309,
-      144,  144,  144, 1325, 1313, 1324, 1313, 1313, 1312, 1314,
-     1320, 2421, 1094,  144, 1094, 1094, 2421, 1095, 1323, 1319,
-     1323, 1323,  144, 1327, 1329,  144, 2702,  144, 2702,  144,
-
-     2426, 1326, 1315,  153, 1324, 2426, 1328,  144,  144, 1320,
-     1321, 2702,  144,  144,  144,  144, 1330, 1316,  144,  131,
-     1331, 1317, 1327, 1329, 1341, 1318,  144, 1332,  144, 1322,
-     1326, 1342,  144, 2431, 1338, 1328,  144,  144, 2431,  144,
-     1333,  144,  144,  144,  144, 1330, 1316,  144, 2702, 1331,
-     1317, 1345, 1334, 1341, 1318, 2702, 1332,  144, 1322,  144,
-     1342,  144, 1335, 1336, 1337, 1339,  144, 1343,  144, 1333,
-      144,  144,  144, 1344,  144, 1340,  144,  144, 1348,  144,
-     1345, 1334,  144, 1349,  144, 1347,  144, 1350,  144,  144,
-      144,  144, 1346,  144, 1339,  144, 1343, 1403, 1351, 2702,
-
-      144,  144, 1344,  144, 1340,  144,  144, 1348,  144,  144,
-     1407,  144, 1349,  144, 1347,  144, 1350, 2702,  144,  144,
-      144, 1346,  144,  144, 1409,  144, 1129, 1351,  881,  881,
-      881,  881,  881,  881,  881,  881, 2702, 2702,  144, 1407,
-     2702, 1129,  131,  881,  881,  881,  881,  881,  881,  881,
-      881, 2702,  144, 1409,  144, 2702, 1129,  131,  881,  881,
-      881,  881,  881,  881, 1366, 1366, 1366, 1366, 1366, 1366,
-     1366, 1366,  131,  648,  383, 1363, 1363, 1363, 1363, 1363,
-     1363, 1363, 1363, 1364, 1369, 1369, 1369, 1369, 1369, 1369,
-     1365, 1365, 1365, 1365, 1365, 1365, 1367, 1367, 1367, 1367,
-
-     1367, 1368, 1369, 1369, 2702, 2702, 1370, 1370, 1370, 1370,
-     1370, 1370, 1370, 1370, 2702, 2702, 2702, 2702, 2702, 1365,
-     1365, 1365, 1365, 1365, 1365,  383, 1371, 1371, 1371, 1371,
-     1371, 1371, 1371, 1371,  890, 1380, 1380, 1380, 1380, 1380,
-     1380, 1372, 1372, 1372, 1372, 1372, 1372, 1373, 1373, 1373,
-     1373, 1373, 1373, 1373, 1373, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1614, 1614, 1614, 1614, 1614, 1614, 2702,
-     1372, 1372, 1372, 1372, 1372, 1372, 1158,  383, 1374, 1374,
-     1374, 1374, 1374, 1374, 1374, 1374, 1375, 1402, 1420, 1425,
-     1428,  144,  144, 1376, 1376, 1376, 1376, 1376, 1376, 1378,
-
-     1378, 1378, 1378, 1378, 1379, 1380, 1380, 1381, 1382, 1383,
-     1384, 1384, 1384, 1384, 1384, 2702, 1402, 1420, 1425, 1428,
-      144,  144, 1376, 1376, 1376, 1376, 1376, 1376, 1151, 2702,
-      898,  898,  898,  898,  898,  898,  898,  898, 1151, 2702,
-      898,  898,  898,  898,  898,  898,  898,  898, 1151, 2702,
-      898,  898,  898,  898,  898,  898,  383, 1385, 1385, 1385,
-     1385, 1385, 1385, 1385, 1385,  650,  383,  647,  647,  647,
-      647,  647,  647,  647,  647,  650,  383, 1385, 1385, 1385,
-     1385, 1385, 1385, 1385, 1385,  650, 1386, 1387, 1388, 1389,
-     1389, 1389, 1389, 1389,  383, 1390, 1390, 1390, 1390, 1390,
-
-     1390, 1390, 1390, 1160, 1423, 1429, 1430, 1431,  144, 1399,
-     1391, 1391, 1391, 1391, 1391, 1391, 1392, 1393, 1394, 1395,
-     1395, 1395, 1395, 1395, 1397, 1397, 1397, 1397, 1397, 1397,
-     1397, 1397, 2702, 1423, 1429, 1430, 1431,  144, 2702, 1391,
-     1391, 1391, 1391, 1391, 1391, 1158,  144, 1398, 1398, 1398,
-     1398, 1398, 1398, 1398, 1398,  144,  144,  144, 1410,  144,
-      144,  144, 1432,  144, 2702,  144, 1400, 1401, 1404, 1405,
-     1406, 1411, 1408, 1421, 1434,  144,  144, 1419,  640,  640,
-      144, 1433, 1435,  640,  144,  144,  144, 1422,  144,  144,
-      144, 1432,  144,  144,  144, 1400, 1401, 1404, 1405, 1406,
-
-     1424, 1408, 1421, 1412,  144,  144, 1419,  144,  144,  144,
-     1433, 1444, 1437,  144,  144, 1426, 1422,  144, 1427,  144,
-     1438, 1436,  144, 1441,  144, 1445, 1452, 1450, 2702, 1424,
-     2702, 1442, 1412,  144, 2702, 1446,  144,  144, 1182,  144,
-     1444, 1182,  144,  144, 1426, 1439,  144, 1427,  144, 1451,
-     1436, 1449,  144,  144, 1445,  144, 1450,  144, 1440, 1447,
-     1443, 1454, 1447,  144, 1446,  144, 1466,  144,  144, 1455,
-     2702,  144, 2702, 1413, 1439, 1414,  144, 1415, 1451, 1453,
-     1449,  144, 1456, 1416,  144, 1417,  144, 1440, 1418, 1443,
-     1454, 2702,  144, 1457,  144, 1466,  144,  144, 1455,  144,
-
-      144,  144, 1413,  144, 1414,  144, 1415, 1459, 1453, 1448,
-      144, 1456, 1416, 1460, 1417, 1458,  144, 1418,  144,  144,
-      144,  144, 1457, 1467,  144, 1464,  144, 1461,  144, 1463,
-      144, 1462,  144,  144,  144, 1470, 1459,  144, 1448,  144,
-     1469, 1465, 1460,  144, 1458,  144,  144,  144,  144,  144,
-      144, 1468, 1467,  144, 1464,  144, 1461, 1472, 1463, 1474,
-     1462,  144,  144,  144, 1470,  144,  144,  144, 1471, 1469,
-     1465, 1477,  144,  144, 1476,  144, 1473, 1475,  144,  144,
-     1468,  144,  153,  144,  144, 2702, 1472,  144, 1474,  144,
-      144, 2702, 1479,  144,  144,  144,  144, 1471,  131,  144,
-
-     1477, 1481,  144, 1476, 1480, 1473, 1475,  144,  144,  144,
-      144,  144,  144, 1478, 1483,  144,  144,  144,  144, 1484,
-     1482, 1479,  144,  144,  144, 1485, 1487, 1486,  144,  144,
-     1481, 1488,  144, 1480, 1489,  144, 1494, 2702,  144, 2702,
-      144,  144, 1478, 1483,  144,  144,  144, 1490, 1484, 1482,
-      144,  144,  144, 1497, 1485, 1487, 1486,  144,  144, 1495,
-     1492,  144, 1491, 1489,  144, 1494,  144,  144,  144,  144,
-      144,  144,  144, 2702,  144, 1496, 1490, 1493, 1499,  144,
-      144, 1498, 1497, 2702,  144, 1505,  144,  144, 1495, 1492,
-     1503, 1491, 2702, 1504,  144,  144,  144,  144,  144, 1506,
-
-      144,  144, 1500,  144, 1496,  144, 1493,  144, 1501,  144,
-     1498,  144, 1502,  144, 1505, 1508,  144, 1509, 1507, 1503,
-      144,  144, 1504,  144, 1510,  144, 1511,  144, 1506, 1512,
-      144, 1500,  144, 1513,  144,  153,  144, 1501,  144,  144,
-      144, 1502, 1515,  144, 1508,  144, 1509, 1507, 1520,  144,
-      144,  131, 1516, 1510,  144, 1511,  144, 1517, 1512,  144,
-     1518,  144, 1513,  153,  144, 1514,  144,  144,  144, 1522,
-     2702, 1515,  144,  144,  144,  144,  144, 1520, 1521,  131,
-      144, 1516,  144, 1527, 1523,  144, 1517, 1524,  144, 1518,
-      144,  144, 1525,  144, 1514,  144,  144,  144, 1522, 1519,
-
-     1530, 1531,  144,  144,  144,  144, 1532, 1521, 1526,  144,
-     1528,  144, 1527, 1523,  144, 1529, 1524,  144, 1533,  144,
-      144, 1525, 2702, 2702, 1538,  144,  144,  144, 1519, 1530,
-     1531, 1534,  144, 1540, 1541, 1532, 1539, 1526, 1313, 1528,
-     1313, 1313,  144, 1314, 1529, 1542,  144, 1533,  144, 1537,
-     1544, 1537, 1537, 1538,  144,  144,  144,  144,  144,  144,
-     1534, 1543, 1540, 1541,  153, 1539, 1535, 1546, 1545,  144,
-     1547,  144,  144,  144, 1542,  144,  144,  144,  144, 1544,
-      131,  144,  144, 1548,  144, 1536,  144,  144,  144,  144,
-     1543, 2702, 1549,  144, 1551, 1550, 1546, 1545,  144, 1547,
-
-     1553,  144,  144,  144, 1552,  144,  144,  144,  144, 1554,
-      144,  144, 1548,  144, 1536,  144, 1557,  144,  144, 1555,
-      144, 1549,  144, 1551, 1550,  144, 1556,  144, 1615, 1553,
-      144, 1558,  144, 1552,  144, 1559,  144,  144, 1554,  144,
-     1560, 1561,  144, 2277,  144, 1557,  144,  144, 1555,  144,
-     2702, 2150, 2702, 2702,  144, 1556,  144, 1615, 1562,  144,
-     1558,  144,  144,  144, 1559,  144,  886,  886,  144, 1560,
-     1561,  886,  153,  144,  144, 1623,  144, 1564, 1565, 1565,
-     1565, 1565, 1565, 1565, 1565, 1565, 2702, 1562,  131, 1616,
-      144,  144,  131, 1564, 1566, 1566, 1566, 1566, 1566, 1566,
-
-     1566, 1566,  144,  144, 1623,  144, 1626, 1618,  131, 1564,
-     1567, 1567, 1567, 1567, 1567, 1568, 1569, 1569, 1616, 2702,
-     2702, 2702, 2702, 2702,  131, 1564, 1569, 1569, 1569, 1569,
-     1569, 1569, 1569, 1569,  144, 1626, 1618, 2702, 2702, 2702,
-      131,  383, 1573, 1574, 1575, 1576, 1576, 1576, 1576, 1576,
-      144, 1620, 1624, 1617,  144, 1627, 1625, 1577, 1577, 1577,
-     1577, 1577, 1577, 1580, 1581, 1582, 1583, 1583, 1583, 1583,
-     1583, 1585, 1585, 1585, 1585, 1585, 1585, 1585, 1585,  144,
-     1620, 1624, 1617,  144, 1627, 1625, 1577, 1577, 1577, 1577,
-     1577, 1577,  383, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
-
-     1578, 1364, 2702, 2702, 2702, 1628, 1629, 1630, 1579, 1579,
-     1579, 1579, 1579, 1579,  648, 2702, 1586, 1586, 1586, 1586,
-     1586, 1586, 1586, 1586,  383, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385,  890, 1628, 1629, 1630, 1579, 1579, 1579,
-     1579, 1579, 1579,  383,  647,  647,  647,  647,  647,  647,
-      647,  647,  890,  383, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385,  890,  383, 1587, 1587, 1587, 1587, 1587, 1587,
-     1587, 1587, 1375,  144,  144,  144, 1637, 1631, 1633, 1588,
-     1588, 1588, 1588, 1588, 1588, 1589, 1590, 1591, 1592, 1592,
-     1592, 1592, 1592, 1594, 1594, 1594, 1594, 1594, 1594, 1594,
-
-     1594, 2702,  144,  144,  144, 1637, 1631, 1633, 1588, 1588,
-     1588, 1588, 1588, 1588, 1158, 2702, 1595, 1595, 1595, 1595,
-     1595, 1595, 1595, 1595, 1596, 2702, 1597, 1597, 1597, 1597,
-     1597, 1597, 1597, 1597, 1596, 2702, 1598, 1598, 1598, 1598,
-     1598, 1599, 1381, 1381, 1596, 2702, 1381, 1381, 1381, 1381,
-     1381, 1381, 1381, 1381,  897,  897,  897,  897,  897,  897,
-      897,  897, 1600, 2702, 1601, 1601, 1601, 1601, 1601, 1601,
-     1601, 1601, 1600, 2702, 1602, 1602, 1602, 1602, 1602, 1603,
-     1386, 1386, 1600, 2702, 1386, 1386, 1386, 1386, 1386, 1386,
-     1386, 1386,  383, 1604, 1604, 1604, 1604, 1604, 1604, 1604,
-
-     1604, 1160,  144,  144, 1638, 1639, 1640, 1632, 1605, 1605,
-     1605, 1605, 1605, 1605, 1606, 1606, 1606, 1606, 1606, 1606,
-     1606, 1606, 1611, 1611, 1611, 1611, 1611, 1611, 1611, 1611,
-     2702,  144,  144, 1638, 1639, 1640, 1632, 1605, 1605, 1605,
-     1605, 1605, 1605, 1607,  383, 1608, 1608, 1608, 1608, 1608,
-     1608, 1608, 1608, 1609, 1635, 1641, 2702, 1642,  144,  144,
-     1610, 1610, 1610, 1610, 1610, 1610, 1612, 1612, 1612, 1612,
-     1612, 1613, 1614, 1614,  144, 1621, 1622,  144, 1643, 2702,
-      144, 1636,  144, 1635, 1641, 1619, 1642,  144,  144, 1610,
-     1610, 1610, 1610, 1610, 1610, 1634, 1645, 1646, 1647, 1648,
-
-     1434,  144,  144,  144, 1621, 1622,  144, 1643, 1435,  144,
-     1636,  144, 1447, 1447, 1619, 1447, 1447, 1650, 1652, 1452,
-     1650,  144, 2702,  144, 1634, 1645, 1646, 1647, 1648, 2476,
-      144,  144, 1651,  144, 1654,  144,  144, 2477,  144,  966,
-     1659,  966,  966,  144,  967, 1655,  144, 1652, 1644,  144,
-      144, 1656,  144,  144, 1657, 1664, 1660,  144, 1649,  144,
-      144, 1651,  144, 1654,  144,  144, 1653,  144,  144, 1659,
-     1658, 1661,  144, 2702, 1655,  144, 1662, 1644,  144,  144,
-     1656,  144,  144, 1657, 1664, 1660,  144, 1649,  144,  144,
-     1663,  144,  144,  144,  144, 1653,  144,  144, 1667, 1658,
-
-     1661,  144, 1665, 1666,  144, 1662, 1671,  144,  144, 1668,
-      144, 1669, 1670, 1672, 1680,  144,  144,  144,  153, 1663,
-      144,  144,  144,  144,  144,  144, 2702, 1667, 1673,  144,
-      144, 1665, 1666,  144,  131, 1678,  144, 1675, 1668,  144,
-     1669, 1670, 1677,  144,  144,  144,  144, 1676, 1681,  144,
-      144, 1679, 1674,  144,  144,  144,  144, 1673,  144, 1682,
-     1683,  144,  144,  144, 1678,  144, 1675,  144,  144, 1686,
-      144, 1677,  144, 1684, 2702,  144, 1676, 1681,  144,  144,
-     1679, 1674,  144,  144,  144,  144, 1685,  144, 1682, 1683,
-      144,  144,  144, 1688,  144,  144,  144,  144, 1686,  144,
-
-     1687, 1689, 1684,  153,  144,  144,  144, 1499, 1693, 2702,
-     1691,  144,  144,  144,  144, 1685,  144, 1694, 1692,  131,
-      144, 1695, 1688,  144,  144, 1696,  144, 1697,  144, 1687,
-     1689,  144,  144,  144,  144,  144, 1701, 1693, 1690, 1691,
-     1717,  144,  144,  144, 1703,  144, 1694, 1692,  153,  144,
-     1695, 1698,  144,  144, 1696, 1699, 1700,  144, 2702, 1704,
-      144,  144,  144,  144,  131, 1701,  144, 1690,  144, 1717,
-      153,  144, 2702, 1703,  144, 1705, 1702, 1706,  144,  144,
-     1698, 1709,  144, 1708, 1699, 1700,  131, 1710, 1704,  144,
-     2702,  144,  144, 2702, 1719,  144, 1721,  144,  144, 1720,
-
-      144, 1707,  144,  144, 1705, 1702, 1706,  144,  144, 1724,
-     1709, 1723, 1708, 1725, 1718, 2702, 1710,  144,  144, 1711,
-      144, 1711, 1711, 1719, 1712, 1726,  144,  144, 1720, 1727,
-     1707,  144,  144,  144, 1732,  144,  887,  887, 1724, 1728,
-     1723,  887, 1725, 1718, 1722,  144,  144, 1713,  144,  144,
-      144, 1729, 1730, 1731, 1726,  144, 1734, 1735, 1727,  144,
-      144,  144,  144, 1732,  144, 1733, 1714,  144, 1728, 1715,
-     1716, 1736,  144, 1722,  144,  144, 1739,  144,  144,  144,
-     1729, 1730, 1731,  144, 1740, 1734, 1737,  144,  144,  144,
-      144, 1738,  144, 1747, 1733, 1714,  144,  144, 1715, 1716,
-
-     1736,  144,  144, 1746,  144, 1739, 1742,  144,  144, 1741,
-     1743,  144,  144, 1740, 1745, 1737,  144, 1744,  144,  144,
-     1738,  144, 1747, 1748, 1803,  144,  144,  144,  380,  380,
-      380,  144, 1746, 2702,  380, 1742,  144,  144, 1741, 1743,
-      144, 2702, 2702, 1745, 1133, 1133, 1744,  144,  144, 1133,
-     1134, 1134, 1748, 1803,  144, 1134,  144, 1565, 1565, 1565,
-     1565, 1565, 1565, 1565, 1565, 1760, 1760, 1760, 1760, 1760,
-     1760,  131, 1750, 1750, 1750, 1750, 1750, 1750, 1750, 1750,
-     1771, 1771, 1771, 1771, 1771, 1771,  131, 1564, 1569, 1569,
-     1569, 1569, 1569, 1569, 1569, 1569, 1781, 1781, 1781, 1781,
-
-     1781, 1781,  131, 1564, 1569, 1569, 1569, 1569, 1569, 1569,
-     1569, 1569, 2702, 2702, 2702, 2702, 1806,  144,  131, 1564,
-     1569, 1569, 1569, 1569, 1569, 1569, 1565, 1565,  153, 2702,
-     2702, 2702, 2702, 2702,  131, 1564, 1565, 1565, 1565, 1565,
-     1565, 1565, 1565, 1565,  131, 1806,  144, 2702, 2702, 2702,
-      131,  648,  383, 1754, 1754, 1754, 1754, 1754, 1754, 1754,
-     1754, 1755,  144, 1809, 1805, 1807, 1810, 1811, 1756, 1756,
-     1756, 1756, 1756, 1756, 1757, 1757, 1757, 1757, 1757, 1757,
-     1757, 1757, 1758, 1758, 1758, 1758, 1758, 1759, 1760, 1760,
-     2702,  144, 1809, 1805, 1807, 1810, 1811, 1756, 1756, 1756,
-
-     1756, 1756, 1756, 2702, 2702, 1761, 1761, 1761, 1761, 1761,
-     1761, 1761, 1761,  383, 1762, 1762, 1762, 1762, 1762, 1762,
-     1762, 1762, 1364, 1808, 1814, 1815, 1816, 1817,  144, 1763,
-     1763, 1763, 1763, 1763, 1763, 1764, 1764, 1764, 1764, 1764,
-     1764, 1764, 1764, 1768, 1768, 1768, 1768, 1768, 1768, 1768,
-     1768,  144, 1808, 1814, 1815, 1816, 1817,  144, 1763, 1763,
-     1763, 1763, 1763, 1763, 1158,  383, 1765, 1765, 1765, 1765,
-     1765, 1765, 1765, 1765, 1766,  144,  144, 1823, 1824, 1818,
-      144, 1767, 1767, 1767, 1767, 1767, 1767, 1769, 1769, 1769,
-     1769, 1769, 1770, 1771, 1771, 1774, 1774, 1774, 1774, 1774,
-
-     1774, 1774, 1774, 2702,  144,  144, 1823, 1824, 1818, 2702,
-     1767, 1767, 1767, 1767, 1767, 1767,  383, 1772, 1772, 1772,
-     1772, 1772, 1772, 1772, 1772, 1375,  144, 1825, 1828, 1821,
-     1829, 1830, 1773, 1773, 1773, 1773, 1773, 1773, 1778, 1778,
-     1778, 1778, 1778, 1778, 1778, 1778, 1779, 1779, 1779, 1779,
-     1779, 1780, 1781, 1781, 1833,  144, 1825, 1828, 1821, 1829,
-     1830, 1773, 1773, 1773, 1773, 1773, 1773, 1607,  383, 1775,
-     1775, 1775, 1775, 1775, 1775, 1775, 1775, 1776, 2702,  144,
-     1835,  144, 1836, 1833, 1777, 1777, 1777, 1777, 1777, 1777,
-     1782, 1783, 1784, 1785, 1785, 1785, 1785, 1785, 1596, 2702,
-
-     1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381,  144, 1835,
-      144, 1836, 2702, 1777, 1777, 1777, 1777, 1777, 1777, 1596,
-     2702, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1596,
-     2702, 1381, 1381, 1381, 1381, 1381, 1381, 1786, 1787, 1788,
-     1789, 1789, 1789, 1789, 1789, 1600, 2702, 1386, 1386, 1386,
-     1386, 1386, 1386, 1386, 1386, 1600, 2702, 1386, 1386, 1386,
-     1386, 1386, 1386, 1386, 1386, 1600, 2702, 1386, 1386, 1386,
-     1386, 1386, 1386,  383, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1160,  383,  647,  647,  647,  647,  647,  647,
-      647,  647, 1160,  383, 1385, 1385, 1385, 1385, 1385, 1385,
-
-     1385, 1385, 1160, 1790, 1791, 1792, 1793, 1793, 1793, 1793,
-     1793,  383, 1794, 1794, 1794, 1794, 1794, 1794, 1794, 1794,
-     1609, 1832, 2702, 1838,  144, 2702,  144, 1795, 1795, 1795,
-     1795, 1795, 1795, 1796, 1797, 1798, 1799, 1799, 1799, 1799,
-     1799, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 2702,
-     1832, 1650, 1838,  144, 1650,  144, 1795, 1795, 1795, 1795,
-     1795, 1795, 1607,  144, 1802, 1802, 1802, 1802, 1802, 1802,
-     1802, 1802,  139,  139,  144,  144, 2702, 1812,  139,  144,
-      139,  153,  139, 1813, 1822,  144, 1820, 2702, 1819, 1839,
-      144,  196,  144,  139,  139,  139,  139,  131, 1831, 2702,
-
-     1837, 1834, 2436,  144,  144,  685, 1812, 2436,  144,  144,
-      144, 1844, 1813, 1822,  144, 1820, 1842, 1819, 1839,  144,
-      453, 2702, 2702,  477,  139,  139,  139,  139,  139, 1837,
-     1834,  144,  144,  139, 2702,  139,  153,  139,  144,  144,
-     1844,  144,  144, 1840,  144, 1842,  196,  686,  139,  139,
-      139,  139,  131,  144, 1841, 1843,  144, 1848, 1804,  153,
-      144,  144, 1845,  144, 1846,  144, 1847,  144, 1849,  144,
-      144,  144, 1840,  144,  144,  131,  686, 1854,  144,  139,
-      139,  139,  144, 1841, 1843,  144, 1848, 1804, 1853,  144,
-      492, 1845,  144, 1846,  144, 1847,  144, 1849,  144,  144,
-
-      144, 1855,  144,  144, 1861,  144, 1854,  144, 1862, 1859,
-      144,  144, 1864,  144,  144,  144, 1860, 1853,  144,  144,
-      144,  144,  144, 1863, 1856, 2702, 2702, 1865,  144,  144,
-     1855,  144,  144, 1861,  144, 1866,  144, 1862, 1859,  144,
-      144, 1864,  144,  144,  144, 1860,  144,  153,  144,  144,
-      144,  144, 1863, 1856,  144, 1867, 1865, 1868,  144,  144,
-      153,  144, 1871,  131, 1866,  144,  144,  144, 1873, 1870,
-      144,  144, 2702,  144,  144,  144,  131, 1875,  144, 1869,
-     2441, 1876, 2702,  144, 1867, 2441, 1868,  144,  144,  144,
-     1879, 1871, 1879, 1879,  144,  144,  144, 1873, 1870,  144,
-
-      144, 1872,  144,  144,  144,  153, 1875,  144, 1869, 1711,
-     1876, 1711, 1711,  144, 1712, 1885, 1880,  144,  144,  144,
-     1881,  131, 1882,  144, 1883,  144, 1884, 2702,  144,  144,
-     1872, 1886, 1888,  144, 1887,  144, 1889, 1877, 1890, 1891,
-      144, 2702,  144, 1892, 1885, 1880,  144, 2702,  144, 1881,
-     1896, 1882,  144, 1883,  144, 1884, 1878,  144,  144, 1903,
-     1886, 1888, 1904, 1887,  144, 1889,  144, 1890, 1891,  144,
-      144, 1893, 1892, 1894,  144, 1895,  144,  144, 1897, 1896,
-     1901,  144,  144,  144,  144, 1878, 1898,  144, 1903, 1906,
-      144, 1904,  144, 1902,  144,  144, 1905, 1969,  144,  144,
-
-     1893, 1975, 1894,  144, 1895,  144,  144, 1897, 2702, 1901,
-     1907,  144,  144,  144,  144, 1898,  144,  144, 1906,  144,
-     2702,  144, 1902,  144,  153, 1905, 1969,  144, 1908, 1973,
-     1975, 1909, 1968, 1968, 1968, 1968, 1968, 1968, 2702, 1907,
-      131, 1971, 1976,  144, 2702,  144,  144, 1921, 1922, 1923,
-     1924, 1924, 1924, 1924, 1924, 2702, 2702, 1908, 1973, 2702,
-     1909,  383, 1914, 1915, 1916, 1917, 1917, 1917, 1917, 1917,
-     1971, 1976,  144, 1974,  144, 1977, 1978, 1918, 1918, 1918,
-     1918, 1918, 1918, 1926, 1926, 1926, 1926, 1926, 1926, 1926,
-     1926,  648, 2702, 1927, 1927, 1927, 1927, 1927, 1927, 1927,
-
-     1927,  144, 1974, 2702, 1977, 1978, 1918, 1918, 1918, 1918,
-     1918, 1918,  383, 1919, 1919, 1919, 1919, 1919, 1919, 1919,
-     1919, 1755, 2702, 2702, 2702, 1979, 1980, 1981, 1920, 1920,
-     1920, 1920, 1920, 1920,  383, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385, 1364,  383,  647,  647,  647,  647,  647,
-      647,  647,  647, 1364, 1979, 1980, 1981, 1920, 1920, 1920,
-     1920, 1920, 1920,  383, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1364,  383, 1928, 1928, 1928, 1928, 1928, 1928,
-     1928, 1928, 1766, 1982, 1984,  144, 1992, 1983, 1993, 1929,
-     1929, 1929, 1929, 1929, 1929, 1930, 1931, 1932, 1933, 1933,
-
-     1933, 1933, 1933, 1935, 1935, 1935, 1935, 1935, 1935, 1935,
-     1935, 2702, 1982, 1984,  144, 1992, 1983, 1993, 1929, 1929,
-     1929, 1929, 1929, 1929, 1158, 2702, 1936, 1936, 1936, 1936,
-     1936, 1936, 1936, 1936,  383, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385, 1375,  383,  647,  647,  647,  647,  647,
-      647,  647,  647, 1375,  383, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385, 1375,  383, 1937, 1937, 1937, 1937, 1937,
-     1937, 1937, 1937, 1776,  144, 1987, 1996, 1999, 2001, 2008,
-     1938, 1938, 1938, 1938, 1938, 1938, 1939, 1940, 1941, 1942,
-     1942, 1942, 1942, 1942, 1944, 1944, 1944, 1944, 1944, 1944,
-
-     1944, 1944, 2702,  144, 1987, 1996, 1999, 2001, 2008, 1938,
-     1938, 1938, 1938, 1938, 1938, 1607, 2702, 1945, 1945, 1945,
-     1945, 1945, 1945, 1945, 1945,  383,  647,  647,  647,  647,
-      647,  647,  647,  647,  383, 1946, 1946, 1946, 1946, 1946,
-     1946, 1946, 1946,  383, 1947, 1947, 1947, 1947, 1947, 1948,
-     1949, 1949,  383, 1949, 1949, 1949, 1949, 1949, 1949, 1949,
-     1949, 1950, 2702, 1951, 1951, 1951, 1951, 1951, 1951, 1951,
-     1951, 1950, 2702, 1952, 1952, 1952, 1952, 1952, 1953, 1786,
-     1786, 1950, 2702, 1786, 1786, 1786, 1786, 1786, 1786, 1786,
-     1786, 1954, 2702, 1955, 1955, 1955, 1955, 1955, 1955, 1955,
-
-     1955, 1954, 2702, 1956, 1956, 1956, 1956, 1956, 1957, 1790,
-     1790, 1954, 2702, 1790, 1790, 1790, 1790, 1790, 1790, 1790,
-     1790,  383, 1958, 1958, 1958, 1958, 1958, 1958, 1958, 1958,
-     1609, 1988, 2007,  144,  144,  144,  144, 1959, 1959, 1959,
-     1959, 1959, 1959, 1960, 1960, 1960, 1960, 1960, 1960, 1960,
-     1960, 1965, 1965, 1965, 1965, 1965, 1965, 1965, 1965, 2024,
-     1988, 2007,  144,  144,  144,  144, 1959, 1959, 1959, 1959,
-     1959, 1959, 1961,  383, 1962, 1962, 1962, 1962, 1962, 1962,
-     1962, 1962, 1963, 2702, 2702, 2702,  144, 2702, 2024, 1964,
-     1964, 1964, 1964, 1964, 1964, 1966, 1966, 1966, 1966, 1966,
-
-     1967, 1968, 1968, 2702,  453,  477, 1985, 1831, 1989, 2702,
-     2702,  144,  144, 1986,  685,  144, 1990, 2702, 1964, 1964,
-     1964, 1964, 1964, 1964,  139,  139,  144, 2702, 2702, 1997,
-      139, 2003,  139,  153,  139, 1985,  144, 2702,  144,  144,
-      144,  144, 1986,  196,  144,  139,  139,  139,  139,  131,
-     1991, 2000, 1970, 2702, 2542,  144,  941, 2002, 1997, 2542,
-     2003, 2702,  492, 2702, 2004,  144,  144,  144,  144,  144,
-     2702,  144, 2702,  144, 2702, 2702,  139,  139,  139, 1991,
-     2000, 1970,  139,  139, 2005,  941, 2002, 2702,  139, 2006,
-      139,  153,  139, 2004,  144,  144,  144, 2702,  144,  144,
-
-      144,  196, 2020,  139,  139,  139,  139,  131, 2010, 2009,
-     2702, 2011, 2015, 2005,  144,  144,  153,  144, 2006, 2012,
-     2016, 2019,  144,  144, 2702,  144, 1972, 2026,  144, 2023,
-     2013, 2020,  131, 2018,  139,  139,  139, 2010, 2009,  144,
-     2022, 2025, 2702,  144,  144,  144,  144,  144,  153, 2028,
-     2019,  144, 2014, 2017,  144, 1972, 2029,  144, 2023,  144,
-     2031, 2027, 2018,  144,  131, 2032,  144, 2034,  144, 2022,
-     2025,  144, 2036, 2702,  144, 2702,  144, 2042, 2028, 2030,
-     2037, 2014, 2017,  144,  144, 2029,  144, 2035,  144, 2031,
-     2027, 2038,  144,  144, 2032,  144, 2034,  144, 2039, 2040,
-
-      144, 2036, 1879,  144, 1879, 1879, 2042, 1712, 2030, 2037,
-      144, 2041, 2043,  144,  144,  144, 2035, 2044,  144, 2045,
-     2038, 2046,  144, 2047,  144, 2048,  144, 2039, 2040, 2049,
-      144, 2050,  144,  144, 2051,  144,  144, 2052, 2053,  144,
-     2041, 2043,  144,  144,  144,  144, 2044,  144, 2045, 2055,
-     2046,  144, 2047,  144, 2048,  144, 2056,  144, 2049,  144,
-     2050,  144,  144, 2051,  144,  144, 2052, 2053,  144, 2057,
-      144,  144, 1360, 1360,  144, 2702, 2702, 1360, 2055, 2702,
-      144, 2702, 1361, 1361,  144, 2056,  144, 1361, 2702, 2702,
-      144, 2068, 2068, 2068, 2068, 2068, 2068,  144, 2057,  144,
-
-      648,  383, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062,
-     2063, 2079, 2079, 2079, 2079, 2079, 2079, 2064, 2064, 2064,
-     2064, 2064, 2064, 2065, 2065, 2065, 2065, 2065, 2065, 2065,
-     2065, 2066, 2066, 2066, 2066, 2066, 2067, 2068, 2068, 2089,
-     2089, 2089, 2089, 2089, 2089, 2702, 2064, 2064, 2064, 2064,
-     2064, 2064, 2702, 2702, 2069, 2069, 2069, 2069, 2069, 2069,
-     2069, 2069,  383, 2070, 2070, 2070, 2070, 2070, 2070, 2070,
-     2070, 1755, 2099, 2099, 2099, 2099, 2099, 2099, 2071, 2071,
-     2071, 2071, 2071, 2071, 2072, 2072, 2072, 2072, 2072, 2072,
-     2072, 2072, 2076, 2076, 2076, 2076, 2076, 2076, 2076, 2076,
-
-     2122, 2250, 2250, 2250, 2250, 2250, 2250, 2071, 2071, 2071,
-     2071, 2071, 2071, 1158,  383, 2073, 2073, 2073, 2073, 2073,
-     2073, 2073, 2073, 2074, 2125, 2126, 2127, 2128, 2129, 2122,
-     2075, 2075, 2075, 2075, 2075, 2075, 2077, 2077, 2077, 2077,
-     2077, 2078, 2079, 2079, 2082, 2082, 2082, 2082, 2082, 2082,
-     2082, 2082, 2702, 2125, 2126, 2127, 2128, 2129, 2702, 2075,
-     2075, 2075, 2075, 2075, 2075,  383, 2080, 2080, 2080, 2080,
-     2080, 2080, 2080, 2080, 1766, 2130, 2131, 2132, 2133, 2134,
-     2135, 2081, 2081, 2081, 2081, 2081, 2081, 2086, 2086, 2086,
-     2086, 2086, 2086, 2086, 2086, 2087, 2087, 2087, 2087, 2087,
-
-     2088, 2089, 2089, 2136, 2130, 2131, 2132, 2133, 2134, 2135,
-     2081, 2081, 2081, 2081, 2081, 2081, 1607,  383, 2083, 2083,
-     2083, 2083, 2083, 2083, 2083, 2083, 2084, 2137, 2138, 2139,
-     2140, 2141, 2136, 2085, 2085, 2085, 2085, 2085, 2085, 2092,
-     2092, 2092, 2092, 2092, 2092, 2092, 2092, 2096, 2096, 2096,
-     2096, 2096, 2096, 2096, 2096, 2702, 2137, 2138, 2139, 2140,
-     2141, 2702, 2085, 2085, 2085, 2085, 2085, 2085,  383, 2090,
-     2090, 2090, 2090, 2090, 2090, 2090, 2090, 1776, 2142, 2143,
-     2144, 2145, 2146, 2147, 2091, 2091, 2091, 2091, 2091, 2091,
-     2097, 2097, 2097, 2097, 2097, 2098, 2099, 2099,  383, 2100,
-
-     2100, 2100, 2100, 2100, 2100, 2100, 2100, 2142, 2143, 2144,
-     2145, 2146, 2147, 2091, 2091, 2091, 2091, 2091, 2091, 1961,
-      383, 2093, 2093, 2093, 2093, 2093, 2093, 2093, 2093, 2094,
-     2702, 2148, 2157, 2158, 2159, 2160, 2095, 2095, 2095, 2095,
-     2095, 2095,  383, 2100, 2100, 2100, 2100, 2100, 2100, 2100,
-     2100,  383, 2100, 2100, 2100, 2100, 2100, 2100, 1385, 1385,
-     2148, 2157, 2158, 2159, 2160, 2095, 2095, 2095, 2095, 2095,
-     2095,  383, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385,
-     2101, 2102, 2103, 2104, 2104, 2104, 2104, 2104, 1950, 2702,
-     1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 1950, 2702,
-
-     1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 1950, 2702,
-     1786, 1786, 1786, 1786, 1786, 1786, 2105, 2106, 2107, 2108,
-     2108, 2108, 2108, 2108, 1954, 2702, 1790, 1790, 1790, 1790,
-     1790, 1790, 1790, 1790, 1954, 2702, 1790, 1790, 1790, 1790,
-     1790, 1790, 1790, 1790, 1954, 2702, 1790, 1790, 1790, 1790,
-     1790, 1790,  383, 1385, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1609,  383,  647,  647,  647,  647,  647,  647,  647,
-      647, 1609,  383, 1385, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1609, 2109, 2110, 2111, 2112, 2112, 2112, 2112, 2112,
-      383, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 1963,
-
-     2163, 2164, 2165, 2166, 2167, 2168, 2114, 2114, 2114, 2114,
-     2114, 2114, 2115, 2116, 2117, 2118, 2118, 2118, 2118, 2118,
-     2120, 2120, 2120, 2120, 2120, 2120, 2120, 2120, 2702, 2163,
-     2164, 2165, 2166, 2167, 2168, 2114, 2114, 2114, 2114, 2114,
-     2114, 1961,  153, 2121, 2121, 2121, 2121, 2121, 2121, 2121,
-     2121,  139,  139, 2702, 2011, 2149, 2152,  139,  131,  139,
-      153,  139, 2012, 2150, 2012, 2169,  153, 2702, 2170, 2702,
-      196, 2154,  139,  139,  139,  139,  131, 2015, 2124, 2016,
-     2171, 2123,  131, 1570, 1570, 2016, 2172, 2173, 1570, 2702,
-     2702, 2702, 2702, 2153, 2169, 2014, 2151, 2170,  153, 2174,
-
-     2702, 2702, 2156,  139,  139,  139, 2702, 2124, 2155, 2171,
-     2123,  139,  139,  153,  131, 2172, 2173,  139, 2017,  139,
-      153,  139, 2153, 2175, 2014, 2151, 2162, 2176, 2174,  131,
-      196, 2156,  139,  139,  139,  139,  131, 2155, 2177, 2178,
-     2179, 2180, 2181, 2251,  144, 2255, 2256, 2017, 2161, 1571,
-     1571, 2702, 2175, 2702, 1571, 2162, 2176, 2182, 2257, 2182,
-     2182, 2258, 2183,  139,  139,  139, 2183, 2177, 2178, 2179,
-     2180, 2181, 2251,  144, 2255, 2256, 2702, 2161,  383, 2187,
-     2188, 2189, 2190, 2190, 2190, 2190, 2190, 2257, 2259, 2260,
-     2258, 2261, 2262, 2263, 2191, 2191, 2191, 2191, 2191, 2191,
-
-     2194, 2195, 2196, 2197, 2197, 2197, 2197, 2197, 2199, 2199,
-     2199, 2199, 2199, 2199, 2199, 2199, 2702, 2259, 2260, 2702,
-     2261, 2262, 2263, 2191, 2191, 2191, 2191, 2191, 2191,  383,
-     2192, 2192, 2192, 2192, 2192, 2192, 2192, 2192, 2063, 2702,
-     2702, 2702, 2265,  144, 2272, 2193, 2193, 2193, 2193, 2193,
-     2193,  648, 2702, 2200, 2200, 2200, 2200, 2200, 2200, 2200,
-     2200,  383, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385,
-     1755, 2265,  144, 2272, 2193, 2193, 2193, 2193, 2193, 2193,
-      383,  647,  647,  647,  647,  647,  647,  647,  647, 1755,
-      383, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1755,
-
-      383, 2201, 2201, 2201, 2201, 2201, 2201, 2201, 2201, 2074,
-     2270, 2274,  144, 2279, 2280, 2283, 2202, 2202, 2202, 2202,
-     2202, 2202, 2203, 2204, 2205, 2206, 2206, 2206, 2206, 2206,
-     2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2702, 2270,
-     2274,  144, 2279, 2280, 2283, 2202, 2202, 2202, 2202, 2202,
-     2202, 1158, 2702, 2209, 2209, 2209, 2209, 2209, 2209, 2209,
-     2209,  383, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385,
-     1766,  383,  647,  647,  647,  647,  647,  647,  647,  647,
-     1766,  383, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385,
-     1766,  383, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
-
-     2084, 2281,  144,  144, 2286, 2288, 2289, 2211, 2211, 2211,
-     2211, 2211, 2211, 2212, 2213, 2214, 2215, 2215, 2215, 2215,
-     2215, 2217, 2217, 2217, 2217, 2217, 2217, 2217, 2217, 2702,
-     2281,  144,  144, 2286, 2288, 2289, 2211, 2211, 2211, 2211,
-     2211, 2211, 1607, 2702, 2218, 2218, 2218, 2218, 2218, 2218,
-     2218, 2218,  383, 1385, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1776,  383,  647,  647,  647,  647,  647,  647,  647,
-      647, 1776,  383, 1385, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1776,  383, 2219, 2219, 2219, 2219, 2219, 2219, 2219,
-     2219, 2094, 2284, 2290, 2293,  144,  144,  144, 2220, 2220,
-
-     2220, 2220, 2220, 2220, 2221, 2222, 2223, 2224, 2224, 2224,
-     2224, 2224, 2226, 2226, 2226, 2226, 2226, 2226, 2226, 2226,
-     2702, 2284, 2290, 2293,  144,  144,  144, 2220, 2220, 2220,
-     2220, 2220, 2220, 1961, 2702, 2227, 2227, 2227, 2227, 2227,
-     2227, 2227, 2227,  383, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385,  383,  647,  647,  647,  647,  647,  647,  647,
-      647,  383, 2228, 2228, 2228, 2228, 2228, 2228, 2228, 2228,
-      383, 2229, 2229, 2229, 2229, 2229, 2230, 2231, 2231,  383,
-     2231, 2231, 2231, 2231, 2231, 2231, 2231, 2231, 2232, 2702,
-     2233, 2233, 2233, 2233, 2233, 2233, 2233, 2233, 2232, 2702,
-
-     2234, 2234, 2234, 2234, 2234, 2235, 2105, 2105, 2232, 2702,
-     2105, 2105, 2105, 2105, 2105, 2105, 2105, 2105, 2236, 2702,
-     2237, 2237, 2237, 2237, 2237, 2237, 2237, 2237, 2236, 2702,
-     2238, 2238, 2238, 2238, 2238, 2239, 2109, 2109, 2236, 2702,
-     2109, 2109, 2109, 2109, 2109, 2109, 2109, 2109,  383, 2240,
-     2240, 2240, 2240, 2240, 2240, 2240, 2240, 1963, 2287,  144,
-     2292, 2295, 2297,  144, 2241, 2241, 2241, 2241, 2241, 2241,
-     2242, 2242, 2242, 2242, 2242, 2242, 2242, 2242, 2247, 2247,
-     2247, 2247, 2247, 2247, 2247, 2247, 2702, 2287,  144, 2292,
-     2295, 2297,  144, 2241, 2241, 2241, 2241, 2241, 2241, 2243,
-
-      383, 2244, 2244, 2244, 2244, 2244, 2244, 2244, 2244, 2245,
-     2298, 2702,  144, 2702, 2300, 2271, 2246, 2246, 2246, 2246,
-     2246, 2246, 2248, 2248, 2248, 2248, 2248, 2249, 2250, 2250,
-     2277, 2702, 2702,  144, 2264, 2702, 2275, 2702, 2150, 2298,
-      153,  144,  144, 2300, 2271, 2246, 2246, 2246, 2246, 2246,
-     2246,  139,  139, 2273,  144,  144,  131,  139, 2149,  139,
-      153,  139,  144, 2264,  144, 2275, 2150, 2278, 2702, 2378,
-      196,  144,  139,  139,  139,  139,  131, 2253, 2276, 2702,
-     2282, 2296, 2273,  144,  144,  144,  144, 2291,  144, 2382,
-     2383, 2384,  144,  144, 2252, 2702, 2278,  153, 2378, 2151,
-
-     2385, 2702, 2294,  139,  139,  139, 2253, 2276,  144, 2282,
-     2296, 2386, 2702,  131,  144,  144, 2291,  144, 2382, 2383,
-     2384,  144, 2285, 2252,  139,  139, 2702, 2387, 2151, 2385,
-      139, 2294,  139,  153,  139, 2702, 2299,  144, 2299, 2299,
-     2386, 1095, 2702,  196, 2702,  139,  139,  139,  139,  131,
-     2182, 2285, 2182, 2182, 2702, 2183, 2387, 1751, 1751, 2183,
-     1752, 1752, 1751, 2702, 1096, 1752, 2702,  144, 2702, 2254,
-     2314, 2314, 2314, 2314, 2314, 2314,  139,  139,  139, 2311,
-     2311, 2311, 2311, 2311, 2311, 2311, 2311,  144, 2312, 2312,
-     2312, 2312, 2312, 2313, 2314, 2314,  144, 2702, 2254, 2315,
-
-     2315, 2315, 2315, 2315, 2315, 2315, 2315, 2318, 2318, 2318,
-     2318, 2318, 2318, 2318, 2318, 2702,  144, 2302, 2303, 2304,
-     2305, 2305, 2305, 2305, 2305, 2306, 2325, 2325, 2325, 2325,
-     2325, 2325, 2307, 2307, 2307, 2307, 2307, 2307, 2322, 2322,
-     2322, 2322, 2322, 2322, 2322, 2322, 2323, 2323, 2323, 2323,
-     2323, 2324, 2325, 2325, 2335, 2335, 2335, 2335, 2335, 2335,
-     2702, 2307, 2307, 2307, 2307, 2307, 2307,  648,  383, 2308,
-     2308, 2308, 2308, 2308, 2308, 2308, 2308, 2309, 2345, 2345,
-     2345, 2345, 2345, 2345, 2310, 2310, 2310, 2310, 2310, 2310,
-     2328, 2328, 2328, 2328, 2328, 2328, 2328, 2328, 2332, 2332,
-
-     2332, 2332, 2332, 2332, 2332, 2332, 2355, 2355, 2355, 2355,
-     2355, 2355, 2702, 2310, 2310, 2310, 2310, 2310, 2310,  383,
-     2316, 2316, 2316, 2316, 2316, 2316, 2316, 2316, 2063, 2388,
-     2389,  144, 2396,  144, 2398, 2317, 2317, 2317, 2317, 2317,
-     2317, 2333, 2333, 2333, 2333, 2333, 2334, 2335, 2335, 2338,
-     2338, 2338, 2338, 2338, 2338, 2338, 2338,  144, 2388, 2389,
-      144, 2396,  144, 2398, 2317, 2317, 2317, 2317, 2317, 2317,
-     1158,  383, 2319, 2319, 2319, 2319, 2319, 2319, 2319, 2319,
-     2320,  144, 2403,  144, 2406, 2395,  144, 2321, 2321, 2321,
-     2321, 2321, 2321, 2342, 2342, 2342, 2342, 2342, 2342, 2342,
-
-     2342, 2343, 2343, 2343, 2343, 2343, 2344, 2345, 2345, 2702,
-      144, 2403,  144, 2406, 2395, 2702, 2321, 2321, 2321, 2321,
-     2321, 2321,  383, 2326, 2326, 2326, 2326, 2326, 2326, 2326,
-     2326, 2074, 2404,  144, 2407,  144,  144, 2467, 2327, 2327,
-     2327, 2327, 2327, 2327, 2348, 2348, 2348, 2348, 2348, 2348,
-     2348, 2348, 2352, 2352, 2352, 2352, 2352, 2352, 2352, 2352,
-     2702, 2404,  144, 2407,  144,  144, 2467, 2327, 2327, 2327,
-     2327, 2327, 2327, 1607,  383, 2329, 2329, 2329, 2329, 2329,
-     2329, 2329, 2329, 2330, 2416, 2416, 2416, 2416, 2416, 2416,
-     2331, 2331, 2331, 2331, 2331, 2331, 2353, 2353, 2353, 2353,
-
-     2353, 2354, 2355, 2355,  383, 2356, 2356, 2356, 2356, 2356,
-     2356, 2356, 2356, 2466, 2466, 2466, 2466, 2466, 2466, 2331,
-     2331, 2331, 2331, 2331, 2331,  383, 2336, 2336, 2336, 2336,
-     2336, 2336, 2336, 2336, 2084, 2702, 2471, 2472, 2473, 2482,
-     2483, 2337, 2337, 2337, 2337, 2337, 2337,  383, 2356, 2356,
-     2356, 2356, 2356, 2356, 2356, 2356,  383, 2356, 2356, 2356,
-     2356, 2356, 2356, 1385, 1385, 2471, 2472, 2473, 2482, 2483,
-     2337, 2337, 2337, 2337, 2337, 2337, 1961,  383, 2339, 2339,
-     2339, 2339, 2339, 2339, 2339, 2339, 2340, 2487, 2545, 2549,
-     2550, 2551,  144, 2341, 2341, 2341, 2341, 2341, 2341,  383,
-
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 2357, 2358,
-     2359, 2360, 2360, 2360, 2360, 2360, 2487, 2545, 2549, 2550,
-     2551,  144, 2341, 2341, 2341, 2341, 2341, 2341,  383, 2346,
-     2346, 2346, 2346, 2346, 2346, 2346, 2346, 2094, 2702, 2702,
-     2702, 2555, 2556,  144, 2347, 2347, 2347, 2347, 2347, 2347,
-     2232, 2702, 2105, 2105, 2105, 2105, 2105, 2105, 2105, 2105,
-     2232, 2397, 2105, 2105, 2105, 2105, 2105, 2105, 2105, 2105,
-     2555, 2556,  144, 2347, 2347, 2347, 2347, 2347, 2347, 2243,
-      383, 2349, 2349, 2349, 2349, 2349, 2349, 2349, 2349, 2350,
-      144, 2557, 2552,  144,  144,  144, 2351, 2351, 2351, 2351,
-
-     2351, 2351, 2232, 2391, 2105, 2105, 2105, 2105, 2105, 2105,
-     2361, 2362, 2363, 2364, 2364, 2364, 2364, 2364, 2702,  144,
-     2557, 2552,  144,  144,  144, 2351, 2351, 2351, 2351, 2351,
-     2351, 2236, 2391, 2109, 2109, 2109, 2109, 2109, 2109, 2109,
-     2109, 2236, 2702, 2109, 2109, 2109, 2109, 2109, 2109, 2109,
-     2109, 2236, 2702, 2109, 2109, 2109, 2109, 2109, 2109,  383,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1963,  383,
-      647,  647,  647,  647,  647,  647,  647,  647, 1963,  383,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1963, 2365,
-     2366, 2367, 2368, 2368, 2368, 2368, 2368,  383, 2369, 2369,
-
-     2369, 2369, 2369, 2369, 2369, 2369, 2245, 2299, 2554, 2299,
-     2299,  144, 1095, 2370, 2370, 2370, 2370, 2370, 2370, 2371,
-     2372, 2373, 2374, 2374, 2374, 2374, 2374, 2376, 2376, 2376,
-     2376, 2376, 2376, 2376, 2376, 1321, 2702, 2554, 2702, 2702,
-      144, 2702, 2370, 2370, 2370, 2370, 2370, 2370, 2243,  153,
-     2377, 2377, 2377, 2377, 2377, 2377, 2377, 2377,  139,  139,
-      144, 2702, 2702,  144,  139,  131,  139,  153,  139,  144,
-      144,  153,  144,  144, 2702,  144, 2390,  196, 2392,  139,
-      139,  139,  139,  131, 2380, 2394, 2399,  131, 2401,  144,
-     2400, 2402,  144,  144, 2702, 2602, 2702, 2702,  144,  144,
-
-     2548,  144,  144, 2379,  144, 2390,  144, 2392,  144, 2405,
-      139,  139,  139, 2380, 2394, 2399,  144, 2401, 2702, 2400,
-     2402, 2478,  144, 2408, 2602, 2408, 2408, 2702, 1314, 2548,
-     2702,  144, 2379,  139,  139,  144, 2702,  144, 2405,  139,
-     2603,  139,  153,  139, 2299,  144, 2299, 2299, 2702, 1095,
-     2478, 1315,  196, 2606,  139,  139,  139,  139,  131,  144,
-      144, 2702, 2408, 2381, 2408, 2408, 2702, 1314, 2702, 2603,
-     2702, 2410, 1321, 2413, 2413, 2413, 2413, 2413, 2413, 2413,
-     2413, 2412, 2606, 2702, 2607,  139,  139,  139,  144, 2702,
-     1535, 2702, 2381, 2414, 2414, 2414, 2414, 2414, 2415, 2416,
-
-     2416,  383, 2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417,
-     2702, 2702, 2559, 2607,  144, 2610,  144, 2418, 2418, 2418,
-     2418, 2418, 2418, 2422, 2422, 2422, 2422, 2422, 2422, 2422,
-     2422,  648, 2702, 2423, 2423, 2423, 2423, 2423, 2423, 2423,
-     2423, 2559, 2702,  144, 2610,  144, 2418, 2418, 2418, 2418,
-     2418, 2418,  383, 2419, 2419, 2419, 2419, 2419, 2419, 2419,
-     2419, 2309, 2702, 2702, 2702, 2611, 2652,  144, 2420, 2420,
-     2420, 2420, 2420, 2420,  383, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385, 2063,  383,  647,  647,  647,  647,  647,
-      647,  647,  647, 2063, 2611, 2652,  144, 2420, 2420, 2420,
-
-     2420, 2420, 2420,  383, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 2063,  383, 2424, 2424, 2424, 2424, 2424, 2424,
-     2424, 2424, 2320, 2702,  144, 2655,  144, 2604,  144, 2425,
-     2425, 2425, 2425, 2425, 2425, 2427, 2427, 2427, 2427, 2427,
-     2427, 2427, 2427, 1158, 2702, 2428, 2428, 2428, 2428, 2428,
-     2428, 2428, 2428,  144, 2655,  144, 2604,  144, 2425, 2425,
-     2425, 2425, 2425, 2425,  383, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385, 2074,  383,  647,  647,  647,  647,  647,
-      647,  647,  647, 2074,  383, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385, 2074,  383, 2429, 2429, 2429, 2429, 2429,
-
-     2429, 2429, 2429, 2330, 2702, 2608,  144,  144,  144,  144,
-     2430, 2430, 2430, 2430, 2430, 2430, 2432, 2432, 2432, 2432,
-     2432, 2432, 2432, 2432, 1607, 2702, 2433, 2433, 2433, 2433,
-     2433, 2433, 2433, 2433, 2608,  144,  144,  144,  144, 2430,
-     2430, 2430, 2430, 2430, 2430,  383, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385, 1385, 2084,  383,  647,  647,  647,  647,
-      647,  647,  647,  647, 2084,  383, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385, 1385, 2084,  383, 2434, 2434, 2434, 2434,
-     2434, 2434, 2434, 2434, 2340, 2702, 2609, 2674, 2685, 2694,
-      144, 2435, 2435, 2435, 2435, 2435, 2435, 2437, 2437, 2437,
-
-     2437, 2437, 2437, 2437, 2437, 1961, 2702, 2438, 2438, 2438,
-     2438, 2438, 2438, 2438, 2438, 2609, 2674, 2685, 2694,  144,
-     2435, 2435, 2435, 2435, 2435, 2435,  383, 1385, 1385, 1385,
-     1385, 1385, 1385, 1385, 1385, 2094,  383,  647,  647,  647,
-      647,  647,  647,  647,  647, 2094,  383, 1385, 1385, 1385,
-     1385, 1385, 1385, 1385, 1385, 2094,  383, 2439, 2439, 2439,
-     2439, 2439, 2439, 2439, 2439, 2350, 2702, 2651, 2695, 2699,
-     2701,  144, 2440, 2440, 2440, 2440, 2440, 2440, 2442, 2442,
-     2442, 2442, 2442, 2442, 2442, 2442, 2243, 2702, 2443, 2443,
-     2443, 2443, 2443, 2443, 2443, 2443, 2651, 2695, 2699, 2701,
-
-      144, 2440, 2440, 2440, 2440, 2440, 2440,  383, 1385, 1385,
-     1385, 1385, 1385, 1385, 1385, 1385,  383,  647,  647,  647,
-      647,  647,  647,  647,  647,  383, 2444, 2444, 2444, 2444,
-     2444, 2444, 2444, 2444,  383, 2445, 2445, 2445, 2445, 2445,
-     2446, 2447, 2447,  383, 2447, 2447, 2447, 2447, 2447, 2447,
-     2447, 2447, 2448, 2702, 2449, 2449, 2449, 2449, 2449, 2449,
-     2449, 2449, 2448, 2702, 2450, 2450, 2450, 2450, 2450, 2451,
-     2361, 2361, 2448, 2702, 2361, 2361, 2361, 2361, 2361, 2361,
-     2361, 2361, 2452, 2702, 2453, 2453, 2453, 2453, 2453, 2453,
-     2453, 2453, 2452, 2702, 2454, 2454, 2454, 2454, 2454, 2455,
-
-     2365, 2365, 2452, 2702, 2365, 2365, 2365, 2365, 2365, 2365,
-     2365, 2365,  383, 2456, 2456, 2456, 2456, 2456, 2456, 2456,
-     2456, 2245, 2408,  144, 2408, 2408, 2702, 1314, 2457, 2457,
-     2457, 2457, 2457, 2457, 2458, 2458, 2458, 2458, 2458, 2458,
-     2458, 2458, 2463, 2463, 2463, 2463, 2463, 2463, 2463, 2463,
-     1535, 2558,  144, 2558, 2558, 2702, 1712, 2457, 2457, 2457,
-     2457, 2457, 2457, 2459,  383, 2460, 2460, 2460, 2460, 2460,
-     2460, 2460, 2460, 2461, 2702, 2702, 2702, 2702,  153, 1877,
-     2462, 2462, 2462, 2462, 2462, 2462, 2464, 2464, 2464, 2464,
-     2464, 2465, 2466, 2466,  131, 2491, 2492, 2493, 2494, 2494,
-
-     2494, 2494, 2494, 1911, 1911, 2702, 2702, 2702, 1911, 2462,
-     2462, 2462, 2462, 2462, 2462,  139,  139,  144,  144, 2485,
-     2702,  139, 2480,  139,  153,  139, 2702,  144,  144, 2479,
-     2702,  144,  144, 2702,  196,  144,  139,  139,  139,  139,
-      131,  144, 2702,  144, 2612, 2481,  144,  144, 2485, 2468,
-     2702, 2480,  144,  144, 2702, 2490,  144,  144, 2479, 2702,
-      144,  144,  144, 2702,  144,  144, 2484,  139,  139,  139,
-      144, 2702,  144, 2612, 2481, 2702,  144, 2702, 2468,  139,
-      139,  144,  144,  144, 2490,  139,  144,  139,  153,  139,
-     2486,  144, 2702,  144,  144, 2484,  144, 2489,  196,  144,
-
-      139,  139,  139,  139,  131,  144, 2488, 2605, 2702,  144,
-     2469, 2702,  144, 1912, 1912,  144, 2059, 2059, 1912, 2486,
-     2470, 2059,  144, 2702, 2702,  144, 2489, 2702,  144, 2060,
-     2060,  139,  139,  139, 2060, 2488, 2605, 2702,  144, 2469,
-     2501, 2501, 2501, 2501, 2501, 2501, 2501, 2501, 2410, 2470,
-     2498, 2498, 2498, 2498, 2498, 2498, 2498, 2498, 2412,  383,
-     2499, 2499, 2499, 2499, 2499, 2499, 2499, 2499, 2702, 2558,
-     2702, 2558, 2558, 2702, 1712, 2500, 2500, 2500, 2500, 2500,
-     2500, 2504, 2504, 2504, 2504, 2504, 2504, 2504, 2504, 2509,
-     2509, 2509, 2509, 2509, 2509, 2509, 2509, 1877, 2184, 2184,
-
-     2702, 2702, 2702, 2184, 2500, 2500, 2500, 2500, 2500, 2500,
-      383, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2502, 2309,
-      144, 2702, 2702, 2702, 2702, 2700, 2503, 2503, 2503, 2503,
-     2503, 2503, 2514, 2514, 2514, 2514, 2514, 2514, 2514, 2514,
-     2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2702,  144,
-     2702, 2702, 2702, 2702, 2700, 2503, 2503, 2503, 2503, 2503,
-     2503,  383, 2505, 2505, 2505, 2505, 2505, 2505, 2505, 2505,
-     2185, 2185, 2702, 2702, 2702, 2185, 2702, 2506, 2506, 2506,
-     2506, 2506, 2506, 2524, 2524, 2524, 2524, 2524, 2524, 2524,
-     2524,  383, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527,
-
-     2301, 2301, 2702, 2702, 2702, 2301, 2506, 2506, 2506, 2506,
-     2506, 2506,  383, 2507, 2507, 2507, 2507, 2507, 2507, 2507,
-     2507, 2320, 2409, 2409, 2702, 2702, 2702, 2409, 2508, 2508,
-     2508, 2508, 2508, 2508,  383, 2527, 2527, 2527, 2527, 2527,
-     2527, 2527, 2527,  383, 2527, 2527, 2527, 2527, 2527, 2527,
-     1385, 1385, 2702, 2702, 2702, 2702, 2702, 2508, 2508, 2508,
-     2508, 2508, 2508,  383, 2510, 2510, 2510, 2510, 2510, 2510,
-     2510, 2510, 2495, 2495, 2702, 2702, 2702, 2495, 2702, 2511,
-     2511, 2511, 2511, 2511, 2511,  383, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385, 1385, 2528, 2529, 2530, 2531, 2531, 2531,
-
-     2531, 2531, 2496, 2496, 2702, 2702, 2702, 2496, 2511, 2511,
-     2511, 2511, 2511, 2511,  383, 2512, 2512, 2512, 2512, 2512,
-     2512, 2512, 2512, 2330, 2564, 2564, 2702, 2702, 2702, 2564,
-     2513, 2513, 2513, 2513, 2513, 2513, 2448, 2702, 2361, 2361,
-     2361, 2361, 2361, 2361, 2361, 2361, 2448, 2702, 2361, 2361,
-     2361, 2361, 2361, 2361, 2361, 2361, 2702, 2702, 2702, 2513,
-     2513, 2513, 2513, 2513, 2513,  383, 2515, 2515, 2515, 2515,
-     2515, 2515, 2515, 2515, 2650, 2702, 2702, 2702, 2702, 2702,
-      144, 2516, 2516, 2516, 2516, 2516, 2516, 2448, 2702, 2361,
-     2361, 2361, 2361, 2361, 2361, 2532, 2533, 2534, 2535, 2535,
-
-     2535, 2535, 2535, 2650, 2702, 2702, 2702, 2702, 2702,  144,
-     2516, 2516, 2516, 2516, 2516, 2516,  383, 2517, 2517, 2517,
-     2517, 2517, 2517, 2517, 2517, 2340, 2702, 2702, 2702, 2702,
-     2702, 2702, 2518, 2518, 2518, 2518, 2518, 2518, 2452, 2702,
-     2365, 2365, 2365, 2365, 2365, 2365, 2365, 2365, 2452, 2702,
-     2365, 2365, 2365, 2365, 2365, 2365, 2365, 2365, 2702, 2702,
-     2702, 2518, 2518, 2518, 2518, 2518, 2518,  383, 2520, 2520,
-     2520, 2520, 2520, 2520, 2520, 2520, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2521, 2521, 2521, 2521, 2521, 2521, 2452,
-     2702, 2365, 2365, 2365, 2365, 2365, 2365,  383, 1385, 1385,
-
-     1385, 1385, 1385, 1385, 1385, 1385, 2245, 2702, 2702, 2702,
-     2702, 2702, 2521, 2521, 2521, 2521, 2521, 2521,  383, 2522,
-     2522, 2522, 2522, 2522, 2522, 2522, 2522, 2350, 2702, 2702,
-     2702, 2702, 2702, 2702, 2523, 2523, 2523, 2523, 2523, 2523,
-      383,  647,  647,  647,  647,  647,  647,  647,  647, 2245,
-      383, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 2245,
-     2702, 2702, 2702, 2523, 2523, 2523, 2523, 2523, 2523,  383,
-     2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525,  144, 2702,
-     2702, 2702, 2702, 2702, 2698, 2526, 2526, 2526, 2526, 2526,
-     2526, 2536, 2537, 2538, 2539, 2539, 2539, 2539, 2539, 2543,
-
-     2543, 2543, 2543, 2543, 2543, 2543, 2543,  144, 2702, 2702,
-     2702, 2702, 2702, 2698, 2526, 2526, 2526, 2526, 2526, 2526,
-      383, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2540, 2461,
-     2702, 2702, 2702, 2702, 2702, 2702, 2541, 2541, 2541, 2541,
-     2541, 2541, 2459, 2702, 2544, 2544, 2544, 2544, 2544, 2544,
-     2544, 2544, 2702, 2702, 2702, 2702, 2702, 2558, 2702, 2558,
-     2558, 2702, 1712, 2702, 2702, 2541, 2541, 2541, 2541, 2541,
-     2541,  139,  139, 2702,  144, 2702, 2702,  139, 2702,  139,
-      153,  139, 2702, 2702, 2553, 1713, 2702, 2702, 2702, 2702,
-      196, 2702,  139,  139,  139,  139,  131,  144, 2702, 2702,
-
-     2702, 2702, 2546,  144, 2569, 2569, 2569, 2569, 2569, 2569,
-     2569, 2569, 2560, 2553, 2561, 2561, 2561, 2561, 2561, 2561,
-     2561, 2561, 2702,  139,  139,  139,  144, 2411, 2702, 2411,
-     2411, 2546,  139,  139, 2411, 2702, 2702, 2702,  139, 2702,
-      139,  153,  139, 2572, 2572, 2572, 2572, 2572, 2572, 2572,
-     2572,  196, 2702,  139,  139,  139,  139,  131, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2560, 2547, 2562, 2562, 2562,
-     2562, 2562, 2563, 2491, 2491,  383,  647,  647,  647,  647,
-      647,  647,  647,  647,  139,  139,  139, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2560, 2547, 2491, 2491, 2491, 2491,
-
-     2491, 2491, 2491, 2491,  383, 2565, 2565, 2565, 2565, 2565,
-     2565, 2565, 2565, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2566, 2566, 2566, 2566, 2566, 2566,  383, 1385, 1385, 1385,
-     1385, 1385, 1385, 1385, 1385, 2309,  383,  647,  647,  647,
-      647,  647,  647,  647,  647, 2309, 2702, 2702, 2702, 2566,
-     2566, 2566, 2566, 2566, 2566,  383, 2567, 2567, 2567, 2567,
-     2567, 2567, 2567, 2567, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2568, 2568, 2568, 2568, 2568, 2568,  383, 1385, 1385,
-     1385, 1385, 1385, 1385, 1385, 1385, 2309,  383, 1385, 1385,
-     1385, 1385, 1385, 1385, 1385, 1385, 2320, 2702, 2702, 2702,
-
-     2568, 2568, 2568, 2568, 2568, 2568,  383, 2570, 2570, 2570,
-     2570, 2570, 2570, 2570, 2570, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2571, 2571, 2571, 2571, 2571, 2571,  383,  647,
-      647,  647,  647,  647,  647,  647,  647, 2320,  383, 1385,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 2320, 2702, 2702,
-     2702, 2571, 2571, 2571, 2571, 2571, 2571,  383, 2573, 2573,
-     2573, 2573, 2573, 2573, 2573, 2573, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2574, 2574, 2574, 2574, 2574, 2574, 2575,
-     2575, 2575, 2575, 2575, 2575, 2575, 2575,  383, 1385, 1385,
-     1385, 1385, 1385, 1385, 1385, 1385, 2330, 2702, 2702, 2702,
-
-     2702, 2702, 2574, 2574, 2574, 2574, 2574, 2574,  383,  647,
-      647,  647,  647,  647,  647,  647,  647, 2330,  383, 1385,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 2330,  383, 2576,
-     2576, 2576, 2576, 2576, 2576, 2576, 2576, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2577, 2577, 2577, 2577, 2577, 2577,
-     2578, 2578, 2578, 2578, 2578, 2578, 2578, 2578,  383, 1385,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 2340, 2702, 2702,
-     2702, 2702, 2702, 2577, 2577, 2577, 2577, 2577, 2577,  383,
-      647,  647,  647,  647,  647,  647,  647,  647, 2340,  383,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 2340,  383,
-
-     2579, 2579, 2579, 2579, 2579, 2579, 2579, 2579, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2580, 2580, 2580, 2580, 2580,
-     2580, 2581, 2581, 2581, 2581, 2581, 2581, 2581, 2581,  383,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 2350, 2702,
-     2702, 2702, 2702, 2702, 2580, 2580, 2580, 2580, 2580, 2580,
-      383,  647,  647,  647,  647,  647,  647,  647,  647, 2350,
-      383, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 2350,
-      383, 2582, 2582, 2582, 2582, 2582, 2582, 2582, 2582, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2583, 2583, 2583, 2583,
-     2583, 2583, 2584, 2584, 2584, 2584, 2584, 2584, 2584, 2584,
-
-      383, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 2702,
-     2702, 2702, 2702, 2702, 2702, 2583, 2583, 2583, 2583, 2583,
-     2583,  383,  647,  647,  647,  647,  647,  647,  647,  647,
-      383, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585,  383,
-     2586, 2586, 2586, 2586, 2586, 2587, 2588, 2588,  383, 2588,
-     2588, 2588, 2588, 2588, 2588, 2588, 2588, 2589, 2702, 2590,
-     2590, 2590, 2590, 2590, 2590, 2590, 2590, 2589, 2702, 2591,
-     2591, 2591, 2591, 2591, 2592, 2532, 2532, 2589, 2702, 2532,
-     2532, 2532, 2532, 2532, 2532, 2532, 2532, 2593, 2702, 2594,
-     2594, 2594, 2594, 2594, 2594, 2594, 2594, 2593, 2702, 2595,
-
-     2595, 2595, 2595, 2595, 2596, 2536, 2536, 2593, 2702, 2536,
-     2536, 2536, 2536, 2536, 2536, 2536, 2536,  383, 2597, 2597,
-     2597, 2597, 2597, 2597, 2597, 2597, 2461, 2702, 2702, 2702,
-     2702, 2702, 2702, 2598, 2598, 2598, 2598, 2598, 2598, 2599,
-     2599, 2599, 2599, 2599, 2599, 2599, 2599, 2613, 2614, 2615,
-     2616, 2616, 2616, 2616, 2616, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2598, 2598, 2598, 2598, 2598, 2598,  383, 2600,
-     2600, 2600, 2600, 2600, 2600, 2600, 2600, 2702, 2702, 2702,
-     2702, 2702,  144, 2702, 2601, 2601, 2601, 2601, 2601, 2601,
-     2560, 2653, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491,
-
-     2560, 2702, 2491, 2491, 2491, 2491, 2491, 2491, 2491, 2491,
-     2702,  144, 2702, 2601, 2601, 2601, 2601, 2601, 2601, 2560,
-     2653, 2491, 2491, 2491, 2491, 2491, 2491,  383, 2617, 2617,
-     2617, 2617, 2617, 2617, 2617, 2617, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2618, 2618, 2618, 2618, 2618, 2618, 2619,
-     2619, 2619, 2619, 2619, 2619, 2619, 2619, 2622, 2622, 2622,
-     2622, 2622, 2622, 2622, 2622, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2618, 2618, 2618, 2618, 2618, 2618,  383, 2620,
-     2620, 2620, 2620, 2620, 2620, 2620, 2620, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2621, 2621, 2621, 2621, 2621, 2621,
-
-     2625, 2625, 2625, 2625, 2625, 2625, 2625, 2625, 2628, 2628,
-     2628, 2628, 2628, 2628, 2628, 2628, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2621, 2621, 2621, 2621, 2621, 2621,  383,
-     2623, 2623, 2623, 2623, 2623, 2623, 2623, 2623, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2624, 2624, 2624, 2624, 2624,
-     2624, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2634,
-     2634, 2634, 2634, 2634, 2634, 2634, 2634, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2624, 2624, 2624, 2624, 2624, 2624,
-      383, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2626, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2627, 2627, 2627, 2627,
-
-     2627, 2627, 2637, 2637, 2637, 2637, 2637, 2637, 2637, 2637,
-      383, 2638, 2638, 2638, 2638, 2638, 2638, 2638, 2638, 2702,
-     2702, 2702, 2702, 2702, 2702, 2627, 2627, 2627, 2627, 2627,
-     2627,  383, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2630, 2630, 2630,
-     2630, 2630, 2630,  383, 2638, 2638, 2638, 2638, 2638, 2638,
-     2638, 2638,  383, 2638, 2638, 2638, 2638, 2638, 2638, 1385,
-     1385, 2702, 2702, 2702, 2702, 2702, 2630, 2630, 2630, 2630,
-     2630, 2630,  383, 2632, 2632, 2632, 2632, 2632, 2632, 2632,
-     2632, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2633, 2633,
-
-     2633, 2633, 2633, 2633,  383, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385, 2639, 2640, 2641, 2642, 2642, 2642, 2642,
-     2642, 2702, 2702, 2702, 2702, 2702, 2702, 2633, 2633, 2633,
-     2633, 2633, 2633,  383, 2635, 2635, 2635, 2635, 2635, 2635,
-     2635, 2635, 2702, 2702, 2702, 2702, 2702,  144, 2702, 2636,
-     2636, 2636, 2636, 2636, 2636, 2589, 2654, 2532, 2532, 2532,
-     2532, 2532, 2532, 2532, 2532, 2589, 2702, 2532, 2532, 2532,
-     2532, 2532, 2532, 2532, 2532, 2702,  144, 2702, 2636, 2636,
-     2636, 2636, 2636, 2636, 2589, 2654, 2532, 2532, 2532, 2532,
-     2532, 2532, 2643, 2644, 2645, 2646, 2646, 2646, 2646, 2646,
-
-     2593, 2702, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536,
-     2593, 2702, 2536, 2536, 2536, 2536, 2536, 2536, 2536, 2536,
-     2593, 2702, 2536, 2536, 2536, 2536, 2536, 2536,  383, 1385,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 2461,  383,  647,
-      647,  647,  647,  647,  647,  647,  647, 2461,  383, 1385,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 2461,  383, 2647,
-     2647, 2647, 2647, 2647, 2647, 2647, 2647, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2648, 2648, 2648, 2648, 2648, 2648,
-     2649, 2649, 2649, 2649, 2649, 2649, 2649, 2649, 2656, 2702,
-     2657, 2657, 2657, 2657, 2657, 2657, 2657, 2657, 2702, 2702,
-
-     2702, 2702, 2702, 2648, 2648, 2648, 2648, 2648, 2648, 2656,
-     2702, 2658, 2658, 2658, 2658, 2658, 2659, 2613, 2613, 2656,
-     2702, 2613, 2613, 2613, 2613, 2613, 2613, 2613, 2613,  383,
-     2660, 2660, 2660, 2660, 2660, 2660, 2660, 2660, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2497, 2497, 2497, 2497, 2497,
-     2497, 2661, 2661, 2661, 2661, 2661, 2661, 2661, 2661,  383,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 2702, 2702,
-     2702, 2702, 2702, 2702, 2497, 2497, 2497, 2497, 2497, 2497,
-      383,  647,  647,  647,  647,  647,  647,  647,  647,  383,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385,  383, 1385,
-
-     1385, 1385, 1385, 1385, 1385, 1385, 1385,  383,  647,  647,
-      647,  647,  647,  647,  647,  647,  383, 1385, 1385, 1385,
-     1385, 1385, 1385, 1385, 1385,  383, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385, 1385,  383,  647,  647,  647,  647,  647,
-      647,  647,  647,  383, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385,  383, 1385, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385,  383,  647,  647,  647,  647,  647,  647,  647,  647,
-      383, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385,  383,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385,  383,  647,
-      647,  647,  647,  647,  647,  647,  647,  383, 1385, 1385,
-
-     1385, 1385, 1385, 1385, 1385, 1385,  383, 1385, 1385, 1385,
-     1385, 1385, 1385, 1385, 1385,  383,  647,  647,  647,  647,
-      647,  647,  647,  647,  383, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385,  383, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385,  383,  647,  647,  647,  647,  647,  647,  647,
-      647,  383, 2662, 2662, 2662, 2662, 2662, 2662, 2662, 2662,
-      383, 2663, 2663, 2663, 2663, 2663, 2664, 2665, 2665,  383,
-     2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2666, 2702,
-     2667, 2667, 2667, 2667, 2667, 2667, 2667, 2667, 2666, 2702,
-     2668, 2668, 2668, 2668, 2668, 2669, 2643, 2643, 2666, 2702,
-
-     2643, 2643, 2643, 2643, 2643, 2643, 2643, 2643,  383, 2670,
-     2670, 2670, 2670, 2670, 2670, 2670, 2670, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2671, 2671, 2671, 2671, 2671, 2671,
-     2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2673, 2702,
-     2702, 2702, 2702, 2702, 2702, 2656,  144, 2613, 2613, 2613,
-     2613, 2613, 2613, 2671, 2671, 2671, 2671, 2671, 2671, 2675,
-     2676, 2677, 2678, 2678, 2678, 2678, 2678, 2673, 2702, 2702,
-     2702, 2702, 2702, 2702, 2656,  144, 2613, 2613, 2613, 2613,
-     2613, 2613, 2613, 2613, 2656, 2702, 2613, 2613, 2613, 2613,
-     2613, 2613, 2613, 2613,  383, 1385, 1385, 1385, 1385, 1385,
-
-     1385, 1385, 1385,  383, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385,  383, 2679, 2679, 2679, 2679, 2679, 2679, 2679,
-     2679,  383, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679,
-      383, 2679, 2679, 2679, 2679, 2679, 2679, 1385, 1385,  383,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 2680, 2681,
-     2682, 2683, 2683, 2683, 2683, 2683, 2666, 2702, 2643, 2643,
-     2643, 2643, 2643, 2643, 2643, 2643, 2666, 2702, 2643, 2643,
-     2643, 2643, 2643, 2643, 2643, 2643, 2666, 2702, 2643, 2643,
-     2643, 2643, 2643, 2643,  383, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1385,  383,  647,  647,  647,  647,  647,  647,
-
-      647,  647,  383, 1385, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385,  144,  383,  647,  647,  647,  647,  647,  647,  647,
-      647, 2702, 2684,  383, 2686, 2686, 2686, 2686, 2686, 2686,
-     2686, 2686, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-      144,  383, 2687, 2687, 2687, 2687, 2687, 2688, 2689, 2689,
-     2702, 2684,  383, 2689, 2689, 2689, 2689, 2689, 2689, 2689,
-     2689,  383, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385,
-      383,  647,  647,  647,  647,  647,  647,  647,  647,  383,
-     2690, 2690, 2690, 2690, 2690, 2690, 2690, 2690,  383, 2691,
-     2691, 2691, 2691, 2691, 2692, 2693, 2693,  383, 2693, 2693,
-
-     2693, 2693, 2693, 2693, 2693, 2693,  383, 2696, 2696, 2696,
-     2696, 2696, 2696, 2696, 2696,  383, 2696, 2696, 2696, 2696,
-     2696, 2696, 2696, 2696,  383, 2696, 2696, 2696, 2696, 2696,
-     2696, 1385, 1385,  383, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385,  383, 2697, 2697, 2697, 2697, 2697, 2697, 2697,
-     2697,  383, 2697, 2697, 2697, 2697, 2697, 2697, 2697, 2697,
-      383, 2697, 2697, 2697, 2697, 2697, 2697, 1385, 1385,  383,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385,  383, 1385,
-     1385, 1385, 1385, 1385, 1385, 1385, 1385,  383, 1385, 1385,
-     1385, 1385, 1385, 1385, 1385, 1385,   64,   64,   64,   64,
-
-       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
-       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
-       64,   64,   64,   73,   73,   73,   73,   73,   73,   73,
-       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
-       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
-       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
-       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
-       79,   79,   79,   79,   79,   79,   79,   86,   86,   86,
-       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
-       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
-
-       86,   86,   86,   86,   94,   94,   94,   94,   94,   94,
-       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
-       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
-       94,  101,  101,  101,  101,  101,  101,  101,  101,  101,
-      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
-      101,  101,  101,  101,  101,  101,  101,  101,  103,  103,
-      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
-      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
-      103,  103,  103,  103,  103,  107,  107,  107,  107,  107,
-      107,  107,  107,  107,  107,  107,  107,  107,  107,  107,
-
-      107,  107,  107,  107,  107,  107,  107,  107,  107,  107,
-      107,  107,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  120,
-      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
-      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
-      120,  120,  120,  120,  120,  120,  125,  125,  125,  125,
-      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
-      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
-      125,  125,  125,  129,  129, 2702, 2702, 2702,  129, 2702,
-
-      129,  129,  129, 2702,  129,  129,  129,  129,  129,  129,
-      129,  132,  132,  132,  132,  132,  132,  132,  132,  132,
-      132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
-      132,  132,  132,  132,  132,  132,  132,  132,  137,  137,
-     2702, 2702, 2702,  137, 2702,  137,  137,  137, 2702,  137,
-      137,  137,  137,  137,  137,  137,  290, 2702, 2702,  290,
-     2702,  290, 2702,  290,  290,  290,  290,  290,  290,  290,
-      290,  290,  290,  290,  290,  290,  290,  290,  290,  290,
-      290,  290,  290,  293,  293,  293,  293,  293,  293,  293,
-      293,  293,  293,  293,  293,  293,  293,  293,  293,  293,
-
-      293,  293,  293,  293,  293,  293,  293,  293,  293,  293,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  305,  305, 2702,
-      305,  305,  305,  305,  305,  305,  305,  305,  305,  305,
-      305,  305,  305,  305,  305,  305,  305,  305,  305,  305,
-      306,  306, 2702, 2702, 2702,  306, 2702,  306,  306,  306,
-     2702,  306,  306, 2702,  306,  306,  306,  306,  307,  307,
-     2702,  307,  307,  307,  307,  307,  307,  307,  307,  307,
-      307,  307,  307,  307,  307,  307,  307,  307,  307,  307,
-
-      307,  310,  310, 2702,  310,  310,  310,  310,  310,  310,
-      310,  310,  310,  310,  310,  310,  310,  310,  310,  310,
-      310,  310,  310,  310,  311,  311, 2702, 2702, 2702,  311,
-     2702,  311,  311,  311, 2702,  311,  311, 2702,  311,  311,
-      311,  311,  312,  312, 2702,  312,  312,  312,  312,  312,
-      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
-      312,  312,  312,  312,  312,  313,  313,  313,  313, 2702,
-      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
-      313,  313,  313,  313,  313, 2702,  313,  313,  313,  313,
-      313,  313,  317,  317,  317,  317, 2702,  317,  317,  317,
-
-      317,  317,  317,  317,  317,  317,  317,  317,  317,  317,
-      317,  317,  317,  317,  317,  317,  317,  317,  317,  320,
-      320,  320,  320, 2702,  320,  320,  320,  320,  320,  320,
-      320,  320,  320,  320,  320,  320,  320,  320,  320, 2702,
-      320,  320,  320,  320,  320,  320,  322,  322,  322,  322,
-     2702,  322,  322,  322,  322,  322,  322,  322,  322,  322,
-      322,  322,  322,  322,  322,  322,  322,  322,  322,  322,
-      322,  322,  322,  325,  325,  325,  325, 2702,  325,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-      325,  325,  325, 2702,  325,  325,  325,  325,  325,  325,
-
-      327,  327,  327,  327, 2702,  327,  327,  327,  327,  327,
-      327,  327,  327,  327,  327,  327,  327,  327,  327,  327,
-      327,  327,  327,  327,  327,  327,  327,  330,  330,  330,
-      330, 2702,  330,  330,  330,  330,  330,  330,  330,  330,
-      330,  330,  330,  330,  330,  330,  330, 2702,  330,  330,
-      330,  330,  330,  330,  332,  332,  332,  332,  332,  332,
-      332,  332,  332,  332,  332,  332,  332,  332, 2702,  332,
-     2702,  332,  332,  333,  333,  333,  333,  333,  333,  333,
-      333,  333,  333,  333,  333,  333,  333, 2702,  333,  333,
-      333,  333,  334,  334,  334,  334,  334,  334,  334,  334,
-
-      334,  334,  334,  334, 2702,  334,  334,  334,  334,  335,
-      335, 2702, 2702, 2702,  335, 2702,  335,  335,  335, 2702,
-      335,  335, 2702,  335,  335,  335,  335,  336,  336, 2702,
-     2702, 2702,  336, 2702,  336,  336,  336, 2702,  336,  336,
-     2702,  336,  336,  336,  336,  337,  337, 2702, 2702, 2702,
-      337, 2702,  337,  337,  337, 2702,  337,  337, 2702,  337,
-      337,  337,  337,  340, 2702,  340,  340, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702,  340,  340, 2702, 2702,  340,  342,
-     2702, 2702, 2702,  342,  342,  342,  342,  342,  342,  342,
-      342,  342, 2702,  342,  342,  342,  342,  342,  342,  342,
-
-      342,  342, 2702, 2702,  342,  342,  346,  346, 2702,  346,
-      346,  346,  346,  346,  346,  346,  346,  346,  346, 2702,
-      346,  346,  346, 2702,  346,  346,  346,  346,  346,  346,
-     2702,  346,  346,  351, 2702, 2702, 2702, 2702,  351,  351,
-      351,  351,  351,  351,  351,  351,  351,  351,  351,  351,
-      351,  351,  351,  351,  351,  351,  351,  351,  351,  351,
-      353,  353, 2702, 2702,  353,  353,  353,  353,  353,  353,
-      353,  353,  353,  353,  353,  353,  353,  353,  353,  353,
-      353,  353,  353,  353,  353,  353,  353,  355,  355, 2702,
-     2702,  355,  355,  355,  355,  355,  355,  355,  355,  355,
-
-      355,  355,  355,  355,  355,  355,  355,  355,  355,  355,
-      355,  355,  355,  355,  120,  120,  120,  120,  120,  120,
-      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
-      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
-      120,  357,  357,  357,  357,  357,  357,  357,  357,  357,
-      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
-      357,  357,  357,  357,  357,  357,  357,  357,  123,  123,
-      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
-      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
-      123,  123,  123,  123,  123,  125,  125,  125,  125,  125,
-
-      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
-      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
-      125,  125,  360,  360,  360,  360,  360,  360,  360,  360,
-      360,  360,  360,  360,  360,  360,  360,  360,  360,  360,
-      360,  360,  360,  360,  360,  360,  360,  360,  360,  362,
-      362,  362,  362,  362,  362,  362,  362,  362,  362,  362,
-      362,  362,  362,  362,  362,  362,  362,  362,  362,  362,
-      362,  362,  362,  362,  362,  362,  129,  129, 2702, 2702,
-     2702,  129, 2702,  129,  129,  129, 2702,  129,  129,  129,
-      129,  129,  129,  129,  364,  364, 2702, 2702, 2702,  364,
-
-     2702,  364,  364,  364, 2702,  364,  364,  364,  364,  364,
-      364,  364,  365,  365, 2702, 2702, 2702,  365, 2702,  365,
-      365,  365, 2702,  365,  365, 2702,  365,  365,  365,  365,
-      132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
-      132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
-      132,  132,  132,  132,  132,  132,  132,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  137,  137, 2702, 2702, 2702,  137,
-     2702,  137,  137,  137, 2702,  137,  137,  137,  137,  137,
-
-      137,  137,  370,  370, 2702, 2702, 2702,  370, 2702,  370,
-      370,  370, 2702,  370,  370,  370,  370,  370,  370,  370,
-      139,  139, 2702, 2702, 2702,  139, 2702,  139,  139,  139,
-     2702,  139,  139,  139,  139,  139,  139,  139,  371,  371,
-     2702, 2702, 2702,  371, 2702,  371,  371,  371, 2702,  371,
-      371,  371,  371,  371,  371,  371,  290, 2702, 2702,  290,
-     2702,  290, 2702,  290,  290,  290,  290,  290,  290,  290,
-      290,  290,  290,  290,  290,  290,  290,  290,  290,  290,
-      290,  290,  290,  293,  293,  293,  293,  293,  293,  293,
-      293,  293,  293,  293,  293,  293,  293,  293,  293,  293,
-
-      293,  293,  293,  293,  293,  293,  293,  293,  293,  293,
-      294,  294,  294,  294,  294,  294,  294,  294,  294,  294,
-      294,  294,  294,  294,  294,  294,  294,  294,  294,  294,
-      294,  294,  294,  294,  294,  294,  294,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  305,  305,  305,  305,  305,  305,
-      305,  305,  305,  305,  305,  305,  305,  305,  305,  305,
-      305,  305,  305,  305,  305,  305,  305,  306,  306, 2702,
-     2702, 2702,  306, 2702,  306,  306,  306, 2702,  306,  306,
-
-     2702,  306,  306,  306,  306,  307,  307, 2702,  307,  307,
-      307,  307,  307,  307,  307,  307,  307,  307,  307,  307,
-      307,  307,  307,  307,  307,  307,  307,  307,  310,  310,
-      310,  310,  310,  310,  310,  310,  310,  310,  310,  310,
-      310,  310,  310,  310,  310,  310,  310,  310,  310,  310,
-      310,  311,  311, 2702, 2702, 2702,  311, 2702,  311,  311,
-      311, 2702,  311,  311, 2702,  311,  311,  311,  311,  312,
-      312, 2702,  312,  312,  312,  312,  312,  312,  312,  312,
-      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
-      312,  312,  313,  313,  313,  313, 2702,  313,  313,  313,
-
-      313,  313,  313,  313,  313,  313,  313,  313,  313,  313,
-      313,  313, 2702,  313,  313,  313,  313,  313,  313,  607,
-      607,  607,  607, 2702,  607,  607,  607,  607,  607,  607,
-      607,  607,  607,  607,  607,  607, 2702,  607,  607, 2702,
-      607,  607,  607,  607,  607,  607,  317,  317,  317,  317,
-     2702,  317,  317,  317,  317,  317,  317,  317,  317,  317,
-      317,  317,  317,  317,  317,  317,  317,  317,  317,  317,
-      317,  317,  317,  608,  608,  608,  608, 2702,  608,  608,
-      608,  608,  608,  608,  608,  608,  608,  608,  608,  608,
-      608,  608,  608,  608,  608,  608,  608,  608,  608,  608,
-
-      319,  319, 2702, 2702, 2702,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  320,  320,  320,
-      320, 2702,  320,  320,  320,  320,  320,  320,  320,  320,
-      320,  320,  320,  320,  320,  320,  320, 2702,  320,  320,
-      320,  320,  320,  320,  609,  609,  609,  609, 2702,  609,
-      609,  609,  609,  609,  609,  609,  609,  609,  609,  609,
-      609,  609,  609,  609, 2702,  609,  609,  609,  609,  609,
-      609,  322,  322,  322,  322, 2702,  322,  322,  322,  322,
-      322,  322,  322,  322,  322,  322,  322,  322,  322,  322,
-
-      322,  322,  322,  322,  322,  322,  322,  322,  610,  610,
-      610,  610, 2702,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  324,  324, 2702, 2702, 2702,
-      324,  324, 2702,  324,  324,  324,  324,  324,  324,  324,
-      324,  324,  324,  324, 2702,  324,  324,  324,  324,  324,
-      324,  324,  325,  325,  325,  325, 2702,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  325,
-      325,  325,  325,  325,  325,  325,  325,  325,  325,  327,
-      327,  327,  327, 2702,  327,  327,  327,  327,  327,  327,
-
-      327,  327,  327,  327,  327,  327,  327,  327,  327,  327,
-      327,  327,  327,  327,  327,  327,  612,  612,  612,  612,
-     2702,  612,  612,  612,  612,  612,  612,  612,  612,  612,
-      612,  612,  612,  612,  612,  612,  612,  612,  612,  612,
-      612,  612,  612,  329,  329, 2702, 2702, 2702,  329,  329,
-     2702,  329,  329,  329,  329,  329,  329,  329,  329,  329,
-      329,  329,  329,  329,  329,  329,  329,  329,  329,  329,
-      330,  330,  330,  330, 2702,  330,  330,  330,  330,  330,
-      330,  330,  330,  330,  330,  330,  330,  330,  330,  330,
-     2702,  330,  330,  330,  330,  330,  330,  614,  614,  614,
-
-      614, 2702,  614,  614,  614,  614,  614,  614,  614,  614,
-      614,  614,  614,  614,  614,  614,  614, 2702,  614,  614,
-      614,  614,  614,  614,  332,  332,  332,  332,  332,  332,
-      332,  332,  332,  332,  332,  332,  332,  332, 2702,  332,
-     2702,  332,  332,  333,  333,  333,  333,  333,  333,  333,
-      333,  333,  333,  333,  333,  333,  333, 2702,  333,  333,
-      333,  333,  334,  334,  334,  334,  334,  334,  334,  334,
-      334,  334,  334,  334, 2702,  334,  334,  334,  334,  335,
-      335,  335, 2702, 2702, 2702,  335, 2702,  335,  335,  335,
-     2702,  335,  335, 2702,  335,  335,  335,  335,  336,  336,
-
-     2702, 2702, 2702,  336, 2702,  336,  336,  336, 2702,  336,
-      336, 2702,  336,  336,  336,  336,  337,  337, 2702,  337,
-     2702,  337, 2702,  337,  337,  337, 2702,  337,  337, 2702,
-      337,  337,  337,  337,  340, 2702,  340,  340, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702,  340,  340, 2702, 2702,  340,
-      342, 2702, 2702, 2702,  342,  342,  342,  342,  342,  342,
-      342,  342,  342, 2702,  342,  342,  342,  342,  342,  342,
-      342,  342,  342, 2702, 2702,  342,  342,  346,  346, 2702,
-     2702,  346,  346,  346,  346,  346,  346,  346,  346,  346,
-     2702,  346,  346,  346, 2702,  346,  346,  346,  346,  346,
-
-      346, 2702,  346,  346,  622,  622,  622,  622,  622,  622,
-      622,  622,  622,  622,  622,  622,  622,  622,  622,  622,
-      622,  622,  622,  622,  622,  622,  622,  622,  622,  622,
-      622,  624,  624,  624,  624,  624,  624,  624,  624,  624,
-      624,  624,  624,  624,  624,  624,  624,  624,  624,  624,
-      624,  624,  624,  624,  624,  624,  624,  624,  351, 2702,
-     2702, 2702, 2702,  351,  351,  351,  351,  351,  351,  351,
-      351,  351,  351,  351,  351,  351,  351,  351,  351,  351,
-      351,  351,  351,  351,  351,  353,  353, 2702, 2702,  353,
-      353,  353,  353,  353,  353,  353,  353,  353,  353,  353,
-
-      353,  353,  353,  353,  353,  353,  353,  353,  353,  353,
-      353,  353,  354,  354, 2702, 2702,  354,  354,  354,  354,
-      354,  354,  354,  354,  354,  354,  354,  354,  354,  354,
-      354,  354,  354,  354,  354,  354,  354,  354,  354,  355,
-      355, 2702, 2702,  355,  355,  355,  355,  355,  355,  355,
-      355,  355,  355,  355,  355,  355,  355,  355,  355,  355,
-      355,  355,  355,  355,  355,  355,  356,  356, 2702, 2702,
-      356,  356,  356,  356,  356,  356,  356,  356,  356,  356,
-      356,  356,  356,  356,  356,  356,  356,  356,  356,  356,
-      356,  356,  356,  357,  357,  357,  357,  357,  357,  357,
-
-      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
-      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
-      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
-      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
-      123,  123,  123,  123,  123,  123,  123,  360,  360,  360,
-      360,  360,  360,  360,  360,  360,  360,  360,  360,  360,
-      360,  360,  360,  360,  360,  360,  360,  360,  360,  360,
-      360,  360,  360,  360,  362,  362,  362,  362,  362,  362,
-      362,  362,  362,  362,  362,  362,  362,  362,  362,  362,
-      362,  362,  362,  362,  362,  362,  362,  362,  362,  362,
-
-      362,  364,  364, 2702, 2702, 2702,  364, 2702,  364,  364,
-      364, 2702,  364,  364,  364,  364,  364,  364,  364,  365,
-      365, 2702, 2702, 2702,  365, 2702,  365,  365,  365, 2702,
-      365,  365, 2702,  365,  365,  365,  365,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  129,  129, 2702, 2702, 2702,  129,
-     2702,  129,  129,  129, 2702,  129,  129,  129,  129,  129,
-      129,  129,  370,  370, 2702, 2702, 2702,  370, 2702,  370,
-      370,  370, 2702,  370,  370,  370,  370,  370,  370,  370,
-
-      371,  371, 2702, 2702, 2702,  371, 2702,  371,  371,  371,
-     2702,  371,  371,  371,  371,  371,  371,  371,  139,  139,
-     2702, 2702, 2702,  139, 2702,  139,  139,  139, 2702,  139,
-      139,  139,  139,  139,  139,  139,  307,  307, 2702,  307,
-      307,  307,  307,  307,  307,  307,  307,  307,  307,  307,
-      307,  307,  307,  307,  307,  307,  307,  307,  307,  312,
-      312, 2702,  312,  312,  312,  312,  312,  312,  312,  312,
-      312,  312,  312,  312,  312,  312,  312,  312,  312,  312,
-      312,  312,  607,  607,  607,  607, 2702,  607,  607,  607,
-      607,  607,  607,  607,  607,  607,  607,  607,  607, 2702,
-
-      607,  607,  607,  607,  607,  607,  607,  607,  607,  608,
-      608,  608,  608, 2702,  608,  608,  608,  608,  608,  608,
-      608,  608,  608,  608,  608,  608,  608,  608,  608,  608,
-      608,  608,  608,  608,  608,  608,  609,  609,  609,  609,
-     2702,  609,  609,  609,  609,  609,  609,  609,  609,  609,
-      609,  609,  609,  609,  609,  609, 2702,  609,  609,  609,
-      609,  609,  609,  610,  610,  610,  610, 2702,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  610,  610,  610,  610,  610,
-      612,  612,  612,  612, 2702,  612,  612,  612,  612,  612,
-
-      612,  612,  612,  612,  612,  612,  612,  612,  612,  612,
-      612,  612,  612,  612,  612,  612,  612,  313,  313,  313,
-      313, 2702,  313,  313,  313,  313,  313,  313,  313,  313,
-      313,  313,  313,  313,  313,  313,  313, 2702,  313,  313,
-      313,  313,  313,  313,  614,  614,  614,  614, 2702,  614,
-      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
-      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
-      614,  615, 2702, 2702, 2702, 2702,  615, 2702,  615,  615,
-     2702, 2702, 2702,  615,  615, 2702,  615,  877, 2702,  877,
-      877, 2702, 2702, 2702, 2702, 2702, 2702, 2702,  877,  877,
-
-     2702, 2702,  877,  623,  623,  623,  623,  623,  623, 2702,
-      623,  623,  623,  623,  623,  623,  623,  623,  623,  623,
-      623,  623,  623,  623,  623,  623,  623,  623,  623,  623,
-      625,  625,  625,  625,  625,  625,  625,  625,  625,  625,
-     2702,  625,  625,  625,  625,  625,  625,  625,  625,  625,
-      625,  625,  625,  625,  625,  625,  625,  622,  622,  622,
-      622,  622,  622,  622,  622,  622,  622,  622,  622,  622,
-      622,  622,  622,  622,  622,  622,  622,  622,  622,  622,
-      622,  622,  622,  622,  624,  624,  624,  624,  624,  624,
-      624,  624,  624,  624,  624,  624,  624,  624,  624,  624,
-
-      624,  624,  624,  624,  624,  624,  624,  624,  624,  624,
-      624,  351, 2702, 2702, 2702, 2702,  351,  351,  351,  351,
-      351,  351,  351,  351,  351,  351,  351,  351,  351,  351,
-      351,  351,  351,  351,  351,  351,  351,  351,  129,  129,
-     2702, 2702, 2702,  129, 2702,  129,  129,  129, 2702,  129,
-      129,  129,  129,  129,  129,  129,  371,  371, 2702, 2702,
-     2702,  371, 2702,  371,  371,  371, 2702,  371,  371,  371,
-      371,  371,  371,  371,  139,  139, 2702, 2702, 2702,  139,
-     2702,  139,  139,  139, 2702,  139,  139,  139,  139,  139,
-      139,  139,  319,  319, 2702, 2702, 2702,  319,  319,  319,
-
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  324,
-      324, 2702, 2702, 2702,  324,  324, 2702,  324,  324,  324,
-      324,  324,  324,  324,  324,  324,  324,  324, 2702,  324,
-      324,  324,  324,  324,  324,  324,  329,  329, 2702, 2702,
-     2702,  329,  329, 2702,  329,  329,  329,  329,  329,  329,
-      329,  329,  329,  329,  329,  329,  329,  329,  329,  329,
-      329,  329,  329,  877, 2702,  877,  877, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702,  877,  877, 2702, 2702,  877, 1352,
-     2702, 1352, 1352, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-
-     1352, 1352, 2702, 2702, 1352,  139,  139, 2702, 2702, 2702,
-      139, 2702,  139,  139,  139, 2702,  139,  139,  139,  139,
-      139,  139,  139, 1352, 2702, 1352, 1352, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 1352, 1352, 2702, 2702, 1352,  129,
-      129, 2702, 2702, 2702,  129, 2702,  129,  129,  129, 2702,
-      129,  129,  129,  129,  129,  129,  129,  371,  371, 2702,
-     2702, 2702,  371, 2702,  371,  371,  371, 2702,  371,  371,
-      371,  371,  371,  371,  371, 1749, 2702, 1749, 1749, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 1749, 1749, 2702, 2702,
-     1749,  144,  144, 2702, 2702, 2702,  144, 2702,  144,  144,
-
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  139,
-      139, 2702, 2702, 2702,  139, 2702,  139,  139,  139, 2702,
-      139,  139,  139,  139,  139,  139,  139, 1857, 1857, 1857,
-     1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857,
-     1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857,
-     1857, 1857, 1857, 1899, 1899, 2702, 1899, 1899, 1899, 1899,
-     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
-     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1749,
-     2702, 1749, 1749, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     1749, 1749, 2702, 2702, 1749,  371,  371, 2702, 2702, 2702,
-
-      371, 2702,  371,  371,  371, 2702,  371,  371,  371,  371,
-      371,  371,  371,  144,  144, 2702, 2702, 2702,  144, 2702,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  139,  139, 2702, 2702, 2702,  139, 2702,  139,  139,
-      139, 2702,  139,  139,  139,  139,  139,  139,  139, 1857,
-     1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857,
-     1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857,
-     1857, 1857, 1857, 1857, 1857, 1899, 1899, 2702, 1899, 1899,
-     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
-     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
-
-     1899, 2058, 2702, 2058, 2058, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2058, 2058, 2702, 2702, 2058,  144,  144, 2702,
-     2702, 2702,  144, 2702,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  139,  139, 2702, 2702, 2702,
-      139, 2702,  139,  139,  139, 2702,  139,  139,  139,  139,
-      139,  139,  139, 1857, 1857, 1857, 1857, 1857, 1857, 1857,
-     1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857,
-     1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1857, 1899,
-     1899, 2702, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
-     1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899, 1899,
-
-     1899, 1899, 1899, 1899, 1899, 2058, 2702, 2058, 2058, 2702,
-     2058, 2702, 2702, 2702, 2058, 2702, 2058, 2058, 2702, 2702,
-     2058,  144,  144, 2702, 2702, 2702,  144, 2702,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  139,
-      139, 2702, 2702, 2702,  139, 2702,  139,  139,  139, 2702,
-      139,  139,  139,  139,  139,  139,  139,  144,  144, 2702,
-     2702, 2702,  144, 2702,  144,  144,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  139,  139, 2702, 2702, 2702,
-      139, 2702,  139,  139,  139, 2702,  139,  139,  139,  139,
-      139,  139,  139,  144,  144, 2702, 2702, 2702,  144, 2702,
-
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
-      144,  139,  139, 2702, 2702, 2702,  139, 2702,  139,  139,
-      139, 2702,  139,  139,  139,  139,  139,  139,  139,  144,
-      144, 2702, 2702, 2702,  144, 2702,  144,  144,  144,  144,
-      144,  144,  144,  144,  144,  144,  144,  139,  139, 2702,
-     2702, 2702,  139, 2702,  139,  139,  139, 2702,  139,  139,
-      139,  139,  139,  139,  139,   21, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702
-    } ;
-
-static const flex_int16_t yy_chk[18657] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        3,    3,    3,    3,  122,    3,   26,   30,  122,    3,
-
-        4,    4,    4,    4,   30,    4, 2643,   26, 2613,    4,
-        5,    5,    5,    5,    5,    5,    5,   28,   32,    5,
-        5,    5,    5,   65,    5,   65,   65, 2564,   17,   17,
-       17,   17,  115,   28,   32,  115,    5,    5,   17,   17,
-     2544,   17,    5,   19,   19,   19,   19,   38,   19,   94,
-       94,   39,   19,   17,   17,   18,   18,   18,   18,   63,
-       38, 2536,  123,   38,   39,   18,   18,   39,   18,   20,
-       20,   20,   20,   63,   20,  134,  352,   94,   20,  352,
-       18,   18,   23,  134,   23,   23,   17, 2532,   17,   63,
-       95,   95,   23,   23,   67,   23,   67,   67,    5,    5,
-
-        6,    6,    6,    6,    6,    6,    6,   31,   23,    6,
-        6,    6,    6,   18,    6,   18,   69,   69,   95,   69,
-      123,   69, 1671,   31, 2495,   69,    6,    6,   76, 1671,
-       76,   76,    6,   34,   34,   34,   34,   34,   34,   34,
-       34,  157,   31,   31,   35,   35,   35,   35,   35,   35,
-       35,   35,   36,   36,   36,   36,   36,   36,   36,   36,
-       40,   82, 2491,   82,   82,   84,  117,   84,   84,  117,
-      157,   31,   31,   40, 2466,  117,   40,   88,   88,   88,
-       88,   88,   88,   88,   88, 2443,   82,  129,    6,    6,
-        7,    7,    7,    7,    7,    7,    7,  158, 2438,    7,
-
-        7,    7,    7,  129,    7,   50,   51,   51,  116,   50,
-       51,  116, 2433,  116,   51,  366,    7,    7,  159,   50,
-       51,  137,    7,  366,   50,   51,  158,   54,   85,   85,
-      104,   54,  104,  104,   50,   51,   51,  137,   50,   51,
-       54,   54,  105,   51,  105,  105,   54,  159,   50,   51,
-      139,  150,   85,   50,   51, 2302,   54,  151,   85,  142,
-       54,   70,   70,   70,   70, 2302,  139,  150,  142,   54,
-       54,   70,   70,  151,   70,   54, 2428,  136,    7,    7,
-        8,    8,    8,    8,    8,    8,    8,   70, 2423,    8,
-        8,    8,    8,  136,    8,   57,   61, 2835,   57,   57,
-
-       61,  162, 2835,  152,   61,  136,    8,    8, 1221,   57,
-       61, 1221,    8,   57,   57,   61,   87,   87,   62,  152,
-      161,   87,   62,  165,   57,   61,   62,   57,   57,   61,
-      162,  161,   62,   61,  136,   62,  166,   62,   57,   61,
-       87, 1831,   57,   57,   61,   87,   87,   62, 1831,  161,
-     1226,   62,  165, 1226,  111,   62,  111,  111,  357,  111,
-      161,   62,  357,  111,   62,  166,   62, 2412,    8,    8,
-        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9,  170,    9,    9,  106,  106,
-      106,  106,  106,  106,  106,  106,    9,    9,    9,    9,
-
-        9,    9,    9, 2411,  173, 2307,   71,   71,   71,   71,
-       75,   75,   75,   75,  170, 2307,   71,   71,  156,   71,
-       75,   75,  400,   75,  108,  156,  108,  108,  175,    9,
-        9,    9,   71,  173,  108,  108,   75,  108,  400,  140,
-      140,  140,  140,  140,  140,  140,  140,  156,  359, 2409,
-      108,   89,   89,  140,  156,  176,   89,  175,    9,    9,
-       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
-       10,   10,   10,   10,   10,   89,   10,   10,  135, 2377,
-      163,   89,  654,  654,  176, 2375,   10,   10,   10,   10,
-       10,   10,   10,  719,  135,  179,  163,  110, 2365,  110,
-
-      110,  118, 1833,  118,  118, 1833,  359,  110,  110,  719,
-      110,  118,  118,  135,  118,  163,  180,  182,  174,   10,
-       10,   10,  110,  110,  179,  740,  143,  118,  143,  143,
-      143,  143,  143,  143,  143,  143, 2361,  291,  174,  291,
-      291,  740,  135, 2355,  163,  180,  182,  174,   10,   10,
-       11,   11,   11,   11,   11,   11,  145, 2345,  145,  145,
-      145,  145,  145,  145,  145,  145,  146,  174,  146,  146,
-      146,  146,  146,  146,  146,  146,   11,  184,   11, 2335,
-       11,  147,   11,  147,  147,  147,  147,  147,  147,  154,
-     2325,  154,  154,  154,  154,  154,  154,  154,  154,  169,
-
-      185, 2314,  186,  169,  181,  187,  184,  169,  154,   11,
-      155,   11,  155,  155,  155,  155,  155,  155,  155,  155,
-      172,  188,  181,  192,  172,  154,  194,  172,  169,  185,
-      155,  186,  169,  181,  187, 2301,  169,  154,   11,   11,
-       12,   12,   12,   12,   12,   12,  756,  881, 2250,  172,
-      188,  181,  192,  172,  154,  194,  172, 2227,  292,  155,
-      292,  292,  756,  881,  193,  191,   12,  195,   12,  191,
-       12,  198,   12,  164,  193,  164,  164,  164,  164,  164,
-      164,  164,  164,  168,  200,  168,  168,  168,  168,  168,
-      168,  168,  168,  193,  191,  203,  195,  204,  191,   12,
-
-      198,   12,  309,  193,  309,  309, 1126,  353,  164,  164,
-      353, 2225,  353,  200,  206,  894,  894,  168,  293,  293,
-     2843,  293, 1126,  293,  203, 2843,  204,  293,   12,   12,
-       13,   13,   13,   13,   13,   13,   13,  164,  164,   13,
-       13,   13,   13,  206,   13,  167,  168,  167,  167,  167,
-      167,  167,  167,  167,  167,  171,   13,   13,  207,  171,
-      178,  178,   13,  171,  167,  208,  210,  178,  189,  171,
-      199,  178,  189,  199,  205,  178,  205,  167,  211,  189,
-      178,  213,  216,  217,  171,  218,  219,  207,  171,  178,
-      178, 2218,  171,  167,  208,  210,  178,  189,  171,  199,
-
-      178,  189,  199,  205,  178,  205,  167,  211,  189,  178,
-      213,  216,  217,  183,  218,  219,  183, 2216,   13,   13,
-       14,   14,   14,   14,   14,   14,   14,  220,  183,   14,
-       14,   14,   14,  183,   14, 2209,  201,  190,  222,  190,
-      201, 2207,  183,  190,  230,  183,   14,   14, 2200,  223,
-      201,  229,   14,  229,  190,  223,  220,  183,  212,  190,
-      221,  221,  183,  232,  212,  201,  190,  222,  190,  201,
-      212,  234,  190,  230,  212,  212,  235,  212,  223,  201,
-      229, 2198,  229,  190,  223,  237, 1127,  212,  190,  221,
-      221,  236,  232,  212,  236,  239,  241,  244,  355,  212,
-
-      234,  355, 1127,  212,  212,  235,  212,  355,   14,   14,
-       15,   15,   15,   15,  237,   15,  242,  247,  250,   15,
-      236,  251,  242,  236,  239,  241,  244,   15,   15,   15,
-       15,   15,   15,   15,   15,   16,   16,   16,   16,  316,
-       16,  316,  316, 2847,   16,  242,  247,  250, 2847,  253,
-      251,  242,   16,   16,   16,   16,   16,   16,   16,   16,
-       27,   27,   27,   27,   27,   27,   27,  231,  225,   27,
-       27,   27,   27,  225,   27,  243,   27,  231,  253,  225,
-      238,  231,  228,  225,  245,  256,   27,   27,  228,  258,
-      243, 2185,   27,  238,  228,  228,  231,  225,  238,  238,
-
-      245,  245,  225,  260,  243,  248,  231,  261,  225,  238,
-      231,  228,  225,  245,  256,  248,  266,  228,  258,  243,
-       27, 2184,  238,  228,  228,  252,  267,  238,  238,  245,
-      245, 1434,  260, 2121,  248,  338,  261,  338,  338, 1434,
-      339,  252,  339,  339,  248,  266, 1164, 1164,   27,   27,
-       33,   33, 1368, 1368,  252,  267,   33, 2119,   33,   33,
-       33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
-      252,   33,   33,   33,   33,   33,   33,   33,   33,   33,
-       33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
-       33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
-
-       33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
-       33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
-       33,   33,   33,   33,   33,   33,   33,   33,   33,   33,
-       33,   41, 2109,   41,   41,   41,   41,   41,   41,   41,
-       41,  246,  249,  268,  249,  249,  246,  257,  269,  262,
-       41,   41, 2105,  262,  270,  272,  257,  255,  257,   41,
-      273,   41,  257,   41,  257,   41,   41,   41,   41, 2099,
-      246,  249,  268,  249,  249,  246,  257,  269,  262,   41,
-       41,  255,  262,  270,  272,  257,  255,  257,   41,  273,
-       41,  257,   41,  257,   41,   41,   41,   41,   42,   42,
-
-       42,   42,   42,   42,   42,   42,   42,   42,  263,  259,
-      255,  259,  263,  264,  274,   42,  275,  265,  265,  271,
-      259,  276,  277,  271,  278,  279,  280,  264,  265,  279,
-      259,  281,  283,  284,  280,   42,  271,  263,  259,   42,
-      259,  263,  264,  274,   42,  275,  265,  265,  271,  259,
-      276,  277,  271,  278,  279,  280,  264,  265,  279,  259,
-      281,  283,  284,  280,   42,  271,  285, 2089,   42,   43,
-     1379, 1379,  287,  315,  282,  315,  315,  286,  282,  288,
-     2079,  289,  282,  394,  396,   43,  403,  286,  340,   43,
-      340,  340,   43,   43,  434,  285,   43, 2068,  315,   43,
-
-       43,  287,   43,  282,   43,   43,  286,  282,  288,   43,
-      289,  282,  394,  396,   43,  403,  286,  619,   43,  619,
-      619,   43,   43,  434, 2060,   43,  333,  333,   43,   43,
-     2059,   43,  368,   43,   43,  411,  411, 1672,   43,   44,
-      297,  297,  297,  297,  302,  302,  302,  302,  368,  392,
-      297,  297, 1672,  297,  333,   44, 1672,  302,  392,   44,
-      368,  317,  317,   44,  411,  411,  297, 2027,   44,   44,
-      298,  298,  298,  298, 1353,   44,  415,   44,  392,   44,
-      298,  298, 1968,  298,   44,  317,  415,  392,   44,  368,
-     1353,  317,   44,  318,  318, 1945,  298,   44,   44, 1437,
-
-      299,  299,  299,  299,   44,  415,   44, 1437,   44,   45,
-      299,  299, 1943,  299, 1440,  415, 1936,  318,  300,  300,
-      300,  300, 1440,  318,  369,   45,  299,   45,  300,  300,
-      347,  300,  347,  347, 1874,  347,   45, 1874,   45,  347,
-      369,   45,  322,  322,  300,   45,   45,  322,   45,   45,
-      301,  301,  301,  301,   45,  448,   45,  323,  323,  369,
-      301,  301,  323,  301, 1934,   45,  322,   45,  327,  327,
-       45,  322,  322,  327,   45,   45,  301,   45,   45,   46,
-      303,  323,  303,  303,  448, 1354,  323,  323,  369, 2416,
-      303,  303,  327,  303,  304,   46,  304,  304,  327, 2416,
-
-      452, 1354,  393,   46,  304,  304,  303,  304,  393,   46,
-      406, 1927,   46,   46,   46,   46,  328,  328,  406,   46,
-      304,  328, 1613, 1613,   46,  348, 1925,  348,  348,  452,
-      348,  393,   46,  877,  348,  877,  877,  393,   46,  406,
-      328,   46,   46,   46,   46, 2854,  328,  406,   46,   47,
-     2854,   47,   47,   47,   47,   47,   47,   47,   47,   47,
-     1998,  454,  308, 1998,  308,  308,   47,   47,   47,   47,
-       47,   47,  308,  308,   47,  308,  344, 2033,  344,  344,
-     2033,   47,  398,   47,  413,   47,  344,  344,  308,  344,
-      454,  398,  413,  455, 1913,   47,   47,   47,   47,   47,
-
-       47, 1912,  344,   47,  387,  387,  387,  387,  387,  387,
-       47,  398,   47,  413,   47,   48,   48,  407,  395,   48,
-      398,  413,  455,   48,  395, 1441,  457,  397,  407,   48,
-       48,  397,   48, 1441,   48,  326,  326,  326,  326,  326,
-      326,  326,  326,  461,   48,   48,  407,  395,   48,  326,
-      349,  349,   48,  395,  349,  457,  397,  407,   48,   48,
-      397,   48,  349,   48,   49,  399,   49,   49,   49,   49,
-       49,  399,  461,  467,  349,  402,   49,   49,   49,   49,
-     1911,  402,   49,   49,  341,  341,  341,  341,  341,  341,
-      341,  341, 1900,   49,  399,   49,   49,   49,   49,   49,
-
-      399,  476,  467,  476,  402,   49,   49,   49,   49,  349,
-      402,   49,   49,   52, 1355,  401,   52,   52, 1690,  401,
-      476,   52, 1858,  350,  350,   52,  345,   52,  345,  345,
-     1355,  350,   52, 1641, 1690,  350,  345,  345,  408,  345,
-     1802, 1641,   52,  408,  401,   52,   52,  350,  401,  476,
-       52,  345,  345, 1800,   52,  404,   52, 1790,  409,  404,
-      483,   52,   53,   53,  409,   53,   53,  408,  410,  412,
-       53,  410,  408,  412,   53,  414,   53,  435,   53,  414,
-       53,   53,  350,  435,  404,  416,   53,  409,  404,  483,
-      416,   53,   53,  409,   53,   53,  416,  410,  412,   53,
-
-      410, 2498,  412,   53,  414,   53,  435,   53,  414,   53,
-       53, 2498,  435, 1786,  416,   53,   55,  493,  418,  416,
-       55,   55, 1781,  418,  417,  416,  425,   55,  417,   55,
-       55,   55,  519,   55,  425,   55, 1771,  376,  376,  376,
-      376,  376,  376,  376,  376,   55,  493,  418, 1760,   55,
-       55,  376,  418,  417, 1872,  425,   55,  417,   55,   55,
-       55,  519,   55,  425,   55,   56,  426,  420,  421,   56,
-     1872,   56,  420,   56,  422,  421,  426,  429,  422,   56,
-       56,  429,   56,  372,   56,  372,  372,  372,  372,  372,
-      372,  372,  372, 1752,   56,  426,  420,  421,   56,  372,
-
-       56,  420,   56,  422,  421,  426,  429,  422,   56,   56,
-      429,   56,  428,   56,   58, 1751,  423,  437,   58,  423,
-      428,   58,   58,  438,  437,   58,   58, 1645,   58,   58,
-      432,  438,   58,   58,   58, 1645,   58,  419,   58, 1750,
-      432,  428,  534,   58,  419,  423,  437,   58,  423,  428,
-       58,   58,  438,  437,   58,   58,  430,   58,   58,  432,
-      438,   58,   58,   58,  430,   58,  430,   58,   59,  432,
-       59,  534,   59,  433,  419,   59,   59,  431,  433,   59,
-      431,   59,   59,  539,  436,  430,  419,   59,  436,  439,
-     1735,  440,   59,  430,  439,  430,  440,   59,  453,   59,
-
-      440,   59,  433,  419,   59,   59,  431,  433,   59,  431,
-       59,   59,  539,  436,  453,  419,   59,  436,  439,  464,
-      440,   59,   60,  439,   60,  440,  540,   60,  464,  440,
-       60,  443,   60,  453,   60,  443,   60,   60,  373, 1680,
-      373,  373,  373,  373,  373,  373,  373,  373,  464, 2386,
-     1646,   60, 2386,   60,  373,  540,   60,  464, 1646,   60,
-      443,   60,  453,   60,  443,   60,   60,   86,   86,   86,
-       86,  463,   86,   86,   86,   86,   86,   86,   86,   86,
-       86,   86,  463,   86,   86,  383,  383,  383,  383,  383,
-      383,  383,  383,   86,   86,   86,   86,   86,   86,  374,
-
-      463,  374,  374,  374,  374,  374,  374,  374,  374,  880,
-     2387,  463,  880, 2387,  375,  374,  375,  375,  375,  375,
-      375,  375,  375,  375, 1614,  880,   86,   86,   86,  378,
-      375,  378,  378,  378,  378,  378,  378,  378,  378,  385,
-      385,  385,  385,  385,  385,  385,  385,  386,  386,  386,
-      386,  386,  386,  386,  386,   86,   86,   90,   90,   90,
-       90,  542,   90,   90,   90,   90, 1595,   90,   90,   90,
-       90,   90,   90,  388,   90,  388,  388,  388,  388,  388,
-      388,  388,  388,   90,   90,   90,   90,   90,   90,  389,
-      542,  389,  389,  389,  389,  389,  389,  389,  389,  391,
-
-      554,  391,  391,  391,  391,  391,  391,  391,  391,  441,
-      389, 1759, 1759,  497,  497,  441,   90,   90,   90,  405,
-     1593,  405,  405,  405,  405,  405,  405,  405,  405,  554,
-     1586,  442, 1584,  391, 1572,  484,  558,  484,  441,  389,
-      405,  442,  497,  497,  441,   90,   90,  125,  125,  125,
-      125,  125,  125,  125, 1770, 1770,  125,  125,  125,  125,
-      442,  125,  391,  125,  484,  558,  484,  447,  445,  405,
-      442,  445,  446,  125,  125,  456,  446,  447,  514,  125,
-      449,  523,  523,  456,  449, 1571,  424, 1570,  424,  424,
-      424,  424,  424,  424,  424,  424,  447,  445,  514,  450,
-
-      445,  446, 1398,  450,  456,  446,  447,  125, 1396,  449,
-      523,  523,  456,  449,  427,  424,  427,  427,  427,  427,
-      427,  427,  427,  427, 1780, 1780, 1386,  514,  450,  879,
-     1381,  427,  450,  879,  879,  125,  125,  126,  126,  126,
-      126,  126,  126,  126,  424,  879,  126,  126,  126,  126,
-      444,  126,  444,  444,  444,  444,  444,  444,  444,  444,
-      427,  458,  451,  126,  126,  451,  459,  458, 1380,  126,
-      460,  462,  465,  466,  459,  444,  462,  468,  469,  465,
-      466,  470,  460,  468,  470,  469,  520,  472,  520,  474,
-      458,  451,  472,  474,  451,  459,  458,  126, 1369,  460,
-
-      462,  465,  466,  459,  444,  462,  468,  469,  465,  466,
-      470,  460,  468,  470,  469,  520,  472,  520,  474, 1967,
-     1967,  472,  474,  471, 1361,  126,  126,  127,  127,  127,
-      127,  127,  127,  127,  471,  473,  127,  127,  127,  127,
-      475,  127,  478, 1360,  477,  479,  473,  482,  475,  478,
-     1826,  479,  471,  127,  127,  480,  564,  482, 1826,  127,
-      477,  481,  486,  471,  473,  485,  480,  486,  481,  475,
-      488,  478,  485,  488,  479,  473,  482,  475,  478,  477,
-      479, 1829, 1707, 1165,  480,  564,  482,  127, 2156, 1829,
-      481,  486, 1707, 1149,  485,  480,  486,  481, 1707,  488,
-
-     1147,  485,  488,  487, 2156,  490,  487,  491,  477,  487,
-      491,  490,  489, 2067, 2067,  127,  127,  128,  128,  128,
-      128,  128,  128,  128,  489, 1135,  128,  128,  128,  128,
-      492,  128,  487,  128,  490,  487,  491,  494,  487,  491,
-      490,  489,  496,  128,  128,  494,  492,  499, 1134,  128,
-      495,  498,  496,  489,  498,  500,  495,  501,  504,  499,
-      500,  501,  495,  503,  505,  492,  494,  503,  505,  504,
-      510,  496,  570,  510,  494,  509,  499,  128, 1133,  495,
-      498,  496,  509,  498,  500,  495,  501,  504,  499,  500,
-      501,  495,  503,  505,  492, 1850,  503,  505,  504,  510,
-
-      910,  570,  510,  908,  509,  128,  128,  141,  141,  898,
-     1850,  509,  895,  141, 1850,  141,  141,  141,  141,  141,
-      141,  141,  141,  141,  141,  141,  141,  887,  141,  141,
-      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
-      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
-      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
-      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
-      141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
-      141,  141,  141,  141,  141,  141,  141,  141,  144,  507,
-      144,  144,  144,  144,  144,  144,  144,  144,  144,  521,
-
-      528,  521,  528,  507,  886,  144,  144,  144,  144,  144,
-      144,  645,  645,  645,  645,  645,  645,  655,  507, 1989,
-      502,  508,  502,  568,  568,  508,  641, 1989,  521,  528,
-      521,  528,  507,  502,  144,  144,  144,  144,  144,  144,
-      149,  149,  149,  149,  149,  149,  149,  149,  149,  502,
-      508,  502,  568,  568,  508,  506,  149,  149,  149,  149,
-      149,  149,  502,  506,  907,  907,  907,  907,  907,  907,
-      640,  513,  511, 1994,  515, 1996,  511,  966,  515,  966,
-      966, 1994,  966, 1996,  506,  149,  149,  149,  149,  149,
-      149,  177,  506,  177,  177,  177,  177,  177,  177,  177,
-
-      177,  511,  512,  515,  513,  511,  516,  515,  513,  518,
-      517,  522,  177,  512,  517,  530,  527,  524,  518,  527,
-      524,  522,  516,  524,  525,  524,  530,  177, 2078, 2078,
-      525,  512,  177,  513,  525,  516,  625,  513,  518,  517,
-      522,  177,  512,  517,  530,  527,  524,  518,  527,  524,
-      522,  516,  524,  525,  524,  530,  177,  529,  526,  525,
-      544,  177,  254,  525,  254,  254,  526,  529,  254,  535,
-      538,  254,  544,  535,  254, 2138,  538,  254,  254,  581,
-      254,  254, 1125, 2138, 1125, 1125,  529,  526,  623,  544,
-      616,  254,  615,  254,  254,  526,  529,  254,  535,  538,
-
-      254,  544,  535,  254,  531,  538,  254,  254,  581,  254,
-      254,  320,  320,  320,  320,  531,  320,  320,  320,  320,
-      320,  320,  320,  320,  320,  320,  532,  320,  320,  555,
-      613,  532,  533,  531,  533,  536,  549,  320,  320,  320,
-      320,  320,  320,  607,  531,  533,  536,  537,  549,  541,
-      543,  555,  537,  541,  543,  532,  545,  543,  606,  546,
-      532,  533,  545,  533,  536,  549,  551,  545,  546,  551,
-      320,  320,  320, 2161,  533,  536,  537,  549,  541,  543,
-      555,  537,  541,  543,  604,  545,  543,  561,  546, 2161,
-      547,  545,  547,  382,  561,  551,  545,  546,  551,  320,
-
-      320,  321,  321,  321,  321,  380,  321,  321,  321,  321,
-      321,  321,  321,  321,  321,  321,  561,  321,  321,  547,
-      548,  547,  553,  561,  556,  548,  584,  321,  321,  321,
-      321,  321,  321,  379,  550,  553,  552,  556,  559,  557,
-      550,  552,  559,  550,  557,  560,  550,  585,  563,  548,
-      567,  553,  563,  556,  548,  584,  560,  567,  589,  590,
-      321,  321,  321,  550,  553,  552,  556,  559,  557,  550,
-      552,  559,  550,  557,  560,  550,  585,  563,  569,  567,
-     1321,  563, 1321, 1321,  569,  560,  567,  589,  590,  321,
-      321,  330,  330,  330,  330,  371,  330,  330,  330,  330,
-
-      566,  330,  330,  330,  330,  330,  330,  569,  330,  566,
-      594,  566,  572,  569,  573,  572,  573,  330,  330,  330,
-      330,  330,  330,  370,  562,  571,  596,  574,  576,  566,
-      562,  575,  571,  576,  562,  575,  364,  574,  566,  594,
-      566,  572,  577,  573,  572,  573,  598,  577,  356,  664,
-      330,  330,  330,  562,  571,  596,  574,  576,  354,  562,
-      575,  571,  576,  562,  575,  565,  574,  342,  565,  337,
-      578,  577,  580,  579,  578,  598,  577,  579,  664,  330,
-      330,  331,  331,  331,  331,  580,  331,  331,  331,  331,
-      335,  331,  331,  331,  331,  331,  331,  565,  331,  578,
-
-      583,  580,  579,  578,  583,  565,  579,  331,  331,  331,
-      331,  331,  331,  325,  580,  582,  586,  665,  565,  587,
-      591,  588,  591,  582,  638,  587,  565,  588,  592,  583,
-      593,  586,  313,  583,  565,  593,  312,  592, 2855,  638,
-      331,  331,  331, 2855,  582,  586,  665,  565,  587,  591,
-      588,  591,  582, 2859,  587,  595,  588,  592, 2859,  593,
-      586,  600,  600,  682,  593,  595,  592,  597,  638,  331,
-      331,  360,  360,  360,  360,  360,  360,  360,  597,  599,
-      360,  360,  360,  360,  595,  360,  608,  608,  601,  599,
-      600,  600,  682,  310,  595,  307,  597,  360,  360,  601,
-
-      610,  610,  305,  360,  294,  610,  661,  597,  599, 1352,
-      608, 1352, 1352,  692,  612,  612,  608,  601,  599,  612,
-      661,  622,  622,  227,  610,  622,  662,  662,  601,  610,
-      610,  360, 2380,  622,  976,  661,  630,  976,  612,  667,
-      667,  631,  692, 2139,  612,  622,  226,  670, 2380,  661,
-      976, 2139,  630,  670,  693,  662,  662,  631,  215,  360,
-      360,  361,  361,  361,  361,  361,  361,  361,  667,  667,
-      361,  361,  361,  361,  630,  361,  670,  624,  624,  631,
-      622,  197,  670,  693,  196,  624, 2485,  361,  361,  624,
-      698,  699, 1040,  361, 1040, 1040,  153, 1040,  684, 2088,
-
-     2088,  624, 2485,  630,  672,  684,  672,  148,  631,  632,
-      632,  632,  632,  632,  632,  632,  632, 2098, 2098,  698,
-      699,  361,  138,  632,  633,  633,  633,  633,  633,  633,
-      633,  633, 2868,  672,  132,  672,  624, 2868,  633,  643,
-      643,  643,  643,  643,  643,  643,  643,  684,  130,  361,
-      361,  362,  362,  362,  362,  362,  362,  362, 2249, 2249,
-      362,  362,  362,  362,  634,  362,  634,  634,  634,  634,
-      634,  634,  634,  634, 2313, 2313,  684,  362,  362,  673,
-      634,  673,  635,  362,  635,  635,  635,  635,  635,  635,
-      635,  635, 1535,  120, 1535, 1535,  107,  636,  635,  636,
-
-      636,  636,  636,  636,  636,  636,  636,  700,  673,  702,
-      673,  362,  637,  636,  637,  637,  637,  637,  637,  637,
-      637,  637,  637,  644,  644,  644,  644,  644,  644,  644,
-      644, 1563,   83, 1563, 1563,  703,  700,  637,  702,  362,
-      362,  363,  363,  363,  363,  363,  363,  363, 2324, 2324,
-      363,  363,  363,  363,  646,  363,  646,  646,  646,  646,
-      646,  646,  646,  646,  703,   81,  637,  363,  363,  706,
-      715,  716,   37,  363,  647,  647,  647,  647,  647,  647,
-      647,  647,  648,  648,  648,  648,  648,  648,  648,  648,
-      650,  650,  650,  650,  650,  650,  650,  650,  706,  715,
-
-      716,  363,  651,  651,  651,  651,  651,  651,  651,  651,
-      652,   25,  652,  652,  652,  652,  652,  652,  652,  652,
-     1128,   21,  724, 1128, 1128, 1128, 2152, 2154, 2869,  363,
-      363,  377,  377, 2869, 2152, 2154, 1128,  377,    0,  377,
-      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
-      377,  724,  377,  377,  377,  377,  377,  377,  377,  377,
-      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
-      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
-      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
-      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
-
-      377,  377,  377,  377,  377,  377,  377,  377,  377,  377,
-      377,  377,  381,  381,  381,  381,  381,  381,  381,  381,
-      381,  659,  663,  671,  728,  659,  663,  671,  381,  381,
-      381,  381,  381,  381,  890,  890,  890,  890,  890,  890,
-      890,  890, 1749,    0, 1749, 1749,  701,  733,  738,  701,
-      659,  663,  671,  728,  659,  663,  671,  381,  381,  381,
-      381,  381,  381,  384,  384,  384,  384,  384,  384,  384,
-      384,  384,  384,  384,  666,  701,  733,  738,  701,  666,
-      384,  384,  384,  384,  384,  384,  882,    0,  882,  882,
-      882,  882,  882,  882,  882,  882,    0, 2266,    0,  739,
-
-      745,  657,  882,  666, 1877, 2266, 1877, 1877,  666,  384,
-      384,  384,  384,  384,  384,  390,  657,  390,  390,  390,
-      390,  390,  390,  390,  390,  390,  657,  660,  739,  745,
-      747,  676,  390,  390,  390,  390,  390,  390,  660,  676,
-      390, 1910,    0, 1910, 1910,  657,  891,  891,  891,  891,
-      891,  891,  891,  891,    0,  657,  660, 2334, 2334,  747,
-      676,  390,  390,  390,  390,  390,  390,  660,  676,  390,
-      609,  609,  609,  609,    0,  609,  609,  609,  609,  609,
-      609,  609,  609,  609,  609,  674,  609,  609,  668,  669,
-      674,  675,  717,    0, 2268,  675,  609,  609,  609,  609,
-
-      609,  609, 2268,  658,  669,  678,  677,  717,  748,  658,
-      678,  677,  668,  669,  674,  677,  658,  679,  668,  674,
-      675,  679,  668,  680,  675,    0,  750,  680,  751,  609,
-      609,  609,  658,  669,  678,  677,  717,  748,  658,  678,
-      677,  668,  669, 2870,  677,  658,  679,  668, 2870,  681,
-      679,  668,  680,  681,  686,  750,  680,  751,  609,  609,
-      614,  614,  614,  614,  686,  614,  614,  614,  614,  683,
-      614,  614,  614,  614,  614,  614,    0,  614,  681,  694,
-      683,  687,  681,  686,  688,  687,  614,  614,  614,  614,
-      614,  614,  614,  686,  694,  688,  689,  690,  683,  691,
-
-      689,  690,  695,  696,  697,  691,  694,  730,  696,  683,
-      687,  697,  704,  688,  687,  704,  730, 2878,  695,  614,
-      614,  614, 2878,  694,  688,  689,  690,    0,  691,  689,
-      690,  695,  696,  697,  691,  694,  730,  696, 2344, 2344,
-      697,  704,  744,  744,  704,  730,  708,  695,  614,  614,
-      642,  642,  642,  642,  642,  642,  642,  642,  642,  642,
-      642,  705,  708,  744,  705,  762,    0,  642,  642,  642,
-      642,  642,  642,    0,  709,  708,  709,  709, 2274,  709,
-     2274, 2274,    0,  712,  707,    0,  712, 2354, 2354,    0,
-      705,  708,  744,  705,  762,  707,  642,  642,  642,  642,
-
-      642,  642,  649,  649,  649,  649,  649,  649,  649,  649,
-      649,  649,  712,  707,  709,  712,  710,  713,  649,  649,
-      649,  649,  649,  649,  707,  711,  709,  710,  718,  714,
-      714,  711,    0,  720,  713,  714,  718,  721,  713,    0,
-      720,  721,  734,  709,  764,  710,  734,  649,  649,  649,
-      649,  649,  649,  685,  711,  709,  710,  718,  714,  714,
-      711,  685,  720,  713,  714,  718,  721,  713,  722,  720,
-      721,  734,  765,  764,  723,  734,  725,  725, 2277,  722,
-      726,  723,  725,  727,  729,    0, 2277,  729,  685,  685,
-      726, 1323,    0, 1323, 1323,  685, 1323,  722,  769,  735,
-
-      685,  765,  685,  723,  685,  725,  725,  735,  722,  726,
-      723,  725,  731,  729,  727,  727,  729,  685,  685,  726,
-      727,  752,  731,  732,  685,  736,    0,  769,  735,  685,
-      727,  685,  742,  685,  736,  732,  735,  737,  741,  742,
-      737,  731,  746,  727,  727,  743,  741,  752,  749,  727,
-      753,  731,  732,  746,  736,  743,  749,  752,  753,  727,
-     2886,  742,  758,  736,  732, 2886,  737,  741,  742,  737,
-      758,  746,  754,  754,  743,  741,  752,  749,  770,  753,
-        0,  757,  746,  755,  743,  749,  752,  753,  757,  755,
-      760,  758,  766,  763,  759,  766,  768,  768,  760,  758,
-
-      761,  754,  754,  759,  763,  767,  761,  770,  773,  771,
-      757,  767,  755,  771,  773,  775,  776,  757,  755,  760,
-      776,  766,  763,  759,  766,  768,  768,  760,  772,  761,
-      774,  772,  759,  763,  767,  761,  777,  773,  771,  774,
-      767,  779,  771,  773,  775,  776,  778,  780,  781,  776,
-      783,  777,  782,  787,  778,  780,  784,  772,  785,  774,
-      772,  782,    0,  784,  786,  777,  785,  788,  774,    0,
-      786,  788,  791,  791,  779,  778,  780,  781,  792,  783,
-      777,  782,  787,  778,  780,  784,  790,  785,  790,  790,
-      782,  790,  784,  786,  789,  785,  788,    0,  789,  786,
-
-      788,  791,  791,  779,  793,  794,  795,  792,  793,  794,
-      796,  797,  789,  796,  799,  800,  802,  798,  801,  798,
-      800,  801,  803,  789,  804,  806,  790,  789,  807,    0,
-      804,  803,  807,  793,  794,  795,  798,  793,  794,  796,
-      797,  789,  796,  799,  800,  802,  805,  801,  808,  800,
-      801,  803,  810,  804,  806,  790,  809,  807,  805,  804,
-      803,  807,  810,  811,  812,  798,  813,  815,  814,  809,
-      812,  813,  817,  811,  808,  805,  814,    0,  816,    0,
-      808,  810,  816,  815,  817,  809,  818,  805,  819, 2415,
-     2415,  810,  811,  812,  818,  813,  815,  814,  809,  812,
-
-      813,  817,  811,  808,  819,  814,  820,  816,  821,  808,
-      820,  816,  815,  817,  821,  818,  822,  819,  824,  823,
-      825,  826,  824,  818,  823,  822,  827,  828,  829,  825,
-      827,  826,  830,  819,  831,  820,  830,  821,  832,  820,
-      835,  837,  831,  821,  835,  822,  837,  824,  823,  825,
-      826,  824,  833,  823,  822,  827,  828,  829,  825,  827,
-      826,  830,  833,  831,  834,  830,  839,  832,  836,  835,
-      837,  831,  846,  835,  834,  837,  836,  838,  839,  841,
-      838,  833,  842,  840,  840,  850,  842, 2887,  851, 2888,
-      841,  833, 2887,  834, 2888,  839,  844,  836,  842,  849,
-
-      844,  846,  845,  834,  840,  836,  845,  839,  841,  849,
-      847,  842,  838,  838,  850,  842,  847,  851,  843,  841,
-      843,  843,  848,  843,  852,  844,  848,  842,  849,  844,
-        0,  845,  855,  840,  857,  845,    0,  854,  849,  847,
-     2279,  838,  838,  854,  853,  847,  843,  854, 2279,    0,
-      858,  848,  853,  852,  855,  848,  856,  859,  843,  856,
-      858,    0,  859,  857,  861,  843,  854,  860,  861,  843,
-      862,  867,  854,  853,  862,  860,  854,  863,  864,  858,
-      864,  853,  863,  855,    0,  856,  859,  843,  856,  858,
-      865,  859,  915,  861,  843,  865,  860,  861,  843,  862,
-
-      867,  918,  866,  862,  860,  866,  863,  864,  869,  864,
-      868,  863,  870,  868,  869,  920,  871,  921,  870,  865,
-      871,  915,    0, 1537,  865, 1537, 1537, 2280, 1537,  913,
-      918,  866,  926,  913,  866, 2280,  924,  869,    0,  868,
-        0,  870,  868,  869,  920,  871,  921,  870,  883,  871,
-      883,  883,  883,  883,  883,  883,  883,  883,  913,    0,
-      924,  926,  913,  884,  883,  884,  884,  884,  884,  884,
-      884,  884,  884,  940, 2393,    0, 2393, 2393,  885,  884,
-      885,  885,  885,  885,  885,  885,  885,  885,  892,  924,
-      892,  892,  892,  892,  892,  892,  892,  892, 2465, 2465,
-
-        0,    0,  940,  885,  897,  897,  897,  897,  897,  897,
-      897,  897,  899,  941,  899,  899,  899,  899,  899,  899,
-      899,  899,  900,    0,  900,  900,  900,  900,  900,  900,
-      900,  900,  885,  888,  888,  888,  888,  888,  888,  888,
-      888,  888,  941,    0,  917,  944,  945,  946,  917,  888,
-      888,  888,  888,  888,  888,  901,    0,  901,  901,  901,
-      901,  901,  901,  901,  901,  903,  903,  903,  903,  903,
-      903,  903,  903,  917,  944,  945,  946,  917,  888,  888,
-      888,  888,  888,  888,  889,  889,  889,  889,  889,  889,
-      889,  889,  889,  889,  912,  927,  948,  949,  927,  912,
-
-      889,  889,  889,  889,  889,  889,  905,  905,  905,  905,
-      905,  905,  905,  905,  906,  906,  906,  906,  906,  906,
-      906,  906,    0,  912,  927,  948,  949,  927,  912,  889,
-      889,  889,  889,  889,  889,  902,  902,  902,  902,  902,
-      902,  902,  902,  902,  902,  922,  937,  952,  953,  937,
-      922,  902,  902,  902,  902,  902,  902, 1129, 1129, 1129,
-     1129, 1129, 1129, 1129, 1129, 2389,    0, 2889,  957,  963,
-        0, 1129, 2889, 2389,  922,  937,  952,  953,  937,  922,
-      902,  902,  902,  902,  902,  902,  904,  904,  904,  904,
-      904,  904,  904,  904,  904,  904,  904,  957,  963,  911,
-
-      914,  916,  923,  904,  904,  904,  904,  904,  904,  911,
-      914,  916,  919,  925,  923,  928,    0,  929,  931,  919,
-      928,  929,  930,    0,  925,  930,    0,  931,  911,  914,
-      916,  923,  904,  904,  904,  904,  904,  904,  911,  914,
-      916,  919,  925,  923,  928,  932,  929,  931,  919,  928,
-      929,  933,  935,  925,  932,  934,  931,  936,    0,  938,
-      965,  939,  930,  935,  933,  938,  939,  934,  936,  954,
-      950,  951,  930,  971,  932,    0,  951,  947,  950,  954,
-      933,  935,  947,  932,  934,    0,  936,  947,  938,  965,
-      939,  930,  935,  933,  938,  939,  934,  936,  954,  950,
-
-      951,  930,  971,    0,  955,  951,  947,  950,  954,  955,
-      956,  947,  958,  956,  961,  959,  947,  958,  959,  960,
-      961,  962,  964,  960,  968,  962,  969,  972,    0,  970,
-      964,  984,  973,  955,  972,  968,  969,  973,  955,  956,
-      970,  958,  956,  961,  959,    0,  958,  959,  960,  961,
-      962,  964,  960,  968,  962,  969,  972,  978,  970,  964,
-      984,  973,  974,  972,  968,  969,  973,  975,  974,  970,
-      977,  975,  977,  978,  979,  980,  982,  979,  981,  980,
-      982,  981,  983,  985,  987,  988,  978,  986,  989,    0,
-      983,  974,  989,  986,  990,  991,  975,  974,  990,  977,
-
-      975,  977,  978,  979,  980,  982,  979,  996,  980,  982,
-      992,  983,  985,  987,  988,  992,  986,  989,  981,  983,
-      993,  989,  986,  990,  991,  995,  994,  990,  995,  997,
-      993,  994,  997, 1000,  998,  999,  996, 1001, 1002,  992,
-     1003,    0, 1004,    0,  992, 1004,  999,  981, 1002,  993,
-      998, 1009, 1005, 1003,  995,  994, 1005,  995,  997,  993,
-      994,  997, 1000,  998,  999,    0, 1001, 1002, 1006, 1003,
-     1008, 1004, 1007, 1008, 1004,  999, 1007, 1002, 1010,  998,
-     1009, 1005, 1003, 1012, 1006, 1005, 1016, 1010, 1011, 1012,
-     1006, 1014, 1013, 1014, 1017, 1015, 1016, 1019, 1017, 1008,
-
-     1015, 1007, 1008, 1018, 1011, 1007, 1020, 1010, 1013,    0,
-     1022, 1020, 1012, 1019, 1018, 1016, 1010, 1011, 1012, 1006,
-     1014, 1013, 1014, 1017, 1015, 1016, 1019, 1017, 1021, 1015,
-     1025, 1023, 1018, 1011, 1027, 1020, 1024, 1013, 1021, 1022,
-     1020, 1023, 1019, 1018, 1026, 1024, 1028, 1029, 1031, 1030,
-     1032, 1033,    0, 1026,    0, 1028, 1032, 1021, 1046, 1025,
-     1023, 1030, 1033, 1027, 1034, 1024, 1035, 1021, 1046, 1034,
-     1023, 1035, 1036, 1026, 1024, 1028, 1029, 1031, 1030, 1032,
-     1033, 1037, 1026, 1036, 1028, 1032, 1037, 1046, 1039, 1038,
-     1030, 1033, 1044, 1034, 1039, 1035, 1042, 1046, 1034, 1047,
-
-     1035, 1036, 1038, 1043, 1042, 1049, 1043, 1050, 1044, 1045,
-     1037, 1052, 1036, 1048, 1045, 1037, 1048, 1039, 1038, 1055,
-     1054, 1044, 1053, 1039, 1056, 1042, 1054, 1051, 1047, 1055,
-     1053, 1038, 1043, 1042, 1049, 1043, 1050, 1044, 1045, 1051,
-     1052, 1057, 1048, 1045, 1060, 1048, 1059, 1058, 1055, 1054,
-     1059, 1053, 1058, 1056, 1061, 1054, 1051, 1057, 1055, 1053,
-     1062, 1063, 1065, 1064,    0, 1061, 1063, 1066, 1051, 1067,
-     1069, 1062, 1057, 1060, 1064, 1059, 1058, 1066, 1067, 1059,
-     1071, 1058, 1073, 1061, 1068, 1075, 1070, 1073, 1065, 1062,
-     1063, 1065, 1064, 1068, 1061, 1063, 1066, 1072, 1067, 1069,
-
-     1062, 1057, 1070, 1064, 1076, 1072, 1066, 1067, 1074, 1071,
-     1077, 1073, 1078, 1068, 1075, 1070, 1073, 1065, 1078, 1074,
-     1065, 1079, 1068, 1081, 1080, 1077, 1072, 1082, 1083, 1085,
-     1084, 1070, 1086, 1076, 1072, 1080, 1087, 1074, 1088, 1077,
-     1084, 1078, 1089, 1090, 1098,    0, 2893, 1078, 1074, 1088,
-     1079, 2893, 1081, 1080, 1077,    0, 1082, 1083, 1085, 1084,
-     1092, 1086,    0, 1092, 1080, 1087, 1097, 1088,    0, 1084,
-     1093, 1089, 1090, 1098, 1091, 1097, 1091, 1091, 1088, 1091,
-     1093, 2898, 1094, 1102, 1094, 1094, 2898, 1094, 1096, 1092,
-     1096, 1096, 1092, 1100, 1102, 1097,    0, 1100,    0, 1093,
-
-     2899, 1099, 1091, 1096, 1097, 2899, 1101, 1099, 1101, 1093,
-     1094,    0, 1102, 1103, 1091, 1104, 1103, 1091, 1110, 1096,
-     1104, 1091, 1100, 1102, 1110, 1091, 1100, 1105, 1106, 1094,
-     1099, 1111, 1105, 2900, 1109, 1101, 1099, 1101, 2900, 1114,
-     1106, 1107, 1103, 1091, 1104, 1103, 1091, 1110,    0, 1104,
-     1091, 1115, 1107, 1110, 1091,    0, 1105, 1106, 1094, 1115,
-     1111, 1105, 1108, 1108, 1108, 1109, 1116, 1112, 1114, 1106,
-     1107, 1109, 1112, 1113, 1117, 1109, 1118, 1113, 1120, 1119,
-     1115, 1107, 1122, 1121, 1108, 1119, 1123, 1122, 1115, 1121,
-     1124, 1167, 1118, 1168, 1109, 1116, 1112, 1172, 1123,    0,
-
-     1109, 1112, 1113, 1117, 1109, 1118, 1113, 1120, 1119, 1175,
-     1177, 1122, 1121, 1108, 1119, 1123, 1122,    0, 1121, 1124,
-     1167, 1118, 1168, 1172, 1179, 1186, 1130, 1123, 1130, 1130,
-     1130, 1130, 1130, 1130, 1130, 1130,    0,    0, 1175, 1177,
-        0, 1131, 1130, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
-     1131,    0, 1172, 1179, 1186,    0, 1132, 1131, 1132, 1132,
-     1132, 1132, 1132, 1132, 1137, 1137, 1137, 1137, 1137, 1137,
-     1137, 1137, 1132, 1136, 1136, 1136, 1136, 1136, 1136, 1136,
-     1136, 1136, 1136, 1136, 1139, 1139, 1139, 1139, 1139, 1139,
-     1136, 1136, 1136, 1136, 1136, 1136, 1138, 1138, 1138, 1138,
-
-     1138, 1138, 1138, 1138, 1140,    0, 1140, 1140, 1140, 1140,
-     1140, 1140, 1140, 1140,    0,    0,    0,    0,    0, 1136,
-     1136, 1136, 1136, 1136, 1136, 1141, 1141, 1141, 1141, 1141,
-     1141, 1141, 1141, 1141, 1141, 1146, 1146, 1146, 1146, 1146,
-     1146, 1141, 1141, 1141, 1141, 1141, 1141, 1142, 1142, 1142,
-     1142, 1142, 1142, 1142, 1142, 1144, 1144, 1144, 1144, 1144,
-     1144, 1144, 1144, 1395, 1395, 1395, 1395, 1395, 1395,    0,
-     1141, 1141, 1141, 1141, 1141, 1141, 1143, 1143, 1143, 1143,
-     1143, 1143, 1143, 1143, 1143, 1143, 1143, 1171, 1184, 1190,
-     1193, 1171, 1184, 1143, 1143, 1143, 1143, 1143, 1143, 1145,
-
-     1145, 1145, 1145, 1145, 1145, 1145, 1145, 1151, 1151, 1151,
-     1151, 1151, 1151, 1151, 1151,    0, 1171, 1184, 1190, 1193,
-     1171, 1184, 1143, 1143, 1143, 1143, 1143, 1143, 1152,    0,
-     1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1153,    0,
-     1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154,    0,
-     1154, 1154, 1154, 1154, 1154, 1154, 1155, 1155, 1155, 1155,
-     1155, 1155, 1155, 1155, 1155, 1155, 1156, 1156, 1156, 1156,
-     1156, 1156, 1156, 1156, 1156, 1156, 1157, 1157, 1157, 1157,
-     1157, 1157, 1157, 1157, 1157, 1157, 1158, 1158, 1158, 1158,
-     1158, 1158, 1158, 1158, 1159, 1159, 1159, 1159, 1159, 1159,
-
-     1159, 1159, 1159, 1159, 1188, 1194, 1195, 1196, 1188, 1166,
-     1159, 1159, 1159, 1159, 1159, 1159, 1160, 1160, 1160, 1160,
-     1160, 1160, 1160, 1160, 1161, 1161, 1161, 1161, 1161, 1161,
-     1161, 1161,    0, 1188, 1194, 1195, 1196, 1188,    0, 1159,
-     1159, 1159, 1159, 1159, 1159, 1162, 1166, 1162, 1162, 1162,
-     1162, 1162, 1162, 1162, 1162, 1169, 1173, 1170, 1180, 1176,
-     1174, 1178, 1197, 1185,    0, 1183, 1169, 1170, 1173, 1174,
-     1176, 1181, 1178, 1185, 1199, 1166, 1180, 1183, 2813, 2813,
-     1187, 1198, 1199, 2813, 1169, 1173, 1170, 1187, 1176, 1174,
-     1178, 1197, 1185, 1189, 1183, 1169, 1170, 1173, 1174, 1176,
-
-     1189, 1178, 1185, 1181, 1191, 1180, 1183, 1192, 1181, 1187,
-     1198, 1202, 1200, 1202, 1203, 1191, 1187, 1204, 1192, 1205,
-     1200, 1199, 1189, 1201, 1206, 1203, 1211, 1209,    0, 1189,
-        0, 1201, 1181, 1191,    0, 1206, 1192, 1181, 1182, 1214,
-     1202, 1182, 1202, 1203, 1191, 1200, 1204, 1192, 1205, 1210,
-     1199, 1208, 1218, 1206, 1203, 1208, 1209, 1210, 1200, 1207,
-     1201, 1213, 1207, 1211, 1206, 1213, 1229, 1212, 1214, 1215,
-        0, 1216,    0, 1182, 1200, 1182, 1215, 1182, 1210, 1212,
-     1208, 1218, 1216, 1182, 1208, 1182, 1210, 1200, 1182, 1201,
-     1213,    0, 1211, 1217, 1213, 1229, 1212, 1220, 1215, 1207,
-
-     1216, 1217, 1182, 1222, 1182, 1215, 1182, 1220, 1212, 1207,
-     1219, 1216, 1182, 1222, 1182, 1219, 1223, 1182, 1230, 1224,
-     1225, 1231, 1217, 1230, 1232, 1227, 1220, 1223, 1207, 1225,
-     1217, 1224, 1222, 1227, 1234, 1236, 1220, 1228, 1207, 1219,
-     1235, 1228, 1222, 1236, 1219, 1223, 1235, 1230, 1224, 1225,
-     1231, 1233, 1230, 1232, 1227, 1233, 1223, 1238, 1225, 1240,
-     1224, 1241, 1227, 1234, 1236, 1239, 1228, 1240, 1237, 1235,
-     1228, 1244, 1236, 1237, 1243, 1235, 1239, 1242, 1243, 1242,
-     1233, 1247, 1245, 1246, 1233,    0, 1238, 1249, 1240, 1252,
-     1241,    0, 1246, 1254, 1239, 1257, 1240, 1237, 1245, 1248,
-
-     1244, 1249, 1237, 1243, 1248, 1239, 1242, 1243, 1242, 1250,
-     1247, 1261, 1246, 1245, 1251, 1251, 1249, 1256, 1252, 1253,
-     1250, 1246, 1254, 1253, 1257, 1255, 1258, 1256, 1248, 1255,
-     1249, 1259, 1258, 1248, 1260, 1262, 1267,    0, 1250,    0,
-     1261, 1260, 1245, 1251, 1251, 1263, 1256, 1263, 1253, 1250,
-     1265, 1264, 1253, 1270, 1255, 1258, 1256, 1272, 1255, 1268,
-     1265, 1258, 1264, 1260, 1262, 1267, 1266, 1268, 1259, 1269,
-     1260, 1271, 1274,    0, 1263, 1269, 1263, 1266, 1273, 1265,
-     1264, 1271, 1270,    0, 1276, 1277, 1272, 1279, 1268, 1265,
-     1275, 1264,    0, 1276, 1275, 1266, 1268, 1259, 1269, 1278,
-
-     1271, 1274, 1273, 1278, 1269, 1281, 1266, 1280, 1273, 1287,
-     1271, 1284, 1273, 1276, 1277, 1281, 1279, 1282, 1280, 1275,
-     1283, 1282, 1276, 1275, 1283, 1285, 1284, 1286, 1278, 1285,
-     1292, 1273, 1278, 1286, 1281, 1288, 1280, 1273, 1287, 1289,
-     1284, 1273, 1289, 1290, 1281, 1294, 1282, 1280, 1296, 1283,
-     1282, 1288, 1290, 1283, 1285, 1284, 1286, 1291, 1285, 1292,
-     1293, 1291, 1286, 1295, 1293, 1288, 1300, 1297, 1289, 1298,
-        0, 1289, 1290, 1299, 1294, 1298, 1301, 1296, 1297, 1295,
-     1303, 1290, 1302, 1305, 1299, 1305, 1291, 1301, 1308, 1293,
-     1291, 1309, 1302, 1293, 1288, 1300, 1297, 1304, 1298, 1295,
-
-     1308, 1309, 1299, 1306, 1298, 1301, 1310, 1297, 1304, 1303,
-     1306, 1302, 1305, 1299, 1305, 1307, 1301, 1308, 1311, 1307,
-     1309, 1302,    0,    0, 1316, 1312, 1304, 1317, 1295, 1308,
-     1309, 1312, 1306, 1318, 1319, 1310, 1317, 1304, 1313, 1306,
-     1313, 1313, 1320, 1313, 1307, 1322, 1325, 1311, 1307, 1315,
-     1325, 1315, 1315, 1316, 1312, 1324, 1317, 1326, 1328, 1329,
-     1312, 1324, 1318, 1319, 1315, 1317, 1313, 1327, 1326, 1330,
-     1331, 1320, 1327, 1332, 1322, 1325, 1335, 1336, 1331, 1325,
-     1315, 1333, 1337, 1332, 1324, 1313, 1326, 1328, 1329, 1344,
-     1324,    0, 1333, 1339, 1338, 1334, 1327, 1326, 1330, 1331,
-
-     1339, 1327, 1332, 1334, 1338, 1335, 1336, 1331, 1346, 1340,
-     1333, 1337, 1332, 1340, 1313, 1342, 1343, 1350, 1344, 1341,
-     1343, 1333, 1339, 1338, 1334, 1341, 1342, 1345, 1399, 1339,
-     1347, 1345, 1334, 1338, 1401, 1347, 1348, 1346, 1340, 1349,
-     1348, 1349, 1340, 2396, 1342, 1343, 1350, 1351, 1341, 1343,
-        0, 2396,    0,    0, 1341, 1342, 1345, 1399, 1351, 1347,
-     1345, 1405, 1406, 1401, 1347, 1348, 2833, 2833, 1349, 1348,
-     1349, 2833, 1403, 1400, 1410, 1411, 1351, 1356, 1356, 1356,
-     1356, 1356, 1356, 1356, 1356, 1356,    0, 1351, 1403, 1400,
-     1405, 1406, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357,
-
-     1357, 1357, 1400, 1410, 1411, 1412, 1414, 1403, 1357, 1358,
-     1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1400,    0,
-        0,    0,    0,    0, 1358, 1359, 1359, 1359, 1359, 1359,
-     1359, 1359, 1359, 1359, 1412, 1414, 1403,    0,    0,    0,
-     1359, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362,
-     1402, 1407, 1413, 1402, 1407, 1415, 1413, 1362, 1362, 1362,
-     1362, 1362, 1362, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
-     1364, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1402,
-     1407, 1413, 1402, 1407, 1415, 1413, 1362, 1362, 1362, 1362,
-     1362, 1362, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363,
-
-     1363, 1363,    0,    0,    0, 1416, 1417, 1418, 1363, 1363,
-     1363, 1363, 1363, 1363, 1366,    0, 1366, 1366, 1366, 1366,
-     1366, 1366, 1366, 1366, 1371, 1371, 1371, 1371, 1371, 1371,
-     1371, 1371, 1371, 1371, 1416, 1417, 1418, 1363, 1363, 1363,
-     1363, 1363, 1363, 1372, 1372, 1372, 1372, 1372, 1372, 1372,
-     1372, 1372, 1372, 1373, 1373, 1373, 1373, 1373, 1373, 1373,
-     1373, 1373, 1373, 1374, 1374, 1374, 1374, 1374, 1374, 1374,
-     1374, 1374, 1374, 1419, 1421, 1422, 1426, 1419, 1422, 1374,
-     1374, 1374, 1374, 1374, 1374, 1375, 1375, 1375, 1375, 1375,
-     1375, 1375, 1375, 1376, 1376, 1376, 1376, 1376, 1376, 1376,
-
-     1376,    0, 1419, 1421, 1422, 1426, 1419, 1422, 1374, 1374,
-     1374, 1374, 1374, 1374, 1377,    0, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1382,    0, 1382, 1382, 1382, 1382,
-     1382, 1382, 1382, 1382, 1383,    0, 1383, 1383, 1383, 1383,
-     1383, 1383, 1383, 1383, 1384,    0, 1384, 1384, 1384, 1384,
-     1384, 1384, 1384, 1384, 1385, 1385, 1385, 1385, 1385, 1385,
-     1385, 1385, 1387,    0, 1387, 1387, 1387, 1387, 1387, 1387,
-     1387, 1387, 1388,    0, 1388, 1388, 1388, 1388, 1388, 1388,
-     1388, 1388, 1389,    0, 1389, 1389, 1389, 1389, 1389, 1389,
-     1389, 1389, 1390, 1390, 1390, 1390, 1390, 1390, 1390, 1390,
-
-     1390, 1390, 1420, 1427, 1428, 1429, 1430, 1420, 1390, 1390,
-     1390, 1390, 1390, 1390, 1391, 1391, 1391, 1391, 1391, 1391,
-     1391, 1391, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393,
-        0, 1420, 1427, 1428, 1429, 1430, 1420, 1390, 1390, 1390,
-     1390, 1390, 1390, 1392, 1392, 1392, 1392, 1392, 1392, 1392,
-     1392, 1392, 1392, 1392, 1424, 1431,    0, 1432, 1424, 1408,
-     1392, 1392, 1392, 1392, 1392, 1392, 1394, 1394, 1394, 1394,
-     1394, 1394, 1394, 1394, 1404, 1408, 1409, 1425, 1433,    0,
-     1423, 1425, 1409, 1424, 1431, 1404, 1432, 1424, 1408, 1392,
-     1392, 1392, 1392, 1392, 1392, 1423, 1439, 1443, 1444, 1445,
-
-     1436, 1446, 1444, 1404, 1408, 1409, 1425, 1433, 1436, 1423,
-     1425, 1409, 1447, 1448, 1404, 1447, 1448, 1449, 1451, 1452,
-     1449, 1450,    0, 1451, 1423, 1439, 1443, 1444, 1445, 2476,
-     1446, 1444, 1450, 1455, 1453, 1456, 1460, 2476, 1453, 1454,
-     1459, 1454, 1454, 1463, 1454, 1455, 1459, 1451, 1436, 1457,
-     1450, 1456, 1451, 1448, 1457, 1466, 1461, 1449, 1447, 1458,
-     1461, 1450, 1455, 1453, 1456, 1460, 1452, 1453, 1462, 1459,
-     1458, 1462, 1463,    0, 1455, 1459, 1464, 1436, 1457, 1454,
-     1456, 1464, 1448, 1457, 1466, 1461, 1449, 1447, 1458, 1461,
-     1465, 1467, 1468, 1471, 1465, 1452, 1472, 1462, 1470, 1458,
-
-     1462, 1474, 1467, 1469, 1470, 1464, 1475, 1469, 1454, 1472,
-     1464, 1473, 1474, 1475, 1484, 1473, 1476, 1477, 1478, 1465,
-     1467, 1468, 1471, 1465, 1479, 1472,    0, 1470, 1477, 1484,
-     1474, 1467, 1469, 1470, 1478, 1482, 1469, 1479, 1472, 1482,
-     1473, 1474, 1481, 1475, 1473, 1476, 1477, 1480, 1485, 1480,
-     1481, 1483, 1478, 1479, 1485, 1483, 1486, 1477, 1484, 1487,
-     1488, 1489, 1490, 1491, 1482, 1493, 1479, 1487, 1482, 1494,
-     1498, 1481, 1475, 1490,    0, 1492, 1480, 1485, 1480, 1481,
-     1483, 1478, 1496, 1485, 1483, 1486, 1492, 1503, 1487, 1488,
-     1489, 1490, 1491, 1496, 1493, 1497, 1487, 1495, 1494, 1498,
-
-     1495, 1497, 1490, 1499, 1492, 1500, 1501, 1502, 1504,    0,
-     1500, 1496, 1505, 1504, 1506, 1492, 1503, 1505, 1501, 1499,
-     1507, 1508, 1496, 1509, 1497, 1510, 1495, 1511, 1515, 1495,
-     1497, 1502, 1510, 1513, 1500, 1501, 1513, 1504, 1499, 1500,
-     1524, 1505, 1504, 1506, 1515, 1512, 1505, 1501, 1514, 1507,
-     1508, 1512, 1509, 1511, 1510, 1512, 1512, 1515,    0, 1516,
-     1502, 1510, 1513, 1516, 1514, 1513, 1517, 1499, 1518, 1524,
-     1519, 1525,    0, 1515, 1512, 1517, 1514, 1518, 1521, 1520,
-     1512, 1521, 1511, 1520, 1512, 1512, 1519, 1522, 1516, 1527,
-        0, 1522, 1516,    0, 1527, 1517, 1529, 1518, 1526, 1528,
-
-     1525, 1519, 1530, 1528, 1517, 1514, 1518, 1521, 1520, 1531,
-     1521, 1530, 1520, 1532, 1526,    0, 1522, 1531, 1527, 1523,
-     1522, 1523, 1523, 1527, 1523, 1533, 1534, 1526, 1528, 1536,
-     1519, 1530, 1528, 1529, 1542, 1538, 2834, 2834, 1531, 1538,
-     1530, 2834, 1532, 1526, 1529, 1539, 1531, 1523, 1540, 1548,
-     1541, 1539, 1540, 1541, 1533, 1534, 1544, 1545, 1536, 1523,
-     1544, 1549, 1529, 1542, 1538, 1543, 1523, 1543, 1538, 1523,
-     1523, 1546, 1545, 1529, 1539, 1546, 1551, 1540, 1548, 1541,
-     1539, 1540, 1541, 1547, 1552, 1544, 1547, 1550, 1523, 1544,
-     1549, 1550, 1559, 1560, 1543, 1523, 1543, 1553, 1523, 1523,
-
-     1546, 1545, 1554, 1558, 1546, 1551, 1554, 1558, 1555, 1553,
-     1555, 1556, 1547, 1552, 1557, 1547, 1550, 1556, 1562, 1557,
-     1550, 1559, 1560, 1561, 1615, 1621, 1553, 1561, 2760, 2760,
-     2760, 1554, 1558,    0, 2760, 1554, 1558, 1555, 1553, 1555,
-     1556,    0,    0, 1557, 2841, 2841, 1556, 1562, 1557, 2841,
-     2842, 2842, 1561, 1615, 1621, 2842, 1561, 1564, 1564, 1564,
-     1564, 1564, 1564, 1564, 1564, 1576, 1576, 1576, 1576, 1576,
-     1576, 1564, 1565, 1565, 1565, 1565, 1565, 1565, 1565, 1565,
-     1583, 1583, 1583, 1583, 1583, 1583, 1565, 1566, 1566, 1566,
-     1566, 1566, 1566, 1566, 1566, 1566, 1592, 1592, 1592, 1592,
-
-     1592, 1592, 1566, 1567, 1567, 1567, 1567, 1567, 1567, 1567,
-     1567, 1567,    0,    0,    0,    0, 1619, 1619, 1567, 1568,
-     1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1618,    0,
-        0,    0,    0,    0, 1568, 1569, 1569, 1569, 1569, 1569,
-     1569, 1569, 1569, 1569, 1618, 1619, 1619,    0,    0,    0,
-     1569, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573,
-     1573, 1573, 1620, 1623, 1618, 1620, 1624, 1625, 1573, 1573,
-     1573, 1573, 1573, 1573, 1574, 1574, 1574, 1574, 1574, 1574,
-     1574, 1574, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575,
-        0, 1620, 1623, 1618, 1620, 1624, 1625, 1573, 1573, 1573,
-
-     1573, 1573, 1573, 1577,    0, 1577, 1577, 1577, 1577, 1577,
-     1577, 1577, 1577, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
-     1578, 1578, 1578, 1622, 1627, 1628, 1629, 1630, 1622, 1578,
-     1578, 1578, 1578, 1578, 1578, 1579, 1579, 1579, 1579, 1579,
-     1579, 1579, 1579, 1581, 1581, 1581, 1581, 1581, 1581, 1581,
-     1581, 1631, 1622, 1627, 1628, 1629, 1630, 1622, 1578, 1578,
-     1578, 1578, 1578, 1578, 1580, 1580, 1580, 1580, 1580, 1580,
-     1580, 1580, 1580, 1580, 1580, 1632, 1633, 1638, 1639, 1633,
-     1631, 1580, 1580, 1580, 1580, 1580, 1580, 1582, 1582, 1582,
-     1582, 1582, 1582, 1582, 1582, 1588, 1588, 1588, 1588, 1588,
-
-     1588, 1588, 1588,    0, 1632, 1633, 1638, 1639, 1633,    0,
-     1580, 1580, 1580, 1580, 1580, 1580, 1587, 1587, 1587, 1587,
-     1587, 1587, 1587, 1587, 1587, 1587, 1636, 1640, 1642, 1636,
-     1643, 1644, 1587, 1587, 1587, 1587, 1587, 1587, 1590, 1590,
-     1590, 1590, 1590, 1590, 1590, 1590, 1591, 1591, 1591, 1591,
-     1591, 1591, 1591, 1591, 1649, 1636, 1640, 1642, 1636, 1643,
-     1644, 1587, 1587, 1587, 1587, 1587, 1587, 1589, 1589, 1589,
-     1589, 1589, 1589, 1589, 1589, 1589, 1589, 1589,    0, 1651,
-     1652, 1652, 1653, 1649, 1589, 1589, 1589, 1589, 1589, 1589,
-     1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1597,    0,
-
-     1597, 1597, 1597, 1597, 1597, 1597, 1597, 1597, 1651, 1652,
-     1652, 1653,    0, 1589, 1589, 1589, 1589, 1589, 1589, 1598,
-        0, 1598, 1598, 1598, 1598, 1598, 1598, 1598, 1598, 1599,
-        0, 1599, 1599, 1599, 1599, 1599, 1599, 1600, 1600, 1600,
-     1600, 1600, 1600, 1600, 1600, 1601,    0, 1601, 1601, 1601,
-     1601, 1601, 1601, 1601, 1601, 1602,    0, 1602, 1602, 1602,
-     1602, 1602, 1602, 1602, 1602, 1603,    0, 1603, 1603, 1603,
-     1603, 1603, 1603, 1604, 1604, 1604, 1604, 1604, 1604, 1604,
-     1604, 1604, 1604, 1605, 1605, 1605, 1605, 1605, 1605, 1605,
-     1605, 1605, 1605, 1606, 1606, 1606, 1606, 1606, 1606, 1606,
-
-     1606, 1606, 1606, 1607, 1607, 1607, 1607, 1607, 1607, 1607,
-     1607, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608,
-     1608, 1648,    0, 1655, 1656,    0, 1648, 1608, 1608, 1608,
-     1608, 1608, 1608, 1609, 1609, 1609, 1609, 1609, 1609, 1609,
-     1609, 1610, 1610, 1610, 1610, 1610, 1610, 1610, 1610,    0,
-     1648, 1650, 1655, 1656, 1650, 1648, 1608, 1608, 1608, 1608,
-     1608, 1608, 1611, 1657, 1611, 1611, 1611, 1611, 1611, 1611,
-     1611, 1611, 1616, 1616, 1634, 1637,    0, 1626, 1616, 1635,
-     1616, 1616, 1616, 1626, 1637, 1654, 1635,    0, 1634, 1658,
-     1658, 1616, 1657, 1616, 1616, 1616, 1616, 1616, 1647,    0,
-
-     1654, 1650, 2901, 1634, 1637, 1647, 1626, 2901, 1635, 1663,
-     1661, 1664, 1626, 1637, 1654, 1635, 1661, 1634, 1658, 1658,
-     1660,    0,    0, 1669, 1616, 1616, 1616, 1617, 1617, 1654,
-     1650, 1659, 1647, 1617,    0, 1617, 1617, 1617, 1663, 1661,
-     1664, 1660, 1666, 1659, 1669, 1661, 1617, 1647, 1617, 1617,
-     1617, 1617, 1617, 1673, 1660, 1662, 1662, 1669, 1617, 1674,
-     1659, 1647, 1665, 1665, 1667, 1667, 1668, 1668, 1670, 1670,
-     1660, 1666, 1659, 1669, 1676, 1674, 1647, 1675, 1675, 1617,
-     1617, 1617, 1673, 1660, 1662, 1662, 1669, 1617, 1674, 1677,
-     1678, 1665, 1665, 1667, 1667, 1668, 1668, 1670, 1670, 1679,
-
-     1681, 1677, 1682, 1676, 1683, 1684, 1675, 1675, 1684, 1681,
-     1685, 1678, 1686, 1687, 1688, 1691, 1682, 1674, 1677, 1689,
-     1693, 1692, 1694, 1685, 1678,    0,    0, 1689, 1679, 1681,
-     1677, 1682, 1699, 1683, 1684, 1692, 1701, 1684, 1681, 1685,
-     1678, 1686, 1687, 1688, 1691, 1682, 1695, 1697, 1689, 1693,
-     1692, 1694, 1685, 1678, 1698, 1695, 1689, 1696, 1696, 1700,
-     1702, 1699, 1700, 1697, 1692, 1701, 1703, 1705, 1704, 1698,
-     1704, 1706,    0, 1710, 1708, 1695, 1702, 1708, 1709, 1697,
-     2902, 1709,    0, 1698, 1695, 2902, 1696, 1696, 1700, 1715,
-     1713, 1700, 1713, 1713, 1718, 1703, 1705, 1704, 1698, 1704,
-
-     1706, 1702, 1710, 1708, 1714, 1713, 1708, 1709, 1697, 1711,
-     1709, 1711, 1711, 1717, 1711, 1721, 1714, 1716, 1715, 1724,
-     1716, 1713, 1717, 1718, 1719, 1719, 1720,    0, 1722, 1720,
-     1702, 1722, 1724, 1714, 1723, 1723, 1725, 1711, 1726, 1727,
-     1728,    0, 1717, 1728, 1721, 1714, 1716,    0, 1724, 1716,
-     1732, 1717, 1737, 1719, 1719, 1720, 1711, 1722, 1720, 1739,
-     1722, 1724, 1740, 1723, 1723, 1725, 1733, 1726, 1727, 1728,
-     1729, 1729, 1728, 1730, 1730, 1731, 1731, 1734, 1733, 1732,
-     1736, 1737, 1736, 1738, 1741, 1711, 1734, 1742, 1739, 1743,
-     1743, 1740, 1745, 1738, 1746, 1733, 1742, 1803, 1744, 1729,
-
-     1729, 1809, 1730, 1730, 1731, 1731, 1734, 1733,    0, 1736,
-     1744, 1736, 1738, 1741, 1747, 1734, 1742, 1748, 1743, 1743,
-        0, 1745, 1738, 1746, 1805, 1742, 1803, 1744, 1747, 1807,
-     1809, 1748, 1799, 1799, 1799, 1799, 1799, 1799,    0, 1744,
-     1805, 1805, 1810, 1747,    0, 1807, 1748, 1755, 1755, 1755,
-     1755, 1755, 1755, 1755, 1755,    0,    0, 1747, 1807,    0,
-     1748, 1753, 1753, 1753, 1753, 1753, 1753, 1753, 1753, 1753,
-     1805, 1810, 1808, 1808, 1807, 1811, 1812, 1753, 1753, 1753,
-     1753, 1753, 1753, 1756, 1756, 1756, 1756, 1756, 1756, 1756,
-     1756, 1757,    0, 1757, 1757, 1757, 1757, 1757, 1757, 1757,
-
-     1757, 1808, 1808,    0, 1811, 1812, 1753, 1753, 1753, 1753,
-     1753, 1753, 1754, 1754, 1754, 1754, 1754, 1754, 1754, 1754,
-     1754, 1754,    0,    0,    0, 1813, 1814, 1815, 1754, 1754,
-     1754, 1754, 1754, 1754, 1762, 1762, 1762, 1762, 1762, 1762,
-     1762, 1762, 1762, 1762, 1763, 1763, 1763, 1763, 1763, 1763,
-     1763, 1763, 1763, 1763, 1813, 1814, 1815, 1754, 1754, 1754,
-     1754, 1754, 1754, 1764, 1764, 1764, 1764, 1764, 1764, 1764,
-     1764, 1764, 1764, 1765, 1765, 1765, 1765, 1765, 1765, 1765,
-     1765, 1765, 1765, 1816, 1817, 1819, 1825, 1816, 1828, 1765,
-     1765, 1765, 1765, 1765, 1765, 1766, 1766, 1766, 1766, 1766,
-
-     1766, 1766, 1766, 1767, 1767, 1767, 1767, 1767, 1767, 1767,
-     1767,    0, 1816, 1817, 1819, 1825, 1816, 1828, 1765, 1765,
-     1765, 1765, 1765, 1765, 1768,    0, 1768, 1768, 1768, 1768,
-     1768, 1768, 1768, 1768, 1772, 1772, 1772, 1772, 1772, 1772,
-     1772, 1772, 1772, 1772, 1773, 1773, 1773, 1773, 1773, 1773,
-     1773, 1773, 1773, 1773, 1774, 1774, 1774, 1774, 1774, 1774,
-     1774, 1774, 1774, 1774, 1775, 1775, 1775, 1775, 1775, 1775,
-     1775, 1775, 1775, 1775, 1821, 1821, 1830, 1834, 1836, 1844,
-     1775, 1775, 1775, 1775, 1775, 1775, 1776, 1776, 1776, 1776,
-     1776, 1776, 1776, 1776, 1777, 1777, 1777, 1777, 1777, 1777,
-
-     1777, 1777,    0, 1821, 1821, 1830, 1834, 1836, 1844, 1775,
-     1775, 1775, 1775, 1775, 1775, 1778,    0, 1778, 1778, 1778,
-     1778, 1778, 1778, 1778, 1778, 1782, 1782, 1782, 1782, 1782,
-     1782, 1782, 1782, 1782, 1783, 1783, 1783, 1783, 1783, 1783,
-     1783, 1783, 1783, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
-     1784, 1784, 1785, 1785, 1785, 1785, 1785, 1785, 1785, 1785,
-     1785, 1787,    0, 1787, 1787, 1787, 1787, 1787, 1787, 1787,
-     1787, 1788,    0, 1788, 1788, 1788, 1788, 1788, 1788, 1788,
-     1788, 1789,    0, 1789, 1789, 1789, 1789, 1789, 1789, 1789,
-     1789, 1791,    0, 1791, 1791, 1791, 1791, 1791, 1791, 1791,
-
-     1791, 1792,    0, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
-     1792, 1793,    0, 1793, 1793, 1793, 1793, 1793, 1793, 1793,
-     1793, 1794, 1794, 1794, 1794, 1794, 1794, 1794, 1794, 1794,
-     1794, 1822, 1843, 1843, 1846, 1849, 1822, 1794, 1794, 1794,
-     1794, 1794, 1794, 1795, 1795, 1795, 1795, 1795, 1795, 1795,
-     1795, 1797, 1797, 1797, 1797, 1797, 1797, 1797, 1797, 1861,
-     1822, 1843, 1843, 1846, 1849, 1822, 1794, 1794, 1794, 1794,
-     1794, 1794, 1796, 1796, 1796, 1796, 1796, 1796, 1796, 1796,
-     1796, 1796, 1796,    0,    0,    0, 1863,    0, 1861, 1796,
-     1796, 1796, 1796, 1796, 1796, 1798, 1798, 1798, 1798, 1798,
-
-     1798, 1798, 1798,    0, 1841, 1848, 1818, 1823, 1824,    0,
-        0, 1866, 1818, 1820, 1823, 1863, 1824,    0, 1796, 1796,
-     1796, 1796, 1796, 1796, 1804, 1804, 1820,    0,    0, 1832,
-     1804, 1838, 1804, 1804, 1804, 1818, 1832,    0, 1841, 1848,
-     1866, 1818, 1820, 1804, 1838, 1804, 1804, 1804, 1804, 1804,
-     1824, 1835, 1804,    0, 2907, 1820, 1823, 1837, 1832, 2907,
-     1838,    0, 1856,    0, 1839, 1832, 1835, 1841, 1848, 1839,
-        0, 1837,    0, 1838,    0,    0, 1804, 1804, 1804, 1824,
-     1835, 1804, 1806, 1806, 1840, 1823, 1837,    0, 1806, 1842,
-     1806, 1806, 1806, 1839, 1840, 1835, 1856,    0, 1839, 1842,
-
-     1837, 1806, 1855, 1806, 1806, 1806, 1806, 1806, 1847, 1845,
-        0, 1851, 1852, 1840, 1845, 1847, 1853, 1855, 1842, 1851,
-     1852, 1854, 1854, 1840,    0, 1856, 1806, 1865, 1842, 1860,
-     1851, 1855, 1853, 1853, 1806, 1806, 1806, 1847, 1845, 1860,
-     1859, 1862,    0, 1845, 1847, 1859, 1855, 1862, 1869, 1867,
-     1854, 1854, 1851, 1852, 1867, 1806, 1868, 1868, 1860, 1870,
-     1870, 1865, 1853, 1873, 1869, 1871, 1875, 1875, 1860, 1859,
-     1862, 1871, 1878,    0, 1859,    0, 1862, 1885, 1867, 1869,
-     1880, 1851, 1852, 1867, 1880, 1868, 1868, 1876, 1870, 1870,
-     1865, 1881, 1873, 1876, 1871, 1875, 1875, 1881, 1882, 1883,
-
-     1871, 1878, 1879, 1882, 1879, 1879, 1885, 1879, 1869, 1880,
-     1884, 1884, 1886, 1880, 1883, 1887, 1876, 1888, 1886, 1889,
-     1881, 1890, 1876, 1891, 1892, 1892, 1881, 1882, 1883, 1893,
-     1893, 1894, 1882, 1895, 1896, 1894, 1898, 1897, 1898, 1884,
-     1884, 1886, 1901, 1883, 1887, 1902, 1888, 1886, 1889, 1904,
-     1890, 1907, 1891, 1892, 1892, 1897, 1905, 1905, 1893, 1893,
-     1894, 1908, 1895, 1896, 1894, 1898, 1897, 1898, 1906, 1906,
-     1909, 1901, 2845, 2845, 1902,    0,    0, 2845, 1904,    0,
-     1907,    0, 2846, 2846, 1897, 1905, 1905, 2846,    0,    0,
-     1908, 1917, 1917, 1917, 1917, 1917, 1917, 1906, 1906, 1909,
-
-     1914, 1914, 1914, 1914, 1914, 1914, 1914, 1914, 1914, 1914,
-     1914, 1924, 1924, 1924, 1924, 1924, 1924, 1914, 1914, 1914,
-     1914, 1914, 1914, 1915, 1915, 1915, 1915, 1915, 1915, 1915,
-     1915, 1916, 1916, 1916, 1916, 1916, 1916, 1916, 1916, 1933,
-     1933, 1933, 1933, 1933, 1933,    0, 1914, 1914, 1914, 1914,
-     1914, 1914, 1918,    0, 1918, 1918, 1918, 1918, 1918, 1918,
-     1918, 1918, 1919, 1919, 1919, 1919, 1919, 1919, 1919, 1919,
-     1919, 1919, 1942, 1942, 1942, 1942, 1942, 1942, 1919, 1919,
-     1919, 1919, 1919, 1919, 1920, 1920, 1920, 1920, 1920, 1920,
-     1920, 1920, 1922, 1922, 1922, 1922, 1922, 1922, 1922, 1922,
-
-     1969, 2118, 2118, 2118, 2118, 2118, 2118, 1919, 1919, 1919,
-     1919, 1919, 1919, 1921, 1921, 1921, 1921, 1921, 1921, 1921,
-     1921, 1921, 1921, 1921, 1973, 1974, 1975, 1976, 1977, 1969,
-     1921, 1921, 1921, 1921, 1921, 1921, 1923, 1923, 1923, 1923,
-     1923, 1923, 1923, 1923, 1929, 1929, 1929, 1929, 1929, 1929,
-     1929, 1929,    0, 1973, 1974, 1975, 1976, 1977,    0, 1921,
-     1921, 1921, 1921, 1921, 1921, 1928, 1928, 1928, 1928, 1928,
-     1928, 1928, 1928, 1928, 1928, 1979, 1981, 1982, 1983, 1984,
-     1985, 1928, 1928, 1928, 1928, 1928, 1928, 1931, 1931, 1931,
-     1931, 1931, 1931, 1931, 1931, 1932, 1932, 1932, 1932, 1932,
-
-     1932, 1932, 1932, 1986, 1979, 1981, 1982, 1983, 1984, 1985,
-     1928, 1928, 1928, 1928, 1928, 1928, 1930, 1930, 1930, 1930,
-     1930, 1930, 1930, 1930, 1930, 1930, 1930, 1991, 1992, 1993,
-     1997, 1999, 1986, 1930, 1930, 1930, 1930, 1930, 1930, 1938,
-     1938, 1938, 1938, 1938, 1938, 1938, 1938, 1940, 1940, 1940,
-     1940, 1940, 1940, 1940, 1940,    0, 1991, 1992, 1993, 1997,
-     1999,    0, 1930, 1930, 1930, 1930, 1930, 1930, 1937, 1937,
-     1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 2003, 2004,
-     2005, 2006, 2008, 2009, 1937, 1937, 1937, 1937, 1937, 1937,
-     1941, 1941, 1941, 1941, 1941, 1941, 1941, 1941, 1946, 1946,
-
-     1946, 1946, 1946, 1946, 1946, 1946, 1946, 2003, 2004, 2005,
-     2006, 2008, 2009, 1937, 1937, 1937, 1937, 1937, 1937, 1939,
-     1939, 1939, 1939, 1939, 1939, 1939, 1939, 1939, 1939, 1939,
-        0, 2010, 2022, 2023, 2024, 2025, 1939, 1939, 1939, 1939,
-     1939, 1939, 1947, 1947, 1947, 1947, 1947, 1947, 1947, 1947,
-     1947, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948, 1948,
-     2010, 2022, 2023, 2024, 2025, 1939, 1939, 1939, 1939, 1939,
-     1939, 1949, 1949, 1949, 1949, 1949, 1949, 1949, 1949, 1949,
-     1950, 1950, 1950, 1950, 1950, 1950, 1950, 1950, 1951,    0,
-     1951, 1951, 1951, 1951, 1951, 1951, 1951, 1951, 1952,    0,
-
-     1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1953,    0,
-     1953, 1953, 1953, 1953, 1953, 1953, 1954, 1954, 1954, 1954,
-     1954, 1954, 1954, 1954, 1955,    0, 1955, 1955, 1955, 1955,
-     1955, 1955, 1955, 1955, 1956,    0, 1956, 1956, 1956, 1956,
-     1956, 1956, 1956, 1956, 1957,    0, 1957, 1957, 1957, 1957,
-     1957, 1957, 1958, 1958, 1958, 1958, 1958, 1958, 1958, 1958,
-     1958, 1958, 1959, 1959, 1959, 1959, 1959, 1959, 1959, 1959,
-     1959, 1959, 1960, 1960, 1960, 1960, 1960, 1960, 1960, 1960,
-     1960, 1960, 1961, 1961, 1961, 1961, 1961, 1961, 1961, 1961,
-     1962, 1962, 1962, 1962, 1962, 1962, 1962, 1962, 1962, 1962,
-
-     2031, 2032, 2035, 2036, 2037, 2038, 1962, 1962, 1962, 1962,
-     1962, 1962, 1963, 1963, 1963, 1963, 1963, 1963, 1963, 1963,
-     1964, 1964, 1964, 1964, 1964, 1964, 1964, 1964,    0, 2031,
-     2032, 2035, 2036, 2037, 2038, 1962, 1962, 1962, 1962, 1962,
-     1962, 1965, 1971, 1965, 1965, 1965, 1965, 1965, 1965, 1965,
-     1965, 1970, 1970,    0, 2011, 2013, 2014, 1970, 1971, 1970,
-     1970, 1970, 2011, 2013, 2014, 2041, 2018,    0, 2042,    0,
-     1970, 2017, 1970, 1970, 1970, 1970, 1970, 2015, 1971, 2017,
-     2043, 1970, 2018, 2852, 2852, 2015, 2044, 2045, 2852,    0,
-        0,    0,    0, 2014, 2041, 2011, 2013, 2042, 2030, 2047,
-
-        0,    0, 2018, 1970, 1970, 1970,    0, 1971, 2017, 2043,
-     1970, 1972, 1972, 2026, 2030, 2044, 2045, 1972, 2015, 1972,
-     1972, 1972, 2014, 2049, 2011, 2013, 2030, 2050, 2047, 2026,
-     1972, 2018, 1972, 1972, 1972, 1972, 1972, 2017, 2051, 2052,
-     2053, 2055, 2056, 2122, 2126, 2127, 2128, 2015, 2026, 2853,
-     2853,    0, 2049,    0, 2853, 2030, 2050, 2058, 2129, 2058,
-     2058, 2130, 2058, 1972, 1972, 1972, 2058, 2051, 2052, 2053,
-     2055, 2056, 2122, 2126, 2127, 2128,    0, 2026, 2061, 2061,
-     2061, 2061, 2061, 2061, 2061, 2061, 2061, 2129, 2131, 2132,
-     2130, 2133, 2134, 2135, 2061, 2061, 2061, 2061, 2061, 2061,
-
-     2063, 2063, 2063, 2063, 2063, 2063, 2063, 2063, 2064, 2064,
-     2064, 2064, 2064, 2064, 2064, 2064,    0, 2131, 2132,    0,
-     2133, 2134, 2135, 2061, 2061, 2061, 2061, 2061, 2061, 2062,
-     2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062, 2062,    0,
-        0,    0, 2137, 2140, 2144, 2062, 2062, 2062, 2062, 2062,
-     2062, 2065,    0, 2065, 2065, 2065, 2065, 2065, 2065, 2065,
-     2065, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070, 2070,
-     2070, 2137, 2140, 2144, 2062, 2062, 2062, 2062, 2062, 2062,
-     2071, 2071, 2071, 2071, 2071, 2071, 2071, 2071, 2071, 2071,
-     2072, 2072, 2072, 2072, 2072, 2072, 2072, 2072, 2072, 2072,
-
-     2073, 2073, 2073, 2073, 2073, 2073, 2073, 2073, 2073, 2073,
-     2142, 2146, 2142, 2153, 2155, 2159, 2073, 2073, 2073, 2073,
-     2073, 2073, 2074, 2074, 2074, 2074, 2074, 2074, 2074, 2074,
-     2075, 2075, 2075, 2075, 2075, 2075, 2075, 2075,    0, 2142,
-     2146, 2142, 2153, 2155, 2159, 2073, 2073, 2073, 2073, 2073,
-     2073, 2076,    0, 2076, 2076, 2076, 2076, 2076, 2076, 2076,
-     2076, 2080, 2080, 2080, 2080, 2080, 2080, 2080, 2080, 2080,
-     2080, 2081, 2081, 2081, 2081, 2081, 2081, 2081, 2081, 2081,
-     2081, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2082, 2082,
-     2082, 2083, 2083, 2083, 2083, 2083, 2083, 2083, 2083, 2083,
-
-     2083, 2157, 2157, 2163, 2163, 2165, 2166, 2083, 2083, 2083,
-     2083, 2083, 2083, 2084, 2084, 2084, 2084, 2084, 2084, 2084,
-     2084, 2085, 2085, 2085, 2085, 2085, 2085, 2085, 2085,    0,
-     2157, 2157, 2163, 2163, 2165, 2166, 2083, 2083, 2083, 2083,
-     2083, 2083, 2086,    0, 2086, 2086, 2086, 2086, 2086, 2086,
-     2086, 2086, 2090, 2090, 2090, 2090, 2090, 2090, 2090, 2090,
-     2090, 2090, 2091, 2091, 2091, 2091, 2091, 2091, 2091, 2091,
-     2091, 2091, 2092, 2092, 2092, 2092, 2092, 2092, 2092, 2092,
-     2092, 2092, 2093, 2093, 2093, 2093, 2093, 2093, 2093, 2093,
-     2093, 2093, 2160, 2167, 2170, 2167, 2171, 2160, 2093, 2093,
-
-     2093, 2093, 2093, 2093, 2094, 2094, 2094, 2094, 2094, 2094,
-     2094, 2094, 2095, 2095, 2095, 2095, 2095, 2095, 2095, 2095,
-        0, 2160, 2167, 2170, 2167, 2171, 2160, 2093, 2093, 2093,
-     2093, 2093, 2093, 2096,    0, 2096, 2096, 2096, 2096, 2096,
-     2096, 2096, 2096, 2100, 2100, 2100, 2100, 2100, 2100, 2100,
-     2100, 2100, 2101, 2101, 2101, 2101, 2101, 2101, 2101, 2101,
-     2101, 2102, 2102, 2102, 2102, 2102, 2102, 2102, 2102, 2102,
-     2103, 2103, 2103, 2103, 2103, 2103, 2103, 2103, 2103, 2104,
-     2104, 2104, 2104, 2104, 2104, 2104, 2104, 2104, 2106,    0,
-     2106, 2106, 2106, 2106, 2106, 2106, 2106, 2106, 2107,    0,
-
-     2107, 2107, 2107, 2107, 2107, 2107, 2107, 2107, 2108,    0,
-     2108, 2108, 2108, 2108, 2108, 2108, 2108, 2108, 2110,    0,
-     2110, 2110, 2110, 2110, 2110, 2110, 2110, 2110, 2111,    0,
-     2111, 2111, 2111, 2111, 2111, 2111, 2111, 2111, 2112,    0,
-     2112, 2112, 2112, 2112, 2112, 2112, 2112, 2112, 2113, 2113,
-     2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2164, 2169,
-     2169, 2174, 2176, 2164, 2113, 2113, 2113, 2113, 2113, 2113,
-     2114, 2114, 2114, 2114, 2114, 2114, 2114, 2114, 2116, 2116,
-     2116, 2116, 2116, 2116, 2116, 2116,    0, 2164, 2169, 2169,
-     2174, 2176, 2164, 2113, 2113, 2113, 2113, 2113, 2113, 2115,
-
-     2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115,
-     2177,    0, 2179,    0, 2180, 2143, 2115, 2115, 2115, 2115,
-     2115, 2115, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2151,    0,    0, 2143, 2136,    0, 2147,    0, 2151, 2177,
-     2124, 2179, 2136, 2180, 2143, 2115, 2115, 2115, 2115, 2115,
-     2115, 2123, 2123, 2145, 2147, 2181, 2124, 2123, 2149, 2123,
-     2123, 2123, 2143, 2136, 2145, 2147, 2149, 2151,    0, 2251,
-     2123, 2136, 2123, 2123, 2123, 2123, 2123, 2124, 2148,    0,
-     2158, 2175, 2145, 2147, 2181, 2148, 2158, 2168, 2175, 2255,
-     2257, 2258, 2168, 2145, 2123,    0, 2151, 2162, 2251, 2149,
-
-     2259,    0, 2172, 2123, 2123, 2123, 2124, 2148, 2172, 2158,
-     2175, 2260,    0, 2162, 2148, 2158, 2168, 2175, 2255, 2257,
-     2258, 2168, 2162, 2123, 2125, 2125,    0, 2261, 2149, 2259,
-     2125, 2172, 2125, 2125, 2125,    0, 2178, 2172, 2178, 2178,
-     2260, 2178,    0, 2125,    0, 2125, 2125, 2125, 2125, 2125,
-     2182, 2162, 2182, 2182,    0, 2182, 2261, 2857, 2857, 2182,
-     2858, 2858, 2857,    0, 2178, 2858,    0, 2263,    0, 2125,
-     2190, 2190, 2190, 2190, 2190, 2190, 2125, 2125, 2125, 2188,
-     2188, 2188, 2188, 2188, 2188, 2188, 2188, 2178, 2189, 2189,
-     2189, 2189, 2189, 2189, 2189, 2189, 2263, 2191, 2125, 2191,
-
-     2191, 2191, 2191, 2191, 2191, 2191, 2191, 2193, 2193, 2193,
-     2193, 2193, 2193, 2193, 2193,    0, 2178, 2186, 2186, 2186,
-     2186, 2186, 2186, 2186, 2186, 2186, 2197, 2197, 2197, 2197,
-     2197, 2197, 2186, 2186, 2186, 2186, 2186, 2186, 2195, 2195,
-     2195, 2195, 2195, 2195, 2195, 2195, 2196, 2196, 2196, 2196,
-     2196, 2196, 2196, 2196, 2206, 2206, 2206, 2206, 2206, 2206,
-        0, 2186, 2186, 2186, 2186, 2186, 2186, 2187, 2187, 2187,
-     2187, 2187, 2187, 2187, 2187, 2187, 2187, 2187, 2215, 2215,
-     2215, 2215, 2215, 2215, 2187, 2187, 2187, 2187, 2187, 2187,
-     2202, 2202, 2202, 2202, 2202, 2202, 2202, 2202, 2204, 2204,
-
-     2204, 2204, 2204, 2204, 2204, 2204, 2224, 2224, 2224, 2224,
-     2224, 2224,    0, 2187, 2187, 2187, 2187, 2187, 2187, 2192,
-     2192, 2192, 2192, 2192, 2192, 2192, 2192, 2192, 2192, 2264,
-     2265, 2270, 2278, 2281, 2283, 2192, 2192, 2192, 2192, 2192,
-     2192, 2205, 2205, 2205, 2205, 2205, 2205, 2205, 2205, 2211,
-     2211, 2211, 2211, 2211, 2211, 2211, 2211, 2288, 2264, 2265,
-     2270, 2278, 2281, 2283, 2192, 2192, 2192, 2192, 2192, 2192,
-     2194, 2194, 2194, 2194, 2194, 2194, 2194, 2194, 2194, 2194,
-     2194, 2276, 2289, 2292, 2292, 2276, 2288, 2194, 2194, 2194,
-     2194, 2194, 2194, 2213, 2213, 2213, 2213, 2213, 2213, 2213,
-
-     2213, 2214, 2214, 2214, 2214, 2214, 2214, 2214, 2214,    0,
-     2276, 2289, 2292, 2292, 2276,    0, 2194, 2194, 2194, 2194,
-     2194, 2194, 2201, 2201, 2201, 2201, 2201, 2201, 2201, 2201,
-     2201, 2201, 2290, 2294, 2295, 2297, 2290, 2378, 2201, 2201,
-     2201, 2201, 2201, 2201, 2220, 2220, 2220, 2220, 2220, 2220,
-     2220, 2220, 2222, 2222, 2222, 2222, 2222, 2222, 2222, 2222,
-        0, 2290, 2294, 2295, 2297, 2290, 2378, 2201, 2201, 2201,
-     2201, 2201, 2201, 2203, 2203, 2203, 2203, 2203, 2203, 2203,
-     2203, 2203, 2203, 2203, 2305, 2305, 2305, 2305, 2305, 2305,
-     2203, 2203, 2203, 2203, 2203, 2203, 2223, 2223, 2223, 2223,
-
-     2223, 2223, 2223, 2223, 2228, 2228, 2228, 2228, 2228, 2228,
-     2228, 2228, 2228, 2374, 2374, 2374, 2374, 2374, 2374, 2203,
-     2203, 2203, 2203, 2203, 2203, 2210, 2210, 2210, 2210, 2210,
-     2210, 2210, 2210, 2210, 2210,    0, 2382, 2383, 2384, 2397,
-     2398, 2210, 2210, 2210, 2210, 2210, 2210, 2229, 2229, 2229,
-     2229, 2229, 2229, 2229, 2229, 2229, 2230, 2230, 2230, 2230,
-     2230, 2230, 2230, 2230, 2230, 2382, 2383, 2384, 2397, 2398,
-     2210, 2210, 2210, 2210, 2210, 2210, 2212, 2212, 2212, 2212,
-     2212, 2212, 2212, 2212, 2212, 2212, 2212, 2403, 2467, 2471,
-     2472, 2473, 2481, 2212, 2212, 2212, 2212, 2212, 2212, 2231,
-
-     2231, 2231, 2231, 2231, 2231, 2231, 2231, 2231, 2232, 2232,
-     2232, 2232, 2232, 2232, 2232, 2232, 2403, 2467, 2471, 2472,
-     2473, 2481, 2212, 2212, 2212, 2212, 2212, 2212, 2219, 2219,
-     2219, 2219, 2219, 2219, 2219, 2219, 2219, 2219,    0,    0,
-        0, 2482, 2483, 2484, 2219, 2219, 2219, 2219, 2219, 2219,
-     2233,    0, 2233, 2233, 2233, 2233, 2233, 2233, 2233, 2233,
-     2234, 2282, 2234, 2234, 2234, 2234, 2234, 2234, 2234, 2234,
-     2482, 2483, 2484, 2219, 2219, 2219, 2219, 2219, 2219, 2221,
-     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
-     2486, 2487, 2478, 2272, 2282, 2478, 2221, 2221, 2221, 2221,
-
-     2221, 2221, 2235, 2272, 2235, 2235, 2235, 2235, 2235, 2235,
-     2236, 2236, 2236, 2236, 2236, 2236, 2236, 2236,    0, 2486,
-     2487, 2478, 2272, 2282, 2478, 2221, 2221, 2221, 2221, 2221,
-     2221, 2237, 2272, 2237, 2237, 2237, 2237, 2237, 2237, 2237,
-     2237, 2238,    0, 2238, 2238, 2238, 2238, 2238, 2238, 2238,
-     2238, 2239,    0, 2239, 2239, 2239, 2239, 2239, 2239, 2240,
-     2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2241,
-     2241, 2241, 2241, 2241, 2241, 2241, 2241, 2241, 2241, 2242,
-     2242, 2242, 2242, 2242, 2242, 2242, 2242, 2242, 2242, 2243,
-     2243, 2243, 2243, 2243, 2243, 2243, 2243, 2244, 2244, 2244,
-
-     2244, 2244, 2244, 2244, 2244, 2244, 2244, 2298, 2480, 2298,
-     2298, 2480, 2298, 2244, 2244, 2244, 2244, 2244, 2244, 2245,
-     2245, 2245, 2245, 2245, 2245, 2245, 2245, 2246, 2246, 2246,
-     2246, 2246, 2246, 2246, 2246, 2298,    0, 2480,    0,    0,
-     2480,    0, 2244, 2244, 2244, 2244, 2244, 2244, 2247, 2253,
-     2247, 2247, 2247, 2247, 2247, 2247, 2247, 2247, 2252, 2252,
-     2271,    0,    0, 2273, 2252, 2253, 2252, 2252, 2252, 2275,
-     2284, 2285, 2489, 2286,    0, 2287, 2271, 2252, 2273, 2252,
-     2252, 2252, 2252, 2252, 2253, 2275, 2284, 2285, 2286, 2271,
-     2285, 2287, 2273, 2291,    0, 2545,    0,    0, 2275, 2284,
-
-     2470, 2489, 2286, 2252, 2287, 2271, 2388, 2273, 2470, 2291,
-     2252, 2252, 2252, 2253, 2275, 2284, 2388, 2286,    0, 2285,
-     2287, 2390, 2291, 2296, 2545, 2296, 2296,    0, 2296, 2470,
-        0, 2390, 2252, 2254, 2254, 2388,    0, 2470, 2291, 2254,
-     2546, 2254, 2254, 2254, 2299, 2388, 2299, 2299,    0, 2299,
-     2390, 2296, 2254, 2549, 2254, 2254, 2254, 2254, 2254, 2296,
-     2390,    0, 2407, 2254, 2407, 2407,    0, 2407,    0, 2546,
-        0, 2303, 2299, 2303, 2303, 2303, 2303, 2303, 2303, 2303,
-     2303, 2303, 2549,    0, 2551, 2254, 2254, 2254, 2296,    0,
-     2407,    0, 2254, 2304, 2304, 2304, 2304, 2304, 2304, 2304,
-
-     2304, 2306, 2306, 2306, 2306, 2306, 2306, 2306, 2306, 2306,
-        0,    0, 2490, 2551, 2553, 2555, 2490, 2306, 2306, 2306,
-     2306, 2306, 2306, 2310, 2310, 2310, 2310, 2310, 2310, 2310,
-     2310, 2311,    0, 2311, 2311, 2311, 2311, 2311, 2311, 2311,
-     2311, 2490,    0, 2553, 2555, 2490, 2306, 2306, 2306, 2306,
-     2306, 2306, 2308, 2308, 2308, 2308, 2308, 2308, 2308, 2308,
-     2308, 2308,    0,    0,    0, 2556, 2605, 2605, 2308, 2308,
-     2308, 2308, 2308, 2308, 2316, 2316, 2316, 2316, 2316, 2316,
-     2316, 2316, 2316, 2316, 2317, 2317, 2317, 2317, 2317, 2317,
-     2317, 2317, 2317, 2317, 2556, 2605, 2605, 2308, 2308, 2308,
-
-     2308, 2308, 2308, 2318, 2318, 2318, 2318, 2318, 2318, 2318,
-     2318, 2318, 2318, 2319, 2319, 2319, 2319, 2319, 2319, 2319,
-     2319, 2319, 2319,    0, 2547, 2610, 2612, 2547, 2651, 2319,
-     2319, 2319, 2319, 2319, 2319, 2321, 2321, 2321, 2321, 2321,
-     2321, 2321, 2321, 2322,    0, 2322, 2322, 2322, 2322, 2322,
-     2322, 2322, 2322, 2547, 2610, 2612, 2547, 2651, 2319, 2319,
-     2319, 2319, 2319, 2319, 2326, 2326, 2326, 2326, 2326, 2326,
-     2326, 2326, 2326, 2326, 2327, 2327, 2327, 2327, 2327, 2327,
-     2327, 2327, 2327, 2327, 2328, 2328, 2328, 2328, 2328, 2328,
-     2328, 2328, 2328, 2328, 2329, 2329, 2329, 2329, 2329, 2329,
-
-     2329, 2329, 2329, 2329,    0, 2552, 2652, 2653, 2654, 2552,
-     2329, 2329, 2329, 2329, 2329, 2329, 2331, 2331, 2331, 2331,
-     2331, 2331, 2331, 2331, 2332,    0, 2332, 2332, 2332, 2332,
-     2332, 2332, 2332, 2332, 2552, 2652, 2653, 2654, 2552, 2329,
-     2329, 2329, 2329, 2329, 2329, 2336, 2336, 2336, 2336, 2336,
-     2336, 2336, 2336, 2336, 2336, 2337, 2337, 2337, 2337, 2337,
-     2337, 2337, 2337, 2337, 2337, 2338, 2338, 2338, 2338, 2338,
-     2338, 2338, 2338, 2338, 2338, 2339, 2339, 2339, 2339, 2339,
-     2339, 2339, 2339, 2339, 2339,    0, 2554, 2655, 2674, 2684,
-     2554, 2339, 2339, 2339, 2339, 2339, 2339, 2341, 2341, 2341,
-
-     2341, 2341, 2341, 2341, 2341, 2342,    0, 2342, 2342, 2342,
-     2342, 2342, 2342, 2342, 2342, 2554, 2655, 2674, 2684, 2554,
-     2339, 2339, 2339, 2339, 2339, 2339, 2346, 2346, 2346, 2346,
-     2346, 2346, 2346, 2346, 2346, 2346, 2347, 2347, 2347, 2347,
-     2347, 2347, 2347, 2347, 2347, 2347, 2348, 2348, 2348, 2348,
-     2348, 2348, 2348, 2348, 2348, 2348, 2349, 2349, 2349, 2349,
-     2349, 2349, 2349, 2349, 2349, 2349,    0, 2604, 2685, 2695,
-     2699, 2604, 2349, 2349, 2349, 2349, 2349, 2349, 2351, 2351,
-     2351, 2351, 2351, 2351, 2351, 2351, 2352,    0, 2352, 2352,
-     2352, 2352, 2352, 2352, 2352, 2352, 2604, 2685, 2695, 2699,
-
-     2604, 2349, 2349, 2349, 2349, 2349, 2349, 2356, 2356, 2356,
-     2356, 2356, 2356, 2356, 2356, 2356, 2357, 2357, 2357, 2357,
-     2357, 2357, 2357, 2357, 2357, 2358, 2358, 2358, 2358, 2358,
-     2358, 2358, 2358, 2358, 2359, 2359, 2359, 2359, 2359, 2359,
-     2359, 2359, 2359, 2360, 2360, 2360, 2360, 2360, 2360, 2360,
-     2360, 2360, 2362,    0, 2362, 2362, 2362, 2362, 2362, 2362,
-     2362, 2362, 2363,    0, 2363, 2363, 2363, 2363, 2363, 2363,
-     2363, 2363, 2364,    0, 2364, 2364, 2364, 2364, 2364, 2364,
-     2364, 2364, 2366,    0, 2366, 2366, 2366, 2366, 2366, 2366,
-     2366, 2366, 2367,    0, 2367, 2367, 2367, 2367, 2367, 2367,
-
-     2367, 2367, 2368,    0, 2368, 2368, 2368, 2368, 2368, 2368,
-     2368, 2368, 2369, 2369, 2369, 2369, 2369, 2369, 2369, 2369,
-     2369, 2369, 2408, 2700, 2408, 2408,    0, 2408, 2369, 2369,
-     2369, 2369, 2369, 2369, 2370, 2370, 2370, 2370, 2370, 2370,
-     2370, 2370, 2372, 2372, 2372, 2372, 2372, 2372, 2372, 2372,
-     2408, 2557, 2700, 2557, 2557,    0, 2557, 2369, 2369, 2369,
-     2369, 2369, 2369, 2371, 2371, 2371, 2371, 2371, 2371, 2371,
-     2371, 2371, 2371, 2371,    0,    0,    0,    0, 2400, 2557,
-     2371, 2371, 2371, 2371, 2371, 2371, 2373, 2373, 2373, 2373,
-     2373, 2373, 2373, 2373, 2400, 2410, 2410, 2410, 2410, 2410,
-
-     2410, 2410, 2410, 2866, 2866,    0,    0,    0, 2866, 2371,
-     2371, 2371, 2371, 2371, 2371, 2379, 2379, 2391, 2392, 2400,
-        0, 2379, 2394, 2379, 2379, 2379,    0, 2391, 2392, 2391,
-        0, 2395, 2394,    0, 2379, 2559, 2379, 2379, 2379, 2379,
-     2379, 2395,    0, 2401, 2559, 2395, 2391, 2392, 2400, 2379,
-        0, 2394, 2399, 2401,    0, 2406, 2391, 2392, 2391,    0,
-     2395, 2394, 2399,    0, 2559, 2406, 2399, 2379, 2379, 2379,
-     2395,    0, 2401, 2559, 2395,    0, 2402,    0, 2379, 2381,
-     2381, 2399, 2401, 2405, 2406, 2381, 2402, 2381, 2381, 2381,
-     2402, 2399,    0, 2405, 2406, 2399, 2548, 2405, 2381, 2404,
-
-     2381, 2381, 2381, 2381, 2381, 2402, 2404, 2548,    0, 2404,
-     2381,    0, 2405, 2867, 2867, 2402, 2876, 2876, 2867, 2402,
-     2381, 2876, 2405,    0,    0, 2548, 2405,    0, 2404, 2877,
-     2877, 2381, 2381, 2381, 2877, 2404, 2548,    0, 2404, 2381,
-     2418, 2418, 2418, 2418, 2418, 2418, 2418, 2418, 2413, 2381,
-     2413, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2413, 2417,
-     2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417,    0, 2558,
-        0, 2558, 2558,    0, 2558, 2417, 2417, 2417, 2417, 2417,
-     2417, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2420, 2425,
-     2425, 2425, 2425, 2425, 2425, 2425, 2425, 2558, 2884, 2884,
-
-        0,    0,    0, 2884, 2417, 2417, 2417, 2417, 2417, 2417,
-     2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419,
-     2698,    0,    0,    0,    0, 2698, 2419, 2419, 2419, 2419,
-     2419, 2419, 2430, 2430, 2430, 2430, 2430, 2430, 2430, 2430,
-     2435, 2435, 2435, 2435, 2435, 2435, 2435, 2435,    0, 2698,
-        0,    0,    0,    0, 2698, 2419, 2419, 2419, 2419, 2419,
-     2419, 2421, 2421, 2421, 2421, 2421, 2421, 2421, 2421, 2421,
-     2885, 2885,    0,    0,    0, 2885,    0, 2421, 2421, 2421,
-     2421, 2421, 2421, 2440, 2440, 2440, 2440, 2440, 2440, 2440,
-     2440, 2444, 2444, 2444, 2444, 2444, 2444, 2444, 2444, 2444,
-
-     2892, 2892,    0,    0,    0, 2892, 2421, 2421, 2421, 2421,
-     2421, 2421, 2424, 2424, 2424, 2424, 2424, 2424, 2424, 2424,
-     2424, 2424, 2896, 2896,    0,    0,    0, 2896, 2424, 2424,
-     2424, 2424, 2424, 2424, 2445, 2445, 2445, 2445, 2445, 2445,
-     2445, 2445, 2445, 2446, 2446, 2446, 2446, 2446, 2446, 2446,
-     2446, 2446,    0,    0,    0,    0,    0, 2424, 2424, 2424,
-     2424, 2424, 2424, 2426, 2426, 2426, 2426, 2426, 2426, 2426,
-     2426, 2426, 2905, 2905,    0,    0,    0, 2905,    0, 2426,
-     2426, 2426, 2426, 2426, 2426, 2447, 2447, 2447, 2447, 2447,
-     2447, 2447, 2447, 2447, 2448, 2448, 2448, 2448, 2448, 2448,
-
-     2448, 2448, 2906, 2906,    0,    0,    0, 2906, 2426, 2426,
-     2426, 2426, 2426, 2426, 2429, 2429, 2429, 2429, 2429, 2429,
-     2429, 2429, 2429, 2429, 2910, 2910,    0,    0,    0, 2910,
-     2429, 2429, 2429, 2429, 2429, 2429, 2449,    0, 2449, 2449,
-     2449, 2449, 2449, 2449, 2449, 2449, 2450,    0, 2450, 2450,
-     2450, 2450, 2450, 2450, 2450, 2450,    0,    0,    0, 2429,
-     2429, 2429, 2429, 2429, 2429, 2431, 2431, 2431, 2431, 2431,
-     2431, 2431, 2431, 2431, 2603,    0,    0,    0,    0,    0,
-     2603, 2431, 2431, 2431, 2431, 2431, 2431, 2451,    0, 2451,
-     2451, 2451, 2451, 2451, 2451, 2452, 2452, 2452, 2452, 2452,
-
-     2452, 2452, 2452, 2603,    0,    0,    0,    0,    0, 2603,
-     2431, 2431, 2431, 2431, 2431, 2431, 2434, 2434, 2434, 2434,
-     2434, 2434, 2434, 2434, 2434, 2434,    0,    0,    0,    0,
-        0,    0, 2434, 2434, 2434, 2434, 2434, 2434, 2453,    0,
-     2453, 2453, 2453, 2453, 2453, 2453, 2453, 2453, 2454,    0,
-     2454, 2454, 2454, 2454, 2454, 2454, 2454, 2454,    0,    0,
-        0, 2434, 2434, 2434, 2434, 2434, 2434, 2436, 2436, 2436,
-     2436, 2436, 2436, 2436, 2436, 2436,    0,    0,    0,    0,
-        0,    0,    0, 2436, 2436, 2436, 2436, 2436, 2436, 2455,
-        0, 2455, 2455, 2455, 2455, 2455, 2455, 2456, 2456, 2456,
-
-     2456, 2456, 2456, 2456, 2456, 2456, 2456,    0,    0,    0,
-        0,    0, 2436, 2436, 2436, 2436, 2436, 2436, 2439, 2439,
-     2439, 2439, 2439, 2439, 2439, 2439, 2439, 2439,    0,    0,
-        0,    0,    0,    0, 2439, 2439, 2439, 2439, 2439, 2439,
-     2457, 2457, 2457, 2457, 2457, 2457, 2457, 2457, 2457, 2457,
-     2458, 2458, 2458, 2458, 2458, 2458, 2458, 2458, 2458, 2458,
-        0,    0,    0, 2439, 2439, 2439, 2439, 2439, 2439, 2441,
-     2441, 2441, 2441, 2441, 2441, 2441, 2441, 2441, 2694,    0,
-        0,    0,    0,    0, 2694, 2441, 2441, 2441, 2441, 2441,
-     2441, 2459, 2459, 2459, 2459, 2459, 2459, 2459, 2459, 2462,
-
-     2462, 2462, 2462, 2462, 2462, 2462, 2462, 2694,    0,    0,
-        0,    0,    0, 2694, 2441, 2441, 2441, 2441, 2441, 2441,
-     2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460, 2460,
-        0,    0,    0,    0,    0,    0, 2460, 2460, 2460, 2460,
-     2460, 2460, 2463,    0, 2463, 2463, 2463, 2463, 2463, 2463,
-     2463, 2463,    0,    0,    0,    0,    0, 2488,    0, 2488,
-     2488,    0, 2488,    0,    0, 2460, 2460, 2460, 2460, 2460,
-     2460, 2468, 2468,    0, 2479,    0,    0, 2468,    0, 2468,
-     2468, 2468,    0,    0, 2479, 2488,    0,    0,    0,    0,
-     2468,    0, 2468, 2468, 2468, 2468, 2468, 2488,    0,    0,
-
-        0,    0, 2468, 2479, 2500, 2500, 2500, 2500, 2500, 2500,
-     2500, 2500, 2492, 2479, 2492, 2492, 2492, 2492, 2492, 2492,
-     2492, 2492,    0, 2468, 2468, 2468, 2488, 2897,    0, 2897,
-     2897, 2468, 2469, 2469, 2897,    0,    0,    0, 2469,    0,
-     2469, 2469, 2469, 2506, 2506, 2506, 2506, 2506, 2506, 2506,
-     2506, 2469,    0, 2469, 2469, 2469, 2469, 2469,    0,    0,
-        0,    0,    0,    0,    0, 2493, 2469, 2493, 2493, 2493,
-     2493, 2493, 2493, 2493, 2493, 2497, 2497, 2497, 2497, 2497,
-     2497, 2497, 2497, 2497, 2469, 2469, 2469,    0,    0,    0,
-        0,    0,    0,    0, 2494, 2469, 2494, 2494, 2494, 2494,
-
-     2494, 2494, 2494, 2494, 2496, 2496, 2496, 2496, 2496, 2496,
-     2496, 2496, 2496,    0,    0,    0,    0,    0,    0,    0,
-     2496, 2496, 2496, 2496, 2496, 2496, 2502, 2502, 2502, 2502,
-     2502, 2502, 2502, 2502, 2502, 2502, 2503, 2503, 2503, 2503,
-     2503, 2503, 2503, 2503, 2503, 2503,    0,    0,    0, 2496,
-     2496, 2496, 2496, 2496, 2496, 2499, 2499, 2499, 2499, 2499,
-     2499, 2499, 2499, 2499,    0,    0,    0,    0,    0,    0,
-        0, 2499, 2499, 2499, 2499, 2499, 2499, 2504, 2504, 2504,
-     2504, 2504, 2504, 2504, 2504, 2504, 2504, 2507, 2507, 2507,
-     2507, 2507, 2507, 2507, 2507, 2507, 2507,    0,    0,    0,
-
-     2499, 2499, 2499, 2499, 2499, 2499, 2505, 2505, 2505, 2505,
-     2505, 2505, 2505, 2505, 2505,    0,    0,    0,    0,    0,
-        0,    0, 2505, 2505, 2505, 2505, 2505, 2505, 2508, 2508,
-     2508, 2508, 2508, 2508, 2508, 2508, 2508, 2508, 2509, 2509,
-     2509, 2509, 2509, 2509, 2509, 2509, 2509, 2509,    0,    0,
-        0, 2505, 2505, 2505, 2505, 2505, 2505, 2510, 2510, 2510,
-     2510, 2510, 2510, 2510, 2510, 2510,    0,    0,    0,    0,
-        0,    0,    0, 2510, 2510, 2510, 2510, 2510, 2510, 2511,
-     2511, 2511, 2511, 2511, 2511, 2511, 2511, 2512, 2512, 2512,
-     2512, 2512, 2512, 2512, 2512, 2512, 2512,    0,    0,    0,
-
-        0,    0, 2510, 2510, 2510, 2510, 2510, 2510, 2513, 2513,
-     2513, 2513, 2513, 2513, 2513, 2513, 2513, 2513, 2514, 2514,
-     2514, 2514, 2514, 2514, 2514, 2514, 2514, 2514, 2515, 2515,
-     2515, 2515, 2515, 2515, 2515, 2515, 2515,    0,    0,    0,
-        0,    0,    0,    0, 2515, 2515, 2515, 2515, 2515, 2515,
-     2516, 2516, 2516, 2516, 2516, 2516, 2516, 2516, 2517, 2517,
-     2517, 2517, 2517, 2517, 2517, 2517, 2517, 2517,    0,    0,
-        0,    0,    0, 2515, 2515, 2515, 2515, 2515, 2515, 2518,
-     2518, 2518, 2518, 2518, 2518, 2518, 2518, 2518, 2518, 2519,
-     2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2519, 2520,
-
-     2520, 2520, 2520, 2520, 2520, 2520, 2520, 2520,    0,    0,
-        0,    0,    0,    0,    0, 2520, 2520, 2520, 2520, 2520,
-     2520, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2521, 2522,
-     2522, 2522, 2522, 2522, 2522, 2522, 2522, 2522, 2522,    0,
-        0,    0,    0,    0, 2520, 2520, 2520, 2520, 2520, 2520,
-     2523, 2523, 2523, 2523, 2523, 2523, 2523, 2523, 2523, 2523,
-     2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524, 2524,
-     2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525, 2525,    0,
-        0,    0,    0,    0,    0,    0, 2525, 2525, 2525, 2525,
-     2525, 2525, 2526, 2526, 2526, 2526, 2526, 2526, 2526, 2526,
-
-     2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527,    0,
-        0,    0,    0,    0,    0, 2525, 2525, 2525, 2525, 2525,
-     2525, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
-     2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2530,
-     2530, 2530, 2530, 2530, 2530, 2530, 2530, 2530, 2531, 2531,
-     2531, 2531, 2531, 2531, 2531, 2531, 2531, 2533,    0, 2533,
-     2533, 2533, 2533, 2533, 2533, 2533, 2533, 2534,    0, 2534,
-     2534, 2534, 2534, 2534, 2534, 2534, 2534, 2535,    0, 2535,
-     2535, 2535, 2535, 2535, 2535, 2535, 2535, 2537,    0, 2537,
-     2537, 2537, 2537, 2537, 2537, 2537, 2537, 2538,    0, 2538,
-
-     2538, 2538, 2538, 2538, 2538, 2538, 2538, 2539,    0, 2539,
-     2539, 2539, 2539, 2539, 2539, 2539, 2539, 2540, 2540, 2540,
-     2540, 2540, 2540, 2540, 2540, 2540, 2540,    0,    0,    0,
-        0,    0,    0, 2540, 2540, 2540, 2540, 2540, 2540, 2541,
-     2541, 2541, 2541, 2541, 2541, 2541, 2541, 2560, 2560, 2560,
-     2560, 2560, 2560, 2560, 2560,    0,    0,    0,    0,    0,
-        0,    0, 2540, 2540, 2540, 2540, 2540, 2540, 2542, 2542,
-     2542, 2542, 2542, 2542, 2542, 2542, 2542,    0,    0,    0,
-        0,    0, 2608,    0, 2542, 2542, 2542, 2542, 2542, 2542,
-     2561, 2608, 2561, 2561, 2561, 2561, 2561, 2561, 2561, 2561,
-
-     2562,    0, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562,
-        0, 2608,    0, 2542, 2542, 2542, 2542, 2542, 2542, 2563,
-     2608, 2563, 2563, 2563, 2563, 2563, 2563, 2565, 2565, 2565,
-     2565, 2565, 2565, 2565, 2565, 2565,    0,    0,    0,    0,
-        0,    0,    0, 2565, 2565, 2565, 2565, 2565, 2565, 2566,
-     2566, 2566, 2566, 2566, 2566, 2566, 2566, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568,    0,    0,    0,    0,    0,
-        0,    0, 2565, 2565, 2565, 2565, 2565, 2565, 2567, 2567,
-     2567, 2567, 2567, 2567, 2567, 2567, 2567,    0,    0,    0,
-        0,    0,    0,    0, 2567, 2567, 2567, 2567, 2567, 2567,
-
-     2571, 2571, 2571, 2571, 2571, 2571, 2571, 2571, 2574, 2574,
-     2574, 2574, 2574, 2574, 2574, 2574,    0,    0,    0,    0,
-        0,    0,    0, 2567, 2567, 2567, 2567, 2567, 2567, 2570,
-     2570, 2570, 2570, 2570, 2570, 2570, 2570, 2570,    0,    0,
-        0,    0,    0,    0,    0, 2570, 2570, 2570, 2570, 2570,
-     2570, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2577, 2580,
-     2580, 2580, 2580, 2580, 2580, 2580, 2580,    0,    0,    0,
-        0,    0,    0,    0, 2570, 2570, 2570, 2570, 2570, 2570,
-     2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573,    0,
-        0,    0,    0,    0,    0,    0, 2573, 2573, 2573, 2573,
-
-     2573, 2573, 2583, 2583, 2583, 2583, 2583, 2583, 2583, 2583,
-     2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585, 2585,    0,
-        0,    0,    0,    0,    0, 2573, 2573, 2573, 2573, 2573,
-     2573, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576,
-        0,    0,    0,    0,    0,    0,    0, 2576, 2576, 2576,
-     2576, 2576, 2576, 2586, 2586, 2586, 2586, 2586, 2586, 2586,
-     2586, 2586, 2587, 2587, 2587, 2587, 2587, 2587, 2587, 2587,
-     2587,    0,    0,    0,    0,    0, 2576, 2576, 2576, 2576,
-     2576, 2576, 2579, 2579, 2579, 2579, 2579, 2579, 2579, 2579,
-     2579,    0,    0,    0,    0,    0,    0,    0, 2579, 2579,
-
-     2579, 2579, 2579, 2579, 2588, 2588, 2588, 2588, 2588, 2588,
-     2588, 2588, 2588, 2589, 2589, 2589, 2589, 2589, 2589, 2589,
-     2589,    0,    0,    0,    0,    0,    0, 2579, 2579, 2579,
-     2579, 2579, 2579, 2582, 2582, 2582, 2582, 2582, 2582, 2582,
-     2582, 2582,    0,    0,    0,    0,    0, 2609,    0, 2582,
-     2582, 2582, 2582, 2582, 2582, 2590, 2609, 2590, 2590, 2590,
-     2590, 2590, 2590, 2590, 2590, 2591,    0, 2591, 2591, 2591,
-     2591, 2591, 2591, 2591, 2591,    0, 2609,    0, 2582, 2582,
-     2582, 2582, 2582, 2582, 2592, 2609, 2592, 2592, 2592, 2592,
-     2592, 2592, 2593, 2593, 2593, 2593, 2593, 2593, 2593, 2593,
-
-     2594,    0, 2594, 2594, 2594, 2594, 2594, 2594, 2594, 2594,
-     2595,    0, 2595, 2595, 2595, 2595, 2595, 2595, 2595, 2595,
-     2596,    0, 2596, 2596, 2596, 2596, 2596, 2596, 2597, 2597,
-     2597, 2597, 2597, 2597, 2597, 2597, 2597, 2597, 2598, 2598,
-     2598, 2598, 2598, 2598, 2598, 2598, 2598, 2598, 2599, 2599,
-     2599, 2599, 2599, 2599, 2599, 2599, 2599, 2599, 2600, 2600,
-     2600, 2600, 2600, 2600, 2600, 2600, 2600,    0,    0,    0,
-        0,    0,    0,    0, 2600, 2600, 2600, 2600, 2600, 2600,
-     2601, 2601, 2601, 2601, 2601, 2601, 2601, 2601, 2614,    0,
-     2614, 2614, 2614, 2614, 2614, 2614, 2614, 2614,    0,    0,
-
-        0,    0,    0, 2600, 2600, 2600, 2600, 2600, 2600, 2615,
-        0, 2615, 2615, 2615, 2615, 2615, 2615, 2615, 2615, 2616,
-        0, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2616, 2617,
-     2617, 2617, 2617, 2617, 2617, 2617, 2617, 2617,    0,    0,
-        0,    0,    0,    0,    0, 2617, 2617, 2617, 2617, 2617,
-     2617, 2618, 2618, 2618, 2618, 2618, 2618, 2618, 2618, 2620,
-     2620, 2620, 2620, 2620, 2620, 2620, 2620, 2620,    0,    0,
-        0,    0,    0,    0, 2617, 2617, 2617, 2617, 2617, 2617,
-     2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2622,
-     2622, 2622, 2622, 2622, 2622, 2622, 2622, 2622, 2623, 2623,
-
-     2623, 2623, 2623, 2623, 2623, 2623, 2623, 2624, 2624, 2624,
-     2624, 2624, 2624, 2624, 2624, 2624, 2625, 2625, 2625, 2625,
-     2625, 2625, 2625, 2625, 2625, 2626, 2626, 2626, 2626, 2626,
-     2626, 2626, 2626, 2626, 2627, 2627, 2627, 2627, 2627, 2627,
-     2627, 2627, 2627, 2628, 2628, 2628, 2628, 2628, 2628, 2628,
-     2628, 2628, 2629, 2629, 2629, 2629, 2629, 2629, 2629, 2629,
-     2629, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630, 2630,
-     2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2631, 2632,
-     2632, 2632, 2632, 2632, 2632, 2632, 2632, 2632, 2633, 2633,
-     2633, 2633, 2633, 2633, 2633, 2633, 2633, 2634, 2634, 2634,
-
-     2634, 2634, 2634, 2634, 2634, 2634, 2635, 2635, 2635, 2635,
-     2635, 2635, 2635, 2635, 2635, 2636, 2636, 2636, 2636, 2636,
-     2636, 2636, 2636, 2636, 2637, 2637, 2637, 2637, 2637, 2637,
-     2637, 2637, 2637, 2638, 2638, 2638, 2638, 2638, 2638, 2638,
-     2638, 2638, 2639, 2639, 2639, 2639, 2639, 2639, 2639, 2639,
-     2639, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640, 2640,
-     2641, 2641, 2641, 2641, 2641, 2641, 2641, 2641, 2641, 2642,
-     2642, 2642, 2642, 2642, 2642, 2642, 2642, 2642, 2644,    0,
-     2644, 2644, 2644, 2644, 2644, 2644, 2644, 2644, 2645,    0,
-     2645, 2645, 2645, 2645, 2645, 2645, 2645, 2645, 2646,    0,
-
-     2646, 2646, 2646, 2646, 2646, 2646, 2646, 2646, 2647, 2647,
-     2647, 2647, 2647, 2647, 2647, 2647, 2647,    0,    0,    0,
-        0,    0,    0,    0, 2647, 2647, 2647, 2647, 2647, 2647,
-     2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2650,    0,
-        0,    0,    0,    0,    0, 2659, 2650, 2659, 2659, 2659,
-     2659, 2659, 2659, 2647, 2647, 2647, 2647, 2647, 2647, 2656,
-     2656, 2656, 2656, 2656, 2656, 2656, 2656, 2650,    0,    0,
-        0,    0,    0,    0, 2657, 2650, 2657, 2657, 2657, 2657,
-     2657, 2657, 2657, 2657, 2658,    0, 2658, 2658, 2658, 2658,
-     2658, 2658, 2658, 2658, 2660, 2660, 2660, 2660, 2660, 2660,
-
-     2660, 2660, 2660, 2661, 2661, 2661, 2661, 2661, 2661, 2661,
-     2661, 2661, 2662, 2662, 2662, 2662, 2662, 2662, 2662, 2662,
-     2662, 2663, 2663, 2663, 2663, 2663, 2663, 2663, 2663, 2663,
-     2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2665,
-     2665, 2665, 2665, 2665, 2665, 2665, 2665, 2665, 2666, 2666,
-     2666, 2666, 2666, 2666, 2666, 2666, 2667,    0, 2667, 2667,
-     2667, 2667, 2667, 2667, 2667, 2667, 2668,    0, 2668, 2668,
-     2668, 2668, 2668, 2668, 2668, 2668, 2669,    0, 2669, 2669,
-     2669, 2669, 2669, 2669, 2670, 2670, 2670, 2670, 2670, 2670,
-     2670, 2670, 2670, 2671, 2671, 2671, 2671, 2671, 2671, 2671,
-
-     2671, 2671, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672,
-     2672, 2673, 2675, 2675, 2675, 2675, 2675, 2675, 2675, 2675,
-     2675,    0, 2673, 2676, 2676, 2676, 2676, 2676, 2676, 2676,
-     2676, 2676,    0,    0,    0,    0,    0,    0,    0,    0,
-     2673, 2677, 2677, 2677, 2677, 2677, 2677, 2677, 2677, 2677,
-        0, 2673, 2678, 2678, 2678, 2678, 2678, 2678, 2678, 2678,
-     2678, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679, 2679,
-     2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2680, 2681,
-     2681, 2681, 2681, 2681, 2681, 2681, 2681, 2681, 2682, 2682,
-     2682, 2682, 2682, 2682, 2682, 2682, 2682, 2683, 2683, 2683,
-
-     2683, 2683, 2683, 2683, 2683, 2683, 2686, 2686, 2686, 2686,
-     2686, 2686, 2686, 2686, 2686, 2687, 2687, 2687, 2687, 2687,
-     2687, 2687, 2687, 2687, 2688, 2688, 2688, 2688, 2688, 2688,
-     2688, 2688, 2688, 2689, 2689, 2689, 2689, 2689, 2689, 2689,
-     2689, 2689, 2690, 2690, 2690, 2690, 2690, 2690, 2690, 2690,
-     2690, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691, 2691,
-     2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2692, 2693,
-     2693, 2693, 2693, 2693, 2693, 2693, 2693, 2693, 2696, 2696,
-     2696, 2696, 2696, 2696, 2696, 2696, 2696, 2697, 2697, 2697,
-     2697, 2697, 2697, 2697, 2697, 2697, 2703, 2703, 2703, 2703,
-
-     2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703,
-     2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703, 2703,
-     2703, 2703, 2703, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704, 2704,
-     2705, 2705, 2705, 2705, 2705, 2705, 2705, 2705, 2705, 2705,
-     2705, 2705, 2705, 2705, 2705, 2705, 2705, 2705, 2705, 2705,
-     2705, 2705, 2705, 2705, 2705, 2705, 2705, 2706, 2706, 2706,
-     2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706,
-     2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706, 2706,
-
-     2706, 2706, 2706, 2706, 2707, 2707, 2707, 2707, 2707, 2707,
-     2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707,
-     2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707, 2707,
-     2707, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708,
-     2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708,
-     2708, 2708, 2708, 2708, 2708, 2708, 2708, 2708, 2709, 2709,
-     2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709,
-     2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709, 2709,
-     2709, 2709, 2709, 2709, 2709, 2710, 2710, 2710, 2710, 2710,
-     2710, 2710, 2710, 2710, 2710, 2710, 2710, 2710, 2710, 2710,
-
-     2710, 2710, 2710, 2710, 2710, 2710, 2710, 2710, 2710, 2710,
-     2710, 2710, 2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711,
-     2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711,
-     2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711, 2711, 2712,
-     2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712,
-     2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712,
-     2712, 2712, 2712, 2712, 2712, 2712, 2713, 2713, 2713, 2713,
-     2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713,
-     2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713, 2713,
-     2713, 2713, 2713, 2714, 2714,    0,    0,    0, 2714,    0,
-
-     2714, 2714, 2714,    0, 2714, 2714, 2714, 2714, 2714, 2714,
-     2714, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715,
-     2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715,
-     2715, 2715, 2715, 2715, 2715, 2715, 2715, 2715, 2716, 2716,
-        0,    0,    0, 2716,    0, 2716, 2716, 2716,    0, 2716,
-     2716, 2716, 2716, 2716, 2716, 2716, 2717,    0,    0, 2717,
-        0, 2717,    0, 2717, 2717, 2717, 2717, 2717, 2717, 2717,
-     2717, 2717, 2717, 2717, 2717, 2717, 2717, 2717, 2717, 2717,
-     2717, 2717, 2717, 2718, 2718, 2718, 2718, 2718, 2718, 2718,
-     2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718,
-
-     2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718, 2718,
-     2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719,
-     2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719, 2719,
-     2719, 2719, 2719, 2719, 2719, 2719, 2719, 2720, 2720,    0,
-     2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720,
-     2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720, 2720,
-     2721, 2721,    0,    0,    0, 2721,    0, 2721, 2721, 2721,
-        0, 2721, 2721,    0, 2721, 2721, 2721, 2721, 2722, 2722,
-        0, 2722, 2722, 2722, 2722, 2722, 2722, 2722, 2722, 2722,
-     2722, 2722, 2722, 2722, 2722, 2722, 2722, 2722, 2722, 2722,
-
-     2722, 2723, 2723,    0, 2723, 2723, 2723, 2723, 2723, 2723,
-     2723, 2723, 2723, 2723, 2723, 2723, 2723, 2723, 2723, 2723,
-     2723, 2723, 2723, 2723, 2724, 2724,    0,    0,    0, 2724,
-        0, 2724, 2724, 2724,    0, 2724, 2724,    0, 2724, 2724,
-     2724, 2724, 2725, 2725,    0, 2725, 2725, 2725, 2725, 2725,
-     2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725, 2725,
-     2725, 2725, 2725, 2725, 2725, 2726, 2726, 2726, 2726,    0,
-     2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726, 2726,
-     2726, 2726, 2726, 2726, 2726,    0, 2726, 2726, 2726, 2726,
-     2726, 2726, 2727, 2727, 2727, 2727,    0, 2727, 2727, 2727,
-
-     2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727,
-     2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2728,
-     2728, 2728, 2728,    0, 2728, 2728, 2728, 2728, 2728, 2728,
-     2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728,    0,
-     2728, 2728, 2728, 2728, 2728, 2728, 2729, 2729, 2729, 2729,
-        0, 2729, 2729, 2729, 2729, 2729, 2729, 2729, 2729, 2729,
-     2729, 2729, 2729, 2729, 2729, 2729, 2729, 2729, 2729, 2729,
-     2729, 2729, 2729, 2730, 2730, 2730, 2730,    0, 2730, 2730,
-     2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730, 2730,
-     2730, 2730, 2730,    0, 2730, 2730, 2730, 2730, 2730, 2730,
-
-     2731, 2731, 2731, 2731,    0, 2731, 2731, 2731, 2731, 2731,
-     2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731, 2731,
-     2731, 2731, 2731, 2731, 2731, 2731, 2731, 2732, 2732, 2732,
-     2732,    0, 2732, 2732, 2732, 2732, 2732, 2732, 2732, 2732,
-     2732, 2732, 2732, 2732, 2732, 2732, 2732,    0, 2732, 2732,
-     2732, 2732, 2732, 2732, 2733, 2733, 2733, 2733, 2733, 2733,
-     2733, 2733, 2733, 2733, 2733, 2733, 2733, 2733,    0, 2733,
-        0, 2733, 2733, 2734, 2734, 2734, 2734, 2734, 2734, 2734,
-     2734, 2734, 2734, 2734, 2734, 2734, 2734,    0, 2734, 2734,
-     2734, 2734, 2735, 2735, 2735, 2735, 2735, 2735, 2735, 2735,
-
-     2735, 2735, 2735, 2735,    0, 2735, 2735, 2735, 2735, 2736,
-     2736,    0,    0,    0, 2736,    0, 2736, 2736, 2736,    0,
-     2736, 2736,    0, 2736, 2736, 2736, 2736, 2737, 2737,    0,
-        0,    0, 2737,    0, 2737, 2737, 2737,    0, 2737, 2737,
-        0, 2737, 2737, 2737, 2737, 2738, 2738,    0,    0,    0,
-     2738,    0, 2738, 2738, 2738,    0, 2738, 2738,    0, 2738,
-     2738, 2738, 2738, 2739,    0, 2739, 2739,    0,    0,    0,
-        0,    0,    0,    0, 2739, 2739,    0,    0, 2739, 2740,
-        0,    0,    0, 2740, 2740, 2740, 2740, 2740, 2740, 2740,
-     2740, 2740,    0, 2740, 2740, 2740, 2740, 2740, 2740, 2740,
-
-     2740, 2740,    0,    0, 2740, 2740, 2741, 2741,    0, 2741,
-     2741, 2741, 2741, 2741, 2741, 2741, 2741, 2741, 2741,    0,
-     2741, 2741, 2741,    0, 2741, 2741, 2741, 2741, 2741, 2741,
-        0, 2741, 2741, 2742,    0,    0,    0,    0, 2742, 2742,
-     2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742,
-     2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742, 2742,
-     2743, 2743,    0,    0, 2743, 2743, 2743, 2743, 2743, 2743,
-     2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743, 2743,
-     2743, 2743, 2743, 2743, 2743, 2743, 2743, 2744, 2744,    0,
-        0, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744,
-
-     2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744, 2744,
-     2744, 2744, 2744, 2744, 2745, 2745, 2745, 2745, 2745, 2745,
-     2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745,
-     2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745, 2745,
-     2745, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746,
-     2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746,
-     2746, 2746, 2746, 2746, 2746, 2746, 2746, 2746, 2747, 2747,
-     2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747,
-     2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747, 2747,
-     2747, 2747, 2747, 2747, 2747, 2748, 2748, 2748, 2748, 2748,
-
-     2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748,
-     2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748, 2748,
-     2748, 2748, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749,
-     2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749,
-     2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2749, 2750,
-     2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750,
-     2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750, 2750,
-     2750, 2750, 2750, 2750, 2750, 2750, 2751, 2751,    0,    0,
-        0, 2751,    0, 2751, 2751, 2751,    0, 2751, 2751, 2751,
-     2751, 2751, 2751, 2751, 2752, 2752,    0,    0,    0, 2752,
-
-        0, 2752, 2752, 2752,    0, 2752, 2752, 2752, 2752, 2752,
-     2752, 2752, 2753, 2753,    0,    0,    0, 2753,    0, 2753,
-     2753, 2753,    0, 2753, 2753,    0, 2753, 2753, 2753, 2753,
-     2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754,
-     2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754, 2754,
-     2754, 2754, 2754, 2754, 2754, 2754, 2754, 2755, 2755, 2755,
-     2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755,
-     2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755, 2755,
-     2755, 2755, 2755, 2755, 2756, 2756,    0,    0,    0, 2756,
-        0, 2756, 2756, 2756,    0, 2756, 2756, 2756, 2756, 2756,
-
-     2756, 2756, 2757, 2757,    0,    0,    0, 2757,    0, 2757,
-     2757, 2757,    0, 2757, 2757, 2757, 2757, 2757, 2757, 2757,
-     2758, 2758,    0,    0,    0, 2758,    0, 2758, 2758, 2758,
-        0, 2758, 2758, 2758, 2758, 2758, 2758, 2758, 2759, 2759,
-        0,    0,    0, 2759,    0, 2759, 2759, 2759,    0, 2759,
-     2759, 2759, 2759, 2759, 2759, 2759, 2761,    0,    0, 2761,
-        0, 2761,    0, 2761, 2761, 2761, 2761, 2761, 2761, 2761,
-     2761, 2761, 2761, 2761, 2761, 2761, 2761, 2761, 2761, 2761,
-     2761, 2761, 2761, 2762, 2762, 2762, 2762, 2762, 2762, 2762,
-     2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762,
-
-     2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762, 2762,
-     2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763,
-     2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763, 2763,
-     2763, 2763, 2763, 2763, 2763, 2763, 2763, 2764, 2764, 2764,
-     2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764,
-     2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764, 2764,
-     2764, 2764, 2764, 2764, 2765, 2765, 2765, 2765, 2765, 2765,
-     2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765, 2765,
-     2765, 2765, 2765, 2765, 2765, 2765, 2765, 2766, 2766,    0,
-        0,    0, 2766,    0, 2766, 2766, 2766,    0, 2766, 2766,
-
-        0, 2766, 2766, 2766, 2766, 2767, 2767,    0, 2767, 2767,
-     2767, 2767, 2767, 2767, 2767, 2767, 2767, 2767, 2767, 2767,
-     2767, 2767, 2767, 2767, 2767, 2767, 2767, 2767, 2768, 2768,
-     2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768,
-     2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768,
-     2768, 2769, 2769,    0,    0,    0, 2769,    0, 2769, 2769,
-     2769,    0, 2769, 2769,    0, 2769, 2769, 2769, 2769, 2770,
-     2770,    0, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770,
-     2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770, 2770,
-     2770, 2770, 2771, 2771, 2771, 2771,    0, 2771, 2771, 2771,
-
-     2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771, 2771,
-     2771, 2771,    0, 2771, 2771, 2771, 2771, 2771, 2771, 2772,
-     2772, 2772, 2772,    0, 2772, 2772, 2772, 2772, 2772, 2772,
-     2772, 2772, 2772, 2772, 2772, 2772,    0, 2772, 2772,    0,
-     2772, 2772, 2772, 2772, 2772, 2772, 2773, 2773, 2773, 2773,
-        0, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773,
-     2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773, 2773,
-     2773, 2773, 2773, 2774, 2774, 2774, 2774,    0, 2774, 2774,
-     2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774,
-     2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774, 2774,
-
-     2775, 2775,    0,    0,    0, 2775, 2775, 2775, 2775, 2775,
-     2775, 2775, 2775, 2775, 2775, 2775, 2775, 2775, 2775, 2775,
-     2775, 2775, 2775, 2775, 2775, 2775, 2775, 2776, 2776, 2776,
-     2776,    0, 2776, 2776, 2776, 2776, 2776, 2776, 2776, 2776,
-     2776, 2776, 2776, 2776, 2776, 2776, 2776,    0, 2776, 2776,
-     2776, 2776, 2776, 2776, 2777, 2777, 2777, 2777,    0, 2777,
-     2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777, 2777,
-     2777, 2777, 2777, 2777,    0, 2777, 2777, 2777, 2777, 2777,
-     2777, 2778, 2778, 2778, 2778,    0, 2778, 2778, 2778, 2778,
-     2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778,
-
-     2778, 2778, 2778, 2778, 2778, 2778, 2778, 2778, 2779, 2779,
-     2779, 2779,    0, 2779, 2779, 2779, 2779, 2779, 2779, 2779,
-     2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779, 2779,
-     2779, 2779, 2779, 2779, 2779, 2780, 2780,    0,    0,    0,
-     2780, 2780,    0, 2780, 2780, 2780, 2780, 2780, 2780, 2780,
-     2780, 2780, 2780, 2780,    0, 2780, 2780, 2780, 2780, 2780,
-     2780, 2780, 2781, 2781, 2781, 2781,    0, 2781, 2781, 2781,
-     2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781,
-     2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2781, 2782,
-     2782, 2782, 2782,    0, 2782, 2782, 2782, 2782, 2782, 2782,
-
-     2782, 2782, 2782, 2782, 2782, 2782, 2782, 2782, 2782, 2782,
-     2782, 2782, 2782, 2782, 2782, 2782, 2783, 2783, 2783, 2783,
-        0, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783,
-     2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783, 2783,
-     2783, 2783, 2783, 2784, 2784,    0,    0,    0, 2784, 2784,
-        0, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784,
-     2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784,
-     2785, 2785, 2785, 2785,    0, 2785, 2785, 2785, 2785, 2785,
-     2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785, 2785,
-        0, 2785, 2785, 2785, 2785, 2785, 2785, 2786, 2786, 2786,
-
-     2786,    0, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786,
-     2786, 2786, 2786, 2786, 2786, 2786, 2786,    0, 2786, 2786,
-     2786, 2786, 2786, 2786, 2787, 2787, 2787, 2787, 2787, 2787,
-     2787, 2787, 2787, 2787, 2787, 2787, 2787, 2787,    0, 2787,
-        0, 2787, 2787, 2788, 2788, 2788, 2788, 2788, 2788, 2788,
-     2788, 2788, 2788, 2788, 2788, 2788, 2788,    0, 2788, 2788,
-     2788, 2788, 2789, 2789, 2789, 2789, 2789, 2789, 2789, 2789,
-     2789, 2789, 2789, 2789,    0, 2789, 2789, 2789, 2789, 2790,
-     2790, 2790,    0,    0,    0, 2790,    0, 2790, 2790, 2790,
-        0, 2790, 2790,    0, 2790, 2790, 2790, 2790, 2791, 2791,
-
-        0,    0,    0, 2791,    0, 2791, 2791, 2791,    0, 2791,
-     2791,    0, 2791, 2791, 2791, 2791, 2792, 2792,    0, 2792,
-        0, 2792,    0, 2792, 2792, 2792,    0, 2792, 2792,    0,
-     2792, 2792, 2792, 2792, 2793,    0, 2793, 2793,    0,    0,
-        0,    0,    0,    0,    0, 2793, 2793,    0,    0, 2793,
-     2794,    0,    0,    0, 2794, 2794, 2794, 2794, 2794, 2794,
-     2794, 2794, 2794,    0, 2794, 2794, 2794, 2794, 2794, 2794,
-     2794, 2794, 2794,    0,    0, 2794, 2794, 2795, 2795,    0,
-        0, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795, 2795,
-        0, 2795, 2795, 2795,    0, 2795, 2795, 2795, 2795, 2795,
-
-     2795,    0, 2795, 2795, 2796, 2796, 2796, 2796, 2796, 2796,
-     2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796,
-     2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796, 2796,
-     2796, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797,
-     2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797,
-     2797, 2797, 2797, 2797, 2797, 2797, 2797, 2797, 2798,    0,
-        0,    0,    0, 2798, 2798, 2798, 2798, 2798, 2798, 2798,
-     2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798, 2798,
-     2798, 2798, 2798, 2798, 2798, 2799, 2799,    0,    0, 2799,
-     2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799,
-
-     2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799, 2799,
-     2799, 2799, 2800, 2800,    0,    0, 2800, 2800, 2800, 2800,
-     2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800,
-     2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2800, 2801,
-     2801,    0,    0, 2801, 2801, 2801, 2801, 2801, 2801, 2801,
-     2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801, 2801,
-     2801, 2801, 2801, 2801, 2801, 2801, 2802, 2802,    0,    0,
-     2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802,
-     2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802, 2802,
-     2802, 2802, 2802, 2803, 2803, 2803, 2803, 2803, 2803, 2803,
-
-     2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803,
-     2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803, 2803,
-     2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804,
-     2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804, 2804,
-     2804, 2804, 2804, 2804, 2804, 2804, 2804, 2805, 2805, 2805,
-     2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805,
-     2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805, 2805,
-     2805, 2805, 2805, 2805, 2806, 2806, 2806, 2806, 2806, 2806,
-     2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806,
-     2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806, 2806,
-
-     2806, 2807, 2807,    0,    0,    0, 2807,    0, 2807, 2807,
-     2807,    0, 2807, 2807, 2807, 2807, 2807, 2807, 2807, 2808,
-     2808,    0,    0,    0, 2808,    0, 2808, 2808, 2808,    0,
-     2808, 2808,    0, 2808, 2808, 2808, 2808, 2809, 2809, 2809,
-     2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809,
-     2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809, 2809,
-     2809, 2809, 2809, 2809, 2810, 2810,    0,    0,    0, 2810,
-        0, 2810, 2810, 2810,    0, 2810, 2810, 2810, 2810, 2810,
-     2810, 2810, 2811, 2811,    0,    0,    0, 2811,    0, 2811,
-     2811, 2811,    0, 2811, 2811, 2811, 2811, 2811, 2811, 2811,
-
-     2812, 2812,    0,    0,    0, 2812,    0, 2812, 2812, 2812,
-        0, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2814, 2814,
-        0,    0,    0, 2814,    0, 2814, 2814, 2814,    0, 2814,
-     2814, 2814, 2814, 2814, 2814, 2814, 2815, 2815,    0, 2815,
-     2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815,
-     2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2816,
-     2816,    0, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-     2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-     2816, 2816, 2817, 2817, 2817, 2817,    0, 2817, 2817, 2817,
-     2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817,    0,
-
-     2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2818,
-     2818, 2818, 2818,    0, 2818, 2818, 2818, 2818, 2818, 2818,
-     2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818,
-     2818, 2818, 2818, 2818, 2818, 2818, 2819, 2819, 2819, 2819,
-        0, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819,
-     2819, 2819, 2819, 2819, 2819, 2819,    0, 2819, 2819, 2819,
-     2819, 2819, 2819, 2820, 2820, 2820, 2820,    0, 2820, 2820,
-     2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820,
-     2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820,
-     2821, 2821, 2821, 2821,    0, 2821, 2821, 2821, 2821, 2821,
-
-     2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821,
-     2821, 2821, 2821, 2821, 2821, 2821, 2821, 2822, 2822, 2822,
-     2822,    0, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822,
-     2822, 2822, 2822, 2822, 2822, 2822, 2822,    0, 2822, 2822,
-     2822, 2822, 2822, 2822, 2823, 2823, 2823, 2823,    0, 2823,
-     2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823,
-     2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823,
-     2823, 2824,    0,    0,    0,    0, 2824,    0, 2824, 2824,
-        0,    0,    0, 2824, 2824,    0, 2824, 2825,    0, 2825,
-     2825,    0,    0,    0,    0,    0,    0,    0, 2825, 2825,
-
-        0,    0, 2825, 2826, 2826, 2826, 2826, 2826, 2826,    0,
-     2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826,
-     2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826,
-     2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827,
-        0, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827,
-     2827, 2827, 2827, 2827, 2827, 2827, 2827, 2828, 2828, 2828,
-     2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828,
-     2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828,
-     2828, 2828, 2828, 2828, 2829, 2829, 2829, 2829, 2829, 2829,
-     2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829,
-
-     2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829,
-     2829, 2830,    0,    0,    0,    0, 2830, 2830, 2830, 2830,
-     2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830,
-     2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2831, 2831,
-        0,    0,    0, 2831,    0, 2831, 2831, 2831,    0, 2831,
-     2831, 2831, 2831, 2831, 2831, 2831, 2832, 2832,    0,    0,
-        0, 2832,    0, 2832, 2832, 2832,    0, 2832, 2832, 2832,
-     2832, 2832, 2832, 2832, 2836, 2836,    0,    0,    0, 2836,
-        0, 2836, 2836, 2836,    0, 2836, 2836, 2836, 2836, 2836,
-     2836, 2836, 2837, 2837,    0,    0,    0, 2837, 2837, 2837,
-
-     2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837,
-     2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2838,
-     2838,    0,    0,    0, 2838, 2838,    0, 2838, 2838, 2838,
-     2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838,    0, 2838,
-     2838, 2838, 2838, 2838, 2838, 2838, 2839, 2839,    0,    0,
-        0, 2839, 2839,    0, 2839, 2839, 2839, 2839, 2839, 2839,
-     2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839,
-     2839, 2839, 2839, 2840,    0, 2840, 2840,    0,    0,    0,
-        0,    0,    0,    0, 2840, 2840,    0,    0, 2840, 2844,
-        0, 2844, 2844,    0,    0,    0,    0,    0,    0,    0,
-
-     2844, 2844,    0,    0, 2844, 2848, 2848,    0,    0,    0,
-     2848,    0, 2848, 2848, 2848,    0, 2848, 2848, 2848, 2848,
-     2848, 2848, 2848, 2849,    0, 2849, 2849,    0,    0,    0,
-        0,    0,    0,    0, 2849, 2849,    0,    0, 2849, 2850,
-     2850,    0,    0,    0, 2850,    0, 2850, 2850, 2850,    0,
-     2850, 2850, 2850, 2850, 2850, 2850, 2850, 2851, 2851,    0,
-        0,    0, 2851,    0, 2851, 2851, 2851,    0, 2851, 2851,
-     2851, 2851, 2851, 2851, 2851, 2856,    0, 2856, 2856,    0,
-        0,    0,    0,    0,    0,    0, 2856, 2856,    0,    0,
-     2856, 2860, 2860,    0,    0,    0, 2860,    0, 2860, 2860,
-
-     2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2861,
-     2861,    0,    0,    0, 2861,    0, 2861, 2861, 2861,    0,
-     2861, 2861, 2861, 2861, 2861, 2861, 2861, 2862, 2862, 2862,
-     2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862,
-     2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862,
-     2862, 2862, 2862, 2863, 2863,    0, 2863, 2863, 2863, 2863,
-     2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863,
-     2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2864,
-        0, 2864, 2864,    0,    0,    0,    0,    0,    0,    0,
-     2864, 2864,    0,    0, 2864, 2865, 2865,    0,    0,    0,
-
-     2865,    0, 2865, 2865, 2865,    0, 2865, 2865, 2865, 2865,
-     2865, 2865, 2865, 2871, 2871,    0,    0,    0, 2871,    0,
-     2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871, 2871,
-     2871, 2872, 2872,    0,    0,    0, 2872,    0, 2872, 2872,
-     2872,    0, 2872, 2872, 2872, 2872, 2872, 2872, 2872, 2873,
-     2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873,
-     2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873, 2873,
-     2873, 2873, 2873, 2873, 2873, 2874, 2874,    0, 2874, 2874,
-     2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874,
-     2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874, 2874,
-
-     2874, 2875,    0, 2875, 2875,    0,    0,    0,    0,    0,
-        0,    0, 2875, 2875,    0,    0, 2875, 2879, 2879,    0,
-        0,    0, 2879,    0, 2879, 2879, 2879, 2879, 2879, 2879,
-     2879, 2879, 2879, 2879, 2879, 2880, 2880,    0,    0,    0,
-     2880,    0, 2880, 2880, 2880,    0, 2880, 2880, 2880, 2880,
-     2880, 2880, 2880, 2881, 2881, 2881, 2881, 2881, 2881, 2881,
-     2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881,
-     2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2881, 2882,
-     2882,    0, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882,
-     2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882, 2882,
-
-     2882, 2882, 2882, 2882, 2882, 2883,    0, 2883, 2883,    0,
-     2883,    0,    0,    0, 2883,    0, 2883, 2883,    0,    0,
-     2883, 2890, 2890,    0,    0,    0, 2890,    0, 2890, 2890,
-     2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2890, 2891,
-     2891,    0,    0,    0, 2891,    0, 2891, 2891, 2891,    0,
-     2891, 2891, 2891, 2891, 2891, 2891, 2891, 2894, 2894,    0,
-        0,    0, 2894,    0, 2894, 2894, 2894, 2894, 2894, 2894,
-     2894, 2894, 2894, 2894, 2894, 2895, 2895,    0,    0,    0,
-     2895,    0, 2895, 2895, 2895,    0, 2895, 2895, 2895, 2895,
-     2895, 2895, 2895, 2903, 2903,    0,    0,    0, 2903,    0,
-
-     2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903, 2903,
-     2903, 2904, 2904,    0,    0,    0, 2904,    0, 2904, 2904,
-     2904,    0, 2904, 2904, 2904, 2904, 2904, 2904, 2904, 2908,
-     2908,    0,    0,    0, 2908,    0, 2908, 2908, 2908, 2908,
-     2908, 2908, 2908, 2908, 2908, 2908, 2908, 2909, 2909,    0,
-        0,    0, 2909,    0, 2909, 2909, 2909,    0, 2909, 2909,
-     2909, 2909, 2909, 2909, 2909, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702, 2702,
-     2702, 2702, 2702, 2702, 2702, 2702
-    } ;
-
-extern int yy_flex_debug;
-int yy_flex_debug = 0;
-
-static yy_state_type *yy_state_buf=0, *yy_state_ptr=0;
-static char *yy_full_match;
-static int yy_lp;
-static int yy_looking_for_trail_begin = 0;
-static int yy_full_lp;
-static int *yy_full_state;
-#define YY_TRAILING_MASK 0x2000
-#define YY_TRAILING_HEAD_MASK 0x4000
-#define REJECT \
-{ \
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */ \
-yy_cp = (yy_full_match); /* restore poss. backed-over text */ \
-(yy_lp) = (yy_full_lp); /* restore orig. accepting pos. */ \
-(yy_state_ptr) = (yy_full_state); /* restore orig. state */ \
-yy_current_state = *(yy_state_ptr); /* restore curr. state */ \
-++(yy_lp); \
-goto find_rule; \
-}
-
-#define yymore() yymore_used_but_not_detected
-#define YY_MORE_ADJ 0
-#define YY_RESTORE_YY_MORE_OFFSET
-char *yytext;
-#line 1 "src/l.l"
-/*
- * Copyright (C) Tildeslash Ltd. All rights reserved.
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU Affero General Public License version 3.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU Affero General Public License
- * along with this program.  If not, see <http://www.gnu.org/licenses/>.
- *
- * In addition, as a special exception, the copyright holders give
- * permission to link the code of portions of this program with the
- * OpenSSL library under certain conditions as described in each
- * individual source file, and distribute linked combinations
- * including the two.
- *
- * You must obey the GNU Affero General Public License in all respects
- * for all of the code used other than OpenSSL.
- */
-#line 30 "src/l.l"
-
-/*
- * DESCRIPTION
- *
- *   Lexical grammar for tokenizing the control file.
- *
- */
-
-#include "config.h"
-
-#ifdef HAVE_STRING_H
-#include <string.h>
-#endif
-
-#ifdef HAVE_GLOB_H
-#include <glob.h>
-#endif
-
-#ifdef HAVE_STRINGS_H
-#include <strings.h>
-#endif
-
-#include "monit.h"
-#include "y.tab.h"
-
-// libmonit
-#include "util/Str.h"
-
-
-// we don't use yyinput => do not generate it
-#define YY_NO_INPUT
-
-#define MAX_STACK_DEPTH 512
-
-int buffer_stack_ptr = 0;
-
-struct buffer_stack_s {
-        int             lineno;
-        char           *currentfile;
-        YY_BUFFER_STATE buffer;
-} buffer_stack[MAX_STACK_DEPTH];
-
-int lineno = 1;
-int arglineno = 1;
-char *currentfile = NULL;
-char *argcurrentfile = NULL;
-char *argyytext = NULL;
-typedef enum {
-        Proc_State,
-        File_State,
-        FileSys_State,
-        Dir_State,
-        Host_State,
-        System_State,
-        Fifo_State,
-        Program_State,
-        Net_State,
-        None_State
-} __attribute__((__packed__)) Check_State;
-
-static Check_State check_state = None_State;
-
-/* Prototypes */
-extern void yyerror(const char *,...);
-extern void yyerror2(const char *,...);
-extern void yywarning(const char *,...);
-extern void yywarning2(const char *,...);
-static void steplinenobycr(char *);
-static void save_arg(void);
-static void include_file(char *);
-static char *handle_quoted_string(char *);
-static void push_buffer_state(YY_BUFFER_STATE, char*);
-static int  pop_buffer_state(void);
-static URL_T create_URL(char *proto);
-
-#line 6075 "src/lex.yy.c"
-
-#line 6077 "src/lex.yy.c"
-
-#define INITIAL 0
-#define ARGUMENT_COND 1
-#define DEPEND_COND 2
-#define SERVICE_COND 3
-#define URL_COND 4
-#define ADDRESS_COND 5
-#define STRING_COND 6
-#define EVERY_COND 7
-#define HTTP_HEADER_COND 8
-#define INCLUDE 9
-
-#ifndef YY_NO_UNISTD_H
-/* Special case for "unistd.h", since it is non-ANSI. We include it way
- * down here because we want the user's section 1 to have been scanned first.
- * The user has a chance to override it with an option.
- */
-#include <unistd.h>
-#endif
-
-#ifndef YY_EXTRA_TYPE
-#define YY_EXTRA_TYPE void *
-#endif
-
-static int yy_init_globals ( void );
-
-/* Accessor methods to globals.
-   These are made visible to non-reentrant scanners for convenience. */
-
-int yylex_destroy ( void );
-
-int yyget_debug ( void );
-
-void yyset_debug ( int debug_flag  );
-
-YY_EXTRA_TYPE yyget_extra ( void );
-
-void yyset_extra ( YY_EXTRA_TYPE user_defined  );
-
-FILE *yyget_in ( void );
-
-void yyset_in  ( FILE * _in_str  );
-
-FILE *yyget_out ( void );
-
-void yyset_out  ( FILE * _out_str  );
-
-			int yyget_leng ( void );
-
-char *yyget_text ( void );
-
-int yyget_lineno ( void );
-
-void yyset_lineno ( int _line_number  );
-
-/* Macros after this point can all be overridden by user definitions in
- * section 1.
- */
-
-#ifndef YY_SKIP_YYWRAP
-#ifdef __cplusplus
-extern "C" int yywrap ( void );
-#else
-extern int yywrap ( void );
-#endif
-#endif
-
-#ifndef YY_NO_UNPUT
-    
-    static void yyunput ( int c, char *buf_ptr  );
-    
-#endif
-
-#ifndef yytext_ptr
-static void yy_flex_strncpy ( char *, const char *, int );
-#endif
-
-#ifdef YY_NEED_STRLEN
-static int yy_flex_strlen ( const char * );
-#endif
-
-#ifndef YY_NO_INPUT
-#ifdef __cplusplus
-static int yyinput ( void );
-#else
-static int input ( void );
-#endif
-
-#endif
-
-/* Amount of stuff to slurp up with each read. */
-#ifndef YY_READ_BUF_SIZE
-#ifdef __ia64__
-/* On IA-64, the buffer size is 16k, not 8k */
-#define YY_READ_BUF_SIZE 16384
-#else
-#define YY_READ_BUF_SIZE 8192
-#endif /* __ia64__ */
-#endif
-
-/* Copy whatever the last rule matched to the standard output. */
-#ifndef ECHO
-/* This used to be an fputs(), but since the string might contain NUL's,
- * we now use fwrite().
- */
-#define ECHO do { if (fwrite( yytext, (size_t) yyleng, 1, yyout )) {} } while (0)
-#endif
-
-/* Gets input and stuffs it into "buf".  number of characters read, or YY_NULL,
- * is returned in "result".
- */
-#ifndef YY_INPUT
-#define YY_INPUT(buf,result,max_size) \
-	if ( YY_CURRENT_BUFFER_LVALUE->yy_is_interactive ) \
-		{ \
-		int c = '*'; \
-		int n; \
-		for ( n = 0; n < max_size && \
-			     (c = getc( yyin )) != EOF && c != '\n'; ++n ) \
-			buf[n] = (char) c; \
-		if ( c == '\n' ) \
-			buf[n++] = (char) c; \
-		if ( c == EOF && ferror( yyin ) ) \
-			YY_FATAL_ERROR( "input in flex scanner failed" ); \
-		result = n; \
-		} \
-	else \
-		{ \
-		errno=0; \
-		while ( (result = (int) fread(buf, 1, (yy_size_t) max_size, yyin)) == 0 && ferror(yyin)) \
-			{ \
-			if( errno != EINTR) \
-				{ \
-				YY_FATAL_ERROR( "input in flex scanner failed" ); \
-				break; \
-				} \
-			errno=0; \
-			clearerr(yyin); \
-			} \
-		}\
-\
-
-#endif
-
-/* No semi-colon after return; correct usage is to write "yyterminate();" -
- * we don't want an extra ';' after the "return" because that will cause
- * some compilers to complain about unreachable statements.
- */
-#ifndef yyterminate
-#define yyterminate() return YY_NULL
-#endif
-
-/* Number of entries by which start-condition stack grows. */
-#ifndef YY_START_STACK_INCR
-#define YY_START_STACK_INCR 25
-#endif
-
-/* Report a fatal error. */
-#ifndef YY_FATAL_ERROR
-#define YY_FATAL_ERROR(msg) yy_fatal_error( msg )
-#endif
-
-/* end tables serialization structures and prototypes */
-
-/* Default declaration of generated scanner - a define so the user can
- * easily add parameters.
- */
-#ifndef YY_DECL
-#define YY_DECL_IS_OURS 1
-
-extern int yylex (void);
-
-#define YY_DECL int yylex (void)
-#endif /* !YY_DECL */
-
-/* Code executed at the beginning of each rule, after yytext and yyleng
- * have been set up.
- */
-#ifndef YY_USER_ACTION
-#define YY_USER_ACTION
-#endif
-
-/* Code executed at the end of each rule. */
-#ifndef YY_BREAK
-#define YY_BREAK /*LINTED*/break;
-#endif
-
-#define YY_RULE_SETUP \
-	YY_USER_ACTION
-
-/** The main scanner function which does all the work.
- */
-YY_DECL
-{
-	yy_state_type yy_current_state;
-	char *yy_cp, *yy_bp;
-	int yy_act;
-    
-	if ( !(yy_init) )
-		{
-		(yy_init) = 1;
-
-#ifdef YY_USER_INIT
-		YY_USER_INIT;
-#endif
-
-        /* Create the reject buffer large enough to save one state per allowed character. */
-        if ( ! (yy_state_buf) )
-            (yy_state_buf) = (yy_state_type *)yyalloc(YY_STATE_BUF_SIZE  );
-            if ( ! (yy_state_buf) )
-                YY_FATAL_ERROR( "out of dynamic memory in yylex()" );
-
-		if ( ! (yy_start) )
-			(yy_start) = 1;	/* first start state */
-
-		if ( ! yyin )
-			yyin = stdin;
-
-		if ( ! yyout )
-			yyout = stdout;
-
-		if ( ! YY_CURRENT_BUFFER ) {
-			yyensure_buffer_stack ();
-			YY_CURRENT_BUFFER_LVALUE =
-				yy_create_buffer( yyin, YY_BUF_SIZE );
-		}
-
-		yy_load_buffer_state(  );
-		}
-
-	{
-#line 160 "src/l.l"
-
-
-#line 6312 "src/lex.yy.c"
-
-	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
-		{
-		yy_cp = (yy_c_buf_p);
-
-		/* Support of yytext. */
-		*yy_cp = (yy_hold_char);
-
-		/* yy_bp points to the position in yy_ch_buf of the start of
-		 * the current run.
-		 */
-		yy_bp = yy_cp;
-
-		yy_current_state = (yy_start);
-
-		(yy_state_ptr) = (yy_state_buf);
-		*(yy_state_ptr)++ = yy_current_state;
-
-yy_match:
-		do
-			{
-			YY_CHAR yy_c = yy_ec[YY_SC_TO_UI(*yy_cp)] ;
-			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-				{
-				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 2703 )
-					yy_c = yy_meta[yy_c];
-				}
-			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-			*(yy_state_ptr)++ = yy_current_state;
-			++yy_cp;
-			}
-		while ( yy_base[yy_current_state] != 18566 );
-
-yy_find_action:
-		yy_current_state = *--(yy_state_ptr);
-		(yy_lp) = yy_accept[yy_current_state];
-find_rule: /* we branch to this label when backing up */
-		for ( ; ; ) /* until we find what rule we matched */
-			{
-			if ( (yy_lp) && (yy_lp) < yy_accept[yy_current_state + 1] )
-				{
-				yy_act = yy_acclist[(yy_lp)];
-				if ( yy_act & YY_TRAILING_HEAD_MASK ||
-				     (yy_looking_for_trail_begin) )
-					{
-					if ( yy_act == (yy_looking_for_trail_begin) )
-						{
-						(yy_looking_for_trail_begin) = 0;
-						yy_act &= ~YY_TRAILING_HEAD_MASK;
-						break;
-						}
-					}
-				else if ( yy_act & YY_TRAILING_MASK )
-					{
-					(yy_looking_for_trail_begin) = yy_act & ~YY_TRAILING_MASK;
-					(yy_looking_for_trail_begin) |= YY_TRAILING_HEAD_MASK;
-					}
-				else
-					{
-					(yy_full_match) = yy_cp;
-					(yy_full_state) = (yy_state_ptr);
-					(yy_full_lp) = (yy_lp);
-					break;
-					}
-				++(yy_lp);
-				goto find_rule;
-				}
-			--yy_cp;
-			yy_current_state = *--(yy_state_ptr);
-			(yy_lp) = yy_accept[yy_current_state];
-			}
-
-		YY_DO_BEFORE_ACTION;
-
-do_action:	/* This label is used only to access EOF actions. */
-
-		switch ( yy_act )
-	{ /* beginning of action switch */
-case 1:
-YY_RULE_SETUP
-#line 162 "src/l.l"
+                       BEGIN(INITIAL);
+                       check_state = None_State;
+                       if (! pop_buffer_state())
+                                yyterminate();
+                  }
+                        }
+                        break;
+                        default:
+                                yyterminate();
+                        }
+                        continue;
+                }
+                size_t yy_cp = yy_b->pos, yy_length = 0;
+                int yy_rule = 0;
+                for (int yy_state = yy_start_state[yy_start]; yy_cp < yy_b->len && (yy_state = yy_next(yy_state, (unsigned char)yy_b->buf[yy_cp])); ) {
+                        yy_cp++;
+                        if (yy_accept[yy_state]) {
+                                yy_rule = yy_accept[yy_state];
+                                yy_length = yy_cp - yy_b->pos;
+                        }
+                }
+                yy_token_start = yy_b->pos;
+                if (! yy_rule) {
+                        // Default rule
+                        yy_b->pos++;
+                        yy_set_text(yy_b, yy_token_start, 1);
+                        ECHO;
+                        continue;
+                }
+                yy_rule--;
+                if (yy_trailing_head[yy_rule])
+                        yy_length = yy_trailing(yy_rule, yy_b->buf + yy_b->pos, yy_length);
+                yy_b->pos += yy_length;
+                yy_set_text(yy_b, yy_token_start, yy_length);
+                switch (yy_rule) {
+                case 0: /* {wws} */
+                {
 { /* Wide white space */ }
-	YY_BREAK
-case 2:
-/* rule 2 can match eol */
-YY_RULE_SETUP
-#line 163 "src/l.l"
+                }
+                break;
+                case 1: /* (#.*)?\\?\n? */
+                {
 { lineno++; }
-	YY_BREAK
-case 3:
-YY_RULE_SETUP
-#line 165 "src/l.l"
+                }
+                break;
+                case 2: /* is */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 4:
-YY_RULE_SETUP
-#line 166 "src/l.l"
+                }
+                break;
+                case 3: /* as */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 5:
-YY_RULE_SETUP
-#line 167 "src/l.l"
+                }
+                break;
+                case 4: /* are */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 6:
-YY_RULE_SETUP
-#line 168 "src/l.l"
+                }
+                break;
+                case 5: /* for */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 7:
-YY_RULE_SETUP
-#line 169 "src/l.l"
+                }
+                break;
+                case 6: /* via */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 8:
-YY_RULE_SETUP
-#line 170 "src/l.l"
+                }
+                break;
+                case 7: /* on(ly)? */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 9:
-YY_RULE_SETUP
-#line 171 "src/l.l"
+                }
+                break;
+                case 8: /* with(in|out)? */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 10:
-YY_RULE_SETUP
-#line 172 "src/l.l"
+                }
+                break;
+                case 9: /* program(s)? */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 11:
-YY_RULE_SETUP
-#line 173 "src/l.l"
+                }
+                break;
+                case 10: /* and */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 12:
-YY_RULE_SETUP
-#line 174 "src/l.l"
+                }
+                break;
+                case 11: /* has */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 13:
-YY_RULE_SETUP
-#line 175 "src/l.l"
+                }
+                break;
+                case 12: /* using */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 14:
-YY_RULE_SETUP
-#line 176 "src/l.l"
+                }
+                break;
+                case 13: /* use */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 15:
-YY_RULE_SETUP
-#line 177 "src/l.l"
+                }
+                break;
+                case 14: /* the */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 16:
-YY_RULE_SETUP
-#line 178 "src/l.l"
+                }
+                break;
+                case 15: /* to */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 17:
-YY_RULE_SETUP
-#line 179 "src/l.l"
+                }
+                break;
+                case 16: /* sum */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 18:
-YY_RULE_SETUP
-#line 180 "src/l.l"
+                }
+                break;
+                case 17: /* than */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 19:
-YY_RULE_SETUP
-#line 181 "src/l.l"
+                }
+                break;
+                case 18: /* usage */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 20:
-YY_RULE_SETUP
-#line 182 "src/l.l"
+                }
+                break;
+                case 19: /* was */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 21:
-YY_RULE_SETUP
-#line 183 "src/l.l"
+                }
+                break;
+                case 20: /* times */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 22:
-YY_RULE_SETUP
-#line 184 "src/l.l"
+                }
+                break;
+                case 21: /* but */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 23:
-YY_RULE_SETUP
-#line 185 "src/l.l"
+                }
+                break;
+                case 22: /* of */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 24:
-YY_RULE_SETUP
-#line 186 "src/l.l"
+                }
+                break;
+                case 23: /* or */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 25:
-YY_RULE_SETUP
-#line 187 "src/l.l"
+                }
+                break;
+                case 24: /* does */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 26:
-YY_RULE_SETUP
-#line 188 "src/l.l"
+                }
+                break;
+                case 25: /* per */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 27:
-YY_RULE_SETUP
-#line 189 "src/l.l"
+                }
+                break;
+                case 26: /* in */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 28:
-YY_RULE_SETUP
-#line 190 "src/l.l"
+                }
+                break;
+                case 27: /* last */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 29:
-YY_RULE_SETUP
-#line 191 "src/l.l"
+                }
+                break;
+                case 28: /* rate */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 30:
-YY_RULE_SETUP
-#line 192 "src/l.l"
+                }
+                break;
+                case 29: /* capacity */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 31:
-YY_RULE_SETUP
-#line 193 "src/l.l"
+                }
+                break;
+                case 30: /* activity */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 32:
-YY_RULE_SETUP
-#line 194 "src/l.l"
+                }
+                break;
+                case 31: /* option(s)? */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 33:
-YY_RULE_SETUP
-#line 195 "src/l.l"
+                }
+                break;
+                case 32: /* ssl[ \t]+disable */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 34:
-YY_RULE_SETUP
-#line 196 "src/l.l"
+                }
+                break;
+                case 33: /* disable[ \t]+ssl */
+                {
 {/* EMPTY */}
-	YY_BREAK
-case 35:
-YY_RULE_SETUP
-#line 198 "src/l.l"
+                }
+                break;
+                case 34: /* {startarg} */
+                {
 { BEGIN(ARGUMENT_COND); return START; }
-	YY_BREAK
-case 36:
-YY_RULE_SETUP
-#line 199 "src/l.l"
+                }
+                break;
+                case 35: /* {stoparg} */
+                {
 { BEGIN(ARGUMENT_COND); return STOP; }
-	YY_BREAK
-case 37:
-YY_RULE_SETUP
-#line 200 "src/l.l"
+                }
+                break;
+                case 36: /* {restartarg} */
+                {
 { BEGIN(ARGUMENT_COND); return RESTART; }
-	YY_BREAK
-case 38:
-YY_RULE_SETUP
-#line 201 "src/l.l"
+                }
+                break;
+                case 37: /* {execarg} */
+                {
 { BEGIN(ARGUMENT_COND); return EXEC; }
-	YY_BREAK
-case 39:
-YY_RULE_SETUP
-#line 202 "src/l.l"
+                }
+                break;
+                case 38: /* {pathtokarg} */
+                {
 {
                         if (check_state == Program_State) {
                                 BEGIN(ARGUMENT_COND); // Parse Path for program as arguments
@@ -6591,1647 +2930,1863 @@ YY_RULE_SETUP
                                 return PATHTOK;
                         }
                   }
-	YY_BREAK
-case 40:
-YY_RULE_SETUP
-#line 212 "src/l.l"
+                }
+                break;
+                case 39: /* if */
+                {
 { return IF; }
-	YY_BREAK
-case 41:
-YY_RULE_SETUP
-#line 213 "src/l.l"
+                }
+                break;
+                case 40: /* then */
+                {
 { return THEN; }
-	YY_BREAK
-case 42:
-YY_RULE_SETUP
-#line 214 "src/l.l"
+                }
+                break;
+                case 41: /* failed */
+                {
 { return FAILED; }
-	YY_BREAK
-case 43:
-YY_RULE_SETUP
-#line 215 "src/l.l"
+                }
+                break;
+                case 42: /* tls */
+                {
 { return SSLTOKEN; }
-	YY_BREAK
-case 44:
-YY_RULE_SETUP
-#line 216 "src/l.l"
+                }
+                break;
+                case 43: /* ssl */
+                {
 { return SSLTOKEN; }
-	YY_BREAK
-case 45:
-YY_RULE_SETUP
-#line 217 "src/l.l"
+                }
+                break;
+                case 44: /* ssl[ \t]+enable */
+                {
 { return SSLTOKEN; }
-	YY_BREAK
-case 46:
-YY_RULE_SETUP
-#line 218 "src/l.l"
+                }
+                break;
+                case 45: /* enable[ ]+ssl */
+                {
 { return SSLTOKEN; }
-	YY_BREAK
-case 47:
-YY_RULE_SETUP
-#line 219 "src/l.l"
+                }
+                break;
+                case 46: /* enable */
+                {
 { return ENABLE; }
-	YY_BREAK
-case 48:
-YY_RULE_SETUP
-#line 220 "src/l.l"
+                }
+                break;
+                case 47: /* disable */
+                {
 { return DISABLE; }
-	YY_BREAK
-case 49:
-YY_RULE_SETUP
-#line 221 "src/l.l"
+                }
+                break;
+                case 48: /* verify */
+                {
 { return VERIFY; }
-	YY_BREAK
-case 50:
-YY_RULE_SETUP
-#line 222 "src/l.l"
+                }
+                break;
+                case 49: /* valid */
+                {
 { return VALID; }
-	YY_BREAK
-case 51:
-YY_RULE_SETUP
-#line 223 "src/l.l"
+                }
+                break;
+                case 50: /* certificate */
+                {
 { return CERTIFICATE; }
-	YY_BREAK
-case 52:
-YY_RULE_SETUP
-#line 224 "src/l.l"
+                }
+                break;
+                case 51: /* cacertificatefile */
+                {
 { return CACERTIFICATEFILE; }
-	YY_BREAK
-case 53:
-YY_RULE_SETUP
-#line 225 "src/l.l"
+                }
+                break;
+                case 52: /* cacertificatepath */
+                {
 { return CACERTIFICATEPATH; }
-	YY_BREAK
-case 54:
-YY_RULE_SETUP
-#line 226 "src/l.l"
+                }
+                break;
+                case 53: /* set */
+                {
 { return SET; }
-	YY_BREAK
-case 55:
-YY_RULE_SETUP
-#line 227 "src/l.l"
+                }
+                break;
+                case 54: /* daemon */
+                {
 { return DAEMON; }
-	YY_BREAK
-case 56:
-YY_RULE_SETUP
-#line 228 "src/l.l"
+                }
+                break;
+                case 55: /* delay */
+                {
 { return DELAY; }
-	YY_BREAK
-case 57:
-YY_RULE_SETUP
-#line 229 "src/l.l"
+                }
+                break;
+                case 56: /* terminal */
+                {
 { return TERMINAL; }
-	YY_BREAK
-case 58:
-YY_RULE_SETUP
-#line 230 "src/l.l"
+                }
+                break;
+                case 57: /* batch */
+                {
 { return BATCH; }
-	YY_BREAK
-case 59:
-YY_RULE_SETUP
-#line 231 "src/l.l"
+                }
+                break;
+                case 58: /* log */
+                {
 { return LOGFILE; }
-	YY_BREAK
-case 60:
-YY_RULE_SETUP
-#line 232 "src/l.l"
+                }
+                break;
+                case 59: /* logfile */
+                {
 { return LOGFILE; }
-	YY_BREAK
-case 61:
-YY_RULE_SETUP
-#line 233 "src/l.l"
+                }
+                break;
+                case 60: /* syslog */
+                {
 { return SYSLOG; }
-	YY_BREAK
-case 62:
-YY_RULE_SETUP
-#line 234 "src/l.l"
+                }
+                break;
+                case 61: /* facility */
+                {
 { return FACILITY; }
-	YY_BREAK
-case 63:
-YY_RULE_SETUP
-#line 235 "src/l.l"
+                }
+                break;
+                case 62: /* httpd */
+                {
 { return HTTPD; }
-	YY_BREAK
-case 64:
-YY_RULE_SETUP
-#line 236 "src/l.l"
+                }
+                break;
+                case 63: /* address */
+                {
 { return ADDRESS; }
-	YY_BREAK
-case 65:
-YY_RULE_SETUP
-#line 237 "src/l.l"
+                }
+                break;
+                case 64: /* interface */
+                {
 { return INTERFACE; }
-	YY_BREAK
-case 66:
-YY_RULE_SETUP
-#line 238 "src/l.l"
+                }
+                break;
+                case 65: /* link */
+                {
 { return LINK; }
-	YY_BREAK
-case 67:
-YY_RULE_SETUP
-#line 239 "src/l.l"
+                }
+                break;
+                case 66: /* packet(s)?("/s")? */
+                {
 { return PACKET; }
-	YY_BREAK
-case 68:
-YY_RULE_SETUP
-#line 240 "src/l.l"
+                }
+                break;
+                case 67: /* bytein */
+                {
 { return BYTEIN; }
-	YY_BREAK
-case 69:
-YY_RULE_SETUP
-#line 241 "src/l.l"
+                }
+                break;
+                case 68: /* byteout */
+                {
 { return BYTEOUT; }
-	YY_BREAK
-case 70:
-YY_RULE_SETUP
-#line 242 "src/l.l"
+                }
+                break;
+                case 69: /* packetin */
+                {
 { return PACKETIN; }
-	YY_BREAK
-case 71:
-YY_RULE_SETUP
-#line 243 "src/l.l"
+                }
+                break;
+                case 70: /* packetout */
+                {
 { return PACKETOUT; }
-	YY_BREAK
-case 72:
-YY_RULE_SETUP
-#line 244 "src/l.l"
+                }
+                break;
+                case 71: /* upload(ed)?|tx */
+                {
 { return UPLOAD; }
-	YY_BREAK
-case 73:
-YY_RULE_SETUP
-#line 245 "src/l.l"
+                }
+                break;
+                case 72: /* download(ed)?|rx */
+                {
 { return DOWNLOAD; }
-	YY_BREAK
-case 74:
-YY_RULE_SETUP
-#line 246 "src/l.l"
+                }
+                break;
+                case 73: /* drop(s|ped)? */
+                {
+{ return DROP; }
+                }
+                break;
+                case 74: /* missed([ \t]+error(s)?)? */
+                {
+{ return MISSED; }
+                }
+                break;
+                case 75: /* fifo([ \t]+error(s)?)? */
+                {
+{ return FIFO; }
+                }
+                break;
+                case 76: /* carrier([ \t]+error(s)?)? */
+                {
+{ return CARRIER; }
+                }
+                break;
+                case 77: /* multicast(s)? */
+                {
+{ return MULTICAST; }
+                }
+                break;
+                case 78: /* collision(s)? */
+                {
+{ return COLLISION; }
+                }
+                break;
+                case 79: /* saturation */
+                {
 { return SATURATION; }
-	YY_BREAK
-case 75:
-YY_RULE_SETUP
-#line 247 "src/l.l"
+                }
+                break;
+                case 80: /* speed */
+                {
 { return SPEED; }
-	YY_BREAK
-case 76:
-YY_RULE_SETUP
-#line 248 "src/l.l"
+                }
+                break;
+                case 81: /* total */
+                {
 { return TOTAL; }
-	YY_BREAK
-case 77:
-YY_RULE_SETUP
-#line 249 "src/l.l"
+                }
+                break;
+                case 82: /* clientpemfile */
+                {
 { return CLIENTPEMFILE; }
-	YY_BREAK
-case 78:
-YY_RULE_SETUP
-#line 250 "src/l.l"
+                }
+                break;
+                case 83: /* allowselfcertification */
+                {
 { return ALLOWSELFCERTIFICATION; }
-	YY_BREAK
-case 79:
-YY_RULE_SETUP
-#line 251 "src/l.l"
+                }
+                break;
+                case 84: /* selfsigned */
+                {
 { return SELFSIGNED; }
-	YY_BREAK
-case 80:
-YY_RULE_SETUP
-#line 252 "src/l.l"
+                }
+                break;
+                case 85: /* certmd5 */
+                {
 { return CERTMD5; }
-	YY_BREAK
-case 81:
-YY_RULE_SETUP
-#line 253 "src/l.l"
+                }
+                break;
+                case 86: /* pemfile */
+                {
 { return PEMFILE; }
-	YY_BREAK
-case 82:
-YY_RULE_SETUP
-#line 254 "src/l.l"
+                }
+                break;
+                case 87: /* pemchain */
+                {
 { return PEMCHAIN; }
-	YY_BREAK
-case 83:
-YY_RULE_SETUP
-#line 255 "src/l.l"
+                }
+                break;
+                case 88: /* pemkey */
+                {
 { return PEMKEY; }
-	YY_BREAK
-case 84:
-YY_RULE_SETUP
-#line 256 "src/l.l"
+                }
+                break;
+                case 89: /* rsakey */
+                {
 { return RSAKEY; }
-	YY_BREAK
-case 85:
-YY_RULE_SETUP
-#line 257 "src/l.l"
+                }
+                break;
+                case 90: /* init */
+                {
 { return INIT; }
-	YY_BREAK
-case 86:
-YY_RULE_SETUP
-#line 258 "src/l.l"
+                }
+                break;
+                case 91: /* allow */
+                {
 { return ALLOW; }
-	YY_BREAK
-case 87:
-YY_RULE_SETUP
-#line 259 "src/l.l"
+                }
+                break;
+                case 92: /* reject */
+                {
 { return REJECTOPT; }
-	YY_BREAK
-case 88:
-YY_RULE_SETUP
-#line 260 "src/l.l"
+                }
+                break;
+                case 93: /* read[-]?only */
+                {
 { return READONLY; }
-	YY_BREAK
-case 89:
-YY_RULE_SETUP
-#line 261 "src/l.l"
+                }
+                break;
+                case 94: /* disk */
+                {
 { return DISK; }
-	YY_BREAK
-case 90:
-YY_RULE_SETUP
-#line 262 "src/l.l"
+                }
+                break;
+                case 95: /* read */
+                {
 { return READ; }
-	YY_BREAK
-case 91:
-YY_RULE_SETUP
-#line 263 "src/l.l"
+                }
+                break;
+                case 96: /* write */
+                {
 { return WRITE; }
-	YY_BREAK
-case 92:
-YY_RULE_SETUP
-#line 264 "src/l.l"
+                }
+                break;
+                case 97: /* service[ ]?time */
+                {
 { return SERVICETIME; }
-	YY_BREAK
-case 93:
-YY_RULE_SETUP
-#line 265 "src/l.l"
+                }
+                break;
+                case 98: /* latency */
+                {
+{ return LATENCY; }
+                }
+                break;
+                case 99: /* utili[sz]ation */
+                {
+{ return UTILIZATION; }
+                }
+                break;
+                case 100: /* queue[ ]?depth */
+                {
+{ return QUEUEDEPTH; }
+                }
+                break;
+                case 101: /* iops */
+                {
+{ return IOPS; }
+                }
+                break;
+                case 102: /* time[ -]?to[ -]?full */
+                {
+{ return TIMETOFULL; }
+                }
+                break;
+                case 103: /* over */
+                {
+{ return OVER; }
+                }
+                break;
+                case 104: /* operation(s)?("/s")? */
+                {
 { return OPERATION; }
-	YY_BREAK
-case 94:
-YY_RULE_SETUP
-#line 266 "src/l.l"
+                }
+                break;
+                case 105: /* pidfile */
+                {
 { return PIDFILE; }
-	YY_BREAK
-case 95:
-YY_RULE_SETUP
-#line 267 "src/l.l"
+                }
+                break;
+                case 106: /* idfile */
+                {
 { return IDFILE; }
-	YY_BREAK
-case 96:
-YY_RULE_SETUP
-#line 268 "src/l.l"
+                }
+                break;
+                case 107: /* statefile */
+                {
 { return STATEFILE; }
-	YY_BREAK
-case 97:
-YY_RULE_SETUP
-#line 269 "src/l.l"
+                }
+                break;
+                case 108: /* path */
+                {
 { return PATHTOK; }
-	YY_BREAK
-case 98:
-YY_RULE_SETUP
-#line 270 "src/l.l"
+                }
+                break;
+                case 109: /* start */
+                {
 { return START; }
-	YY_BREAK
-case 99:
-YY_RULE_SETUP
-#line 271 "src/l.l"
+                }
+                break;
+                case 110: /* stop */
+                {
 { return STOP; }
-	YY_BREAK
-case 100:
-YY_RULE_SETUP
-#line 272 "src/l.l"
+                }
+                break;
+                case 111: /* port(number)? */
+                {
 { return PORT; }
-	YY_BREAK
-case 101:
-YY_RULE_SETUP
-#line 273 "src/l.l"
+                }
+                break;
+                case 112: /* unix(socket)? */
+                {
 { return UNIXSOCKET; }
-	YY_BREAK
-case 102:
-YY_RULE_SETUP
-#line 274 "src/l.l"
+                }
+                break;
+                case 113: /* ipv4 */
+                {
 { return IPV4; }
-	YY_BREAK
-case 103:
-YY_RULE_SETUP
-#line 275 "src/l.l"
+                }
+                break;
+                case 114: /* ipv6 */
+                {
 { return IPV6; }
-	YY_BREAK
-case 104:
-YY_RULE_SETUP
-#line 276 "src/l.l"
+                }
+                break;
+                case 115: /* type */
+                {
 { return TYPE; }
-	YY_BREAK
-case 105:
-YY_RULE_SETUP
-#line 277 "src/l.l"
+                }
+                break;
+                case 116: /* proto(col)? */
+                {
 { return PROTOCOL; }
-	YY_BREAK
-case 106:
-YY_RULE_SETUP
-#line 278 "src/l.l"
+                }
+                break;
+                case 117: /* tcp[ \t]+retransmi(t|ts|ssion|ssions) */
+                {
+{ return TCPRETRANSMITS; }
+                }
+                break;
+                case 118: /* (tcp[ \t]+)?listen[ \t]+overflow(s)? */
+                {
+{ return LISTENOVERFLOWS; }
+                }
+                break;
+                case 119: /* (tcp[ \t]+)?listen[ \t]+drop(s)? */
+                {
+{ return LISTENDROPS; }
+                }
+                break;
+                case 120: /* (tcp[ \t]+)?syn[ \t]+cookie(s)? */
+                {
+{ return SYNCOOKIES; }
+                }
+                break;
+                case 121: /* (tcp[ \t]+)?orphan(s|ed)?([ \t]+socket(s)?)? */
+                {
+{ return ORPHANS; }
+                }
+                break;
+                case 122: /* (tcp[ \t]+)?time[_-]wait([ \t]+socket(s)?)? */
+                {
+{ return TIMEWAIT; }
+                }
+                break;
+                case 123: /* udp[ \t]+(receive[ \t]+buffer|rcvbuf)[ \t]+error(s)? */
+                {
+{ return UDPRCVBUFERRORS; }
+                }
+                break;
+                case 124: /* (listen|accept)[ \t]+queue */
+                {
+{ return LISTENQUEUE; }
+                }
+                break;
+                case 125: /* listen(ing)? */
+                {
+{ return LISTENING; }
+                }
+                break;
+                case 126: /* established([ \t]+connection(s)?)? */
+                {
+{ return ESTABLISHED; }
+                }
+                break;
+                case 127: /* tcp */
+                {
 { return TCP; }
-	YY_BREAK
-case 107:
-YY_RULE_SETUP
-#line 279 "src/l.l"
+                }
+                break;
+                case 128: /* tcpssl */
+                {
 { return TCPSSL; }
-	YY_BREAK
-case 108:
-YY_RULE_SETUP
-#line 280 "src/l.l"
+                }
+                break;
+                case 129: /* udp */
+                {
 { return UDP; }
-	YY_BREAK
-case 109:
-YY_RULE_SETUP
-#line 281 "src/l.l"
+                }
+                break;
+                case 130: /* alert */
+                {
 { return ALERT; }
-	YY_BREAK
-case 110:
-YY_RULE_SETUP
-#line 282 "src/l.l"
+                }
+                break;
+                case 131: /* noalert */
+                {
 { return NOALERT; }
-	YY_BREAK
-case 111:
-YY_RULE_SETUP
-#line 283 "src/l.l"
+                }
+                break;
+                case 132: /* mail-format */
+                {
 { return MAILFORMAT; }
-	YY_BREAK
-case 112:
-YY_RULE_SETUP
-#line 284 "src/l.l"
+                }
+                break;
+                case 133: /* resource */
+                {
 { return RESOURCE; }
-	YY_BREAK
-case 113:
-YY_RULE_SETUP
-#line 285 "src/l.l"
+                }
+                break;
+                case 134: /* restart(s)? */
+                {
 { return RESTART; }
-	YY_BREAK
-case 114:
-YY_RULE_SETUP
-#line 286 "src/l.l"
+                }
+                break;
+                case 135: /* cycle(s)? */
+                {
 { return CYCLE;}
-	YY_BREAK
-case 115:
-YY_RULE_SETUP
-#line 287 "src/l.l"
+                }
+                break;
+                case 136: /* timeout */
+                {
 { return TIMEOUT; }
-	YY_BREAK
-case 116:
-YY_RULE_SETUP
-#line 288 "src/l.l"
+                }
+                break;
+                case 137: /* retry */
+                {
 { return RETRY; }
-	YY_BREAK
-case 117:
-YY_RULE_SETUP
-#line 289 "src/l.l"
+                }
+                break;
+                case 138: /* persistent([ \t]+connection)? */
+                {
+{ return PERSISTENT; }
+                }
+                break;
+                case 139: /* dns[ \t]+(resolution|time) */
+                {
+{ return DNSTIME; }
+                }
+                break;
+                case 140: /* connect[ \t]+time */
+                {
+{ return CONNECTTIME; }
+                }
+                break;
+                case 141: /* (tls|ssl)[ \t]+handshake */
+                {
+{ return TLSHANDSHAKE; }
+                }
+                break;
+                case 142: /* request[ \t]+(write|time) */
+                {
+{ return REQUESTTIME; }
+                }
+                break;
+                case 143: /* (first[ \t]+byte|ttfb) */
+                {
+{ return FIRSTBYTE; }
+                }
+                break;
+                case 144: /* response[ \t]+time */
+                {
+{ return RESPONSETIME; }
+                }
+                break;
+                case 145: /* (rtt|round[ \t-]?trip([ \t]+time)?) */
+                {
+{ return RTT; }
+                }
+                break;
+                case 146: /* retransmi(t|ts|ssion|ssions) */
+                {
+{ return RETRANSMITS; }
+                }
+                break;
+                case 147: /* checksum */
+                {
 { return CHECKSUM; }
-	YY_BREAK
-case 118:
-YY_RULE_SETUP
-#line 290 "src/l.l"
+                }
+                break;
+                case 148: /* mailserver */
+                {
 { return MAILSERVER; }
-	YY_BREAK
-case 119:
-YY_RULE_SETUP
-#line 291 "src/l.l"
+                }
+                break;
+                case 149: /* host */
+                {
 { return HOST; }
-	YY_BREAK
-case 120:
-YY_RULE_SETUP
-#line 292 "src/l.l"
+                }
+                break;
+                case 150: /* hostheader */
+                {
 { return HOSTHEADER; }
-	YY_BREAK
-case 121:
-YY_RULE_SETUP
-#line 293 "src/l.l"
+                }
+                break;
+                case 151: /* method */
+                {
 { return METHOD; }
-	YY_BREAK
-case 122:
-YY_RULE_SETUP
-#line 294 "src/l.l"
+                }
+                break;
+                case 152: /* get */
+                {
 { return GET; }
-	YY_BREAK
-case 123:
-YY_RULE_SETUP
-#line 295 "src/l.l"
+                }
+                break;
+                case 153: /* head */
+                {
 { return HEAD; }
-	YY_BREAK
-case 124:
-YY_RULE_SETUP
-#line 296 "src/l.l"
+                }
+                break;
+                case 154: /* status */
+                {
 { return STATUS; }
-	YY_BREAK
-case 125:
-YY_RULE_SETUP
-#line 297 "src/l.l"
+                }
+                break;
+                case 155: /* default */
+                {
 { return DEFAULT; }
-	YY_BREAK
-case 126:
-YY_RULE_SETUP
-#line 298 "src/l.l"
+                }
+                break;
+                case 156: /* http */
+                {
 { return HTTP; }
-	YY_BREAK
-case 127:
-YY_RULE_SETUP
-#line 299 "src/l.l"
+                }
+                break;
+                case 157: /* https */
+                {
 { return HTTPS; }
-	YY_BREAK
-case 128:
-YY_RULE_SETUP
-#line 300 "src/l.l"
+                }
+                break;
+                case 158: /* http2 */
+                {
+{ return HTTP2; }
+                }
+                break;
+                case 159: /* apache-status */
+                {
 { return APACHESTATUS; }
-	YY_BREAK
-case 129:
-YY_RULE_SETUP
-#line 301 "src/l.l"
+                }
+                break;
+                case 160: /* ftp */
+                {
 { return FTP; }
-	YY_BREAK
-case 130:
-YY_RULE_SETUP
-#line 302 "src/l.l"
+                }
+                break;
+                case 161: /* smtp */
+                {
 { return SMTP; }
-	YY_BREAK
-case 131:
-YY_RULE_SETUP
-#line 303 "src/l.l"
+                }
+                break;
+                case 162: /* smtps */
+                {
 { return SMTPS; }
-	YY_BREAK
-case 132:
-YY_RULE_SETUP
-#line 304 "src/l.l"
+                }
+                break;
+                case 163: /* postfix-policy */
+                {
 { return POSTFIXPOLICY; }
-	YY_BREAK
-case 133:
-YY_RULE_SETUP
-#line 305 "src/l.l"
+                }
+                break;
+                case 164: /* pop */
+                {
 { return POP; }
-	YY_BREAK
-case 134:
-YY_RULE_SETUP
-#line 306 "src/l.l"
+                }
+                break;
+                case 165: /* pops */
+                {
 { return POPS; }
-	YY_BREAK
-case 135:
-YY_RULE_SETUP
-#line 307 "src/l.l"
+                }
+                break;
+                case 166: /* imap */
+                {
 { return IMAP; }
-	YY_BREAK
-case 136:
-YY_RULE_SETUP
-#line 308 "src/l.l"
+                }
+                break;
+                case 167: /* imaps */
+                {
 { return IMAPS; }
-	YY_BREAK
-case 137:
-YY_RULE_SETUP
-#line 309 "src/l.l"
+                }
+                break;
+                case 168: /* clamav */
+                {
 { return CLAMAV; }
-	YY_BREAK
-case 138:
-YY_RULE_SETUP
-#line 310 "src/l.l"
+                }
+                break;
+                case 169: /* dns */
+                {
 { return DNS; }
-	YY_BREAK
-case 139:
-YY_RULE_SETUP
-#line 311 "src/l.l"
+                }
+                break;
+                case 170: /* mysql */
+                {
 { return MYSQL; }
-	YY_BREAK
-case 140:
-YY_RULE_SETUP
-#line 312 "src/l.l"
+                }
+                break;
+                case 171: /* mysqls */
+                {
 { return MYSQLS; }
-	YY_BREAK
-case 141:
-YY_RULE_SETUP
-#line 313 "src/l.l"
+                }
+                break;
+                case 172: /* nntp */
+                {
 { return NNTP; }
-	YY_BREAK
-case 142:
-YY_RULE_SETUP
-#line 314 "src/l.l"
+                }
+                break;
+                case 173: /* ntp3 */
+                {
 { return NTP3; }
-	YY_BREAK
-case 143:
-YY_RULE_SETUP
-#line 315 "src/l.l"
+                }
+                break;
+                case 174: /* ssh */
+                {
 { return SSH; }
-	YY_BREAK
-case 144:
-YY_RULE_SETUP
-#line 316 "src/l.l"
+                }
+                break;
+                case 175: /* redis */
+                {
 { return REDIS; }
-	YY_BREAK
-case 145:
-YY_RULE_SETUP
-#line 317 "src/l.l"
+                }
+                break;
+                case 176: /* mongodb */
+                {
 { return MONGODB; }
-	YY_BREAK
-case 146:
-YY_RULE_SETUP
-#line 318 "src/l.l"
+                }
+                break;
+                case 177: /* fail2ban */
+                {
 { return FAIL2BAN; }
-	YY_BREAK
-case 147:
-YY_RULE_SETUP
-#line 319 "src/l.l"
+                }
+                break;
+                case 178: /* sieve */
+                {
 { return SIEVE; }
-	YY_BREAK
-case 148:
-YY_RULE_SETUP
-#line 320 "src/l.l"
+                }
+                break;
+                case 179: /* spamassassin */
+                {
 { return SPAMASSASSIN; }
-	YY_BREAK
-case 149:
-YY_RULE_SETUP
-#line 321 "src/l.l"
+                }
+                break;
+                case 180: /* dwp */
+                {
 { return DWP; }
-	YY_BREAK
-case 150:
-YY_RULE_SETUP
-#line 322 "src/l.l"
+                }
+                break;
+                case 181: /* ldap2 */
+                {
 { return LDAP2; }
-	YY_BREAK
-case 151:
-YY_RULE_SETUP
-#line 323 "src/l.l"
+                }
+                break;
+                case 182: /* ldap3 */
+                {
 { return LDAP3; }
-	YY_BREAK
-case 152:
-YY_RULE_SETUP
-#line 324 "src/l.l"
+                }
+                break;
+                case 183: /* rdate */
+                {
 { return RDATE; }
-	YY_BREAK
-case 153:
-YY_RULE_SETUP
-#line 325 "src/l.l"
+                }
+                break;
+                case 184: /* lmtp */
+                {
 { return LMTP; }
-	YY_BREAK
-case 154:
-YY_RULE_SETUP
-#line 326 "src/l.l"
+                }
+                break;
+                case 185: /* rsync */
+                {
 { return RSYNC; }
-	YY_BREAK
-case 155:
-YY_RULE_SETUP
-#line 327 "src/l.l"
+                }
+                break;
+                case 186: /* tns */
+                {
 { return TNS; }
-	YY_BREAK
-case 156:
-YY_RULE_SETUP
-#line 328 "src/l.l"
+                }
+                break;
+                case 187: /* pgsql */
+                {
 { return PGSQL; }
-	YY_BREAK
-case 157:
-YY_RULE_SETUP
-#line 329 "src/l.l"
+                }
+                break;
+                case 188: /* websocket */
+                {
 { return WEBSOCKET; }
-	YY_BREAK
-case 158:
-YY_RULE_SETUP
-#line 330 "src/l.l"
+                }
+                break;
+                case 189: /* mqtt */
+                {
 { return MQTT; }
-	YY_BREAK
-case 159:
-YY_RULE_SETUP
-#line 331 "src/l.l"
+                }
+                break;
+                case 190: /* origin */
+                {
 { return ORIGIN; }
-	YY_BREAK
-case 160:
-YY_RULE_SETUP
-#line 332 "src/l.l"
+                }
+                break;
+                case 191: /* version */
+                {
 { return VERSIONOPT; }
-	YY_BREAK
-case 161:
-YY_RULE_SETUP
-#line 333 "src/l.l"
+                }
+                break;
+                case 192: /* sip */
+                {
 { return SIP; }
-	YY_BREAK
-case 162:
-YY_RULE_SETUP
-#line 334 "src/l.l"
+                }
+                break;
+                case 193: /* gps */
+                {
 { return GPS; }
-	YY_BREAK
-case 163:
-YY_RULE_SETUP
-#line 335 "src/l.l"
+                }
+                break;
+                case 194: /* radius */
+                {
 { return RADIUS; }
-	YY_BREAK
-case 164:
-YY_RULE_SETUP
-#line 336 "src/l.l"
+                }
+                break;
+                case 195: /* memcache */
+                {
 { return MEMCACHE; }
-	YY_BREAK
-case 165:
-YY_RULE_SETUP
-#line 337 "src/l.l"
+                }
+                break;
+                case 196: /* target */
+                {
 { return TARGET; }
-	YY_BREAK
-case 166:
-YY_RULE_SETUP
-#line 338 "src/l.l"
+                }
+                break;
+                case 197: /* maxforward */
+                {
 { return MAXFORWARD; }
-	YY_BREAK
-case 167:
-YY_RULE_SETUP
-#line 339 "src/l.l"
+                }
+                break;
+                case 198: /* mode */
+                {
 { return MODE; }
-	YY_BREAK
-case 168:
-YY_RULE_SETUP
-#line 340 "src/l.l"
+                }
+                break;
+                case 199: /* active */
+                {
 { return ACTIVE; }
-	YY_BREAK
-case 169:
-YY_RULE_SETUP
-#line 341 "src/l.l"
+                }
+                break;
+                case 200: /* passive */
+                {
 { return PASSIVE; }
-	YY_BREAK
-case 170:
-YY_RULE_SETUP
-#line 342 "src/l.l"
+                }
+                break;
+                case 201: /* manual */
+                {
 { return MANUAL; }
-	YY_BREAK
-case 171:
-YY_RULE_SETUP
-#line 343 "src/l.l"
+                }
+                break;
+                case 202: /* onreboot */
+                {
 { return ONREBOOT; }
-	YY_BREAK
-case 172:
-YY_RULE_SETUP
-#line 344 "src/l.l"
+                }
+                break;
+                case 203: /* nostart */
+                {
 { return NOSTART; }
-	YY_BREAK
-case 173:
-YY_RULE_SETUP
-#line 345 "src/l.l"
+                }
+                break;
+                case 204: /* laststate */
+                {
 { return LASTSTATE; }
-	YY_BREAK
-case 174:
-YY_RULE_SETUP
-#line 346 "src/l.l"
+                }
+                break;
+                case 205: /* uid */
+                {
 { return UID; }
-	YY_BREAK
-case 175:
-YY_RULE_SETUP
-#line 347 "src/l.l"
+                }
+                break;
+                case 206: /* euid */
+                {
 { return EUID; }
-	YY_BREAK
-case 176:
-YY_RULE_SETUP
-#line 348 "src/l.l"
+                }
+                break;
+                case 207: /* security */
+                {
 { return SECURITY; }
-	YY_BREAK
-case 177:
-YY_RULE_SETUP
-#line 349 "src/l.l"
+                }
+                break;
+                case 208: /* attribute(s)? */
+                {
 { return ATTRIBUTE; }
-	YY_BREAK
-case 178:
-YY_RULE_SETUP
-#line 350 "src/l.l"
+                }
+                break;
+                case 209: /* gid */
+                {
 { return GID; }
-	YY_BREAK
-case 179:
-YY_RULE_SETUP
-#line 351 "src/l.l"
+                }
+                break;
+                case 210: /* request */
+                {
 { return REQUEST; }
-	YY_BREAK
-case 180:
-YY_RULE_SETUP
-#line 352 "src/l.l"
+                }
+                break;
+                case 211: /* secret */
+                {
 { return SECRET; }
-	YY_BREAK
-case 181:
-YY_RULE_SETUP
-#line 353 "src/l.l"
+                }
+                break;
+                case 212: /* loglimit */
+                {
 { return LOGLIMIT; }
-	YY_BREAK
-case 182:
-YY_RULE_SETUP
-#line 354 "src/l.l"
+                }
+                break;
+                case 213: /* closelimit */
+                {
 { return CLOSELIMIT; }
-	YY_BREAK
-case 183:
-YY_RULE_SETUP
-#line 355 "src/l.l"
+                }
+                break;
+                case 214: /* dnslimit */
+                {
 { return DNSLIMIT; }
-	YY_BREAK
-case 184:
-YY_RULE_SETUP
-#line 356 "src/l.l"
+                }
+                break;
+                case 215: /* keepalivelimit */
+                {
 { return KEEPALIVELIMIT; }
-	YY_BREAK
-case 185:
-YY_RULE_SETUP
-#line 357 "src/l.l"
+                }
+                break;
+                case 216: /* replylimit */
+                {
 { return REPLYLIMIT; }
-	YY_BREAK
-case 186:
-YY_RULE_SETUP
-#line 358 "src/l.l"
+                }
+                break;
+                case 217: /* requestlimit */
+                {
 { return REQUESTLIMIT; }
-	YY_BREAK
-case 187:
-YY_RULE_SETUP
-#line 359 "src/l.l"
+                }
+                break;
+                case 218: /* startlimit */
+                {
 { return STARTLIMIT; }
-	YY_BREAK
-case 188:
-YY_RULE_SETUP
-#line 360 "src/l.l"
+                }
+                break;
+                case 219: /* waitlimit */
+                {
 { return WAITLIMIT; }
-	YY_BREAK
-case 189:
-YY_RULE_SETUP
-#line 361 "src/l.l"
+                }
+                break;
+                case 220: /* gracefullimit */
+                {
 { return GRACEFULLIMIT; }
-	YY_BREAK
-case 190:
-YY_RULE_SETUP
-#line 362 "src/l.l"
+                }
+                break;
+                case 221: /* cleanuplimit */
+                {
 { return CLEANUPLIMIT; }
-	YY_BREAK
-case 191:
-YY_RULE_SETUP
-#line 363 "src/l.l"
+                }
+                break;
+                case 222: /* mem(ory)? */
+                {
 { return MEMORY; }
-	YY_BREAK
-case 192:
-YY_RULE_SETUP
-#line 364 "src/l.l"
+                }
+                break;
+                case 223: /* swap */
+                {
 { return SWAP; }
-	YY_BREAK
-case 193:
-YY_RULE_SETUP
-#line 365 "src/l.l"
+                }
+                break;
+                case 224: /* total[ ]?mem(ory)? */
+                {
 { return TOTALMEMORY; }
-	YY_BREAK
-case 194:
-YY_RULE_SETUP
-#line 366 "src/l.l"
+                }
+                break;
+                case 225: /* core */
+                {
 { return CORE; }
-	YY_BREAK
-case 195:
-YY_RULE_SETUP
-#line 367 "src/l.l"
+                }
+                break;
+                case 226: /* cpu */
+                {
 { return CPU; }
-	YY_BREAK
-case 196:
-YY_RULE_SETUP
-#line 368 "src/l.l"
+                }
+                break;
+                case 227: /* total[ ]?cpu */
+                {
 { return TOTALCPU; }
-	YY_BREAK
-case 197:
-YY_RULE_SETUP
-#line 369 "src/l.l"
+                }
+                break;
+                case 228: /* child(ren)? */
+                {
 { return CHILDREN; }
-	YY_BREAK
-case 198:
-YY_RULE_SETUP
-#line 370 "src/l.l"
+                }
+                break;
+                case 229: /* thread(s)? */
+                {
 { return THREADS; }
-	YY_BREAK
-case 199:
-YY_RULE_SETUP
-#line 371 "src/l.l"
+                }
+                break;
+                case 230: /* time(stamp)? */
+                {
 { return TIME; }
-	YY_BREAK
-case 200:
-YY_RULE_SETUP
-#line 372 "src/l.l"
+                }
+                break;
+                case 231: /* changed */
+                {
 { return CHANGED; }
-	YY_BREAK
-case 201:
-YY_RULE_SETUP
-#line 373 "src/l.l"
+                }
+                break;
+                case 232: /* -sslv2 */
+                {
 { return NOSSLV2; }
-	YY_BREAK
-case 202:
-YY_RULE_SETUP
-#line 374 "src/l.l"
+                }
+                break;
+                case 233: /* -sslv3 */
+                {
 { return NOSSLV3; }
-	YY_BREAK
-case 203:
-YY_RULE_SETUP
-#line 375 "src/l.l"
+                }
+                break;
+                case 234: /* -tlsv1 */
+                {
 { return NOTLSV1; }
-	YY_BREAK
-case 204:
-YY_RULE_SETUP
-#line 376 "src/l.l"
+                }
+                break;
+                case 235: /* -tlsv11 */
+                {
 { return NOTLSV11; }
-	YY_BREAK
-case 205:
-YY_RULE_SETUP
-#line 377 "src/l.l"
+                }
+                break;
+                case 236: /* -tlsv12 */
+                {
 { return NOTLSV12; }
-	YY_BREAK
-case 206:
-YY_RULE_SETUP
-#line 378 "src/l.l"
+                }
+                break;
+                case 237: /* -tlsv13 */
+                {
 { return NOTLSV13; }
-	YY_BREAK
-case 207:
-YY_RULE_SETUP
-#line 379 "src/l.l"
+                }
+                break;
+                case 238: /* sslv2 */
+                {
 { return SSLV2; }
-	YY_BREAK
-case 208:
-YY_RULE_SETUP
-#line 380 "src/l.l"
+                }
+                break;
+                case 239: /* sslv3 */
+                {
 { return SSLV3; }
-	YY_BREAK
-case 209:
-YY_RULE_SETUP
-#line 381 "src/l.l"
+                }
+                break;
+                case 240: /* tlsv1 */
+                {
 { return TLSV1; }
-	YY_BREAK
-case 210:
-YY_RULE_SETUP
-#line 382 "src/l.l"
+                }
+                break;
+                case 241: /* tlsv11 */
+                {
 { return TLSV11; }
-	YY_BREAK
-case 211:
-YY_RULE_SETUP
-#line 383 "src/l.l"
+                }
+                break;
+                case 242: /* tlsv12 */
+                {
 { return TLSV12; }
-	YY_BREAK
-case 212:
-YY_RULE_SETUP
-#line 384 "src/l.l"
+                }
+                break;
+                case 243: /* tlsv13 */
+                {
 { return TLSV13; }
-	YY_BREAK
-case 213:
-YY_RULE_SETUP
-#line 385 "src/l.l"
+                }
+                break;
+                case 244: /* cipher(s)? */
+                {
 { return CIPHER; }
-	YY_BREAK
-case 214:
-YY_RULE_SETUP
-#line 386 "src/l.l"
+                }
+                break;
+                case 245: /* auto */
+                {
 { return AUTO; }
-	YY_BREAK
-case 215:
-YY_RULE_SETUP
-#line 387 "src/l.l"
+                }
+                break;
+                case 246: /* sslauto */
+                {
 { return AUTO; }
-	YY_BREAK
-case 216:
-YY_RULE_SETUP
-#line 388 "src/l.l"
+                }
+                break;
+                case 247: /* inode(s)? */
+                {
 { return INODE; }
-	YY_BREAK
-case 217:
-YY_RULE_SETUP
-#line 389 "src/l.l"
+                }
+                break;
+                case 248: /* space */
+                {
 { return SPACE; }
-	YY_BREAK
-case 218:
-YY_RULE_SETUP
-#line 390 "src/l.l"
+                }
+                break;
+                case 249: /* free */
+                {
 { return TFREE; }
-	YY_BREAK
-case 219:
-YY_RULE_SETUP
-#line 391 "src/l.l"
+                }
+                break;
+                case 250: /* perm(ission)? */
+                {
 { return PERMISSION; }
-	YY_BREAK
-case 220:
-YY_RULE_SETUP
-#line 392 "src/l.l"
+                }
+                break;
+                case 251: /* exec(ute)? */
+                {
 { return EXEC; }
-	YY_BREAK
-case 221:
-YY_RULE_SETUP
-#line 393 "src/l.l"
+                }
+                break;
+                case 252: /* size */
+                {
 { return SIZE; }
-	YY_BREAK
-case 222:
-YY_RULE_SETUP
-#line 394 "src/l.l"
+                }
+                break;
+                case 253: /* uptime */
+                {
 { return UPTIME; }
-	YY_BREAK
-case 223:
-YY_RULE_SETUP
-#line 395 "src/l.l"
+                }
+                break;
+                case 254: /* basedir */
+                {
 { return BASEDIR; }
-	YY_BREAK
-case 224:
-YY_RULE_SETUP
-#line 396 "src/l.l"
+                }
+                break;
+                case 255: /* slot(s)? */
+                {
 { return SLOT; }
-	YY_BREAK
-case 225:
-YY_RULE_SETUP
-#line 397 "src/l.l"
+                }
+                break;
+                case 256: /* eventqueue */
+                {
 { return EVENTQUEUE; }
-	YY_BREAK
-case 226:
-YY_RULE_SETUP
-#line 398 "src/l.l"
+                }
+                break;
+                case 257: /* match(ing)? */
+                {
 { return MATCH; }
-	YY_BREAK
-case 227:
-YY_RULE_SETUP
-#line 399 "src/l.l"
+                }
+                break;
+                case 258: /* not */
+                {
 { return NOT; }
-	YY_BREAK
-case 228:
-YY_RULE_SETUP
-#line 400 "src/l.l"
+                }
+                break;
+                case 259: /* ignore */
+                {
 { return IGNORE; }
-	YY_BREAK
-case 229:
-YY_RULE_SETUP
-#line 401 "src/l.l"
+                }
+                break;
+                case 260: /* connection */
+                {
 { return CONNECTION; }
-	YY_BREAK
-case 230:
-YY_RULE_SETUP
-#line 402 "src/l.l"
+                }
+                break;
+                case 261: /* unmonitor */
+                {
 { return UNMONITOR; }
-	YY_BREAK
-case 231:
-YY_RULE_SETUP
-#line 403 "src/l.l"
+                }
+                break;
+                case 262: /* action */
+                {
 { return ACTION; }
-	YY_BREAK
-case 232:
-YY_RULE_SETUP
-#line 404 "src/l.l"
+                }
+                break;
+                case 263: /* icmp */
+                {
 { return ICMP; }
-	YY_BREAK
-case 233:
-YY_RULE_SETUP
-#line 405 "src/l.l"
+                }
+                break;
+                case 264: /* ping */
+                {
 { return PING; }
-	YY_BREAK
-case 234:
-YY_RULE_SETUP
-#line 406 "src/l.l"
+                }
+                break;
+                case 265: /* ping4 */
+                {
 { return PING4; }
-	YY_BREAK
-case 235:
-YY_RULE_SETUP
-#line 407 "src/l.l"
+                }
+                break;
+                case 266: /* ping6 */
+                {
 { return PING6; }
-	YY_BREAK
-case 236:
-YY_RULE_SETUP
-#line 408 "src/l.l"
+                }
+                break;
+                case 267: /* echo */
+                {
 { return ICMPECHO; }
-	YY_BREAK
-case 237:
-YY_RULE_SETUP
-#line 409 "src/l.l"
+                }
+                break;
+                case 268: /* send */
+                {
 { return SEND; }
-	YY_BREAK
-case 238:
-YY_RULE_SETUP
-#line 410 "src/l.l"
+                }
+                break;
+                case 269: /* expect */
+                {
 { return EXPECT; }
-	YY_BREAK
-case 239:
-YY_RULE_SETUP
-#line 411 "src/l.l"
+                }
+                break;
+                case 270: /* hex */
+                {
+{ return HEX; }
+                }
+                break;
+                case 271: /* expectbuffer */
+                {
 { return EXPECTBUFFER; }
-	YY_BREAK
-case 240:
-YY_RULE_SETUP
-#line 412 "src/l.l"
+                }
+                break;
+                case 272: /* limits */
+                {
 { return LIMITS; }
-	YY_BREAK
-case 241:
-YY_RULE_SETUP
-#line 413 "src/l.l"
+                }
+                break;
+                case 273: /* sendexpectbuffer */
+                {
 { return SENDEXPECTBUFFER; }
-	YY_BREAK
-case 242:
-YY_RULE_SETUP
-#line 414 "src/l.l"
+                }
+                break;
+                case 274: /* filecontentbuffer */
+                {
 { return FILECONTENTBUFFER; }
-	YY_BREAK
-case 243:
-YY_RULE_SETUP
-#line 415 "src/l.l"
+                }
+                break;
+                case 275: /* httpcontentbuffer */
+                {
 { return HTTPCONTENTBUFFER; }
-	YY_BREAK
-case 244:
-YY_RULE_SETUP
-#line 416 "src/l.l"
+                }
+                break;
+                case 276: /* programoutput */
+                {
 { return PROGRAMOUTPUT; }
-	YY_BREAK
-case 245:
-YY_RULE_SETUP
-#line 417 "src/l.l"
+                }
+                break;
+                case 277: /* networktimeout */
+                {
 { return NETWORKTIMEOUT; }
-	YY_BREAK
-case 246:
-YY_RULE_SETUP
-#line 418 "src/l.l"
+                }
+                break;
+                case 278: /* programtimeout */
+                {
 { return PROGRAMTIMEOUT; }
-	YY_BREAK
-case 247:
-YY_RULE_SETUP
-#line 419 "src/l.l"
+                }
+                break;
+                case 279: /* stoptimeout */
+                {
 { return STOPTIMEOUT; }
-	YY_BREAK
-case 248:
-YY_RULE_SETUP
-#line 420 "src/l.l"
+                }
+                break;
+                case 280: /* starttimeout */
+                {
 { return STARTTIMEOUT; }
-	YY_BREAK
-case 249:
-YY_RULE_SETUP
-#line 421 "src/l.l"
+                }
+                break;
+                case 281: /* restarttimeout */
+                {
 { return RESTARTTIMEOUT; }
-	YY_BREAK
-case 250:
-YY_RULE_SETUP
-#line 422 "src/l.l"
+                }
+                break;
+                case 282: /* checksumworkers */
+                {
+{ return CHECKSUMWORKERS; }
+                }
+                break;
+                case 283: /* checksumidleio */
+                {
+{ return CHECKSUMIDLEIO; }
+                }
+                break;
+                case 284: /* filesystemtimeout */
+                {
+{ return FILESYSTEMTIMEOUT; }
+                }
+                break;
+                case 285: /* dnsttl */
+                {
+{ return DNSTTL; }
+                }
+                break;
+                case 286: /* dnsnegativettl */
+                {
+{ return DNSNEGATIVETTL; }
+                }
+                break;
+                case 287: /* entries */
+                {
+{ return ENTRIES; }
+                }
+                break;
+                case 288: /* oldest */
+                {
+{ return OLDEST; }
+                }
+                break;
+                case 289: /* cleartext */
+                {
 { return CLEARTEXT; }
-	YY_BREAK
-case 251:
-YY_RULE_SETUP
-#line 423 "src/l.l"
+                }
+                break;
+                case 290: /* md5 */
+                {
 { return MD5HASH; }
-	YY_BREAK
-case 252:
-YY_RULE_SETUP
-#line 424 "src/l.l"
+                }
+                break;
+                case 291: /* sha1 */
+                {
 { return SHA1HASH; }
-	YY_BREAK
-case 253:
-YY_RULE_SETUP
-#line 425 "src/l.l"
+                }
+                break;
+                case 292: /* sha256 */
+                {
+{ return SHA256HASH; }
+                }
+                break;
+                case 293: /* xxh64 */
+                {
+{ return XXH64HASH; }
+                }
+                break;
+                case 294: /* crypt */
+                {
 { return CRYPT; }
-	YY_BREAK
-case 254:
-YY_RULE_SETUP
-#line 426 "src/l.l"
+                }
+                break;
+                case 295: /* signature */
+                {
 { return SIGNATURE; }
-	YY_BREAK
-case 255:
-YY_RULE_SETUP
-#line 427 "src/l.l"
+                }
+                break;
+                case 296: /* nonexist(s)? */
+                {
 { return NONEXIST; }
-	YY_BREAK
-case 256:
-YY_RULE_SETUP
-#line 428 "src/l.l"
+                }
+                break;
+                case 297: /* exist(s)? */
+                {
 { return EXIST; }
-	YY_BREAK
-case 257:
-YY_RULE_SETUP
-#line 429 "src/l.l"
+                }
+                break;
+                case 298: /* invalid */
+                {
 { return INVALID; }
-	YY_BREAK
-case 258:
-YY_RULE_SETUP
-#line 430 "src/l.l"
+                }
+                break;
+                case 299: /* data */
+                {
 { return DATA; }
-	YY_BREAK
-case 259:
-YY_RULE_SETUP
-#line 431 "src/l.l"
+                }
+                break;
+                case 300: /* recovered */
+                {
 { return RECOVERED; }
-	YY_BREAK
-case 260:
-YY_RULE_SETUP
-#line 432 "src/l.l"
+                }
+                break;
+                case 301: /* passed */
+                {
 { return PASSED; }
-	YY_BREAK
-case 261:
-YY_RULE_SETUP
-#line 433 "src/l.l"
+                }
+                break;
+                case 302: /* succeeded */
+                {
 { return SUCCEEDED; }
-	YY_BREAK
-case 262:
-YY_RULE_SETUP
-#line 434 "src/l.l"
+                }
+                break;
+                case 303: /* else */
+                {
 { return ELSE; }
-	YY_BREAK
-case 263:
-YY_RULE_SETUP
-#line 435 "src/l.l"
+                }
+                break;
+                case 304: /* mmonit */
+                {
 { return MMONIT; }
-	YY_BREAK
-case 264:
-YY_RULE_SETUP
-#line 436 "src/l.l"
+                }
+                break;
+                case 305: /* url */
+                {
 { return URL; }
-	YY_BREAK
-case 265:
-YY_RULE_SETUP
-#line 437 "src/l.l"
+                }
+                break;
+                case 306: /* content */
+                {
 { return CONTENT; }
-	YY_BREAK
-case 266:
-YY_RULE_SETUP
-#line 438 "src/l.l"
+                }
+                break;
+                case 307: /* pid */
+                {
 { return PID; }
-	YY_BREAK
-case 267:
-YY_RULE_SETUP
-#line 439 "src/l.l"
+                }
+                break;
+                case 308: /* ppid */
+                {
 { return PPID; }
-	YY_BREAK
-case 268:
-YY_RULE_SETUP
-#line 440 "src/l.l"
+                }
+                break;
+                case 309: /* count */
+                {
 { return COUNT; }
-	YY_BREAK
-case 269:
-YY_RULE_SETUP
-#line 441 "src/l.l"
+                }
+                break;
+                case 310: /* repeat */
+                {
 { return REPEAT; }
-	YY_BREAK
-case 270:
-YY_RULE_SETUP
-#line 442 "src/l.l"
+                }
+                break;
+                case 311: /* reminder */
+                {
 { return REMINDER; }
-	YY_BREAK
-case 271:
-YY_RULE_SETUP
-#line 443 "src/l.l"
+                }
+                break;
+                case 312: /* instance */
+                {
 { return INSTANCE; }
-	YY_BREAK
-case 272:
-YY_RULE_SETUP
-#line 444 "src/l.l"
+                }
+                break;
+                case 313: /* hostname */
+                {
 { return HOSTNAME; }
-	YY_BREAK
-case 273:
-YY_RULE_SETUP
-#line 445 "src/l.l"
+                }
+                break;
+                case 314: /* username */
+                {
 { return USERNAME; }
-	YY_BREAK
-case 274:
-YY_RULE_SETUP
-#line 446 "src/l.l"
+                }
+                break;
+                case 315: /* password */
+                {
 { return PASSWORD; }
-	YY_BREAK
-case 275:
-YY_RULE_SETUP
-#line 447 "src/l.l"
+                }
+                break;
+                case 316: /* credentials */
+                {
 { return CREDENTIALS; }
-	YY_BREAK
-case 276:
-YY_RULE_SETUP
-#line 448 "src/l.l"
+                }
+                break;
+                case 317: /* register */
+                {
 { return REGISTER; }
-	YY_BREAK
-case 277:
-YY_RULE_SETUP
-#line 449 "src/l.l"
+                }
+                break;
+                case 318: /* fsflag(s)? */
+                {
 { return FSFLAG; }
-	YY_BREAK
-case 278:
-YY_RULE_SETUP
-#line 450 "src/l.l"
+                }
+                break;
+                case 319: /* fips */
+                {
 { return FIPS; }
-	YY_BREAK
-case 279:
-YY_RULE_SETUP
-#line 451 "src/l.l"
+                }
+                break;
+                case 320: /* filedescriptors */
+                {
 { return FILEDESCRIPTORS; }
-	YY_BREAK
-case 280:
-YY_RULE_SETUP
-#line 452 "src/l.l"
+                }
+                break;
+                case 321: /* {byte} */
+                {
 { return BYTE; }
-	YY_BREAK
-case 281:
-YY_RULE_SETUP
-#line 453 "src/l.l"
+                }
+                break;
+                case 322: /* {kilobyte} */
+                {
 { return KILOBYTE; }
-	YY_BREAK
-case 282:
-YY_RULE_SETUP
-#line 454 "src/l.l"
+                }
+                break;
+                case 323: /* {megabyte} */
+                {
 { return MEGABYTE; }
-	YY_BREAK
-case 283:
-YY_RULE_SETUP
-#line 455 "src/l.l"
+                }
+                break;
+                case 324: /* {gigabyte} */
+                {
 { return GIGABYTE; }
-	YY_BREAK
-case 284:
-YY_RULE_SETUP
-#line 456 "src/l.l"
+                }
+                break;
+                case 325: /* {loadavg1} */
+                {
 { return LOADAVG1; }
-	YY_BREAK
-case 285:
-YY_RULE_SETUP
-#line 457 "src/l.l"
+                }
+                break;
+                case 326: /* {loadavg5} */
+                {
 { return LOADAVG5; }
-	YY_BREAK
-case 286:
-YY_RULE_SETUP
-#line 458 "src/l.l"
+                }
+                break;
+                case 327: /* {loadavg15} */
+                {
 { return LOADAVG15; }
-	YY_BREAK
-case 287:
-YY_RULE_SETUP
-#line 459 "src/l.l"
+                }
+                break;
+                case 328: /* {cpuuser} */
+                {
 { return CPUUSER; }
-	YY_BREAK
-case 288:
-YY_RULE_SETUP
-#line 460 "src/l.l"
+                }
+                break;
+                case 329: /* {cpusyst} */
+                {
 { return CPUSYSTEM; }
-	YY_BREAK
-case 289:
-YY_RULE_SETUP
-#line 461 "src/l.l"
+                }
+                break;
+                case 330: /* {cpuwait} */
+                {
 { return CPUWAIT; }
-	YY_BREAK
-case 290:
-YY_RULE_SETUP
-#line 462 "src/l.l"
+                }
+                break;
+                case 331: /* {cpunice} */
+                {
 { return CPUNICE; }
-	YY_BREAK
-case 291:
-YY_RULE_SETUP
-#line 463 "src/l.l"
+                }
+                break;
+                case 332: /* {cpuhardirq} */
+                {
 { return CPUHARDIRQ; }
-	YY_BREAK
-case 292:
-YY_RULE_SETUP
-#line 464 "src/l.l"
+                }
+                break;
+                case 333: /* {cpusoftirq} */
+                {
 { return CPUSOFTIRQ; }
-	YY_BREAK
-case 293:
-YY_RULE_SETUP
-#line 465 "src/l.l"
+                }
+                break;
+                case 334: /* {cpusteal} */
+                {
 { return CPUSTEAL; }
-	YY_BREAK
-case 294:
-YY_RULE_SETUP
-#line 466 "src/l.l"
+                }
+                break;
+                case 335: /* {cpuguest} */
+                {
 { return CPUGUEST; }
-	YY_BREAK
-case 295:
-YY_RULE_SETUP
-#line 467 "src/l.l"
+                }
+                break;
+                case 336: /* {cpuguestnice} */
+                {
 { return CPUGUESTNICE; }
-	YY_BREAK
-case 296:
-YY_RULE_SETUP
-#line 468 "src/l.l"
+                }
+                break;
+                case 337: /* {greater} */
+                {
 { return GREATER; }
-	YY_BREAK
-case 297:
-YY_RULE_SETUP
-#line 469 "src/l.l"
+                }
+                break;
+                case 338: /* {greaterorequal} */
+                {
 { return GREATEROREQUAL; }
-	YY_BREAK
-case 298:
-YY_RULE_SETUP
-#line 470 "src/l.l"
+                }
+                break;
+                case 339: /* {less} */
+                {
 { return LESS; }
-	YY_BREAK
-case 299:
-YY_RULE_SETUP
-#line 471 "src/l.l"
+                }
+                break;
+                case 340: /* {lessorequal} */
+                {
 { return LESSOREQUAL; }
-	YY_BREAK
-case 300:
-YY_RULE_SETUP
-#line 472 "src/l.l"
+                }
+                break;
+                case 341: /* {equal} */
+                {
 { return EQUAL; }
-	YY_BREAK
-case 301:
-YY_RULE_SETUP
-#line 473 "src/l.l"
+                }
+                break;
+                case 342: /* {notequal} */
+                {
 { return NOTEQUAL; }
-	YY_BREAK
-case 302:
-YY_RULE_SETUP
-#line 474 "src/l.l"
+                }
+                break;
+                case 343: /* {millisecond} */
+                {
 { return MILLISECOND; }
-	YY_BREAK
-case 303:
-YY_RULE_SETUP
-#line 475 "src/l.l"
+                }
+                break;
+                case 344: /* {second} */
+                {
 { return SECOND; }
-	YY_BREAK
-case 304:
-YY_RULE_SETUP
-#line 476 "src/l.l"
+                }
+                break;
+                case 345: /* {minute} */
+                {
 { return MINUTE; }
-	YY_BREAK
-case 305:
-YY_RULE_SETUP
-#line 477 "src/l.l"
+                }
+                break;
+                case 346: /* {hour} */
+                {
 { return HOUR; }
-	YY_BREAK
-case 306:
-YY_RULE_SETUP
-#line 478 "src/l.l"
+                }
+                break;
+                case 347: /* {day} */
+                {
 { return DAY; }
-	YY_BREAK
-case 307:
-YY_RULE_SETUP
-#line 479 "src/l.l"
+                }
+                break;
+                case 348: /* {month} */
+                {
 { return MONTH; }
-	YY_BREAK
-case 308:
-YY_RULE_SETUP
-#line 480 "src/l.l"
+                }
+                break;
+                case 349: /* {atime} */
+                {
 { return ATIME; }
-	YY_BREAK
-case 309:
-YY_RULE_SETUP
-#line 481 "src/l.l"
+                }
+                break;
+                case 350: /* {ctime} */
+                {
 { return CTIME; }
-	YY_BREAK
-case 310:
-YY_RULE_SETUP
-#line 482 "src/l.l"
+                }
+                break;
+                case 351: /* {mtime} */
+                {
 { return MTIME; }
-	YY_BREAK
-case 311:
-YY_RULE_SETUP
-#line 484 "src/l.l"
+                }
+                break;
+                case 352: /* include */
+                {
 { BEGIN(INCLUDE); }
-	YY_BREAK
-case 312:
-YY_RULE_SETUP
-#line 486 "src/l.l"
+                }
+                break;
+                case 353: /* not[ ]+every */
+                {
 {
                     BEGIN(EVERY_COND);
                     return NOTEVERY;
                   }
-	YY_BREAK
-case 313:
-YY_RULE_SETUP
-#line 491 "src/l.l"
+                }
+                break;
+                case 354: /* every */
+                {
 {
                     BEGIN(EVERY_COND);
                     return EVERY;
                   }
-	YY_BREAK
-case 314:
-YY_RULE_SETUP
-#line 496 "src/l.l"
+                }
+                break;
+                case 355: /* depend(s)?[ \t]+(on[ \t]*)? */
+                {
 {
                     BEGIN(DEPEND_COND);
                     return DEPENDS;
                   }
-	YY_BREAK
-case 315:
-YY_RULE_SETUP
-#line 501 "src/l.l"
+                }
+                break;
+                case 356: /* check[ \t]+(process[ \t])? */
+                {
 {
                     BEGIN(SERVICE_COND);
                     check_state = Proc_State;
                     return CHECKPROC;
                   }
-	YY_BREAK
-case 316:
-YY_RULE_SETUP
-#line 507 "src/l.l"
+                }
+                break;
+                case 357: /* check[ \t]+(program[ \t])? */
+                {
 {
                     BEGIN(SERVICE_COND);
                     check_state = Program_State;
                     return CHECKPROGRAM;
                   }
-	YY_BREAK
-case 317:
-YY_RULE_SETUP
-#line 513 "src/l.l"
+                }
+                break;
+                case 358: /* check[ \t]+device */
+                {
 { /* Filesystem alias for backward compatibility  */
                     BEGIN(SERVICE_COND);
                     check_state = FileSys_State;
                     return CHECKFILESYS;
                   }
-	YY_BREAK
-case 318:
-YY_RULE_SETUP
-#line 519 "src/l.l"
+                }
+                break;
+                case 359: /* check[ \t]+filesystem */
+                {
 {
                     BEGIN(SERVICE_COND);
                     check_state = FileSys_State;
                     return CHECKFILESYS;
                   }
-	YY_BREAK
-case 319:
-YY_RULE_SETUP
-#line 525 "src/l.l"
+                }
+                break;
+                case 360: /* check[ \t]+file */
+                {
 {
                     BEGIN(SERVICE_COND);
                     check_state = File_State;
                     return CHECKFILE;
                   }
-	YY_BREAK
-case 320:
-YY_RULE_SETUP
-#line 531 "src/l.l"
+                }
+                break;
+                case 361: /* check[ \t]+fileset */
+                {
+{
+                    BEGIN(SERVICE_COND);
+                    check_state = Fileset_State;
+                    return CHECKFILESET;
+                  }
+                }
+                break;
+                case 362: /* check[ \t]+directory */
+                {
 {
                     BEGIN(SERVICE_COND);
                     check_state = Dir_State;
                     return CHECKDIR;
                   }
-	YY_BREAK
-case 321:
-YY_RULE_SETUP
-#line 537 "src/l.l"
+                }
+                break;
+                case 363: /* check[ \t]+host */
+                {
 {
                     BEGIN(SERVICE_COND);
                     check_state = Host_State;
                     return CHECKHOST;
                   }
-	YY_BREAK
-case 322:
-YY_RULE_SETUP
-#line 543 "src/l.l"
+                }
+                break;
+                case 364: /* check[ \t]+network */
+                {
 {
                     BEGIN(SERVICE_COND);
                     check_state = Net_State;
                     return CHECKNET;
                   }
-	YY_BREAK
-case 323:
-YY_RULE_SETUP
-#line 549 "src/l.l"
+                }
+                break;
+                case 365: /* check[ \t]+fifo */
+                {
 {
                     BEGIN(SERVICE_COND);
                     check_state = Fifo_State;
                     return CHECKFIFO;
                   }
-	YY_BREAK
-case 324:
-YY_RULE_SETUP
-#line 555 "src/l.l"
+                }
+                break;
+                case 366: /* check[ \t]+program */
+                {
 {
                     BEGIN(SERVICE_COND);
                     check_state = Program_State;
                     return CHECKPROGRAM;
                   }
-	YY_BREAK
-case 325:
-YY_RULE_SETUP
-#line 561 "src/l.l"
+                }
+                break;
+                case 367: /* check[ \t]+system */
+                {
 {
                     BEGIN(SERVICE_COND);
                     check_state = System_State;
                     return CHECKSYSTEM;
                   }
-	YY_BREAK
-case 326:
-YY_RULE_SETUP
-#line 567 "src/l.l"
+                }
+                break;
+                case 368: /* group[ \t]+ */
+                {
 {
                     BEGIN(STRING_COND);
                     return GROUP;
                   }
-	YY_BREAK
-case 327:
-YY_RULE_SETUP
-#line 572 "src/l.l"
+                }
+                break;
+                case 369: /* "http headers"{ws} */
+                {
 {
                         BEGIN(HTTP_HEADER_COND);
                         return '[';
                   }
-	YY_BREAK
-case 328:
-YY_RULE_SETUP
-#line 577 "src/l.l"
+                }
+                break;
+                case 370: /* [a-zA-Z0-9]+"://" */
+                {
 {
                     yylval.url = create_URL(Str_ndup(yytext, strlen(yytext)-3));
                     BEGIN(URL_COND);
                   }
-	YY_BREAK
-case 329:
-YY_RULE_SETUP
-#line 582 "src/l.l"
+                }
+                break;
+                case 371: /* {number} */
+                {
 {
                     yylval.number = atoi(yytext);
                     save_arg();
                     return NUMBER;
                   }
-	YY_BREAK
-case 330:
-YY_RULE_SETUP
-#line 588 "src/l.l"
+                }
+                break;
+                case 372: /* {real} */
+                {
 {
                     yylval.real = atof(yytext);
                     save_arg();
                     return REAL;
                   }
-	YY_BREAK
-case 331:
-YY_RULE_SETUP
-#line 594 "src/l.l"
+                }
+                break;
+                case 373: /* {percent} */
+                {
 {
                     return PERCENT;
                   }
-	YY_BREAK
-case 332:
-YY_RULE_SETUP
-#line 598 "src/l.l"
+                }
+                break;
+                case 374: /* [a-zA-Z0-9]{str} */
+                {
 {
                     yylval.string = Str_dup(yytext);
                     save_arg();
                     return STRING;
                   }
-	YY_BREAK
-case 333:
-YY_RULE_SETUP
-#line 604 "src/l.l"
+                }
+                break;
+                case 375: /* \"[/][^\"\n]*\" */
+                {
 {
                     yylval.string = handle_quoted_string(yytext);
                     save_arg();
                     return PATH;
                   }
-	YY_BREAK
-case 334:
-YY_RULE_SETUP
-#line 610 "src/l.l"
+                }
+                break;
+                case 376: /* \'[/][^\'\n]*\' */
+                {
 {
                     yylval.string = handle_quoted_string(yytext);
                     save_arg();
                     return PATH;
                   }
-	YY_BREAK
-case 335:
-/* rule 335 can match eol */
-YY_RULE_SETUP
-#line 616 "src/l.l"
+                }
+                break;
+                case 377: /* \"[^\"]*\" */
+                {
 {
                     steplinenobycr(yytext);
                     yylval.string = handle_quoted_string(yytext);
                     save_arg();
                     return STRING;
                   }
-	YY_BREAK
-case 336:
-/* rule 336 can match eol */
-YY_RULE_SETUP
-#line 623 "src/l.l"
+                }
+                break;
+                case 378: /* \'[^\']*\' */
+                {
 {
                     steplinenobycr(yytext);
                     yylval.string = handle_quoted_string(yytext);
                     save_arg();
                     return STRING;
                   }
-	YY_BREAK
-case 337:
-YY_RULE_SETUP
-#line 630 "src/l.l"
+                }
+                break;
+                case 379: /* {str}[@]{str} */
+                {
 {
                     yylval.string = Str_dup(yytext);
                     save_arg();
                     return MAILADDR;
                   }
-	YY_BREAK
-case 338:
-YY_RULE_SETUP
-#line 636 "src/l.l"
+                }
+                break;
+                case 380: /* [/]{str} */
+                {
 {
                      yylval.string = Str_dup(yytext);
                      save_arg();
                     return PATH;
                   }
-	YY_BREAK
-case 339:
-YY_RULE_SETUP
-#line 642 "src/l.l"
+                }
+                break;
+                case 381: /* "/" */
+                {
 {
                      yylval.string = Str_dup(yytext);
                      save_arg();
                     return PATH;
                   }
-	YY_BREAK
-case 340:
-YY_RULE_SETUP
-#line 648 "src/l.l"
+                }
+                break;
+                case 382: /* "from:"[ \t]* */
+                {
 {
                       yylval.address = Address_new();
                       BEGIN(ADDRESS_COND);
                       return MAILFROM;
                   }
-	YY_BREAK
-case 341:
-YY_RULE_SETUP
-#line 654 "src/l.l"
+                }
+                break;
+                case 383: /* "reply-to:"[ \t]* */
+                {
 {
                       yylval.address = Address_new();
                       BEGIN(ADDRESS_COND);
                       return MAILREPLYTO;
                   }
-	YY_BREAK
-case 342:
-YY_RULE_SETUP
-#line 660 "src/l.l"
+                }
+                break;
+                case 384: /* "subject:"[^}\n]* */
+                {
 {
                       char *p = yytext+strlen("subject:");
                       yylval.string = Str_trim(Str_dup(p));
                       save_arg();
                       return MAILSUBJECT;
                   }
-	YY_BREAK
-case 343:
-/* rule 343 can match eol */
-YY_RULE_SETUP
-#line 667 "src/l.l"
+                }
+                break;
+                case 385: /* "message:"[^}]* */
+                {
 {
                       char *p = yytext+strlen("message:");
                       steplinenobycr(yytext);
@@ -8239,1508 +4794,482 @@ YY_RULE_SETUP
                       save_arg();
                       return MAILBODY;
                   }
-	YY_BREAK
-case 344:
-YY_RULE_SETUP
-#line 675 "src/l.l"
+                }
+                break;
+                case 386: /* {hostname} */
+                {
 {
                       yylval.string = Str_dup(yytext);
                       save_arg();
                       return STRING;
                   }
-	YY_BREAK
-case 345:
-YY_RULE_SETUP
-#line 681 "src/l.l"
+                }
+                break;
+                case 387: /* {ipv4}[/]?[0-9]{0,2} */
+                {
 {
                       yylval.string = Str_dup(yytext);
                       save_arg();
                       return STRING;
                   }
-	YY_BREAK
-case 346:
-YY_RULE_SETUP
-#line 687 "src/l.l"
+                }
+                break;
+                case 388: /* {ipv6}[/]?[0-9]{0,3} */
+                {
 {
                       yylval.string = Str_dup(yytext);
                       save_arg();
                       return STRING;
                   }
-	YY_BREAK
-case 347:
-YY_RULE_SETUP
-#line 693 "src/l.l"
-{
-                      yyerror("unbalanced quotes");
-                  }
-	YY_BREAK
-
-case 348:
-YY_RULE_SETUP
-#line 699 "src/l.l"
-;
-	YY_BREAK
-case 349:
-/* rule 349 can match eol */
-YY_RULE_SETUP
-#line 701 "src/l.l"
-{
-                    lineno++;
-                  }
-	YY_BREAK
-case 350:
-YY_RULE_SETUP
-#line 705 "src/l.l"
-{
-                    yylval.string = Str_dup(yytext);
-                    BEGIN(INITIAL);
-                    save_arg();
-                    return SERVICENAME;
-                  }
-	YY_BREAK
-case 351:
-YY_RULE_SETUP
-#line 712 "src/l.l"
-{
-                    yylval.string = handle_quoted_string(yytext);
-                    BEGIN(INITIAL);
-                    save_arg();
-                    return SERVICENAME;
-                  }
-	YY_BREAK
-case 352:
-YY_RULE_SETUP
-#line 719 "src/l.l"
-{
-                    yylval.string = handle_quoted_string(yytext);
-                    BEGIN(INITIAL);
-                    save_arg();
-                    return SERVICENAME;
-                  }
-	YY_BREAK
-case 353:
-YY_RULE_SETUP
-#line 726 "src/l.l"
+                }
+                break;
+                case 389: /* [\"\'] */
+                {
 {
                       yyerror("unbalanced quotes");
                   }
-	YY_BREAK
-
-
-case 354:
-YY_RULE_SETUP
-#line 734 "src/l.l"
-;
-	YY_BREAK
-case 355:
-/* rule 355 can match eol */
-YY_RULE_SETUP
-#line 736 "src/l.l"
-{
-                    lineno++;
-                  }
-	YY_BREAK
-case 356:
-YY_RULE_SETUP
-#line 740 "src/l.l"
-{
-                    yylval.string = Str_dup(yytext);
-                    save_arg();
-                    return SERVICENAME;
-                  }
-	YY_BREAK
-case 357:
-YY_RULE_SETUP
-#line 746 "src/l.l"
-{
-                    yylval.string = handle_quoted_string(yytext);
-                    save_arg();
-                    return SERVICENAME;
-                  }
-	YY_BREAK
-case 358:
-YY_RULE_SETUP
-#line 752 "src/l.l"
-{
-                    yylval.string = handle_quoted_string(yytext);
-                    save_arg();
-                    return SERVICENAME;
-                  }
-	YY_BREAK
-case 359:
-/* rule 359 can match eol */
-YY_RULE_SETUP
-#line 758 "src/l.l"
-{
-                    steplinenobycr(yytext);
-                    unput(yytext[strlen(yytext)-1]);
-                    BEGIN(INITIAL);
-                  }
-	YY_BREAK
-
-
-case 360:
-YY_RULE_SETUP
-#line 768 "src/l.l"
+                }
+                break;
+                case 390: /* {ws} */
+                {
 ;
-	YY_BREAK
-case 361:
-/* rule 361 can match eol */
-YY_RULE_SETUP
-#line 770 "src/l.l"
+                }
+                break;
+                case 391: /* [\n] */
+                {
 {
                     lineno++;
                   }
-	YY_BREAK
-case 362:
-YY_RULE_SETUP
-#line 774 "src/l.l"
-{
-                      BEGIN(INITIAL);
-                  }
-	YY_BREAK
-case 363:
-/* rule 363 can match eol */
-YY_RULE_SETUP
-#line 778 "src/l.l"
-{
-                      steplinenobycr(yytext);
-                      yylval.string = handle_quoted_string(yytext);
-                      save_arg();
-                      return STRING;
-                  }
-	YY_BREAK
-case 364:
-YY_RULE_SETUP
-#line 785 "src/l.l"
-{
-                      yyerror("unbalanced quotes");
-                  }
-	YY_BREAK
-case 365:
-YY_RULE_SETUP
-#line 789 "src/l.l"
-{
-                      yylval.string = Str_dup(yytext);
-                      save_arg();
-                      return STRING;
-                  }
-	YY_BREAK
-
-
-case 366:
-/* rule 366 can match eol */
-YY_RULE_SETUP
-#line 799 "src/l.l"
-{
-                      BEGIN(INITIAL);
-                      if (! yylval.url->hostname)
-                                yyerror("missing hostname in URL");
-                      if (! yylval.url->path)
-                                yylval.url->path = Str_dup("/");
-                      yylval.url->url = Str_cat("%s://[%s]:%d%s%s%s",
-                                yylval.url->protocol,
-                                /* possible credentials are hidden */
-                                yylval.url->hostname,
-                                yylval.url->port,
-                                yylval.url->path,
-                                yylval.url->query ? "?" : "",
-                                yylval.url->query ? yylval.url->query : "");
-                      save_arg();
-                      return URLOBJECT;
-                  }
-	YY_BREAK
-case 367:
-/* rule 367 can match eol */
-YY_RULE_SETUP
-#line 817 "src/l.l"
-{
-                      yylval.url->user = Str_dup(yytext);
-                  }
-	YY_BREAK
-case 368:
-/* rule 368 can match eol */
-YY_RULE_SETUP
-#line 821 "src/l.l"
-{
-                      yytext++;
-                      yylval.url->password = Str_ndup(yytext, strlen(yytext)-1);
-                  }
-	YY_BREAK
-case 369:
-YY_RULE_SETUP
-#line 826 "src/l.l"
-{
-                      yylval.url->hostname = Str_dup(yytext);
-                  }
-	YY_BREAK
-case 370:
-YY_RULE_SETUP
-#line 830 "src/l.l"
-{
-                      yylval.url->hostname = Str_ndup(yytext + 1, yyleng - 2);
-                      yylval.url->ipv6 = true;
-                  }
-	YY_BREAK
-case 371:
-YY_RULE_SETUP
-#line 835 "src/l.l"
-{
-                      yylval.url->port = atoi(++yytext);
-                  }
-	YY_BREAK
-case 372:
-YY_RULE_SETUP
-#line 839 "src/l.l"
-{
-                      yylval.url->path = Util_urlEncode(yytext, false);
-                  }
-	YY_BREAK
-case 373:
-YY_RULE_SETUP
-#line 843 "src/l.l"
-{
-                      yylval.url->query = Util_urlEncode(++yytext, false);
-                  }
-	YY_BREAK
-case 374:
-YY_RULE_SETUP
-#line 847 "src/l.l"
-{
-                      /* EMPTY - reference is ignored */
-                  }
-	YY_BREAK
-
-
-case 375:
-/* rule 375 can match eol */
-YY_RULE_SETUP
-#line 855 "src/l.l"
-{
-                        if (yytext[0] == '}')
-                                yyless(0);
-                        BEGIN(INITIAL);
-                        if (! yylval.address->address)
-                                yyerror("missing address");
-                        save_arg();
-                        return ADDRESSOBJECT;
-                }
-	YY_BREAK
-case 376:
-YY_RULE_SETUP
-#line 865 "src/l.l"
-{
-                        yylval.address->address = Str_dup(yytext);
-                }
-	YY_BREAK
-case 377:
-YY_RULE_SETUP
-#line 869 "src/l.l"
-{
-                        char *name = Str_unquote(Str_dup(yytext));
-                        if (name) {
-                                if (*name)
-                                        yylval.address->name = name;
-                                else
-                                        // Empty quoted string
-                                        FREE(name);
-                        }
-                }
-	YY_BREAK
-case 378:
-YY_RULE_SETUP
-#line 880 "src/l.l"
-{
-                        // Ignore
                 }
-	YY_BREAK
-case 379:
-YY_RULE_SETUP
-#line 884 "src/l.l"
-{
-                        BEGIN(INITIAL);
-                        yyerror("invalid mail format");
-                }
-	YY_BREAK
-
-
-case 380:
-YY_RULE_SETUP
-#line 892 "src/l.l"
+                break;
+                case 392: /* {str} */
+                {
 {
                     yylval.string = Str_dup(yytext);
                     BEGIN(INITIAL);
                     save_arg();
-                    return STRINGNAME;
+                    return SERVICENAME;
                   }
-	YY_BREAK
-case 381:
-YY_RULE_SETUP
-#line 899 "src/l.l"
+                }
+                break;
+                case 393: /* \"[^\000-\037\"\n]+\" */
+                {
 {
                     yylval.string = handle_quoted_string(yytext);
                     BEGIN(INITIAL);
                     save_arg();
-                    return STRINGNAME;
+                    return SERVICENAME;
                   }
-	YY_BREAK
-case 382:
-YY_RULE_SETUP
-#line 906 "src/l.l"
+                }
+                break;
+                case 394: /* \'[^\000-\037\"\n]+\' */
+                {
 {
                     yylval.string = handle_quoted_string(yytext);
                     BEGIN(INITIAL);
                     save_arg();
-                    return STRINGNAME;
+                    return SERVICENAME;
                   }
-	YY_BREAK
-case 383:
-YY_RULE_SETUP
-#line 913 "src/l.l"
+                }
+                break;
+                case 395: /* [\"]|[\'] */
+                {
 {
                       yyerror("unbalanced quotes");
                   }
-	YY_BREAK
-
-
-case 384:
-YY_RULE_SETUP
-#line 921 "src/l.l"
+                }
+                break;
+                case 396: /* {wws} */
+                {
 ;
-	YY_BREAK
-case 385:
-YY_RULE_SETUP
-#line 923 "src/l.l"
+                }
+                break;
+                case 397: /* {wws}?[\n]{wws}? */
+                {
 {
-                    yylval.number = atoi(yytext);
-                    BEGIN(INITIAL);
-                    save_arg();
-                    return NUMBER;
+                    lineno++;
                   }
-	YY_BREAK
-case 386:
-YY_RULE_SETUP
-#line 930 "src/l.l"
-{ // A minimal syntax check of the cron format string; 5 fields separated with white-space
-                    yylval.string = Str_dup(Str_unquote(yytext));
-                    BEGIN(INITIAL);
+                }
+                break;
+                case 398: /* {str} */
+                {
+{
+                    yylval.string = Str_dup(yytext);
                     save_arg();
-                    return TIMESPEC;
+                    return SERVICENAME;
                   }
-	YY_BREAK
-case 387:
-YY_RULE_SETUP
-#line 937 "src/l.l"
+                }
+                break;
+                case 399: /* \"[^\000-\037\"\n]+\" */
+                {
 {
-                      BEGIN(INITIAL);
-                      yyerror("invalid every format");
+                    yylval.string = handle_quoted_string(yytext);
+                    save_arg();
+                    return SERVICENAME;
                   }
-	YY_BREAK
-
-
-case 388:
-YY_RULE_SETUP
-#line 946 "src/l.l"
-;
-	YY_BREAK
-case 389:
-YY_RULE_SETUP
-#line 948 "src/l.l"
-;
-	YY_BREAK
-case 390:
-/* rule 390 can match eol */
-YY_RULE_SETUP
-#line 950 "src/l.l"
+                }
+                break;
+                case 400: /* \'[^\000-\037\"\n]+\' */
+                {
 {
-                        lineno++;
+                    yylval.string = handle_quoted_string(yytext);
+                    save_arg();
+                    return SERVICENAME;
+                  }
                 }
-	YY_BREAK
-case 391:
-*yy_cp = (yy_hold_char); /* undo effects of setting up yytext */
-(yy_c_buf_p) = yy_cp -= 1;
-YY_DO_BEFORE_ACTION; /* set up yytext again */
-YY_RULE_SETUP
-#line 954 "src/l.l"
-{ // name/:
-                        save_arg();
+                break;
+                case 401: /* [ \r\n\t]+[^,] */
+                {
+{
+                    steplinenobycr(yytext);
+                    unput(yytext[strlen(yytext)-1]);
+                    BEGIN(INITIAL);
+                  }
                 }
-	YY_BREAK
-case 392:
-/* rule 392 can match eol */
-YY_RULE_SETUP
-#line 958 "src/l.l"
-{ // : value
-                        yylval.string = Str_cat("%s:%s", Str_trim(argyytext), Str_unquote(yytext + 1));
-                        save_arg();
-                        return HTTPHEADER;
+                break;
+                case 402: /* {ws} */
+                {
+;
                 }
-	YY_BREAK
-case 393:
-YY_RULE_SETUP
-#line 964 "src/l.l"
+                break;
+                case 403: /* [\n] */
+                {
 {
-                        BEGIN(INITIAL);
-                        save_arg();
-                        return ']';
+                    lineno++;
+                  }
                 }
-	YY_BREAK
-case 394:
-YY_RULE_SETUP
-#line 970 "src/l.l"
+                break;
+                case 404: /* \" */
+                {
 {
-                        BEGIN(INITIAL);
-                        yyerror("invalid HTTP header list format");
+                      BEGIN(INITIAL);
+                  }
                 }
-	YY_BREAK
-
-case 395:
-YY_RULE_SETUP
-#line 978 "src/l.l"
+                break;
+                case 405: /* \'[^\']*\' */
+                {
 {
-                      check_state = None_State;
-                      return yytext[0];
+                      steplinenobycr(yytext);
+                      yylval.string = handle_quoted_string(yytext);
+                      save_arg();
+                      return STRING;
                   }
-	YY_BREAK
-case 396:
-YY_RULE_SETUP
-#line 984 "src/l.l"
-/* eat the whitespace */
-	YY_BREAK
-case 397:
-YY_RULE_SETUP
-#line 986 "src/l.l"
-{ /* got the include file name with double quotes */
-                     char *temp = Str_dup(yytext);
-                     Str_unquote(temp);
-                     include_file(temp);
-                     FREE(temp);
-                     BEGIN(INITIAL);
-                   }
-	YY_BREAK
-case 398:
-YY_RULE_SETUP
-#line 994 "src/l.l"
-{ /* got the include file name with single quotes*/
-                     char *temp = Str_dup(yytext);
-                     Str_unquote(temp);
-                     include_file(temp);
-                     FREE(temp);
-                     BEGIN(INITIAL);
-                   }
-	YY_BREAK
-case 399:
-YY_RULE_SETUP
-#line 1002 "src/l.l"
-{ /* got the include file name without quotes*/
-                     char *temp = Str_dup(yytext);
-                     include_file(temp);
-                     FREE(temp);
-                     BEGIN(INITIAL);
-                   }
-	YY_BREAK
-case YY_STATE_EOF(INITIAL):
-case YY_STATE_EOF(ARGUMENT_COND):
-case YY_STATE_EOF(DEPEND_COND):
-case YY_STATE_EOF(SERVICE_COND):
-case YY_STATE_EOF(URL_COND):
-case YY_STATE_EOF(ADDRESS_COND):
-case YY_STATE_EOF(STRING_COND):
-case YY_STATE_EOF(EVERY_COND):
-case YY_STATE_EOF(HTTP_HEADER_COND):
-case YY_STATE_EOF(INCLUDE):
-#line 1010 "src/l.l"
+                }
+                break;
+                case 406: /* \' */
+                {
 {
-
-                       BEGIN(INITIAL);
-                       check_state = None_State;
-                       if (! pop_buffer_state())
-                                yyterminate();
+                      yyerror("unbalanced quotes");
                   }
-	YY_BREAK
-case 400:
-YY_RULE_SETUP
-#line 1018 "src/l.l"
-ECHO;
-	YY_BREAK
-#line 8767 "src/lex.yy.c"
-
-	case YY_END_OF_BUFFER:
-		{
-		/* Amount of text matched not including the EOB char. */
-		int yy_amount_of_matched_text = (int) (yy_cp - (yytext_ptr)) - 1;
-
-		/* Undo the effects of YY_DO_BEFORE_ACTION. */
-		*yy_cp = (yy_hold_char);
-		YY_RESTORE_YY_MORE_OFFSET
-
-		if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_NEW )
-			{
-			/* We're scanning a new file or input source.  It's
-			 * possible that this happened because the user
-			 * just pointed yyin at a new source and called
-			 * yylex().  If so, then we have to assure
-			 * consistency between YY_CURRENT_BUFFER and our
-			 * globals.  Here is the right place to do so, because
-			 * this is the first action (other than possibly a
-			 * back-up) that will match for the new input source.
-			 */
-			(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
-			YY_CURRENT_BUFFER_LVALUE->yy_input_file = yyin;
-			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status = YY_BUFFER_NORMAL;
-			}
-
-		/* Note that here we test for yy_c_buf_p "<=" to the position
-		 * of the first EOB in the buffer, since yy_c_buf_p will
-		 * already have been incremented past the NUL character
-		 * (since all states make transitions on EOB to the
-		 * end-of-buffer state).  Contrast this with the test
-		 * in input().
-		 */
-		if ( (yy_c_buf_p) <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
-			{ /* This was really a NUL. */
-			yy_state_type yy_next_state;
-
-			(yy_c_buf_p) = (yytext_ptr) + yy_amount_of_matched_text;
-
-			yy_current_state = yy_get_previous_state(  );
-
-			/* Okay, we're now positioned to make the NUL
-			 * transition.  We couldn't have
-			 * yy_get_previous_state() go ahead and do it
-			 * for us because it doesn't know how to deal
-			 * with the possibility of jamming (and we don't
-			 * want to build jamming into it because then it
-			 * will run more slowly).
-			 */
-
-			yy_next_state = yy_try_NUL_trans( yy_current_state );
-
-			yy_bp = (yytext_ptr) + YY_MORE_ADJ;
-
-			if ( yy_next_state )
-				{
-				/* Consume the NUL. */
-				yy_cp = ++(yy_c_buf_p);
-				yy_current_state = yy_next_state;
-				goto yy_match;
-				}
-
-			else
-				{
-				yy_cp = (yy_c_buf_p);
-				goto yy_find_action;
-				}
-			}
-
-		else switch ( yy_get_next_buffer(  ) )
-			{
-			case EOB_ACT_END_OF_FILE:
-				{
-				(yy_did_buffer_switch_on_eof) = 0;
-
-				if ( yywrap(  ) )
-					{
-					/* Note: because we've taken care in
-					 * yy_get_next_buffer() to have set up
-					 * yytext, we can now set up
-					 * yy_c_buf_p so that if some total
-					 * hoser (like flex itself) wants to
-					 * call the scanner after we return the
-					 * YY_NULL, it'll still work - another
-					 * YY_NULL will get returned.
-					 */
-					(yy_c_buf_p) = (yytext_ptr) + YY_MORE_ADJ;
-
-					yy_act = YY_STATE_EOF(YY_START);
-					goto do_action;
-					}
-
-				else
-					{
-					if ( ! (yy_did_buffer_switch_on_eof) )
-						YY_NEW_FILE;
-					}
-				break;
-				}
-
-			case EOB_ACT_CONTINUE_SCAN:
-				(yy_c_buf_p) =
-					(yytext_ptr) + yy_amount_of_matched_text;
-
-				yy_current_state = yy_get_previous_state(  );
-
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
-				goto yy_match;
-
-			case EOB_ACT_LAST_MATCH:
-				(yy_c_buf_p) =
-				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)];
-
-				yy_current_state = yy_get_previous_state(  );
-
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
-				goto yy_find_action;
-			}
-		break;
-		}
-
-	default:
-		YY_FATAL_ERROR(
-			"fatal flex scanner internal error--no action found" );
-	} /* end of action switch */
-		} /* end of scanning one token */
-	} /* end of user's declarations */
-} /* end of yylex */
-
-/* yy_get_next_buffer - try to read in a new buffer
- *
- * Returns a code representing an action:
- *	EOB_ACT_LAST_MATCH -
- *	EOB_ACT_CONTINUE_SCAN - continue scanning from current position
- *	EOB_ACT_END_OF_FILE - end of file
- */
-static int yy_get_next_buffer (void)
-{
-    	char *dest = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf;
-	char *source = (yytext_ptr);
-	int number_to_move, i;
-	int ret_val;
-
-	if ( (yy_c_buf_p) > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] )
-		YY_FATAL_ERROR(
-		"fatal flex scanner internal error--end of buffer missed" );
-
-	if ( YY_CURRENT_BUFFER_LVALUE->yy_fill_buffer == 0 )
-		{ /* Don't try to fill the buffer, so this is an EOF. */
-		if ( (yy_c_buf_p) - (yytext_ptr) - YY_MORE_ADJ == 1 )
-			{
-			/* We matched a single character, the EOB, so
-			 * treat this as a final EOF.
-			 */
-			return EOB_ACT_END_OF_FILE;
-			}
-
-		else
-			{
-			/* We matched some text prior to the EOB, first
-			 * process it.
-			 */
-			return EOB_ACT_LAST_MATCH;
-			}
-		}
-
-	/* Try to read more data. */
-
-	/* First move last chars to start of buffer. */
-	number_to_move = (int) ((yy_c_buf_p) - (yytext_ptr) - 1);
-
-	for ( i = 0; i < number_to_move; ++i )
-		*(dest++) = *(source++);
-
-	if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_EOF_PENDING )
-		/* don't do the read, it's not guaranteed to return an EOF,
-		 * just force an EOF
-		 */
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars) = 0;
-
-	else
-		{
-			int num_to_read =
-			YY_CURRENT_BUFFER_LVALUE->yy_buf_size - number_to_move - 1;
-
-		while ( num_to_read <= 0 )
-			{ /* Not enough room in the buffer - grow it. */
-
-			YY_FATAL_ERROR(
-"input buffer overflow, can't enlarge buffer because scanner uses REJECT" );
-
-			}
-
-		if ( num_to_read > YY_READ_BUF_SIZE )
-			num_to_read = YY_READ_BUF_SIZE;
-
-		/* Read in more data. */
-		YY_INPUT( (&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[number_to_move]),
-			(yy_n_chars), num_to_read );
-
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
-		}
-
-	if ( (yy_n_chars) == 0 )
-		{
-		if ( number_to_move == YY_MORE_ADJ )
-			{
-			ret_val = EOB_ACT_END_OF_FILE;
-			yyrestart( yyin  );
-			}
-
-		else
-			{
-			ret_val = EOB_ACT_LAST_MATCH;
-			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status =
-				YY_BUFFER_EOF_PENDING;
-			}
-		}
-
-	else
-		ret_val = EOB_ACT_CONTINUE_SCAN;
-
-	if (((yy_n_chars) + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
-		/* Extend the array by 50%, plus the number we really need. */
-		int new_size = (yy_n_chars) + number_to_move + ((yy_n_chars) >> 1);
-		YY_CURRENT_BUFFER_LVALUE->yy_ch_buf = (char *) yyrealloc(
-			(void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf, (yy_size_t) new_size  );
-		if ( ! YY_CURRENT_BUFFER_LVALUE->yy_ch_buf )
-			YY_FATAL_ERROR( "out of dynamic memory in yy_get_next_buffer()" );
-		/* "- 2" to take care of EOB's */
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_size = (int) (new_size - 2);
-	}
-
-	(yy_n_chars) += number_to_move;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] = YY_END_OF_BUFFER_CHAR;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] = YY_END_OF_BUFFER_CHAR;
-
-	(yytext_ptr) = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
-
-	return ret_val;
-}
-
-/* yy_get_previous_state - get the state just before the EOB char was reached */
-
-    static yy_state_type yy_get_previous_state (void)
-{
-	yy_state_type yy_current_state;
-	char *yy_cp;
-    
-	yy_current_state = (yy_start);
-
-	(yy_state_ptr) = (yy_state_buf);
-	*(yy_state_ptr)++ = yy_current_state;
-
-	for ( yy_cp = (yytext_ptr) + YY_MORE_ADJ; yy_cp < (yy_c_buf_p); ++yy_cp )
-		{
-		YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 1);
-		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-			{
-			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 2703 )
-				yy_c = yy_meta[yy_c];
-			}
-		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-		*(yy_state_ptr)++ = yy_current_state;
-		}
-
-	return yy_current_state;
-}
-
-/* yy_try_NUL_trans - try to make a transition on the NUL character
- *
- * synopsis
- *	next_state = yy_try_NUL_trans( current_state );
- */
-    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state )
-{
-	int yy_is_jam;
-    
-	YY_CHAR yy_c = 1;
-	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-		{
-		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 2703 )
-			yy_c = yy_meta[yy_c];
-		}
-	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 2702);
-	if ( ! yy_is_jam )
-		*(yy_state_ptr)++ = yy_current_state;
-
-		return yy_is_jam ? 0 : yy_current_state;
-}
-
-#ifndef YY_NO_UNPUT
-
-    static void yyunput (int c, char * yy_bp )
-{
-	char *yy_cp;
-    
-    yy_cp = (yy_c_buf_p);
-
-	/* undo effects of setting up yytext */
-	*yy_cp = (yy_hold_char);
-
-	if ( yy_cp < YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + 2 )
-		{ /* need to shift things up to make room */
-		/* +2 for EOB chars. */
-		int number_to_move = (yy_n_chars) + 2;
-		char *dest = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[
-					YY_CURRENT_BUFFER_LVALUE->yy_buf_size + 2];
-		char *source =
-				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[number_to_move];
-
-		while ( source > YY_CURRENT_BUFFER_LVALUE->yy_ch_buf )
-			*--dest = *--source;
-
-		yy_cp += (int) (dest - source);
-		yy_bp += (int) (dest - source);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars =
-			(yy_n_chars) = (int) YY_CURRENT_BUFFER_LVALUE->yy_buf_size;
-
-		if ( yy_cp < YY_CURRENT_BUFFER_LVALUE->yy_ch_buf + 2 )
-			YY_FATAL_ERROR( "flex scanner push-back overflow" );
-		}
-
-	*--yy_cp = (char) c;
-
-	(yytext_ptr) = yy_bp;
-	(yy_hold_char) = *yy_cp;
-	(yy_c_buf_p) = yy_cp;
-}
-
-#endif
-
-#ifndef YY_NO_INPUT
-#ifdef __cplusplus
-    static int yyinput (void)
-#else
-    static int input  (void)
-#endif
-
-{
-	int c;
-    
-	*(yy_c_buf_p) = (yy_hold_char);
-
-	if ( *(yy_c_buf_p) == YY_END_OF_BUFFER_CHAR )
-		{
-		/* yy_c_buf_p now points to the character we want to return.
-		 * If this occurs *before* the EOB characters, then it's a
-		 * valid NUL; if not, then we've hit the end of the buffer.
-		 */
-		if ( (yy_c_buf_p) < &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
-			/* This was really a NUL. */
-			*(yy_c_buf_p) = '\0';
-
-		else
-			{ /* need more input */
-			int offset = (int) ((yy_c_buf_p) - (yytext_ptr));
-			++(yy_c_buf_p);
-
-			switch ( yy_get_next_buffer(  ) )
-				{
-				case EOB_ACT_LAST_MATCH:
-					/* This happens because yy_g_n_b()
-					 * sees that we've accumulated a
-					 * token and flags that we need to
-					 * try matching the token before
-					 * proceeding.  But for input(),
-					 * there's no matching to consider.
-					 * So convert the EOB_ACT_LAST_MATCH
-					 * to EOB_ACT_END_OF_FILE.
-					 */
-
-					/* Reset buffer status. */
-					yyrestart( yyin );
-
-					/*FALLTHROUGH*/
-
-				case EOB_ACT_END_OF_FILE:
-					{
-					if ( yywrap(  ) )
-						return 0;
-
-					if ( ! (yy_did_buffer_switch_on_eof) )
-						YY_NEW_FILE;
-#ifdef __cplusplus
-					return yyinput();
-#else
-					return input();
-#endif
-					}
-
-				case EOB_ACT_CONTINUE_SCAN:
-					(yy_c_buf_p) = (yytext_ptr) + offset;
-					break;
-				}
-			}
-		}
-
-	c = *(unsigned char *) (yy_c_buf_p);	/* cast for 8-bit char's */
-	*(yy_c_buf_p) = '\0';	/* preserve yytext */
-	(yy_hold_char) = *++(yy_c_buf_p);
-
-	return c;
-}
-#endif	/* ifndef YY_NO_INPUT */
-
-/** Immediately switch to a different input stream.
- * @param input_file A readable stream.
- * 
- * @note This function does not reset the start condition to @c INITIAL .
- */
-    void yyrestart  (FILE * input_file )
-{
-    
-	if ( ! YY_CURRENT_BUFFER ){
-        yyensure_buffer_stack ();
-		YY_CURRENT_BUFFER_LVALUE =
-            yy_create_buffer( yyin, YY_BUF_SIZE );
-	}
-
-	yy_init_buffer( YY_CURRENT_BUFFER, input_file );
-	yy_load_buffer_state(  );
-}
-
-/** Switch to a different input buffer.
- * @param new_buffer The new input buffer.
- * 
- */
-    void yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer )
-{
-    
-	/* TODO. We should be able to replace this entire function body
-	 * with
-	 *		yypop_buffer_state();
-	 *		yypush_buffer_state(new_buffer);
-     */
-	yyensure_buffer_stack ();
-	if ( YY_CURRENT_BUFFER == new_buffer )
-		return;
-
-	if ( YY_CURRENT_BUFFER )
-		{
-		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
-		}
-
-	YY_CURRENT_BUFFER_LVALUE = new_buffer;
-	yy_load_buffer_state(  );
-
-	/* We don't actually know whether we did this switch during
-	 * EOF (yywrap()) processing, but the only time this flag
-	 * is looked at is after yywrap() is called, so it's safe
-	 * to go ahead and always set it.
-	 */
-	(yy_did_buffer_switch_on_eof) = 1;
-}
-
-static void yy_load_buffer_state  (void)
-{
-    	(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
-	(yytext_ptr) = (yy_c_buf_p) = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
-	yyin = YY_CURRENT_BUFFER_LVALUE->yy_input_file;
-	(yy_hold_char) = *(yy_c_buf_p);
-}
-
-/** Allocate and initialize an input buffer state.
- * @param file A readable stream.
- * @param size The character buffer size in bytes. When in doubt, use @c YY_BUF_SIZE.
- * 
- * @return the allocated buffer state.
- */
-    YY_BUFFER_STATE yy_create_buffer  (FILE * file, int  size )
-{
-	YY_BUFFER_STATE b;
-    
-	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  );
-	if ( ! b )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
-
-	b->yy_buf_size = size;
-
-	/* yy_ch_buf has to be 2 characters longer than the size given because
-	 * we need to put in 2 end-of-buffer characters.
-	 */
-	b->yy_ch_buf = (char *) yyalloc( (yy_size_t) (b->yy_buf_size + 2)  );
-	if ( ! b->yy_ch_buf )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
-
-	b->yy_is_our_buffer = 1;
-
-	yy_init_buffer( b, file );
-
-	return b;
-}
-
-/** Destroy the buffer.
- * @param b a buffer created with yy_create_buffer()
- * 
- */
-    void yy_delete_buffer (YY_BUFFER_STATE  b )
-{
-    
-	if ( ! b )
-		return;
-
-	if ( b == YY_CURRENT_BUFFER ) /* Not sure if we should pop here. */
-		YY_CURRENT_BUFFER_LVALUE = (YY_BUFFER_STATE) 0;
-
-	if ( b->yy_is_our_buffer )
-		yyfree( (void *) b->yy_ch_buf  );
-
-	yyfree( (void *) b  );
-}
-
-/* Initializes or reinitializes a buffer.
- * This function is sometimes called more than once on the same buffer,
- * such as during a yyrestart() or at EOF.
- */
-    static void yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file )
-
-{
-	int oerrno = errno;
-    
-	yy_flush_buffer( b );
-
-	b->yy_input_file = file;
-	b->yy_fill_buffer = 1;
-
-    /* If b is the current buffer, then yy_init_buffer was _probably_
-     * called from yyrestart() or through yy_get_next_buffer.
-     * In that case, we don't want to reset the lineno or column.
-     */
-    if (b != YY_CURRENT_BUFFER){
-        b->yy_bs_lineno = 1;
-        b->yy_bs_column = 0;
-    }
-
-        b->yy_is_interactive = file ? (isatty( fileno(file) ) > 0) : 0;
-    
-	errno = oerrno;
-}
-
-/** Discard all buffered characters. On the next scan, YY_INPUT will be called.
- * @param b the buffer state to be flushed, usually @c YY_CURRENT_BUFFER.
- * 
- */
-    void yy_flush_buffer (YY_BUFFER_STATE  b )
+                }
+                break;
+                case 407: /* [^ \t\n\"]+ */
+                {
 {
-    	if ( ! b )
-		return;
-
-	b->yy_n_chars = 0;
-
-	/* We always need two end-of-buffer characters.  The first causes
-	 * a transition to the end-of-buffer state.  The second causes
-	 * a jam in that state.
-	 */
-	b->yy_ch_buf[0] = YY_END_OF_BUFFER_CHAR;
-	b->yy_ch_buf[1] = YY_END_OF_BUFFER_CHAR;
-
-	b->yy_buf_pos = &b->yy_ch_buf[0];
-
-	b->yy_at_bol = 1;
-	b->yy_buffer_status = YY_BUFFER_NEW;
-
-	if ( b == YY_CURRENT_BUFFER )
-		yy_load_buffer_state(  );
-}
-
-/** Pushes the new state onto the stack. The new state becomes
- *  the current state. This function will allocate the stack
- *  if necessary.
- *  @param new_buffer The new state.
- *  
- */
-void yypush_buffer_state (YY_BUFFER_STATE new_buffer )
+                      yylval.string = Str_dup(yytext);
+                      save_arg();
+                      return STRING;
+                  }
+                }
+                break;
+                case 408: /* {ws}|[\n] */
+                {
 {
-    	if (new_buffer == NULL)
-		return;
-
-	yyensure_buffer_stack();
-
-	/* This block is copied from yy_switch_to_buffer. */
-	if ( YY_CURRENT_BUFFER )
-		{
-		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
-		}
-
-	/* Only push if top exists. Otherwise, replace top. */
-	if (YY_CURRENT_BUFFER)
-		(yy_buffer_stack_top)++;
-	YY_CURRENT_BUFFER_LVALUE = new_buffer;
-
-	/* copied from yy_switch_to_buffer. */
-	yy_load_buffer_state(  );
-	(yy_did_buffer_switch_on_eof) = 1;
-}
-
-/** Removes and deletes the top of the stack, if present.
- *  The next element becomes the new top.
- *  
- */
-void yypop_buffer_state (void)
+                      BEGIN(INITIAL);
+                      if (! yylval.url->hostname)
+                                yyerror("missing hostname in URL");
+                      if (! yylval.url->path)
+                                yylval.url->path = Str_dup("/");
+                      yylval.url->url = Str_cat("%s://[%s]:%d%s%s%s",
+                                yylval.url->protocol,
+                                /* possible credentials are hidden */
+                                yylval.url->hostname,
+                                yylval.url->port,
+                                yylval.url->path,
+                                yylval.url->query ? "?" : "",
+                                yylval.url->query ? yylval.url->query : "");
+                      save_arg();
+                      return URLOBJECT;
+                  }
+                }
+                break;
+                case 409: /* [^:@ ]+/[:][^@: ]+[@] */
+                {
 {
-    	if (!YY_CURRENT_BUFFER)
-		return;
-
-	yy_delete_buffer(YY_CURRENT_BUFFER );
-	YY_CURRENT_BUFFER_LVALUE = NULL;
-	if ((yy_buffer_stack_top) > 0)
-		--(yy_buffer_stack_top);
-
-	if (YY_CURRENT_BUFFER) {
-		yy_load_buffer_state(  );
-		(yy_did_buffer_switch_on_eof) = 1;
-	}
-}
-
-/* Allocates the stack if it does not exist.
- *  Guarantees space for at least one push.
- */
-static void yyensure_buffer_stack (void)
+                      yylval.url->user = Str_dup(yytext);
+                  }
+                }
+                break;
+                case 410: /* [:][^@ ]+[@] */
+                {
 {
-	yy_size_t num_to_alloc;
-    
-	if (!(yy_buffer_stack)) {
-
-		/* First allocation is just for 2 elements, since we don't know if this
-		 * scanner will even need a stack. We use 2 instead of 1 to avoid an
-		 * immediate realloc on the next call.
-         */
-      num_to_alloc = 1; /* After all that talk, this was set to 1 anyways... */
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyalloc
-								(num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
-			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
-
-		memset((yy_buffer_stack), 0, num_to_alloc * sizeof(struct yy_buffer_state*));
-
-		(yy_buffer_stack_max) = num_to_alloc;
-		(yy_buffer_stack_top) = 0;
-		return;
-	}
-
-	if ((yy_buffer_stack_top) >= ((yy_buffer_stack_max)) - 1){
-
-		/* Increase the buffer to prepare for a possible push. */
-		yy_size_t grow_size = 8 /* arbitrary grow size */;
-
-		num_to_alloc = (yy_buffer_stack_max) + grow_size;
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyrealloc
-								((yy_buffer_stack),
-								num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
-			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
-
-		/* zero only the new slots.*/
-		memset((yy_buffer_stack) + (yy_buffer_stack_max), 0, grow_size * sizeof(struct yy_buffer_state*));
-		(yy_buffer_stack_max) = num_to_alloc;
-	}
-}
-
-/** Setup the input buffer state to scan directly from a user-specified character buffer.
- * @param base the character buffer
- * @param size the size in bytes of the character buffer
- * 
- * @return the newly allocated buffer state object.
- */
-YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
+                      yytext++;
+                      yylval.url->password = Str_ndup(yytext, strlen(yytext)-1);
+                  }
+                }
+                break;
+                case 411: /* ([a-zA-Z0-9\-]+)([.]([a-zA-Z0-9\-]+))* */
+                {
 {
-	YY_BUFFER_STATE b;
-    
-	if ( size < 2 ||
-	     base[size-2] != YY_END_OF_BUFFER_CHAR ||
-	     base[size-1] != YY_END_OF_BUFFER_CHAR )
-		/* They forgot to leave room for the EOB's. */
-		return NULL;
-
-	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  );
-	if ( ! b )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_buffer()" );
-
-	b->yy_buf_size = (int) (size - 2);	/* "- 2" to take care of EOB's */
-	b->yy_buf_pos = b->yy_ch_buf = base;
-	b->yy_is_our_buffer = 0;
-	b->yy_input_file = NULL;
-	b->yy_n_chars = b->yy_buf_size;
-	b->yy_is_interactive = 0;
-	b->yy_at_bol = 1;
-	b->yy_fill_buffer = 0;
-	b->yy_buffer_status = YY_BUFFER_NEW;
-
-	yy_switch_to_buffer( b  );
-
-	return b;
-}
-
-/** Setup the input buffer state to scan a string. The next call to yylex() will
- * scan from a @e copy of @a str.
- * @param yystr a NUL-terminated string to scan
- * 
- * @return the newly allocated buffer state object.
- * @note If you want to scan bytes that may contain NUL values, then use
- *       yy_scan_bytes() instead.
- */
-YY_BUFFER_STATE yy_scan_string (const char * yystr )
+                      yylval.url->hostname = Str_dup(yytext);
+                  }
+                }
+                break;
+                case 412: /* \[[0-9a-zA-Z.:%]+\] */
+                {
 {
-    
-	return yy_scan_bytes( yystr, (int) strlen(yystr) );
-}
-
-/** Setup the input buffer state to scan the given bytes. The next call to yylex() will
- * scan from a @e copy of @a bytes.
- * @param yybytes the byte buffer to scan
- * @param _yybytes_len the number of bytes in the buffer pointed to by @a bytes.
- * 
- * @return the newly allocated buffer state object.
- */
-YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, int  _yybytes_len )
+                      yylval.url->hostname = Str_ndup(yytext + 1, yyleng - 2);
+                      yylval.url->ipv6 = true;
+                  }
+                }
+                break;
+                case 413: /* [:]{number} */
+                {
 {
-	YY_BUFFER_STATE b;
-	char *buf;
-	yy_size_t n;
-	int i;
-    
-	/* Get memory for full buffer, including space for trailing EOB's. */
-	n = (yy_size_t) (_yybytes_len + 2);
-	buf = (char *) yyalloc( n  );
-	if ( ! buf )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_bytes()" );
-
-	for ( i = 0; i < _yybytes_len; ++i )
-		buf[i] = yybytes[i];
-
-	buf[_yybytes_len] = buf[_yybytes_len+1] = YY_END_OF_BUFFER_CHAR;
-
-	b = yy_scan_buffer( buf, n );
-	if ( ! b )
-		YY_FATAL_ERROR( "bad buffer in yy_scan_bytes()" );
-
-	/* It's okay to grow etc. this buffer, and we should throw it
-	 * away when we're done.
-	 */
-	b->yy_is_our_buffer = 1;
-
-	return b;
-}
-
-#ifndef YY_EXIT_FAILURE
-#define YY_EXIT_FAILURE 2
-#endif
-
-static void yynoreturn yy_fatal_error (const char* msg )
+                      yylval.url->port = atoi(++yytext);
+                  }
+                }
+                break;
+                case 414: /* [/][^?#\r\n ]* */
+                {
 {
-			fprintf( stderr, "%s\n", msg );
-	exit( YY_EXIT_FAILURE );
-}
-
-/* Redefine yyless() so it works in section 3 code. */
-
-#undef yyless
-#define yyless(n) \
-	do \
-		{ \
-		/* Undo effects of setting up yytext. */ \
-        int yyless_macro_arg = (n); \
-        YY_LESS_LINENO(yyless_macro_arg);\
-		yytext[yyleng] = (yy_hold_char); \
-		(yy_c_buf_p) = yytext + yyless_macro_arg; \
-		(yy_hold_char) = *(yy_c_buf_p); \
-		*(yy_c_buf_p) = '\0'; \
-		yyleng = yyless_macro_arg; \
-		} \
-	while ( 0 )
-
-/* Accessor  methods (get/set functions) to struct members. */
-
-/** Get the current line number.
- * 
- */
-int yyget_lineno  (void)
+                      yylval.url->path = Util_urlEncode(yytext, false);
+                  }
+                }
+                break;
+                case 415: /* [?][^#\r\n ]* */
+                {
 {
-    
-    return yylineno;
-}
-
-/** Get the input stream.
- * 
- */
-FILE *yyget_in  (void)
+                      yylval.url->query = Util_urlEncode(++yytext, false);
+                  }
+                }
+                break;
+                case 416: /* [#][^\r\n ]* */
+                {
 {
-        return yyin;
-}
-
-/** Get the output stream.
- * 
- */
-FILE *yyget_out  (void)
+                      /* EMPTY - reference is ignored */
+                  }
+                }
+                break;
+                case 417: /* [}\n] */
+                {
 {
-        return yyout;
-}
-
-/** Get the length of the current token.
- * 
- */
-int yyget_leng  (void)
+                        if (yytext[0] == '}')
+                                yyless(0);
+                        BEGIN(INITIAL);
+                        if (! yylval.address->address)
+                                yyerror("missing address");
+                        save_arg();
+                        return ADDRESSOBJECT;
+                }
+                }
+                break;
+                case 418: /* {address} */
+                {
 {
-        return yyleng;
-}
-
-/** Get the current token.
- * 
- */
-
-char *yyget_text  (void)
+                        yylval.address->address = Str_dup(yytext);
+                }
+                }
+                break;
+                case 419: /* {addrname} */
+                {
 {
-        return yytext;
-}
-
-/** Set the current line number.
- * @param _line_number line number
- * 
- */
-void yyset_lineno (int  _line_number )
+                        char *name = Str_unquote(Str_dup(yytext));
+                        if (name) {
+                                if (*name)
+                                        yylval.address->name = name;
+                                else
+                                        // Empty quoted string
+                                        FREE(name);
+                        }
+                }
+                }
+                break;
+                case 420: /* [<>:\[\]] */
+                {
 {
-    
-    yylineno = _line_number;
-}
-
-/** Set the input stream. This does not discard the current
- * input buffer.
- * @param _in_str A readable stream.
- * 
- * @see yy_switch_to_buffer
- */
-void yyset_in (FILE *  _in_str )
+                        // Ignore
+                }
+                }
+                break;
+                case 421: /* . */
+                {
 {
-        yyin = _in_str ;
-}
-
-void yyset_out (FILE *  _out_str )
+                        BEGIN(INITIAL);
+                        yyerror("invalid mail format");
+                }
+                }
+                break;
+                case 422: /* {str} */
+                {
 {
-        yyout = _out_str ;
-}
-
-int yyget_debug  (void)
+                    yylval.string = Str_dup(yytext);
+                    BEGIN(INITIAL);
+                    save_arg();
+                    return STRINGNAME;
+                  }
+                }
+                break;
+                case 423: /* \"{str}\" */
+                {
 {
-        return yy_flex_debug;
-}
-
-void yyset_debug (int  _bdebug )
+                    yylval.string = handle_quoted_string(yytext);
+                    BEGIN(INITIAL);
+                    save_arg();
+                    return STRINGNAME;
+                  }
+                }
+                break;
+                case 424: /* \'{str}\' */
+                {
 {
-        yy_flex_debug = _bdebug ;
-}
-
-static int yy_init_globals (void)
+                    yylval.string = handle_quoted_string(yytext);
+                    BEGIN(INITIAL);
+                    save_arg();
+                    return STRINGNAME;
+                  }
+                }
+                break;
+                case 425: /* [\"\'] */
+                {
 {
-        /* Initialization is the same as for the non-reentrant scanner.
-     * This function is called from yylex_destroy(), so don't allocate here.
-     */
-
-    (yy_buffer_stack) = NULL;
-    (yy_buffer_stack_top) = 0;
-    (yy_buffer_stack_max) = 0;
-    (yy_c_buf_p) = NULL;
-    (yy_init) = 0;
-    (yy_start) = 0;
-
-    (yy_state_buf) = 0;
-    (yy_state_ptr) = 0;
-    (yy_full_match) = 0;
-    (yy_lp) = 0;
-
-/* Defined in main.c */
-#ifdef YY_STDINIT
-    yyin = stdin;
-    yyout = stdout;
-#else
-    yyin = NULL;
-    yyout = NULL;
-#endif
-
-    /* For future reference: Set errno on error, since we are called by
-     * yylex_init()
-     */
-    return 0;
-}
-
-/* yylex_destroy is for both reentrant and non-reentrant scanners. */
-int yylex_destroy  (void)
+                      yyerror("unbalanced quotes");
+                  }
+                }
+                break;
+                case 426: /* {ws} */
+                {
+;
+                }
+                break;
+                case 427: /* {number} */
+                {
 {
-    
-    /* Pop the buffer stack, destroying each element. */
-	while(YY_CURRENT_BUFFER){
-		yy_delete_buffer( YY_CURRENT_BUFFER  );
-		YY_CURRENT_BUFFER_LVALUE = NULL;
-		yypop_buffer_state();
-	}
-
-	/* Destroy the stack itself. */
-	yyfree((yy_buffer_stack) );
-	(yy_buffer_stack) = NULL;
-
-    yyfree ( (yy_state_buf) );
-    (yy_state_buf)  = NULL;
-
-    /* Reset the globals. This is important in a non-reentrant scanner so the next time
-     * yylex() is called, initialization will occur. */
-    yy_init_globals( );
-
-    return 0;
-}
-
-/*
- * Internal utility routines.
- */
-
-#ifndef yytext_ptr
-static void yy_flex_strncpy (char* s1, const char * s2, int n )
+                    yylval.number = atoi(yytext);
+                    BEGIN(INITIAL);
+                    save_arg();
+                    return NUMBER;
+                  }
+                }
+                break;
+                case 428: /* ['"]{ws}?[0-9,*-]+{ws}[0-9,*-]+{ws}[0-9,*-]+{ws}[0-9,*-]+{ws}[0-9,*-]+{ws}?['"] */
+                {
+{ // A minimal syntax check of the cron format string; 5 fields separated with white-space
+                    yylval.string = Str_dup(Str_unquote(yytext));
+                    BEGIN(INITIAL);
+                    save_arg();
+                    return TIMESPEC;
+                  }
+                }
+                break;
+                case 429: /* . */
+                {
 {
-		
-	int i;
-	for ( i = 0; i < n; ++i )
-		s1[i] = s2[i];
-}
-#endif
-
-#ifdef YY_NEED_STRLEN
-static int yy_flex_strlen (const char * s )
+                      BEGIN(INITIAL);
+                      yyerror("invalid every format");
+                  }
+                }
+                break;
+                case 430: /* {wws} */
+                {
+;
+                }
+                break;
+                case 431: /* "[" */
+                {
+;
+                }
+                break;
+                case 432: /* [\n] */
+                {
 {
-	int n;
-	for ( n = 0; s[n]; ++n )
-		;
-
-	return n;
-}
-#endif
-
-void *yyalloc (yy_size_t  size )
+                        lineno++;
+                }
+                }
+                break;
+                case 433: /* ([^\t\r\n,\[\]:]+)/[:] */
+                {
+{ // name/:
+                        save_arg();
+                }
+                }
+                break;
+                case 434: /* [:](({ws}?["][^"]+["])|({ws}?['][^']+['])|([^\r\n\],:]+)) */
+                {
+{ // : value
+                        yylval.string = Str_cat("%s:%s", Str_trim(argyytext), Str_unquote(yytext + 1));
+                        save_arg();
+                        return HTTPHEADER;
+                }
+                }
+                break;
+                case 435: /* "]" */
+                {
 {
-			return malloc(size);
-}
-
-void *yyrealloc  (void * ptr, yy_size_t  size )
+                        BEGIN(INITIAL);
+                        save_arg();
+                        return ']';
+                }
+                }
+                break;
+                case 436: /* . */
+                {
 {
-		
-	/* The cast to (char *) in the following accommodates both
-	 * implementations that use char* generic pointers, and those
-	 * that use void* generic pointers.  It works with the latter
-	 * because both ANSI C and C++ allow castless assignment from
-	 * any pointer type to void*, and deal with argument conversions
-	 * as though doing an assignment.
-	 */
-	return realloc(ptr, size);
-}
-
-void yyfree (void * ptr )
+                        BEGIN(INITIAL);
+                        yyerror("invalid HTTP header list format");
+                }
+                }
+                break;
+                case 437: /* . */
+                {
 {
-			free( (char *) ptr );	/* see yyrealloc() for (char *) cast */
+                      check_state = None_State;
+                      return yytext[0];
+                  }
+                }
+                break;
+                case 438: /* [ \t]* */
+                {
+;
+                }
+                break;
+                case 439: /* \"[^\"\r\n]+\" */
+                {
+{ /* got the include file name with double quotes */
+                     char *temp = Str_dup(yytext);
+                     Str_unquote(temp);
+                     include_file(temp);
+                     FREE(temp);
+                     BEGIN(INITIAL);
+                   }
+                }
+                break;
+                case 440: /* \'[^\'\r\n]+\' */
+                {
+{ /* got the include file name with single quotes*/
+                     char *temp = Str_dup(yytext);
+                     Str_unquote(temp);
+                     include_file(temp);
+                     FREE(temp);
+                     BEGIN(INITIAL);
+                   }
+                }
+                break;
+                case 441: /* [^ \t\r\n]+ */
+                {
+{ /* got the include file name without quotes*/
+                     char *temp = Str_dup(yytext);
+                     include_file(temp);
+                     FREE(temp);
+                     BEGIN(INITIAL);
+                   }
+                }
+                break;
+                }
+        }
+        return YY_NULL;
 }
 
-#define YYTABLES_NAME "yytables"
-
-#line 1018 "src/l.l"
-
 
 /*
  * Do lineno++ for every occurrence of '\n' in a string.  This is
@@ -83,7 +83,11 @@
 #include "MMonit.h"
 #include "md5.h"
 #include "sha1.h"
+#include "sha256.h"
+#include "xxh64.h"
 #include "checksum.h"
+#include "hashpool.h"
+#include "net/Resolver.h"
 
 // libmonit
 #include "Bootstrap.h"
@@ -142,14 +146,15 @@ static volatile bool heartbeatRunning = false;
 const char *actionnames[] = {"ignore", "alert", "restart", "stop", "exec", "unmonitor", "start", "monitor", ""};
 const char *modenames[] = {"active", "passive"};
 const char *onrebootnames[] = {"start", "nostart", "laststate"};
-const char *checksumnames[] = {"UNKNOWN", "MD5", "SHA1"};
+const char *checksumnames[] = {"UNKNOWN", "MD5", "SHA1", "SHA256", "XXH64"};
 const char *operatornames[] = {"less than", "less than or equal to", "greater than", "greater than or equal to", "equal to", "not equal to", "changed"};
 const char *operatorshortnames[] = {"<", "<=", ">", ">=", "=", "!=", "<>"};
-const char *servicetypes[] = {"Filesystem", "Directory", "File", "Process", "Remote Host", "System", "Fifo", "Program", "Network"};
+const char *servicetypes[] = {"Filesystem", "Directory", "File", "Process", "Remote Host", "System", "Fifo", "Program", "Network", "Fileset"};
 const char *pathnames[] = {"Path", "Path", "Path", "Pid file", "Path", "", "Path"};
 const char *icmpnames[] = {"Reply", "", "", "Destination Unreachable", "Source Quench", "Redirect", "", "", "Ping", "", "", "Time Exceeded", "Parameter Problem", "Timestamp Request", "Timestamp Reply", "Information Request", "Information Reply", "Address Mask Request", "Address Mask Reply"};
 const char *socketnames[] = {"unix", "IP", "IPv4", "IPv6"};
 const char *timestampnames[] = {"modify/change time", "access time", "change time", "modify time"};
+const char *timingnames[] = {"dns time", "connect time", "tls handshake", "request time", "first byte", "response time", "rtt", "retransmits"};
 const char *httpmethod[] = {"", "HEAD", "GET"};
 
 
@@ -353,6 +358,12 @@ static void do_reinit() {
         if (Run.httpd.flags & Httpd_Net || Run.httpd.flags & Httpd_Unix)
                 monit_http(Httpd_Stop);
 
+        /* Stop the checksum workers, pending jobs are released by the garbage collector */
+        HashPool_stop();
+
+        /* Stop the DNS cache refresh and drop the cache, the limits may change */
+        Resolver_stop();
+
         /* Save the current state (no changes are possible now since the http thread is stopped) */
         State_save();
         State_close();
@@ -360,6 +371,11 @@ static void do_reinit() {
         /* Run the garbage collector */
         gc();
 
+#ifdef HAVE_OPENSSL
+        /* Drop the cached SSL client contexts, the certificates may have changed */
+        Ssl_reset();
+#endif
+
         if (! parse(Run.files.control)) {
                 Log_error("%s stopped -- error parsing configuration file\n", prog);
                 exit(1);
@@ -402,6 +418,12 @@ static void do_reinit() {
                 Thread_create(heartbeatThread, heartbeat, NULL);
                 heartbeatRunning = true;
         }
+
+        /* Start the background checksum workers */
+        HashPool_start();
+
+        /* Start the DNS cache refresh */
+        Resolver_start();
 }
 
 
@@ -513,6 +535,8 @@ static void do_exit(bool saveState) {
                 /* send the monit stop notification */
                 Event_post(Run.system, Event_Instance, State_Changed, Run.system->action_MONIT_STOP, "Monit %s stopped", VERSION);
         }
+        HashPool_stop();
+        Resolver_stop();
         if (saveState) {
                 State_save();
         }
@@ -588,6 +612,9 @@ static void do_default() {
                         heartbeatRunning = true;
                 }
 
+                HashPool_start();
+                Resolver_start();
+
                 while (true) {
                         validate();
 
@@ -832,8 +859,8 @@ static void help() {
                " -t            Run syntax check for the control file\n"
                " -v            Verbose mode, work noisy (diagnostic output)\n"
                " -vv           Very verbose mode, same as -v plus log stacktrace on error\n"
-               " -H [filename] Print SHA1 and MD5 hashes of the file or of stdin if the\n"
-               "               filename is omitted; monit will exit afterwards\n"
+               " -H [filename] Print SHA256, SHA1, MD5 and XXH64 hashes of the file or of\n"
+               "               stdin if the filename is omitted; monit will exit afterwards\n"
                " -V            Print version number and patchlevel\n"
                " -h            Print this text\n"
                "Optional commands are as follows:\n"
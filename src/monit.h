@@ -104,6 +104,7 @@
 #include "statistics/Statistics.h"
 #include "net/socket.h"
 #include "net/Link.h"
+#include "net/Listen.h"
 
 // libmonit
 #include "system/Command.h"
@@ -274,6 +275,19 @@ typedef enum {
 } __attribute__((__packed__)) Connection_State;
 
 
+typedef enum {
+        Timing_Dns = 0,
+        Timing_Connect,
+        Timing_Tls,
+        Timing_Request,
+        Timing_FirstByte,
+        Timing_Total,
+        Timing_Rtt,
+        Timing_Retransmits,
+        Timing_Last = Timing_Retransmits
+} __attribute__((__packed__)) Timing_Type;
+
+
 typedef enum {
         Service_Filesystem = 0,
         Service_Directory,
@@ -284,7 +298,8 @@ typedef enum {
         Service_Fifo,
         Service_Program,
         Service_Net,
-        Service_Last = Service_Net
+        Service_Fileset,
+        Service_Last = Service_Fileset
 } __attribute__((__packed__)) Service_Type;
 
 
@@ -324,7 +339,25 @@ typedef enum {
         Resource_ServiceTime,
         Resource_LoadAveragePerCore1m,
         Resource_LoadAveragePerCore5m,
-        Resource_LoadAveragePerCore15m
+        Resource_LoadAveragePerCore15m,
+        Resource_DirectoryEntries,
+        Resource_DirectorySize,
+        Resource_DirectoryOldest,
+        Resource_ReadLatency,
+        Resource_WriteLatency,
+        Resource_Utilization,
+        Resource_QueueDepth,
+        Resource_Iops,
+        Resource_SpaceTimeToFull,
+        Resource_InodeTimeToFull,
+        Resource_TcpRetransmits,
+        Resource_TcpRetransmitsPercent,
+        Resource_TcpListenOverflows,
+        Resource_TcpListenDrops,
+        Resource_TcpSynCookies,
+        Resource_TcpOrphans,
+        Resource_TcpTimeWait,
+        Resource_UdpReceiveBufferErrors
 } __attribute__((__packed__)) Resource_Type;
 
 
@@ -349,6 +382,8 @@ typedef enum {
         Hash_Unknown = 0,
         Hash_Md5,
         Hash_Sha1,
+        Hash_Sha256,
+        Hash_Xxh64,
         Hash_Default = Hash_Md5
 } __attribute__((__packed__)) Hash_Type;
 
@@ -380,7 +415,8 @@ typedef enum {
         Statistics_CpuGuestNice                 = 0x100,
         Statistics_FiledescriptorsPerSystem     = 0x200,
         Statistics_FiledescriptorsPerProcess    = 0x400,
-        Statistics_FiledescriptorsPerProcessMax = 0x800
+        Statistics_FiledescriptorsPerProcessMax = 0x800,
+        Statistics_NetworkStack                 = 0x1000
 } __attribute__((__packed__)) Statistics_Flags;
 
 
@@ -403,6 +439,10 @@ typedef enum {
 #define LIMIT_STOPTIMEOUT       30000
 #define LIMIT_STARTTIMEOUT      30000
 #define LIMIT_RESTARTTIMEOUT    30000
+#define LIMIT_CHECKSUMWORKERS   1
+#define LIMIT_FILESYSTEMTIMEOUT 5000
+#define LIMIT_DNSTTL            60
+#define LIMIT_DNSNEGATIVETTL    10
 
 
 
@@ -456,6 +496,11 @@ typedef struct Limits_T {
         uint32_t stopTimeout;                     /**< Default stop timeout [ms] */
         uint32_t startTimeout;                   /**< Default start timeout [ms] */
         uint32_t restartTimeout;               /**< Default restart timeout [ms] */
+        uint32_t checksumWorkers;   /**< Background checksum threads (0 = inline) */
+        bool     checksumIdleIO;        /**< Checksum threads use idle I/O class */
+        uint32_t filesystemTimeout;   /**< Filesystem probe timeout [ms] (0 = none) */
+        uint32_t dnsTtl;           /**< DNS cache time to live [s] (0 = no cache) */
+        uint32_t dnsNegativeTtl;      /**< DNS cache time to live for failures [s] */
 } Limits_T;
 
 
@@ -606,6 +651,20 @@ typedef struct SystemInfo_T {
                 long long unused;              /**< Number of unused filedescriptors */
                 long long maximum;                        /**< Filedescriptors limit */
         } filedescriptors;
+        struct {
+                struct {
+                        struct Statistics_T segments;               /**< Sent TCP segments */
+                        struct Statistics_T retransmits;     /**< Retransmitted TCP segments */
+                        struct Statistics_T listenOverflows;   /**< Listen queue overflows */
+                        struct Statistics_T listenDrops;   /**< SYNs dropped on listen sockets */
+                        struct Statistics_T synCookies;                /**< SYN cookies sent */
+                        long long orphans;                       /**< Orphaned TCP sockets */
+                        long long timeWait;             /**< TCP sockets in TIME_WAIT state */
+                } tcp;
+                struct {
+                        struct Statistics_T receiveBufferErrors; /**< UDP receive buffer errors */
+                } udp;
+        } netstack;
         size_t argmax;                                                   /**< Program arguments maximum [B] */
         double loadavg[3];                                                         /**< Load average triple */
         struct utsname uname;                                 /**< Platform information provided by uname() */
@@ -620,6 +679,7 @@ typedef struct SystemInfo_T {
 typedef struct Protocol_T {
         const char *name;                                       /**< Protocol name */
         void (*check)(Socket_T);          /**< Protocol verification function */
+        void (*ping)(Socket_T);  /**< Persistent connection liveness check or NULL */
 } *Protocol_T;
 
 
@@ -627,6 +687,8 @@ typedef struct Protocol_T {
 typedef struct Generic_T {
         char *send;                           /* string to send, or NULL if expect */
         regex_t *expect;                  /* regex code to expect, or NULL if send */
+        unsigned char *bytes;        /* bytes to expect, or NULL if send or regex */
+        int length;                                 /* number of bytes to expect */
         /** For internal use */
         struct Generic_T *next;
 } *Generic_T;
@@ -639,6 +701,40 @@ typedef struct Outgoing_T {
 } Outgoing_T;
 
 
+/** Defines the result of a connection test shared by identical port tests */
+typedef struct PortProbe_T {
+        unsigned long long cycle;           /**< Validation cycle of the last test */
+        Connection_State is_available;                            /**< Test result */
+        double response;                                   /**< Response time [ms] */
+        int validDays;                             /**< SSL certificate valid days */
+        int references;                     /**< Number of ports sharing the probe */
+        double timing[Timing_Last + 1];                     /**< Connection timing */
+        char report[1024];                      /**< Failure description if failed */
+} *PortProbe_T;
+
+
+/** Defines an HTTP/2 request stream and the result of its last test */
+typedef struct Http2Stream_T {
+        char *request;                                           /**< Request path */
+        int status;                      /**< Response status (-1 if not received) */
+        double response;             /**< Response time [ms] (-1 if not completed) */
+
+        /** For internal use */
+        struct Http2Stream_T *next;                      /**< next stream in chain */
+} *Http2Stream_T;
+
+
+/** Defines a connection phase timing limit */
+typedef struct TimingLimit_T {
+        Timing_Type type;                                        /**< Timing phase */
+        Operator_Type operator;                           /**< Comparison operator */
+        double limit;                     /**< Limit [ms] or number of retransmits */
+
+        /** For internal use */
+        struct TimingLimit_T *next;                       /**< next limit in chain */
+} *TimingLimit_T;
+
+
 /** Defines a port object */
 typedef struct Port_T {
         char *hostname;                                     /**< Hostname to check */
@@ -661,7 +757,12 @@ typedef struct Port_T {
         int timeout;      /**< The timeout in [ms] to wait for connect or read i/o */
         int retry;       /**< Number of connection retry before reporting an error */
         volatile int socket;                       /**< Socket used for connection */
+        bool persistent;              /**< Keep the connection open between cycles */
+        Socket_T connection;            /**< Persistent connection or NULL if none */
+        PortProbe_T probe;         /**< Result shared with identical tests or NULL */
         double response;                 /**< Socket connection response time [ms] */
+        double timing[Timing_Last + 1];     /**< Phase timing [ms] (-1 if unknown) */
+        TimingLimit_T timinglist;                    /**< Connection timing limits */
         Socket_Type type;           /**< Socket type used for connection (UDP/TCP) */
         Socket_Family family;    /**< Socket family used for connection (NET/UNIX) */
         Connection_State is_available;               /**< Server/port availability */
@@ -707,6 +808,7 @@ typedef struct Port_T {
                         char *request;                                          /**< HTTP request */
                         char *checksum;                         /**< Document checksum (optional) */
                         List_T headers;      /**< List of headers to send with request (optional) */
+                        Http2Stream_T streams;                        /**< HTTP/2 request streams */
                 } http;
                 struct {
                         char *username;
@@ -752,11 +854,14 @@ typedef struct Icmp_T {
         int timeout;         /**< The timeout in milliseconds to wait for response */
         Connection_State is_available;    /**< Flag for the server is availability */
         Socket_Family family;                 /**< ICMP family used for connection */
-        double response;                         /**< ICMP ECHO response time [ms] */
+        double response;                 /**< ICMP ECHO average response time [ms] */
+        double jitter;                         /**< ICMP ECHO response jitter [ms] */
+        double loss;                    /**< ICMP ECHO requests without reply [%] */
         Outgoing_T outgoing;                                 /**< Outgoing address */
         EventAction_T action; /**< Description of the action upon event occurrence */
 
         /** For internal use */
+        bool probed;        /**< Result of the concurrent ping is ready for check */
         struct Icmp_T *next;                               /**< next icmp in chain */
 } *Icmp_T;
 
@@ -904,6 +1009,7 @@ typedef struct Bandwidth_T {
         Time_Type range;                            /**< Time range to watch: unit */
         int rangecount;                            /**< Time range to watch: count */
         unsigned long long limit;                              /**< Data watermark */
+        LinkCounter_Type counter;     /**< Extended link counter (counter test only) */
         EventAction_T action; /**< Description of the action upon event occurrence */
 
         /** For internal use */
@@ -915,10 +1021,13 @@ typedef struct Bandwidth_T {
 typedef struct Checksum_T {
         bool initialized;               /**< true if checksum was initialized */
         bool test_changes;       /**< true if we only should test for changes */
-        Hash_Type type;                   /**< The type of hash (e.g. md5 or sha1) */
+        Hash_Type type;     /**< The type of hash (e.g. md5, sha1, sha256, xxh64) */
         int   length;                                      /**< Length of the hash */
         MD_T  hash;                     /**< A checksum hash computed for the path */
         EventAction_T action; /**< Description of the action upon event occurrence */
+        struct HashJob_T *job;   /**< Pending background checksum computation */
+        bool collected;           /**< true if a background checksum was collected */
+        bool succeeded;         /**< true if the last collected checksum succeeded */
 } *Checksum_T;
 
 
@@ -966,6 +1075,30 @@ typedef struct SecurityAttribute_T {
         struct SecurityAttribute_T *next;
 } *SecurityAttribute_T;
 
+typedef enum {
+        ListenTest_Exist = 0,
+        ListenTest_Queue,
+        ListenTest_Established
+} __attribute__((__packed__)) ListenTest_Type;
+
+
+typedef struct Listen_T {
+        char *address;                   /**< Local address (NULL = any address) */
+        struct addrinfo *addresses;  /**< Resolved local address (NULL = any) */
+        int port;                                                 /**< Local port */
+        ListenTest_Type type;                                      /**< Test type */
+        Operator_Type operator;                           /**< Comparison operator */
+        long long limit_absolute;                        /**< Count limit (or -1) */
+        float limit_percent;            /**< Queue limit in % of backlog (or -1) */
+        EventAction_T action; /**< Description of the action upon event occurrence */
+
+        /** For internal use */
+        bool found;                     /**< Listening socket found in last cycle */
+        ListenInfo_T info;                      /**< Last accept queue statistics */
+        struct Listen_T *next;                         /**< next listen in chain */
+} *Listen_T;
+
+
 typedef struct Filedescriptors_T {
         bool total;             /**<Whether to include filedescriptors of children */
         long long limit_absolute;                      /**<  Filedescriptors limit */
@@ -1017,6 +1150,7 @@ typedef struct FileSystem_T {
         //FIXME: union
         long long limit_absolute;                          /**< Watermark - blocks */
         float limit_percent;                              /**< Watermark - percent */
+        int window;                      /**< Time-to-full growth rate window [s] */
         EventAction_T action; /**< Description of the action upon event occurrence */
 
         /** For internal use */
@@ -1076,11 +1210,27 @@ typedef struct FileSystemInfo_T {
         bool flagsChanged;          /**< True if filesystem flags changed */
         struct IOStatistics_T read;                       /**< Read statistics */
         struct IOStatistics_T write;                     /**< Write statistics */
+        struct IOStatistics_T discard;                 /**< Discard statistics */
+        struct IOStatistics_T flush;                     /**< Flush statistics */
+        long long inFlight;      /**< I/O requests in flight (-1 if unknown) */
+        bool timeout;                     /**< True if the last probe timed out */
+        struct {
+                struct Trend_T *space;          /**< Available space history [B] */
+                struct Trend_T *inode;            /**< Free inodes history */
+        } trend;
+        struct {
+                long long space;   /**< Predicted time to full space [s] (-1 if none) */
+                long long inode;  /**< Predicted time to full inodes [s] (-1 if none) */
+        } timeToFull;
         struct {
                 struct Statistics_T read;         /**< Time spend by read [ms] */
                 struct Statistics_T write;       /**< Time spend by write [ms] */
+                struct Statistics_T discard;   /**< Time spend by discard [ms] */
+                struct Statistics_T flush;       /**< Time spend by flush [ms] */
                 struct Statistics_T wait;   /**< Time spend in wait queue [ms] */
                 struct Statistics_T run;     /**< Time spend in run queue [ms] */
+                struct Statistics_T io;     /**< Time the device was busy [ms] */
+                struct Statistics_T weighted; /**< Weighted time doing I/O [ms] */
         } time;
         struct Device_T object;                             /**< Device object */
 } *FileSystemInfo_T;
@@ -1095,6 +1245,7 @@ typedef struct FileInfo_T {
         off_t readpos;                        /**< Position for regex matching */
         ino_t inode;                                                /**< Inode */
         ino_t inode_prev;               /**< Previous inode for regex matching */
+        dev_t device;                                  /**< Device id of the file */
         MD_T  cs_sum;                                            /**< Checksum */ //FIXME: allocate dynamically only when necessary
 } *FileInfo_T;
 
@@ -1104,6 +1255,10 @@ typedef struct DirectoryInfo_T {
         int mode;                                              /**< Permission */
         int uid;                                              /**< Owner's uid */
         int gid;                                              /**< Owner's gid */
+        long long entries;    /**< Number of directory entries (-1 if unknown) */
+        long long size;                    /**< Total size of the entries [B] */
+        time_t oldest;              /**< Modification time of the oldest entry */
+        struct DirIndex_T *index;       /**< Entries index for aggregate tests */
 } *DirectoryInfo_T;
 
 
@@ -1115,6 +1270,14 @@ typedef struct FifoInfo_T {
 } *FifoInfo_T;
 
 
+typedef struct FileSetInfo_T {
+        int entries;           /**< Number of matching files (-1 if unknown) */
+        int failed;              /**< Number of files failing at least a test */
+        long long size;                  /**< Total size of matching files [B] */
+        struct FileSet_T *set;                     /**< Per-file compact state */
+} *FileSetInfo_T;
+
+
 typedef struct ProcessInfo_T {
         bool zombie;
         pid_t _pid;                           /**< Process PID from last cycle */
@@ -1158,6 +1321,7 @@ typedef union Info_T {
         DirectoryInfo_T  directory;
         FifoInfo_T       fifo;
         FileInfo_T       file;
+        FileSetInfo_T    fileset;
         FileSystemInfo_T filesystem;
         NetInfo_T        net;
         ProcessInfo_T    process;
@@ -1216,6 +1380,7 @@ typedef struct Service_T {
         Gid_T       gid;                                            /**< Gid check */
         SecurityAttribute_T secattrlist;             /**< Security attributes list */
         Filedescriptors_T filedescriptorslist;                   /**< Filedescriptors list */
+        Listen_T listenlist;                         /**< Listening socket check list */
         LinkStatus_T linkstatuslist;                 /**< Network link status list */
         LinkSpeed_T linkspeedlist;                    /**< Network link speed list */
         LinkSaturation_T linksaturationlist;     /**< Network link saturation list */
@@ -1223,6 +1388,7 @@ typedef struct Service_T {
         Bandwidth_T uploadpacketslist;              /**< Upload packets check list */
         Bandwidth_T downloadbyteslist;              /**< Download bytes check list */
         Bandwidth_T downloadpacketslist;          /**< Download packets check list */
+        Bandwidth_T linkcounterlist;        /**< Extended link counters check list */
 
         /** General event handlers */
         EventAction_T action_DATA;       /**< Description of the action upon event */
@@ -1374,6 +1540,7 @@ extern const char *pathnames[];
 extern const char *icmpnames[];
 extern const char *socketnames[];
 extern const char *timestampnames[];
+extern const char *timingnames[];
 extern const char *httpmethod[];
 
 
@@ -1431,6 +1598,7 @@ State_Type check_directory(Service_T);
 State_Type check_remote_host(Service_T);
 State_Type check_system(Service_T);
 State_Type check_fifo(Service_T);
+State_Type check_fileset(Service_T);
 State_Type check_program(Service_T);
 State_Type check_net(Service_T);
 int  check_URL(Service_T s);
@@ -118,6 +118,20 @@ struct T {
         LinkData_T opackets;  // Packets sent on interface
         LinkData_T oerrors;   // Output errors on interface
         LinkData_T obytes;    // Total number of octets sent
+        unsigned int counters; // Bitmap of the extended counters supported by the interface
+        LinkData_T counter[LinkCounter_Count]; // Extended counters (drops, FIFO errors, etc.)
+};
+
+
+static const char *_counterNames[LinkCounter_Count] = {
+        [LinkCounter_DropsIn]     = "download drops",
+        [LinkCounter_DropsOut]    = "upload drops",
+        [LinkCounter_MissedIn]    = "download missed",
+        [LinkCounter_FifoIn]      = "download fifo errors",
+        [LinkCounter_FifoOut]     = "upload fifo errors",
+        [LinkCounter_CarrierOut]  = "upload carrier errors",
+        [LinkCounter_MulticastIn] = "download multicast",
+        [LinkCounter_Collisions]  = "collisions"
 };
 
 
@@ -149,6 +163,12 @@ static void _updateValue(LinkData_T *data, unsigned long long raw) {
 }
 
 
+static void _updateCounter(T L, LinkCounter_Type counter, unsigned long long raw) {
+        _updateValue(&(L->counter[counter]), raw);
+        L->counters |= 1U << counter;
+}
+
+
 #if defined DARWIN
 #include "os/macosx/Link.inc"
 #elif defined FREEBSD
@@ -190,6 +210,9 @@ static void _reset(T L) {
         _resetData(&(L->obytes), 0ULL);
         _resetData(&(L->opackets), 0ULL);
         _resetData(&(L->oerrors), 0ULL);
+        L->counters = 0;
+        for (int i = 0; i < LinkCounter_Count; i++)
+                _resetData(&(L->counter[i]), 0ULL);
 }
 
 
@@ -267,6 +290,8 @@ static void _updateHistory(T L) {
                 _resetData(&(L->obytes), L->obytes.now);
                 _resetData(&(L->opackets), L->opackets.now);
                 _resetData(&(L->oerrors), L->oerrors.now);
+                for (int i = 0; i < LinkCounter_Count; i++)
+                        _resetData(&(L->counter[i]), L->counter[i].now);
         } else {
                 // Update relative values only
                 time_t now = L->timestamp.now / 1000.;
@@ -278,6 +303,8 @@ static void _updateHistory(T L) {
                 L->obytes.minute[minute] = L->obytes.hour[hour] = L->obytes.now;
                 L->opackets.minute[minute] = L->opackets.hour[hour] = L->opackets.now;
                 L->oerrors.minute[minute] = L->oerrors.hour[hour] = L->oerrors.now;
+                for (int i = 0; i < LinkCounter_Count; i++)
+                        L->counter[i].minute[minute] = L->counter[i].hour[hour] = L->counter[i].now;
         }
 }
 
@@ -529,3 +556,37 @@ int Link_getDuplex(T L) {
         return L->state > 0 ? L->duplex : -1;
 }
 
+
+const char *Link_getCounterName(LinkCounter_Type counter) {
+        assert(counter >= 0 && counter < LinkCounter_Count);
+        return _counterNames[counter];
+}
+
+
+long long Link_getCounterPerSecond(T L, LinkCounter_Type counter) {
+        assert(L);
+        assert(counter >= 0 && counter < LinkCounter_Count);
+        return L->state > 0 && (L->counters & (1U << counter)) ? _deltaSecond(L, &(L->counter[counter])) : -1LL;
+}
+
+
+long long Link_getCounterPerMinute(T L, LinkCounter_Type counter, int count) {
+        assert(L);
+        assert(counter >= 0 && counter < LinkCounter_Count);
+        return L->state > 0 && (L->counters & (1U << counter)) ? _deltaMinute(L, &(L->counter[counter]), count) : -1LL;
+}
+
+
+long long Link_getCounterPerHour(T L, LinkCounter_Type counter, int count) {
+        assert(L);
+        assert(counter >= 0 && counter < LinkCounter_Count);
+        return L->state > 0 && (L->counters & (1U << counter)) ? _deltaHour(L, &(L->counter[counter]), count) : -1LL;
+}
+
+
+long long Link_getCounterTotal(T L, LinkCounter_Type counter) {
+        assert(L);
+        assert(counter >= 0 && counter < LinkCounter_Count);
+        return L->state > 0 && (L->counters & (1U << counter)) ? L->counter[counter].now : -1LL;
+}
+
@@ -40,6 +40,24 @@
 typedef struct T *T;
 
 
+/**
+ * Extended interface counters. Availability depends on the platform and
+ * the interface driver, the Link_getCounter* methods return -1 for counters
+ * which are not available.
+ */
+typedef enum {
+        LinkCounter_DropsIn = 0,  // Received packets dropped (e.g. no buffer space)
+        LinkCounter_DropsOut,     // Packets dropped on transmit
+        LinkCounter_MissedIn,     // Received packets missed by the NIC (rx ring full)
+        LinkCounter_FifoIn,       // Receive FIFO overruns
+        LinkCounter_FifoOut,      // Transmit FIFO underruns
+        LinkCounter_CarrierOut,   // Transmit carrier errors
+        LinkCounter_MulticastIn,  // Multicast packets received
+        LinkCounter_Collisions,   // Collisions
+        LinkCounter_Count         // Number of counters (internal use)
+} LinkCounter_Type;
+
+
 /**
  * Test if Link by IP address is supported.
  * @return true if supported, false if not
@@ -342,5 +360,53 @@ long long Link_getSpeed(T L);
 int Link_getDuplex(T L);
 
 
+/**
+ * Get the description of the extended counter (e.g. "download drops").
+ * @param counter The counter type
+ * @return Counter description
+ */
+const char *Link_getCounterName(LinkCounter_Type counter);
+
+
+/**
+ * Get extended counter per second.
+ * @param L A Link object
+ * @param counter The counter type
+ * @return Counter delta per second or -1 if not available.
+ */
+long long Link_getCounterPerSecond(T L, LinkCounter_Type counter);
+
+
+/**
+ * Get extended counter per minute.
+ * @param L A Link object
+ * @param counter The counter type
+ * @param count Number of minutes, the returned statistics will be for
+ * the range given by 'now - count' (count max = 60m)
+ * @return Counter delta per minute or -1 if not available.
+ */
+long long Link_getCounterPerMinute(T L, LinkCounter_Type counter, int count);
+
+
+/**
+ * Get extended counter per hour.
+ * @param L A Link object
+ * @param counter The counter type
+ * @param count Number of hours, the returned statistics will be for
+ * the range given by 'now - count' (count max = 24h)
+ * @return Counter delta per hour or -1 if not available.
+ */
+long long Link_getCounterPerHour(T L, LinkCounter_Type counter, int count);
+
+
+/**
+ * Get extended counter total.
+ * @param L A Link object
+ * @param counter The counter type
+ * @return Counter total or -1 if not available
+ */
+long long Link_getCounterTotal(T L, LinkCounter_Type counter);
+
+
 #undef T
 #endif
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#include "config.h"
+
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_DIRENT_H
+#include <dirent.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+
+#ifdef HAVE_NETINET_IN_H
+#include <netinet/in.h>
+#endif
+
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+
+#include "monit.h"
+#include "Listen.h"
+
+// libmonit
+#include "system/Time.h"
+#include "system/System.h"
+#include "util/Str.h"
+#include "exceptions/AssertException.h"
+
+
+/**
+ * Implementation of the passive listen test facade.
+ *
+ * @author http://www.tildeslash.com/
+ * @see http://www.mmonit.com/
+ * @file
+ */
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+#if defined LINUX && defined HAVE_LINUX_INET_DIAG_H
+#define LISTEN_SUPPORTED 1
+#endif
+
+
+#ifdef LISTEN_SUPPORTED
+
+
+typedef struct Socket_T {
+        int family;
+        int state;
+        int port;
+        unsigned char address[16];
+        unsigned long long inode;
+        long long queue;   // Listening socket: accept queue length
+        long long backlog; // Listening socket: accept queue limit
+} *Socket_T;
+
+
+static struct {
+        int count;
+        int capacity;
+        unsigned long long timestamp;
+        struct Socket_T *sockets;
+} _table = {};
+
+
+/* ----------------------------------------------------- Static destructor */
+
+
+static void __attribute__ ((destructor)) _destructor(void) {
+        FREE(_table.sockets);
+}
+
+
+/* --------------------------------------------------------------- Private */
+
+
+static void _addSocket(struct Socket_T *entry) {
+        if (_table.count == _table.capacity) {
+                _table.capacity = _table.capacity ? _table.capacity * 2 : 64;
+                RESIZE(_table.sockets, _table.capacity * sizeof(struct Socket_T));
+        }
+        _table.sockets[_table.count++] = *entry;
+}
+
+
+#include "os/linux/Listen.inc"
+
+
+static bool _isWildcard(Socket_T s) {
+        for (int i = 0; i < (s->family == AF_INET ? 4 : 16); i++)
+                if (s->address[i])
+                        return false;
+        return true;
+}
+
+
+static bool _matchAddress(Socket_T s, const struct addrinfo *addresses, bool wildcard) {
+        if (! addresses || (wildcard && _isWildcard(s)))
+                return true;
+        for (const struct addrinfo *a = addresses; a; a = a->ai_next) {
+                if (a->ai_family == AF_INET && s->family == AF_INET) {
+                        if (! memcmp(s->address, &(((struct sockaddr_in *)a->ai_addr)->sin_addr), 4))
+                                return true;
+#ifdef HAVE_IPV6
+                } else if (a->ai_family == AF_INET && s->family == AF_INET6) {
+                        // IPv4-mapped IPv6 address (::ffff:a.b.c.d)
+                        static const unsigned char mapped[12] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff};
+                        if (! memcmp(s->address, mapped, 12) && ! memcmp(s->address + 12, &(((struct sockaddr_in *)a->ai_addr)->sin_addr), 4))
+                                return true;
+                } else if (a->ai_family == AF_INET6 && s->family == AF_INET6) {
+                        if (! memcmp(s->address, &(((struct sockaddr_in6 *)a->ai_addr)->sin6_addr), 16))
+                                return true;
+#endif
+                }
+        }
+        return false;
+}
+
+
+/**
+ * Check if the process owns the socket: scan the process file descriptors
+ * for the socket inode (e.g. /proc/<pid>/fd/3 -> socket:[12345])
+ */
+static bool _isOwner(int pid, unsigned long long inode) {
+        char path[PATH_MAX];
+        snprintf(path, sizeof(path), "/proc/%d/fd", pid);
+        DIR *dir = opendir(path);
+        if (! dir) {
+                DEBUG("Cannot read %s -- %s\n", path, STRERROR);
+                return false;
+        }
+        bool rv = false;
+        char expected[64];
+        snprintf(expected, sizeof(expected), "socket:[%llu]", inode);
+        struct dirent *de;
+        while (! rv && (de = readdir(dir))) {
+                if (*de->d_name == '.')
+                        continue;
+                char link[64];
+                snprintf(path, sizeof(path), "/proc/%d/fd/%s", pid, de->d_name);
+                ssize_t n = readlink(path, link, sizeof(link) - 1);
+                if (n > 0) {
+                        link[n] = 0;
+                        rv = Str_isEqual(link, expected);
+                }
+        }
+        closedir(dir);
+        return rv;
+}
+
+
+static void _updateTable(void) {
+        unsigned long long now = Time_milli();
+        // Refresh only if the snapshot is older then 1 second (handle also backward time jumps)
+        if (now > _table.timestamp + 1000 || now < _table.timestamp - 1000) {
+                _table.count = 0;
+                _table.timestamp = now;
+                if (! _dump()) {
+                        _table.timestamp = 0ULL;
+                        THROW(AssertException, "Cannot read the socket table -- %s", STRERROR);
+                }
+        }
+}
+
+
+#endif
+
+
+/* ---------------------------------------------------------------- Public */
+
+
+bool Listen_isSupported(void) {
+#ifdef LISTEN_SUPPORTED
+        return true;
+#else
+        return false;
+#endif
+}
+
+
+#ifdef LISTEN_SUPPORTED
+
+
+bool Listen_get(const struct addrinfo *addresses, int port, int pid, ListenInfo_T *info) {
+        assert(port > 0);
+        assert(info);
+        bool found = false;
+        _updateTable();
+        info->queue = info->backlog = -1LL;
+        info->established = 0LL;
+        for (int i = 0; i < _table.count; i++) {
+                Socket_T s = &(_table.sockets[i]);
+                if (s->port != port)
+                        continue;
+                if (s->state == LISTEN_STATE) {
+                        if (! found && _matchAddress(s, addresses, true) && (pid <= 0 || _isOwner(pid, s->inode))) {
+                                found = true;
+                                info->queue = s->queue;
+                                info->backlog = s->backlog;
+                        }
+                } else if (_matchAddress(s, addresses, false)) {
+                        info->established++;
+                }
+        }
+        return found;
+}
+
+
+#else
+
+
+bool Listen_get(__attribute__ ((unused)) const struct addrinfo *addresses, __attribute__ ((unused)) int port, __attribute__ ((unused)) int pid, __attribute__ ((unused)) ListenInfo_T *info) {
+        THROW(AssertException, "The listen test is not supported on this platform");
+        return false;
+}
+
+
+#endif
+
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#ifndef LISTEN_INCLUDED
+#define LISTEN_INCLUDED
+
+
+/**
+ * Passive test of local listening TCP sockets. The sockets are looked up
+ * in the kernel socket table (Linux: NETLINK_SOCK_DIAG), so unlike the port
+ * test no connection is made to the service. The socket table snapshot is
+ * shared by all services and refreshed at most once a second.
+ *
+ * @author http://www.tildeslash.com/
+ * @see http://www.mmonit.com/
+ * @file
+ */
+
+
+typedef struct ListenInfo_T {
+        long long queue;       /**< Connections waiting in the accept queue */
+        long long backlog;     /**< Accept queue limit (listen backlog) */
+        long long established; /**< Established connections on the local port */
+} ListenInfo_T;
+
+
+/**
+ * Test if the passive listen test is supported on this platform.
+ * @return true if supported, false if not
+ */
+bool Listen_isSupported(void);
+
+
+/**
+ * Lookup the listening TCP socket.
+ * @param addresses Resolved local address the socket should accept
+ * connections on, NULL for any. A socket bound to the wildcard address
+ * accepts connections on all addresses and matches too.
+ * @param port Local port
+ * @param pid If greater then 0, the socket must be owned by the given
+ * process (one of its file descriptors)
+ * @param info Output: accept queue and established connections statistics
+ * @return true if the listening socket was found, otherwise false
+ * @exception AssertException if the socket table cannot be read
+ */
+bool Listen_get(const struct addrinfo *addresses, int port, int pid, ListenInfo_T *info);
+
+
+#endif
@@ -0,0 +1,397 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#include "config.h"
+
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+
+#ifdef HAVE_NETINET_IN_H
+#include <netinet/in.h>
+#endif
+
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+
+#include "monit.h"
+#include "Resolver.h"
+#include "socket.h"
+#include "net.h"
+
+// libmonit
+#include "system/Time.h"
+#include "util/Str.h"
+#include "exceptions/AssertException.h"
+
+
+/**
+ * Implementation of the caching resolver. The cache is a list protected
+ * by a mutex, getaddrinfo() is always called without holding the mutex.
+ *
+ * @author http://www.tildeslash.com/
+ * @see http://www.mmonit.com/
+ * @file
+ */
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+typedef struct Entry_T {
+        char *hostname;
+        int family;
+        int socktype;
+        int protocol;
+        int flags;
+        int status;                 // getaddrinfo() status of the last lookup, 0 on success
+        char error[STRLEN];         // Error description if the lookup failed
+        struct addrinfo *addresses; // Cached addresses (NULL for negative entry)
+        time_t expires;             // When the entry has to be resolved again
+        time_t refresh;             // When the background thread resolves the entry again
+        time_t used;                // Last lookup of the entry
+        bool resolved;              // At least one lookup completed (false for a queued name)
+        bool refreshing;            // Background refresh in progress
+        struct Entry_T *next;
+} *Entry_T;
+
+
+static struct {
+        bool running;
+        bool stop;
+        Thread_T thread;
+        Entry_T entries;
+        Resolver_Statistics_T statistics;
+        Mutex_T mutex;
+        Sem_T cond;
+        Sem_T resolved;
+} resolver = {.mutex = PTHREAD_MUTEX_INITIALIZER, .cond = PTHREAD_COND_INITIALIZER, .resolved = PTHREAD_COND_INITIALIZER};
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+static void _freeAddresses(struct addrinfo **addresses) {
+        while (*addresses) {
+                struct addrinfo *a = *addresses;
+                *addresses = a->ai_next;
+                FREE(a->ai_canonname);
+                FREE(a->ai_addr);
+                FREE(a);
+        }
+}
+
+
+static void _freeEntry(Entry_T *entry) {
+        _freeAddresses(&(*entry)->addresses);
+        FREE((*entry)->hostname);
+        FREE(*entry);
+}
+
+
+// Copy the address list to memory we own, so it can outlive the getaddrinfo() result, and set the port
+static struct addrinfo *_copyAddresses(const struct addrinfo *addresses, int port) {
+        struct addrinfo *head = NULL, **tail = &head;
+        for (const struct addrinfo *a = addresses; a; a = a->ai_next) {
+                struct addrinfo *copy;
+                NEW(copy);
+                *copy = *a;
+                copy->ai_next = NULL;
+                copy->ai_canonname = a->ai_canonname ? Str_dup(a->ai_canonname) : NULL;
+                copy->ai_addr = ALLOC(a->ai_addrlen);
+                memcpy(copy->ai_addr, a->ai_addr, a->ai_addrlen);
+                switch (copy->ai_family) {
+                        case AF_INET:
+                                ((struct sockaddr_in *)copy->ai_addr)->sin_port = htons(port);
+                                break;
+#ifdef HAVE_IPV6
+                        case AF_INET6:
+                                ((struct sockaddr_in6 *)copy->ai_addr)->sin6_port = htons(port);
+                                break;
+#endif
+                        default:
+                                break;
+                }
+                *tail = copy;
+                tail = &(copy->ai_next);
+        }
+        return head;
+}
+
+
+static Entry_T _find(const char *hostname, const struct addrinfo *hints) {
+        for (Entry_T e = resolver.entries; e; e = e->next)
+                if (e->family == hints->ai_family && e->socktype == hints->ai_socktype && e->protocol == hints->ai_protocol && e->flags == hints->ai_flags && Str_isEqual(e->hostname, hostname))
+                        return e;
+        return NULL;
+}
+
+
+// Add an unresolved entry, must be called with the mutex locked
+static Entry_T _insert(const char *hostname, const struct addrinfo *hints) {
+        Entry_T entry;
+        NEW(entry);
+        entry->hostname = Str_dup(hostname);
+        entry->family = hints->ai_family;
+        entry->socktype = hints->ai_socktype;
+        entry->protocol = hints->ai_protocol;
+        entry->flags = hints->ai_flags;
+        entry->next = resolver.entries;
+        resolver.entries = entry;
+        resolver.statistics.entries++;
+        return entry;
+}
+
+
+// Query the system resolver, must be called without holding the mutex
+static int _lookup(const char *hostname, const struct addrinfo *hints, struct addrinfo **addresses, char *error, int errorSize) {
+        struct addrinfo *result = NULL;
+        int status = getaddrinfo(hostname, NULL, hints, &result);
+        if (status) {
+                snprintf(error, errorSize, "%s", status == EAI_SYSTEM ? STRERROR : gai_strerror(status));
+                *addresses = NULL;
+        } else {
+                *addresses = _copyAddresses(result, 0);
+                freeaddrinfo(result);
+        }
+        return status;
+}
+
+
+// Store the lookup result in the entry, must be called with the mutex locked
+static void _update(Entry_T entry, int status, struct addrinfo *addresses, const char *error) {
+        time_t now = Time_now();
+        if (status == 0) {
+                _freeAddresses(&(entry->addresses));
+                entry->addresses = addresses;
+                entry->status = 0;
+                *entry->error = 0;
+                entry->expires = now + Run.limits.dnsTtl;
+                // Refresh the entry a bit ahead of the expiration
+                entry->refresh = entry->expires - Run.limits.dnsTtl / 5;
+        } else {
+                // Serve the stale addresses on temporary resolver failure, drop them if the name doesn't exist
+                if (status == EAI_NONAME || ! entry->addresses) {
+                        _freeAddresses(&(entry->addresses));
+                        entry->status = status;
+                        snprintf(entry->error, sizeof(entry->error), "%s", error);
+                }
+                entry->expires = now + Run.limits.dnsNegativeTtl;
+                // Retry after the negative time to live, even if the stale addresses are kept
+                entry->refresh = entry->expires;
+        }
+        entry->resolved = true;
+        Sem_broadcast(resolver.resolved);
+}
+
+
+static void *_refresher(__attribute__ ((unused)) void *args) {
+        set_signal_block();
+        Mutex_lock(resolver.mutex);
+        while (! resolver.stop) {
+                time_t now = Time_now();
+                Entry_T due = NULL;
+                for (Entry_T *e = &resolver.entries; *e;) {
+                        Entry_T entry = *e;
+                        if (entry->used + 2 * (time_t)Run.limits.dnsTtl < now && ! entry->refreshing) {
+                                // Not used anymore (e.g. the service was removed)
+                                *e = entry->next;
+                                resolver.statistics.entries--;
+                                _freeEntry(&entry);
+                                continue;
+                        }
+                        if (! due && ! entry->refreshing && entry->refresh <= now)
+                                due = entry;
+                        e = &entry->next;
+                }
+                if (due) {
+                        due->refreshing = true;
+                        char *hostname = Str_dup(due->hostname);
+                        struct addrinfo hints = {.ai_family = due->family, .ai_socktype = due->socktype, .ai_protocol = due->protocol, .ai_flags = due->flags};
+                        Mutex_unlock(resolver.mutex);
+                        char error[STRLEN] = {};
+                        struct addrinfo *addresses = NULL;
+                        int status = _lookup(hostname, &hints, &addresses, error, sizeof(error));
+                        DEBUG("DNS cache: refreshed '%s'%s%s\n", hostname, status ? " -- " : "", status ? error : "");
+                        FREE(hostname);
+                        Mutex_lock(resolver.mutex);
+                        due->refreshing = false;
+                        _update(due, status, addresses, error);
+                        resolver.statistics.refreshes++;
+                } else {
+                        struct timespec wait = {.tv_sec = Time_now() + 1, .tv_nsec = 0};
+                        Sem_timeWait(resolver.cond, resolver.mutex, wait);
+                }
+        }
+        Mutex_unlock(resolver.mutex);
+        return NULL;
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+void Resolver_start(void) {
+        ASSERT(! resolver.running);
+        if (Run.limits.dnsTtl == 0)
+                return;
+        resolver.stop = false;
+        Thread_create(resolver.thread, _refresher, NULL);
+        resolver.running = true;
+        // Queue the names used by the tests and notifications, so the validate thread finds them in the cache
+        for (Service_T s = servicelist; s; s = s->next) {
+                for (Port_T p = s->portlist; p; p = p->next)
+                        Socket_prefetch(p->hostname, p->type, p->family);
+                if (s->type == Service_Host)
+                        for (Icmp_T i = s->icmplist; i; i = i->next)
+                                icmp_prefetch(s->path, i);
+        }
+        for (MailServer_T m = Run.mailservers; m; m = m->next)
+                Socket_prefetch(m->host, Socket_Tcp, Socket_Ip);
+        for (Mmonit_T m = Run.mmonits; m; m = m->next)
+                Socket_prefetch(m->url->hostname, Socket_Tcp, Socket_Ip);
+}
+
+
+void Resolver_stop(void) {
+        Mutex_lock(resolver.mutex);
+        resolver.stop = true;
+        Sem_signal(resolver.cond);
+        Sem_broadcast(resolver.resolved);
+        Mutex_unlock(resolver.mutex);
+        if (resolver.running) {
+                Thread_join(resolver.thread);
+                resolver.running = false;
+        }
+        // The refresh thread is stopped, so no entry is being refreshed
+        Mutex_lock(resolver.mutex);
+        while (resolver.entries) {
+                Entry_T entry = resolver.entries;
+                resolver.entries = entry->next;
+                _freeEntry(&entry);
+        }
+        resolver.statistics.entries = 0;
+        Mutex_unlock(resolver.mutex);
+}
+
+
+struct addrinfo *Resolver_get(const char *hostname, int port, const struct addrinfo *hints, char *error, int errorSize) {
+        ASSERT(hostname);
+        ASSERT(hints);
+        ASSERT(error);
+        struct addrinfo *result = NULL;
+        if (Run.limits.dnsTtl == 0) {
+                // The cache is disabled
+                struct addrinfo *addresses = NULL;
+                if (_lookup(hostname, hints, &addresses, error, errorSize) == 0) {
+                        result = _copyAddresses(addresses, port);
+                        _freeAddresses(&addresses);
+                }
+                return result;
+        }
+        bool found = false;
+        time_t now = Time_now();
+        Mutex_lock(resolver.mutex);
+        Entry_T entry = _find(hostname, hints);
+        // The background thread is resolving a queued name for the first time, wait for its result instead of querying the resolver again
+        while (entry && ! entry->resolved && entry->refreshing && ! resolver.stop) {
+                Sem_wait(resolver.resolved, resolver.mutex);
+                entry = _find(hostname, hints);
+        }
+        // Serve an expired entry only if the background thread will refresh it
+        if (entry && entry->resolved && (entry->expires > now || resolver.running)) {
+                found = true;
+                entry->used = now;
+                if (entry->addresses) {
+                        resolver.statistics.hits++;
+                        result = _copyAddresses(entry->addresses, port);
+                } else {
+                        resolver.statistics.negativeHits++;
+                        snprintf(error, errorSize, "%s", entry->error);
+                }
+                if (entry->expires <= now)
+                        Sem_signal(resolver.cond);
+        }
+        Mutex_unlock(resolver.mutex);
+        if (! found) {
+                struct addrinfo *addresses = NULL;
+                int status = _lookup(hostname, hints, &addresses, error, errorSize);
+                if (status == 0)
+                        result = _copyAddresses(addresses, port);
+                Mutex_lock(resolver.mutex);
+                resolver.statistics.misses++;
+                if (! (entry = _find(hostname, hints)))
+                        entry = _insert(hostname, hints);
+                entry->used = now;
+                _update(entry, status, addresses, error);
+                Mutex_unlock(resolver.mutex);
+        }
+        return result;
+}
+
+
+void Resolver_prefetch(const char *hostname, const struct addrinfo *hints) {
+        ASSERT(hostname);
+        ASSERT(hints);
+        Mutex_lock(resolver.mutex);
+        if (resolver.running && ! _find(hostname, hints)) {
+                _insert(hostname, hints)->used = Time_now();
+                Sem_signal(resolver.cond);
+        }
+        Mutex_unlock(resolver.mutex);
+}
+
+
+void Resolver_free(struct addrinfo **result) {
+        ASSERT(result);
+        _freeAddresses(result);
+}
+
+
+void Resolver_statistics(Resolver_Statistics_T *statistics) {
+        ASSERT(statistics);
+        Mutex_lock(resolver.mutex);
+        *statistics = resolver.statistics;
+        Mutex_unlock(resolver.mutex);
+}
+
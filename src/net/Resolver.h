@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#ifndef RESOLVER_INCLUDED
+#define RESOLVER_INCLUDED
+
+#include <netdb.h>
+
+
+/**
+ * Caching host name resolver for the connection tests and notifications.
+ * The getaddrinfo() results are kept for the configured time to live
+ * (set limits { dnsttl }), failed lookups for the negative time to live
+ * (set limits { dnsnegativettl }). When the background refresh thread is
+ * running, the entries in use are resolved again before they expire and
+ * an expired entry is served until the refresh completes. A failed
+ * refresh is retried after the negative time to live. The names used by
+ * the configuration are queued by Resolver_start() and resolved by the
+ * background thread, so the caller only waits for a first lookup which
+ * is already in progress there.
+ *
+ * @author http://www.tildeslash.com/
+ * @see http://www.mmonit.com/
+ * @file
+ */
+
+
+typedef struct Resolver_Statistics_T {
+        int entries;                          /**< Number of cached names */
+        unsigned long long hits;       /**< Lookups answered from the cache */
+        unsigned long long negativeHits; /**< Failed lookups answered from the cache */
+        unsigned long long misses; /**< Lookups which had to query the resolver */
+        unsigned long long refreshes;    /**< Background refreshes performed */
+} Resolver_Statistics_T;
+
+
+/**
+ * Start the background refresh thread and queue the host names of the
+ * connection tests, pings, mail servers and M/Monit servers
+ */
+void Resolver_start(void);
+
+
+/**
+ * Stop the background refresh thread and drop the cache
+ */
+void Resolver_stop(void);
+
+
+/**
+ * Resolve the host name. The returned list is owned by the caller and
+ * must be released with Resolver_free().
+ * @param hostname The host name to resolve
+ * @param port The port number to set in the returned addresses
+ * @param hints The getaddrinfo() hints (family, socket type, protocol and flags)
+ * @param error Error buffer, set if the lookup failed
+ * @param errorSize The size of the error buffer
+ * @return The address list or NULL if the name cannot be resolved
+ */
+struct addrinfo *Resolver_get(const char *hostname, int port, const struct addrinfo *hints, char *error, int errorSize);
+
+
+/**
+ * Queue the host name for a lookup in the background thread. Does
+ * nothing if the name is already cached or the thread is not running.
+ * @param hostname The host name to resolve
+ * @param hints The getaddrinfo() hints (family, socket type, protocol and flags)
+ */
+void Resolver_prefetch(const char *hostname, const struct addrinfo *hints);
+
+
+/**
+ * Free the address list returned by Resolver_get()
+ * @param result A reference to the address list
+ */
+void Resolver_free(struct addrinfo **result);
+
+
+/**
+ * Get the cache statistics
+ * @param statistics Output: the cache statistics
+ */
+void Resolver_statistics(Resolver_Statistics_T *statistics);
+
+
+#endif
+
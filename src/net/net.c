@@ -136,8 +136,13 @@
 #include <arpa/inet.h>
 #endif
 
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
+
 #include "monit.h"
 #include "net.h"
+#include "Resolver.h"
 
 // libmonit
 #include "util/Convert.h"
@@ -157,6 +162,43 @@
 /* ----------------------------------------------------------------- Private */
 
 
+#define ICMP_INTERVAL 100000LL // Interval between the echo requests to the same host [us]
+#define ICMP_BATCH    32768    // Maximum number of echo requests in one batch (the sequence number is 16-bit)
+
+
+typedef struct IcmpSocket_T {
+        int family;
+        int socket;
+        Outgoing_T *outgoing;
+} IcmpSocket_T;
+
+
+typedef struct IcmpProbe_T {
+        const char *hostname;
+        Icmp_T icmp;
+        struct addrinfo *addresses;
+        struct addrinfo *addr;      // Address to ping, NULL if the host cannot be pinged
+        int socket;                 // Index of the shared socket
+        int received;               // Number of responses
+        double sum;                 // Sum of the response times [ms]
+        double jitter;              // Sum of the response time differences [ms]
+        double last;                // Last response time [ms]
+} IcmpProbe_T;
+
+
+typedef struct IcmpRequest_T {
+        int probe;                  // Index of the probe
+        int round;                  // Request number for the probe
+        bool done;                  // Response received, timed out or failed
+        long long due;              // When to send the request [us]
+        long long sent;             // When the request was sent [us]
+        long long deadline;         // When to stop waiting for the response [us]
+} IcmpRequest_T;
+
+
+static uint16_t _pingSequence = 0;
+
+
 /*
  * Compute Internet Checksum for "count" bytes beginning at location "addr".
  * Based on RFC1071.
@@ -178,19 +220,6 @@ static unsigned short _checksum(unsigned char *_addr, int count) {
 }
 
 
-__attribute__((format (printf, 3, 4))) static void _log_warningOrError(int attempt, int maxAttempts, const char *s, ...) {
-        ASSERT(s);
-        va_list ap;
-        va_start(ap, s);
-        if (attempt < maxAttempts) {
-                Log_vwarning(s, ap);
-        } else {
-                Log_verror(s, ap);
-        }
-        va_end(ap);
-}
-
-
 /* ------------------------------------------------------------------ Public */
 
 
@@ -297,7 +326,12 @@ int create_server_socket_unix(const char *path, int backlog, char error[STRLEN])
 }
 
 
-static void _setPingOptions(int socket, struct addrinfo *addr) {
+static void _setPingOptions(int socket, struct addrinfo *addr, int burst) {
+        // The replies of all hosts in the batch may arrive at once, make room for them in the receive buffer (the raw socket gets all ICMP traffic of the host too)
+        int size = 0, rcvbuf = burst * 2 * ICMP_MAXSIZE;
+        socklen_t len = sizeof(size);
+        if (getsockopt(socket, SOL_SOCKET, SO_RCVBUF, &size, &len) == 0 && size < rcvbuf && setsockopt(socket, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf)) < 0)
+                DEBUG("Ping: setsockopt for receive buffer size failed -- %s\n", System_getLastError());
 #ifdef HAVE_IPV6
         struct icmp6_filter filter;
         ICMP6_FILTER_SETBLOCKALL(&filter);
@@ -325,7 +359,7 @@ static void _setPingOptions(int socket, struct addrinfo *addr) {
 }
 
 
-static bool _sendPing(const char *hostname, int socket, struct addrinfo *addr, int size, int retry, int maxretries, int id, long long started) {
+static bool _sendPing(const char *hostname, int socket, struct addrinfo *addr, int size, uint16_t id, uint16_t seq, long long started) {
         char buf[ICMP_MAXSIZE] = {};
         int header_len = 0;
         unsigned long out_len = 0;
@@ -341,7 +375,7 @@ static bool _sendPing(const char *hostname, int socket, struct addrinfo *addr, i
                         out_icmp4->icmp_code = 0;
                         out_icmp4->icmp_cksum = 0;
                         out_icmp4->icmp_id = htons(id);
-                        out_icmp4->icmp_seq = htons(retry);
+                        out_icmp4->icmp_seq = htons(seq);
                         memcpy((long long *)(out_icmp4->icmp_data), &started, sizeof(long long)); // set data to timestamp
                         header_len = offsetof(struct icmp, icmp_data);
                         out_len = header_len + size;
@@ -355,7 +389,7 @@ static bool _sendPing(const char *hostname, int socket, struct addrinfo *addr, i
                         out_icmp6->icmp6_code = 0;
                         out_icmp6->icmp6_cksum = 0;
                         out_icmp6->icmp6_id = htons(id);
-                        out_icmp6->icmp6_seq = htons(retry);
+                        out_icmp6->icmp6_seq = htons(seq);
                         memcpy((long long *)(out_icmp6 + 1), &started, sizeof(long long)); // set data to timestamp
                         header_len = sizeof(struct icmp6_hdr);
                         out_len = header_len + size;
@@ -366,7 +400,7 @@ static bool _sendPing(const char *hostname, int socket, struct addrinfo *addr, i
                         break;
         }
         if (out_len > sizeof(buf)) {
-                _log_warningOrError(retry, maxretries, "Ping request for %s %d/%d failed -- too large (%d vs. maximum %lu bytes)\n", hostname, retry, maxretries, size, (unsigned long)(sizeof(buf) - header_len));
+                Log_error("Ping request for %s failed -- too large (%d vs. maximum %lu bytes)\n", hostname, size, (unsigned long)(sizeof(buf) - header_len));
                 return false;
         }
         ssize_t n;
@@ -374,171 +408,353 @@ static bool _sendPing(const char *hostname, int socket, struct addrinfo *addr, i
                 n = sendto(socket, out_icmp, out_len, 0, addr->ai_addr, addr->ai_addrlen);
         } while (n == -1 && errno == EINTR);
         if (n < 0) {
-                _log_warningOrError(retry, maxretries, "Ping request for %s %d/%d failed -- %s\n", hostname, retry, maxretries, STRERROR);
+                Log_warning("Ping request for %s failed -- %s\n", hostname, STRERROR);
                 return false;
         }
         return true;
 }
 
 
-static double _receivePing(const char *hostname, int socket, struct addrinfo *addr, int retry, int maxretries, int out_id, long long started, int timeout) {
-        int in_len = 0, read_timeout = timeout;
-        uint16_t in_id = 0, in_seq = 0;
-        unsigned char *data = NULL;
-        struct icmp *in_icmp4;
-        struct ip *in_iphdr4;
+/**
+ * Read one packet from the ICMP socket without blocking
+ * @return 1 if the packet is an echo reply with our id, 0 if the packet
+ * belongs to some other conversation, -1 if there are no more packets
+ */
+static int _receivePing(int socket, int family, uint16_t id, struct sockaddr_storage *in_addr, uint16_t *seq) {
+        char buf[ICMP_MAXSIZE];
+        socklen_t addrlen = sizeof(struct sockaddr_storage);
+        ssize_t n;
+        do {
+                n = recvfrom(socket, buf, sizeof(buf), MSG_DONTWAIT, (struct sockaddr *)in_addr, &addrlen);
+        } while (n == -1 && errno == EINTR);
+        if (n < 0) {
+                if (errno != EAGAIN && errno != EWOULDBLOCK)
+                        Log_error("Ping response receive failed -- %s\n", STRERROR);
+                return -1;
+        }
+        /* read from raw socket via recvfrom() provides messages regardless of origin, we have to skip responses belonging to other conversations or different ICMP types */
+        if (in_addr->ss_family != family)
+                return 0;
+        switch (family) {
+                case AF_INET:
+                        {
+                                struct ip *in_iphdr4 = (struct ip *)buf;
+                                if (n < (ssize_t)sizeof(struct ip) || n < in_iphdr4->ip_hl * 4 + ICMP_MINLEN)
+                                        return 0;
+                                struct icmp *in_icmp4 = (struct icmp *)(buf + in_iphdr4->ip_hl * 4);
+                                if (in_icmp4->icmp_type != ICMP_ECHOREPLY || ntohs(in_icmp4->icmp_id) != id)
+                                        return 0;
+                                *seq = ntohs(in_icmp4->icmp_seq);
+                        }
+                        return 1;
 #ifdef HAVE_IPV6
-        struct icmp6_hdr *in_icmp6;
+                case AF_INET6:
+                        {
+                                if (n < (ssize_t)sizeof(struct icmp6_hdr))
+                                        return 0;
+                                struct icmp6_hdr *in_icmp6 = (struct icmp6_hdr *)buf;
+                                if (in_icmp6->icmp6_type != ICMP6_ECHO_REPLY || ntohs(in_icmp6->icmp6_id) != id)
+                                        return 0;
+                                *seq = ntohs(in_icmp6->icmp6_seq);
+                        }
+                        return 1;
 #endif
-        ssize_t n;
-        char buf[ICMP_MAXSIZE] = {};
+                default:
+                        break;
+        }
+        return 0;
+}
+
+
+static bool _isSameOutgoing(Outgoing_T *a, Outgoing_T *b) {
+        return a == b || (! a->ip && ! b->ip) || IS(a->ip, b->ip);
+}
+
+
+static bool _isPingSource(struct sockaddr_storage *in_addr, struct addrinfo *addr) {
         switch (addr->ai_family) {
                 case AF_INET:
-                        in_len = 36; // 20 bytes for IP header + 8 bytes for minimum ICMP fields (type, code, checksum, id, seq) + 8 bytes for data payload
-                        break;
+                        return memcmp(&((struct sockaddr_in *)in_addr)->sin_addr, &((struct sockaddr_in *)(addr->ai_addr))->sin_addr, sizeof(struct in_addr)) == 0;
 #ifdef HAVE_IPV6
                 case AF_INET6:
-                        in_len = sizeof(struct icmp6_hdr);
-                        break;
+                        return memcmp(&((struct sockaddr_in6 *)in_addr)->sin6_addr, &((struct sockaddr_in6 *)(addr->ai_addr))->sin6_addr, sizeof(struct in6_addr)) == 0;
 #endif
                 default:
                         break;
         }
-        while (read_timeout > 0 && Net_canRead(socket, read_timeout)) {
-                if (Run.flags & Run_Stopped) {
-                        return -1.;
-                }
-                long long stopped = Time_micro();
-                struct sockaddr_storage in_addr;
-                socklen_t addrlen = sizeof(in_addr);
-                bool in_addrmatch = false, in_typematch = false;
-                do {
-                        n = recvfrom(socket, buf, sizeof(buf), 0, (struct sockaddr *)&in_addr, &addrlen);
-                } while (n == -1 && errno == EINTR);
-                if (n < 0) {
-                        _log_warningOrError(retry, maxretries, "Ping response from %s %d/%d failed -- %s\n", hostname, retry, maxretries, STRERROR);
-                        return -1.;
-                } else if (n >= in_len) {
-                        /* read from raw socket via recvfrom() provides messages regardless of origin, we have to check the IP and skip responses belonging to other conversations or different ICMP types (n < in_len) */
-                        switch (in_addr.ss_family) {
-                                case AF_INET:
-                                        in_addrmatch = memcmp(&((struct sockaddr_in *)&in_addr)->sin_addr, &((struct sockaddr_in *)(addr->ai_addr))->sin_addr, sizeof(struct in_addr)) ? false : true;
-                                        in_iphdr4 = (struct ip *)buf;
-                                        in_icmp4 = (struct icmp *)(buf + in_iphdr4->ip_hl * 4);
-                                        in_typematch = in_icmp4->icmp_type == ICMP_ECHOREPLY ? true : false;
-                                        in_id = ntohs(in_icmp4->icmp_id);
-                                        in_seq = ntohs(in_icmp4->icmp_seq);
-                                        data = (unsigned char *)in_icmp4->icmp_data;
-                                        break;
+        return false;
+}
+
+
+/**
+ * Find the shared ICMP socket for the given family and outgoing address or create a new one
+ * @return index of the socket, -1 on error or -2 if the monit user has no permission to create raw socket
+ */
+static int _getPingSocket(IcmpSocket_T *sockets, int *socketsCount, const char *hostname, struct addrinfo *addr, Outgoing_T *outgoing, int burst) {
+        for (int i = 0; i < *socketsCount; i++)
+                if (sockets[i].family == addr->ai_family && _isSameOutgoing(sockets[i].outgoing, outgoing))
+                        return i;
+        int s = -1;
+        switch (addr->ai_family) {
+                case AF_INET:
+                        s = socket(AF_INET, SOCK_RAW, IPPROTO_ICMP);
+                        break;
 #ifdef HAVE_IPV6
-                                case AF_INET6:
-                                        in_addrmatch = memcmp(&((struct sockaddr_in6 *)&in_addr)->sin6_addr, &((struct sockaddr_in6 *)(addr->ai_addr))->sin6_addr, sizeof(struct in6_addr)) ? false : true;
-                                        in_icmp6 = (struct icmp6_hdr *)buf;
-                                        in_typematch = in_icmp6->icmp6_type == ICMP6_ECHO_REPLY ? true : false;
-                                        in_id = ntohs(in_icmp6->icmp6_id);
-                                        in_seq = ntohs(in_icmp6->icmp6_seq);
-                                        data = (unsigned char *)(in_icmp6 + 1);
-                                        break;
-#endif
-                                default:
-                                        Log_error("Invalid address family: %d\n", in_addr.ss_family);
-                                        return -1.;
-                        }
-                }
-                if (n < in_len || in_addr.ss_family != addr->ai_family || ! in_addrmatch || ! in_typematch || in_id != out_id || in_seq > (uint16_t)maxretries) {
-                        // Try to read next packet, but don't exceed the timeout while waiting for our response so we won't loop forever if the socket is flooded with other ICMP packets
-                        if (stopped < started) {
-                                // Time jumped
-                                break;
-                        } else {
-                                read_timeout = timeout - (stopped - started) / 1000.;
-                        }
-                } else {
-                        memcpy(&started, data, sizeof(long long));
-                        double response = (double)(stopped - started) / 1000.; // Convert microseconds to milliseconds
-                        DEBUG("Ping response for %s %d/%d succeeded -- received id=%d sequence=%d response_time=%s\n", hostname, retry, maxretries, in_id, in_seq, Convert_time2str(response, (char[11]){}));
-                        return response; // Wait for one response only
+                case AF_INET6:
+                        s = socket(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6);
+                        break;
+#endif
+                default:
+                        Log_error("Ping for %s -- unknown address family: %d\n", hostname, addr->ai_family);
+                        return -1;
+        }
+        if (s < 0) {
+                if (errno == EACCES || errno == EPERM) {
+                        DEBUG("Ping for %s -- cannot create socket: %s\n", hostname, STRERROR);
+                        return -2;
                 }
+                Log_error("Ping for %s -- cannot create socket: %s\n", hostname, STRERROR);
+                return -1;
         }
-        _log_warningOrError(retry, maxretries, "Ping response for %s %d/%d timed out -- no response within %s\n", hostname, retry, maxretries, Convert_time2str(timeout, (char[11]){}));
-        return -1.;
+        if (outgoing->ip && bind(s, (struct sockaddr *)&(outgoing->addr), outgoing->addrlen) < 0) {
+                Log_error("Cannot bind to outgoing address -- %s\n", STRERROR);
+                Net_close(s);
+                return -1;
+        }
+        _setPingOptions(s, addr, burst);
+        sockets[*socketsCount].family = addr->ai_family;
+        sockets[*socketsCount].socket = s;
+        sockets[*socketsCount].outgoing = outgoing;
+        return (*socketsCount)++;
 }
 
 
-double icmp_echo(const char *hostname, Socket_Family family, Outgoing_T *outgoing, int size, int timeout, int maxretries) {
-        ASSERT(hostname);
-        ASSERT(size > 0);
-        double response = -1.;
-        struct addrinfo *result, hints = {
+static bool _getPingHints(Socket_Family family, struct addrinfo *hints) {
+        *hints = (struct addrinfo){
                 /* filter for only one sockettype to not get back one address multiple times for each protocol and sockettype */
                 .ai_socktype = SOCK_RAW,
         };
         switch (family) {
                 case Socket_Ip:
-                        hints.ai_family = AF_UNSPEC;
+                        hints->ai_family = AF_UNSPEC;
                         break;
                 case Socket_Ip4:
-                        hints.ai_family = AF_INET;
+                        hints->ai_family = AF_INET;
                         break;
 #ifdef HAVE_IPV6
                 case Socket_Ip6:
-                        hints.ai_family = AF_INET6;
+                        hints->ai_family = AF_INET6;
                         break;
 #endif
                 default:
                         Log_error("Invalid socket family %d\n", family);
-                        return response;
+                        return false;
         }
-        int status = getaddrinfo(hostname, NULL, &hints, &result);
-        if (status) {
-                Log_error("Ping for %s -- getaddrinfo failed: %s\n", hostname, status == EAI_SYSTEM ? STRERROR : gai_strerror(status));
-                return response;
+        return true;
+}
+
+
+// Returns the address which follows 'addr' (the first one if NULL) and matches the outgoing address family
+static struct addrinfo *_nextPingAddress(IcmpProbe_T *probe, struct addrinfo *addr) {
+        for (addr = addr ? addr->ai_next : probe->addresses; addr; addr = addr->ai_next)
+                if (probe->icmp->outgoing.addrlen == 0 || probe->icmp->outgoing.addrlen == addr->ai_addrlen)
+                        return addr;
+        return NULL;
+}
+
+
+static struct addrinfo *_resolvePing(IcmpProbe_T *probe) {
+        struct addrinfo hints;
+        if (! _getPingHints(probe->icmp->family, &hints))
+                return NULL;
+        char error[STRLEN];
+        if (! (probe->addresses = Resolver_get(probe->hostname, 0, &hints, error, sizeof(error)))) {
+                Log_error("Ping for %s -- getaddrinfo failed: %s\n", probe->hostname, error);
+                return NULL;
         }
-        int s = -1;
-        for (struct addrinfo *addr = result; addr && response < 0.; addr = addr->ai_next) {
-                if (outgoing->addrlen == 0 || outgoing->addrlen == addr->ai_addrlen) {
-                        switch (addr->ai_family) {
-                                case AF_INET:
-                                        s = socket(AF_INET, SOCK_RAW, IPPROTO_ICMP);
-                                        break;
-#ifdef HAVE_IPV6
-                                case AF_INET6:
-                                        s = socket(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6);
-                                        break;
-#endif
-                                default:
-                                        Log_error("Ping for %s -- unknown address family: %d\n", hostname, addr->ai_family);
-                                        continue;
+        struct addrinfo *addr = _nextPingAddress(probe, NULL);
+        if (! addr)
+                Log_error("Ping for %s -- no address matching the outgoing address family\n", probe->hostname);
+        return addr;
+}
+
+
+/**
+ * Assign the shared socket to the probe and schedule its requests, the requests to the same host are spaced by ICMP_INTERVAL.
+ * If no socket can be created for the probe address, the next address is tried
+ * @return true if the requests were scheduled, false if the host cannot be pinged (the probe address is set to NULL)
+ */
+static bool _schedulePing(IcmpProbe_T *probe, int index, IcmpRequest_T *requests, IcmpSocket_T *sockets, int *socketsCount, int burst, long long started, int *pending) {
+        for (; probe->addr; probe->addr = _nextPingAddress(probe, probe->addr)) {
+                probe->socket = _getPingSocket(sockets, socketsCount, probe->hostname, probe->addr, &(probe->icmp->outgoing), burst);
+                if (probe->socket >= 0) {
+                        for (int k = 0; k < probe->icmp->count; k++) {
+                                requests[k] = (IcmpRequest_T){.probe = index, .round = k, .due = started + k * ICMP_INTERVAL};
+                                (*pending)++;
                         }
-                        if (s >= 0) {
-                                if (outgoing->ip && bind(s, (struct sockaddr *)&(outgoing->addr), outgoing->addrlen) < 0) {
-                                        Log_error("Cannot bind to outgoing address -- %s\n", STRERROR);
-                                } else {
-                                        _setPingOptions(s, addr);
-                                        uint16_t id = getpid() & 0xFFFF;
-                                        for (int retry = 1; retry <= maxretries && ! (Run.flags & Run_Stopped); retry++) {
-                                                long long started = Time_micro();
-                                                if (_sendPing(hostname, s, addr, size, retry, maxretries, id, started) && (response = _receivePing(hostname, s, addr, retry, maxretries, id, started, timeout)) >= 0.) {
-                                                        // Success
-                                                        break;
-                                                }
+                        return true;
+                }
+                probe->icmp->response = probe->socket;
+        }
+        for (int k = 0; k < probe->icmp->count; k++)
+                requests[k].done = true;
+        return false;
+}
+
+
+static void _receivePings(IcmpSocket_T *socket, IcmpProbe_T *probes, IcmpRequest_T *requests, int requestsCount, uint16_t id, uint16_t base, int *pending) {
+        int rv;
+        uint16_t seq = 0;
+        struct sockaddr_storage in_addr;
+        while ((rv = _receivePing(socket->socket, socket->family, id, &in_addr, &seq)) >= 0) {
+                long long stopped = Time_micro();
+                int r = (uint16_t)(seq - base);
+                if (rv == 0 || r >= requestsCount)
+                        continue;
+                IcmpRequest_T *request = &requests[r];
+                IcmpProbe_T *probe = &probes[request->probe];
+                if (! request->sent || request->done || ! _isSameOutgoing(&(probe->icmp->outgoing), socket->outgoing) || ! _isPingSource(&in_addr, probe->addr))
+                        continue;
+                request->done = true;
+                (*pending)--;
+                if (stopped < request->sent)
+                        continue; // Time jumped
+                double response = (double)(stopped - request->sent) / 1000.; // Convert microseconds to milliseconds
+                if (probe->received)
+                        probe->jitter += response > probe->last ? response - probe->last : probe->last - response;
+                probe->last = response;
+                probe->sum += response;
+                probe->received++;
+                DEBUG("Ping response for %s %d/%d succeeded -- received id=%d sequence=%d response_time=%s\n", probe->hostname, request->round + 1, probe->icmp->count, id, seq, Convert_time2str(response, (char[11]){}));
+        }
+}
+
+
+static void _ping(const char **hostnames, Icmp_T *icmps, int count) {
+        int socketsCount = 0, requestsCount = 0, pending = 0;
+        // One socket per address family and outgoing address, a host may fall back to an address of the other family
+        IcmpSocket_T *sockets = CALLOC(2 * count, sizeof(IcmpSocket_T));
+        IcmpProbe_T *probes = CALLOC(count, sizeof(IcmpProbe_T));
+        for (int i = 0; i < count; i++)
+                requestsCount += icmps[i]->count;
+        IcmpRequest_T *requests = CALLOC(requestsCount > 0 ? requestsCount : 1, sizeof(IcmpRequest_T));
+        struct pollfd *fds = CALLOC(2 * count, sizeof(struct pollfd));
+        uint16_t id = getpid() & 0xFFFF;
+        uint16_t base = _pingSequence;
+        _pingSequence += requestsCount;
+        // Resolve the hosts and assign the shared sockets
+        long long started = Time_micro();
+        for (int i = 0, r = 0; i < count; r += icmps[i]->count, i++) {
+                IcmpProbe_T *probe = &probes[i];
+                probe->hostname = hostnames[i];
+                probe->icmp = icmps[i];
+                probe->icmp->response = -1.;
+                probe->icmp->jitter = -1.;
+                probe->icmp->loss = -1.;
+                probe->addr = _resolvePing(probe);
+                _schedulePing(probe, i, requests + r, sockets, &socketsCount, count, started, &pending);
+        }
+        while (pending > 0 && ! (Run.flags & Run_Stopped)) {
+                for (int i = 0; i < socketsCount; i++) {
+                        fds[i].fd = sockets[i].socket;
+                        fds[i].events = POLLIN;
+                }
+                while (pending > 0 && ! (Run.flags & Run_Stopped)) {
+                        // Send the requests which are due and expire the requests which were not answered in time
+                        long long now = Time_micro(), wakeup = now + 1000000LL;
+                        for (int r = 0; r < requestsCount; r++) {
+                                IcmpRequest_T *request = &requests[r];
+                                if (request->done)
+                                        continue;
+                                IcmpProbe_T *probe = &probes[request->probe];
+                                if (! request->sent) {
+                                        if (request->due > now) {
+                                                wakeup = MIN(wakeup, request->due);
+                                                continue;
                                         }
+                                        if (! _sendPing(probe->hostname, sockets[probe->socket].socket, probe->addr, probe->icmp->size, id, (uint16_t)(base + r), now)) {
+                                                request->done = true;
+                                                pending--;
+                                                continue;
+                                        }
+                                        request->sent = now;
+                                        request->deadline = now + probe->icmp->timeout * 1000LL;
                                 }
-                                Net_close(s);
-                        } else {
-                                // Cannot create a socket -> return error
-                                if (errno == EACCES || errno == EPERM) {
-                                        DEBUG("Ping for %s -- cannot create socket: %s\n", hostname, STRERROR);
-                                        response = -2.;
+                                if (request->deadline <= now || now < request->sent) {
+                                        DEBUG("Ping response for %s %d/%d timed out -- no response within %s\n", probe->hostname, request->round + 1, probe->icmp->count, Convert_time2str(probe->icmp->timeout, (char[11]){}));
+                                        request->done = true;
+                                        pending--;
                                 } else {
-                                        Log_error("Ping for %s -- cannot create socket: %s\n", hostname, STRERROR);
+                                        wakeup = MIN(wakeup, request->deadline);
                                 }
-                                goto error;
+                        }
+                        if (pending <= 0)
+                                break;
+                        int timeout = (int)((wakeup - now + 999LL) / 1000LL);
+                        int rv = poll(fds, socketsCount, timeout > 0 ? timeout : 1);
+                        if (rv < 0 && errno != EINTR) {
+                                Log_error("Ping failed -- poll error: %s\n", STRERROR);
+                                break;
+                        }
+                        for (int i = 0; i < socketsCount && rv > 0; i++)
+                                if (fds[i].revents & POLLIN)
+                                        _receivePings(&sockets[i], probes, requests, requestsCount, id, base, &pending);
+                }
+                if (pending > 0 || (Run.flags & Run_Stopped))
+                        break;
+                // Ping the next address of the hosts which didn't respond (late replies from the previous address don't match the source address check)
+                started = Time_micro();
+                for (int i = 0, r = 0; i < count; r += icmps[i]->count, i++) {
+                        IcmpProbe_T *probe = &probes[i];
+                        struct addrinfo *last = probe->addr;
+                        if (last && ! probe->received && (probe->addr = _nextPingAddress(probe, last))) {
+                                DEBUG("Ping for %s -- no response, trying the next address\n", probe->hostname);
+                                if (! _schedulePing(probe, i, requests + r, sockets, &socketsCount, count, started, &pending))
+                                        probe->addr = last;
+                        } else {
+                                probe->addr = last;
                         }
                 }
         }
-error:
-        freeaddrinfo(result);
-        return response;
+        for (int i = 0; i < count; i++) {
+                IcmpProbe_T *probe = &probes[i];
+                if (probe->addr) {
+                        if (probe->received) {
+                                probe->icmp->response = probe->sum / probe->received;
+                                probe->icmp->jitter = probe->received > 1 ? probe->jitter / (probe->received - 1) : 0.;
+                        } else {
+                                Log_error("Ping response for %s timed out -- no response within %s\n", probe->hostname, Convert_time2str(probe->icmp->timeout, (char[11]){}));
+                        }
+                        probe->icmp->loss = probe->icmp->count > 0 ? 100. * (double)(probe->icmp->count - probe->received) / (double)probe->icmp->count : 100.;
+                }
+                if (probe->addresses)
+                        Resolver_free(&(probe->addresses));
+        }
+        for (int i = 0; i < socketsCount; i++)
+                Net_close(sockets[i].socket);
+        FREE(fds);
+        FREE(requests);
+        FREE(probes);
+        FREE(sockets);
+}
+
+
+void icmp_prefetch(const char *hostname, Icmp_T icmp) {
+        struct addrinfo hints;
+        if (hostname && icmp->type == ICMP_ECHO && _getPingHints(icmp->family, &hints))
+                Resolver_prefetch(hostname, &hints);
+}
+
+
+void icmp_echo(const char **hostnames, Icmp_T *icmps, int count) {
+        ASSERT(hostnames);
+        ASSERT(icmps);
+        // The requests in one batch are identified by a 16-bit sequence number, split large sets of hosts to several batches
+        for (int i = 0, n = 0; i < count; i += n) {
+                int requests = icmps[i]->count;
+                for (n = 1; i + n < count && requests + icmps[i + n]->count <= ICMP_BATCH; n++)
+                        requests += icmps[i + n]->count;
+                _ping(hostnames + i, icmps + i, n);
+        }
 }
 
@@ -66,16 +66,30 @@ int create_server_socket_unix(const char *path, int backlog, char error[STRLEN])
 
 
 /**
- * Create a ICMP socket against hostname, send echo and wait for response.
- * The 'count' echo requests  is send and we expect at least one reply.
- * @param hostname The host to open a socket at
- * @param family The socket family to use
- * @param outgoing Outgoing IP address (optional)
- * @param size The ping size
- * @param timeout If response will not come within timeout milliseconds abort
- * @param count How many pings to send
- * @return response time on success, -1 on error
+ * Queue the host name for a background lookup, so a later
+ * icmp_echo() for the host finds the addresses in the resolver cache
+ * @param hostname The host to ping
+ * @param icmp The ping test
+ */
+void icmp_prefetch(const char *hostname, Icmp_T icmp);
+
+
+/**
+ * Ping several hosts concurrently. One raw socket per address family
+ * (and outgoing address) is shared by all hosts, the echo requests to all
+ * hosts are sent at once and the responses are matched by the id and
+ * sequence number, so the time spent is bounded by the timeout rather
+ * than by the number of hosts. Each host gets 'count' echo requests and
+ * is available if at least one reply arrives. The result is stored in
+ * the Icmp_T object: response is the average response time in
+ * milliseconds (-1 on error, -2 if the monit user has no permission to
+ * create a raw socket), jitter is the mean difference between consecutive
+ * response times in milliseconds and loss is the percentage of requests
+ * without reply.
+ * @param hostnames The hosts to ping
+ * @param icmps The ping tests, one per host
+ * @param count The number of hosts
  */
-double icmp_echo(const char *hostname, Socket_Family family, Outgoing_T *outgoing, int size, int timeout, int count);
+void icmp_echo(const char **hostnames, Icmp_T *icmps, int count);
 
 #endif
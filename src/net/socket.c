@@ -76,6 +76,7 @@
 #include "monit.h"
 #include "socket.h"
 #include "SslServer.h"
+#include "Resolver.h"
 
 // libmonit
 #include "exceptions/assert.h"
@@ -106,6 +107,10 @@ typedef enum {
 #define RBUFFER_SIZE 1460
 
 
+// Delay between the connection attempts to the addresses of one host [ms] (RFC 8305)
+#define CONNECT_ATTEMPT_DELAY 250
+
+
 #define T Socket_T
 struct T {
         Socket_Type type;
@@ -116,6 +121,8 @@ struct T {
         int timeout; // milliseconds
         int length;
         int offset;
+        long long mark; // microseconds, end of the last connection phase, start of the wait for the first response byte
+        unsigned int retransmits; // TCP retransmits of the connection at the last sample
         char *host;
         Port_T Port;
 #ifdef HAVE_OPENSSL
@@ -148,9 +155,11 @@ static int _fill(T S, int timeout) {
         else
 #endif
                 n = (int)Net_read(S->socket, S->buffer + S->length,  RBUFFER_SIZE - S->length, timeout);
-        if (n > 0)
+        if (n > 0) {
                 S->length += n;
-        else if (n < 0)
+                if (S->Port && S->Port->timing[Timing_FirstByte] < 0)
+                        S->Port->timing[Timing_FirstByte] = (double)(Time_micro() - S->mark) / 1000.;
+        } else if (n < 0)
                 return -1;
         else if (! (errno == EAGAIN || errno == EWOULDBLOCK)) // Peer closed connection
                 return -1;
@@ -226,79 +235,235 @@ static bool _doConnect(int s, const struct sockaddr *addr, socklen_t addrlen, in
 }
 
 
-static T _createIpSocket(const char *host, const struct sockaddr *addr, socklen_t addrlen, const struct sockaddr *localaddr, socklen_t localaddrlen, int family, int type, int protocol, int timeout) {
-        ASSERT(host);
-        char error[STRLEN];
-        int s = socket(family, type, protocol);
+// Start the non-blocking connect to the address, return the socket or -1 if the attempt failed immediately
+static int _startConnect(const struct addrinfo *address, const struct sockaddr *localaddr, socklen_t localaddrlen, bool *connected, char *error, int errorlen) {
+        int s = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
         if (s >= 0) {
-                if (localaddr) {
-                        if (bind(s, localaddr, localaddrlen) < 0) {
-                                snprintf(error, sizeof(error), "Cannot bind to outgoing address -- %s", STRERROR);
-                                goto error;
+                if (localaddr && bind(s, localaddr, localaddrlen) < 0) {
+                        snprintf(error, errorlen, "Cannot bind to outgoing address -- %s", STRERROR);
+                } else if (! Net_setNonBlocking(s)) {
+                        snprintf(error, errorlen, "Cannot set nonblocking socket -- %s", STRERROR);
+                } else if (fcntl(s, F_SETFD, FD_CLOEXEC) == -1) {
+                        snprintf(error, errorlen, "Cannot set socket close on exec -- %s", STRERROR);
+                } else if (connect(s, address->ai_addr, address->ai_addrlen) == 0) {
+                        *connected = true;
+                        return s;
+                } else if (errno == EINPROGRESS) {
+                        *connected = false;
+                        return s;
+                } else {
+                        snprintf(error, errorlen, "%s", STRERROR);
+                }
+                Net_close(s);
+        } else {
+                snprintf(error, errorlen, "Cannot create socket to %s -- %s", _addressToString(address->ai_addr, address->ai_addrlen, (char[2048]){}, 2048), STRERROR);
+        }
+        return -1;
+}
+
+
+/*
+ * Order the addresses for the connection race (RFC 8305, section 4): keep the
+ * resolver preference, but interleave the address families, so an unreachable
+ * address family doesn't delay the connection. Only addresses matching the
+ * outgoing address family are used.
+ */
+static struct addrinfo **_getCandidates(struct addrinfo *result, socklen_t localaddrlen, int *count) {
+        int total = 0;
+        for (struct addrinfo *r = result; r; r = r->ai_next)
+                total++;
+        struct addrinfo **candidates = CALLOC(total + 1, sizeof(struct addrinfo *));
+        bool *used = CALLOC(total + 1, sizeof(bool));
+        int family = result ? result->ai_family : AF_UNSPEC;
+        *count = 0;
+        for (bool found = true; found;) {
+                found = false;
+                // Take the next unused address of the current family, or of any family if there is none left
+                for (int pass = 0; pass < 2 && ! found; pass++) {
+                        int i = 0;
+                        for (struct addrinfo *r = result; r; r = r->ai_next, i++) {
+                                if (! used[i] && (pass || r->ai_family == family)) {
+                                        used[i] = true;
+                                        found = true;
+                                        if (localaddrlen == 0 || localaddrlen == r->ai_addrlen)
+                                                candidates[(*count)++] = r;
+                                        family = r->ai_family == AF_INET ? AF_INET6 : AF_INET;
+                                        break;
+                                }
                         }
                 }
-                if (Net_setNonBlocking(s)) {
-                        if (fcntl(s, F_SETFD, FD_CLOEXEC) != -1) {
-                                if (_doConnect(s, addr, addrlen, timeout, error, sizeof(error))) {
-                                        T S;
-                                        NEW(S);
-                                        S->socket = s;
-                                        S->type = type;
-                                        S->family = family == AF_INET ? Socket_Ip4 : Socket_Ip6;
-                                        S->timeout = timeout;
-                                        S->host = Str_dup(host);
-                                        S->port = _getPort(addr);
-                                        S->connection_type = Connection_Client;
-                                        return S;
+        }
+        FREE(used);
+        return candidates;
+}
+
+
+static bool _hasCandidates(struct addrinfo **candidates, int count) {
+        for (int i = 0; i < count; i++)
+                if (candidates[i])
+                        return true;
+        return false;
+}
+
+
+/*
+ * Connect to the first responding address (RFC 8305 "Happy Eyeballs"): the
+ * connection attempts are started one after another, delayed by
+ * CONNECT_ATTEMPT_DELAY or immediately if the previous attempt failed, and the
+ * first established connection is used. Each attempt has its own timeout. The
+ * candidates which failed to connect are removed from the array (set to NULL),
+ * the winner is removed as well, so the caller can race the remaining addresses
+ * if the connection is not usable. Throws IOException with the last error if no
+ * connection could be established.
+ */
+static T _createIpSocket(const char *host, struct addrinfo **candidates, int count, const struct sockaddr *localaddr, socklen_t localaddrlen, int timeout) {
+        ASSERT(host);
+        if (count == 0)
+                THROW(IOException, "No address to connect to");
+        char error[STRLEN] = {};
+        int winner = -1;
+        int sockets[count];
+        long long deadlines[count];
+        struct pollfd fds[count];
+        int active[count];
+        for (int i = 0; i < count; i++)
+                sockets[i] = -1;
+        int next = 0;
+        long long nextStart = Time_milli();
+        while (winner < 0) {
+                long long now = Time_milli();
+                // Start the next attempt if it's time to or if there is no attempt in progress
+                int pending = 0;
+                for (int i = 0; i < count; i++)
+                        if (sockets[i] >= 0)
+                                pending++;
+                while (next < count && (! candidates[next] || now >= nextStart || pending == 0)) {
+                        int i = next++;
+                        if (! candidates[i])
+                                continue;
+                        bool connected = false;
+                        if ((sockets[i] = _startConnect(candidates[i], localaddr, localaddrlen, &connected, error, sizeof(error))) >= 0) {
+                                if (connected) {
+                                        winner = i;
+                                        break;
                                 }
+                                deadlines[i] = now + timeout;
+                                nextStart = now + CONNECT_ATTEMPT_DELAY;
+                                pending++;
+                                break;
+                        }
+                        DEBUG("Cannot connect to %s -- %s\n", _addressToString(candidates[i]->ai_addr, candidates[i]->ai_addrlen, (char[2048]){}, 2048), error);
+                        candidates[i] = NULL;
+                }
+                if (winner >= 0)
+                        break;
+                if (pending == 0) {
+                        if (next >= count)
+                                break;
+                        continue;
+                }
+                // Wait for the attempts in progress until the next attempt is due or the earliest attempt times out
+                long long wakeup = next < count ? nextStart : LLONG_MAX;
+                int n = 0;
+                for (int i = 0; i < count; i++) {
+                        if (sockets[i] >= 0) {
+                                fds[n] = (struct pollfd){.fd = sockets[i], .events = POLLIN | POLLOUT};
+                                active[n++] = i;
+                                if (deadlines[i] < wakeup)
+                                        wakeup = deadlines[i];
+                        }
+                }
+                int rv = poll(fds, n, wakeup > now ? (int)(wakeup - now) : 0);
+                if (rv == -1 && errno != EINTR) {
+                        snprintf(error, sizeof(error), "Poll failed: %s", STRERROR);
+                        break;
+                }
+                now = Time_milli();
+                for (int k = 0; k < n && winner < 0; k++) {
+                        int i = active[k];
+                        if (rv > 0 && fds[k].revents) {
+                                int err = 0;
+                                socklen_t errlen = sizeof(err);
+                                if (getsockopt(sockets[i], SOL_SOCKET, SO_ERROR, &err, &errlen) < 0)
+                                        snprintf(error, sizeof(error), "Read of error details failed: %s", STRERROR);
+                                else if (err)
+                                        snprintf(error, sizeof(error), "%s", strerror(err));
+                                else if (fds[k].revents & (POLLIN | POLLOUT))
+                                        winner = i;
+                                else
+                                        snprintf(error, sizeof(error), "Not ready for I/O");
+                        } else if (now >= deadlines[i]) {
+                                snprintf(error, sizeof(error), "Connection timed out");
                         } else {
-                                snprintf(error, sizeof(error), "Cannot set socket close on exec -- %s", STRERROR);
+                                continue;
+                        }
+                        if (winner < 0) {
+                                DEBUG("Cannot connect to %s -- %s\n", _addressToString(candidates[i]->ai_addr, candidates[i]->ai_addrlen, (char[2048]){}, 2048), error);
+                                Net_close(sockets[i]);
+                                sockets[i] = -1;
+                                candidates[i] = NULL;
+                                // Start the next attempt without waiting for the delay
+                                nextStart = now;
                         }
-                } else {
-                        snprintf(error, sizeof(error), "Cannot set nonblocking socket -- %s", STRERROR);
                 }
-error:
-                Net_close(s);
-        } else {
-                snprintf(error, sizeof(error), "Cannot create socket to %s -- %s", _addressToString(addr, addrlen, (char[2048]){}, 2048), STRERROR);
         }
-        THROW(IOException, "%s", error);
-        return NULL;
+        // Abort the attempts which lost the race, the addresses stay candidates
+        for (int i = 0; i < count; i++)
+                if (i != winner && sockets[i] >= 0)
+                        Net_close(sockets[i]);
+        if (winner < 0)
+                THROW(IOException, "%s", error);
+        T S;
+        NEW(S);
+        S->socket = sockets[winner];
+        S->type = candidates[winner]->ai_socktype;
+        S->family = candidates[winner]->ai_family == AF_INET ? Socket_Ip4 : Socket_Ip6;
+        S->timeout = timeout;
+        S->host = Str_dup(host);
+        S->port = _getPort(candidates[winner]->ai_addr);
+        S->connection_type = Connection_Client;
+        S->mark = Time_micro();
+        candidates[winner] = NULL;
+        return S;
 }
 
 
-static struct addrinfo *_resolve(const char *hostname, int port, Socket_Type type, Socket_Family family) {
-        ASSERT(hostname);
-        struct addrinfo *result, hints = {
+static bool _getHints(Socket_Type type, Socket_Family family, struct addrinfo *hints) {
+        *hints = (struct addrinfo){
                 .ai_socktype = type,
                 .ai_protocol = type == Socket_Udp ? IPPROTO_UDP : IPPROTO_TCP
         };
         switch (family) {
                 case Socket_Ip:
-                        hints.ai_family = AF_UNSPEC;
+                        hints->ai_family = AF_UNSPEC;
                         break;
                 case Socket_Ip4:
-                        hints.ai_family = AF_INET;
+                        hints->ai_family = AF_INET;
                         break;
 #ifdef HAVE_IPV6
                 case Socket_Ip6:
-                        hints.ai_family = AF_INET6;
+                        hints->ai_family = AF_INET6;
 #ifdef AI_ADDRCONFIG
-                        hints.ai_flags = AI_ADDRCONFIG;
+                        hints->ai_flags = AI_ADDRCONFIG;
 #endif
                         break;
 #endif
                 default:
                         Log_error("Invalid socket family %d\n", family);
-                        return NULL;
+                        return false;
         }
-        char _port[6];
-        snprintf(_port, sizeof(_port), "%d", port);
-        int status = getaddrinfo(hostname, _port, &hints, &result);
-        if (status != 0) {
-                Log_error("Cannot translate '%s' to IP address -- %s\n", hostname, status == EAI_SYSTEM ? STRERROR : gai_strerror(status));
+        return true;
+}
+
+
+static struct addrinfo *_resolve(const char *hostname, int port, Socket_Type type, Socket_Family family) {
+        ASSERT(hostname);
+        struct addrinfo *result, hints;
+        if (! _getHints(type, family, &hints))
                 return NULL;
-        }
+        char error[STRLEN];
+        if (! (result = Resolver_get(hostname, port, &hints, error, sizeof(error))))
+                Log_error("Cannot translate '%s' to IP address -- %s\n", hostname, error);
         return result;
 }
 
@@ -319,11 +484,13 @@ T Socket_create(const char *host, int port, Socket_Type type, Socket_Family fami
         struct addrinfo *result = _resolve(host, port, type, family);
         if (result) {
                 char error[512] = {};
+                int count;
+                struct addrinfo **candidates = _getCandidates(result, 0, &count);
                 // The host may resolve to multiple IPs and if at least one succeeded, we have no problem and don't have to flood the log with partial errors => log only the last error
-                for (struct addrinfo *r = result; r && S == NULL; r = r->ai_next) {
+                while (S == NULL && _hasCandidates(candidates, count)) {
                         TRY
                         {
-                                S = _createIpSocket(host, r->ai_addr, r->ai_addrlen, NULL, 0, r->ai_family, r->ai_socktype, r->ai_protocol, timeout);
+                                S = _createIpSocket(host, candidates, count, NULL, 0, timeout);
                                 if (options->flags == SSL_Enabled)
                                         Socket_enableSsl(S, options, host);
                         }
@@ -336,7 +503,8 @@ T Socket_create(const char *host, int port, Socket_Type type, Socket_Family fami
                         }
                         END_TRY;
                 }
-                freeaddrinfo(result);
+                FREE(candidates);
+                Resolver_free(&result);
                 if (! S)
                         Log_error("Cannot connect to [%s]:%d -- %s\n", host, port, error);
         }
@@ -344,6 +512,13 @@ T Socket_create(const char *host, int port, Socket_Type type, Socket_Family fami
 }
 
 
+void Socket_prefetch(const char *host, Socket_Type type, Socket_Family family) {
+        struct addrinfo hints;
+        if (host && _getHints(type, family, &hints))
+                Resolver_prefetch(host, &hints);
+}
+
+
 T Socket_createUnix(const char *path, Socket_Type type, int timeout) {
         ASSERT(path);
         ASSERT(timeout > 0);
@@ -372,6 +547,7 @@ T Socket_createUnix(const char *path, Socket_Type type, int timeout) {
                                 S->socket = s;
                                 S->timeout = timeout;
                                 S->host = Str_dup(LOCALHOST);
+                                S->mark = Time_micro();
                                 return S;
                         }
                         Log_error("Unix socket %s connection error -- %s\n", path, error);
@@ -549,17 +725,58 @@ const char *Socket_getLocalHost(T S, char *host, int hostlen) {
 }
 
 
+/*
+ * Forget the time of the given connection phase and of all phases which follow
+ */
+static void _resetTiming(Port_T p, Timing_Type from) {
+        for (int i = from; i <= Timing_Last; i++)
+                p->timing[i] = -1.;
+}
+
+
+/*
+ * Sample the kernel's smoothed round trip time and the number of retransmitted
+ * segments of the TCP connection before it's closed or kept for the next cycle.
+ * The kernel counts the retransmits over the lifetime of the connection, so
+ * only the retransmits since the previous sample are reported for a persistent
+ * connection
+ */
+static void _sampleTcpInfo(T S) {
+#if defined LINUX && defined TCP_INFO
+        if (S->Port && S->type == Socket_Tcp && S->family != Socket_Unix) {
+                struct tcp_info info = {};
+                socklen_t length = sizeof(info);
+                if (getsockopt(S->socket, IPPROTO_TCP, TCP_INFO, &info, &length) == 0) {
+                        S->Port->timing[Timing_Rtt] = (double)info.tcpi_rtt / 1000.; // Convert microseconds to milliseconds
+                        S->Port->timing[Timing_Retransmits] = info.tcpi_total_retrans - S->retransmits;
+                        S->retransmits = info.tcpi_total_retrans;
+                } else {
+                        DEBUG("Cannot read TCP information -- %s\n", STRERROR);
+                }
+        }
+#endif
+}
+
+
 static void _testUnix(Port_T p) {
-        T S = Socket_createUnix(p->target.unix.pathname, p->type, p->timeout);
+        long long start = Time_micro();
+        volatile T S = Socket_createUnix(p->target.unix.pathname, p->type, p->timeout);
         if (S) {
+                p->timing[Timing_Connect] = (double)(Time_micro() - start) / 1000.;
                 S->Port = p;
                 TRY
                 {
                         p->protocol->check(S);
+                        if (p->persistent) {
+                                // Keep the connection for the next cycles
+                                p->connection = S;
+                                S = NULL;
+                        }
                 }
                 FINALLY
                 {
-                        Socket_free(&S);
+                        if (S)
+                                Socket_free((T *)&S);
                 }
                 END_TRY;
         } else {
@@ -571,53 +788,65 @@ static void _testUnix(Port_T p) {
 static void _testIp(Port_T p) {
         char error[512];
         volatile Connection_State is_available = Connection_Failed;
+        long long start = Time_micro();
         struct addrinfo *result = _resolve(p->hostname, p->target.net.port, p->type, p->family);
+        p->timing[Timing_Dns] = (double)(Time_micro() - start) / 1000.;
         if (result) {
+                int count;
+                struct addrinfo **candidates = _getCandidates(result, p->outgoing.addrlen, &count);
+                if (count == 0)
+                        snprintf(error, sizeof(error), "No IP address matching '%s' was found", p->outgoing.ip);
                 // The host may resolve to multiple IPs and if at least one succeeded, we have no problem and don't have to flood the log with partial errors => log only the last error
-                for (struct addrinfo *r = result; r && is_available != Connection_Ok; r = r->ai_next) {
-                        if (p->outgoing.addrlen == 0 || p->outgoing.addrlen == r->ai_addrlen) {
-                                volatile T S = NULL;
+                while (is_available != Connection_Ok && _hasCandidates(candidates, count)) {
+                        volatile T S = NULL;
+                        // Report the timing of the last connection attempt
+                        _resetTiming(p, Timing_Connect);
+                        TRY
+                        {
+                                start = Time_micro();
+                                S = _createIpSocket(p->hostname, candidates, count, p->outgoing.addrlen ? (struct sockaddr *)&(p->outgoing.addr) : NULL, p->outgoing.addrlen, p->timeout);
+                                p->timing[Timing_Connect] = (double)(Time_micro() - start) / 1000.;
+                                S->Port = p;
                                 TRY
                                 {
-                                        S = _createIpSocket(p->hostname, r->ai_addr, r->ai_addrlen, p->outgoing.addrlen ? (struct sockaddr *)&(p->outgoing.addr) : NULL, p->outgoing.addrlen, r->ai_family, r->ai_socktype, r->ai_protocol, p->timeout);
-                                        S->Port = p;
-                                        TRY
-                                        {
-                                                if (p->target.net.ssl.options.flags == SSL_Enabled) {
-                                                        Socket_enableSsl(S, &(p->target.net.ssl.options), p->hostname);
-                                                }
-                                                p->protocol->check(S);
+                                        if (p->target.net.ssl.options.flags == SSL_Enabled) {
+                                                Socket_enableSsl(S, &(p->target.net.ssl.options), p->hostname);
                                         }
-                                        FINALLY
-                                        {
-                                                // Set the minimum valid days past the protocol check as if the connection uses STARTTLS to switch plain->SSL, we have no SSL certificate information until the STARTTTLS is performed.
-                                                // Try to collect the certificate validDays even on protocol exception - the protocol test may fail on higher level (e.g. when HTTP returns 400), but we can still get certificate info
-#ifdef HAVE_OPENSSL
-                                                if (S->ssl)
-                                                        p->target.net.ssl.certificate.validDays = Ssl_getCertificateValidDays(S->ssl);
-#endif
-                                        }
-                                        END_TRY;
-                                        is_available = Connection_Ok;
-
-                                }
-                                ELSE
-                                {
-                                        snprintf(error, sizeof(error), "%s", Exception_frame.message);
-                                        DEBUG("Socket test failed for %s -- %s\n", _addressToString(r->ai_addr, r->ai_addrlen, (char[STRLEN]){}, STRLEN), error);
+                                        p->protocol->check(S);
                                 }
                                 FINALLY
                                 {
-                                        if (S) {
-                                                Socket_free((Socket_T *)&S);
-                                        }
+                                        // Set the minimum valid days past the protocol check as if the connection uses STARTTLS to switch plain->SSL, we have no SSL certificate information until the STARTTTLS is performed.
+                                        // Try to collect the certificate validDays even on protocol exception - the protocol test may fail on higher level (e.g. when HTTP returns 400), but we can still get certificate info
+#ifdef HAVE_OPENSSL
+                                        if (S->ssl)
+                                                p->target.net.ssl.certificate.validDays = Ssl_getCertificateValidDays(S->ssl);
+#endif
+                                        _sampleTcpInfo(S);
                                 }
                                 END_TRY;
-                        } else {
-                                snprintf(error, sizeof(error), "No IP address matching '%s' was found", p->outgoing.ip);
+                                is_available = Connection_Ok;
+                                if (p->persistent) {
+                                        // Keep the connection for the next cycles
+                                        p->connection = S;
+                                        S = NULL;
+                                }
+                        }
+                        ELSE
+                        {
+                                snprintf(error, sizeof(error), "%s", Exception_frame.message);
+                                DEBUG("Socket test failed for [%s]:%d -- %s\n", p->hostname, p->target.net.port, error);
+                        }
+                        FINALLY
+                        {
+                                if (S) {
+                                        Socket_free((Socket_T *)&S);
+                                }
                         }
+                        END_TRY;
                 }
-                freeaddrinfo(result);
+                FREE(candidates);
+                Resolver_free(&result);
                 if (is_available != Connection_Ok)
                         THROW(IOException, "%s", error);
         } else {
@@ -626,29 +855,63 @@ static void _testIp(Port_T p) {
 }
 
 
+/*
+ * Run the protocol liveness check on the persistent connection. If the
+ * connection is not usable anymore (for example the server closed the idle
+ * connection), it is dropped and false is returned, so the caller reconnects.
+ */
+static bool _testPersistent(Port_T p) {
+        volatile bool rv = false;
+        TRY
+        {
+                p->connection->mark = Time_micro();
+                p->protocol->ping(p->connection);
+#ifdef HAVE_OPENSSL
+                // The certificate of the kept connection doesn't change, but the number of days until it expires does
+                if (p->connection->ssl)
+                        p->target.net.ssl.certificate.validDays = Ssl_getCertificateValidDays(p->connection->ssl);
+#endif
+                _sampleTcpInfo(p->connection);
+                rv = true;
+        }
+        ELSE
+        {
+                DEBUG("Persistent connection to %s lost -- %s\n", Util_portDescription(p, (char[STRLEN]){}, STRLEN), Exception_frame.message);
+                Socket_free(&(p->connection));
+        }
+        END_TRY;
+        return rv;
+}
+
+
 /* ---------------------------------------------------------------- Public */
 
 
 void Socket_test(void *P) {
         ASSERT(P);
         Port_T p = P;
+        _resetTiming(p, Timing_Dns);
         TRY
         {
                 long long start = Time_micro();
-                switch (p->family) {
-                        case Socket_Unix:
-                                _testUnix(p);
-                                break;
-                        case Socket_Ip:
-                        case Socket_Ip4:
-                        case Socket_Ip6:
-                                _testIp(p);
-                                break;
-                        default:
-                                THROW(IOException, "Invalid socket family %d\n", p->family);
-                                break;
+                // Use the persistent connection if it is alive, otherwise connect and run the full protocol test
+                if (! p->connection || ! _testPersistent(p)) {
+                        switch (p->family) {
+                                case Socket_Unix:
+                                        _testUnix(p);
+                                        break;
+                                case Socket_Ip:
+                                case Socket_Ip4:
+                                case Socket_Ip6:
+                                        _testIp(p);
+                                        break;
+                                default:
+                                        THROW(IOException, "Invalid socket family %d\n", p->family);
+                                        break;
+                        }
                 }
                 p->response = (double)(Time_micro() - start) / 1000.; // Convert microseconds to milliseconds
+                p->timing[Timing_Total] = p->response;
                 p->is_available = Connection_Ok;
         }
         ELSE
@@ -664,8 +927,12 @@ void Socket_test(void *P) {
 void Socket_enableSsl(T S, SslOptions_T options, const char *name)  {
         assert(S);
 #ifdef HAVE_OPENSSL
+        long long start = Time_micro();
         if ((S->ssl = Ssl_new(options)))
                 Ssl_connect(S->ssl, S->socket, S->timeout, name);
+        S->mark = Time_micro();
+        if (S->Port)
+                S->Port->timing[Timing_Tls] = (double)(S->mark - start) / 1000.;
 #endif
 }
 
@@ -689,6 +956,7 @@ int Socket_write(T S, const void *b, size_t size) {
         ssize_t n = 0;
         const void *p = b;
         ASSERT(S);
+        long long start = Time_micro();
         while (size > 0) {
 #ifdef HAVE_OPENSSL
                 if (S->ssl) {
@@ -705,6 +973,13 @@ int Socket_write(T S, const void *b, size_t size) {
                 size -= n;
 
         }
+        if (S->Port) {
+                // The time to first byte is measured from the end of the last request sent before the response
+                long long now = Time_micro();
+                S->Port->timing[Timing_Request] = (S->Port->timing[Timing_Request] < 0 ? 0. : S->Port->timing[Timing_Request]) + (double)(now - start) / 1000.;
+                if (S->Port->timing[Timing_FirstByte] < 0)
+                        S->mark = now;
+        }
         if (n < 0) {
                 /* No write or a partial write is an error */
                 return -1;
@@ -732,6 +1007,39 @@ int Socket_read(T S, void *b, int size) {
 }
 
 
+int Socket_readAvailable(T S, void *b, int size) {
+        ASSERT(S);
+        ASSERT(b);
+        if (S->offset >= S->length)
+                if (_fill(S, S->timeout) <= 0)
+                        return -1;
+        int n = MIN(size, S->length - S->offset);
+        memcpy(b, S->buffer + S->offset, n);
+        S->offset += n;
+        return n;
+}
+
+
+int Socket_discard(T S) {
+        ASSERT(S);
+        int discarded = S->length - S->offset;
+        S->offset = S->length = 0;
+        int n;
+        // Read what the kernel has buffered without waiting, a short read means the receive queue is empty
+        do {
+#ifdef HAVE_OPENSSL
+                if (S->ssl)
+                        n = Ssl_read(S->ssl, S->buffer, RBUFFER_SIZE, 0);
+                else
+#endif
+                        n = (int)Net_read(S->socket, S->buffer, RBUFFER_SIZE, 0);
+                if (n > 0)
+                        discarded += n;
+        } while (n == RBUFFER_SIZE);
+        return discarded;
+}
+
+
 char *Socket_readLine(T S, char *s, int size) {
         int c;
         unsigned char *p = (unsigned char *)s;
@@ -86,6 +86,17 @@ T Socket_new(const char *host, int port, Socket_Type type, Socket_Family family,
 T Socket_create(const char *host, int port, Socket_Type type, Socket_Family family, SslOptions_T options, int timeout);
 
 
+/**
+ * Queue the host name for a background lookup, so a later
+ * Socket_create() with the same type and family finds the
+ * addresses in the resolver cache
+ * @param host The remote host name
+ * @param type The socket type to use
+ * @param family The socket family to use
+ */
+void Socket_prefetch(const char *host, Socket_Type type, Socket_Family family);
+
+
 /**
  * Create a new unix Socket for given path for connect and read.
  * Otherwise, same as socket_new().
@@ -261,6 +272,29 @@ int Socket_readByte(T S);
 int Socket_read(T S, void *b, int size);
 
 
+/**
+ * Reads up to size bytes which are available and stores them into the
+ * byte buffer pointed to by b. If no data is buffered, waits up to the
+ * socket timeout for data, otherwise returns the buffered data without
+ * waiting for more.
+ * @param S A Socket_T object
+ * @param b A Byte buffer
+ * @param size The size of the buffer b
+ * @return The bytes read or -1 if an error occurred, the timeout expired
+ * or the end of the stream has been reached
+ */
+int Socket_readAvailable(T S, void *b, int size);
+
+
+/**
+ * Discards the buffered data and the data already received by the
+ * kernel, without waiting for more.
+ * @param S A Socket_T object
+ * @return The number of bytes discarded
+ */
+int Socket_discard(T S);
+
+
 /**
  * Reads in at most one less than size <code>characters</code> and
  * stores them into the buffer pointed to by s. Reading stops after
@@ -130,6 +130,8 @@
 #include "processor.h"
 #include "md5.h"
 #include "sha1.h"
+#include "sha256.h"
+#include "xxh64.h"
 #include "checksum.h"
 #include "process_sysdep.h"
 
@@ -231,6 +233,8 @@ static void  adddependant(char *);
 static void  addservicegroup(char *);
 static void  addport(Port_T *, Port_T);
 static void  addhttpheader(Port_T, const char *);
+static void  addhttp2stream(Port_T, char *);
+static void  addtiming(Timing_Type, Operator_Type, double);
 static void  addresource(Resource_T);
 static void  addtimestamp(Timestamp_T);
 static void  addactionrate(ActionRate_T);
@@ -247,7 +251,7 @@ static void  addlinksaturation(Service_T, LinkSaturation_T);
 static void  addbandwidth(Bandwidth_T *, Bandwidth_T);
 static void  addfilesystem(FileSystem_T);
 static void  addicmp(Icmp_T);
-static void  addgeneric(Port_T, char*, char*);
+static void  addgeneric(Port_T, char*, char*, bool);
 static void  addcommand(int, unsigned);
 static void  addargument(char *);
 static void  addmmonit(Mmonit_T);
@@ -305,6 +309,7 @@ static int   check_perm(int);
 static void  check_exec(char *);
 static int   cleanup_hash_string(char *);
 static void  check_depend(void);
+static void  shareprobes(void);
 static void  setsyslog(char *);
 static command_t copycommand(command_t);
 static int verifyMaxForward(int);
@@ -316,6 +321,7 @@ static void _setSSLVersion(short version);
 static void _unsetSSLVersion(short version);
 static void addsecurityattribute(char *, Action_Type, Action_Type);
 static void addfiledescriptors(Operator_Type, bool, long long, float, Action_Type, Action_Type);
+static void addlisten(ListenTest_Type, char *, int, Operator_Type, long long, float, Action_Type, Action_Type);
 
 %}
 
@@ -329,16 +335,22 @@ static void addfiledescriptors(Operator_Type, bool, long long, float, Action_Typ
 
 %token IF ELSE THEN FAILED
 %token SET LOGFILE FACILITY DAEMON SYSLOG MAILSERVER HTTPD ALLOW REJECTOPT ADDRESS INIT TERMINAL BATCH
-%token READONLY CLEARTEXT MD5HASH SHA1HASH CRYPT DELAY
+%token READONLY CLEARTEXT MD5HASH SHA1HASH SHA256HASH XXH64HASH CRYPT DELAY
 %token PEMFILE PEMKEY PEMCHAIN ENABLE DISABLE SSLTOKEN CIPHER CLIENTPEMFILE ALLOWSELFCERTIFICATION SELFSIGNED VERIFY CERTIFICATE CACERTIFICATEFILE CACERTIFICATEPATH VALID
 %token INTERFACE LINK PACKET BYTEIN BYTEOUT PACKETIN PACKETOUT SPEED SATURATION UPLOAD DOWNLOAD TOTAL
+%token DROP MISSED FIFO CARRIER MULTICAST COLLISION
+%token TCPRETRANSMITS LISTENOVERFLOWS LISTENDROPS SYNCOOKIES ORPHANS TIMEWAIT UDPRCVBUFERRORS
+%token LISTENING LISTENQUEUE ESTABLISHED
 %token IDFILE STATEFILE SEND EXPECT CYCLE COUNT REMINDER REPEAT
 %token LIMITS SENDEXPECTBUFFER EXPECTBUFFER FILECONTENTBUFFER HTTPCONTENTBUFFER PROGRAMOUTPUT NETWORKTIMEOUT PROGRAMTIMEOUT STARTTIMEOUT STOPTIMEOUT RESTARTTIMEOUT
+%token CHECKSUMWORKERS CHECKSUMIDLEIO FILESYSTEMTIMEOUT DNSTTL DNSNEGATIVETTL
+%token ENTRIES OLDEST
 %token PIDFILE START STOP PATHTOK RSAKEY
 %token HOST HOSTNAME PORT IPV4 IPV6 TYPE UDP TCP TCPSSL PROTOCOL CONNECTION
 %token ALERT NOALERT MAILFORMAT UNIXSOCKET SIGNATURE
-%token TIMEOUT RETRY RESTART CHECKSUM EVERY NOTEVERY
-%token DEFAULT HTTP HTTPS APACHESTATUS FTP SMTP SMTPS POP POPS IMAP IMAPS CLAMAV NNTP NTP3 MYSQL MYSQLS DNS WEBSOCKET MQTT
+%token TIMEOUT RETRY PERSISTENT RESTART CHECKSUM EVERY NOTEVERY
+%token DNSTIME CONNECTTIME TLSHANDSHAKE REQUESTTIME FIRSTBYTE RESPONSETIME RTT RETRANSMITS
+%token DEFAULT HTTP HTTPS APACHESTATUS FTP SMTP SMTPS POP POPS IMAP IMAPS CLAMAV NNTP NTP3 MYSQL MYSQLS DNS WEBSOCKET MQTT HTTP2 HEX
 %token SSH DWP LDAP2 LDAP3 RDATE RSYNC TNS PGSQL POSTFIXPOLICY SIP LMTP GPS RADIUS MEMCACHE REDIS MONGODB SIEVE SPAMASSASSIN FAIL2BAN
 %token <string> STRING PATH MAILADDR MAILFROM MAILREPLYTO MAILSUBJECT
 %token <string> MAILBODY SERVICENAME STRINGNAME
@@ -347,7 +359,9 @@ static void addfiledescriptors(Operator_Type, bool, long long, float, Action_Typ
 %token <number> CLEANUPLIMIT
 %token <real> REAL
 %token CHECKPROC CHECKFILESYS CHECKFILE CHECKDIR CHECKHOST CHECKSYSTEM CHECKFIFO CHECKPROGRAM CHECKNET
+%token CHECKFILESET
 %token THREADS CHILDREN METHOD GET HEAD STATUS ORIGIN VERSIONOPT READ WRITE OPERATION SERVICETIME DISK
+%token LATENCY UTILIZATION QUEUEDEPTH IOPS TIMETOFULL OVER
 %token RESOURCE MEMORY TOTALMEMORY LOADAVG1 LOADAVG5 LOADAVG15 SWAP
 %token MODE ACTIVE PASSIVE MANUAL ONREBOOT NOSTART LASTSTATE
 %token CORE CPU TOTALCPU CPUUSER CPUSYSTEM CPUWAIT CPUNICE CPUHARDIRQ CPUSOFTIRQ CPUSTEAL CPUGUEST CPUGUESTNICE
@@ -408,6 +422,7 @@ statement       : setalert
                 | checkfifo optfifolist
                 | checkprogram optprogramlist
                 | checknet optnetlist
+                | checkfileset optfilesetlist
                 ;
 
 optproclist     : /* EMPTY */
@@ -438,6 +453,7 @@ optproc         : start
                 | group
                 | depend
                 | resourceprocess
+                | listen
                 ;
 
 optfilelist      : /* EMPTY */
@@ -464,6 +480,29 @@ optfile         : start
                 | depend
                 ;
 
+optfilesetlist  : /* EMPTY */
+                | optfilesetlist optfileset
+                ;
+
+optfileset      : start
+                | stop
+                | restart
+                | exist
+                | timestamp
+                | actionrate
+                | every
+                | alert
+                | permission
+                | uid
+                | gid
+                | checksum
+                | size
+                | mode
+                | onreboot
+                | group
+                | depend
+                ;
+
 optfilesyslist  : /* EMPTY */
                 | optfilesyslist optfilesys
                 ;
@@ -487,6 +526,9 @@ optfilesys      : start
                 | read
                 | write
                 | servicetime
+                | utilization
+                | queuedepth
+                | iops
                 | fsflag
                 ;
 
@@ -509,6 +551,7 @@ optdir          : start
                 | onreboot
                 | group
                 | depend
+                | resourcedirectory
                 ;
 
 opthostlist     : /* EMPTY */
@@ -542,6 +585,7 @@ optnet          : start
                 | linksaturation
                 | upload
                 | download
+                | linkcounter
                 | actionrate
                 | every
                 | mode
@@ -568,6 +612,7 @@ optsystem       : start
                 | resourcesystem
                 | uptime
                 | filedescriptorssystem
+                | listen
                 ;
 
 optfifolist     : /* EMPTY */
@@ -715,6 +760,30 @@ limit           : SENDEXPECTBUFFER ':' NUMBER unit {
                 | RESTARTTIMEOUT ':' NUMBER SECOND {
                         Run.limits.restartTimeout = $3 * 1000;
                   }
+                | CHECKSUMWORKERS ':' NUMBER {
+                        if ($3 > 64)
+                                yyerror2("The number of checksum workers must be between 0 and 64");
+                        else
+                                Run.limits.checksumWorkers = $3;
+                  }
+                | CHECKSUMIDLEIO ':' ENABLE {
+                        Run.limits.checksumIdleIO = true;
+                  }
+                | CHECKSUMIDLEIO ':' DISABLE {
+                        Run.limits.checksumIdleIO = false;
+                  }
+                | FILESYSTEMTIMEOUT ':' NUMBER MILLISECOND {
+                        Run.limits.filesystemTimeout = $3;
+                  }
+                | FILESYSTEMTIMEOUT ':' NUMBER SECOND {
+                        Run.limits.filesystemTimeout = $3 * 1000;
+                  }
+                | DNSTTL ':' NUMBER SECOND {
+                        Run.limits.dnsTtl = $3;
+                  }
+                | DNSNEGATIVETTL ':' NUMBER SECOND {
+                        Run.limits.dnsNegativeTtl = $3;
+                  }
                 ;
 
 setfips         : SET FIPS {
@@ -1278,6 +1347,11 @@ checkfile       : CHECKFILE SERVICENAME PATHTOK PATH {
                   }
                 ;
 
+checkfileset    : CHECKFILESET SERVICENAME PATHTOK PATH {
+                        createservice(Service_Fileset, $<string>2, $4, check_fileset);
+                  }
+                ;
+
 checkfilesys    : CHECKFILESYS SERVICENAME PATHTOK PATH {
                         createservice(Service_Filesystem, $<string>2, $4, check_filesystem);
                   }
@@ -1443,6 +1517,8 @@ connectionopt   : ip
                 | connectiontimeout
                 | outgoing
                 | retry
+                | persistent
+                | timing
                 | ssl
                 | sslchecksum
                 | sslexpire
@@ -1462,6 +1538,8 @@ connectionurloptlist : /* EMPTY */
 connectionurlopt : urloption
                  | connectiontimeout
                  | retry
+                 | persistent
+                 | timing
                  | ssl
                  | sslchecksum
                  | sslexpire
@@ -1482,6 +1560,8 @@ connectionuxopt : type
                 | sendexpect
                 | connectiontimeout
                 | retry
+                | persistent
+                | timing
                 ;
 
 icmp            : IF FAILED ICMP icmptype icmpoptlist rate1 THEN action1 recovery {
@@ -1595,6 +1675,10 @@ protocol        : PROTOCOL APACHESTATUS apache_stat_list {
                         portset.type = Socket_Tcp;
                         portset.protocol = Protocol_get(Protocol_HTTP);
                  }
+                | PROTOCOL HTTP2 http2list {
+                        portset.type = Socket_Tcp;
+                        portset.protocol = Protocol_get(Protocol_HTTP2);
+                  }
                 | PROTOCOL IMAP {
                         portset.protocol = Protocol_get(Protocol_IMAP);
                   }
@@ -1698,7 +1782,7 @@ protocol        : PROTOCOL APACHESTATUS apache_stat_list {
 sendexpect      : SEND STRING {
                         if (portset.protocol->check == check_default || portset.protocol->check == check_generic) {
                                 portset.protocol = Protocol_get(Protocol_GENERIC);
-                                addgeneric(&portset, $2, NULL);
+                                addgeneric(&portset, $2, NULL, false);
                         } else {
                                 yyerror("The SEND statement is not allowed in the %s protocol context", portset.protocol->name);
                         }
@@ -1706,7 +1790,15 @@ sendexpect      : SEND STRING {
                 | EXPECT STRING {
                         if (portset.protocol->check == check_default || portset.protocol->check == check_generic) {
                                 portset.protocol = Protocol_get(Protocol_GENERIC);
-                                addgeneric(&portset, NULL, $2);
+                                addgeneric(&portset, NULL, $2, false);
+                        } else {
+                                yyerror("The EXPECT statement is not allowed in the %s protocol context", portset.protocol->name);
+                        }
+                  }
+                | EXPECT HEX STRING {
+                        if (portset.protocol->check == check_default || portset.protocol->check == check_generic) {
+                                portset.protocol = Protocol_get(Protocol_GENERIC);
+                                addgeneric(&portset, NULL, $3, true);
                         } else {
                                 yyerror("The EXPECT statement is not allowed in the %s protocol context", portset.protocol->name);
                         }
@@ -1836,6 +1928,28 @@ http            : username {
                 | '[' httpheaderlist ']'
                 ;
 
+http2list       : /* EMPTY */
+                | http2list http2
+                ;
+
+http2           : username {
+                        portset.parameters.http.username = $<string>1;
+                  }
+                | password {
+                        portset.parameters.http.password = $<string>1;
+                  }
+                | REQUEST PATH {
+                        addhttp2stream(&portset, $2);
+                  }
+                | REQUEST STRING {
+                        addhttp2stream(&portset, $2);
+                  }
+                | status
+                | method
+                | hostheader
+                | '[' httpheaderlist ']'
+                ;
+
 status          : STATUS operator NUMBER {
                         if ($<number>3 < 0) {
                                 yyerror2("The status value must be greater or equal to 0");
@@ -2056,6 +2170,31 @@ retry           : RETRY NUMBER {
                   }
                 ;
 
+persistent      : PERSISTENT {
+                        portset.persistent = true;
+                  }
+                ;
+
+timing          : timingphase operator NUMBER MILLISECOND {
+                        addtiming($<number>1, $<number>2, $<number>3);
+                  }
+                | timingphase operator value SECOND {
+                        addtiming($<number>1, $<number>2, $<real>3 * 1000.);
+                  }
+                | RETRANSMITS operator NUMBER {
+                        addtiming(Timing_Retransmits, $<number>2, $<number>3);
+                  }
+                ;
+
+timingphase     : DNSTIME      { $<number>$ = Timing_Dns; }
+                | CONNECTTIME  { $<number>$ = Timing_Connect; }
+                | TLSHANDSHAKE { $<number>$ = Timing_Tls; }
+                | REQUESTTIME  { $<number>$ = Timing_Request; }
+                | FIRSTBYTE    { $<number>$ = Timing_FirstByte; }
+                | RESPONSETIME { $<number>$ = Timing_Total; }
+                | RTT          { $<number>$ = Timing_Rtt; }
+                ;
+
 actionrate      : IF NUMBER RESTART NUMBER CYCLE THEN action1 {
                         actionrateset.count = $2;
                         actionrateset.cycle = $4;
@@ -2256,8 +2395,32 @@ resourcesystemopt  : resourceload
                    | resourcemem
                    | resourceswap
                    | resourcecpu
+                   | resourcenetstack
                    ;
 
+resourcedirectory : IF resourcedirectoryopt rate1 THEN action1 recovery {
+                        addeventaction(&(resourceset).action, $<number>5, $<number>6);
+                        addresource(&resourceset);
+                   }
+                ;
+
+resourcedirectoryopt : ENTRIES operator NUMBER {
+                        resourceset.resource_id = Resource_DirectoryEntries;
+                        resourceset.operator = $<number>2;
+                        resourceset.limit = $3;
+                     }
+                     | TOTAL SIZE operator NUMBER unit {
+                        resourceset.resource_id = Resource_DirectorySize;
+                        resourceset.operator = $<number>3;
+                        resourceset.limit = (double)$4 * $<number>5;
+                     }
+                     | OLDEST operator NUMBER time {
+                        resourceset.resource_id = Resource_DirectoryOldest;
+                        resourceset.operator = $<number>2;
+                        resourceset.limit = (double)$3 * $<number>4;
+                     }
+                     ;
+
 resourcecpuproc : CPU operator value PERCENT {
                         resourceset.resource_id = Resource_CpuPercent;
                         resourceset.operator = $<number>2;
@@ -2382,6 +2545,48 @@ resourceswap    : SWAP operator value unit {
                   }
                 ;
 
+resourcenetstack : TCPRETRANSMITS operator NUMBER currenttime {
+                        resourceset.resource_id = Resource_TcpRetransmits;
+                        resourceset.operator = $<number>2;
+                        resourceset.limit = $3;
+                  }
+                | TCPRETRANSMITS operator value PERCENT {
+                        resourceset.resource_id = Resource_TcpRetransmitsPercent;
+                        resourceset.operator = $<number>2;
+                        resourceset.limit = $<real>3;
+                  }
+                | LISTENOVERFLOWS operator NUMBER currenttime {
+                        resourceset.resource_id = Resource_TcpListenOverflows;
+                        resourceset.operator = $<number>2;
+                        resourceset.limit = $3;
+                  }
+                | LISTENDROPS operator NUMBER currenttime {
+                        resourceset.resource_id = Resource_TcpListenDrops;
+                        resourceset.operator = $<number>2;
+                        resourceset.limit = $3;
+                  }
+                | SYNCOOKIES operator NUMBER currenttime {
+                        resourceset.resource_id = Resource_TcpSynCookies;
+                        resourceset.operator = $<number>2;
+                        resourceset.limit = $3;
+                  }
+                | UDPRCVBUFERRORS operator NUMBER currenttime {
+                        resourceset.resource_id = Resource_UdpReceiveBufferErrors;
+                        resourceset.operator = $<number>2;
+                        resourceset.limit = $3;
+                  }
+                | ORPHANS operator NUMBER {
+                        resourceset.resource_id = Resource_TcpOrphans;
+                        resourceset.operator = $<number>2;
+                        resourceset.limit = $3;
+                  }
+                | TIMEWAIT operator NUMBER {
+                        resourceset.resource_id = Resource_TcpTimeWait;
+                        resourceset.operator = $<number>2;
+                        resourceset.limit = $3;
+                  }
+                ;
+
 resourcethreads : THREADS operator NUMBER {
                         resourceset.resource_id = Resource_Threads;
                         resourceset.operator = $<number>2;
@@ -2652,6 +2857,8 @@ checksum        : IF FAILED hashtype CHECKSUM rate1 THEN action1 recovery {
 hashtype        : /* EMPTY */ { checksumset.type = Hash_Unknown; }
                 | MD5HASH     { checksumset.type = Hash_Md5; }
                 | SHA1HASH    { checksumset.type = Hash_Sha1; }
+                | SHA256HASH  { checksumset.type = Hash_Sha256; }
+                | XXH64HASH   { checksumset.type = Hash_Xxh64; }
                 ;
 
 inode           : IF INODE operator NUMBER rate1 THEN action1 recovery {
@@ -2682,9 +2889,25 @@ inode           : IF INODE operator NUMBER rate1 THEN action1 recovery {
                         addeventaction(&(filesystemset).action, $<number>9, $<number>10);
                         addfilesystem(&filesystemset);
                   }
+                | IF INODE TIMETOFULL operator NUMBER time timetofullwindow rate1 THEN action1 recovery {
+                        filesystemset.resource = Resource_InodeTimeToFull;
+                        filesystemset.operator = $<number>4;
+                        filesystemset.limit_absolute = $5 * $<number>6;
+                        filesystemset.window = $<number>7 ? $<number>7 : filesystemset.limit_absolute;
+                        addeventaction(&(filesystemset).action, $<number>10, $<number>11);
+                        addfilesystem(&filesystemset);
+                  }
                 ;
 
-space           : IF SPACE operator value unit rate1 THEN action1 recovery {
+space           : IF SPACE TIMETOFULL operator NUMBER time timetofullwindow rate1 THEN action1 recovery {
+                        filesystemset.resource = Resource_SpaceTimeToFull;
+                        filesystemset.operator = $<number>4;
+                        filesystemset.limit_absolute = $5 * $<number>6;
+                        filesystemset.window = $<number>7 ? $<number>7 : filesystemset.limit_absolute;
+                        addeventaction(&(filesystemset).action, $<number>10, $<number>11);
+                        addfilesystem(&filesystemset);
+                  }
+                | IF SPACE operator value unit rate1 THEN action1 recovery {
                         filesystemset.resource = Resource_Space;
                         filesystemset.operator = $<number>3;
                         filesystemset.limit_absolute = $<real>4 * $<number>5;
@@ -2728,6 +2951,20 @@ read            : IF READ operator value unit currenttime rate1 THEN action1 rec
                         addeventaction(&(filesystemset).action, $<number>8, $<number>9);
                         addfilesystem(&filesystemset);
                   }
+                | IF READ LATENCY operator NUMBER MILLISECOND rate1 THEN action1 recovery {
+                        filesystemset.resource = Resource_ReadLatency;
+                        filesystemset.operator = $<number>4;
+                        filesystemset.limit_absolute = $<number>5;
+                        addeventaction(&(filesystemset).action, $<number>9, $<number>10);
+                        addfilesystem(&filesystemset);
+                  }
+                | IF READ LATENCY operator value SECOND rate1 THEN action1 recovery {
+                        filesystemset.resource = Resource_ReadLatency;
+                        filesystemset.operator = $<number>4;
+                        filesystemset.limit_absolute = $<real>5 * 1000;
+                        addeventaction(&(filesystemset).action, $<number>9, $<number>10);
+                        addfilesystem(&filesystemset);
+                  }
                 ;
 
 write           : IF WRITE operator value unit currenttime rate1 THEN action1 recovery {
@@ -2744,6 +2981,20 @@ write           : IF WRITE operator value unit currenttime rate1 THEN action1 re
                         addeventaction(&(filesystemset).action, $<number>8, $<number>9);
                         addfilesystem(&filesystemset);
                   }
+                | IF WRITE LATENCY operator NUMBER MILLISECOND rate1 THEN action1 recovery {
+                        filesystemset.resource = Resource_WriteLatency;
+                        filesystemset.operator = $<number>4;
+                        filesystemset.limit_absolute = $<number>5;
+                        addeventaction(&(filesystemset).action, $<number>9, $<number>10);
+                        addfilesystem(&filesystemset);
+                  }
+                | IF WRITE LATENCY operator value SECOND rate1 THEN action1 recovery {
+                        filesystemset.resource = Resource_WriteLatency;
+                        filesystemset.operator = $<number>4;
+                        filesystemset.limit_absolute = $<real>5 * 1000;
+                        addeventaction(&(filesystemset).action, $<number>9, $<number>10);
+                        addfilesystem(&filesystemset);
+                  }
                 ;
 
 servicetime     : IF SERVICETIME operator NUMBER MILLISECOND rate1 THEN action1 recovery {
@@ -2762,6 +3013,41 @@ servicetime     : IF SERVICETIME operator NUMBER MILLISECOND rate1 THEN action1
                   }
                 ;
 
+timetofullwindow: /* EMPTY */ { $<number>$ = 0; }
+                | OVER NUMBER time {
+                        if ($2 <= 0)
+                                yyerror2("The time-to-full window must be greater than 0");
+                        $<number>$ = $2 * $<number>3;
+                  }
+                ;
+
+utilization     : IF UTILIZATION operator value PERCENT rate1 THEN action1 recovery {
+                        filesystemset.resource = Resource_Utilization;
+                        filesystemset.operator = $<number>3;
+                        filesystemset.limit_percent = $<real>4;
+                        addeventaction(&(filesystemset).action, $<number>8, $<number>9);
+                        addfilesystem(&filesystemset);
+                  }
+                ;
+
+queuedepth      : IF QUEUEDEPTH operator value rate1 THEN action1 recovery {
+                        filesystemset.resource = Resource_QueueDepth;
+                        filesystemset.operator = $<number>3;
+                        filesystemset.limit_percent = $<real>4;
+                        addeventaction(&(filesystemset).action, $<number>7, $<number>8);
+                        addfilesystem(&filesystemset);
+                  }
+                ;
+
+iops            : IF IOPS operator NUMBER rate1 THEN action1 recovery {
+                        filesystemset.resource = Resource_Iops;
+                        filesystemset.operator = $<number>3;
+                        filesystemset.limit_absolute = $<number>4;
+                        addeventaction(&(filesystemset).action, $<number>7, $<number>8);
+                        addfilesystem(&filesystemset);
+                  }
+                ;
+
 fsflag          : IF CHANGED FSFLAG rate1 THEN action1 {
                         addeventaction(&(fsflagset).action, $<number>6, Action_Ignored);
                         addfsflag(&fsflagset);
@@ -2916,6 +3202,28 @@ filedescriptorssystem : IF FILEDESCRIPTORS operator NUMBER rate1 THEN action1 re
                   }
                 ;
 
+listen          : IF NOT LISTENING listenaddress PORT NUMBER rate1 THEN action1 recovery {
+                        addlisten(ListenTest_Exist, $<string>4, $6, Operator_Equal, -1LL, -1., $<number>9, $<number>10);
+                  }
+                | IF LISTENQUEUE listenaddress PORT NUMBER operator NUMBER rate1 THEN action1 recovery {
+                        addlisten(ListenTest_Queue, $<string>3, $5, $<number>6, (long long)$7, -1., $<number>10, $<number>11);
+                  }
+                | IF LISTENQUEUE listenaddress PORT NUMBER operator value PERCENT rate1 THEN action1 recovery {
+                        addlisten(ListenTest_Queue, $<string>3, $5, $<number>6, -1LL, $<real>7, $<number>11, $<number>12);
+                  }
+                | IF ESTABLISHED listenaddress PORT NUMBER operator NUMBER rate1 THEN action1 recovery {
+                        addlisten(ListenTest_Established, $<string>3, $5, $<number>6, (long long)$7, -1., $<number>10, $<number>11);
+                  }
+                ;
+
+listenaddress   : /* EMPTY */ {
+                        $<string>$ = NULL;
+                  }
+                | ADDRESS STRING {
+                        $<string>$ = $2;
+                  }
+                ;
+
 filedescriptorsprocess : IF FILEDESCRIPTORS operator NUMBER rate1 THEN action1 recovery {
                         if (systeminfo.statisticsAvailable & Statistics_FiledescriptorsPerProcess)
                                 addfiledescriptors($<number>3, false, (long long)$4, -1., $<number>7, $<number>8);
@@ -3070,6 +3378,46 @@ download        : IF DOWNLOAD operator NUMBER unit currenttime rate1 THEN action
                   }
                 ;
 
+linkcounter     : IF linkcountertype operator NUMBER currenttime rate1 THEN action1 recovery {
+                        bandwidthset.counter = $<number>2;
+                        bandwidthset.operator = $<number>3;
+                        bandwidthset.limit = (unsigned long long)$4;
+                        bandwidthset.rangecount = 1;
+                        bandwidthset.range = $<number>5;
+                        addeventaction(&(bandwidthset).action, $<number>8, $<number>9);
+                        addbandwidth(&(current->linkcounterlist), &bandwidthset);
+                  }
+                | IF TOTAL linkcountertype operator NUMBER totaltime rate1 THEN action1 recovery {
+                        bandwidthset.counter = $<number>3;
+                        bandwidthset.operator = $<number>4;
+                        bandwidthset.limit = (unsigned long long)$5;
+                        bandwidthset.rangecount = 1;
+                        bandwidthset.range = $<number>6;
+                        addeventaction(&(bandwidthset).action, $<number>9, $<number>10);
+                        addbandwidth(&(current->linkcounterlist), &bandwidthset);
+                  }
+                | IF TOTAL linkcountertype operator NUMBER NUMBER totaltime rate1 THEN action1 recovery {
+                        bandwidthset.counter = $<number>3;
+                        bandwidthset.operator = $<number>4;
+                        bandwidthset.limit = (unsigned long long)$5;
+                        bandwidthset.rangecount = $6;
+                        bandwidthset.range = $<number>7;
+                        addeventaction(&(bandwidthset).action, $<number>10, $<number>11);
+                        addbandwidth(&(current->linkcounterlist), &bandwidthset);
+                  }
+                ;
+
+linkcountertype : DOWNLOAD DROP       { $<number>$ = LinkCounter_DropsIn; }
+                | UPLOAD DROP         { $<number>$ = LinkCounter_DropsOut; }
+                | DOWNLOAD MISSED     { $<number>$ = LinkCounter_MissedIn; }
+                | DOWNLOAD FIFO       { $<number>$ = LinkCounter_FifoIn; }
+                | UPLOAD FIFO         { $<number>$ = LinkCounter_FifoOut; }
+                | UPLOAD CARRIER      { $<number>$ = LinkCounter_CarrierOut; }
+                | MULTICAST           { $<number>$ = LinkCounter_MulticastIn; }
+                | DOWNLOAD MULTICAST  { $<number>$ = LinkCounter_MulticastIn; }
+                | COLLISION           { $<number>$ = LinkCounter_Collisions; }
+                ;
+
 icmptype        : TYPE ICMPECHO { $<number>$ = ICMP_ECHO; }
                 ;
 
@@ -3219,6 +3567,11 @@ static void preparse() {
         Run.limits.stopTimeout       = LIMIT_STOPTIMEOUT;
         Run.limits.startTimeout      = LIMIT_STARTTIMEOUT;
         Run.limits.restartTimeout    = LIMIT_RESTARTTIMEOUT;
+        Run.limits.checksumWorkers   = LIMIT_CHECKSUMWORKERS;
+        Run.limits.checksumIdleIO    = false;
+        Run.limits.filesystemTimeout = LIMIT_FILESYSTEMTIMEOUT;
+        Run.limits.dnsTtl            = LIMIT_DNSTTL;
+        Run.limits.dnsNegativeTtl    = LIMIT_DNSNEGATIVETTL;
         Run.onreboot                 = Onreboot_Start;
         Run.mmonitcredentials        = NULL;
         Run.httpd.flags              = Httpd_Disabled | Httpd_Signature;
@@ -3331,6 +3684,9 @@ static void postparse() {
         /* Check the sanity of any dependency graph */
         check_depend();
 
+        /* Probe identical connection tests once per cycle */
+        shareprobes();
+
 #if defined HAVE_OPENSSL && defined OPENSSL_FIPS
         Ssl_setFipsMode(Run.flags & Run_FipsEnabled);
 #endif
@@ -3379,6 +3735,9 @@ static Service_T createservice(Service_Type type, char *name, char *value, State
                 case Service_File:
                         NEW(current->inf.file);
                         break;
+                case Service_Fileset:
+                        NEW(current->inf.fileset);
+                        break;
                 case Service_Filesystem:
                         NEW(current->inf.filesystem);
                         break;
@@ -3489,6 +3848,7 @@ static void addservice(Service_T s) {
                 case Service_Directory:
                 case Service_Fifo:
                 case Service_File:
+                case Service_Fileset:
                 case Service_Process:
                         if (! s->nonexistlist && ! s->existlist) {
                                 // Add existence test if not defined
@@ -3591,6 +3951,22 @@ static void addport(Port_T *list, Port_T port) {
 
         if (port->protocol->check == check_radius && port->type != Socket_Udp)
                 yyerror("Radius protocol test supports UDP only");
+        if (port->persistent) {
+                if (! port->protocol->ping)
+                        yyerror2("Persistent connection is not supported by the %s protocol test", port->protocol->name);
+                else if (port->type != Socket_Tcp)
+                        yyerror("Persistent connection requires TCP");
+                else if (port->protocol->check == check_mysql && ! port->parameters.mysql.username)
+                        yyerror("Persistent MySQL connection requires credentials, the server closes connections which didn't log in");
+        }
+        for (TimingLimit_T t = port->timinglist; t; t = t->next) {
+                if (port->family == Socket_Unix && (t->type == Timing_Dns || t->type == Timing_Tls || t->type == Timing_Rtt || t->type == Timing_Retransmits))
+                        yyerror2("The %s test is not supported for unix sockets", timingnames[t->type]);
+                else if (t->type == Timing_Tls && ! sslset.flags)
+                        yyerror2("The %s test requires TLS", timingnames[t->type]);
+                else if ((t->type == Timing_Rtt || t->type == Timing_Retransmits) && port->type != Socket_Tcp)
+                        yyerror2("The %s test requires TCP", timingnames[t->type]);
+        }
 
         Port_T p;
         NEW(p);
@@ -3601,10 +3977,14 @@ static void addport(Port_T *list, Port_T port) {
         p->action             = port->action;
         p->timeout            = port->timeout;
         p->retry              = port->retry;
+        p->persistent         = port->persistent;
+        p->timinglist         = port->timinglist;
         p->protocol           = port->protocol;
         p->hostname           = port->hostname;
         p->url_request        = port->url_request;
         p->outgoing           = port->outgoing;
+        for (int i = 0; i <= Timing_Last; i++)
+                p->timing[i] = -1.;
         if (p->family == Socket_Unix) {
                 p->target.unix.pathname = port->target.unix.pathname;
         } else {
@@ -3615,6 +3995,9 @@ static void addport(Port_T *list, Port_T port) {
                         if (sslset.flags && (p->target.net.port == 25 || p->target.net.port == 143 || p->target.net.port == 587))
                                 sslset.flags = SSL_StartTLS;
                         _setSSLOptions(&(p->target.net.ssl.options));
+                        // HTTP/2 over TLS is negotiated using the ALPN extension
+                        if (p->protocol->check == check_http2)
+                                p->target.net.ssl.options.alpn = "h2";
 #else
                         yyerror("SSL check cannot be activated -- Monit was not built with SSL support");
 #endif
@@ -3629,6 +4012,10 @@ static void addport(Port_T *list, Port_T port) {
                                 p->parameters.http.hashtype = Hash_Md5;
                         else if (strlen(p->parameters.http.checksum) == 40)
                                 p->parameters.http.hashtype = Hash_Sha1;
+                        else if (strlen(p->parameters.http.checksum) == 64)
+                                p->parameters.http.hashtype = Hash_Sha256;
+                        else if (strlen(p->parameters.http.checksum) == 16)
+                                p->parameters.http.hashtype = Hash_Xxh64;
                         else
                                 yyerror2("invalid checksum [%s]", p->parameters.http.checksum);
                 } else {
@@ -3642,6 +4029,12 @@ static void addport(Port_T *list, Port_T port) {
                                 yyerror2("if response content or checksum test is enabled, the HEAD method is not allowed");
                         }
                 }
+        } else if (p->protocol->check == check_http2) {
+                if (! p->parameters.http.method)
+                        p->parameters.http.method = Http_Get;
+                // Test the root document if no request is defined
+                if (! p->parameters.http.streams)
+                        addhttp2stream(p, Str_dup("/"));
         } else if (p->protocol->check == check_mysql) {
                 if (p->parameters.mysql.rsaChecksum) {
                         if (! p->parameters.mysql.username)
@@ -3660,6 +4053,23 @@ static void addport(Port_T *list, Port_T port) {
 }
 
 
+/*
+ * Add a connection phase timing limit to the current port
+ */
+static void addtiming(Timing_Type type, Operator_Type operator, double limit) {
+        TimingLimit_T t;
+        NEW(t);
+        t->type = type;
+        t->operator = operator;
+        t->limit = limit;
+        // Append the limit, so the rules are reported in the configured order
+        TimingLimit_T *last = &(portset.timinglist);
+        while (*last)
+                last = &((*last)->next);
+        *last = t;
+}
+
+
 static void addhttpheader(Port_T port, const char *header) {
         if (! port->parameters.http.headers) {
                 port->parameters.http.headers = List_new();
@@ -3671,12 +4081,30 @@ static void addhttpheader(Port_T port, const char *header) {
 }
 
 
+/*
+ * Append the HTTP/2 request stream to the current port
+ */
+static void addhttp2stream(Port_T port, char *request) {
+        Http2Stream_T s;
+        NEW(s);
+        s->request = Util_urlEncode(request, false);
+        s->status = -1;
+        s->response = -1.;
+        FREE(request);
+        // Append the stream, so the requests are sent in the configured order
+        Http2Stream_T *last = &port->parameters.http.streams;
+        while (*last)
+                last = &(*last)->next;
+        *last = s;
+}
+
+
 /*
  * Add a new resource object to the current service resource list
  */
 static void addresource(Resource_T rr) {
         ASSERT(rr);
-        if (Run.flags & Run_ProcessEngineEnabled) {
+        if (Run.flags & Run_ProcessEngineEnabled || current->type == Service_Directory) {
                 Resource_T r;
                 NEW(r);
                 r->resource_id = rr->resource_id;
@@ -3877,9 +4305,12 @@ static void addchecksum(Checksum_T cs) {
         if (STR_UNDEF(cs->hash)) {
                 if (cs->type == Hash_Unknown)
                         cs->type = Hash_Default;
-                if (! (Checksum_getChecksum(current->path, cs->type, cs->hash, sizeof(cs->hash)))) {
+                if (current->type == Service_Fileset) {
+                        /* Each file of the set takes its first checksum as the reference value */
+                        cs->initialized = false;
+                } else if (! (Checksum_getChecksum(current->path, cs->type, cs->hash, sizeof(cs->hash)))) {
                         /* If the file doesn't exist, set dummy value */
-                        snprintf(cs->hash, sizeof(cs->hash), cs->type == Hash_Md5 ? "00000000000000000000000000000000" : "0000000000000000000000000000000000000000");
+                        snprintf(cs->hash, sizeof(cs->hash), "%0*d", Checksum_length(cs->type) * 2, 0);
                         cs->initialized = false;
                         yywarning2("Cannot compute a checksum for file %s", current->path);
                 }
@@ -3891,12 +4322,16 @@ static void addchecksum(Checksum_T cs) {
                         cs->type = Hash_Md5;
                 } else if (len == 40) {
                         cs->type = Hash_Sha1;
+                } else if (len == 64) {
+                        cs->type = Hash_Sha256;
+                } else if (len == 16) {
+                        cs->type = Hash_Xxh64;
                 } else {
                         yyerror2("Unknown checksum type [%s] for file %s", cs->hash, current->path);
                         reset_checksumset();
                         return;
                 }
-        } else if ((cs->type == Hash_Md5 && len != 32) || (cs->type == Hash_Sha1 && len != 40)) {
+        } else if (len != Checksum_length(cs->type) * 2 && ! (len == 0 && current->type == Service_Fileset)) {
                 yyerror2("Invalid checksum [%s] for file %s", cs->hash, current->path);
                 reset_checksumset();
                 return;
@@ -4013,6 +4448,7 @@ static void addbandwidth(Bandwidth_T *list, Bandwidth_T b) {
                 bandwidth->limit = b->limit;
                 bandwidth->rangecount = b->rangecount;
                 bandwidth->range = b->range;
+                bandwidth->counter = b->counter;
                 bandwidth->action = b->action;
                 bandwidth->next = *list;
                 *list = bandwidth;
@@ -4172,6 +4608,7 @@ static void addfilesystem(FileSystem_T ds) {
         dev->operator           = ds->operator;
         dev->limit_absolute     = ds->limit_absolute;
         dev->limit_percent      = ds->limit_percent;
+        dev->window             = ds->window;
         dev->action             = ds->action;
 
         dev->next               = current->filesystemlist;
@@ -4200,6 +4637,8 @@ static void addicmp(Icmp_T is) {
         icmp->outgoing     = is->outgoing;
         icmp->is_available = Connection_Init;
         icmp->response     = -1;
+        icmp->jitter       = -1;
+        icmp->loss         = -1;
 
         icmp->next         = current->icmplist;
         current->icmplist  = icmp;
@@ -4250,7 +4689,7 @@ static void addeventaction(EventAction_T *_ea, Action_Type failed, Action_Type s
 /*
  * Add a generic protocol handler to
  */
-static void addgeneric(Port_T port, char *send, char *expect) {
+static void addgeneric(Port_T port, char *send, char *expect, bool hex) {
         Generic_T g = port->parameters.generic.sendexpect;
         if (! g) {
                 NEW(g);
@@ -4264,6 +4703,28 @@ static void addgeneric(Port_T port, char *send, char *expect) {
         if (send) {
                 g->send = send;
                 g->expect = NULL;
+        } else if (expect && hex) {
+                // Hex digits, optionally separated by whitespace, for example "0d 0a"
+                g->bytes = CALLOC(1, strlen(expect) / 2 + 1);
+                int digits = 0;
+                char *c = expect;
+                for (; *c; c++) {
+                        if (isspace((unsigned char)*c))
+                                continue;
+                        if (! isxdigit((unsigned char)*c)) {
+                                yyerror2("Invalid hex digit '%c' in the expected data", *c);
+                                break;
+                        }
+                        int value = isdigit((unsigned char)*c) ? *c - '0' : tolower((unsigned char)*c) - 'a' + 10;
+                        if (digits++ % 2)
+                                g->bytes[g->length++] |= value;
+                        else
+                                g->bytes[g->length] = value << 4;
+                }
+                if (! *c && (digits == 0 || digits % 2))
+                        yyerror2("The expected hex data must have an even number of digits");
+                FREE(expect);
+                g->send = NULL;
         } else if (expect) {
                 int reg_return;
                 NEW(g->expect);
@@ -4960,6 +5421,7 @@ static void reset_filesystemset() {
         filesystemset.operator = Operator_Equal;
         filesystemset.limit_absolute = -1;
         filesystemset.limit_percent = -1.;
+        filesystemset.window = 0;
         filesystemset.action = NULL;
 }
 
@@ -5020,6 +5482,128 @@ static int check_perm(int perm) {
 }
 
 
+static bool _isSameSSL(SslOptions_T a, SslOptions_T b) {
+        return a->flags == b->flags &&
+               a->version == b->version &&
+               a->verify == b->verify &&
+               a->allowSelfSigned == b->allowSelfSigned &&
+               a->checksumType == b->checksumType &&
+               IS(NVLSTR(a->checksum), NVLSTR(b->checksum)) &&
+               IS(NVLSTR(a->clientpemfile), NVLSTR(b->clientpemfile)) &&
+               IS(NVLSTR(a->ciphers), NVLSTR(b->ciphers)) &&
+               IS(NVLSTR(a->CACertificateFile), NVLSTR(b->CACertificateFile)) &&
+               IS(NVLSTR(a->CACertificatePath), NVLSTR(b->CACertificatePath));
+}
+
+
+static bool _isSameList(List_T a, List_T b) {
+        if (! a || ! b)
+                return a == b;
+        if (List_length(a) != List_length(b))
+                return false;
+        for (list_t x = a->head, y = b->head; x && y; x = x->next, y = y->next)
+                if (! IS(x->e, y->e))
+                        return false;
+        return true;
+}
+
+
+/*
+ * Return true if the port tests are identical, so one probe result can be
+ * used for both. Tests with response expectations given as regular
+ * expressions (content and send/expect tests) are never considered identical,
+ * as the compiled expressions cannot be compared. HTTP/2 tests keep the result
+ * of each stream in the port, so they are not shared either.
+ */
+static bool _isSameProbe(Port_T a, Port_T b) {
+        if (a->family != b->family || a->type != b->type || a->protocol != b->protocol || a->timeout != b->timeout || a->retry != b->retry || a->persistent != b->persistent)
+                return false;
+        if ((a->url_request && a->url_request->regex) || (b->url_request && b->url_request->regex))
+                return false;
+        if (a->url_request || b->url_request) {
+                if (! a->url_request || ! b->url_request || ! a->url_request->url || ! b->url_request->url || ! IS(a->url_request->url->url, b->url_request->url->url))
+                        return false;
+        }
+        if (a->family == Socket_Unix) {
+                if (! IS(a->target.unix.pathname, b->target.unix.pathname))
+                        return false;
+        } else {
+                if (! IS(a->hostname, b->hostname) || a->target.net.port != b->target.net.port || ! IS(NVLSTR(a->outgoing.ip), NVLSTR(b->outgoing.ip)))
+                        return false;
+                if (! _isSameSSL(&(a->target.net.ssl.options), &(b->target.net.ssl.options)))
+                        return false;
+        }
+        if (a->protocol->check == check_http) {
+                return a->parameters.http.method == b->parameters.http.method &&
+                       a->parameters.http.hasStatus == b->parameters.http.hasStatus &&
+                       a->parameters.http.operator == b->parameters.http.operator &&
+                       a->parameters.http.status == b->parameters.http.status &&
+                       IS(NVLSTR(a->parameters.http.username), NVLSTR(b->parameters.http.username)) &&
+                       IS(NVLSTR(a->parameters.http.password), NVLSTR(b->parameters.http.password)) &&
+                       IS(NVLSTR(a->parameters.http.request), NVLSTR(b->parameters.http.request)) &&
+                       IS(NVLSTR(a->parameters.http.checksum), NVLSTR(b->parameters.http.checksum)) &&
+                       a->parameters.http.hashtype == b->parameters.http.hashtype &&
+                       _isSameList(a->parameters.http.headers, b->parameters.http.headers);
+        } else if (a->protocol->check == check_generic || a->protocol->check == check_apache_status || a->protocol->check == check_http2) {
+                return false;
+        } else if (a->protocol->check == check_mqtt) {
+                return IS(NVLSTR(a->parameters.mqtt.username), NVLSTR(b->parameters.mqtt.username)) &&
+                       IS(NVLSTR(a->parameters.mqtt.password), NVLSTR(b->parameters.mqtt.password));
+        } else if (a->protocol->check == check_mysql) {
+                return IS(NVLSTR(a->parameters.mysql.username), NVLSTR(b->parameters.mysql.username)) &&
+                       IS(NVLSTR(a->parameters.mysql.password), NVLSTR(b->parameters.mysql.password)) &&
+                       IS(NVLSTR(a->parameters.mysql.rsaChecksum), NVLSTR(b->parameters.mysql.rsaChecksum));
+        } else if (a->protocol->check == check_radius) {
+                return IS(NVLSTR(a->parameters.radius.secret), NVLSTR(b->parameters.radius.secret));
+        } else if (a->protocol->check == check_sip) {
+                return a->parameters.sip.maxforward == b->parameters.sip.maxforward &&
+                       IS(NVLSTR(a->parameters.sip.target), NVLSTR(b->parameters.sip.target));
+        } else if (a->protocol->check == check_smtp) {
+                return IS(NVLSTR(a->parameters.smtp.username), NVLSTR(b->parameters.smtp.username)) &&
+                       IS(NVLSTR(a->parameters.smtp.password), NVLSTR(b->parameters.smtp.password));
+        } else if (a->protocol->check == check_websocket) {
+                return a->parameters.websocket.version == b->parameters.websocket.version &&
+                       IS(NVLSTR(a->parameters.websocket.host), NVLSTR(b->parameters.websocket.host)) &&
+                       IS(NVLSTR(a->parameters.websocket.origin), NVLSTR(b->parameters.websocket.origin)) &&
+                       IS(NVLSTR(a->parameters.websocket.request), NVLSTR(b->parameters.websocket.request));
+        }
+        return true;
+}
+
+
+static void _shareProbe(Port_T port) {
+        for (Service_T s = servicelist; s; s = s->next) {
+                for (Port_T p = (port->family == Socket_Unix ? s->socketlist : s->portlist); p; p = p->next) {
+                        if (p == port)
+                                return; // The ports are compared with the preceding ones only
+                        if (_isSameProbe(p, port)) {
+                                if (! p->probe) {
+                                        NEW(p->probe);
+                                        p->probe->references = 1;
+                                }
+                                port->probe = p->probe;
+                                port->probe->references++;
+                                return;
+                        }
+                }
+        }
+}
+
+
+/*
+ * Find the identical port tests across services, so the endpoint is probed
+ * once per cycle and the result is used by all services referencing it
+ */
+static void shareprobes() {
+        for (Service_T s = servicelist; s; s = s->next) {
+                for (Port_T p = s->portlist; p; p = p->next)
+                        _shareProbe(p);
+                for (Port_T p = s->socketlist; p; p = p->next)
+                        _shareProbe(p);
+        }
+}
+
+
 /*
  * Check the dependency graph for errors
  * by doing a topological sort, thereby finding any cycles.
@@ -5203,6 +5787,35 @@ static void addsecurityattribute(char *value, Action_Type failed, Action_Type su
         current->secattrlist = attr;
 }
 
+static void addlisten(ListenTest_Type type, char *address, int port, Operator_Type operator, long long value_absolute, float value_percent, Action_Type failed, Action_Type succeeded) {
+        if (! Listen_isSupported()) {
+                yywarning("The listen test is not supported on this system\n");
+                FREE(address);
+                return;
+        }
+        if (port < 1 || port > 65535)
+                yyerror2("Listen port %d is out of range", port);
+        Listen_T l;
+        NEW(l);
+        addeventaction(&(l->action), failed, succeeded);
+        l->type = type;
+        l->address = address;
+        if (address) {
+                // Resolve the local address once, the test runs every cycle
+                struct addrinfo hints = {.ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM};
+                int status = getaddrinfo(address, NULL, &hints, &(l->addresses));
+                if (status)
+                        yyerror2("Cannot resolve listen address %s -- %s", address, status == EAI_SYSTEM ? STRERROR : gai_strerror(status));
+        }
+        l->port = port;
+        l->operator = operator;
+        l->limit_absolute = value_absolute;
+        l->limit_percent = value_percent;
+        l->info.queue = l->info.backlog = l->info.established = -1LL;
+        l->next = current->listenlist;
+        current->listenlist = l;
+}
+
 static void addfiledescriptors(Operator_Type operator, bool total, long long value_absolute, float value_percent, Action_Type failed, Action_Type succeeded) {
         Filedescriptors_T fds;
         NEW(fds);
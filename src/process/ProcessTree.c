@@ -489,6 +489,7 @@ bool init_system_info(void) {
         systeminfo.cpu.usage.user = -1.;
         systeminfo.cpu.usage.system = -1.;
         systeminfo.cpu.usage.iowait = -1.;
+        systeminfo.netstack.tcp.orphans = systeminfo.netstack.tcp.timeWait = -1LL;
         return (init_process_info_sysdep());
 }
 
@@ -517,6 +518,11 @@ bool update_system_info() {
                 goto error4;
         }
 
+        if ((systeminfo.statisticsAvailable & Statistics_NetworkStack) && ! used_system_netstack_sysdep(&systeminfo)) {
+                Log_error("'%s' statistic error -- network stack data collection failed\n", Run.system->name);
+                systeminfo.netstack.tcp.orphans = systeminfo.netstack.tcp.timeWait = -1LL;
+        }
+
         return true;
 
 error1:
@@ -31,6 +31,7 @@ int  getloadavg_sysdep (double *, int);
 bool used_system_memory_sysdep(SystemInfo_T *);
 bool used_system_cpu_sysdep(SystemInfo_T *);
 bool used_system_filedescriptors_sysdep(SystemInfo_T *);
+bool used_system_netstack_sysdep(SystemInfo_T *);
 bool available_statistics(SystemInfo_T *);
 int  initprocesstree_sysdep(ProcessTree_T **, ProcessEngine_Flags);
 
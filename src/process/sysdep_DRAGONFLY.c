@@ -330,6 +330,12 @@ bool used_system_filedescriptors_sysdep(SystemInfo_T *si) {
 }
 
 
+bool used_system_netstack_sysdep(__attribute__ ((unused)) SystemInfo_T *si) {
+        // Not implemented (Statistics_NetworkStack is not available)
+        return true;
+}
+
+
 bool available_statistics(SystemInfo_T *si) {
         si->statisticsAvailable = Statistics_CpuUser | Statistics_CpuSystem | Statistics_CpuNice | Statistics_CpuHardIRQ | Statistics_FiledescriptorsPerSystem;
         return true;
@@ -803,6 +803,83 @@ bool used_system_filedescriptors_sysdep(SystemInfo_T *si) {
 }
 
 
+/**
+ * Parse the "Prefix: name1 name2 ...\nPrefix: value1 value2 ..." line pair
+ * used by /proc/net/snmp and /proc/net/netstat and lookup requested values.
+ * The buffer is modified, the cursor is moved behind the parsed line pair,
+ * so the following sections can be parsed by the next call.
+ * @return true if all requested values were found, otherwise false
+ */
+static bool _parseNetstat(char **cursor, const char *prefix, int count, const char *names[], unsigned long long values[]) {
+        size_t length = strlen(prefix);
+        for (char *header = *cursor; header && *header; ) {
+                char *data = strchr(header, '\n');
+                if (! data)
+                        break;
+                *data++ = 0;
+                if (! strncmp(header, prefix, length) && header[length] == ':' && ! strncmp(data, prefix, length) && data[length] == ':') {
+                        int found = 0;
+                        char *next = strchr(data, '\n');
+                        if (next)
+                                *next++ = 0;
+                        *cursor = next;
+                        char *hctx = NULL, *dctx = NULL;
+                        char *name = strtok_r(header + length + 1, " ", &hctx);
+                        char *value = strtok_r(data + length + 1, " ", &dctx);
+                        for (; name && value; name = strtok_r(NULL, " ", &hctx), value = strtok_r(NULL, " ", &dctx)) {
+                                for (int i = 0; i < count; i++) {
+                                        if (Str_isEqual(name, names[i])) {
+                                                values[i] = strtoull(value, NULL, 10);
+                                                found++;
+                                        }
+                                }
+                        }
+                        return found == count;
+                }
+                header = data;
+        }
+        return false;
+}
+
+
+bool used_system_netstack_sysdep(SystemInfo_T *si) {
+        char buf[16384];
+        unsigned long long now = Time_milli();
+        // TCP and UDP counters: /proc/net/snmp (the Udp section follows the Tcp section)
+        unsigned long long snmp[3] = {};
+        char *cursor = buf;
+        if (! file_readProc(buf, sizeof(buf), "net/snmp", -1, NULL) || ! _parseNetstat(&cursor, "Tcp", 2, (const char *[]){"OutSegs", "RetransSegs"}, snmp) || ! _parseNetstat(&cursor, "Udp", 1, (const char *[]){"RcvbufErrors"}, snmp + 2)) {
+                DEBUG("system statistic error -- cannot read /proc/net/snmp\n");
+                return false;
+        }
+        Statistics_update(&(si->netstack.tcp.segments), now, snmp[0]);
+        Statistics_update(&(si->netstack.tcp.retransmits), now, snmp[1]);
+        Statistics_update(&(si->netstack.udp.receiveBufferErrors), now, snmp[2]);
+        // TCP extended counters: /proc/net/netstat
+        unsigned long long netstat[3] = {};
+        cursor = buf;
+        if (! file_readProc(buf, sizeof(buf), "net/netstat", -1, NULL) || ! _parseNetstat(&cursor, "TcpExt", 3, (const char *[]){"ListenOverflows", "ListenDrops", "SyncookiesSent"}, netstat)) {
+                DEBUG("system statistic error -- cannot read /proc/net/netstat\n");
+                return false;
+        }
+        Statistics_update(&(si->netstack.tcp.listenOverflows), now, netstat[0]);
+        Statistics_update(&(si->netstack.tcp.listenDrops), now, netstat[1]);
+        Statistics_update(&(si->netstack.tcp.synCookies), now, netstat[2]);
+        // Socket gauges: /proc/net/sockstat
+        // TCP: inuse 5 orphan 0 tw 2 alloc 8 mem 1
+        if (! file_readProc(buf, sizeof(buf), "net/sockstat", -1, NULL)) {
+                DEBUG("system statistic error -- cannot read /proc/net/sockstat\n");
+                return false;
+        }
+        char *tcp = strstr(buf, "TCP:");
+        if (! tcp || sscanf(tcp, "TCP: inuse %*d orphan %lld tw %lld", &(si->netstack.tcp.orphans), &(si->netstack.tcp.timeWait)) != 2) {
+                DEBUG("system statistic error -- cannot parse /proc/net/sockstat\n");
+                return false;
+        }
+        return true;
+}
+
+
 bool available_statistics(SystemInfo_T *si) {
         int rv;
         unsigned long long cpu_user;       // Time spent in user mode
@@ -869,6 +946,9 @@ bool available_statistics(SystemInfo_T *si) {
         if (stat("/proc/sys/fs/file-nr", &sb) == 0)
                 si->statisticsAvailable |= Statistics_FiledescriptorsPerProcessMax;
 
+        if (stat("/proc/net/snmp", &sb) == 0 && stat("/proc/net/netstat", &sb) == 0 && stat("/proc/net/sockstat", &sb) == 0)
+                si->statisticsAvailable |= Statistics_NetworkStack;
+
         return true;
 }
 
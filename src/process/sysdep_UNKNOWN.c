@@ -92,6 +92,11 @@ bool used_system_filedescriptors_sysdep(SystemInfo_T *si) {
 }
 
 
+bool used_system_netstack_sysdep(SystemInfo_T *si) {
+        return false;
+}
+
+
 bool available_statistics(SystemInfo_T *si) {
         return false;
 }
@@ -35,30 +35,170 @@
 #include "protocol.h"
 
 // libmonit
+#include "system/Time.h"
 #include "exceptions/IOException.h"
 #include "exceptions/ProtocolException.h"
 
-/* Escape zero i.e. '\0' in expect buffer with "\0" so zero can be tested in expect strings as "\0". If there are no '\0' in the buffer it is returned as it is */
-static char *_escapeZeroInExpectBuffer(char *buf, int buflen, int n) {
-        for (int i = 0, j = 0; i < n && j < buflen; i++, j++) {
-                if (buf[j] == '\0') {
-                        if (j + 1 < buflen) {
-                                memmove(buf + j + 1, buf + j, n - i);
-                                buf[j] = '\\';
-                                buf[j + 1] = '0';
-                                j++;
-                        }
-                }
-        }
-        return buf;
-}
-
 
 /**
  *  Generic service test.
  *
+ *  The expectation is evaluated each time data arrives from the server and
+ *  the expect step finishes as soon as the result is certain: a byte sequence
+ *  or a regular expression matched the data received so far. If the regular
+ *  expression matched only because of "$" at the end of the data, we wait a
+ *  moment for more data to arrive. The expect step fails if the data doesn't
+ *  match when the timeout expires, the server closes the connection or the
+ *  send/expect buffer is full.
+ *
+ *  The rest of a response which was matched already is discarded before the
+ *  next send, so it doesn't precede the next response and break "^" anchored
+ *  expectations: we read through the end of the matched line, waiting a
+ *  moment if it is incomplete, and drop the data already received.
+ *
  *  @file
  */
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+// Time to wait for more data if the match depends on the end of the data [ms]
+#define SETTLETIMEOUT 200
+
+
+typedef enum {
+        Match_None = 0,
+        Match_Tentative,                 // "$" matched the end of the data received so far
+        Match_Certain
+} __attribute__((__packed__)) Match_Type;
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+/* Escape zero i.e. '\0' in the received data with "\0" so zero can be tested in expect strings as "\0" */
+static char *_escapeZero(const unsigned char *data, int length, char *text) {
+        int j = 0;
+        for (int i = 0; i < length; i++) {
+                if (data[i] == '\0') {
+                        text[j++] = '\\';
+                        text[j++] = '0';
+                } else {
+                        text[j++] = data[i];
+                }
+        }
+        text[j] = 0;
+        return text;
+}
+
+
+/* Print the data as hex digits, the output is truncated if the buffer is too small */
+static char *_toHex(const unsigned char *data, int length, char *buf, int size) {
+        *buf = 0;
+        for (int i = 0; i < length && 2 * i + 2 < size; i++)
+                snprintf(buf + 2 * i, size - 2 * i, "%02x", data[i]);
+        return buf;
+}
+
+
+static bool _hasBytes(const unsigned char *data, int length, const unsigned char *bytes, int count) {
+        for (int i = 0; i + count <= length; i++)
+                if (memcmp(data + i, bytes, count) == 0)
+                        return true;
+        return false;
+}
+
+
+static Match_Type _match(Generic_T g, const unsigned char *data, int length, char *text) {
+        if (g->bytes)
+                return _hasBytes(data, length, g->bytes, g->length) ? Match_Certain : Match_None;
+        _escapeZero(data, length, text);
+        // More data may follow, so the end of the data received so far is not the end of the response
+        if (regexec(g->expect, text, 0, NULL, REG_NOTEOL) == 0)
+                return Match_Certain;
+        if (regexec(g->expect, text, 0, NULL, 0) == 0)
+                return Match_Tentative;
+        return Match_None;
+}
+
+
+static void _send(Socket_T socket, Generic_T g) {
+        /* Unescape any \0x00 escaped chars in g's send string to allow sending a string containing \0 bytes also */
+        char *X = Str_dup(g->send);
+        int l = Util_handle0Escapes(X);
+        int rv = Socket_write(socket, X, l);
+        FREE(X);
+        if (rv < 0)
+                THROW(IOException, "GENERIC: error sending data -- %s", STRERROR);
+        DEBUG("GENERIC: successfully sent: '%s'\n", g->send);
+}
+
+
+// Discard the rest of the previous response, returns the number of bytes discarded
+static int _discard(Socket_T socket, bool lineComplete) {
+        int discarded = 0;
+        if (! lineComplete) {
+                int timeout = Socket_getTimeout(socket);
+                Socket_setTimeout(socket, timeout > SETTLETIMEOUT ? SETTLETIMEOUT : timeout);
+                for (int c; (c = Socket_readByte(socket)) >= 0;) {
+                        discarded++;
+                        if (c == '\n')
+                                break;
+                }
+                Socket_setTimeout(socket, timeout);
+        }
+        return discarded + Socket_discard(socket);
+}
+
+
+// Returns true if the data received ends at the end of a line
+static bool _expect(Socket_T socket, Generic_T g, unsigned char *data, char *text) {
+        int length = 0;
+        Match_Type match = Match_None;
+        int timeout = Socket_getTimeout(socket);
+        long long started = Time_milli();
+        long long deadline = started + timeout;
+        // Read the data as it arrives until the match is certain, the timeout expires, the server closes the connection or the buffer is full
+        while (match != Match_Certain && length < (int)Run.limits.sendExpectBuffer) {
+                long long remaining = deadline - Time_milli();
+                if (remaining <= 0)
+                        break;
+                Socket_setTimeout(socket, match == Match_Tentative && remaining > SETTLETIMEOUT ? SETTLETIMEOUT : (int)remaining);
+                int n = Socket_readAvailable(socket, data + length, Run.limits.sendExpectBuffer - length);
+                if (n <= 0)
+                        break;
+                length += n;
+                match = _match(g, data, length, text);
+        }
+        Socket_setTimeout(socket, timeout); // Reset back original timeout for next send/expect
+        if (length == 0)
+                THROW(IOException, "GENERIC: error receiving data -- %s", STRERROR);
+        if (match == Match_None) {
+                char error[512];
+                if (g->bytes) {
+                        char received[256], expected[128];
+                        snprintf(error, sizeof(error), "GENERIC: received unexpected data [%s] -- expected bytes %s not found", _toHex(data, length, received, sizeof(received)), _toHex(g->bytes, g->length, expected, sizeof(expected)));
+                } else {
+                        char e[STRLEN];
+                        _escapeZero(data, length, text);
+                        regerror(REG_NOMATCH, g->expect, e, STRLEN);
+                        snprintf(error, sizeof(error), "GENERIC: received unexpected data [%s] -- %s", Str_trunc(Str_trim(text), sizeof(error) - 128), e);
+                }
+                THROW(ProtocolException, "%s", error);
+        }
+        if (g->bytes) {
+                DEBUG("GENERIC: successfully received: '%s' in %lld ms\n", _toHex(data, length, (char[STRLEN]){}, STRLEN), Time_milli() - started);
+                return true; // Binary data has no lines
+        }
+        DEBUG("GENERIC: successfully received: '%s' in %lld ms\n", Str_trunc(_escapeZero(data, length, text), STRLEN), Time_milli() - started);
+        return data[length - 1] == '\n';
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
 void check_generic(Socket_T socket) {
         ASSERT(socket);
 
@@ -66,60 +206,34 @@ void check_generic(Socket_T socket) {
         if (Socket_getPort(socket))
                 g = ((Port_T)(Socket_getPort(socket)))->parameters.generic.sendexpect;
 
-        char *buf = CALLOC(sizeof(char), Run.limits.sendExpectBuffer + 1);
-
-        while (g != NULL) {
-
-                if (g->send != NULL) {
-                        /* Unescape any \0x00 escaped chars in g's send string to allow sending a string containing \0 bytes also */
-                        char *X = Str_dup(g->send);
-                        int l = Util_handle0Escapes(X);
-
-                        if (Socket_write(socket, X, l) < 0) {
-                                FREE(X);
-                                FREE(buf);
-                                THROW(IOException, "GENERIC: error sending data -- %s", STRERROR);
+        // The received data and its copy with escaped zeros for the regular expression match
+        unsigned char *data = CALLOC(sizeof(unsigned char), Run.limits.sendExpectBuffer + 1);
+        char *text = CALLOC(sizeof(char), 2 * Run.limits.sendExpectBuffer + 1);
+        TRY
+        {
+                bool expected = false, lineComplete = true;
+                for (; g; g = g->next) {
+                        if (g->send) {
+                                if (expected) {
+                                        int discarded = _discard(socket, lineComplete);
+                                        if (discarded)
+                                                DEBUG("GENERIC: discarded %d bytes of the previous response\n", discarded);
+                                        expected = false;
+                                }
+                                _send(socket, g);
+                        } else if (g->expect || g->bytes) {
+                                lineComplete = _expect(socket, g, data, text);
+                                expected = true;
                         } else {
-                                DEBUG("GENERIC: successfully sent: '%s'\n", g->send);
+                                THROW(ProtocolException, "GENERIC: unexpected strangeness"); // This should not happen
                         }
-                        FREE(X);
-                } else if (g->expect != NULL) {
-                        /* Since the protocol is unknown we need to wait on EOF. To avoid waiting
-                         timeout seconds on EOF we first read one byte to fill the socket's read
-                         buffer and then set a low timeout on next read which reads remaining bytes
-                         as well as wait on EOF */
-                        int first_byte = Socket_readByte(socket);
-                        if (first_byte < 0) {
-                                FREE(buf);
-                                THROW(IOException, "GENERIC: error receiving data -- %s", STRERROR);
-                        }
-                        *buf = first_byte;
-
-                        int timeout = Socket_getTimeout(socket);
-                        Socket_setTimeout(socket, 200);
-                        int n = Socket_read(socket, buf + 1, Run.limits.sendExpectBuffer - 1) + 1;
-                        buf[n] = 0;
-                        if (n > 0)
-                                _escapeZeroInExpectBuffer(buf, Run.limits.sendExpectBuffer, n);
-                        Socket_setTimeout(socket, timeout); // Reset back original timeout for next send/expect
-                        int regex_return = regexec(g->expect, buf, 0, NULL, 0);
-                        if (regex_return != 0) {
-                                char e[STRLEN];
-                                regerror(regex_return, g->expect, e, STRLEN);
-                                char error[512];
-                                snprintf(error, sizeof(error), "GENERIC: received unexpected data [%s] -- %s", Str_trunc(Str_trim(buf), sizeof(error) - 128), e);
-                                FREE(buf);
-                                THROW(ProtocolException, "%s", error);
-                        } else {
-                                DEBUG("GENERIC: successfully received: '%s'\n", Str_trunc(buf, STRLEN));
-                        }
-                } else {
-                        /* This should not happen */
-                        FREE(buf);
-                        THROW(ProtocolException, "GENERIC: unexpected strangeness");
                 }
-                g = g->next;
         }
-        FREE(buf);
+        FINALLY
+        {
+                FREE(text);
+                FREE(data);
+        }
+        END_TRY;
 }
 
@@ -30,6 +30,8 @@
 
 #include "md5.h"
 #include "sha1.h"
+#include "sha256.h"
+#include "xxh64.h"
 #include "base64.h"
 #include "checksum.h"
 #include "protocol.h"
@@ -61,28 +63,97 @@
 
 #define BUFSIZE 4096
 
+/*
+ * The content is scanned as it arrives: each block read from the socket is
+ * appended to the last WINDOWSIZE bytes of the preceding content and the
+ * regular expression is matched against this window. A match which spans a
+ * block boundary is found if it is not longer than WINDOWSIZE bytes, the
+ * memory used by the content test is bounded by WINDOWSIZE + BUFSIZE.
+ */
+#define WINDOWSIZE 4096
+
+
+typedef struct Body_T {
+        Port_T port;
+        ChecksumContext_T checksum;                    // NULL if the checksum isn't tested
+        regex_t *regex;                   // NULL if the content isn't tested or if it matched already
+        bool matched;
+        bool skip;                 // The test outcome is known => the rest of the body doesn't have to be read
+        unsigned int total;                                  // Number of content bytes received
+        unsigned int offset;                 // Content offset of the first byte in the window
+        int length;                                                  // Bytes in the window
+        int peak;                                               // Peak number of bytes in the window
+        char window[WINDOWSIZE + BUFSIZE + 1];
+} *Body_T;
+
 
 /* ----------------------------------------------------------------- Private */
 
 
-static void _contentVerify(Port_T P, const char *data) {
+/*
+ * Scan the block of content which was read to the end of the window. The
+ * matched test is finished without waiting for the rest of the content
+ */
+static void _scanData(Body_T B, int n) {
+        char *data = B->window + B->length;
+        B->total += n;
+        if (B->checksum)
+                Checksum_append(B->checksum, data, n);
+        if (B->regex) {
+                B->length += n;
+                B->window[B->length] = 0;
+                if (B->length > B->peak)
+                        B->peak = B->length;
+                // The end of the window is not the end of the content, so '$' must not match here (see _finishScan). Similarly '^' is the start of the content only
+                if (regexec(B->regex, B->window, 0, NULL, B->offset ? REG_NOTBOL | REG_NOTEOL : REG_NOTEOL) == 0) {
+                        B->matched = true;
+                        B->regex = NULL;
+                        B->length = 0;
+                        if (B->port->url_request->operator == Operator_NotEqual)
+                                THROW(ProtocolException, "HTTP error: Regular expression matches");
+                        // The rest of the content must be still read if the checksum is tested or to keep the persistent connection usable
+                        B->skip = ! B->checksum && ! B->port->persistent;
+                } else if (B->length > WINDOWSIZE) {
+                        // Keep the tail of the window to find matches across the block boundary
+                        int shift = B->length - WINDOWSIZE;
+                        memmove(B->window, B->window + shift, WINDOWSIZE + 1);
+                        B->offset += shift;
+                        B->length = WINDOWSIZE;
+                }
+        }
+}
+
+
+/*
+ * Scan the tail of the content again, allowing '$' to match the end of the content
+ */
+static void _finishScan(Body_T B) {
+        if (B->regex && B->length && regexec(B->regex, B->window, 0, NULL, B->offset ? REG_NOTBOL : 0) == 0) {
+                B->matched = true;
+                B->regex = NULL;
+        }
+        if (B->port->url_request && B->port->url_request->regex)
+                DEBUG("HTTP: content test scanned %u bytes using %d bytes window\n", B->total, B->peak);
+}
+
+
+static void _contentVerify(Port_T P, Body_T B) {
         if (P->url_request && P->url_request->regex) {
                 bool rv = false;
                 char error[512];
-                int regex_return = regexec(P->url_request->regex, data, 0, NULL, 0);
                 switch (P->url_request->operator) {
                         case Operator_Equal:
-                                if (regex_return == 0) {
+                                if (B->matched) {
                                         rv = true;
                                         DEBUG("HTTP: Regular expression matches\n");
                                 } else {
                                         char errbuf[STRLEN];
-                                        regerror(regex_return, NULL, errbuf, sizeof(errbuf));
+                                        regerror(REG_NOMATCH, NULL, errbuf, sizeof(errbuf));
                                         snprintf(error, sizeof(error), "Regular expression doesn't match: %s", errbuf);
                                 }
                                 break;
                         case Operator_NotEqual:
-                                if (regex_return == 0) {
+                                if (B->matched) {
                                         snprintf(error, sizeof(error), "Regular expression matches");
                                 } else {
                                         rv = true;
@@ -141,86 +212,84 @@ static int _readDataFromSocket(Socket_T socket, char *data, int wantBytes) {
 }
 
 
-static void _readData(Socket_T socket, Port_T P, char **data, unsigned int wantBytes, unsigned int *haveBytes, ChecksumContext_T context) {
-        if (P->url_request && P->url_request->regex) {
-                // The content test is required => cache the whole body
-                *data = realloc(*data, *haveBytes + wantBytes + 1);
-                *haveBytes += _readDataFromSocket(socket, *data + *haveBytes, wantBytes);
-                if (P->parameters.http.checksum)
-                        Checksum_append(context, *data, wantBytes);
-                *(*data + *haveBytes) = 0;
-        } else {
-                // No content check is required => use small buffer and compute the checksum on the fly
-                *haveBytes = 0;
-                for (int readBytes = (wantBytes < BUFSIZE) ? wantBytes : BUFSIZE; *haveBytes < wantBytes; readBytes = (wantBytes - *haveBytes) < BUFSIZE ? (wantBytes - *haveBytes) : BUFSIZE) {
-                        _readDataFromSocket(socket, *data, readBytes);
-                        if (P->parameters.http.checksum)
-                                Checksum_append(context, *data, readBytes);
-                        *haveBytes += readBytes;
-                }
+static void _readData(Socket_T socket, Body_T B, unsigned int wantBytes) {
+        // Read the data in blocks and test them on the fly
+        for (unsigned int haveBytes = 0; haveBytes < wantBytes && ! B->skip;) {
+                int readBytes = (wantBytes - haveBytes) < BUFSIZE ? (wantBytes - haveBytes) : BUFSIZE;
+                _readDataFromSocket(socket, B->window + B->length, readBytes);
+                _scanData(B, readBytes);
+                haveBytes += readBytes;
         }
 }
 
 
-static void _processBodyChunked(Socket_T socket, Port_T P, char **data, __attribute__ ((unused)) int *contentLength, ChecksumContext_T context) {
+// Read and drop the content which exceeds the content buffer limit, so the persistent connection is read up to the end of the body
+static void _skipData(Socket_T socket, unsigned int wantBytes) {
+        char buf[BUFSIZE];
+        for (unsigned int haveBytes = 0; haveBytes < wantBytes;)
+                haveBytes += _readDataFromSocket(socket, buf, (wantBytes - haveBytes) < BUFSIZE ? (wantBytes - haveBytes) : BUFSIZE);
+}
+
+
+static void _processBodyChunked(Socket_T socket, Body_T B, __attribute__ ((unused)) int *contentLength) {
         char crlf[2] = {};
         unsigned int wantBytes = 0;
-        unsigned int haveBytes = 0;
-        while ((wantBytes = _getChunkSize(socket)) && haveBytes < Run.limits.httpContentBuffer) {
-                if (haveBytes + wantBytes > Run.limits.httpContentBuffer) {
-                        DEBUG("HTTP: content buffer limit exceeded -- limiting the data to %d\n", Run.limits.httpContentBuffer);
-                        wantBytes = Run.limits.httpContentBuffer - haveBytes;
+        while ((wantBytes = _getChunkSize(socket))) {
+                unsigned int testBytes = wantBytes;
+                if (B->total + wantBytes > Run.limits.httpContentBuffer) {
+                        testBytes = B->total < Run.limits.httpContentBuffer ? Run.limits.httpContentBuffer - B->total : 0;
+                        if (testBytes)
+                                DEBUG("HTTP: content buffer limit exceeded -- limiting the data to %d\n", Run.limits.httpContentBuffer);
+                }
+                _readData(socket, B, testBytes);
+                if (B->skip)
+                        return;
+                if (testBytes < wantBytes) {
+                        if (! B->port->persistent)
+                                return;
+                        _skipData(socket, wantBytes - testBytes);
                 }
-                _readData(socket, P, data, wantBytes, &haveBytes, context);
                 // Read the CRLF terminator
                 _readDataFromSocket(socket, crlf, 2);
         }
+        if (B->port->persistent) {
+                // Consume the trailer up to the empty line, so the connection is ready for the next request
+                char buf[512];
+                while (Socket_readLine(socket, buf, sizeof(buf)) && ! ((buf[0] == '\r' && buf[1] == '\n') || buf[0] == '\n'))
+                        ;
+        }
 }
 
 
-static void _processBodyContentLength(Socket_T socket, Port_T P, char **data, int *contentLength, ChecksumContext_T context) {
-        unsigned int haveBytes = 0;
+static void _processBodyContentLength(Socket_T socket, Body_T B, int *contentLength) {
         if (*contentLength < 0) {
                 THROW(ProtocolException, "HTTP error: Missing Content-Length header");
         } else if (*contentLength == 0) {
                 THROW(ProtocolException, "HTTP error: No content returned from server");
-        } else if (*contentLength > (int)Run.limits.httpContentBuffer) {
+        }
+        unsigned int testBytes = *contentLength;
+        if (testBytes > Run.limits.httpContentBuffer) {
                 DEBUG("HTTP: content buffer limit exceeded -- limiting the data to %d\n", Run.limits.httpContentBuffer);
-                *contentLength = Run.limits.httpContentBuffer;
+                testBytes = Run.limits.httpContentBuffer;
         }
-        _readData(socket, P, data, *contentLength, &haveBytes, context);
+        _readData(socket, B, testBytes);
+        if (B->port->persistent && ! B->skip)
+                _skipData(socket, *contentLength - testBytes);
 }
 
 
-static void _processBodyUntilEOF(Socket_T socket, Port_T P, char **data, __attribute__ ((unused)) int *contentLength, ChecksumContext_T context) {
+static void _processBodyUntilEOF(Socket_T socket, Body_T B, __attribute__ ((unused)) int *contentLength) {
         int readBytes = 0;
-        if (P->url_request && P->url_request->regex) {
-                // The content test is required => cache the whole body
-                unsigned int haveBytes = 0;
-                unsigned int wantBytes = STRLEN;
-                while (haveBytes < Run.limits.httpContentBuffer && (readBytes = Socket_read(socket, *data + haveBytes, wantBytes)) > 0)  {
-                        if (P->parameters.http.checksum)
-                                Checksum_append(context, *data + haveBytes, readBytes);
-                        haveBytes += readBytes;
-                        if (haveBytes + wantBytes > Run.limits.httpContentBuffer)
-                                wantBytes = Run.limits.httpContentBuffer - haveBytes;
-                        *data = realloc(*data, haveBytes + wantBytes + 1);
-                }
-                *(*data + haveBytes) = 0;
-        } else {
-                // No content check is required => use small buffer and compute the checksum on the fly
-                while ((readBytes = Socket_read(socket, *data, BUFSIZE)) > 0) {
-                        if (P->parameters.http.checksum)
-                                Checksum_append(context, *data, readBytes);
-                }
-        }
+        // The content test is limited to httpContentBuffer, the checksum is computed from the whole body
+        while (! B->skip && (! B->regex || B->total < Run.limits.httpContentBuffer) && (readBytes = Socket_read(socket, B->window + B->length, B->regex && Run.limits.httpContentBuffer - B->total < BUFSIZE ? Run.limits.httpContentBuffer - B->total : BUFSIZE)) > 0)
+                _scanData(B, readBytes);
         if (readBytes < 0) {
                 THROW(ProtocolException, "HTTP error: Receiving data -- %s", STRERROR);
         }
 }
 
 
-static void _processStatus(Socket_T socket, Port_T P) {
+static int _processStatus(Socket_T socket, Port_T P) {
         int status;
         char buf[512] = {};
 
@@ -231,10 +300,11 @@ static void _processStatus(Socket_T socket, Port_T P) {
                 THROW(ProtocolException, "HTTP error: Cannot parse HTTP status in response: %s", buf);
         if (! Util_evalQExpression(P->parameters.http.operator, status, P->parameters.http.hasStatus ? P->parameters.http.status : 400))
                 THROW(ProtocolException, "HTTP error: Server returned status %d", status);
+        return status;
 }
 
 
-static void _processHeaders(Socket_T socket, void (**processBody)(Socket_T socket, Port_T P, char **data, int *contentLength, ChecksumContext_T context), int *contentLength) {
+static void _processHeaders(Socket_T socket, void (**processBody)(Socket_T socket, Body_T B, int *contentLength), int *contentLength) {
         char buf[512] = {};
         *processBody = _processBodyUntilEOF;
 
@@ -264,32 +334,52 @@ static void _processHeaders(Socket_T socket, void (**processBody)(Socket_T socke
  */
 static void _checkResponse(Socket_T socket, Port_T P) {
         int contentLength = -1;
-        void (*processBody)(Socket_T socket, Port_T P, char **data, int *contentLength, ChecksumContext_T context);
-        _processStatus(socket, P);
+        void (*processBody)(Socket_T socket, Body_T B, int *contentLength);
+        int status = _processStatus(socket, P);
         _processHeaders(socket, &processBody, &contentLength);
         if ((P->url_request && P->url_request->regex) || P->parameters.http.checksum) {
                 if (processBody) {
-                        char *data = CALLOC(1, BUFSIZE);
+                        Body_T B;
+                        NEW(B);
+                        B->port = P;
                         struct ChecksumContext_T context;
                         TRY
                         {
-                                // Read data
-                                if (P->parameters.http.checksum)
+                                if (P->parameters.http.checksum) {
                                         Checksum_init(&context, P->parameters.http.hashtype);
-                                processBody(socket, P, &data, &contentLength, &context);
-                                // Perform tests
+                                        B->checksum = &context;
+                                }
+                                if (P->url_request)
+                                        B->regex = P->url_request->regex;
+                                // Read and test the data
+                                processBody(socket, B, &contentLength);
+                                _finishScan(B);
                                 if (P->parameters.http.checksum)
                                         Checksum_verify(&context, P->parameters.http.checksum);
-                                _contentVerify(P, data);
+                                _contentVerify(P, B);
                         }
                         FINALLY
                         {
-                                FREE(data);
+                                FREE(B);
                         }
                         END_TRY;
                 } else {
                         THROW(ProtocolException, "HTTP error: unknown transfer encoding");
                 }
+        } else if (P->persistent && P->parameters.http.method != Http_Head && status != 204 && status != 304 && status >= 200 && contentLength != 0) {
+                // Read the body without testing it, so the next request on the persistent connection starts at the response boundary
+                Body_T B;
+                NEW(B);
+                B->port = P;
+                TRY
+                {
+                        processBody(socket, B, &contentLength);
+                }
+                FINALLY
+                {
+                        FREE(B);
+                }
+                END_TRY;
         }
 }
 
@@ -325,7 +415,7 @@ static void _sendRequest(Socket_T socket, Port_T P) {
         if (! _hasHeader(P->parameters.http.headers, "Accept-Encoding"))
                 StringBuffer_append(sb, "Accept-Encoding: identity\r\n"); // We want no compression
         if (! _hasHeader(P->parameters.http.headers, "Connection"))
-                StringBuffer_append(sb, "Connection: close\r\n");
+                StringBuffer_append(sb, "Connection: %s\r\n", P->persistent ? "keep-alive" : "close");
         // Add headers if we have them
         if (P->parameters.http.headers) {
                 for (list_t p = P->parameters.http.headers->head; p; p = p->next) {
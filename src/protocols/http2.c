@@ -0,0 +1,933 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#include "config.h"
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_CTYPE_H
+#include <ctype.h>
+#endif
+
+#include "protocol.h"
+
+// libmonit
+#include "system/Time.h"
+#include "util/Str.h"
+#include "exceptions/IOException.h"
+#include "exceptions/ProtocolException.h"
+
+
+/**
+ *  A HTTP/2 test.
+ *
+ *  https://tools.ietf.org/html/rfc7540
+ *  https://tools.ietf.org/html/rfc7541
+ *
+ *  The connection is established either over TLS using the "h2" ALPN
+ *  protocol, or in cleartext with prior knowledge of HTTP/2 support (h2c).
+ *  All configured request paths are sent as concurrent streams over the
+ *  same connection and the status and response time of each stream is
+ *  recorded. If any stream's status fails the status test (>= 400 by
+ *  default), is reset by the server or doesn't complete, an error occurs.
+ *
+ *  The response content is discarded.
+ *
+ *  @file
+ */
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+#define FRAMEHEADER 9
+
+// We don't change SETTINGS_MAX_FRAME_SIZE, so the server cannot send larger frames
+#define FRAMESIZE 16384
+
+// The limit for the header block, which can span a HEADERS frame and multiple CONTINUATION frames
+#define HEADERBLOCKSIZE 65536
+
+// The HPACK dynamic table size (we keep the SETTINGS_HEADER_TABLE_SIZE default)
+#define TABLESIZE 4096
+
+// The size of a table entry is the length of the name and value plus 32 bytes overhead
+#define TABLEENTRIES (TABLESIZE / 32)
+
+#define OUTPUTSIZE 65536
+
+// The maximum window size, we don't want the server to wait for flow control window updates
+#define WINDOWSIZE 0x7fffffff
+
+
+typedef enum {
+        Frame_Data = 0,
+        Frame_Headers,
+        Frame_Priority,
+        Frame_RstStream,
+        Frame_Settings,
+        Frame_PushPromise,
+        Frame_Ping,
+        Frame_GoAway,
+        Frame_WindowUpdate,
+        Frame_Continuation
+} Frame_Type;
+
+
+// Frame flags
+#define FLAG_ENDSTREAM  0x1
+#define FLAG_ACK        0x1
+#define FLAG_ENDHEADERS 0x4
+#define FLAG_PADDED     0x8
+#define FLAG_PRIORITY   0x20
+
+
+// Settings identifiers
+#define SETTINGS_ENABLEPUSH        0x2
+#define SETTINGS_INITIALWINDOWSIZE 0x4
+
+
+// Error codes
+#define ERROR_NONE     0x0
+#define ERROR_REFUSED  0x7
+
+
+static const char *errorNames[] = {"NO_ERROR", "PROTOCOL_ERROR", "INTERNAL_ERROR", "FLOW_CONTROL_ERROR", "SETTINGS_TIMEOUT", "STREAM_CLOSED", "FRAME_SIZE_ERROR", "REFUSED_STREAM", "CANCEL", "COMPRESSION_ERROR", "CONNECT_ERROR", "ENHANCE_YOUR_CALM", "INADEQUATE_SECURITY", "HTTP_1_1_REQUIRED"};
+
+
+static const char *preface = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+
+
+// HPACK static table (RFC 7541, Appendix A), the index 0 is unused
+static const struct {
+        const char *name;
+        const char *value;
+} staticTable[] = {
+        {NULL, NULL},
+        {":authority", ""},
+        {":method", "GET"},
+        {":method", "POST"},
+        {":path", "/"},
+        {":path", "/index.html"},
+        {":scheme", "http"},
+        {":scheme", "https"},
+        {":status", "200"},
+        {":status", "204"},
+        {":status", "206"},
+        {":status", "304"},
+        {":status", "400"},
+        {":status", "404"},
+        {":status", "500"},
+        {"accept-charset", ""},
+        {"accept-encoding", "gzip, deflate"},
+        {"accept-language", ""},
+        {"accept-ranges", ""},
+        {"accept", ""},
+        {"access-control-allow-origin", ""},
+        {"age", ""},
+        {"allow", ""},
+        {"authorization", ""},
+        {"cache-control", ""},
+        {"content-disposition", ""},
+        {"content-encoding", ""},
+        {"content-language", ""},
+        {"content-length", ""},
+        {"content-location", ""},
+        {"content-range", ""},
+        {"content-type", ""},
+        {"cookie", ""},
+        {"date", ""},
+        {"etag", ""},
+        {"expect", ""},
+        {"expires", ""},
+        {"from", ""},
+        {"host", ""},
+        {"if-match", ""},
+        {"if-modified-since", ""},
+        {"if-none-match", ""},
+        {"if-range", ""},
+        {"if-unmodified-since", ""},
+        {"last-modified", ""},
+        {"link", ""},
+        {"location", ""},
+        {"max-forwards", ""},
+        {"proxy-authenticate", ""},
+        {"proxy-authorization", ""},
+        {"range", ""},
+        {"referer", ""},
+        {"refresh", ""},
+        {"retry-after", ""},
+        {"server", ""},
+        {"set-cookie", ""},
+        {"strict-transport-security", ""},
+        {"transfer-encoding", ""},
+        {"user-agent", ""},
+        {"vary", ""},
+        {"via", ""},
+        {"www-authenticate", ""}
+};
+
+#define STATICENTRIES ((int)(sizeof(staticTable) / sizeof(staticTable[0])) - 1)
+
+
+// Static table indexes used by the request encoder
+#define INDEX_AUTHORITY      1
+#define INDEX_METHOD_GET     2
+#define INDEX_PATH_ROOT      4
+#define INDEX_SCHEME_HTTP    6
+#define INDEX_SCHEME_HTTPS   7
+#define INDEX_ACCEPTENCODING 16
+#define INDEX_ACCEPT         19
+#define INDEX_AUTHORIZATION  23
+#define INDEX_USERAGENT      58
+
+
+/*
+ * HPACK Huffman code (RFC 7541, Appendix B). The code is canonical, so it is
+ * described by the number of codes of each length and the symbols ordered by
+ * the code (the symbol 256 is EOS)
+ */
+static const uint8_t huffmanCount[31] = {
+        0, 0, 0, 0, 0, 10, 26, 32, 6, 0, 5, 3, 2, 6, 2, 3, 0, 0, 0, 3, 8, 13, 26, 29, 12, 4, 15, 19, 29, 0, 4
+};
+
+static const uint16_t huffmanSymbol[257] = {
+        48, 49, 50, 97, 99, 101, 105, 111, 115, 116, 32, 37, 45, 46, 47, 51,
+        52, 53, 54, 55, 56, 57, 61, 65, 95, 98, 100, 102, 103, 104, 108, 109,
+        110, 112, 114, 117, 58, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+        77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 89, 106, 107, 113, 118,
+        119, 120, 121, 122, 38, 42, 44, 59, 88, 90, 33, 34, 40, 41, 63, 39,
+        43, 124, 35, 62, 0, 36, 64, 91, 93, 126, 94, 125, 60, 96, 123, 92,
+        195, 208, 128, 130, 131, 162, 184, 194, 224, 226, 153, 161, 167, 172, 176, 177,
+        179, 209, 216, 217, 227, 229, 230, 129, 132, 133, 134, 136, 146, 154, 156, 160,
+        163, 164, 169, 170, 173, 178, 181, 185, 186, 187, 189, 190, 196, 198, 228, 232,
+        233, 1, 135, 137, 138, 139, 140, 141, 143, 147, 149, 150, 151, 152, 155, 157,
+        158, 165, 166, 168, 174, 175, 180, 182, 183, 188, 191, 197, 231, 239, 9, 142,
+        144, 145, 148, 159, 171, 206, 215, 225, 236, 237, 199, 207, 234, 235, 192, 193,
+        200, 201, 202, 205, 210, 213, 218, 219, 238, 240, 242, 243, 255, 203, 204, 211,
+        212, 214, 221, 222, 223, 241, 244, 245, 246, 247, 248, 250, 251, 252, 253, 254,
+        2, 3, 4, 5, 6, 7, 8, 11, 12, 14, 15, 16, 17, 18, 19, 20,
+        21, 23, 24, 25, 26, 27, 28, 29, 30, 31, 127, 220, 249, 10, 13, 22,
+        256
+};
+
+
+typedef struct Stream_T {
+        Http2Stream_T stream;
+        unsigned int id;
+        bool closed;
+        int error;                                   // RST_STREAM error code or -1
+        long long started;
+} *Stream_T;
+
+
+typedef struct Http2_T {
+        Socket_T socket;
+        Port_T port;
+        int count;                                                 // Number of streams
+        int open;                                             // Number of open streams
+        Stream_T streams;
+        // Header block which is being received (it can continue in CONTINUATION frames)
+        unsigned int headersId;                               // 0 if no header block is open
+        Stream_T headersStream;                                // NULL if the stream is unknown
+        bool headersEndStream;
+        int headersLength;
+        unsigned char headers[HEADERBLOCKSIZE];
+        // HPACK dynamic table, the entry 0 is the newest one
+        struct {
+                char *name;
+                char *value;
+                int size;
+        } table[TABLEENTRIES];
+        int tableEntries;
+        int tableSize;
+        int tableMaxSize;
+        // Decoded header field (longer strings cannot be stored in the dynamic table and are not used)
+        char name[TABLESIZE + 1];
+        char value[TABLESIZE + 1];
+        // Frame buffers
+        unsigned char frame[FRAMESIZE];
+        int outputLength;
+        unsigned char output[OUTPUTSIZE];
+} *Http2_T;
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+static const char *_errorName(unsigned int error) {
+        return error < sizeof(errorNames) / sizeof(errorNames[0]) ? errorNames[error] : "UNKNOWN_ERROR";
+}
+
+
+static unsigned int _getUInt32(const unsigned char *b) {
+        return (unsigned int)b[0] << 24 | (unsigned int)b[1] << 16 | (unsigned int)b[2] << 8 | (unsigned int)b[3];
+}
+
+
+static void _putUInt32(unsigned char *b, unsigned int value) {
+        b[0] = (value >> 24) & 0xff;
+        b[1] = (value >> 16) & 0xff;
+        b[2] = (value >> 8) & 0xff;
+        b[3] = value & 0xff;
+}
+
+
+static void _read(Socket_T socket, unsigned char *buf, int length) {
+        for (int n = 0; n < length;) {
+                int rv = Socket_read(socket, buf + n, length - n);
+                if (rv <= 0)
+                        THROW(IOException, "HTTP2: error receiving data -- %s", rv == 0 ? "connection closed by the server" : STRERROR);
+                n += rv;
+        }
+}
+
+
+static void _flush(Http2_T H) {
+        if (H->outputLength) {
+                if (Socket_write(H->socket, H->output, H->outputLength) < 0)
+                        THROW(IOException, "HTTP2: error sending data -- %s", STRERROR);
+                H->outputLength = 0;
+        }
+}
+
+
+/*
+ * Queue the frame in the output buffer. The frames are sent by _flush(), so
+ * all requests are sent at once
+ */
+static void _putFrame(Http2_T H, Frame_Type type, unsigned char flags, unsigned int stream, const unsigned char *payload, int length) {
+        if (H->outputLength + FRAMEHEADER + length > OUTPUTSIZE)
+                _flush(H);
+        unsigned char *b = H->output + H->outputLength;
+        b[0] = (length >> 16) & 0xff;
+        b[1] = (length >> 8) & 0xff;
+        b[2] = length & 0xff;
+        b[3] = type;
+        b[4] = flags;
+        _putUInt32(b + 5, stream & 0x7fffffff);
+        if (length)
+                memcpy(b + FRAMEHEADER, payload, length);
+        H->outputLength += FRAMEHEADER + length;
+}
+
+
+/* --------------------------------------------------------- HPACK encoder */
+
+
+static void _encodeInteger(unsigned char *b, int *length, unsigned char flags, int prefix, size_t value) {
+        int max = (1 << prefix) - 1;
+        if (*length >= FRAMESIZE)
+                THROW(ProtocolException, "HTTP2 error: request headers too large");
+        if (value < (size_t)max) {
+                b[(*length)++] = flags | (unsigned char)value;
+        } else {
+                b[(*length)++] = flags | (unsigned char)max;
+                for (value -= max; ; value >>= 7) {
+                        if (*length >= FRAMESIZE)
+                                THROW(ProtocolException, "HTTP2 error: request headers too large");
+                        if (value < 128) {
+                                b[(*length)++] = (unsigned char)value;
+                                break;
+                        }
+                        b[(*length)++] = (unsigned char)(value % 128 + 128);
+                }
+        }
+}
+
+
+static void _encodeString(unsigned char *b, int *length, const char *s, size_t n) {
+        // The strings are sent as is, without the Huffman coding
+        _encodeInteger(b, length, 0x00, 7, n);
+        if (*length + n > FRAMESIZE)
+                THROW(ProtocolException, "HTTP2 error: request headers too large");
+        memcpy(b + *length, s, n);
+        *length += n;
+}
+
+
+/*
+ * Encode the header field as a literal without indexing: if the index is
+ * set, the name is referenced from the static table
+ */
+static void _encodeHeader(unsigned char *b, int *length, int index, const char *name, size_t nameLength, const char *value, size_t valueLength) {
+        if (index) {
+                _encodeInteger(b, length, 0x00, 4, index);
+        } else {
+                _encodeInteger(b, length, 0x00, 4, 0);
+                _encodeString(b, length, name, nameLength);
+        }
+        _encodeString(b, length, value, valueLength);
+}
+
+
+static bool _hasHeader(List_T list, const char *name) {
+        if (list) {
+                for (list_t h = list->head; h; h = h->next) {
+                        char *header = h->e;
+                        if (Str_startsWith(header, name))
+                                if (header[strlen(name)] == ':') // Ensure that name is not just a prefix
+                                        return true;
+                }
+        }
+        return false;
+}
+
+
+/*
+ * Return true if the header is connection specific (not allowed in HTTP/2) or is sent as a pseudo header
+ */
+static bool _isIgnoredHeader(const char *name, size_t length) {
+        static const char *ignored[] = {"host", "connection", "keep-alive", "proxy-connection", "transfer-encoding", "upgrade", "te"};
+        for (size_t i = 0; i < sizeof(ignored) / sizeof(ignored[0]); i++)
+                if (strlen(ignored[i]) == length && strncasecmp(name, ignored[i], length) == 0)
+                        return true;
+        return false;
+}
+
+
+static void _encodeRequest(Http2_T H, Http2Stream_T stream, const char *authority, const char *auth, unsigned char *b, int *length) {
+        Port_T P = H->port;
+        if (P->parameters.http.method == Http_Head)
+                _encodeHeader(b, length, INDEX_METHOD_GET, NULL, 0, "HEAD", 4);
+        else
+                _encodeInteger(b, length, 0x80, 7, INDEX_METHOD_GET);
+        _encodeInteger(b, length, 0x80, 7, Socket_isSecure(H->socket) ? INDEX_SCHEME_HTTPS : INDEX_SCHEME_HTTP);
+        if (IS(stream->request, "/"))
+                _encodeInteger(b, length, 0x80, 7, INDEX_PATH_ROOT);
+        else
+                _encodeHeader(b, length, INDEX_PATH_ROOT, NULL, 0, stream->request, strlen(stream->request));
+        _encodeHeader(b, length, INDEX_AUTHORITY, NULL, 0, authority, strlen(authority));
+        if (auth)
+                _encodeHeader(b, length, INDEX_AUTHORIZATION, NULL, 0, auth, strlen(auth));
+        if (! _hasHeader(P->parameters.http.headers, "User-Agent")) {
+                char userAgent[STRLEN];
+                snprintf(userAgent, sizeof(userAgent), "Monit/%s", VERSION);
+                _encodeHeader(b, length, INDEX_USERAGENT, NULL, 0, userAgent, strlen(userAgent));
+        }
+        if (! _hasHeader(P->parameters.http.headers, "Accept"))
+                _encodeHeader(b, length, INDEX_ACCEPT, NULL, 0, "*/*", 3);
+        if (! _hasHeader(P->parameters.http.headers, "Accept-Encoding"))
+                _encodeHeader(b, length, INDEX_ACCEPTENCODING, NULL, 0, "identity", 8); // We want no compression
+        if (P->parameters.http.headers) {
+                for (list_t p = P->parameters.http.headers->head; p; p = p->next) {
+                        char *header = p->e;
+                        char *delimiter = strchr(header, ':');
+                        if (delimiter && ! _isIgnoredHeader(header, delimiter - header)) {
+                                // The header names must be lowercase in HTTP/2
+                                char name[STRLEN];
+                                size_t nameLength = delimiter - header < (long)sizeof(name) ? (size_t)(delimiter - header) : sizeof(name) - 1;
+                                for (size_t i = 0; i < nameLength; i++)
+                                        name[i] = tolower((unsigned char)header[i]);
+                                char *value = delimiter + 1;
+                                while (*value == ' ' || *value == '\t')
+                                        value++;
+                                _encodeHeader(b, length, 0, name, nameLength, value, strlen(value));
+                        }
+                }
+        }
+}
+
+
+static void _sendRequests(Http2_T H) {
+        Port_T P = H->port;
+        // Connection preface: the magic string followed by SETTINGS and the connection window update
+        unsigned char settings[12];
+        settings[0] = 0;
+        settings[1] = SETTINGS_ENABLEPUSH;
+        _putUInt32(settings + 2, 0);
+        settings[6] = 0;
+        settings[7] = SETTINGS_INITIALWINDOWSIZE;
+        _putUInt32(settings + 8, WINDOWSIZE);
+        memcpy(H->output, preface, strlen(preface));
+        H->outputLength = strlen(preface);
+        _putFrame(H, Frame_Settings, 0, 0, settings, sizeof(settings));
+        unsigned char increment[4];
+        _putUInt32(increment, WINDOWSIZE - 65535);
+        _putFrame(H, Frame_WindowUpdate, 0, 0, increment, sizeof(increment));
+        // Request headers
+        char authority[STRLEN];
+        char *auth = NULL;
+        if (P->parameters.http.username) {
+                char *header = Util_getBasicAuthHeader(P->parameters.http.username, P->parameters.http.password);
+                if (header) {
+                        // Strip the "Authorization: " prefix and the CRLF terminator
+                        char *value = strchr(header, ':');
+                        auth = Str_dup(Str_trim(value ? value + 1 : header));
+                        FREE(header);
+                }
+        }
+        if (P->parameters.http.headers) {
+                for (list_t p = P->parameters.http.headers->head; p; p = p->next) {
+                        char *header = p->e;
+                        if (Str_startsWith(header, "Host:")) {
+                                snprintf(authority, sizeof(authority), "%s", header + 5);
+                                Str_trim(authority);
+                                break;
+                        }
+                }
+        }
+        if (! _hasHeader(P->parameters.http.headers, "Host"))
+                Util_getHTTPHostHeader(H->socket, authority, sizeof(authority));
+        TRY
+        {
+                for (int i = 0; i < H->count; i++) {
+                        Stream_T S = H->streams + i;
+                        int length = 0;
+                        _encodeRequest(H, S->stream, authority, auth, H->frame, &length);
+                        _putFrame(H, Frame_Headers, FLAG_ENDSTREAM | FLAG_ENDHEADERS, S->id, H->frame, length);
+                }
+        }
+        FINALLY
+        {
+                FREE(auth);
+        }
+        END_TRY;
+        long long started = Time_micro();
+        for (int i = 0; i < H->count; i++)
+                H->streams[i].started = started;
+        _flush(H);
+}
+
+
+/* --------------------------------------------------------- HPACK decoder */
+
+
+static size_t _decodeInteger(const unsigned char **b, const unsigned char *end, int prefix) {
+        int max = (1 << prefix) - 1;
+        if (*b >= end)
+                THROW(ProtocolException, "HTTP2 error: HPACK integer truncated");
+        size_t value = *(*b)++ & max;
+        if (value == (size_t)max) {
+                for (int shift = 0; ; shift += 7) {
+                        if (*b >= end)
+                                THROW(ProtocolException, "HTTP2 error: HPACK integer truncated");
+                        if (shift > 28)
+                                THROW(ProtocolException, "HTTP2 error: HPACK integer overflow");
+                        unsigned char c = *(*b)++;
+                        value += (size_t)(c & 0x7f) << shift;
+                        if (! (c & 0x80))
+                                break;
+                }
+        }
+        return value;
+}
+
+
+/*
+ * Decode the Huffman coded string. The string is stored in the buffer only if
+ * it fits, the decoded length is returned in any case
+ */
+static size_t _decodeHuffman(const unsigned char *b, size_t length, char *s, size_t size) {
+        size_t n = 0;
+        int bits = 0;                                  // Number of bits of the current code
+        unsigned int code = 0, first = 0, index = 0;
+        for (size_t i = 0; i < length; i++) {
+                for (int bit = 7; bit >= 0; bit--) {
+                        code |= (b[i] >> bit) & 1;
+                        bits++;
+                        unsigned int count = huffmanCount[bits];
+                        if (code - first < count) {
+                                unsigned int symbol = huffmanSymbol[index + code - first];
+                                if (symbol == 256)
+                                        THROW(ProtocolException, "HTTP2 error: HPACK string contains EOS");
+                                if (n < size)
+                                        s[n] = (char)symbol;
+                                n++;
+                                bits = 0;
+                                code = first = index = 0;
+                        } else {
+                                if (bits == 30)
+                                        THROW(ProtocolException, "HTTP2 error: HPACK invalid Huffman code");
+                                index += count;
+                                first = (first + count) << 1;
+                                code <<= 1;
+                        }
+                }
+        }
+        // The padding is the most significant bits of EOS (all ones) and is shorter than 8 bits
+        if (bits > 7 || (bits && code >> 1 != (1U << bits) - 1))
+                THROW(ProtocolException, "HTTP2 error: HPACK invalid Huffman padding");
+        return n;
+}
+
+
+/*
+ * Decode the string into the buffer of size TABLESIZE + 1. Returns the string
+ * length, if the string is longer than TABLESIZE, it's truncated
+ */
+static size_t _decodeString(const unsigned char **b, const unsigned char *end, char *s) {
+        if (*b >= end)
+                THROW(ProtocolException, "HTTP2 error: HPACK string truncated");
+        bool huffman = **b & 0x80;
+        size_t length = _decodeInteger(b, end, 7);
+        if (length > (size_t)(end - *b))
+                THROW(ProtocolException, "HTTP2 error: HPACK string truncated");
+        size_t n;
+        if (huffman) {
+                n = _decodeHuffman(*b, length, s, TABLESIZE);
+        } else {
+                n = length;
+                memcpy(s, *b, length < TABLESIZE ? length : TABLESIZE);
+        }
+        s[n < TABLESIZE ? n : TABLESIZE] = 0;
+        *b += length;
+        return n;
+}
+
+
+static void _tableEvict(Http2_T H, int size) {
+        while (H->tableEntries && H->tableSize > size) {
+                int last = --H->tableEntries;
+                H->tableSize -= H->table[last].size;
+                FREE(H->table[last].name);
+                FREE(H->table[last].value);
+        }
+}
+
+
+static void _tableAdd(Http2_T H, size_t nameLength, size_t valueLength) {
+        int size = (int)(nameLength + valueLength + 32);
+        if (nameLength > TABLESIZE || valueLength > TABLESIZE || size > H->tableMaxSize) {
+                // The entry larger than the table empties the table
+                _tableEvict(H, 0);
+                return;
+        }
+        _tableEvict(H, H->tableMaxSize - size);
+        memmove(H->table + 1, H->table, H->tableEntries * sizeof(H->table[0]));
+        H->table[0].name = Str_dup(H->name);
+        H->table[0].value = Str_dup(H->value);
+        H->table[0].size = size;
+        H->tableEntries++;
+        H->tableSize += size;
+}
+
+
+/*
+ * Copy the indexed entry to the decoded field
+ */
+static void _tableGet(Http2_T H, size_t index, bool withValue, size_t *nameLength, size_t *valueLength) {
+        if (index < 1 || index > (size_t)(STATICENTRIES + H->tableEntries))
+                THROW(ProtocolException, "HTTP2 error: HPACK invalid table index %zu", index);
+        const char *name, *value;
+        if (index <= STATICENTRIES) {
+                name = staticTable[index].name;
+                value = staticTable[index].value;
+        } else {
+                name = H->table[index - STATICENTRIES - 1].name;
+                value = H->table[index - STATICENTRIES - 1].value;
+        }
+        *nameLength = strlen(name);
+        snprintf(H->name, sizeof(H->name), "%s", name);
+        if (withValue) {
+                *valueLength = strlen(value);
+                snprintf(H->value, sizeof(H->value), "%s", value);
+        }
+}
+
+
+static void _decodeField(Http2_T H, Stream_T S, size_t valueLength) {
+        if (S && IS(H->name, ":status") && valueLength < TABLESIZE) {
+                int status;
+                if (sscanf(H->value, "%3d", &status) != 1)
+                        THROW(ProtocolException, "HTTP2 error: stream %u: cannot parse status '%s'", S->id, H->value);
+                // Wait for the final response if the status is informational
+                if (status >= 200)
+                        S->stream->status = status;
+        }
+}
+
+
+static void _decodeHeaders(Http2_T H, Stream_T S) {
+        const unsigned char *b = H->headers;
+        const unsigned char *end = H->headers + H->headersLength;
+        while (b < end) {
+                size_t nameLength = 0, valueLength = 0;
+                if (*b & 0x80) {
+                        // Indexed header field
+                        _tableGet(H, _decodeInteger(&b, end, 7), true, &nameLength, &valueLength);
+                } else if (*b & 0x40) {
+                        // Literal header field with incremental indexing
+                        size_t index = _decodeInteger(&b, end, 6);
+                        if (index)
+                                _tableGet(H, index, false, &nameLength, &valueLength);
+                        else
+                                nameLength = _decodeString(&b, end, H->name);
+                        valueLength = _decodeString(&b, end, H->value);
+                        _tableAdd(H, nameLength, valueLength);
+                } else if (*b & 0x20) {
+                        // Dynamic table size update
+                        size_t size = _decodeInteger(&b, end, 5);
+                        if (size > TABLESIZE)
+                                THROW(ProtocolException, "HTTP2 error: HPACK invalid table size update %zu", size);
+                        H->tableMaxSize = (int)size;
+                        _tableEvict(H, H->tableMaxSize);
+                        continue;
+                } else {
+                        // Literal header field without indexing or never indexed
+                        size_t index = _decodeInteger(&b, end, 4);
+                        if (index)
+                                _tableGet(H, index, false, &nameLength, &valueLength);
+                        else
+                                nameLength = _decodeString(&b, end, H->name);
+                        valueLength = _decodeString(&b, end, H->value);
+                }
+                _decodeField(H, S, valueLength);
+        }
+}
+
+
+/* ---------------------------------------------------------------- Streams */
+
+
+static Stream_T _getStream(Http2_T H, unsigned int id) {
+        if (id % 2 && id / 2 < (unsigned int)H->count)
+                return H->streams + id / 2;
+        return NULL;
+}
+
+
+static void _closeStream(Http2_T H, Stream_T S) {
+        if (! S->closed) {
+                S->closed = true;
+                S->stream->response = (double)(Time_micro() - S->started) / 1000.;
+                H->open--;
+        }
+}
+
+
+static void _headersReceived(Http2_T H) {
+        Stream_T S = H->headersStream;
+        _decodeHeaders(H, S);
+        // Trailers or a response without content can end the stream
+        if (S && H->headersEndStream)
+                _closeStream(H, S);
+        H->headersId = 0;
+        H->headersStream = NULL;
+        H->headersLength = 0;
+}
+
+
+static void _appendHeaders(Http2_T H, const unsigned char *fragment, int length) {
+        if (H->headersLength + length > HEADERBLOCKSIZE)
+                THROW(ProtocolException, "HTTP2 error: response headers too large");
+        memcpy(H->headers + H->headersLength, fragment, length);
+        H->headersLength += length;
+}
+
+
+static void _processHeaders(Http2_T H, unsigned char flags, unsigned int id, int length) {
+        unsigned char *fragment = H->frame;
+        if (! id)
+                THROW(ProtocolException, "HTTP2 error: HEADERS frame received for stream 0");
+        if (flags & FLAG_PADDED) {
+                if (length < 1 || fragment[0] >= length)
+                        THROW(ProtocolException, "HTTP2 error: invalid HEADERS frame padding");
+                length -= fragment[0] + 1;
+                fragment++;
+        }
+        if (flags & FLAG_PRIORITY) {
+                if (length < 5)
+                        THROW(ProtocolException, "HTTP2 error: invalid HEADERS frame");
+                length -= 5;
+                fragment += 5;
+        }
+        // Header blocks for unknown streams must be decoded too, to keep the HPACK table in sync
+        H->headersId = id;
+        H->headersStream = _getStream(H, id);
+        H->headersEndStream = flags & FLAG_ENDSTREAM;
+        H->headersLength = 0;
+        _appendHeaders(H, fragment, length);
+        if (flags & FLAG_ENDHEADERS)
+                _headersReceived(H);
+}
+
+
+static void _processGoAway(Http2_T H, int length) {
+        if (length < 8)
+                THROW(ProtocolException, "HTTP2 error: invalid GOAWAY frame");
+        unsigned int last = _getUInt32(H->frame) & 0x7fffffff;
+        unsigned int error = _getUInt32(H->frame + 4);
+        if (error != ERROR_NONE)
+                THROW(ProtocolException, "HTTP2 error: the server closed the connection -- %s", _errorName(error));
+        // The streams above the last stream identifier were not processed by the server
+        for (int i = 0; i < H->count; i++) {
+                Stream_T S = H->streams + i;
+                if (S->id > last && ! S->closed) {
+                        S->error = ERROR_REFUSED;
+                        _closeStream(H, S);
+                }
+        }
+}
+
+
+static void _receiveResponses(Http2_T H) {
+        bool first = true;
+        while (H->open > 0) {
+                unsigned char header[FRAMEHEADER];
+                _read(H->socket, header, FRAMEHEADER);
+                if (first && memcmp(header, "HTTP/1.", 7) == 0)
+                        THROW(ProtocolException, "HTTP2 error: the server doesn't support HTTP/2");
+                first = false;
+                int length = header[0] << 16 | header[1] << 8 | header[2];
+                Frame_Type type = header[3];
+                unsigned char flags = header[4];
+                unsigned int id = _getUInt32(header + 5) & 0x7fffffff;
+                if (length > FRAMESIZE)
+                        THROW(ProtocolException, "HTTP2 error: frame too large (%d bytes)", length);
+                _read(H->socket, H->frame, length);
+                if (H->headersId && (type != Frame_Continuation || id != H->headersId))
+                        THROW(ProtocolException, "HTTP2 error: CONTINUATION frame expected for stream %u", H->headersId);
+                Stream_T S = _getStream(H, id);
+                switch (type) {
+                        case Frame_Data:
+                                // The content is discarded, we announced the maximum window size, so no window updates are needed
+                                if (S && (flags & FLAG_ENDSTREAM))
+                                        _closeStream(H, S);
+                                break;
+                        case Frame_Headers:
+                                _processHeaders(H, flags, id, length);
+                                break;
+                        case Frame_Continuation:
+                                if (! H->headersId)
+                                        THROW(ProtocolException, "HTTP2 error: unexpected CONTINUATION frame");
+                                _appendHeaders(H, H->frame, length);
+                                if (flags & FLAG_ENDHEADERS)
+                                        _headersReceived(H);
+                                break;
+                        case Frame_RstStream:
+                                if (S && length >= 4) {
+                                        S->error = _getUInt32(H->frame);
+                                        _closeStream(H, S);
+                                }
+                                break;
+                        case Frame_Settings:
+                                if (! (flags & FLAG_ACK)) {
+                                        _putFrame(H, Frame_Settings, FLAG_ACK, 0, NULL, 0);
+                                        _flush(H);
+                                }
+                                break;
+                        case Frame_Ping:
+                                if (! (flags & FLAG_ACK)) {
+                                        _putFrame(H, Frame_Ping, FLAG_ACK, 0, H->frame, length);
+                                        _flush(H);
+                                }
+                                break;
+                        case Frame_GoAway:
+                                _processGoAway(H, length);
+                                break;
+                        case Frame_PushPromise:
+                                THROW(ProtocolException, "HTTP2 error: unexpected PUSH_PROMISE frame (server push was disabled)");
+                                break;
+                        default:
+                                // PRIORITY, WINDOW_UPDATE and unknown frames are ignored
+                                break;
+                }
+        }
+}
+
+
+static void _sendGoAway(Http2_T H) {
+        unsigned char payload[8];
+        _putUInt32(payload, 0);
+        _putUInt32(payload + 4, ERROR_NONE);
+        _putFrame(H, Frame_GoAway, 0, 0, payload, sizeof(payload));
+        // Best effort, the test result is known already
+        Socket_write(H->socket, H->output, H->outputLength);
+        H->outputLength = 0;
+}
+
+
+static void _checkStreams(Http2_T H) {
+        Port_T P = H->port;
+        StringBuffer_T sb = StringBuffer_create(64);
+        for (int i = 0; i < H->count; i++) {
+                Stream_T S = H->streams + i;
+                if (S->error >= 0) {
+                        StringBuffer_append(sb, "%s%s stream reset by the server -- %s", StringBuffer_length(sb) ? ", " : "", S->stream->request, _errorName(S->error));
+                        S->stream->response = -1.;
+                } else if (S->stream->status < 0) {
+                        StringBuffer_append(sb, "%s%s no response status", StringBuffer_length(sb) ? ", " : "", S->stream->request);
+                } else if (! Util_evalQExpression(P->parameters.http.operator, S->stream->status, P->parameters.http.hasStatus ? P->parameters.http.status : 400)) {
+                        StringBuffer_append(sb, "%s%s returned status %d", StringBuffer_length(sb) ? ", " : "", S->stream->request, S->stream->status);
+                } else {
+                        DEBUG("HTTP2: stream %u %s returned status %d in %.3f ms\n", S->id, S->stream->request, S->stream->status, S->stream->response);
+                }
+        }
+        if (StringBuffer_length(sb)) {
+                char error[STRLEN];
+                snprintf(error, sizeof(error), "%s", StringBuffer_toString(sb));
+                StringBuffer_free(&sb);
+                THROW(ProtocolException, "HTTP2 error: %s", error);
+        }
+        StringBuffer_free(&sb);
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+void check_http2(Socket_T socket) {
+        ASSERT(socket);
+
+        Port_T P = Socket_getPort(socket);
+        ASSERT(P);
+
+        Http2_T H;
+        NEW(H);
+        H->socket = socket;
+        H->port = P;
+        H->tableMaxSize = TABLESIZE;
+        for (Http2Stream_T s = P->parameters.http.streams; s; s = s->next)
+                H->count++;
+        H->open = H->count;
+        H->streams = CALLOC(H->count, sizeof(struct Stream_T));
+        int i = 0;
+        for (Http2Stream_T s = P->parameters.http.streams; s; s = s->next, i++) {
+                // The client initiated streams use odd identifiers
+                H->streams[i].id = 2 * i + 1;
+                H->streams[i].error = -1;
+                H->streams[i].stream = s;
+                s->status = -1;
+                s->response = -1.;
+        }
+        TRY
+        {
+                _sendRequests(H);
+                _receiveResponses(H);
+                _sendGoAway(H);
+                _checkStreams(H);
+        }
+        FINALLY
+        {
+                _tableEvict(H, 0);
+                FREE(H->streams);
+                FREE(H);
+        }
+        END_TRY;
+}
+
@@ -48,6 +48,8 @@
 #include "protocol.h"
 #include "md5.h"
 #include "sha1.h"
+#include "sha256.h"
+#include "xxh64.h"
 #include "checksum.h"
 
 // libmonit
@@ -181,6 +183,7 @@ typedef enum {
         MySQL_FetchRSAKey,
         MySQL_PasswordSent,
         MySQL_AuthSwitch,
+        MySQL_PingSent,
         MySQL_Ok,
         MySQL_Error
 } __attribute__((__packed__)) mysql_state_t;
@@ -621,6 +624,18 @@ static void _sendQuit(mysql_t *mysql) {
 }
 
 
+// COM_PING packet (see https://dev.mysql.com/doc/dev/mysql-server/latest/page_protocol_com_ping.html)
+static void _sendPing(mysql_t *mysql) {
+        if (mysql->state != MySQL_Ok)
+                THROW(ProtocolException, "Unexpected communication state %d before Ping", mysql->state);
+        mysql->sequence = 0;
+        _initRequest(mysql);
+        _setUInt1(&mysql->request, COM_PING);
+        _sendRequest(mysql, MySQL_PingSent);
+        DEBUG("MySQL PING sent\n");
+}
+
+
 static void _sendPassword(mysql_t *mysql, const unsigned char *password, int passwordLength) {
         if (mysql->state != MySQL_FullAuthenticationNeeded && mysql->state != MySQL_FetchRSAKey && mysql->state != MySQL_AuthSwitch)
                 THROW(ProtocolException, "Unexpected communication state %d before password exchange", mysql->state);
@@ -770,7 +785,31 @@ void check_mysql(Socket_T S) {
                                 _readResponse(&mysql);
                         }
                 }
-                _sendQuit(&mysql);
+                if (mysql.port->persistent) {
+                        if (mysql.state != MySQL_Ok)
+                                THROW(ProtocolException, "Unexpected communication state %d after login", mysql.state);
+                } else {
+                        _sendQuit(&mysql);
+                }
         }
 }
 
+
+/**
+ * Persistent connection liveness check: send COM_PING on the logged in connection and expect the OK packet.
+ *
+ *  @see https://dev.mysql.com/doc/dev/mysql-server/latest/page_protocol_com_ping.html
+ */
+void ping_mysql(Socket_T S) {
+        ASSERT(S);
+        mysql_t mysql = {
+                .state = MySQL_Ok,
+                .socket = S,
+                .port = Socket_getPort(S)
+        };
+        _sendPing(&mysql);
+        _readResponse(&mysql);
+        if (mysql.state != MySQL_Ok)
+                THROW(ProtocolException, "Invalid response to COM_PING -- state %d", mysql.state);
+}
+
@@ -39,40 +39,41 @@
 #include "protocol.h"
 
 static Protocol_T protocols[] = {
-        &(struct Protocol_T){"DEFAULT",         check_default},
-        &(struct Protocol_T){"HTTP",            check_http},
-        &(struct Protocol_T){"FTP",             check_ftp},
-        &(struct Protocol_T){"SMTP",            check_smtp},
-        &(struct Protocol_T){"POP",             check_pop},
-        &(struct Protocol_T){"IMAP",            check_imap},
-        &(struct Protocol_T){"NNTP",            check_nntp},
-        &(struct Protocol_T){"SSH",             check_ssh},
-        &(struct Protocol_T){"DWP",             check_dwp},
-        &(struct Protocol_T){"LDAP2",           check_ldap2},
-        &(struct Protocol_T){"LDAP3",           check_ldap3},
-        &(struct Protocol_T){"RDATE",           check_rdate},
-        &(struct Protocol_T){"RSYNC",           check_rsync},
-        &(struct Protocol_T){"generic",         check_generic},
-        &(struct Protocol_T){"APACHESTATUS",    check_apache_status},
-        &(struct Protocol_T){"NTP3",            check_ntp3},
-        &(struct Protocol_T){"MYSQL",           check_mysql},
-        &(struct Protocol_T){"DNS",             check_dns},
-        &(struct Protocol_T){"POSTFIX-POLICY",  check_postfix_policy},
-        &(struct Protocol_T){"TNS",             check_tns},
-        &(struct Protocol_T){"PGSQL",           check_pgsql},
-        &(struct Protocol_T){"CLAMAV",          check_clamav},
-        &(struct Protocol_T){"SIP",             check_sip},
-        &(struct Protocol_T){"LMTP",            check_lmtp},
-        &(struct Protocol_T){"GPS",             check_gps},
-        &(struct Protocol_T){"RADIUS",          check_radius},
-        &(struct Protocol_T){"MEMCACHE",        check_memcache},
-        &(struct Protocol_T){"WEBSOCKET",       check_websocket},
-        &(struct Protocol_T){"REDIS",           check_redis},
-        &(struct Protocol_T){"MONGODB",         check_mongodb},
-        &(struct Protocol_T){"SIEVE",           check_sieve},
-        &(struct Protocol_T){"SPAMASSASSIN",    check_spamassassin},
-        &(struct Protocol_T){"FAIL2BAN",        check_fail2ban},
-        &(struct Protocol_T){"MQTT",            check_mqtt}
+        &(struct Protocol_T){"DEFAULT",         check_default,         NULL},
+        &(struct Protocol_T){"HTTP",            check_http,            check_http},
+        &(struct Protocol_T){"FTP",             check_ftp,             NULL},
+        &(struct Protocol_T){"SMTP",            check_smtp,            NULL},
+        &(struct Protocol_T){"POP",             check_pop,             NULL},
+        &(struct Protocol_T){"IMAP",            check_imap,            NULL},
+        &(struct Protocol_T){"NNTP",            check_nntp,            NULL},
+        &(struct Protocol_T){"SSH",             check_ssh,             NULL},
+        &(struct Protocol_T){"DWP",             check_dwp,             NULL},
+        &(struct Protocol_T){"LDAP2",           check_ldap2,           NULL},
+        &(struct Protocol_T){"LDAP3",           check_ldap3,           NULL},
+        &(struct Protocol_T){"RDATE",           check_rdate,           NULL},
+        &(struct Protocol_T){"RSYNC",           check_rsync,           NULL},
+        &(struct Protocol_T){"generic",         check_generic,         NULL},
+        &(struct Protocol_T){"APACHESTATUS",    check_apache_status,   NULL},
+        &(struct Protocol_T){"NTP3",            check_ntp3,            NULL},
+        &(struct Protocol_T){"MYSQL",           check_mysql,           ping_mysql},
+        &(struct Protocol_T){"DNS",             check_dns,             NULL},
+        &(struct Protocol_T){"POSTFIX-POLICY",  check_postfix_policy,  NULL},
+        &(struct Protocol_T){"TNS",             check_tns,             NULL},
+        &(struct Protocol_T){"PGSQL",           check_pgsql,           NULL},
+        &(struct Protocol_T){"CLAMAV",          check_clamav,          NULL},
+        &(struct Protocol_T){"SIP",             check_sip,             NULL},
+        &(struct Protocol_T){"LMTP",            check_lmtp,            NULL},
+        &(struct Protocol_T){"GPS",             check_gps,             NULL},
+        &(struct Protocol_T){"RADIUS",          check_radius,          NULL},
+        &(struct Protocol_T){"MEMCACHE",        check_memcache,        check_memcache},
+        &(struct Protocol_T){"WEBSOCKET",       check_websocket,       NULL},
+        &(struct Protocol_T){"REDIS",           check_redis,           ping_redis},
+        &(struct Protocol_T){"MONGODB",         check_mongodb,         NULL},
+        &(struct Protocol_T){"SIEVE",           check_sieve,           NULL},
+        &(struct Protocol_T){"SPAMASSASSIN",    check_spamassassin,    NULL},
+        &(struct Protocol_T){"FAIL2BAN",        check_fail2ban,        NULL},
+        &(struct Protocol_T){"MQTT",            check_mqtt,            NULL},
+        &(struct Protocol_T){"HTTP2",           check_http2,           NULL}
 };
 
 
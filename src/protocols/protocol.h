@@ -65,7 +65,8 @@ typedef enum {
         Protocol_SIEVE,
         Protocol_SPAMASSASSIN,
         Protocol_FAIL2BAN,
-        Protocol_MQTT
+        Protocol_MQTT,
+        Protocol_HTTP2
 } Protocol_Type;
 
 
@@ -77,6 +78,7 @@ void check_fail2ban(Socket_T);
 void check_ftp(Socket_T);
 void check_generic(Socket_T);
 void check_http(Socket_T);
+void check_http2(Socket_T);
 void check_imap(Socket_T);
 void check_clamav(Socket_T);
 void check_ldap2(Socket_T);
@@ -105,6 +107,10 @@ void check_mqtt(Socket_T);
 void check_websocket(Socket_T);
 
 
+void ping_mysql(Socket_T);
+void ping_redis(Socket_T);
+
+
 /*
  * Returns a protocol object for the given protocol type
  */
@@ -39,6 +39,8 @@
 
 #include "md5.h"
 #include "sha1.h"
+#include "sha256.h"
+#include "xxh64.h"
 #include "checksum.h"
 #include "protocol.h"
 
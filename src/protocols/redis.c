@@ -31,6 +31,21 @@
 #include "exceptions/ProtocolException.h"
 
 
+/* -------------------------------------------------------------- Private */
+
+
+static void _ping(Socket_T socket) {
+        char buf[STRLEN];
+        if (Socket_print(socket, "*1\r\n$4\r\nPING\r\n") < 0)
+                THROW(IOException, "REDIS: PING command error -- %s", STRERROR);
+        if (! Socket_readLine(socket, buf, sizeof(buf)))
+                THROW(IOException, "REDIS: PING response error -- %s", STRERROR);
+        Str_chomp(buf);
+        if (! Str_isEqual(buf, "+PONG") && ! Str_startsWith(buf, "-NOAUTH")) // We accept authentication error (-NOAUTH Authentication required): redis responded to request, but requires authentication => we assume it works
+                THROW(ProtocolException, "REDIS: PING error -- %s", buf);
+}
+
+
 /* --------------------------------------------------------------- Public */
 
 
@@ -39,7 +54,7 @@
  *
  *     1. send a PING command
  *     2. expect a PONG response
- *     3. send a QUIT command
+ *     3. send a QUIT command (unless the connection is persistent)
  *
  * @see http://redis.io/topics/protocol
  *
@@ -47,16 +62,19 @@
  */
 void check_redis(Socket_T socket) {
         ASSERT(socket);
-        char buf[STRLEN];
+        _ping(socket);
+        Port_T P = Socket_getPort(socket);
+        if (! (P && P->persistent))
+                if (Socket_print(socket, "*1\r\n$4\r\nQUIT\r\n") < 0)
+                        THROW(IOException, "REDIS: QUIT command error -- %s", STRERROR);
+}
 
-        if (Socket_print(socket, "*1\r\n$4\r\nPING\r\n") < 0)
-                THROW(IOException, "REDIS: PING command error -- %s", STRERROR);
-        if (! Socket_readLine(socket, buf, sizeof(buf)))
-                THROW(IOException, "REDIS: PING response error -- %s", STRERROR);
-        Str_chomp(buf);
-        if (! Str_isEqual(buf, "+PONG") && ! Str_startsWith(buf, "-NOAUTH")) // We accept authentication error (-NOAUTH Authentication required): redis responded to request, but requires authentication => we assume it works
-                THROW(ProtocolException, "REDIS: PING error -- %s", buf);
-        if (Socket_print(socket, "*1\r\n$4\r\nQUIT\r\n") < 0)
-                THROW(IOException, "REDIS: QUIT command error -- %s", STRERROR);
+
+/**
+ * Persistent connection liveness check: PING/PONG on the open connection
+ */
+void ping_redis(Socket_T socket) {
+        ASSERT(socket);
+        _ping(socket);
 }
 
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+/* SHA-256 as specified in FIPS 180-4 */
+
+#include "config.h"
+
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+#include "sha256.h"
+
+#define ror(value, bits) (((value) >> (bits)) | ((value) << (32 - (bits))))
+
+#define CH(x,y,z)  (((x) & (y)) ^ (~(x) & (z)))
+#define MAJ(x,y,z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define EP0(x)     (ror(x,2) ^ ror(x,13) ^ ror(x,22))
+#define EP1(x)     (ror(x,6) ^ ror(x,11) ^ ror(x,25))
+#define SIG0(x)    (ror(x,7) ^ ror(x,18) ^ ((x) >> 3))
+#define SIG1(x)    (ror(x,17) ^ ror(x,19) ^ ((x) >> 10))
+
+
+static const unsigned int k[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+
+/* Hash a single 512-bit block */
+static void sha256_transform(unsigned int state[8], const unsigned char data[64]) {
+        unsigned int a, b, c, d, e, f, g, h, t1, t2, m[64];
+        int i;
+
+        for (i = 0; i < 16; i++)
+                m[i] = ((unsigned int)data[i * 4] << 24) | ((unsigned int)data[i * 4 + 1] << 16) | ((unsigned int)data[i * 4 + 2] << 8) | (unsigned int)data[i * 4 + 3];
+        for (; i < 64; i++)
+                m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+
+        a = state[0];
+        b = state[1];
+        c = state[2];
+        d = state[3];
+        e = state[4];
+        f = state[5];
+        g = state[6];
+        h = state[7];
+
+        for (i = 0; i < 64; i++) {
+                t1 = h + EP1(e) + CH(e, f, g) + k[i] + m[i];
+                t2 = EP0(a) + MAJ(a, b, c);
+                h = g;
+                g = f;
+                f = e;
+                e = d + t1;
+                d = c;
+                c = b;
+                b = a;
+                a = t1 + t2;
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+}
+
+
+/* Initialize new context */
+void sha256_init(sha256_context_t *context) {
+        context->state[0] = 0x6a09e667;
+        context->state[1] = 0xbb67ae85;
+        context->state[2] = 0x3c6ef372;
+        context->state[3] = 0xa54ff53a;
+        context->state[4] = 0x510e527f;
+        context->state[5] = 0x9b05688c;
+        context->state[6] = 0x1f83d9ab;
+        context->state[7] = 0x5be0cd19;
+        context->count = 0;
+}
+
+
+/* Run your data through this. */
+void sha256_append(sha256_context_t *context, const unsigned char *data, const size_t len) {
+        size_t i = 0, j = (size_t)(context->count & 63);
+
+        context->count += len;
+        if (j + len > 63) {
+                memcpy(&context->buffer[j], data, (i = 64 - j));
+                sha256_transform(context->state, context->buffer);
+                for (; i + 63 < len; i += 64)
+                        sha256_transform(context->state, data + i);
+                j = 0;
+        }
+        memcpy(&context->buffer[j], &data[i], len - i);
+}
+
+
+/* Add padding and return the message digest. */
+void sha256_finish(sha256_context_t *context, unsigned char digest[SHA256_DIGEST_SIZE]) {
+        unsigned char finalcount[8];
+        unsigned long long bits = context->count << 3;
+        int i;
+
+        for (i = 0; i < 8; i++)
+                finalcount[i] = (unsigned char)(bits >> ((7 - i) * 8));
+        sha256_append(context, (unsigned char *)"\200", 1);
+        while ((context->count & 63) != 56)
+                sha256_append(context, (unsigned char *)"\0", 1);
+        sha256_append(context, finalcount, 8); /* Should cause a sha256_transform() */
+        for (i = 0; i < SHA256_DIGEST_SIZE; i++)
+                digest[i] = (unsigned char)(context->state[i >> 2] >> ((3 - (i & 3)) * 8));
+
+        /* Wipe variables */
+        memset(context, 0, sizeof(*context));
+}
+
@@ -72,6 +72,7 @@
 #include <openssl/crypto.h>
 #include <openssl/x509.h>
 #include <openssl/x509_vfy.h>
+#include <openssl/x509v3.h>
 #include <openssl/pem.h>
 #include <openssl/ssl.h>
 #include <openssl/err.h>
@@ -121,6 +122,48 @@
 #define SSLERROR ERR_error_string(ERR_get_error(),NULL)
 
 
+#if (OPENSSL_VERSION_NUMBER < 0x10100000L) && ! defined(LIBRESSL_VERSION_NUMBER)
+#define ASN1_STRING_get0_data ASN1_STRING_data
+#endif
+
+
+// Interval between full handshakes to the same server which refresh the cached certificate information [s]
+#define CERTIFICATE_REFRESH 3600
+
+// Maximum number of servers with a cached session per context, the least recently used server is evicted
+#define SESSION_CACHE_MAX 256
+
+
+/**
+ * The client contexts are shared by all connections with the same options, loading of
+ * the CA certificates is thus done once. Each context keeps the last session per server
+ * for TLS resumption (session ID or ticket) and the server certificate information from
+ * the last full handshake. The session is offered only while the certificate information
+ * is fresh, so the certificate is verified and inspected again every CERTIFICATE_REFRESH
+ * seconds, while the checks in between use the cached information. A session is dropped
+ * when it expires, at most SESSION_CACHE_MAX servers are cached per context.
+ */
+typedef struct SslSession_T {
+        char *key;
+        SSL_SESSION *session;
+        time_t used;                               // Last use of the entry
+        struct {
+                time_t inspected;                  // Time of the last full handshake
+                time_t notAfter;                   // Certificate expiry
+        } certificate;
+        struct SslSession_T *next;
+} *SslSession_T;
+
+
+typedef struct SslContext_T {
+        char *key;
+        SSL_CTX *ctx;
+        int sessionsCount;
+        SslSession_T sessions;
+        struct SslContext_T *next;
+} *SslContext_T;
+
+
 #define T Ssl_T
 struct T {
         bool accepted;
@@ -129,6 +172,8 @@ struct T {
         SSL *handler;
         SSL_CTX *ctx;
         X509 *certificate;
+        time_t notAfter;
+        char *session;
         char error[128];
 };
 
@@ -148,6 +193,12 @@ static Mutex_T *instanceMutexTable;
 static int session_id_context = 1;
 
 
+static struct {
+        Mutex_T mutex;
+        SslContext_T list;
+} _contexts = {.mutex = PTHREAD_MUTEX_INITIALIZER};
+
+
 /* ----------------------------------------------------------------- Private */
 
 
@@ -467,16 +518,46 @@ static bool _setServerNameIdentification(T C, const char *hostname) {
 }
 
 
-static bool _setClientCertificate(T C, const char *file) {
-        if (SSL_CTX_use_certificate_chain_file(C->ctx, file) != 1) {
+static void _setApplicationProtocol(T C) {
+        if (C->options->alpn) {
+#if OPENSSL_VERSION_NUMBER >= 0x10002000L
+                // ALPN protocol list in the wire format: length prefixed protocol name
+                unsigned char protocols[256];
+                size_t length = strlen(C->options->alpn);
+                protocols[0] = (unsigned char)length;
+                memcpy(protocols + 1, C->options->alpn, length);
+                if (SSL_set_alpn_protos(C->handler, protocols, (unsigned int)length + 1) != 0)
+                        THROW(IOException, "SSL: unable to set the ALPN extension to %s", C->options->alpn);
+#else
+                THROW(IOException, "SSL: the ALPN extension is not supported by the OpenSSL library");
+#endif
+        }
+}
+
+
+static void _checkApplicationProtocol(T C) {
+#if OPENSSL_VERSION_NUMBER >= 0x10002000L
+        if (C->options->alpn) {
+                const unsigned char *protocol = NULL;
+                unsigned int length = 0;
+                SSL_get0_alpn_selected(C->handler, &protocol, &length);
+                if (! protocol || length != strlen(C->options->alpn) || memcmp(protocol, C->options->alpn, length))
+                        THROW(IOException, "SSL: the server doesn't support the %s application protocol", C->options->alpn);
+        }
+#endif
+}
+
+
+static bool _setClientCertificate(SSL_CTX *ctx, const char *file) {
+        if (SSL_CTX_use_certificate_chain_file(ctx, file) != 1) {
                 Log_error("SSL client certificate chain loading failed: %s\n", SSLERROR);
                 return false;
         }
-        if (SSL_CTX_use_PrivateKey_file(C->ctx, file, SSL_FILETYPE_PEM) != 1) {
+        if (SSL_CTX_use_PrivateKey_file(ctx, file, SSL_FILETYPE_PEM) != 1) {
                 Log_error("SSL client private key loading failed: %s\n", SSLERROR);
                 return false;
         }
-        if (SSL_CTX_check_private_key(C->ctx) != 1) {
+        if (SSL_CTX_check_private_key(ctx) != 1) {
                 Log_error("SSL client private key doesn't match the certificate: %s\n", SSLERROR);
                 return false;
         }
@@ -484,6 +565,323 @@ static bool _setClientCertificate(T C, const char *file) {
 }
 
 
+static void _retainContext(SSL_CTX *ctx) {
+#if (OPENSSL_VERSION_NUMBER < 0x10100000L) && ! defined(LIBRESSL_VERSION_NUMBER)
+        CRYPTO_add(&ctx->references, 1, CRYPTO_LOCK_SSL_CTX);
+#else
+        SSL_CTX_up_ref(ctx);
+#endif
+}
+
+
+static SslContext_T _findContext(SSL_CTX *ctx) {
+        for (SslContext_T context = _contexts.list; context; context = context->next)
+                if (context->ctx == ctx)
+                        return context;
+        return NULL;
+}
+
+
+static SslSession_T _findSession(SslContext_T context, const char *key) {
+        for (SslSession_T session = context->sessions; session; session = session->next)
+                if (Str_isByteEqual(session->key, key))
+                        return session;
+        return NULL;
+}
+
+
+static void _freeSession(SslSession_T *session) {
+        if ((*session)->session)
+                SSL_SESSION_free((*session)->session);
+        FREE((*session)->key);
+        FREE(*session);
+}
+
+
+static void _dropSession(SslContext_T context, SslSession_T session) {
+        for (SslSession_T *s = &(context->sessions); *s; s = &((*s)->next)) {
+                if (*s == session) {
+                        *s = session->next;
+                        context->sessionsCount--;
+                        _freeSession(&session);
+                        return;
+                }
+        }
+}
+
+
+static SslSession_T _getSession(SslContext_T context, const char *key) {
+        SslSession_T session = _findSession(context, key);
+        if (! session) {
+                if (context->sessionsCount >= SESSION_CACHE_MAX) {
+                        SslSession_T lru = context->sessions;
+                        for (SslSession_T s = context->sessions; s; s = s->next)
+                                if (s->used < lru->used)
+                                        lru = s;
+                        _dropSession(context, lru);
+                }
+                NEW(session);
+                session->key = Str_dup(key);
+                session->next = context->sessions;
+                context->sessions = session;
+                context->sessionsCount++;
+        }
+        session->used = Time_now();
+        return session;
+}
+
+
+// Called by OpenSSL when the server sent a new session (for TLSv1.3 the ticket may arrive after the handshake)
+static int _newSession(SSL *ssl, SSL_SESSION *session) {
+        int rv = 0;
+        T C = SSL_get_app_data(ssl);
+        if (C && C->session) {
+                LOCK(_contexts.mutex)
+                {
+                        SslContext_T context = _findContext(SSL_get_SSL_CTX(ssl));
+                        if (context) {
+                                SslSession_T s = _getSession(context, C->session);
+                                if (s->session)
+                                        SSL_SESSION_free(s->session);
+                                s->session = session;
+                                rv = 1; // We keep the session reference
+                        }
+                }
+                END_LOCK;
+        }
+        return rv;
+}
+
+
+static void _setSession(T C, const char *name) {
+        struct sockaddr_storage addr;
+        socklen_t addrlen = sizeof(addr);
+        char host[NI_MAXHOST], port[NI_MAXSERV];
+        if (getpeername(C->socket, (struct sockaddr *)&addr, &addrlen) == 0 && getnameinfo((struct sockaddr *)&addr, addrlen, host, sizeof(host), port, sizeof(port), NI_NUMERICHOST | NI_NUMERICSERV) == 0) {
+                FREE(C->session);
+                C->session = Str_cat("%s@[%s]:%s", name ? name : "", host, port);
+                LOCK(_contexts.mutex)
+                {
+                        SslContext_T context = _findContext(C->ctx);
+                        if (context) {
+                                SslSession_T s = _findSession(context, C->session);
+                                if (s && s->session) {
+                                        time_t now = Time_now();
+                                        if (SSL_SESSION_get_time(s->session) + SSL_SESSION_get_timeout(s->session) <= now) {
+                                                // The server would reject the expired session anyway
+                                                _dropSession(context, s);
+                                        } else if (now - s->certificate.inspected < CERTIFICATE_REFRESH) {
+                                                SSL_set_session(C->handler, s->session);
+                                                C->notAfter = s->certificate.notAfter;
+                                                s->used = now;
+                                        }
+                                }
+                        }
+                }
+                END_LOCK;
+        }
+}
+
+
+static void _removeSession(T C) {
+        if (C->session) {
+                LOCK(_contexts.mutex)
+                {
+                        SslContext_T context = _findContext(C->ctx);
+                        if (context) {
+                                SslSession_T s = _findSession(context, C->session);
+                                if (s)
+                                        _dropSession(context, s);
+                        }
+                }
+                END_LOCK;
+        }
+}
+
+
+static time_t _getNotAfter(X509 *certificate) {
+#ifdef HAVE_ASN1_TIME_DIFF
+        int deltadays, deltaseconds;
+#if (OPENSSL_VERSION_NUMBER < 0x10100000L) || defined(LIBRESSL_VERSION_NUMBER)
+        if (! ASN1_TIME_diff(&deltadays, &deltaseconds, NULL, X509_get_notAfter(certificate))) {
+#else
+        if (! ASN1_TIME_diff(&deltadays, &deltaseconds, NULL, X509_get0_notAfter(certificate))) {
+#endif
+                THROW(IOException, "invalid time format in certificate's notAfter field");
+        }
+        return Time_now() + (time_t)deltadays * 86400 + deltaseconds;
+#else
+        volatile time_t notAfter = 0;
+        ASN1_GENERALIZEDTIME *t = ASN1_TIME_to_generalizedtime(X509_get_notAfter(certificate), NULL);
+        if (! t) {
+                THROW(IOException, "invalid time format (in certificate's notAfter field)");
+        }
+        TRY
+        {
+                notAfter = Time_toTimestamp((const char *)t->data);
+        }
+        ELSE
+        {
+                THROW(IOException, "invalid time format in certificate's notAfter field -- %s", t->data);
+        }
+        FINALLY
+        {
+                ASN1_STRING_free(t);
+        }
+        END_TRY;
+        return notAfter;
+#endif
+}
+
+
+static char *_getSubjectAltNames(X509 *certificate) {
+        StringBuffer_T sb = StringBuffer_create(64);
+        GENERAL_NAMES *names = X509_get_ext_d2i(certificate, NID_subject_alt_name, NULL, NULL);
+        if (names) {
+                for (int i = 0; i < sk_GENERAL_NAME_num(names); i++) {
+                        GENERAL_NAME *name = sk_GENERAL_NAME_value(names, i);
+                        if (name->type == GEN_DNS) {
+                                StringBuffer_append(sb, "%s%.*s", StringBuffer_length(sb) ? ", " : "", ASN1_STRING_length(name->d.dNSName), (const char *)ASN1_STRING_get0_data(name->d.dNSName));
+                        } else if (name->type == GEN_IPADD) {
+                                char ip[INET6_ADDRSTRLEN] = {};
+                                int length = ASN1_STRING_length(name->d.iPAddress);
+                                if (length == 4 || length == 16)
+                                        inet_ntop(length == 4 ? AF_INET : AF_INET6, ASN1_STRING_get0_data(name->d.iPAddress), ip, sizeof(ip));
+                                StringBuffer_append(sb, "%s%s", StringBuffer_length(sb) ? ", " : "", ip);
+                        }
+                }
+                GENERAL_NAMES_free(names);
+        }
+        char *result = Str_dup(StringBuffer_toString(sb));
+        StringBuffer_free(&sb);
+        return result;
+}
+
+
+// Cache the server certificate information after full handshake
+static void _inspectCertificate(T C) {
+        if (C->session && C->certificate) {
+                volatile time_t notAfter = 0;
+                TRY
+                {
+                        notAfter = _getNotAfter(C->certificate);
+                }
+                ELSE
+                {
+                        DEBUG("SSL: cannot inspect the server certificate -- %s\n", Exception_frame.message);
+                }
+                END_TRY;
+                if (notAfter) {
+                        if (Run.debug) {
+                                STACK_OF(X509) *chain = SSL_get_peer_cert_chain(C->handler);
+                                char *subjectAltNames = _getSubjectAltNames(C->certificate);
+                                DEBUG("SSL: server certificate for %s valid until %s, chain length %d, subject alternative names: %s\n", C->session, Time_string(notAfter, (char[32]){}), chain ? sk_X509_num(chain) : 0, subjectAltNames);
+                                FREE(subjectAltNames);
+                        }
+                        LOCK(_contexts.mutex)
+                        {
+                                SslContext_T context = _findContext(C->ctx);
+                                if (context) {
+                                        SslSession_T s = _getSession(context, C->session);
+                                        s->certificate.inspected = Time_now();
+                                        s->certificate.notAfter = notAfter;
+                                }
+                        }
+                        END_LOCK;
+                }
+        }
+}
+
+
+static SSL_CTX *_createContext(SslOptions_T options) {
+#if (OPENSSL_VERSION_NUMBER < 0x10100000L) || defined(LIBRESSL_VERSION_NUMBER)
+        const SSL_METHOD *method = SSLv23_client_method();
+#else
+        const SSL_METHOD *method = TLS_client_method();
+#endif
+        if (! method) {
+                Log_error("SSL: client method initialization failed -- %s\n", SSLERROR);
+                return NULL;
+        }
+        SSL_CTX *ctx = SSL_CTX_new(method);
+        if (! ctx) {
+                Log_error("SSL: client context initialization failed -- %s\n", SSLERROR);
+                return NULL;
+        }
+        if (! _setVersion(ctx, options)) {
+                goto sslerror;
+        }
+        SSL_CTX_set_default_verify_paths(ctx);
+        const char *CACertificateFile = _optionsCACertificateFile(options->CACertificateFile);
+        const char *CACertificatePath = _optionsCACertificatePath(options->CACertificatePath);
+        if (CACertificateFile || CACertificatePath) {
+                if (! SSL_CTX_load_verify_locations(ctx, CACertificateFile, CACertificatePath)) {
+                        Log_error("SSL: CA certificates loading failed -- %s\n", SSLERROR);
+                        goto sslerror;
+                }
+        }
+        const char *ClientPEMFile = _optionsClientPEMFile(options->clientpemfile);
+        if (ClientPEMFile && ! _setClientCertificate(ctx, ClientPEMFile))
+                goto sslerror;
+#ifdef SSL_OP_NO_COMPRESSION
+        SSL_CTX_set_options(ctx, SSL_OP_NO_COMPRESSION);
+#endif
+        const char *ciphers = _optionsCiphers(options->ciphers);
+        if (SSL_CTX_set_cipher_list(ctx, ciphers) != 1) {
+                Log_error("SSL: client cipher list [%s] error -- no valid ciphers\n", ciphers);
+                goto sslerror;
+        }
+        SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+        SSL_CTX_sess_set_new_cb(ctx, _newSession);
+        return ctx;
+sslerror:
+        SSL_CTX_free(ctx);
+        return NULL;
+}
+
+
+/**
+ * Get the shared client context for the given options. The caller owns a reference to the context
+ */
+static SSL_CTX *_getContext(SslOptions_T options) {
+        SSL_CTX *ctx = NULL;
+        char *key = Str_cat("%d:%d:%d:%d:%s:%s:%s:%s:%s",
+                            _optionsVersion(options->version),
+                            _optionsVerify(options->verify),
+                            _optionsAllowSelfSigned(options->allowSelfSigned),
+                            _optionsChecksumType(options->checksumType),
+                            NVLSTR(_optionsChecksum(options->checksum)),
+                            NVLSTR(_optionsClientPEMFile(options->clientpemfile)),
+                            NVLSTR(_optionsCiphers(options->ciphers)),
+                            NVLSTR(_optionsCACertificateFile(options->CACertificateFile)),
+                            NVLSTR(_optionsCACertificatePath(options->CACertificatePath)));
+        LOCK(_contexts.mutex)
+        {
+                SslContext_T context = _contexts.list;
+                while (context && ! Str_isByteEqual(context->key, key))
+                        context = context->next;
+                if (! context) {
+                        SSL_CTX *created = _createContext(options);
+                        if (created) {
+                                NEW(context);
+                                context->key = key;
+                                key = NULL;
+                                context->ctx = created;
+                                context->next = _contexts.list;
+                                _contexts.list = context;
+                        }
+                }
+                if (context) {
+                        ctx = context->ctx;
+                        _retainContext(ctx);
+                }
+        }
+        END_LOCK;
+        FREE(key);
+        return ctx;
+}
+
+
 /* ------------------------------------------------------------------ Public */
 
 
@@ -517,10 +915,31 @@ void Ssl_stop() {
         RAND_cleanup();
         ERR_free_strings();
 #endif
+        Ssl_reset();
         Ssl_threadCleanup();
 }
 
 
+void Ssl_reset() {
+        LOCK(_contexts.mutex)
+        {
+                while (_contexts.list) {
+                        SslContext_T context = _contexts.list;
+                        _contexts.list = context->next;
+                        while (context->sessions) {
+                                SslSession_T session = context->sessions;
+                                context->sessions = session->next;
+                                _freeSession(&session);
+                        }
+                        SSL_CTX_free(context->ctx); // The connections which are still open hold their own reference
+                        FREE(context->key);
+                        FREE(context);
+                }
+        }
+        END_LOCK;
+}
+
+
 void Ssl_threadCleanup() {
 #if (OPENSSL_VERSION_NUMBER < 0x10100000L) || defined(LIBRESSL_VERSION_NUMBER)
         ERR_remove_thread_state(NULL);
@@ -543,40 +962,7 @@ T Ssl_new(SslOptions_T options) {
         T C;
         NEW(C);
         C->options = options;
-#if (OPENSSL_VERSION_NUMBER < 0x10100000L) || defined(LIBRESSL_VERSION_NUMBER)
-        const SSL_METHOD *method = SSLv23_client_method();
-#else
-        const SSL_METHOD *method = TLS_client_method();
-#endif
-        if (! method) {
-                Log_error("SSL: client method initialization failed -- %s\n", SSLERROR);
-                goto sslerror;
-        }
-        if (! (C->ctx = SSL_CTX_new(method))) {
-                Log_error("SSL: client context initialization failed -- %s\n", SSLERROR);
-                goto sslerror;
-        }
-        if (! _setVersion(C->ctx, options)) {
-                goto sslerror;
-        }
-        SSL_CTX_set_default_verify_paths(C->ctx);
-        const char *CACertificateFile = _optionsCACertificateFile(options->CACertificateFile);
-        const char *CACertificatePath = _optionsCACertificatePath(options->CACertificatePath);
-        if (CACertificateFile || CACertificatePath) {
-                if (! SSL_CTX_load_verify_locations(C->ctx, CACertificateFile, CACertificatePath)) {
-                        Log_error("SSL: CA certificates loading failed -- %s\n", SSLERROR);
-                        goto sslerror;
-                }
-        }
-        const char *ClientPEMFile = _optionsClientPEMFile(options->clientpemfile);
-        if (ClientPEMFile && ! _setClientCertificate(C, ClientPEMFile))
-                goto sslerror;
-#ifdef SSL_OP_NO_COMPRESSION
-        SSL_CTX_set_options(C->ctx, SSL_OP_NO_COMPRESSION);
-#endif
-        const char *ciphers = _optionsCiphers(options->ciphers);
-        if (SSL_CTX_set_cipher_list(C->ctx, ciphers) != 1) {
-                Log_error("SSL: client cipher list [%s] error -- no valid ciphers\n", ciphers);
+        if (! (C->ctx = _getContext(options))) {
                 goto sslerror;
         }
         if (! (C->handler = SSL_new(C->ctx))) {
@@ -599,6 +985,7 @@ void Ssl_free(T *C) {
                 SSL_free((*C)->handler);
         if ((*C)->ctx && ! (*C)->accepted)
                 SSL_CTX_free((*C)->ctx);
+        FREE((*C)->session);
         FREE(*C);
 }
 
@@ -642,6 +1029,8 @@ void Ssl_connect(T C, int socket, int timeout, const char *name) {
         SSL_set_connect_state(C->handler);
         SSL_set_fd(C->handler, C->socket);
         _setServerNameIdentification(C, name);
+        _setSession(C, name);
+        _setApplicationProtocol(C);
         bool retry = false;
         do {
                 int rv = SSL_connect(C->handler);
@@ -656,6 +1045,7 @@ void Ssl_connect(T C, int socket, int timeout, const char *name) {
                                         retry = _retry(C->socket, &timeout, Net_canWrite);
                                         break;
                                 default:
+                                        _removeSession(C);
 					rv = (int)SSL_get_verify_result(C->handler);
 					if (rv != X509_V_OK)
                                                 THROW(IOException, "SSL server certificate verification error: %s", *C->error ? C->error : X509_verify_cert_error_string(rv));
@@ -667,6 +1057,14 @@ void Ssl_connect(T C, int socket, int timeout, const char *name) {
                         break;
                 }
         } while (retry);
+        _checkApplicationProtocol(C);
+        if (SSL_session_reused(C->handler)) {
+                // The verification callback is not called for resumed session, the certificate expiry is taken from the cache
+                DEBUG("SSL: session resumed\n");
+        } else {
+                C->notAfter = 0;
+                _inspectCertificate(C);
+        }
 }
 
 
@@ -753,38 +1151,13 @@ int Ssl_read(T C, void *b, int size, int timeout) {
 
 
 int Ssl_getCertificateValidDays(T C) {
-        if (C && C->certificate) {
+        if (C) {
                 // Certificates which expired already are caught in preverify => we don't need to handle them here
-                volatile int deltadays = 0;
-#ifdef HAVE_ASN1_TIME_DIFF
-                int deltaseconds;
-#if (OPENSSL_VERSION_NUMBER < 0x10100000L) || defined(LIBRESSL_VERSION_NUMBER)
-                if (! ASN1_TIME_diff((int *)&deltadays, &deltaseconds, NULL, X509_get_notAfter(C->certificate))) {
-#else
-                if (! ASN1_TIME_diff((int *)&deltadays, &deltaseconds, NULL, X509_get0_notAfter(C->certificate))) {
-#endif
-                        THROW(IOException, "invalid time format in certificate's notAfter field");
+                time_t notAfter = C->certificate ? _getNotAfter(C->certificate) : C->notAfter;
+                if (notAfter > 0) {
+                        int deltadays = (int)((notAfter - Time_now()) / 86400);
+                        return deltadays > 0 ? deltadays : 0;
                 }
-#else
-                ASN1_GENERALIZEDTIME *t = ASN1_TIME_to_generalizedtime(X509_get_notAfter(C->certificate), NULL);
-                if (! t) {
-                        THROW(IOException, "invalid time format (in certificate's notAfter field)");
-                }
-                TRY
-                {
-                        deltadays = (double)(Time_toTimestamp((const char *)t->data) - Time_now()) / 86400.;
-                }
-                ELSE
-                {
-                        THROW(IOException, "invalid time format in certificate's notAfter field -- %s", t->data);
-                }
-                FINALLY
-                {
-                        ASN1_STRING_free(t);
-                }
-                END_TRY;
-#endif
-                return deltadays > 0 ? deltadays : 0;
         }
         return -1;
 }
@@ -61,6 +61,7 @@ typedef struct SslOptions_T {
         char *ciphers;                               /**< Allowed SSL ciphers list */
         char *CACertificateFile;             /**< Path to CA certificates PEM file */
         char *CACertificatePath;            /**< Path to CA certificates directory */
+        const char *alpn;            /**< Application protocol to negotiate (ALPN) */
 } *SslOptions_T;
 
 
@@ -101,6 +102,13 @@ void Ssl_setFipsMode(bool enabled);
 #endif
 
 
+/**
+ * Drop the cached client contexts and TLS sessions. The contexts are
+ * created again on demand, so changed CA certificates are reloaded.
+ */
+void Ssl_reset(void);
+
+
 /**
  * Create a new SSL connection object
  * @param options SSL options
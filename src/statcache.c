@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#include "config.h"
+
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+
+#ifdef HAVE_SYS_SYSMACROS_H
+#include <sys/sysmacros.h>
+#endif
+
+#include "monit.h"
+#include "statcache.h"
+
+
+/**
+ * The cache is a small chained hash table keyed by path and the "follow
+ * symlinks" flag. Failed lookups are cached too, so a missing file is
+ * stat'ed once per cycle regardless of how many services test it.
+ *
+ * @file
+ */
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+#define BUCKETS 256
+
+
+typedef struct Entry_T {
+        char *path;
+        bool follow;
+        int error;
+        struct stat sb;
+        struct Entry_T *next;
+} *Entry_T;
+
+
+static struct {
+        bool active;
+        int lookups;
+        int syscalls;
+        Entry_T table[BUCKETS];
+} cache = {};
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+static unsigned int _hash(const char *path) {
+        unsigned int h = 5381;
+        while (*path)
+                h = h * 33 + (unsigned char)*path++;
+        return h % BUCKETS;
+}
+
+
+// Fetch the status with the smallest field mask we need. The statx() is used if available, with fallback to stat()/lstat() if the kernel doesn't support it
+static int _stat(const char *path, bool follow, struct stat *sb) {
+        cache.syscalls++;
+#ifdef STATX_BASIC_STATS
+        static bool statxUnsupported = false;
+        if (! statxUnsupported) {
+                struct statx stx;
+                if (statx(AT_FDCWD, path, AT_STATX_SYNC_AS_STAT | (follow ? 0 : AT_SYMLINK_NOFOLLOW), STATX_TYPE | STATX_MODE | STATX_UID | STATX_GID | STATX_INO | STATX_SIZE | STATX_ATIME | STATX_MTIME | STATX_CTIME, &stx) == 0) {
+                        memset(sb, 0, sizeof(struct stat));
+                        sb->st_dev = makedev(stx.stx_dev_major, stx.stx_dev_minor);
+                        sb->st_rdev = makedev(stx.stx_rdev_major, stx.stx_rdev_minor);
+                        sb->st_ino = stx.stx_ino;
+                        sb->st_mode = stx.stx_mode;
+                        sb->st_uid = stx.stx_uid;
+                        sb->st_gid = stx.stx_gid;
+                        sb->st_size = stx.stx_size;
+                        sb->st_atim.tv_sec = stx.stx_atime.tv_sec;
+                        sb->st_atim.tv_nsec = stx.stx_atime.tv_nsec;
+                        sb->st_mtim.tv_sec = stx.stx_mtime.tv_sec;
+                        sb->st_mtim.tv_nsec = stx.stx_mtime.tv_nsec;
+                        sb->st_ctim.tv_sec = stx.stx_ctime.tv_sec;
+                        sb->st_ctim.tv_nsec = stx.stx_ctime.tv_nsec;
+                        return 0;
+                } else if (errno != ENOSYS) {
+                        return -1;
+                }
+                statxUnsupported = true;
+        }
+#endif
+        return follow ? stat(path, sb) : lstat(path, sb);
+}
+
+
+static int _lookup(const char *path, bool follow, struct stat *sb) {
+        ASSERT(path);
+        ASSERT(sb);
+        if (! cache.active)
+                return follow ? stat(path, sb) : lstat(path, sb);
+        cache.lookups++;
+        unsigned int h = _hash(path);
+        for (Entry_T e = cache.table[h]; e; e = e->next) {
+                if (e->follow == follow && Str_isEqual(e->path, path)) {
+                        if (e->error) {
+                                errno = e->error;
+                                return -1;
+                        }
+                        *sb = e->sb;
+                        return 0;
+                }
+        }
+        Entry_T e;
+        NEW(e);
+        e->path = Str_dup(path);
+        e->follow = follow;
+        if (_stat(path, follow, &e->sb) != 0)
+                e->error = errno;
+        e->next = cache.table[h];
+        cache.table[h] = e;
+        if (e->error) {
+                errno = e->error;
+                return -1;
+        }
+        *sb = e->sb;
+        return 0;
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+void StatCache_start(void) {
+        StatCache_invalidate();
+        cache.lookups = cache.syscalls = 0;
+        cache.active = true;
+}
+
+
+void StatCache_stop(void) {
+        if (cache.active) {
+                cache.active = false;
+                StatCache_invalidate();
+                if (cache.lookups)
+                        DEBUG("Stat cache: %d lookups served with %d system calls\n", cache.lookups, cache.syscalls);
+        }
+}
+
+
+void StatCache_invalidate(void) {
+        for (int i = 0; i < BUCKETS; i++) {
+                while (cache.table[i]) {
+                        Entry_T e = cache.table[i];
+                        cache.table[i] = e->next;
+                        FREE(e->path);
+                        FREE(e);
+                }
+        }
+}
+
+
+int StatCache_stat(const char *path, struct stat *sb) {
+        return _lookup(path, true, sb);
+}
+
+
+int StatCache_lstat(const char *path, struct stat *sb) {
+        return _lookup(path, false, sb);
+}
+
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#ifndef MONIT_STATCACHE_H
+#define MONIT_STATCACHE_H
+
+#include <sys/stat.h>
+
+#include "monit.h"
+
+
+/**
+ * Per-cycle cache of file metadata. Several services and the dependant
+ * re-checks often stat the same path within one validate cycle: while
+ * the cache is active, the first lookup of a path performs the system
+ * call (statx() with a minimal field mask where available) and the
+ * subsequent lookups are served from the cache. Outside of the validate
+ * cycle the functions are plain pass-through wrappers.
+ *
+ * The cache is not thread-safe, it may be used only by the validate
+ * thread.
+ *
+ * @file
+ */
+
+
+/**
+ * Activate the cache for a new validate cycle
+ */
+void StatCache_start(void);
+
+
+/**
+ * Deactivate the cache and release all entries
+ */
+void StatCache_stop(void);
+
+
+/**
+ * Drop all cached entries, for example after a program was executed
+ * which may have changed the filesystem
+ */
+void StatCache_invalidate(void);
+
+
+/**
+ * Get the file status like stat(2) does, following symbolic links.
+ * Only the type, mode, ownership, inode, device, size and timestamps
+ * are guaranteed to be set.
+ * @param path The file path
+ * @param sb The status buffer
+ * @return 0 on success, -1 on error with errno set
+ */
+int StatCache_stat(const char *path, struct stat *sb);
+
+
+/**
+ * Get the file status like lstat(2) does, without following symbolic
+ * links. Only the type, mode, ownership, inode, device, size and
+ * timestamps are guaranteed to be set.
+ * @param path The file path
+ * @param sb The status buffer
+ * @return 0 on success, -1 on error with errno set
+ */
+int StatCache_lstat(const char *path, struct stat *sb);
+
+
+#endif
+
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#include "config.h"
+
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+
+#include "monit.h"
+#include "trend.h"
+
+
+/**
+ * Ring buffer of (time, value) samples with a linear least squares fit.
+ *
+ * @file
+ */
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+// Number of history slots (16 bytes each)
+#define TREND_SLOTS 64
+
+
+#define T Trend_T
+struct T {
+        int span;
+        int resolution;                       // Minimum distance between stored samples [s]
+        int head;                             // Index of the newest sample
+        int count;
+        struct {
+                time_t time;
+                double value;
+        } sample[TREND_SLOTS];
+};
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+#define _index(t, i) (((t)->head - (i) + TREND_SLOTS) % TREND_SLOTS) // i-th newest sample
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+T Trend_new(int span) {
+        T t;
+        NEW(t);
+        t->span = span;
+        t->resolution = span / TREND_SLOTS;
+        t->head = -1;
+        return t;
+}
+
+
+void Trend_free(T *t) {
+        ASSERT(t);
+        FREE(*t);
+}
+
+
+void Trend_add(T t, time_t time, double value) {
+        ASSERT(t);
+        if (t->count > 0 && time <= t->sample[t->head].time) {
+                if (time == t->sample[t->head].time) {
+                        t->sample[t->head].value = value;
+                        return;
+                }
+                t->count = 0; // The clock was set back
+        }
+        // Merge with the newest sample if the previous one is closer than the resolution, so the newest slot always holds the last value
+        if (t->count > 1 && time - t->sample[_index(t, 1)].time < t->resolution) {
+                t->sample[t->head].time = time;
+                t->sample[t->head].value = value;
+                return;
+        }
+        t->head = (t->head + 1) % TREND_SLOTS;
+        t->sample[t->head].time = time;
+        t->sample[t->head].value = value;
+        if (t->count < TREND_SLOTS)
+                t->count++;
+}
+
+
+bool Trend_rate(T t, int window, double *rate) {
+        ASSERT(t);
+        ASSERT(rate);
+        if (t->count < 3)
+                return false;
+        time_t last = t->sample[t->head].time;
+        double base = t->sample[t->head].value;
+        // Use the time and value relative to the newest sample to keep the sums small
+        double n = 0., sx = 0., sy = 0., sxx = 0., sxy = 0.;
+        time_t oldest = last;
+        for (int i = 0; i < t->count; i++) {
+                int j = _index(t, i);
+                if (last - t->sample[j].time > window)
+                        break;
+                double x = (double)(t->sample[j].time - last);
+                double y = t->sample[j].value - base;
+                n++;
+                sx += x;
+                sy += y;
+                sxx += x * x;
+                sxy += x * y;
+                oldest = t->sample[j].time;
+        }
+        if (n < 3 || last - oldest < window / 2)
+                return false;
+        double d = n * sxx - sx * sx;
+        if (d <= 0.)
+                return false;
+        *rate = (n * sxy - sx * sy) / d;
+        return true;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#ifndef MONIT_TREND_H
+#define MONIT_TREND_H
+
+#include "monit.h"
+
+
+/**
+ * Compact rolling history of a sampled value with a least squares fit
+ * of its growth rate, used to predict when a filesystem fills up. The
+ * history has a fixed number of slots which cover the configured span:
+ * samples closer to each other than span / slots are merged into the
+ * most recent slot, so the memory use doesn't depend on the poll
+ * interval.
+ *
+ * @file
+ */
+
+
+#define T Trend_T
+typedef struct T *T;
+
+
+/**
+ * Create a new trend history
+ * @param span The time span to keep [s]
+ * @return A new trend object
+ */
+T Trend_new(int span);
+
+
+/**
+ * Destroy the trend history
+ * @param t The trend object reference
+ */
+void Trend_free(T *t);
+
+
+/**
+ * Add a sample. If the timestamp is not greater than the last sample,
+ * the history is cleared (clock was set back)
+ * @param t The trend object
+ * @param time The sample timestamp [s]
+ * @param value The sample value
+ */
+void Trend_add(T t, time_t time, double value);
+
+
+/**
+ * Fit the growth rate over the given window ending with the last
+ * sample. At least three samples covering a half of the window are
+ * required.
+ * @param t The trend object
+ * @param window The window [s]
+ * @param rate Output: the growth rate [value per second]
+ * @return true if enough data are available, otherwise false
+ */
+bool Trend_rate(T t, int window, double *rate);
+
+
+#undef T
+#endif
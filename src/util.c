@@ -113,6 +113,8 @@
 #include "md5.h"
 #include "md5_crypt.h"
 #include "sha1.h"
+#include "sha256.h"
+#include "xxh64.h"
 #include "base64.h"
 #include "alert.h"
 #include "ProcessTree.h"
@@ -120,6 +122,9 @@
 #include "state.h"
 #include "protocol.h"
 #include "checksum.h"
+#include "dirindex.h"
+#include "trend.h"
+#include "fileset.h"
 
 // libmonit
 #include "io/File.h"
@@ -628,6 +633,11 @@ void Util_printRunList() {
         printf(" %-18s =   stopTimeout:       %s\n", " ", Convert_time2str(Run.limits.stopTimeout, (char[11]){}));
         printf(" %-18s =   startTimeout:      %s\n", " ", Convert_time2str(Run.limits.startTimeout, (char[11]){}));
         printf(" %-18s =   restartTimeout:    %s\n", " ", Convert_time2str(Run.limits.restartTimeout, (char[11]){}));
+        printf(" %-18s =   checksumWorkers:   %u\n", " ", Run.limits.checksumWorkers);
+        printf(" %-18s =   checksumIdleIO:    %s\n", " ", Run.limits.checksumIdleIO ? "enabled" : "disabled");
+        printf(" %-18s =   filesystemTimeout: %s\n", " ", Run.limits.filesystemTimeout ? Convert_time2str(Run.limits.filesystemTimeout, (char[11]){}) : "none");
+        printf(" %-18s =   dnsTtl:            %s\n", " ", Run.limits.dnsTtl ? Convert_time2str(Run.limits.dnsTtl * 1000., (char[11]){}) : "no cache");
+        printf(" %-18s =   dnsNegativeTtl:    %s\n", " ", Convert_time2str(Run.limits.dnsNegativeTtl * 1000., (char[11]){}));
         printf(" %-18s = }\n", " ");
         printf(" %-18s = %s\n", "On reboot", onrebootnames[Run.onreboot]);
         printf(" %-18s = %d seconds with start delay %d seconds\n", "Poll time", Run.polltime, Run.startdelay);
@@ -904,6 +914,20 @@ void Util_printService(Service_T s) {
                 }
         }
 
+        for (Listen_T o = s->listenlist; o; o = o->next) {
+                char where[STRLEN];
+                StringBuffer_clear(buf);
+                Util_listenDescription(o, where, sizeof(where));
+                if (o->type == ListenTest_Exist)
+                        printf(" %-20s = %s\n", "Listen", StringBuffer_toString(Util_printRule(buf, o->action, "if not listening on %s", where)));
+                else if (o->type == ListenTest_Established)
+                        printf(" %-20s = %s\n", "Established", StringBuffer_toString(Util_printRule(buf, o->action, "if on %s %s %lld", where, operatornames[o->operator], o->limit_absolute)));
+                else if (o->limit_absolute > -1LL)
+                        printf(" %-20s = %s\n", "Listen queue", StringBuffer_toString(Util_printRule(buf, o->action, "if on %s %s %lld", where, operatornames[o->operator], o->limit_absolute)));
+                else
+                        printf(" %-20s = %s\n", "Listen queue", StringBuffer_toString(Util_printRule(buf, o->action, "if on %s %s %.1f%% of backlog", where, operatornames[o->operator], o->limit_percent)));
+        }
+
         if (s->gid && s->gid->action) {
                 StringBuffer_clear(buf);
                 printf(" %-20s = %s\n", "GID", StringBuffer_toString(Util_printRule(buf, s->gid->action, "if failed %d", s->gid->gid)));
@@ -932,10 +956,16 @@ void Util_printService(Service_T s) {
                         o->hostname, o->target.net.port, Util_portRequestDescription(o));
                 if (o->outgoing.ip)
                         StringBuffer_append(buf2, " via address %s", o->outgoing.ip);
-                StringBuffer_append(buf2, " type %s/%s protocol %s with timeout %s",
-                        Util_portTypeDescription(o), Util_portIpDescription(o), o->protocol->name, Convert_time2str(o->timeout, (char[11]){}));
+                StringBuffer_append(buf2, " type %s/%s protocol %s%s with timeout %s",
+                        Util_portTypeDescription(o), Util_portIpDescription(o), o->protocol->name, Util_portHttp2Requests(o, (char[STRLEN]){}, STRLEN), Convert_time2str(o->timeout, (char[11]){}));
                 if (o->retry > 1)
                         StringBuffer_append(buf2, " and retry %d times", o->retry);
+                if (o->timinglist)
+                        StringBuffer_append(buf2, "%s", Util_portTimingLimits(o, (char[STRLEN]){}, STRLEN));
+                if (o->persistent)
+                        StringBuffer_append(buf2, " using persistent connection");
+                if (o->probe)
+                        StringBuffer_append(buf2, " (probe shared by %d tests)", o->probe->references);
 #ifdef HAVE_OPENSSL
                 if (o->target.net.ssl.options.flags) {
                         StringBuffer_append(buf2, " using TLS");
@@ -956,9 +986,9 @@ void Util_printService(Service_T s) {
         for (Port_T o = s->socketlist; o; o = o->next) {
                 StringBuffer_clear(buf);
                 if (o->retry > 1)
-                        printf(" %-20s = %s\n", "Unix Socket", StringBuffer_toString(Util_printRule(buf, o->action, "if failed %s type %s protocol %s with timeout %s and retry %d times", o->target.unix.pathname, Util_portTypeDescription(o), o->protocol->name, Convert_time2str(o->timeout, (char[11]){}), o->retry)));
+                        printf(" %-20s = %s\n", "Unix Socket", StringBuffer_toString(Util_printRule(buf, o->action, "if failed %s type %s protocol %s with timeout %s and retry %d times%s%s", o->target.unix.pathname, Util_portTypeDescription(o), o->protocol->name, Convert_time2str(o->timeout, (char[11]){}), o->retry, Util_portTimingLimits(o, (char[STRLEN]){}, STRLEN), o->persistent ? " using persistent connection" : "")));
                 else
-                        printf(" %-20s = %s\n", "Unix Socket", StringBuffer_toString(Util_printRule(buf, o->action, "if failed %s type %s protocol %s with timeout %s", o->target.unix.pathname, Util_portTypeDescription(o), o->protocol->name, Convert_time2str(o->timeout, (char[11]){}))));
+                        printf(" %-20s = %s\n", "Unix Socket", StringBuffer_toString(Util_printRule(buf, o->action, "if failed %s type %s protocol %s with timeout %s%s%s", o->target.unix.pathname, Util_portTypeDescription(o), o->protocol->name, Convert_time2str(o->timeout, (char[11]){}), Util_portTimingLimits(o, (char[STRLEN]){}, STRLEN), o->persistent ? " using persistent connection" : "")));
         }
 
         for (Timestamp_T o = s->timestamplist; o; o = o->next) {
@@ -1034,6 +1064,15 @@ void Util_printService(Service_T s) {
                 }
         }
 
+        for (Bandwidth_T o = s->linkcounterlist; o; o = o->next) {
+                StringBuffer_clear(buf);
+                if (o->range == Time_Second) {
+                        printf(" %-20s = %s\n", "Link counter", StringBuffer_toString(Util_printRule(buf, o->action, "if %s %s %lld/s", Link_getCounterName(o->counter), operatornames[o->operator], o->limit)));
+                } else {
+                        printf(" %-20s = %s\n", "Total link counter", StringBuffer_toString(Util_printRule(buf, o->action, "if %s %s %lld in last %d %s(s)", Link_getCounterName(o->counter), operatornames[o->operator], o->limit, o->rangecount, Util_timestr(o->range))));
+                }
+        }
+
         for (Uptime_T o = s->uptimelist; o; o = o->next) {
                 StringBuffer_clear(buf);
                 printf(" %-20s = %s\n", "Uptime", StringBuffer_toString(Util_printRule(buf, o->action, "if %s %llu second(s)", operatornames[o->operator], o->uptime)));
@@ -1090,6 +1129,19 @@ void Util_printService(Service_T s) {
                         printf(" %-20s = %s\n", "Write limit", StringBuffer_toString(Util_printRule(buf, o->action, "if write %s %llu operations/s", operatornames[o->operator], o->limit_absolute)));
                 } else if (o->resource == Resource_ServiceTime) {
                         printf(" %-20s = %s\n", "Service time limit", StringBuffer_toString(Util_printRule(buf, o->action, "if service time %s %s/operation", operatornames[o->operator], Convert_time2str(o->limit_absolute, (char[11]){}))));
+                } else if (o->resource == Resource_ReadLatency) {
+                        printf(" %-20s = %s\n", "Read latency limit", StringBuffer_toString(Util_printRule(buf, o->action, "if read latency %s %s/operation", operatornames[o->operator], Convert_time2str(o->limit_absolute, (char[11]){}))));
+                } else if (o->resource == Resource_WriteLatency) {
+                        printf(" %-20s = %s\n", "Write latency limit", StringBuffer_toString(Util_printRule(buf, o->action, "if write latency %s %s/operation", operatornames[o->operator], Convert_time2str(o->limit_absolute, (char[11]){}))));
+                } else if (o->resource == Resource_Utilization) {
+                        printf(" %-20s = %s\n", "Utilization limit", StringBuffer_toString(Util_printRule(buf, o->action, "if utilization %s %.1f%%", operatornames[o->operator], o->limit_percent)));
+                } else if (o->resource == Resource_QueueDepth) {
+                        printf(" %-20s = %s\n", "Queue depth limit", StringBuffer_toString(Util_printRule(buf, o->action, "if queue depth %s %.2f", operatornames[o->operator], o->limit_percent)));
+                } else if (o->resource == Resource_SpaceTimeToFull || o->resource == Resource_InodeTimeToFull) {
+                        bool space = o->resource == Resource_SpaceTimeToFull;
+                        printf(" %-20s = %s\n", space ? "Space time-to-full" : "Inode time-to-full", StringBuffer_toString(Util_printRule(buf, o->action, "if %s time-to-full %s %s over %s", space ? "space" : "inode", operatornames[o->operator], Convert_time2str(o->limit_absolute * 1000., (char[11]){}), Convert_time2str(o->window * 1000., (char[11]){}))));
+                } else if (o->resource == Resource_Iops) {
+                        printf(" %-20s = %s\n", "IOPS limit", StringBuffer_toString(Util_printRule(buf, o->action, "if iops %s %llu operations/s", operatornames[o->operator], o->limit_absolute)));
                 }
         }
 
@@ -1220,6 +1272,47 @@ void Util_printService(Service_T s) {
                                 printf(" %-20s = ", "Disk write limit");
                                 break;
 
+                        case Resource_DirectoryEntries:
+                                printf(" %-20s = ", "Entries limit");
+                                break;
+
+                        case Resource_DirectorySize:
+                                printf(" %-20s = ", "Total size limit");
+                                break;
+
+                        case Resource_DirectoryOldest:
+                                printf(" %-20s = ", "Oldest entry limit");
+                                break;
+
+                        case Resource_TcpRetransmits:
+                        case Resource_TcpRetransmitsPercent:
+                                printf(" %-20s = ", "TCP retransmits");
+                                break;
+
+                        case Resource_TcpListenOverflows:
+                                printf(" %-20s = ", "TCP listen overflows");
+                                break;
+
+                        case Resource_TcpListenDrops:
+                                printf(" %-20s = ", "TCP listen drops");
+                                break;
+
+                        case Resource_TcpSynCookies:
+                                printf(" %-20s = ", "TCP SYN cookies");
+                                break;
+
+                        case Resource_TcpOrphans:
+                                printf(" %-20s = ", "TCP orphans");
+                                break;
+
+                        case Resource_TcpTimeWait:
+                                printf(" %-20s = ", "TCP TIME_WAIT");
+                                break;
+
+                        case Resource_UdpReceiveBufferErrors:
+                                printf(" %-20s = ", "UDP rcvbuf errors");
+                                break;
+
                         default:
                                 break;
                 }
@@ -1276,6 +1369,35 @@ void Util_printService(Service_T s) {
                                 printf("%s", StringBuffer_toString(Util_printRule(buf, o->action, "if %s %.0f operations/s", operatornames[o->operator], o->limit)));
                                 break;
 
+                        case Resource_DirectoryEntries:
+                                printf("%s", StringBuffer_toString(Util_printRule(buf, o->action, "if %s %.0f", operatornames[o->operator], o->limit)));
+                                break;
+
+                        case Resource_DirectorySize:
+                                printf("%s", StringBuffer_toString(Util_printRule(buf, o->action, "if %s %s", operatornames[o->operator], Convert_bytes2str(o->limit, (char[10]){}))));
+                                break;
+
+                        case Resource_DirectoryOldest:
+                                printf("%s", StringBuffer_toString(Util_printRule(buf, o->action, "if %s %s", operatornames[o->operator], Convert_time2str(o->limit * 1000., (char[11]){}))));
+                                break;
+
+                        case Resource_TcpRetransmitsPercent:
+                                printf("%s", StringBuffer_toString(Util_printRule(buf, o->action, "if %s %.1f%%", operatornames[o->operator], o->limit)));
+                                break;
+
+                        case Resource_TcpRetransmits:
+                        case Resource_TcpListenOverflows:
+                        case Resource_TcpListenDrops:
+                        case Resource_TcpSynCookies:
+                        case Resource_UdpReceiveBufferErrors:
+                                printf("%s", StringBuffer_toString(Util_printRule(buf, o->action, "if %s %.0f/s", operatornames[o->operator], o->limit)));
+                                break;
+
+                        case Resource_TcpOrphans:
+                        case Resource_TcpTimeWait:
+                                printf("%s", StringBuffer_toString(Util_printRule(buf, o->action, "if %s %.0f", operatornames[o->operator], o->limit)));
+                                break;
+
                         default:
                                 break;
                 }
@@ -1598,18 +1720,33 @@ void Util_resetInfo(Service_T s) {
                         s->inf.filesystem->mode = -1;
                         s->inf.filesystem->uid = -1;
                         s->inf.filesystem->gid = -1;
+                        s->inf.filesystem->inFlight = -1LL;
+                        s->inf.filesystem->timeout = false;
+                        s->inf.filesystem->timeToFull.space = -1LL;
+                        s->inf.filesystem->timeToFull.inode = -1LL;
+                        if (s->inf.filesystem->trend.space)
+                                Trend_free(&(s->inf.filesystem->trend.space));
+                        if (s->inf.filesystem->trend.inode)
+                                Trend_free(&(s->inf.filesystem->trend.inode));
                         _resetIOStatistics(&(s->inf.filesystem->read));
                         _resetIOStatistics(&(s->inf.filesystem->write));
+                        _resetIOStatistics(&(s->inf.filesystem->discard));
+                        _resetIOStatistics(&(s->inf.filesystem->flush));
                         Statistics_reset(&(s->inf.filesystem->time.read));
                         Statistics_reset(&(s->inf.filesystem->time.write));
+                        Statistics_reset(&(s->inf.filesystem->time.discard));
+                        Statistics_reset(&(s->inf.filesystem->time.flush));
                         Statistics_reset(&(s->inf.filesystem->time.wait));
                         Statistics_reset(&(s->inf.filesystem->time.run));
+                        Statistics_reset(&(s->inf.filesystem->time.io));
+                        Statistics_reset(&(s->inf.filesystem->time.weighted));
                         break;
                 case Service_File:
                         s->inf.file->size  = -1;
                         s->inf.file->readpos = 0;
                         s->inf.file->inode = 0;
                         s->inf.file->inode_prev = 0;
+                        s->inf.file->device = 0;
                         s->inf.file->mode = -1;
                         s->inf.file->uid = -1;
                         s->inf.file->gid = -1;
@@ -1617,6 +1754,8 @@ void Util_resetInfo(Service_T s) {
                         s->inf.file->timestamp.change = 0;
                         s->inf.file->timestamp.modify = 0;
                         *s->inf.file->cs_sum = 0;
+                        if (s->checksum)
+                                s->checksum->collected = false;
                         break;
                 case Service_Directory:
                         s->inf.directory->mode = -1;
@@ -1625,6 +1764,18 @@ void Util_resetInfo(Service_T s) {
                         s->inf.directory->timestamp.access = 0;
                         s->inf.directory->timestamp.change = 0;
                         s->inf.directory->timestamp.modify = 0;
+                        s->inf.directory->entries = -1LL;
+                        s->inf.directory->size = -1LL;
+                        s->inf.directory->oldest = 0;
+                        if (s->inf.directory->index)
+                                DirIndex_free(&(s->inf.directory->index));
+                        break;
+                case Service_Fileset:
+                        s->inf.fileset->entries = -1;
+                        s->inf.fileset->failed = 0;
+                        s->inf.fileset->size = -1LL;
+                        if (s->inf.fileset->set)
+                                FileSet_free(&(s->inf.fileset->set));
                         break;
                 case Service_Fifo:
                         s->inf.fifo->mode = -1;
@@ -1886,6 +2037,8 @@ const char *Util_portRequestDescription(Port_T p) {
                 request = p->parameters.http.request;
         else if (p->protocol->check == check_websocket && p->parameters.websocket.request)
                 request = p->parameters.websocket.request;
+        else if (p->protocol->check == check_http2 && p->parameters.http.streams && ! p->parameters.http.streams->next)
+                request = p->parameters.http.streams->request;
         return request;
 }
 
@@ -1902,6 +2055,61 @@ char *Util_portDescription(Port_T p, char *buf, int bufsize) {
 }
 
 
+char *Util_portTimingLimits(Port_T p, char *buf, int bufsize) {
+        int len = 0;
+        *buf = 0;
+        for (TimingLimit_T t = p->timinglist; t && len < bufsize; t = t->next) {
+                if (t->type == Timing_Retransmits)
+                        len += snprintf(buf + len, bufsize - len, " and %s %s %.0f", timingnames[t->type], operatorshortnames[t->operator], t->limit);
+                else
+                        len += snprintf(buf + len, bufsize - len, " and %s %s %s", timingnames[t->type], operatorshortnames[t->operator], Convert_time2str(t->limit, (char[11]){}));
+        }
+        return buf;
+}
+
+
+char *Util_portTiming(Port_T p, char *buf, int bufsize) {
+        int len = 0;
+        *buf = 0;
+        for (int i = 0; i <= Timing_Last && len < bufsize; i++) {
+                if (p->timing[i] < 0)
+                        continue;
+                if (i == Timing_Retransmits)
+                        len += snprintf(buf + len, bufsize - len, "%s%s %.0f", len ? ", " : "", timingnames[i], p->timing[i]);
+                else
+                        len += snprintf(buf + len, bufsize - len, "%s%s %s", len ? ", " : "", timingnames[i], Convert_time2str(p->timing[i], (char[11]){}));
+        }
+        return buf;
+}
+
+
+char *Util_portHttp2Requests(Port_T p, char *buf, int bufsize) {
+        int len = 0;
+        *buf = 0;
+        if (p->protocol->check == check_http2 && p->parameters.http.streams && p->parameters.http.streams->next)
+                for (Http2Stream_T stream = p->parameters.http.streams; stream && len < bufsize; stream = stream->next)
+                        len += snprintf(buf + len, bufsize - len, "%s%s", len ? ", " : " requests ", stream->request);
+        return buf;
+}
+
+
+char *Util_http2StreamDescription(Http2Stream_T stream, char *buf, int bufsize) {
+        if (stream->status < 0)
+                snprintf(buf, bufsize, "%s no response", stream->request);
+        else if (stream->response < 0)
+                snprintf(buf, bufsize, "%s status %d", stream->request, stream->status);
+        else
+                snprintf(buf, bufsize, "%s status %d in %s", stream->request, stream->status, Convert_time2str(stream->response, (char[11]){}));
+        return buf;
+}
+
+
+char *Util_listenDescription(Listen_T l, char *buf, int bufsize) {
+        snprintf(buf, bufsize, "[%s]:%d", l->address ? l->address : "*", l->port);
+        return buf;
+}
+
+
 char *Util_commandDescription(command_t command, char s[STRLEN]) {
         ASSERT(s);
         ASSERT(command);
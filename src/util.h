@@ -337,6 +337,62 @@ const char *Util_portRequestDescription(Port_T p);
 char *Util_portDescription(Port_T p, char *buf, int bufsize);
 
 
+/**
+ * Print port connection timing limits description, for example
+ * " and tls handshake > 200 ms"
+ * @param p A port structure
+ * @param buf Buffer
+ * @param bufsize Buffer size
+ * @return the buffer
+ */
+char *Util_portTimingLimits(Port_T p, char *buf, int bufsize);
+
+
+/**
+ * Print the connection timing measured by the last port test, for example
+ * "dns time 0.1 ms, connect time 0.3 ms, ...". Phases which were not
+ * measured are skipped
+ * @param p A port structure
+ * @param buf Buffer
+ * @param bufsize Buffer size
+ * @return the buffer
+ */
+char *Util_portTiming(Port_T p, char *buf, int bufsize);
+
+
+/**
+ * Print the HTTP/2 request paths if the port tests more than one stream,
+ * for example " requests /, /health"
+ * @param p A port structure
+ * @param buf Buffer
+ * @param bufsize Buffer size
+ * @return the buffer
+ */
+char *Util_portHttp2Requests(Port_T p, char *buf, int bufsize);
+
+
+/**
+ * Print the result of the HTTP/2 stream test, for example
+ * "/health status 200 in 1.234 ms"
+ * @param stream A HTTP/2 stream
+ * @param buf Buffer
+ * @param bufsize Buffer size
+ * @return the buffer
+ */
+char *Util_http2StreamDescription(Http2Stream_T stream, char *buf, int bufsize);
+
+
+/**
+ * Print listening socket description \[<address>\]:<port>, where the
+ * address is '*' if the test matches any local address
+ * @param l A listen structure
+ * @param buf Buffer
+ * @param bufsize Buffer size
+ * @return the buffer
+ */
+char *Util_listenDescription(Listen_T l, char *buf, int bufsize);
+
+
 /**
  * Print a command description
  * @param command Command object
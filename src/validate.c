@@ -102,7 +102,15 @@
 #include "protocol.h"
 #include "md5.h"
 #include "sha1.h"
+#include "sha256.h"
+#include "xxh64.h"
 #include "checksum.h"
+#include "hashpool.h"
+#include "statcache.h"
+#include "mounttable.h"
+#include "dirindex.h"
+#include "fileset.h"
+#include "trend.h"
 
 // libmonit
 #include "system/Time.h"
@@ -118,6 +126,16 @@
  */
 
 
+/* ------------------------------------------------------------- Definitions */
+
+
+#define FILESET_REPORT_PATHS 5     // Maximum number of file paths named in a fileset event
+#define TIMETOFULL_MAX 315360000LL // Longest reported time-to-full (10 years) [s], slower growth is reported as not growing
+
+
+static unsigned long long _cycle = 0; // Validation cycle counter, used to share the connection test results within one cycle
+
+
 /* ----------------------------------------------------------------- Private */
 
 
@@ -140,6 +158,41 @@ static void _programOutput(InputStream_T I, StringBuffer_T S) {
 }
 
 
+/**
+ * Test the SSL certificate expiration
+ */
+static State_Type _checkCertificate(Service_T s, Port_T p, State_Type rv) {
+        if (p->target.net.ssl.options.flags && p->target.net.ssl.certificate.validDays >= 0 && p->target.net.ssl.certificate.minimumDays > 0) {
+                if (p->target.net.ssl.certificate.validDays < p->target.net.ssl.certificate.minimumDays) {
+                        Event_post(s, Event_Timestamp, State_Failed, p->action, "certificate expiry in %d days matches check limit [valid > %d days]", p->target.net.ssl.certificate.validDays, p->target.net.ssl.certificate.minimumDays);
+                        rv = State_Failed;
+                } else {
+                        Event_post(s, Event_Timestamp, State_Succeeded, p->action, "certificate valid days test succeeded [valid for %d days]", p->target.net.ssl.certificate.validDays);
+                }
+        }
+        return rv;
+}
+
+
+/**
+ * Test the connection phase timing limits. If a limit matched, the report is
+ * set and false is returned
+ */
+static bool _checkTiming(Port_T p, char *report, int reportlen) {
+        char buf[STRLEN];
+        for (TimingLimit_T t = p->timinglist; t; t = t->next) {
+                if (p->timing[t->type] >= 0 && Util_evalDoubleQExpression(t->operator, p->timing[t->type], t->limit)) {
+                        if (t->type == Timing_Retransmits)
+                                snprintf(report, reportlen, "%s %.0f matches limit [%s %.0f] at %s", timingnames[t->type], p->timing[t->type], operatorshortnames[t->operator], t->limit, Util_portDescription(p, buf, sizeof(buf)));
+                        else
+                                snprintf(report, reportlen, "%s %s matches limit [%s %s] at %s", timingnames[t->type], Convert_time2str(p->timing[t->type], (char[11]){}), operatorshortnames[t->operator], Convert_time2str(t->limit, (char[11]){}), Util_portDescription(p, buf, sizeof(buf)));
+                        return false;
+                }
+        }
+        return true;
+}
+
+
 /**
  * Test the connection and protocol
  */
@@ -148,8 +201,30 @@ static State_Type _checkConnection(Service_T s, Port_T p) {
         ASSERT(p);
         volatile int retry_count = p->retry;
         volatile State_Type rv = State_Succeeded;
+        bool timingFailed = false;
         char buf[STRLEN];
         char report[1024] = {};
+        if (p->probe && p->probe->cycle == _cycle) {
+                // The identical test of another service probed the endpoint in this cycle already, use its result
+                p->is_available = p->probe->is_available;
+                p->response = p->probe->response;
+                memcpy(p->timing, p->probe->timing, sizeof(p->timing));
+                if (p->family != Socket_Unix)
+                        p->target.net.ssl.certificate.validDays = p->probe->validDays;
+                if (p->is_available != Connection_Ok) {
+                        rv = State_Failed;
+                        Event_post(s, Event_Connection, State_Failed, p->action, "%s", p->probe->report);
+                } else if (! _checkTiming(p, report, sizeof(report))) {
+                        // The timing limits are specific to each test
+                        rv = State_Failed;
+                        p->is_available = Connection_Failed;
+                        Event_post(s, Event_Connection, State_Failed, p->action, "%s", report);
+                } else {
+                        DEBUG("'%s' succeeded testing protocol [%s] at %s [response time %s, shared probe]\n", s->name, p->protocol->name, Util_portDescription(p, buf, sizeof(buf)), Convert_time2str(p->response, (char[11]){}));
+                        Event_post(s, Event_Connection, State_Succeeded, p->action, "connection succeeded to %s", Util_portDescription(p, buf, sizeof(buf)));
+                }
+                return _checkCertificate(s, p, rv);
+        }
 retry:
         TRY
         {
@@ -163,6 +238,9 @@ retry:
                 snprintf(report, sizeof(report), "failed protocol test [%s] at %s -- %s", p->protocol->name, Util_portDescription(p, buf, sizeof(buf)), Exception_frame.message);
         }
         END_TRY;
+        timingFailed = rv == State_Succeeded && ! _checkTiming(p, report, sizeof(report));
+        if (timingFailed)
+                rv = State_Failed;
         if (rv == State_Failed) {
                 if (retry_count-- > 1) {
                         Log_warning("'%s' %s (attempt %d/%d)\n", s->name, report, p->retry - retry_count, p->retry);
@@ -172,15 +250,19 @@ retry:
         } else {
                 Event_post(s, Event_Connection, State_Succeeded, p->action, "connection succeeded to %s", Util_portDescription(p, buf, sizeof(buf)));
         }
-        if (p->target.net.ssl.options.flags && p->target.net.ssl.certificate.validDays >= 0 && p->target.net.ssl.certificate.minimumDays > 0) {
-                if (p->target.net.ssl.certificate.validDays < p->target.net.ssl.certificate.minimumDays) {
-                        Event_post(s, Event_Timestamp, State_Failed, p->action, "certificate expiry in %d days matches check limit [valid > %d days]", p->target.net.ssl.certificate.validDays, p->target.net.ssl.certificate.minimumDays);
-                        rv = State_Failed;
-                } else {
-                        Event_post(s, Event_Timestamp, State_Succeeded, p->action, "certificate valid days test succeeded [valid for %d days]", p->target.net.ssl.certificate.validDays);
-                }
-        }
-        return rv;
+        if (p->probe) {
+                p->probe->cycle = _cycle;
+                p->probe->is_available = p->is_available;
+                p->probe->response = p->response;
+                memcpy(p->probe->timing, p->timing, sizeof(p->timing));
+                if (p->family != Socket_Unix)
+                        p->probe->validDays = p->target.net.ssl.certificate.validDays;
+                snprintf(p->probe->report, sizeof(p->probe->report), "%s", report);
+        }
+        // The connection succeeded, but the timing limit of this test failed (the shared probe keeps the connection state for the other tests)
+        if (timingFailed)
+                p->is_available = Connection_Failed;
+        return _checkCertificate(s, p, rv);
 }
 
 
@@ -448,6 +530,35 @@ static State_Type _checkLoadAverage(Resource_T r, double loadavg, const char *na
 }
 
 
+static State_Type _checkNetworkStackRate(Service_T s, Resource_T r, Statistics_T statistics, const char *name, char report[STRLEN]) {
+        if (! Statistics_initialized(statistics) || ! statistics->last.time) {
+                DEBUG("'%s' %s check skipped (initializing)\n", s->name, name);
+                return State_Init;
+        }
+        double rate = Statistics_deltaNormalize(statistics);
+        if (Util_evalDoubleQExpression(r->operator, rate, r->limit)) {
+                snprintf(report, STRLEN, "%s of %.1f/s matches resource limit [%s %s %.0f/s]", name, rate, name, operatorshortnames[r->operator], r->limit);
+                return State_Failed;
+        }
+        snprintf(report, STRLEN, "%s check succeeded [current %s = %.1f/s]", name, name, rate);
+        return State_Succeeded;
+}
+
+
+static State_Type _checkNetworkStackCount(Service_T s, Resource_T r, long long count, const char *name, char report[STRLEN]) {
+        if (count < 0) {
+                DEBUG("'%s' %s check skipped (data not available)\n", s->name, name);
+                return State_Init;
+        }
+        if (Util_evalQExpression(r->operator, count, r->limit)) {
+                snprintf(report, STRLEN, "%s of %lld matches resource limit [%s %s %.0f]", name, count, name, operatorshortnames[r->operator], r->limit);
+                return State_Failed;
+        }
+        snprintf(report, STRLEN, "%s check succeeded [current %s = %lld]", name, name, count);
+        return State_Succeeded;
+}
+
+
 static State_Type _checkSystemResources(Service_T s, Resource_T r) {
         ASSERT(s);
         ASSERT(r);
@@ -669,6 +780,60 @@ static State_Type _checkSystemResources(Service_T s, Resource_T r) {
                         rv = _checkLoadAverage(r, systeminfo.loadavg[2] / (double)systeminfo.cpu.count, "loadavg per core (15min)", report);
                         break;
 
+                case Resource_TcpRetransmits:
+                case Resource_TcpRetransmitsPercent:
+                case Resource_TcpListenOverflows:
+                case Resource_TcpListenDrops:
+                case Resource_TcpSynCookies:
+                case Resource_TcpOrphans:
+                case Resource_TcpTimeWait:
+                case Resource_UdpReceiveBufferErrors:
+                        if (! (systeminfo.statisticsAvailable & Statistics_NetworkStack)) {
+                                Log_warning("Cannot test network stack statistics as they are not available on this system\n");
+                                return State_Succeeded;
+                        }
+                        switch (r->resource_id) {
+                                case Resource_TcpRetransmits:
+                                        rv = _checkNetworkStackRate(s, r, &(systeminfo.netstack.tcp.retransmits), "tcp retransmits", report);
+                                        break;
+                                case Resource_TcpRetransmitsPercent:
+                                        if (! systeminfo.netstack.tcp.segments.last.time) {
+                                                DEBUG("'%s' tcp retransmits check skipped (initializing)\n", s->name);
+                                                return State_Init;
+                                        } else {
+                                                unsigned long long segments = Statistics_delta(&(systeminfo.netstack.tcp.segments));
+                                                double retransmits = segments ? 100. * (double)Statistics_delta(&(systeminfo.netstack.tcp.retransmits)) / (double)segments : 0.;
+                                                if (Util_evalDoubleQExpression(r->operator, retransmits, r->limit)) {
+                                                        rv = State_Failed;
+                                                        snprintf(report, STRLEN, "tcp retransmits of %.1f%% matches resource limit [tcp retransmits %s %.1f%%]", retransmits, operatorshortnames[r->operator], r->limit);
+                                                } else {
+                                                        snprintf(report, STRLEN, "tcp retransmits check succeeded [current tcp retransmits = %.1f%%]", retransmits);
+                                                }
+                                        }
+                                        break;
+                                case Resource_TcpListenOverflows:
+                                        rv = _checkNetworkStackRate(s, r, &(systeminfo.netstack.tcp.listenOverflows), "tcp listen overflows", report);
+                                        break;
+                                case Resource_TcpListenDrops:
+                                        rv = _checkNetworkStackRate(s, r, &(systeminfo.netstack.tcp.listenDrops), "tcp listen drops", report);
+                                        break;
+                                case Resource_TcpSynCookies:
+                                        rv = _checkNetworkStackRate(s, r, &(systeminfo.netstack.tcp.synCookies), "tcp syn cookies", report);
+                                        break;
+                                case Resource_UdpReceiveBufferErrors:
+                                        rv = _checkNetworkStackRate(s, r, &(systeminfo.netstack.udp.receiveBufferErrors), "udp receive buffer errors", report);
+                                        break;
+                                case Resource_TcpOrphans:
+                                        rv = _checkNetworkStackCount(s, r, systeminfo.netstack.tcp.orphans, "tcp orphaned sockets", report);
+                                        break;
+                                default:
+                                        rv = _checkNetworkStackCount(s, r, systeminfo.netstack.tcp.timeWait, "tcp time-wait sockets", report);
+                                        break;
+                        }
+                        if (rv == State_Init)
+                                return rv;
+                        break;
+
                 default:
                         Log_error("'%s' error -- unknown resource ID: [%d]\n", s->name, r->resource_id);
                         return State_Failed;
@@ -687,25 +852,36 @@ static State_Type _checkChecksum(Service_T s) {
         State_Type rv = State_Succeeded;
         if (s->checksum) {
                 Checksum_T cs = s->checksum;
-                if (Checksum_getChecksum(s->path, cs->type, s->inf.file->cs_sum, sizeof(s->inf.file->cs_sum))) {
+                bool succeeded;
+                if (HashPool_isRunning()) {
+                        // The checksum is computed in the background: collect the result of the job queued in a previous cycle and queue the next one. While the job is still running, the last collected checksum is evaluated again, so the test keeps its schedule. Until the first result is available, the test stays in the initial state
+                        if (! cs->job) {
+                                cs->job = HashPool_submit(s->path, cs->type);
+                                return State_Init;
+                        }
+                        if (HashPool_poll(cs->job, s->inf.file->cs_sum, &cs->succeeded)) {
+                                cs->collected = true;
+                                cs->job = HashPool_submit(s->path, cs->type);
+                        } else if (! cs->collected) {
+                                return State_Init;
+                        }
+                        succeeded = cs->succeeded;
+                } else {
+                        succeeded = Checksum_getChecksum(s->path, cs->type, s->inf.file->cs_sum, sizeof(s->inf.file->cs_sum));
+                }
+                if (succeeded) {
                         Event_post(s, Event_Data, State_Succeeded, s->action_DATA, "checksum %s", s->inf.file->cs_sum);
                         if (! cs->initialized) {
                                 cs->initialized = true;
                                 snprintf(cs->hash, sizeof(cs->hash), "%s", s->inf.file->cs_sum);
                         }
-                        int changed;
-                        switch (cs->type) {
-                                case Hash_Md5:
-                                        changed = strncmp(cs->hash, s->inf.file->cs_sum, 32);
-                                        break;
-                                case Hash_Sha1:
-                                        changed = strncmp(cs->hash, s->inf.file->cs_sum, 40);
-                                        break;
-                                default:
-                                        Log_error("'%s' unknown hash type (%d)\n", s->name, cs->type);
-                                        *s->inf.file->cs_sum = 0;
-                                        return State_Failed;
+                        int length = Checksum_length(cs->type) * 2;
+                        if (! length) {
+                                Log_error("'%s' unknown hash type (%d)\n", s->name, cs->type);
+                                *s->inf.file->cs_sum = 0;
+                                return State_Failed;
                         }
+                        int changed = strncmp(cs->hash, s->inf.file->cs_sum, length);
                         if (changed) {
                                 if (cs->test_changes) {
                                         rv = State_Changed;
@@ -824,6 +1000,70 @@ static State_Type _checkSecurityAttribute(Service_T s, char *attribute) {
 }
 
 
+static State_Type _checkListen(Service_T s, int pid) {
+        ASSERT(s);
+        State_Type rv = State_Succeeded;
+        char where[STRLEN];
+        for (Listen_T l = s->listenlist; l; l = l->next) {
+                Util_listenDescription(l, where, sizeof(where));
+                TRY
+                {
+                        l->found = Listen_get(l->addresses, l->port, pid, &(l->info));
+                }
+                ELSE
+                {
+                        l->found = false;
+                        l->info.queue = l->info.backlog = l->info.established = -1LL;
+                        rv = State_Failed;
+                        Event_post(s, Event_Connection, State_Failed, l->action, "listen test for %s failed -- %s", where, Exception_frame.message);
+                        continue;
+                }
+                END_TRY;
+                switch (l->type) {
+                        case ListenTest_Exist:
+                                if (! l->found) {
+                                        rv = State_Failed;
+                                        Event_post(s, Event_Connection, State_Failed, l->action, "no socket is listening on %s%s", where, pid > 0 ? " owned by the process" : "");
+                                } else {
+                                        Event_post(s, Event_Connection, State_Succeeded, l->action, "socket is listening on %s", where);
+                                }
+                                break;
+                        case ListenTest_Queue:
+                                if (! l->found) {
+                                        DEBUG("'%s' accept queue test skipped -- no socket is listening on %s\n", s->name, where);
+                                } else if (l->limit_absolute > -1LL) {
+                                        if (Util_evalQExpression(l->operator, l->info.queue, l->limit_absolute)) {
+                                                rv = State_Failed;
+                                                Event_post(s, Event_Resource, State_Failed, l->action, "accept queue on %s of %lld matches limit [listen queue %s %lld]", where, l->info.queue, operatorshortnames[l->operator], l->limit_absolute);
+                                        } else {
+                                                Event_post(s, Event_Resource, State_Succeeded, l->action, "accept queue test on %s succeeded [current queue = %lld/%lld]", where, l->info.queue, l->info.backlog);
+                                        }
+                                } else {
+                                        float usage = l->info.backlog > 0 ? (float)100 * (float)l->info.queue / (float)l->info.backlog : 0;
+                                        if (Util_evalDoubleQExpression(l->operator, usage, l->limit_percent)) {
+                                                rv = State_Failed;
+                                                Event_post(s, Event_Resource, State_Failed, l->action, "accept queue on %s of %.1f%% matches limit [listen queue %s %.1f%%]", where, usage, operatorshortnames[l->operator], l->limit_percent);
+                                        } else {
+                                                Event_post(s, Event_Resource, State_Succeeded, l->action, "accept queue test on %s succeeded [current queue = %.1f%%]", where, usage);
+                                        }
+                                }
+                                break;
+                        case ListenTest_Established:
+                                if (Util_evalQExpression(l->operator, l->info.established, l->limit_absolute)) {
+                                        rv = State_Failed;
+                                        Event_post(s, Event_Resource, State_Failed, l->action, "established connections on %s of %lld matches limit [established %s %lld]", where, l->info.established, operatorshortnames[l->operator], l->limit_absolute);
+                                } else {
+                                        Event_post(s, Event_Resource, State_Succeeded, l->action, "established connections test on %s succeeded [current connections = %lld]", where, l->info.established);
+                                }
+                                break;
+                        default:
+                                break;
+                }
+        }
+        return rv;
+}
+
+
 static State_Type _checkSystemFiledescriptors(Service_T s) {
         ASSERT(s);
         State_Type rv = State_Succeeded;
@@ -1069,11 +1309,9 @@ static State_Type _checkMatch(Service_T s) {
                         Log_error("'%s' cannot open file %s: %s\n", s->name, s->path, STRERROR);
                         return State_Failed;
                 }
-                /* FIXME: Refactor: Initialize the filesystems table ahead of file and filesystems test and index it by device id + replace the Str_startsWith() with lookup to the table by device id (obtained via file's stat()).
-                 The central filesystems initialization will allow to reduce the statfs() calls in the case that there will be multiple file and/or filesystems tests for the same fs. Temporarily we go with
-                 dummy Str_startsWith() as quick fix which will cover 99.9% of use cases without rising the statfs overhead if statfs call would be inlined here.
-                 */
-                if (Str_startsWith(s->path, "/proc")) {
+                // Files on pseudo filesystems (procfs, sysfs, ...) report no meaningful size: always read them from the start. If the mount table is not available, fall back to the path prefix
+                Mount_T mount = MountTable_getByDevice(s->inf.file->device);
+                if (mount ? mount->pseudo : Str_startsWith(s->path, "/proc")) {
                         s->inf.file->readpos = 0;
                 } else {
                         /* If inode changed or size shrunk -> set read position = 0 */
@@ -1372,6 +1610,97 @@ static State_Type _checkFilesystemResources(Service_T s, FileSystem_T td) {
                         }
                         return State_Succeeded;
 
+                case Resource_ReadLatency:
+                case Resource_WriteLatency:
+                        {
+                                const char *name = td->resource == Resource_ReadLatency ? "read" : "write";
+                                double latency = td->resource == Resource_ReadLatency ? Filesystem_getLatency(&(s->inf.filesystem->read), &(s->inf.filesystem->time.read)) : Filesystem_getLatency(&(s->inf.filesystem->write), &(s->inf.filesystem->time.write));
+                                if (latency < 0.) {
+                                        DEBUG("'%s' warning -- no data are available for %s latency test\n", s->name, name);
+                                        return State_Succeeded;
+                                }
+                                if (Util_evalDoubleQExpression(td->operator, latency, td->limit_absolute)) {
+                                        Event_post(s, Event_Resource, State_Failed, td->action, "%s latency %.3fms/operation matches resource limit [%s latency %s %s/operation]", name, latency, name, operatorshortnames[td->operator], Convert_time2str(td->limit_absolute, (char[11]){}));
+                                        return State_Failed;
+                                }
+                                Event_post(s, Event_Resource, State_Succeeded, td->action, "%s latency test succeeded [current %s latency = %.3f ms/operation]", name, name, latency);
+                        }
+                        return State_Succeeded;
+
+                case Resource_Utilization:
+                        {
+                                double utilization = Filesystem_getUtilization(&(s->inf));
+                                if (utilization < 0.) {
+                                        DEBUG("'%s' warning -- no data are available for utilization test\n", s->name);
+                                        return State_Succeeded;
+                                }
+                                if (Util_evalDoubleQExpression(td->operator, utilization, td->limit_percent)) {
+                                        Event_post(s, Event_Resource, State_Failed, td->action, "device utilization %.1f%% matches resource limit [utilization %s %.1f%%]", utilization, operatorshortnames[td->operator], td->limit_percent);
+                                        return State_Failed;
+                                }
+                                Event_post(s, Event_Resource, State_Succeeded, td->action, "utilization test succeeded [current device utilization = %.1f%%]", utilization);
+                        }
+                        return State_Succeeded;
+
+                case Resource_QueueDepth:
+                        {
+                                double depth = Filesystem_getQueueDepth(&(s->inf));
+                                if (depth < 0.) {
+                                        DEBUG("'%s' warning -- no data are available for queue depth test\n", s->name);
+                                        return State_Succeeded;
+                                }
+                                if (Util_evalDoubleQExpression(td->operator, depth, td->limit_percent)) {
+                                        Event_post(s, Event_Resource, State_Failed, td->action, "average queue depth %.2f matches resource limit [queue depth %s %.2f]", depth, operatorshortnames[td->operator], td->limit_percent);
+                                        return State_Failed;
+                                }
+                                Event_post(s, Event_Resource, State_Succeeded, td->action, "queue depth test succeeded [current average queue depth = %.2f]", depth);
+                        }
+                        return State_Succeeded;
+
+                case Resource_SpaceTimeToFull:
+                case Resource_InodeTimeToFull:
+                        {
+                                bool space = td->resource == Resource_SpaceTimeToFull;
+                                const char *name = space ? "space" : "inode";
+                                Trend_T trend = space ? s->inf.filesystem->trend.space : s->inf.filesystem->trend.inode;
+                                double rate;
+                                if (! trend || ! Trend_rate(trend, td->window, &rate)) {
+                                        DEBUG("'%s' warning -- not enough history for %s time-to-full test\n", s->name, name);
+                                        return State_Succeeded;
+                                }
+                                double available = space ? (double)s->inf.filesystem->f_blocksfree * (double)s->inf.filesystem->f_bsize : (double)s->inf.filesystem->f_filesfree;
+                                long long timeToFull = rate < 0. && available / -rate < TIMETOFULL_MAX ? (long long)(available / -rate) : -1LL;
+                                if (space)
+                                        s->inf.filesystem->timeToFull.space = timeToFull;
+                                else
+                                        s->inf.filesystem->timeToFull.inode = timeToFull;
+                                if (timeToFull < 0) {
+                                        Event_post(s, Event_Resource, State_Succeeded, td->action, "%s time-to-full test succeeded [%s usage is not growing]", name, name);
+                                        return State_Succeeded;
+                                }
+                                if (Util_evalQExpression(td->operator, timeToFull, td->limit_absolute)) {
+                                        Event_post(s, Event_Resource, State_Failed, td->action, "%s time-to-full %s matches resource limit [%s time-to-full %s %s]", name, Convert_time2str(timeToFull * 1000., (char[11]){}), name, operatorshortnames[td->operator], Convert_time2str(td->limit_absolute * 1000., (char[11]){}));
+                                        return State_Failed;
+                                }
+                                Event_post(s, Event_Resource, State_Succeeded, td->action, "%s time-to-full test succeeded [current %s time-to-full = %s]", name, name, Convert_time2str(timeToFull * 1000., (char[11]){}));
+                        }
+                        return State_Succeeded;
+
+                case Resource_Iops:
+                        {
+                                double iops = Filesystem_getIOPS(&(s->inf));
+                                if (iops < 0.) {
+                                        DEBUG("'%s' warning -- no data are available for iops test\n", s->name);
+                                        return State_Succeeded;
+                                }
+                                if (Util_evalDoubleQExpression(td->operator, iops, td->limit_absolute)) {
+                                        Event_post(s, Event_Resource, State_Failed, td->action, "iops %.1f operations/s matches resource limit [iops %s %llu]", iops, operatorshortnames[td->operator], td->limit_absolute);
+                                        return State_Failed;
+                                }
+                                Event_post(s, Event_Resource, State_Succeeded, td->action, "iops test succeeded [current iops = %.1f operations/s]", iops);
+                        }
+                        return State_Succeeded;
+
                 default:
                         Log_error("'%s' error -- unknown resource type: [%d]\n", s->name, td->resource);
                         return State_Failed;
@@ -1379,6 +1708,284 @@ static State_Type _checkFilesystemResources(Service_T s, FileSystem_T td) {
 }
 
 
+/**
+ * Record the available space and inodes for the time-to-full tests. The
+ * history is kept only if such a test is configured and covers the
+ * longest configured window
+ */
+static void _updateFilesystemTrend(Service_T s) {
+        int spaceWindow = 0, inodeWindow = 0;
+        for (FileSystem_T fs = s->filesystemlist; fs; fs = fs->next) {
+                if (fs->resource == Resource_SpaceTimeToFull && fs->window > spaceWindow)
+                        spaceWindow = fs->window;
+                else if (fs->resource == Resource_InodeTimeToFull && fs->window > inodeWindow)
+                        inodeWindow = fs->window;
+        }
+        time_t now = Time_now();
+        if (spaceWindow) {
+                if (! s->inf.filesystem->trend.space)
+                        s->inf.filesystem->trend.space = Trend_new(spaceWindow);
+                Trend_add(s->inf.filesystem->trend.space, now, (double)s->inf.filesystem->f_blocksfree * (double)s->inf.filesystem->f_bsize);
+        }
+        if (inodeWindow && s->inf.filesystem->f_files > 0) {
+                if (! s->inf.filesystem->trend.inode)
+                        s->inf.filesystem->trend.inode = Trend_new(inodeWindow);
+                Trend_add(s->inf.filesystem->trend.inode, now, s->inf.filesystem->f_filesfree);
+        }
+}
+
+
+/**
+ * Directory resource test
+ */
+static State_Type _checkDirectoryResources(Service_T s, Resource_T r) {
+        ASSERT(s);
+        ASSERT(r);
+        State_Type rv = State_Succeeded;
+        char report[STRLEN] = {}, buf1[11], buf2[11];
+        switch (r->resource_id) {
+                case Resource_DirectoryEntries:
+                        if (Util_evalDoubleQExpression(r->operator, s->inf.directory->entries, r->limit)) {
+                                rv = State_Failed;
+                                snprintf(report, STRLEN, "number of entries %lld matches resource limit [entries %s %.0f]", s->inf.directory->entries, operatorshortnames[r->operator], r->limit);
+                        } else {
+                                snprintf(report, STRLEN, "number of entries check succeeded [current entries = %lld]", s->inf.directory->entries);
+                        }
+                        break;
+
+                case Resource_DirectorySize:
+                        if (Util_evalDoubleQExpression(r->operator, s->inf.directory->size, r->limit)) {
+                                rv = State_Failed;
+                                snprintf(report, STRLEN, "total size %s matches resource limit [total size %s %s]", Convert_bytes2str(s->inf.directory->size, buf1), operatorshortnames[r->operator], Convert_bytes2str(r->limit, buf2));
+                        } else {
+                                snprintf(report, STRLEN, "total size check succeeded [current total size = %s]", Convert_bytes2str(s->inf.directory->size, buf1));
+                        }
+                        break;
+
+                case Resource_DirectoryOldest:
+                        if (s->inf.directory->oldest <= 0) {
+                                snprintf(report, STRLEN, "oldest entry check succeeded [directory is empty]");
+                        } else {
+                                double age = difftime(Time_now(), s->inf.directory->oldest);
+                                if (age < 0.)
+                                        age = 0.;
+                                if (Util_evalDoubleQExpression(r->operator, age, r->limit)) {
+                                        rv = State_Failed;
+                                        snprintf(report, STRLEN, "oldest entry age %s matches resource limit [oldest %s %s]", Convert_time2str(age * 1000., buf1), operatorshortnames[r->operator], Convert_time2str(r->limit * 1000., buf2));
+                                } else {
+                                        snprintf(report, STRLEN, "oldest entry check succeeded [current oldest entry age = %s]", Convert_time2str(age * 1000., buf1));
+                                }
+                        }
+                        break;
+
+                default:
+                        Log_error("'%s' error -- unknown resource ID: [%d]\n", s->name, r->resource_id);
+                        return State_Failed;
+        }
+        Event_post(s, Event_Resource, rv, r->action, "%s", report);
+        return rv;
+}
+
+
+/**
+ * Offending files of a fileset test: the first FILESET_REPORT_PATHS paths
+ * are named in the event, the rest is only counted
+ */
+typedef struct FilesetMatch_T {
+        int count;
+        StringBuffer_T paths;
+} *FilesetMatch_T;
+
+
+static void _filesetMatchReset(FilesetMatch_T m) {
+        m->count = 0;
+        StringBuffer_clear(m->paths);
+}
+
+
+static void _filesetMatch(FilesetMatch_T m, FileSet_T set, FileSetEntry_T e, bool failed) {
+        if (failed)
+                e->flags |= FileSet_Failed;
+        if (m->count++ < FILESET_REPORT_PATHS)
+                StringBuffer_append(m->paths, "%s%s", m->count > 1 ? ", " : "", FileSet_path(set, e));
+}
+
+
+static const char *_filesetMatches(FilesetMatch_T m) {
+        if (m->count > FILESET_REPORT_PATHS)
+                StringBuffer_append(m->paths, " and %d more", m->count - FILESET_REPORT_PATHS);
+        return StringBuffer_toString(m->paths);
+}
+
+
+static State_Type _checkFilesetChecksum(Service_T s, FilesetMatch_T m) {
+        Checksum_T cs = s->checksum;
+        FileSet_T set = s->inf.fileset->set;
+        int count = FileSet_count(set);
+        State_Type rv = State_Succeeded;
+        _filesetMatchReset(m);
+        for (int i = 0; i < count; i++) {
+                FileSetEntry_T e = FileSet_get(set, i);
+                if (e->flags & FileSet_ChecksumError)
+                        _filesetMatch(m, set, e, true);
+        }
+        if (m->count) {
+                rv = State_Failed;
+                Event_post(s, Event_Data, State_Failed, s->action_DATA, "cannot compute checksum for %d files: %s", m->count, _filesetMatches(m));
+        } else {
+                Event_post(s, Event_Data, State_Succeeded, s->action_DATA, "checksum computed for %d files", count);
+        }
+        _filesetMatchReset(m);
+        for (int i = 0; i < count; i++) {
+                FileSetEntry_T e = FileSet_get(set, i);
+                if (e->flags & (cs->test_changes ? FileSet_ChecksumChanged : FileSet_ChecksumMismatch))
+                        _filesetMatch(m, set, e, ! cs->test_changes);
+        }
+        if (cs->test_changes) {
+                if (m->count) {
+                        rv = State_Changed;
+                        Event_post(s, Event_Checksum, State_Changed, cs->action, "checksum changed for %d files: %s", m->count, _filesetMatches(m));
+                } else {
+                        Event_post(s, Event_Checksum, State_ChangedNot, cs->action, "checksum has not changed");
+                }
+        } else if (m->count) {
+                rv = State_Failed;
+                Event_post(s, Event_Checksum, State_Failed, cs->action, "checksum failed for %d of %d files: %s", m->count, count, _filesetMatches(m));
+        } else {
+                Event_post(s, Event_Checksum, State_Succeeded, cs->action, "checksum is valid for %d files", count);
+        }
+        return rv;
+}
+
+
+static State_Type _checkFilesetPerm(Service_T s, FilesetMatch_T m) {
+        FileSet_T set = s->inf.fileset->set;
+        int count = FileSet_count(set);
+        _filesetMatchReset(m);
+        for (int i = 0; i < count; i++) {
+                FileSetEntry_T e = FileSet_get(set, i);
+                if (s->perm->test_changes ? (e->flags & FileSet_ModeChanged) : (e->mode & 07777) != (uint32_t)s->perm->perm)
+                        _filesetMatch(m, set, e, ! s->perm->test_changes);
+        }
+        if (s->perm->test_changes) {
+                if (m->count) {
+                        Event_post(s, Event_Permission, State_Changed, s->perm->action, "permission changed for %d files: %s", m->count, _filesetMatches(m));
+                        return State_Changed;
+                }
+                Event_post(s, Event_Permission, State_ChangedNot, s->perm->action, "permission not changed");
+                return State_ChangedNot;
+        } else if (m->count) {
+                Event_post(s, Event_Permission, State_Failed, s->perm->action, "permission test failed for %d of %d files: %s [expected permission %04o]", m->count, count, _filesetMatches(m), s->perm->perm);
+                return State_Failed;
+        }
+        Event_post(s, Event_Permission, State_Succeeded, s->perm->action, "permission test succeeded for %d files", count);
+        return State_Succeeded;
+}
+
+
+static State_Type _checkFilesetOwner(Service_T s, FilesetMatch_T m, bool group) {
+        FileSet_T set = s->inf.fileset->set;
+        int count = FileSet_count(set);
+        uint32_t expected = group ? (uint32_t)s->gid->gid : (uint32_t)s->uid->uid;
+        EventAction_T action = group ? s->gid->action : s->uid->action;
+        Event_Type event = group ? Event_Gid : Event_Uid;
+        const char *name = group ? "gid" : "uid";
+        _filesetMatchReset(m);
+        for (int i = 0; i < count; i++) {
+                FileSetEntry_T e = FileSet_get(set, i);
+                if ((group ? e->gid : e->uid) != expected)
+                        _filesetMatch(m, set, e, true);
+        }
+        if (m->count) {
+                Event_post(s, event, State_Failed, action, "%s test failed for %d of %d files: %s [expected %s %u]", name, m->count, count, _filesetMatches(m), name, expected);
+                return State_Failed;
+        }
+        Event_post(s, event, State_Succeeded, action, "%s test succeeded for %d files", name, count);
+        return State_Succeeded;
+}
+
+
+static State_Type _checkFilesetSize(Service_T s, FilesetMatch_T m) {
+        FileSet_T set = s->inf.fileset->set;
+        int count = FileSet_count(set);
+        State_Type rv = State_Succeeded;
+        char buf[10];
+        for (Size_T sl = s->sizelist; sl; sl = sl->next) {
+                _filesetMatchReset(m);
+                for (int i = 0; i < count; i++) {
+                        FileSetEntry_T e = FileSet_get(set, i);
+                        if (sl->test_changes ? (e->flags & FileSet_SizeChanged) : Util_evalQExpression(sl->operator, e->size, sl->size))
+                                _filesetMatch(m, set, e, ! sl->test_changes);
+                }
+                if (sl->test_changes) {
+                        if (m->count) {
+                                rv = State_Changed;
+                                Event_post(s, Event_Size, State_Changed, sl->action, "size changed for %d files: %s", m->count, _filesetMatches(m));
+                        } else {
+                                Event_post(s, Event_Size, State_ChangedNot, sl->action, "size has not changed");
+                        }
+                } else if (m->count) {
+                        rv = State_Failed;
+                        Event_post(s, Event_Size, State_Failed, sl->action, "size test failed for %d of %d files: %s [size %s %s]", m->count, count, _filesetMatches(m), operatorshortnames[sl->operator], Convert_bytes2str(sl->size, buf));
+                } else {
+                        Event_post(s, Event_Size, State_Succeeded, sl->action, "size check succeeded for %d files", count);
+                }
+        }
+        return rv;
+}
+
+
+static State_Type _checkFilesetTimestamps(Service_T s, FilesetMatch_T m) {
+        FileSet_T set = s->inf.fileset->set;
+        int count = FileSet_count(set);
+        State_Type rv = State_Succeeded;
+        time_t now = Time_now();
+        for (Timestamp_T t = s->timestamplist; t; t = t->next) {
+                int changed;
+                switch (t->type) {
+                        case Timestamp_Access:
+                                changed = FileSet_AccessChanged;
+                                break;
+                        case Timestamp_Change:
+                                changed = FileSet_ChangeChanged;
+                                break;
+                        case Timestamp_Modification:
+                                changed = FileSet_ModifyChanged;
+                                break;
+                        default:
+                                changed = FileSet_ChangeChanged | FileSet_ModifyChanged;
+                                break;
+                }
+                _filesetMatchReset(m);
+                for (int i = 0; i < count; i++) {
+                        FileSetEntry_T e = FileSet_get(set, i);
+                        if (t->test_changes) {
+                                if (e->flags & changed)
+                                        _filesetMatch(m, set, e, false);
+                        } else {
+                                time_t timestamp = t->type == Timestamp_Access ? e->atime : t->type == Timestamp_Change ? e->ctime : t->type == Timestamp_Modification ? e->mtime : MAX(e->mtime, e->ctime);
+                                if (Util_evalQExpression(t->operator, now - timestamp, t->time))
+                                        _filesetMatch(m, set, e, true);
+                        }
+                }
+                if (t->test_changes) {
+                        if (m->count) {
+                                rv = State_Changed;
+                                Event_post(s, Event_Timestamp, State_Changed, t->action, "%s changed for %d files: %s", timestampnames[t->type], m->count, _filesetMatches(m));
+                        } else {
+                                Event_post(s, Event_Timestamp, State_ChangedNot, t->action, "%s was not changed", timestampnames[t->type]);
+                        }
+                } else if (m->count) {
+                        rv = State_Failed;
+                        Event_post(s, Event_Timestamp, State_Failed, t->action, "%s test failed for %d of %d files: %s", timestampnames[t->type], m->count, count, _filesetMatches(m));
+                } else {
+                        Event_post(s, Event_Timestamp, State_Succeeded, t->action, "%s test succeeded for %d files", timestampnames[t->type], count);
+                }
+        }
+        return rv;
+}
+
+
 static void _checkTimeout(Service_T s) {
         if (s->actionratelist) {
                 /* Start counting cycles */
@@ -1458,6 +2065,65 @@ static bool _checkSkip(Service_T s) {
 }
 
 
+/**
+ * Returns true if the service is likely to be checked in this cycle. Unlike
+ * _checkSkip() this has no side effects and ignores the dependencies
+ */
+static bool _isDue(Service_T s) {
+        if (s->monitor == Monitor_Not || s->doaction != Action_Ignored)
+                return false;
+        switch (s->every.type) {
+                case Every_SkipCycles:
+                        return s->every.spec.cycle.counter + 1 >= s->every.spec.cycle.number;
+                case Every_Cron:
+                        return (Time_now() - s->every.last_run) > 59 && Time_incron(s->every.spec.cron, Time_now());
+                case Every_NotInCron:
+                        return ! Time_incron(s->every.spec.cron, Time_now());
+                default:
+                        break;
+        }
+        return true;
+}
+
+
+/**
+ * Ping all remote hosts due in this cycle concurrently, check_remote_host() then uses the result
+ */
+static void _pingHosts(void) {
+        int count = 0;
+        for (Service_T s = servicelist; s; s = s->next) {
+                if (s->type == Service_Host) {
+                        bool due = _isDue(s);
+                        for (Icmp_T icmp = s->icmplist; icmp; icmp = icmp->next) {
+                                icmp->probed = false; // Drop the result from the previous cycle if the service was skipped
+                                if (due && icmp->type == ICMP_ECHO)
+                                        count++;
+                        }
+                }
+        }
+        if (count) {
+                const char **hostnames = CALLOC(count, sizeof(char *));
+                Icmp_T *icmps = CALLOC(count, sizeof(Icmp_T));
+                count = 0;
+                for (Service_T s = servicelist; s; s = s->next) {
+                        if (s->type == Service_Host && _isDue(s)) {
+                                for (Icmp_T icmp = s->icmplist; icmp; icmp = icmp->next) {
+                                        if (icmp->type == ICMP_ECHO) {
+                                                hostnames[count] = s->path;
+                                                icmps[count++] = icmp;
+                                        }
+                                }
+                        }
+                }
+                icmp_echo(hostnames, icmps, count);
+                for (int i = 0; i < count; i++)
+                        icmps[i]->probed = true;
+                FREE(icmps);
+                FREE(hostnames);
+        }
+}
+
+
 /**
  * Returns true if scheduled action was performed
  */
@@ -1482,6 +2148,7 @@ static bool _doScheduledAction(Service_T s) {
  *  they will pass all defined tests.
  */
 int validate() {
+        _cycle++;
         Run.handler_flag = Handler_Succeeded;
         Event_queue_process();
 
@@ -1497,6 +2164,9 @@ int validate() {
         }
 
         int errors = 0;
+        StatCache_start();
+        MountTable_check();
+        _pingHosts();
         /* Check the services */
         for (Service_T s = servicelist; s && ! interrupt(); s = s->next) {
                 // FIXME: The Service_Program must collect the exit value from last run, even if the program start should be skipped in this cycle => let check program always run the test (to be refactored with new scheduler)
@@ -1512,6 +2182,7 @@ int validate() {
                         gettimeofday(&s->collected, NULL);
                 }
         }
+        StatCache_stop();
         return errors;
 }
 
@@ -1604,6 +2275,15 @@ State_Type check_process(Service_T s) {
                         DEBUG("'%s' connection test paused for %s while the process is starting\n", s->name, Convert_time2str(s->start->timeout - (uptimeMilli < 0 ? 0 : uptimeMilli), (char[11]){}));
                 }
         }
+        if (s->listenlist) {
+                /* pause listen tests in the start timeout timeframe as well, the process may not have bound its sockets yet */
+                if (! s->start || uptimeMilli > s->start->timeout) {
+                        if (_checkListen(s, (int)pid) == State_Failed)
+                                rv = State_Failed;
+                } else {
+                        DEBUG("'%s' listen test paused for %s while the process is starting\n", s->name, Convert_time2str(s->start->timeout - (uptimeMilli < 0 ? 0 : uptimeMilli), (char[11]){}));
+                }
+        }
         return rv;
 }
 
@@ -1616,6 +2296,11 @@ State_Type check_filesystem(Service_T s) {
         ASSERT(s);
         State_Type rv = State_Succeeded;
         if (! filesystem_usage(s)) {
+                if (s->inf.filesystem->timeout) {
+                        // Hung filesystem (e.g. unreachable NFS server): don't report it as non-existent, the state is unknown
+                        Event_post(s, Event_Data, State_Failed, s->action_DATA, "filesystem '%s' probe timed out", s->path);
+                        return State_Failed;
+                }
                 for (NonExist_T l = s->nonexistlist; l; l = l->next) {
                         rv = State_Failed;
                         Event_post(s, Event_NonExist, State_Failed, l->action, "unable to read filesystem '%s' state", s->path);
@@ -1625,6 +2310,8 @@ State_Type check_filesystem(Service_T s) {
                 }
                 return rv;
         }
+        if (IS_EVENT_SET(s->error, Event_Data))
+                Event_post(s, Event_Data, State_Succeeded, s->action_DATA, "filesystem '%s' probe succeeded", s->path);
         for (NonExist_T l = s->nonexistlist; l; l = l->next) {
                 Event_post(s, Event_NonExist, State_Succeeded, l->action, "succeeded getting filesystem statistics for '%s'", s->path);
         }
@@ -1643,6 +2330,7 @@ State_Type check_filesystem(Service_T s) {
                 rv = State_Failed;
         if (_checkFilesystemFlags(s) == State_Failed)
                 rv = State_Failed;
+        _updateFilesystemTrend(s);
         for (FileSystem_T fs = s->filesystemlist; fs; fs = fs->next)
                 if (_checkFilesystemResources(s, fs) == State_Failed)
                         rv = State_Failed;
@@ -1658,7 +2346,7 @@ State_Type check_file(Service_T s) {
         ASSERT(s);
         struct stat stat_buf;
         State_Type rv = State_Succeeded;
-        if (stat(s->path, &stat_buf) != 0) {
+        if (StatCache_stat(s->path, &stat_buf) != 0) {
                 for (NonExist_T l = s->nonexistlist; l; l = l->next) {
                         rv = State_Failed;
                         Event_post(s, Event_NonExist, State_Failed, l->action, "file doesn't exist");
@@ -1678,6 +2366,7 @@ State_Type check_file(Service_T s) {
                         s->inf.file->inode_prev = stat_buf.st_ino;
                 }
                 s->inf.file->inode = stat_buf.st_ino;
+                s->inf.file->device = stat_buf.st_dev;
                 s->inf.file->uid = stat_buf.st_uid;
                 s->inf.file->gid = stat_buf.st_gid;
                 s->inf.file->size = stat_buf.st_size;
@@ -1728,7 +2417,7 @@ State_Type check_directory(Service_T s) {
         ASSERT(s);
         struct stat stat_buf;
         State_Type rv = State_Succeeded;
-        if (stat(s->path, &stat_buf) != 0) {
+        if (StatCache_stat(s->path, &stat_buf) != 0) {
                 for (NonExist_T l = s->nonexistlist; l; l = l->next) {
                         rv = State_Failed;
                         Event_post(s, Event_NonExist, State_Failed, l->action, "directory doesn't exist");
@@ -1769,6 +2458,26 @@ State_Type check_directory(Service_T s) {
                 rv = State_Failed;
         if (_checkTimestamps(s, s->inf.directory->timestamp.access, s->inf.directory->timestamp.change, s->inf.directory->timestamp.modify) == State_Failed)
                 rv = State_Failed;
+        if (s->resourcelist) {
+                if (! s->inf.directory->index)
+                        s->inf.directory->index = DirIndex_new(s->path);
+                if (DirIndex_update(s->inf.directory->index)) {
+                        s->inf.directory->entries = DirIndex_entries(s->inf.directory->index);
+                        s->inf.directory->size = DirIndex_size(s->inf.directory->index);
+                        s->inf.directory->oldest = DirIndex_oldest(s->inf.directory->index);
+                        Event_post(s, Event_Data, State_Succeeded, s->action_DATA, "directory content read");
+                        for (Resource_T r = s->resourcelist; r; r = r->next) {
+                                if (_checkDirectoryResources(s, r) == State_Failed)
+                                        rv = State_Failed;
+                        }
+                } else {
+                        s->inf.directory->entries = -1LL;
+                        s->inf.directory->size = -1LL;
+                        s->inf.directory->oldest = 0;
+                        Event_post(s, Event_Data, State_Failed, s->action_DATA, "cannot read directory content -- %s", STRERROR);
+                        rv = State_Failed;
+                }
+        }
         return rv;
 }
 
@@ -1781,7 +2490,7 @@ State_Type check_fifo(Service_T s) {
         ASSERT(s);
         struct stat stat_buf;
         State_Type rv = State_Succeeded;
-        if (stat(s->path, &stat_buf) != 0) {
+        if (StatCache_stat(s->path, &stat_buf) != 0) {
                 for (NonExist_T l = s->nonexistlist; l; l = l->next) {
                         rv = State_Failed;
                         Event_post(s, Event_NonExist, State_Failed, l->action, "fifo doesn't exist");
@@ -1826,6 +2535,74 @@ State_Type check_fifo(Service_T s) {
 }
 
 
+/**
+ * Validate a given fileset service s. Every file matching the pattern is
+ * tested and one event per test names the offending files. In case of a
+ * fatal event false is returned.
+ */
+State_Type check_fileset(Service_T s) {
+        ASSERT(s);
+        State_Type rv = State_Succeeded;
+        FileSetInfo_T info = s->inf.fileset;
+        if (! info->set)
+                info->set = FileSet_new(s->path);
+        int count = FileSet_update(info->set, s->checksum);
+        if (count < 0) {
+                info->entries = -1;
+                Event_post(s, Event_Data, State_Failed, s->action_DATA, "cannot expand pattern %s -- %s", s->path, STRERROR);
+                return State_Failed;
+        }
+        info->entries = count;
+        info->size = 0LL;
+        for (int i = 0; i < count; i++) {
+                FileSetEntry_T e = FileSet_get(info->set, i);
+                e->flags &= ~FileSet_Failed;
+                info->size += e->size;
+        }
+        if (count == 0) {
+                info->failed = 0;
+                for (NonExist_T l = s->nonexistlist; l; l = l->next) {
+                        rv = State_Failed;
+                        Event_post(s, Event_NonExist, State_Failed, l->action, "no file matches the pattern");
+                }
+                for (Exist_T l = s->existlist; l; l = l->next) {
+                        Event_post(s, Event_Exist, State_Succeeded, l->action, "no file matches the pattern");
+                }
+                return rv;
+        }
+        for (NonExist_T l = s->nonexistlist; l; l = l->next) {
+                Event_post(s, Event_NonExist, State_Succeeded, l->action, "%d files match the pattern", count);
+        }
+        for (Exist_T l = s->existlist; l; l = l->next) {
+                rv = State_Failed;
+                Event_post(s, Event_Exist, State_Failed, l->action, "%d files match the pattern", count);
+        }
+        // Double-check the monitoring state: the "if does exist" may call unmonitor/stop, which resets the service object
+        if (s->monitor == Monitor_Not)
+                return rv;
+        struct FilesetMatch_T m = {.paths = StringBuffer_create(256)};
+        if (s->checksum && _checkFilesetChecksum(s, &m) == State_Failed)
+                rv = State_Failed;
+        if (s->perm && _checkFilesetPerm(s, &m) == State_Failed)
+                rv = State_Failed;
+        if (s->uid && _checkFilesetOwner(s, &m, false) == State_Failed)
+                rv = State_Failed;
+        if (s->gid && _checkFilesetOwner(s, &m, true) == State_Failed)
+                rv = State_Failed;
+        if (_checkFilesetSize(s, &m) == State_Failed)
+                rv = State_Failed;
+        if (_checkFilesetTimestamps(s, &m) == State_Failed)
+                rv = State_Failed;
+        StringBuffer_free(&(m.paths));
+        info->failed = 0;
+        for (int i = 0; i < count; i++) {
+                if (FileSet_get(info->set, i)->flags & FileSet_Failed)
+                        info->failed++;
+        }
+        return rv;
+}
+
+
 /**
  * Validate a program status. Events are posted according to
  * its configuration. In case of a fatal event false is returned.
@@ -1918,7 +2695,10 @@ State_Type check_remote_host(Service_T s) {
         for (Icmp_T icmp = s->icmplist; icmp; icmp = icmp->next) {
                 switch (icmp->type) {
                         case ICMP_ECHO:
-                                icmp->response = icmp_echo(s->path, icmp->family, &(icmp->outgoing), icmp->size, icmp->timeout, icmp->count);
+                                // The ping was normally done already for all hosts concurrently at the beginning of the cycle, see _pingHosts()
+                                if (! icmp->probed)
+                                        icmp_echo((const char *[]){s->path}, (Icmp_T []){icmp}, 1);
+                                icmp->probed = false;
                                 if (icmp->response == -2) {
                                         icmp->is_available = Connection_Init;
 #ifdef SOLARIS
@@ -1932,7 +2712,7 @@ State_Type check_remote_host(Service_T s) {
                                         Event_post(s, Event_Icmp, State_Failed, icmp->action, "ping test failed");
                                 } else {
                                         icmp->is_available = Connection_Ok;
-                                        Event_post(s, Event_Icmp, State_Succeeded, icmp->action, "ping test succeeded [response time %s]", Convert_time2str(icmp->response, (char[11]){}));
+                                        Event_post(s, Event_Icmp, State_Succeeded, icmp->action, "ping test succeeded [response time %s, jitter %s, loss %.0f%%]", Convert_time2str(icmp->response, (char[11]){}), Convert_time2str(icmp->jitter, (char[11]){}), icmp->loss);
                                 }
                                 last_ping = icmp;
                                 break;
@@ -1970,6 +2750,8 @@ State_Type check_system(Service_T s) {
                 if (_checkSystemFiledescriptors(s) == State_Failed)
                         rv = State_Failed;
         }
+        if (_checkListen(s, 0) == State_Failed)
+                rv = State_Failed;
         return rv;
 }
 
@@ -2145,6 +2927,31 @@ State_Type check_net(Service_T s) {
                 else
                         Event_post(s, Event_PacketIn, State_Succeeded, download->action, "%sdownload packets check succeeded [current download packets %lld in last %d %s]", download->range != Time_Second ? "total " : "", ipackets, download->rangecount, Util_timestr(download->range));
         }
+        // Extended counters (drops, FIFO errors, etc.)
+        for (Bandwidth_T counter = s->linkcounterlist; counter; counter = counter->next) {
+                long long value;
+                switch (counter->range) {
+                        case Time_Minute:
+                                value = Link_getCounterPerMinute(s->inf.net->stats, counter->counter, counter->rangecount);
+                                break;
+                        case Time_Hour:
+                                if (counter->rangecount == 1) // Use precise minutes range for "last hour"
+                                        value = Link_getCounterPerMinute(s->inf.net->stats, counter->counter, 60);
+                                else
+                                        value = Link_getCounterPerHour(s->inf.net->stats, counter->counter, counter->rangecount);
+                                break;
+                        default:
+                                value = Link_getCounterPerSecond(s->inf.net->stats, counter->counter);
+                                break;
+                }
+                long id = counter->counter == LinkCounter_DropsIn || counter->counter == LinkCounter_MissedIn || counter->counter == LinkCounter_FifoIn || counter->counter == LinkCounter_MulticastIn ? Event_PacketIn : Event_PacketOut;
+                if (value < 0)
+                        DEBUG("'%s' %s statistics are not available on this interface\n", s->name, Link_getCounterName(counter->counter));
+                else if (Util_evalQExpression(counter->operator, value, counter->limit))
+                        Event_post(s, id, State_Failed, counter->action, "%s%s %lld matches limit [%s %s %lld in last %d %s]", counter->range != Time_Second ? "total " : "", Link_getCounterName(counter->counter), value, Link_getCounterName(counter->counter), operatorshortnames[counter->operator], counter->limit, counter->rangecount, Util_timestr(counter->range));
+                else
+                        Event_post(s, id, State_Succeeded, counter->action, "%s%s check succeeded [current %s %lld in last %d %s]", counter->range != Time_Second ? "total " : "", Link_getCounterName(counter->counter), Link_getCounterName(counter->counter), value, counter->rangecount, Util_timestr(counter->range));
+        }
         return rv;
 }
 
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+/* XXH64 non-cryptographic hash (seed 0), compatible with xxhsum -H64 */
+
+#include "config.h"
+
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+#include "xxh64.h"
+
+#define PRIME1 0x9E3779B185EBCA87ULL
+#define PRIME2 0xC2B2AE3D27D4EB4FULL
+#define PRIME3 0x165667B19E3779F9ULL
+#define PRIME4 0x85EBCA77C2B2AE63ULL
+#define PRIME5 0x27D4EB2F165667C5ULL
+
+#define rol(value, bits) (((value) << (bits)) | ((value) >> (64 - (bits))))
+
+
+static inline unsigned long long _read64(const unsigned char *p) {
+        return (unsigned long long)p[0] | ((unsigned long long)p[1] << 8) | ((unsigned long long)p[2] << 16) | ((unsigned long long)p[3] << 24) |
+               ((unsigned long long)p[4] << 32) | ((unsigned long long)p[5] << 40) | ((unsigned long long)p[6] << 48) | ((unsigned long long)p[7] << 56);
+}
+
+
+static inline unsigned int _read32(const unsigned char *p) {
+        return (unsigned int)p[0] | ((unsigned int)p[1] << 8) | ((unsigned int)p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+
+static inline unsigned long long _round(unsigned long long acc, unsigned long long input) {
+        acc += input * PRIME2;
+        acc = rol(acc, 31);
+        return acc * PRIME1;
+}
+
+
+static inline unsigned long long _merge(unsigned long long acc, unsigned long long v) {
+        acc ^= _round(0, v);
+        return acc * PRIME1 + PRIME4;
+}
+
+
+/* Consume one 32-byte stripe */
+static inline void _stripe(unsigned long long v[4], const unsigned char *p) {
+        v[0] = _round(v[0], _read64(p));
+        v[1] = _round(v[1], _read64(p + 8));
+        v[2] = _round(v[2], _read64(p + 16));
+        v[3] = _round(v[3], _read64(p + 24));
+}
+
+
+/* Initialize new context */
+void xxh64_init(xxh64_context_t *context) {
+        memset(context, 0, sizeof(*context));
+        context->v[0] = PRIME1 + PRIME2;
+        context->v[1] = PRIME2;
+        context->v[2] = 0;
+        context->v[3] = -PRIME1;
+}
+
+
+/* Run your data through this. */
+void xxh64_append(xxh64_context_t *context, const unsigned char *data, const size_t len) {
+        size_t i = 0;
+
+        context->total += len;
+        if (context->buffered + len < 32) {
+                memcpy(context->buffer + context->buffered, data, len);
+                context->buffered += (unsigned int)len;
+                return;
+        }
+        if (context->buffered) {
+                i = 32 - context->buffered;
+                memcpy(context->buffer + context->buffered, data, i);
+                _stripe(context->v, context->buffer);
+                context->buffered = 0;
+        }
+        for (; i + 32 <= len; i += 32)
+                _stripe(context->v, data + i);
+        if (i < len) {
+                memcpy(context->buffer, data + i, len - i);
+                context->buffered = (unsigned int)(len - i);
+        }
+}
+
+
+/* Mix the tail and return the 64-bit hash in big-endian (canonical) byte order. */
+void xxh64_finish(xxh64_context_t *context, unsigned char digest[XXH64_DIGEST_SIZE]) {
+        unsigned long long h;
+        const unsigned char *p = context->buffer;
+        const unsigned char *end = p + context->buffered;
+        int i;
+
+        if (context->total >= 32) {
+                h = rol(context->v[0], 1) + rol(context->v[1], 7) + rol(context->v[2], 12) + rol(context->v[3], 18);
+                for (i = 0; i < 4; i++)
+                        h = _merge(h, context->v[i]);
+        } else {
+                h = context->v[2] + PRIME5;
+        }
+        h += context->total;
+        for (; p + 8 <= end; p += 8) {
+                h ^= _round(0, _read64(p));
+                h = rol(h, 27) * PRIME1 + PRIME4;
+        }
+        if (p + 4 <= end) {
+                h ^= (unsigned long long)_read32(p) * PRIME1;
+                h = rol(h, 23) * PRIME2 + PRIME3;
+                p += 4;
+        }
+        for (; p < end; p++) {
+                h ^= (*p) * PRIME5;
+                h = rol(h, 11) * PRIME1;
+        }
+        h ^= h >> 33;
+        h *= PRIME2;
+        h ^= h >> 29;
+        h *= PRIME3;
+        h ^= h >> 32;
+        for (i = 0; i < XXH64_DIGEST_SIZE; i++)
+                digest[i] = (unsigned char)(h >> ((7 - i) * 8));
+
+        /* Wipe variables */
+        memset(context, 0, sizeof(*context));
+}
+
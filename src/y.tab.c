@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.5.1.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -34,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -41,14 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
-
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.5.1"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -174,6 +175,8 @@
 #include "processor.h"
 #include "md5.h"
 #include "sha1.h"
+#include "sha256.h"
+#include "xxh64.h"
 #include "checksum.h"
 #include "process_sysdep.h"
 
@@ -275,6 +278,8 @@ static void  adddependant(char *);
 static void  addservicegroup(char *);
 static void  addport(Port_T *, Port_T);
 static void  addhttpheader(Port_T, const char *);
+static void  addhttp2stream(Port_T, char *);
+static void  addtiming(Timing_Type, Operator_Type, double);
 static void  addresource(Resource_T);
 static void  addtimestamp(Timestamp_T);
 static void  addactionrate(ActionRate_T);
@@ -291,7 +296,7 @@ static void  addlinksaturation(Service_T, LinkSaturation_T);
 static void  addbandwidth(Bandwidth_T *, Bandwidth_T);
 static void  addfilesystem(FileSystem_T);
 static void  addicmp(Icmp_T);
-static void  addgeneric(Port_T, char*, char*);
+static void  addgeneric(Port_T, char*, char*, bool);
 static void  addcommand(int, unsigned);
 static void  addargument(char *);
 static void  addmmonit(Mmonit_T);
@@ -349,6 +354,7 @@ static int   check_perm(int);
 static void  check_exec(char *);
 static int   cleanup_hash_string(char *);
 static void  check_depend(void);
+static void  shareprobes(void);
 static void  setsyslog(char *);
 static command_t copycommand(command_t);
 static int verifyMaxForward(int);
@@ -360,9 +366,10 @@ static void _setSSLVersion(short version);
 static void _unsetSSLVersion(short version);
 static void addsecurityattribute(char *, Action_Type, Action_Type);
 static void addfiledescriptors(Operator_Type, bool, long long, float, Action_Type, Action_Type);
+static void addlisten(ListenTest_Type, char *, int, Operator_Type, long long, float, Action_Type, Action_Type);
 
 
-#line 366 "src/y.tab.c"
+#line 373 "src/y.tab.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -385,651 +392,625 @@ static void addfiledescriptors(Operator_Type, bool, long long, float, Action_Typ
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* Use api.header.include to #include this header
-   instead of duplicating it here.  */
-#ifndef YY_YY_SRC_Y_TAB_H_INCLUDED
-# define YY_YY_SRC_Y_TAB_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    IF = 258,
-    ELSE = 259,
-    THEN = 260,
-    FAILED = 261,
-    SET = 262,
-    LOGFILE = 263,
-    FACILITY = 264,
-    DAEMON = 265,
-    SYSLOG = 266,
-    MAILSERVER = 267,
-    HTTPD = 268,
-    ALLOW = 269,
-    REJECTOPT = 270,
-    ADDRESS = 271,
-    INIT = 272,
-    TERMINAL = 273,
-    BATCH = 274,
-    READONLY = 275,
-    CLEARTEXT = 276,
-    MD5HASH = 277,
-    SHA1HASH = 278,
-    CRYPT = 279,
-    DELAY = 280,
-    PEMFILE = 281,
-    PEMKEY = 282,
-    PEMCHAIN = 283,
-    ENABLE = 284,
-    DISABLE = 285,
-    SSLTOKEN = 286,
-    CIPHER = 287,
-    CLIENTPEMFILE = 288,
-    ALLOWSELFCERTIFICATION = 289,
-    SELFSIGNED = 290,
-    VERIFY = 291,
-    CERTIFICATE = 292,
-    CACERTIFICATEFILE = 293,
-    CACERTIFICATEPATH = 294,
-    VALID = 295,
-    INTERFACE = 296,
-    LINK = 297,
-    PACKET = 298,
-    BYTEIN = 299,
-    BYTEOUT = 300,
-    PACKETIN = 301,
-    PACKETOUT = 302,
-    SPEED = 303,
-    SATURATION = 304,
-    UPLOAD = 305,
-    DOWNLOAD = 306,
-    TOTAL = 307,
-    IDFILE = 308,
-    STATEFILE = 309,
-    SEND = 310,
-    EXPECT = 311,
-    CYCLE = 312,
-    COUNT = 313,
-    REMINDER = 314,
-    REPEAT = 315,
-    LIMITS = 316,
-    SENDEXPECTBUFFER = 317,
-    EXPECTBUFFER = 318,
-    FILECONTENTBUFFER = 319,
-    HTTPCONTENTBUFFER = 320,
-    PROGRAMOUTPUT = 321,
-    NETWORKTIMEOUT = 322,
-    PROGRAMTIMEOUT = 323,
-    STARTTIMEOUT = 324,
-    STOPTIMEOUT = 325,
-    RESTARTTIMEOUT = 326,
-    PIDFILE = 327,
-    START = 328,
-    STOP = 329,
-    PATHTOK = 330,
-    RSAKEY = 331,
-    HOST = 332,
-    HOSTNAME = 333,
-    PORT = 334,
-    IPV4 = 335,
-    IPV6 = 336,
-    TYPE = 337,
-    UDP = 338,
-    TCP = 339,
-    TCPSSL = 340,
-    PROTOCOL = 341,
-    CONNECTION = 342,
-    ALERT = 343,
-    NOALERT = 344,
-    MAILFORMAT = 345,
-    UNIXSOCKET = 346,
-    SIGNATURE = 347,
-    TIMEOUT = 348,
-    RETRY = 349,
-    RESTART = 350,
-    CHECKSUM = 351,
-    EVERY = 352,
-    NOTEVERY = 353,
-    DEFAULT = 354,
-    HTTP = 355,
-    HTTPS = 356,
-    APACHESTATUS = 357,
-    FTP = 358,
-    SMTP = 359,
-    SMTPS = 360,
-    POP = 361,
-    POPS = 362,
-    IMAP = 363,
-    IMAPS = 364,
-    CLAMAV = 365,
-    NNTP = 366,
-    NTP3 = 367,
-    MYSQL = 368,
-    MYSQLS = 369,
-    DNS = 370,
-    WEBSOCKET = 371,
-    MQTT = 372,
-    SSH = 373,
-    DWP = 374,
-    LDAP2 = 375,
-    LDAP3 = 376,
-    RDATE = 377,
-    RSYNC = 378,
-    TNS = 379,
-    PGSQL = 380,
-    POSTFIXPOLICY = 381,
-    SIP = 382,
-    LMTP = 383,
-    GPS = 384,
-    RADIUS = 385,
-    MEMCACHE = 386,
-    REDIS = 387,
-    MONGODB = 388,
-    SIEVE = 389,
-    SPAMASSASSIN = 390,
-    FAIL2BAN = 391,
-    STRING = 392,
-    PATH = 393,
-    MAILADDR = 394,
-    MAILFROM = 395,
-    MAILREPLYTO = 396,
-    MAILSUBJECT = 397,
-    MAILBODY = 398,
-    SERVICENAME = 399,
-    STRINGNAME = 400,
-    NUMBER = 401,
-    PERCENT = 402,
-    LOGLIMIT = 403,
-    CLOSELIMIT = 404,
-    DNSLIMIT = 405,
-    KEEPALIVELIMIT = 406,
-    REPLYLIMIT = 407,
-    REQUESTLIMIT = 408,
-    STARTLIMIT = 409,
-    WAITLIMIT = 410,
-    GRACEFULLIMIT = 411,
-    CLEANUPLIMIT = 412,
-    REAL = 413,
-    CHECKPROC = 414,
-    CHECKFILESYS = 415,
-    CHECKFILE = 416,
-    CHECKDIR = 417,
-    CHECKHOST = 418,
-    CHECKSYSTEM = 419,
-    CHECKFIFO = 420,
-    CHECKPROGRAM = 421,
-    CHECKNET = 422,
-    THREADS = 423,
-    CHILDREN = 424,
-    METHOD = 425,
-    GET = 426,
-    HEAD = 427,
-    STATUS = 428,
-    ORIGIN = 429,
-    VERSIONOPT = 430,
-    READ = 431,
-    WRITE = 432,
-    OPERATION = 433,
-    SERVICETIME = 434,
-    DISK = 435,
-    RESOURCE = 436,
-    MEMORY = 437,
-    TOTALMEMORY = 438,
-    LOADAVG1 = 439,
-    LOADAVG5 = 440,
-    LOADAVG15 = 441,
-    SWAP = 442,
-    MODE = 443,
-    ACTIVE = 444,
-    PASSIVE = 445,
-    MANUAL = 446,
-    ONREBOOT = 447,
-    NOSTART = 448,
-    LASTSTATE = 449,
-    CORE = 450,
-    CPU = 451,
-    TOTALCPU = 452,
-    CPUUSER = 453,
-    CPUSYSTEM = 454,
-    CPUWAIT = 455,
-    CPUNICE = 456,
-    CPUHARDIRQ = 457,
-    CPUSOFTIRQ = 458,
-    CPUSTEAL = 459,
-    CPUGUEST = 460,
-    CPUGUESTNICE = 461,
-    GROUP = 462,
-    REQUEST = 463,
-    DEPENDS = 464,
-    BASEDIR = 465,
-    SLOT = 466,
-    EVENTQUEUE = 467,
-    SECRET = 468,
-    HOSTHEADER = 469,
-    UID = 470,
-    EUID = 471,
-    GID = 472,
-    MMONIT = 473,
-    INSTANCE = 474,
-    USERNAME = 475,
-    PASSWORD = 476,
-    TIME = 477,
-    ATIME = 478,
-    CTIME = 479,
-    MTIME = 480,
-    CHANGED = 481,
-    MILLISECOND = 482,
-    SECOND = 483,
-    MINUTE = 484,
-    HOUR = 485,
-    DAY = 486,
-    MONTH = 487,
-    SSLV2 = 488,
-    SSLV3 = 489,
-    TLSV1 = 490,
-    TLSV11 = 491,
-    TLSV12 = 492,
-    TLSV13 = 493,
-    CERTMD5 = 494,
-    AUTO = 495,
-    NOSSLV2 = 496,
-    NOSSLV3 = 497,
-    NOTLSV1 = 498,
-    NOTLSV11 = 499,
-    NOTLSV12 = 500,
-    NOTLSV13 = 501,
-    BYTE = 502,
-    KILOBYTE = 503,
-    MEGABYTE = 504,
-    GIGABYTE = 505,
-    INODE = 506,
-    SPACE = 507,
-    TFREE = 508,
-    PERMISSION = 509,
-    SIZE = 510,
-    MATCH = 511,
-    NOT = 512,
-    IGNORE = 513,
-    ACTION = 514,
-    UPTIME = 515,
-    EXEC = 516,
-    UNMONITOR = 517,
-    PING = 518,
-    PING4 = 519,
-    PING6 = 520,
-    ICMP = 521,
-    ICMPECHO = 522,
-    NONEXIST = 523,
-    EXIST = 524,
-    INVALID = 525,
-    DATA = 526,
-    RECOVERED = 527,
-    PASSED = 528,
-    SUCCEEDED = 529,
-    URL = 530,
-    CONTENT = 531,
-    PID = 532,
-    PPID = 533,
-    FSFLAG = 534,
-    REGISTER = 535,
-    CREDENTIALS = 536,
-    URLOBJECT = 537,
-    ADDRESSOBJECT = 538,
-    TARGET = 539,
-    TIMESPEC = 540,
-    HTTPHEADER = 541,
-    MAXFORWARD = 542,
-    FIPS = 543,
-    SECURITY = 544,
-    ATTRIBUTE = 545,
-    FILEDESCRIPTORS = 546,
-    GREATER = 547,
-    GREATEROREQUAL = 548,
-    LESS = 549,
-    LESSOREQUAL = 550,
-    EQUAL = 551,
-    NOTEQUAL = 552
-  };
-#endif
-/* Tokens.  */
-#define IF 258
-#define ELSE 259
-#define THEN 260
-#define FAILED 261
-#define SET 262
-#define LOGFILE 263
-#define FACILITY 264
-#define DAEMON 265
-#define SYSLOG 266
-#define MAILSERVER 267
-#define HTTPD 268
-#define ALLOW 269
-#define REJECTOPT 270
-#define ADDRESS 271
-#define INIT 272
-#define TERMINAL 273
-#define BATCH 274
-#define READONLY 275
-#define CLEARTEXT 276
-#define MD5HASH 277
-#define SHA1HASH 278
-#define CRYPT 279
-#define DELAY 280
-#define PEMFILE 281
-#define PEMKEY 282
-#define PEMCHAIN 283
-#define ENABLE 284
-#define DISABLE 285
-#define SSLTOKEN 286
-#define CIPHER 287
-#define CLIENTPEMFILE 288
-#define ALLOWSELFCERTIFICATION 289
-#define SELFSIGNED 290
-#define VERIFY 291
-#define CERTIFICATE 292
-#define CACERTIFICATEFILE 293
-#define CACERTIFICATEPATH 294
-#define VALID 295
-#define INTERFACE 296
-#define LINK 297
-#define PACKET 298
-#define BYTEIN 299
-#define BYTEOUT 300
-#define PACKETIN 301
-#define PACKETOUT 302
-#define SPEED 303
-#define SATURATION 304
-#define UPLOAD 305
-#define DOWNLOAD 306
-#define TOTAL 307
-#define IDFILE 308
-#define STATEFILE 309
-#define SEND 310
-#define EXPECT 311
-#define CYCLE 312
-#define COUNT 313
-#define REMINDER 314
-#define REPEAT 315
-#define LIMITS 316
-#define SENDEXPECTBUFFER 317
-#define EXPECTBUFFER 318
-#define FILECONTENTBUFFER 319
-#define HTTPCONTENTBUFFER 320
-#define PROGRAMOUTPUT 321
-#define NETWORKTIMEOUT 322
-#define PROGRAMTIMEOUT 323
-#define STARTTIMEOUT 324
-#define STOPTIMEOUT 325
-#define RESTARTTIMEOUT 326
-#define PIDFILE 327
-#define START 328
-#define STOP 329
-#define PATHTOK 330
-#define RSAKEY 331
-#define HOST 332
-#define HOSTNAME 333
-#define PORT 334
-#define IPV4 335
-#define IPV6 336
-#define TYPE 337
-#define UDP 338
-#define TCP 339
-#define TCPSSL 340
-#define PROTOCOL 341
-#define CONNECTION 342
-#define ALERT 343
-#define NOALERT 344
-#define MAILFORMAT 345
-#define UNIXSOCKET 346
-#define SIGNATURE 347
-#define TIMEOUT 348
-#define RETRY 349
-#define RESTART 350
-#define CHECKSUM 351
-#define EVERY 352
-#define NOTEVERY 353
-#define DEFAULT 354
-#define HTTP 355
-#define HTTPS 356
-#define APACHESTATUS 357
-#define FTP 358
-#define SMTP 359
-#define SMTPS 360
-#define POP 361
-#define POPS 362
-#define IMAP 363
-#define IMAPS 364
-#define CLAMAV 365
-#define NNTP 366
-#define NTP3 367
-#define MYSQL 368
-#define MYSQLS 369
-#define DNS 370
-#define WEBSOCKET 371
-#define MQTT 372
-#define SSH 373
-#define DWP 374
-#define LDAP2 375
-#define LDAP3 376
-#define RDATE 377
-#define RSYNC 378
-#define TNS 379
-#define PGSQL 380
-#define POSTFIXPOLICY 381
-#define SIP 382
-#define LMTP 383
-#define GPS 384
-#define RADIUS 385
-#define MEMCACHE 386
-#define REDIS 387
-#define MONGODB 388
-#define SIEVE 389
-#define SPAMASSASSIN 390
-#define FAIL2BAN 391
-#define STRING 392
-#define PATH 393
-#define MAILADDR 394
-#define MAILFROM 395
-#define MAILREPLYTO 396
-#define MAILSUBJECT 397
-#define MAILBODY 398
-#define SERVICENAME 399
-#define STRINGNAME 400
-#define NUMBER 401
-#define PERCENT 402
-#define LOGLIMIT 403
-#define CLOSELIMIT 404
-#define DNSLIMIT 405
-#define KEEPALIVELIMIT 406
-#define REPLYLIMIT 407
-#define REQUESTLIMIT 408
-#define STARTLIMIT 409
-#define WAITLIMIT 410
-#define GRACEFULLIMIT 411
-#define CLEANUPLIMIT 412
-#define REAL 413
-#define CHECKPROC 414
-#define CHECKFILESYS 415
-#define CHECKFILE 416
-#define CHECKDIR 417
-#define CHECKHOST 418
-#define CHECKSYSTEM 419
-#define CHECKFIFO 420
-#define CHECKPROGRAM 421
-#define CHECKNET 422
-#define THREADS 423
-#define CHILDREN 424
-#define METHOD 425
-#define GET 426
-#define HEAD 427
-#define STATUS 428
-#define ORIGIN 429
-#define VERSIONOPT 430
-#define READ 431
-#define WRITE 432
-#define OPERATION 433
-#define SERVICETIME 434
-#define DISK 435
-#define RESOURCE 436
-#define MEMORY 437
-#define TOTALMEMORY 438
-#define LOADAVG1 439
-#define LOADAVG5 440
-#define LOADAVG15 441
-#define SWAP 442
-#define MODE 443
-#define ACTIVE 444
-#define PASSIVE 445
-#define MANUAL 446
-#define ONREBOOT 447
-#define NOSTART 448
-#define LASTSTATE 449
-#define CORE 450
-#define CPU 451
-#define TOTALCPU 452
-#define CPUUSER 453
-#define CPUSYSTEM 454
-#define CPUWAIT 455
-#define CPUNICE 456
-#define CPUHARDIRQ 457
-#define CPUSOFTIRQ 458
-#define CPUSTEAL 459
-#define CPUGUEST 460
-#define CPUGUESTNICE 461
-#define GROUP 462
-#define REQUEST 463
-#define DEPENDS 464
-#define BASEDIR 465
-#define SLOT 466
-#define EVENTQUEUE 467
-#define SECRET 468
-#define HOSTHEADER 469
-#define UID 470
-#define EUID 471
-#define GID 472
-#define MMONIT 473
-#define INSTANCE 474
-#define USERNAME 475
-#define PASSWORD 476
-#define TIME 477
-#define ATIME 478
-#define CTIME 479
-#define MTIME 480
-#define CHANGED 481
-#define MILLISECOND 482
-#define SECOND 483
-#define MINUTE 484
-#define HOUR 485
-#define DAY 486
-#define MONTH 487
-#define SSLV2 488
-#define SSLV3 489
-#define TLSV1 490
-#define TLSV11 491
-#define TLSV12 492
-#define TLSV13 493
-#define CERTMD5 494
-#define AUTO 495
-#define NOSSLV2 496
-#define NOSSLV3 497
-#define NOTLSV1 498
-#define NOTLSV11 499
-#define NOTLSV12 500
-#define NOTLSV13 501
-#define BYTE 502
-#define KILOBYTE 503
-#define MEGABYTE 504
-#define GIGABYTE 505
-#define INODE 506
-#define SPACE 507
-#define TFREE 508
-#define PERMISSION 509
-#define SIZE 510
-#define MATCH 511
-#define NOT 512
-#define IGNORE 513
-#define ACTION 514
-#define UPTIME 515
-#define EXEC 516
-#define UNMONITOR 517
-#define PING 518
-#define PING4 519
-#define PING6 520
-#define ICMP 521
-#define ICMPECHO 522
-#define NONEXIST 523
-#define EXIST 524
-#define INVALID 525
-#define DATA 526
-#define RECOVERED 527
-#define PASSED 528
-#define SUCCEEDED 529
-#define URL 530
-#define CONTENT 531
-#define PID 532
-#define PPID 533
-#define FSFLAG 534
-#define REGISTER 535
-#define CREDENTIALS 536
-#define URLOBJECT 537
-#define ADDRESSOBJECT 538
-#define TARGET 539
-#define TIMESPEC 540
-#define HTTPHEADER 541
-#define MAXFORWARD 542
-#define FIPS 543
-#define SECURITY 544
-#define ATTRIBUTE 545
-#define FILEDESCRIPTORS 546
-#define GREATER 547
-#define GREATEROREQUAL 548
-#define LESS 549
-#define LESSOREQUAL 550
-#define EQUAL 551
-#define NOTEQUAL 552
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-union YYSTYPE
+#include "y.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 322 "src/p.y"
-
-        URL_T url;
-        Address_T address;
-        float real;
-        int   number;
-        char *string;
-
-#line 1020 "src/y.tab.c"
-
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_IF = 3,                         /* IF  */
+  YYSYMBOL_ELSE = 4,                       /* ELSE  */
+  YYSYMBOL_THEN = 5,                       /* THEN  */
+  YYSYMBOL_FAILED = 6,                     /* FAILED  */
+  YYSYMBOL_SET = 7,                        /* SET  */
+  YYSYMBOL_LOGFILE = 8,                    /* LOGFILE  */
+  YYSYMBOL_FACILITY = 9,                   /* FACILITY  */
+  YYSYMBOL_DAEMON = 10,                    /* DAEMON  */
+  YYSYMBOL_SYSLOG = 11,                    /* SYSLOG  */
+  YYSYMBOL_MAILSERVER = 12,                /* MAILSERVER  */
+  YYSYMBOL_HTTPD = 13,                     /* HTTPD  */
+  YYSYMBOL_ALLOW = 14,                     /* ALLOW  */
+  YYSYMBOL_REJECTOPT = 15,                 /* REJECTOPT  */
+  YYSYMBOL_ADDRESS = 16,                   /* ADDRESS  */
+  YYSYMBOL_INIT = 17,                      /* INIT  */
+  YYSYMBOL_TERMINAL = 18,                  /* TERMINAL  */
+  YYSYMBOL_BATCH = 19,                     /* BATCH  */
+  YYSYMBOL_READONLY = 20,                  /* READONLY  */
+  YYSYMBOL_CLEARTEXT = 21,                 /* CLEARTEXT  */
+  YYSYMBOL_MD5HASH = 22,                   /* MD5HASH  */
+  YYSYMBOL_SHA1HASH = 23,                  /* SHA1HASH  */
+  YYSYMBOL_SHA256HASH = 24,                /* SHA256HASH  */
+  YYSYMBOL_XXH64HASH = 25,                 /* XXH64HASH  */
+  YYSYMBOL_CRYPT = 26,                     /* CRYPT  */
+  YYSYMBOL_DELAY = 27,                     /* DELAY  */
+  YYSYMBOL_PEMFILE = 28,                   /* PEMFILE  */
+  YYSYMBOL_PEMKEY = 29,                    /* PEMKEY  */
+  YYSYMBOL_PEMCHAIN = 30,                  /* PEMCHAIN  */
+  YYSYMBOL_ENABLE = 31,                    /* ENABLE  */
+  YYSYMBOL_DISABLE = 32,                   /* DISABLE  */
+  YYSYMBOL_SSLTOKEN = 33,                  /* SSLTOKEN  */
+  YYSYMBOL_CIPHER = 34,                    /* CIPHER  */
+  YYSYMBOL_CLIENTPEMFILE = 35,             /* CLIENTPEMFILE  */
+  YYSYMBOL_ALLOWSELFCERTIFICATION = 36,    /* ALLOWSELFCERTIFICATION  */
+  YYSYMBOL_SELFSIGNED = 37,                /* SELFSIGNED  */
+  YYSYMBOL_VERIFY = 38,                    /* VERIFY  */
+  YYSYMBOL_CERTIFICATE = 39,               /* CERTIFICATE  */
+  YYSYMBOL_CACERTIFICATEFILE = 40,         /* CACERTIFICATEFILE  */
+  YYSYMBOL_CACERTIFICATEPATH = 41,         /* CACERTIFICATEPATH  */
+  YYSYMBOL_VALID = 42,                     /* VALID  */
+  YYSYMBOL_INTERFACE = 43,                 /* INTERFACE  */
+  YYSYMBOL_LINK = 44,                      /* LINK  */
+  YYSYMBOL_PACKET = 45,                    /* PACKET  */
+  YYSYMBOL_BYTEIN = 46,                    /* BYTEIN  */
+  YYSYMBOL_BYTEOUT = 47,                   /* BYTEOUT  */
+  YYSYMBOL_PACKETIN = 48,                  /* PACKETIN  */
+  YYSYMBOL_PACKETOUT = 49,                 /* PACKETOUT  */
+  YYSYMBOL_SPEED = 50,                     /* SPEED  */
+  YYSYMBOL_SATURATION = 51,                /* SATURATION  */
+  YYSYMBOL_UPLOAD = 52,                    /* UPLOAD  */
+  YYSYMBOL_DOWNLOAD = 53,                  /* DOWNLOAD  */
+  YYSYMBOL_TOTAL = 54,                     /* TOTAL  */
+  YYSYMBOL_DROP = 55,                      /* DROP  */
+  YYSYMBOL_MISSED = 56,                    /* MISSED  */
+  YYSYMBOL_FIFO = 57,                      /* FIFO  */
+  YYSYMBOL_CARRIER = 58,                   /* CARRIER  */
+  YYSYMBOL_MULTICAST = 59,                 /* MULTICAST  */
+  YYSYMBOL_COLLISION = 60,                 /* COLLISION  */
+  YYSYMBOL_TCPRETRANSMITS = 61,            /* TCPRETRANSMITS  */
+  YYSYMBOL_LISTENOVERFLOWS = 62,           /* LISTENOVERFLOWS  */
+  YYSYMBOL_LISTENDROPS = 63,               /* LISTENDROPS  */
+  YYSYMBOL_SYNCOOKIES = 64,                /* SYNCOOKIES  */
+  YYSYMBOL_ORPHANS = 65,                   /* ORPHANS  */
+  YYSYMBOL_TIMEWAIT = 66,                  /* TIMEWAIT  */
+  YYSYMBOL_UDPRCVBUFERRORS = 67,           /* UDPRCVBUFERRORS  */
+  YYSYMBOL_LISTENING = 68,                 /* LISTENING  */
+  YYSYMBOL_LISTENQUEUE = 69,               /* LISTENQUEUE  */
+  YYSYMBOL_ESTABLISHED = 70,               /* ESTABLISHED  */
+  YYSYMBOL_IDFILE = 71,                    /* IDFILE  */
+  YYSYMBOL_STATEFILE = 72,                 /* STATEFILE  */
+  YYSYMBOL_SEND = 73,                      /* SEND  */
+  YYSYMBOL_EXPECT = 74,                    /* EXPECT  */
+  YYSYMBOL_CYCLE = 75,                     /* CYCLE  */
+  YYSYMBOL_COUNT = 76,                     /* COUNT  */
+  YYSYMBOL_REMINDER = 77,                  /* REMINDER  */
+  YYSYMBOL_REPEAT = 78,                    /* REPEAT  */
+  YYSYMBOL_LIMITS = 79,                    /* LIMITS  */
+  YYSYMBOL_SENDEXPECTBUFFER = 80,          /* SENDEXPECTBUFFER  */
+  YYSYMBOL_EXPECTBUFFER = 81,              /* EXPECTBUFFER  */
+  YYSYMBOL_FILECONTENTBUFFER = 82,         /* FILECONTENTBUFFER  */
+  YYSYMBOL_HTTPCONTENTBUFFER = 83,         /* HTTPCONTENTBUFFER  */
+  YYSYMBOL_PROGRAMOUTPUT = 84,             /* PROGRAMOUTPUT  */
+  YYSYMBOL_NETWORKTIMEOUT = 85,            /* NETWORKTIMEOUT  */
+  YYSYMBOL_PROGRAMTIMEOUT = 86,            /* PROGRAMTIMEOUT  */
+  YYSYMBOL_STARTTIMEOUT = 87,              /* STARTTIMEOUT  */
+  YYSYMBOL_STOPTIMEOUT = 88,               /* STOPTIMEOUT  */
+  YYSYMBOL_RESTARTTIMEOUT = 89,            /* RESTARTTIMEOUT  */
+  YYSYMBOL_CHECKSUMWORKERS = 90,           /* CHECKSUMWORKERS  */
+  YYSYMBOL_CHECKSUMIDLEIO = 91,            /* CHECKSUMIDLEIO  */
+  YYSYMBOL_FILESYSTEMTIMEOUT = 92,         /* FILESYSTEMTIMEOUT  */
+  YYSYMBOL_DNSTTL = 93,                    /* DNSTTL  */
+  YYSYMBOL_DNSNEGATIVETTL = 94,            /* DNSNEGATIVETTL  */
+  YYSYMBOL_ENTRIES = 95,                   /* ENTRIES  */
+  YYSYMBOL_OLDEST = 96,                    /* OLDEST  */
+  YYSYMBOL_PIDFILE = 97,                   /* PIDFILE  */
+  YYSYMBOL_START = 98,                     /* START  */
+  YYSYMBOL_STOP = 99,                      /* STOP  */
+  YYSYMBOL_PATHTOK = 100,                  /* PATHTOK  */
+  YYSYMBOL_RSAKEY = 101,                   /* RSAKEY  */
+  YYSYMBOL_HOST = 102,                     /* HOST  */
+  YYSYMBOL_HOSTNAME = 103,                 /* HOSTNAME  */
+  YYSYMBOL_PORT = 104,                     /* PORT  */
+  YYSYMBOL_IPV4 = 105,                     /* IPV4  */
+  YYSYMBOL_IPV6 = 106,                     /* IPV6  */
+  YYSYMBOL_TYPE = 107,                     /* TYPE  */
+  YYSYMBOL_UDP = 108,                      /* UDP  */
+  YYSYMBOL_TCP = 109,                      /* TCP  */
+  YYSYMBOL_TCPSSL = 110,                   /* TCPSSL  */
+  YYSYMBOL_PROTOCOL = 111,                 /* PROTOCOL  */
+  YYSYMBOL_CONNECTION = 112,               /* CONNECTION  */
+  YYSYMBOL_ALERT = 113,                    /* ALERT  */
+  YYSYMBOL_NOALERT = 114,                  /* NOALERT  */
+  YYSYMBOL_MAILFORMAT = 115,               /* MAILFORMAT  */
+  YYSYMBOL_UNIXSOCKET = 116,               /* UNIXSOCKET  */
+  YYSYMBOL_SIGNATURE = 117,                /* SIGNATURE  */
+  YYSYMBOL_TIMEOUT = 118,                  /* TIMEOUT  */
+  YYSYMBOL_RETRY = 119,                    /* RETRY  */
+  YYSYMBOL_PERSISTENT = 120,               /* PERSISTENT  */
+  YYSYMBOL_RESTART = 121,                  /* RESTART  */
+  YYSYMBOL_CHECKSUM = 122,                 /* CHECKSUM  */
+  YYSYMBOL_EVERY = 123,                    /* EVERY  */
+  YYSYMBOL_NOTEVERY = 124,                 /* NOTEVERY  */
+  YYSYMBOL_DNSTIME = 125,                  /* DNSTIME  */
+  YYSYMBOL_CONNECTTIME = 126,              /* CONNECTTIME  */
+  YYSYMBOL_TLSHANDSHAKE = 127,             /* TLSHANDSHAKE  */
+  YYSYMBOL_REQUESTTIME = 128,              /* REQUESTTIME  */
+  YYSYMBOL_FIRSTBYTE = 129,                /* FIRSTBYTE  */
+  YYSYMBOL_RESPONSETIME = 130,             /* RESPONSETIME  */
+  YYSYMBOL_RTT = 131,                      /* RTT  */
+  YYSYMBOL_RETRANSMITS = 132,              /* RETRANSMITS  */
+  YYSYMBOL_DEFAULT = 133,                  /* DEFAULT  */
+  YYSYMBOL_HTTP = 134,                     /* HTTP  */
+  YYSYMBOL_HTTPS = 135,                    /* HTTPS  */
+  YYSYMBOL_APACHESTATUS = 136,             /* APACHESTATUS  */
+  YYSYMBOL_FTP = 137,                      /* FTP  */
+  YYSYMBOL_SMTP = 138,                     /* SMTP  */
+  YYSYMBOL_SMTPS = 139,                    /* SMTPS  */
+  YYSYMBOL_POP = 140,                      /* POP  */
+  YYSYMBOL_POPS = 141,                     /* POPS  */
+  YYSYMBOL_IMAP = 142,                     /* IMAP  */
+  YYSYMBOL_IMAPS = 143,                    /* IMAPS  */
+  YYSYMBOL_CLAMAV = 144,                   /* CLAMAV  */
+  YYSYMBOL_NNTP = 145,                     /* NNTP  */
+  YYSYMBOL_NTP3 = 146,                     /* NTP3  */
+  YYSYMBOL_MYSQL = 147,                    /* MYSQL  */
+  YYSYMBOL_MYSQLS = 148,                   /* MYSQLS  */
+  YYSYMBOL_DNS = 149,                      /* DNS  */
+  YYSYMBOL_WEBSOCKET = 150,                /* WEBSOCKET  */
+  YYSYMBOL_MQTT = 151,                     /* MQTT  */
+  YYSYMBOL_HTTP2 = 152,                    /* HTTP2  */
+  YYSYMBOL_HEX = 153,                      /* HEX  */
+  YYSYMBOL_SSH = 154,                      /* SSH  */
+  YYSYMBOL_DWP = 155,                      /* DWP  */
+  YYSYMBOL_LDAP2 = 156,                    /* LDAP2  */
+  YYSYMBOL_LDAP3 = 157,                    /* LDAP3  */
+  YYSYMBOL_RDATE = 158,                    /* RDATE  */
+  YYSYMBOL_RSYNC = 159,                    /* RSYNC  */
+  YYSYMBOL_TNS = 160,                      /* TNS  */
+  YYSYMBOL_PGSQL = 161,                    /* PGSQL  */
+  YYSYMBOL_POSTFIXPOLICY = 162,            /* POSTFIXPOLICY  */
+  YYSYMBOL_SIP = 163,                      /* SIP  */
+  YYSYMBOL_LMTP = 164,                     /* LMTP  */
+  YYSYMBOL_GPS = 165,                      /* GPS  */
+  YYSYMBOL_RADIUS = 166,                   /* RADIUS  */
+  YYSYMBOL_MEMCACHE = 167,                 /* MEMCACHE  */
+  YYSYMBOL_REDIS = 168,                    /* REDIS  */
+  YYSYMBOL_MONGODB = 169,                  /* MONGODB  */
+  YYSYMBOL_SIEVE = 170,                    /* SIEVE  */
+  YYSYMBOL_SPAMASSASSIN = 171,             /* SPAMASSASSIN  */
+  YYSYMBOL_FAIL2BAN = 172,                 /* FAIL2BAN  */
+  YYSYMBOL_STRING = 173,                   /* STRING  */
+  YYSYMBOL_PATH = 174,                     /* PATH  */
+  YYSYMBOL_MAILADDR = 175,                 /* MAILADDR  */
+  YYSYMBOL_MAILFROM = 176,                 /* MAILFROM  */
+  YYSYMBOL_MAILREPLYTO = 177,              /* MAILREPLYTO  */
+  YYSYMBOL_MAILSUBJECT = 178,              /* MAILSUBJECT  */
+  YYSYMBOL_MAILBODY = 179,                 /* MAILBODY  */
+  YYSYMBOL_SERVICENAME = 180,              /* SERVICENAME  */
+  YYSYMBOL_STRINGNAME = 181,               /* STRINGNAME  */
+  YYSYMBOL_NUMBER = 182,                   /* NUMBER  */
+  YYSYMBOL_PERCENT = 183,                  /* PERCENT  */
+  YYSYMBOL_LOGLIMIT = 184,                 /* LOGLIMIT  */
+  YYSYMBOL_CLOSELIMIT = 185,               /* CLOSELIMIT  */
+  YYSYMBOL_DNSLIMIT = 186,                 /* DNSLIMIT  */
+  YYSYMBOL_KEEPALIVELIMIT = 187,           /* KEEPALIVELIMIT  */
+  YYSYMBOL_REPLYLIMIT = 188,               /* REPLYLIMIT  */
+  YYSYMBOL_REQUESTLIMIT = 189,             /* REQUESTLIMIT  */
+  YYSYMBOL_STARTLIMIT = 190,               /* STARTLIMIT  */
+  YYSYMBOL_WAITLIMIT = 191,                /* WAITLIMIT  */
+  YYSYMBOL_GRACEFULLIMIT = 192,            /* GRACEFULLIMIT  */
+  YYSYMBOL_CLEANUPLIMIT = 193,             /* CLEANUPLIMIT  */
+  YYSYMBOL_REAL = 194,                     /* REAL  */
+  YYSYMBOL_CHECKPROC = 195,                /* CHECKPROC  */
+  YYSYMBOL_CHECKFILESYS = 196,             /* CHECKFILESYS  */
+  YYSYMBOL_CHECKFILE = 197,                /* CHECKFILE  */
+  YYSYMBOL_CHECKDIR = 198,                 /* CHECKDIR  */
+  YYSYMBOL_CHECKHOST = 199,                /* CHECKHOST  */
+  YYSYMBOL_CHECKSYSTEM = 200,              /* CHECKSYSTEM  */
+  YYSYMBOL_CHECKFIFO = 201,                /* CHECKFIFO  */
+  YYSYMBOL_CHECKPROGRAM = 202,             /* CHECKPROGRAM  */
+  YYSYMBOL_CHECKNET = 203,                 /* CHECKNET  */
+  YYSYMBOL_CHECKFILESET = 204,             /* CHECKFILESET  */
+  YYSYMBOL_THREADS = 205,                  /* THREADS  */
+  YYSYMBOL_CHILDREN = 206,                 /* CHILDREN  */
+  YYSYMBOL_METHOD = 207,                   /* METHOD  */
+  YYSYMBOL_GET = 208,                      /* GET  */
+  YYSYMBOL_HEAD = 209,                     /* HEAD  */
+  YYSYMBOL_STATUS = 210,                   /* STATUS  */
+  YYSYMBOL_ORIGIN = 211,                   /* ORIGIN  */
+  YYSYMBOL_VERSIONOPT = 212,               /* VERSIONOPT  */
+  YYSYMBOL_READ = 213,                     /* READ  */
+  YYSYMBOL_WRITE = 214,                    /* WRITE  */
+  YYSYMBOL_OPERATION = 215,                /* OPERATION  */
+  YYSYMBOL_SERVICETIME = 216,              /* SERVICETIME  */
+  YYSYMBOL_DISK = 217,                     /* DISK  */
+  YYSYMBOL_LATENCY = 218,                  /* LATENCY  */
+  YYSYMBOL_UTILIZATION = 219,              /* UTILIZATION  */
+  YYSYMBOL_QUEUEDEPTH = 220,               /* QUEUEDEPTH  */
+  YYSYMBOL_IOPS = 221,                     /* IOPS  */
+  YYSYMBOL_TIMETOFULL = 222,               /* TIMETOFULL  */
+  YYSYMBOL_OVER = 223,                     /* OVER  */
+  YYSYMBOL_RESOURCE = 224,                 /* RESOURCE  */
+  YYSYMBOL_MEMORY = 225,                   /* MEMORY  */
+  YYSYMBOL_TOTALMEMORY = 226,              /* TOTALMEMORY  */
+  YYSYMBOL_LOADAVG1 = 227,                 /* LOADAVG1  */
+  YYSYMBOL_LOADAVG5 = 228,                 /* LOADAVG5  */
+  YYSYMBOL_LOADAVG15 = 229,                /* LOADAVG15  */
+  YYSYMBOL_SWAP = 230,                     /* SWAP  */
+  YYSYMBOL_MODE = 231,                     /* MODE  */
+  YYSYMBOL_ACTIVE = 232,                   /* ACTIVE  */
+  YYSYMBOL_PASSIVE = 233,                  /* PASSIVE  */
+  YYSYMBOL_MANUAL = 234,                   /* MANUAL  */
+  YYSYMBOL_ONREBOOT = 235,                 /* ONREBOOT  */
+  YYSYMBOL_NOSTART = 236,                  /* NOSTART  */
+  YYSYMBOL_LASTSTATE = 237,                /* LASTSTATE  */
+  YYSYMBOL_CORE = 238,                     /* CORE  */
+  YYSYMBOL_CPU = 239,                      /* CPU  */
+  YYSYMBOL_TOTALCPU = 240,                 /* TOTALCPU  */
+  YYSYMBOL_CPUUSER = 241,                  /* CPUUSER  */
+  YYSYMBOL_CPUSYSTEM = 242,                /* CPUSYSTEM  */
+  YYSYMBOL_CPUWAIT = 243,                  /* CPUWAIT  */
+  YYSYMBOL_CPUNICE = 244,                  /* CPUNICE  */
+  YYSYMBOL_CPUHARDIRQ = 245,               /* CPUHARDIRQ  */
+  YYSYMBOL_CPUSOFTIRQ = 246,               /* CPUSOFTIRQ  */
+  YYSYMBOL_CPUSTEAL = 247,                 /* CPUSTEAL  */
+  YYSYMBOL_CPUGUEST = 248,                 /* CPUGUEST  */
+  YYSYMBOL_CPUGUESTNICE = 249,             /* CPUGUESTNICE  */
+  YYSYMBOL_GROUP = 250,                    /* GROUP  */
+  YYSYMBOL_REQUEST = 251,                  /* REQUEST  */
+  YYSYMBOL_DEPENDS = 252,                  /* DEPENDS  */
+  YYSYMBOL_BASEDIR = 253,                  /* BASEDIR  */
+  YYSYMBOL_SLOT = 254,                     /* SLOT  */
+  YYSYMBOL_EVENTQUEUE = 255,               /* EVENTQUEUE  */
+  YYSYMBOL_SECRET = 256,                   /* SECRET  */
+  YYSYMBOL_HOSTHEADER = 257,               /* HOSTHEADER  */
+  YYSYMBOL_UID = 258,                      /* UID  */
+  YYSYMBOL_EUID = 259,                     /* EUID  */
+  YYSYMBOL_GID = 260,                      /* GID  */
+  YYSYMBOL_MMONIT = 261,                   /* MMONIT  */
+  YYSYMBOL_INSTANCE = 262,                 /* INSTANCE  */
+  YYSYMBOL_USERNAME = 263,                 /* USERNAME  */
+  YYSYMBOL_PASSWORD = 264,                 /* PASSWORD  */
+  YYSYMBOL_TIME = 265,                     /* TIME  */
+  YYSYMBOL_ATIME = 266,                    /* ATIME  */
+  YYSYMBOL_CTIME = 267,                    /* CTIME  */
+  YYSYMBOL_MTIME = 268,                    /* MTIME  */
+  YYSYMBOL_CHANGED = 269,                  /* CHANGED  */
+  YYSYMBOL_MILLISECOND = 270,              /* MILLISECOND  */
+  YYSYMBOL_SECOND = 271,                   /* SECOND  */
+  YYSYMBOL_MINUTE = 272,                   /* MINUTE  */
+  YYSYMBOL_HOUR = 273,                     /* HOUR  */
+  YYSYMBOL_DAY = 274,                      /* DAY  */
+  YYSYMBOL_MONTH = 275,                    /* MONTH  */
+  YYSYMBOL_SSLV2 = 276,                    /* SSLV2  */
+  YYSYMBOL_SSLV3 = 277,                    /* SSLV3  */
+  YYSYMBOL_TLSV1 = 278,                    /* TLSV1  */
+  YYSYMBOL_TLSV11 = 279,                   /* TLSV11  */
+  YYSYMBOL_TLSV12 = 280,                   /* TLSV12  */
+  YYSYMBOL_TLSV13 = 281,                   /* TLSV13  */
+  YYSYMBOL_CERTMD5 = 282,                  /* CERTMD5  */
+  YYSYMBOL_AUTO = 283,                     /* AUTO  */
+  YYSYMBOL_NOSSLV2 = 284,                  /* NOSSLV2  */
+  YYSYMBOL_NOSSLV3 = 285,                  /* NOSSLV3  */
+  YYSYMBOL_NOTLSV1 = 286,                  /* NOTLSV1  */
+  YYSYMBOL_NOTLSV11 = 287,                 /* NOTLSV11  */
+  YYSYMBOL_NOTLSV12 = 288,                 /* NOTLSV12  */
+  YYSYMBOL_NOTLSV13 = 289,                 /* NOTLSV13  */
+  YYSYMBOL_BYTE = 290,                     /* BYTE  */
+  YYSYMBOL_KILOBYTE = 291,                 /* KILOBYTE  */
+  YYSYMBOL_MEGABYTE = 292,                 /* MEGABYTE  */
+  YYSYMBOL_GIGABYTE = 293,                 /* GIGABYTE  */
+  YYSYMBOL_INODE = 294,                    /* INODE  */
+  YYSYMBOL_SPACE = 295,                    /* SPACE  */
+  YYSYMBOL_TFREE = 296,                    /* TFREE  */
+  YYSYMBOL_PERMISSION = 297,               /* PERMISSION  */
+  YYSYMBOL_SIZE = 298,                     /* SIZE  */
+  YYSYMBOL_MATCH = 299,                    /* MATCH  */
+  YYSYMBOL_NOT = 300,                      /* NOT  */
+  YYSYMBOL_IGNORE = 301,                   /* IGNORE  */
+  YYSYMBOL_ACTION = 302,                   /* ACTION  */
+  YYSYMBOL_UPTIME = 303,                   /* UPTIME  */
+  YYSYMBOL_EXEC = 304,                     /* EXEC  */
+  YYSYMBOL_UNMONITOR = 305,                /* UNMONITOR  */
+  YYSYMBOL_PING = 306,                     /* PING  */
+  YYSYMBOL_PING4 = 307,                    /* PING4  */
+  YYSYMBOL_PING6 = 308,                    /* PING6  */
+  YYSYMBOL_ICMP = 309,                     /* ICMP  */
+  YYSYMBOL_ICMPECHO = 310,                 /* ICMPECHO  */
+  YYSYMBOL_NONEXIST = 311,                 /* NONEXIST  */
+  YYSYMBOL_EXIST = 312,                    /* EXIST  */
+  YYSYMBOL_INVALID = 313,                  /* INVALID  */
+  YYSYMBOL_DATA = 314,                     /* DATA  */
+  YYSYMBOL_RECOVERED = 315,                /* RECOVERED  */
+  YYSYMBOL_PASSED = 316,                   /* PASSED  */
+  YYSYMBOL_SUCCEEDED = 317,                /* SUCCEEDED  */
+  YYSYMBOL_URL = 318,                      /* URL  */
+  YYSYMBOL_CONTENT = 319,                  /* CONTENT  */
+  YYSYMBOL_PID = 320,                      /* PID  */
+  YYSYMBOL_PPID = 321,                     /* PPID  */
+  YYSYMBOL_FSFLAG = 322,                   /* FSFLAG  */
+  YYSYMBOL_REGISTER = 323,                 /* REGISTER  */
+  YYSYMBOL_CREDENTIALS = 324,              /* CREDENTIALS  */
+  YYSYMBOL_URLOBJECT = 325,                /* URLOBJECT  */
+  YYSYMBOL_ADDRESSOBJECT = 326,            /* ADDRESSOBJECT  */
+  YYSYMBOL_TARGET = 327,                   /* TARGET  */
+  YYSYMBOL_TIMESPEC = 328,                 /* TIMESPEC  */
+  YYSYMBOL_HTTPHEADER = 329,               /* HTTPHEADER  */
+  YYSYMBOL_MAXFORWARD = 330,               /* MAXFORWARD  */
+  YYSYMBOL_FIPS = 331,                     /* FIPS  */
+  YYSYMBOL_SECURITY = 332,                 /* SECURITY  */
+  YYSYMBOL_ATTRIBUTE = 333,                /* ATTRIBUTE  */
+  YYSYMBOL_FILEDESCRIPTORS = 334,          /* FILEDESCRIPTORS  */
+  YYSYMBOL_GREATER = 335,                  /* GREATER  */
+  YYSYMBOL_GREATEROREQUAL = 336,           /* GREATEROREQUAL  */
+  YYSYMBOL_LESS = 337,                     /* LESS  */
+  YYSYMBOL_LESSOREQUAL = 338,              /* LESSOREQUAL  */
+  YYSYMBOL_EQUAL = 339,                    /* EQUAL  */
+  YYSYMBOL_NOTEQUAL = 340,                 /* NOTEQUAL  */
+  YYSYMBOL_341_ = 341,                     /* '{'  */
+  YYSYMBOL_342_ = 342,                     /* '}'  */
+  YYSYMBOL_343_ = 343,                     /* ':'  */
+  YYSYMBOL_344_ = 344,                     /* '@'  */
+  YYSYMBOL_345_ = 345,                     /* '['  */
+  YYSYMBOL_346_ = 346,                     /* ']'  */
+  YYSYMBOL_YYACCEPT = 347,                 /* $accept  */
+  YYSYMBOL_cfgfile = 348,                  /* cfgfile  */
+  YYSYMBOL_statement_list = 349,           /* statement_list  */
+  YYSYMBOL_statement = 350,                /* statement  */
+  YYSYMBOL_optproclist = 351,              /* optproclist  */
+  YYSYMBOL_optproc = 352,                  /* optproc  */
+  YYSYMBOL_optfilelist = 353,              /* optfilelist  */
+  YYSYMBOL_optfile = 354,                  /* optfile  */
+  YYSYMBOL_optfilesetlist = 355,           /* optfilesetlist  */
+  YYSYMBOL_optfileset = 356,               /* optfileset  */
+  YYSYMBOL_optfilesyslist = 357,           /* optfilesyslist  */
+  YYSYMBOL_optfilesys = 358,               /* optfilesys  */
+  YYSYMBOL_optdirlist = 359,               /* optdirlist  */
+  YYSYMBOL_optdir = 360,                   /* optdir  */
+  YYSYMBOL_opthostlist = 361,              /* opthostlist  */
+  YYSYMBOL_opthost = 362,                  /* opthost  */
+  YYSYMBOL_optnetlist = 363,               /* optnetlist  */
+  YYSYMBOL_optnet = 364,                   /* optnet  */
+  YYSYMBOL_optsystemlist = 365,            /* optsystemlist  */
+  YYSYMBOL_optsystem = 366,                /* optsystem  */
+  YYSYMBOL_optfifolist = 367,              /* optfifolist  */
+  YYSYMBOL_optfifo = 368,                  /* optfifo  */
+  YYSYMBOL_optprogramlist = 369,           /* optprogramlist  */
+  YYSYMBOL_optprogram = 370,               /* optprogram  */
+  YYSYMBOL_setalert = 371,                 /* setalert  */
+  YYSYMBOL_setdaemon = 372,                /* setdaemon  */
+  YYSYMBOL_setterminal = 373,              /* setterminal  */
+  YYSYMBOL_startdelay = 374,               /* startdelay  */
+  YYSYMBOL_setinit = 375,                  /* setinit  */
+  YYSYMBOL_setonreboot = 376,              /* setonreboot  */
+  YYSYMBOL_setexpectbuffer = 377,          /* setexpectbuffer  */
+  YYSYMBOL_setlimits = 378,                /* setlimits  */
+  YYSYMBOL_limitlist = 379,                /* limitlist  */
+  YYSYMBOL_limit = 380,                    /* limit  */
+  YYSYMBOL_setfips = 381,                  /* setfips  */
+  YYSYMBOL_setlog = 382,                   /* setlog  */
+  YYSYMBOL_seteventqueue = 383,            /* seteventqueue  */
+  YYSYMBOL_setidfile = 384,                /* setidfile  */
+  YYSYMBOL_setstatefile = 385,             /* setstatefile  */
+  YYSYMBOL_setpid = 386,                   /* setpid  */
+  YYSYMBOL_setmmonits = 387,               /* setmmonits  */
+  YYSYMBOL_mmonitlist = 388,               /* mmonitlist  */
+  YYSYMBOL_mmonit = 389,                   /* mmonit  */
+  YYSYMBOL_mmonitoptlist = 390,            /* mmonitoptlist  */
+  YYSYMBOL_mmonitopt = 391,                /* mmonitopt  */
+  YYSYMBOL_credentials = 392,              /* credentials  */
+  YYSYMBOL_setssl = 393,                   /* setssl  */
+  YYSYMBOL_ssl = 394,                      /* ssl  */
+  YYSYMBOL_ssloptionlist = 395,            /* ssloptionlist  */
+  YYSYMBOL_ssloption = 396,                /* ssloption  */
+  YYSYMBOL_sslexpire = 397,                /* sslexpire  */
+  YYSYMBOL_expireoperator = 398,           /* expireoperator  */
+  YYSYMBOL_sslchecksum = 399,              /* sslchecksum  */
+  YYSYMBOL_checksumoperator = 400,         /* checksumoperator  */
+  YYSYMBOL_sslversionlist = 401,           /* sslversionlist  */
+  YYSYMBOL_sslversion = 402,               /* sslversion  */
+  YYSYMBOL_certmd5 = 403,                  /* certmd5  */
+  YYSYMBOL_setmailservers = 404,           /* setmailservers  */
+  YYSYMBOL_setmailformat = 405,            /* setmailformat  */
+  YYSYMBOL_mailserverlist = 406,           /* mailserverlist  */
+  YYSYMBOL_mailserver = 407,               /* mailserver  */
+  YYSYMBOL_mailserveroptlist = 408,        /* mailserveroptlist  */
+  YYSYMBOL_mailserveropt = 409,            /* mailserveropt  */
+  YYSYMBOL_sethttpd = 410,                 /* sethttpd  */
+  YYSYMBOL_httpdlist = 411,                /* httpdlist  */
+  YYSYMBOL_httpdoption = 412,              /* httpdoption  */
+  YYSYMBOL_pemfile = 413,                  /* pemfile  */
+  YYSYMBOL_clientpemfile = 414,            /* clientpemfile  */
+  YYSYMBOL_allowselfcert = 415,            /* allowselfcert  */
+  YYSYMBOL_httpdport = 416,                /* httpdport  */
+  YYSYMBOL_httpdsocket = 417,              /* httpdsocket  */
+  YYSYMBOL_httpdsocketoptionlist = 418,    /* httpdsocketoptionlist  */
+  YYSYMBOL_httpdsocketoption = 419,        /* httpdsocketoption  */
+  YYSYMBOL_sigenable = 420,                /* sigenable  */
+  YYSYMBOL_sigdisable = 421,               /* sigdisable  */
+  YYSYMBOL_signature = 422,                /* signature  */
+  YYSYMBOL_bindaddress = 423,              /* bindaddress  */
+  YYSYMBOL_allow = 424,                    /* allow  */
+  YYSYMBOL_425_1 = 425,                    /* $@1  */
+  YYSYMBOL_426_2 = 426,                    /* $@2  */
+  YYSYMBOL_427_3 = 427,                    /* $@3  */
+  YYSYMBOL_428_4 = 428,                    /* $@4  */
+  YYSYMBOL_allowuserlist = 429,            /* allowuserlist  */
+  YYSYMBOL_allowuser = 430,                /* allowuser  */
+  YYSYMBOL_readonly = 431,                 /* readonly  */
+  YYSYMBOL_checkproc = 432,                /* checkproc  */
+  YYSYMBOL_checkfile = 433,                /* checkfile  */
+  YYSYMBOL_checkfileset = 434,             /* checkfileset  */
+  YYSYMBOL_checkfilesys = 435,             /* checkfilesys  */
+  YYSYMBOL_checkdir = 436,                 /* checkdir  */
+  YYSYMBOL_checkhost = 437,                /* checkhost  */
+  YYSYMBOL_checknet = 438,                 /* checknet  */
+  YYSYMBOL_checksystem = 439,              /* checksystem  */
+  YYSYMBOL_checkfifo = 440,                /* checkfifo  */
+  YYSYMBOL_checkprogram = 441,             /* checkprogram  */
+  YYSYMBOL_start = 442,                    /* start  */
+  YYSYMBOL_stop = 443,                     /* stop  */
+  YYSYMBOL_restart = 444,                  /* restart  */
+  YYSYMBOL_argumentlist = 445,             /* argumentlist  */
+  YYSYMBOL_useroptionlist = 446,           /* useroptionlist  */
+  YYSYMBOL_argument = 447,                 /* argument  */
+  YYSYMBOL_useroption = 448,               /* useroption  */
+  YYSYMBOL_username = 449,                 /* username  */
+  YYSYMBOL_password = 450,                 /* password  */
+  YYSYMBOL_hostname = 451,                 /* hostname  */
+  YYSYMBOL_connection = 452,               /* connection  */
+  YYSYMBOL_connectionoptlist = 453,        /* connectionoptlist  */
+  YYSYMBOL_connectionopt = 454,            /* connectionopt  */
+  YYSYMBOL_connectionurl = 455,            /* connectionurl  */
+  YYSYMBOL_connectionurloptlist = 456,     /* connectionurloptlist  */
+  YYSYMBOL_connectionurlopt = 457,         /* connectionurlopt  */
+  YYSYMBOL_connectionunix = 458,           /* connectionunix  */
+  YYSYMBOL_connectionuxoptlist = 459,      /* connectionuxoptlist  */
+  YYSYMBOL_connectionuxopt = 460,          /* connectionuxopt  */
+  YYSYMBOL_icmp = 461,                     /* icmp  */
+  YYSYMBOL_icmpoptlist = 462,              /* icmpoptlist  */
+  YYSYMBOL_icmpopt = 463,                  /* icmpopt  */
+  YYSYMBOL_host = 464,                     /* host  */
+  YYSYMBOL_port = 465,                     /* port  */
+  YYSYMBOL_unixsocket = 466,               /* unixsocket  */
+  YYSYMBOL_ip = 467,                       /* ip  */
+  YYSYMBOL_type = 468,                     /* type  */
+  YYSYMBOL_typeoptlist = 469,              /* typeoptlist  */
+  YYSYMBOL_typeopt = 470,                  /* typeopt  */
+  YYSYMBOL_outgoing = 471,                 /* outgoing  */
+  YYSYMBOL_protocol = 472,                 /* protocol  */
+  YYSYMBOL_sendexpect = 473,               /* sendexpect  */
+  YYSYMBOL_websocketlist = 474,            /* websocketlist  */
+  YYSYMBOL_websocket = 475,                /* websocket  */
+  YYSYMBOL_smtplist = 476,                 /* smtplist  */
+  YYSYMBOL_smtp = 477,                     /* smtp  */
+  YYSYMBOL_mqttlist = 478,                 /* mqttlist  */
+  YYSYMBOL_mqtt = 479,                     /* mqtt  */
+  YYSYMBOL_mysqllist = 480,                /* mysqllist  */
+  YYSYMBOL_mysql = 481,                    /* mysql  */
+  YYSYMBOL_target = 482,                   /* target  */
+  YYSYMBOL_maxforward = 483,               /* maxforward  */
+  YYSYMBOL_siplist = 484,                  /* siplist  */
+  YYSYMBOL_sip = 485,                      /* sip  */
+  YYSYMBOL_httplist = 486,                 /* httplist  */
+  YYSYMBOL_http = 487,                     /* http  */
+  YYSYMBOL_http2list = 488,                /* http2list  */
+  YYSYMBOL_http2 = 489,                    /* http2  */
+  YYSYMBOL_status = 490,                   /* status  */
+  YYSYMBOL_method = 491,                   /* method  */
+  YYSYMBOL_request = 492,                  /* request  */
+  YYSYMBOL_responsesum = 493,              /* responsesum  */
+  YYSYMBOL_hostheader = 494,               /* hostheader  */
+  YYSYMBOL_httpheaderlist = 495,           /* httpheaderlist  */
+  YYSYMBOL_secret = 496,                   /* secret  */
+  YYSYMBOL_radiuslist = 497,               /* radiuslist  */
+  YYSYMBOL_radius = 498,                   /* radius  */
+  YYSYMBOL_apache_stat_list = 499,         /* apache_stat_list  */
+  YYSYMBOL_apache_stat = 500,              /* apache_stat  */
+  YYSYMBOL_exist = 501,                    /* exist  */
+  YYSYMBOL_pid = 502,                      /* pid  */
+  YYSYMBOL_ppid = 503,                     /* ppid  */
+  YYSYMBOL_uptime = 504,                   /* uptime  */
+  YYSYMBOL_icmpcount = 505,                /* icmpcount  */
+  YYSYMBOL_icmpsize = 506,                 /* icmpsize  */
+  YYSYMBOL_icmptimeout = 507,              /* icmptimeout  */
+  YYSYMBOL_icmpoutgoing = 508,             /* icmpoutgoing  */
+  YYSYMBOL_stoptimeout = 509,              /* stoptimeout  */
+  YYSYMBOL_starttimeout = 510,             /* starttimeout  */
+  YYSYMBOL_restarttimeout = 511,           /* restarttimeout  */
+  YYSYMBOL_programtimeout = 512,           /* programtimeout  */
+  YYSYMBOL_nettimeout = 513,               /* nettimeout  */
+  YYSYMBOL_connectiontimeout = 514,        /* connectiontimeout  */
+  YYSYMBOL_retry = 515,                    /* retry  */
+  YYSYMBOL_persistent = 516,               /* persistent  */
+  YYSYMBOL_timing = 517,                   /* timing  */
+  YYSYMBOL_timingphase = 518,              /* timingphase  */
+  YYSYMBOL_actionrate = 519,               /* actionrate  */
+  YYSYMBOL_urloption = 520,                /* urloption  */
+  YYSYMBOL_urloperator = 521,              /* urloperator  */
+  YYSYMBOL_alert = 522,                    /* alert  */
+  YYSYMBOL_alertmail = 523,                /* alertmail  */
+  YYSYMBOL_noalertmail = 524,              /* noalertmail  */
+  YYSYMBOL_eventoptionlist = 525,          /* eventoptionlist  */
+  YYSYMBOL_eventoption = 526,              /* eventoption  */
+  YYSYMBOL_formatlist = 527,               /* formatlist  */
+  YYSYMBOL_formatoptionlist = 528,         /* formatoptionlist  */
+  YYSYMBOL_formatoption = 529,             /* formatoption  */
+  YYSYMBOL_every = 530,                    /* every  */
+  YYSYMBOL_mode = 531,                     /* mode  */
+  YYSYMBOL_onreboot = 532,                 /* onreboot  */
+  YYSYMBOL_group = 533,                    /* group  */
+  YYSYMBOL_depend = 534,                   /* depend  */
+  YYSYMBOL_dependlist = 535,               /* dependlist  */
+  YYSYMBOL_dependant = 536,                /* dependant  */
+  YYSYMBOL_statusvalue = 537,              /* statusvalue  */
+  YYSYMBOL_resourceprocess = 538,          /* resourceprocess  */
+  YYSYMBOL_resourceprocesslist = 539,      /* resourceprocesslist  */
+  YYSYMBOL_resourceprocessopt = 540,       /* resourceprocessopt  */
+  YYSYMBOL_resourcesystem = 541,           /* resourcesystem  */
+  YYSYMBOL_resourcesystemlist = 542,       /* resourcesystemlist  */
+  YYSYMBOL_resourcesystemopt = 543,        /* resourcesystemopt  */
+  YYSYMBOL_resourcedirectory = 544,        /* resourcedirectory  */
+  YYSYMBOL_resourcedirectoryopt = 545,     /* resourcedirectoryopt  */
+  YYSYMBOL_resourcecpuproc = 546,          /* resourcecpuproc  */
+  YYSYMBOL_resourcecpu = 547,              /* resourcecpu  */
+  YYSYMBOL_resourcecpuid = 548,            /* resourcecpuid  */
+  YYSYMBOL_resourcemem = 549,              /* resourcemem  */
+  YYSYMBOL_resourcememproc = 550,          /* resourcememproc  */
+  YYSYMBOL_resourceswap = 551,             /* resourceswap  */
+  YYSYMBOL_resourcenetstack = 552,         /* resourcenetstack  */
+  YYSYMBOL_resourcethreads = 553,          /* resourcethreads  */
+  YYSYMBOL_resourcechild = 554,            /* resourcechild  */
+  YYSYMBOL_resourceload = 555,             /* resourceload  */
+  YYSYMBOL_resourceloadavg = 556,          /* resourceloadavg  */
+  YYSYMBOL_coremultiplier = 557,           /* coremultiplier  */
+  YYSYMBOL_resourceread = 558,             /* resourceread  */
+  YYSYMBOL_resourcewrite = 559,            /* resourcewrite  */
+  YYSYMBOL_value = 560,                    /* value  */
+  YYSYMBOL_timestamptype = 561,            /* timestamptype  */
+  YYSYMBOL_timestamp = 562,                /* timestamp  */
+  YYSYMBOL_operator = 563,                 /* operator  */
+  YYSYMBOL_time = 564,                     /* time  */
+  YYSYMBOL_totaltime = 565,                /* totaltime  */
+  YYSYMBOL_currenttime = 566,              /* currenttime  */
+  YYSYMBOL_repeat = 567,                   /* repeat  */
+  YYSYMBOL_action = 568,                   /* action  */
+  YYSYMBOL_action1 = 569,                  /* action1  */
+  YYSYMBOL_action2 = 570,                  /* action2  */
+  YYSYMBOL_rateXcycles = 571,              /* rateXcycles  */
+  YYSYMBOL_rateXYcycles = 572,             /* rateXYcycles  */
+  YYSYMBOL_rate1 = 573,                    /* rate1  */
+  YYSYMBOL_rate2 = 574,                    /* rate2  */
+  YYSYMBOL_recovery = 575,                 /* recovery  */
+  YYSYMBOL_checksum = 576,                 /* checksum  */
+  YYSYMBOL_hashtype = 577,                 /* hashtype  */
+  YYSYMBOL_inode = 578,                    /* inode  */
+  YYSYMBOL_space = 579,                    /* space  */
+  YYSYMBOL_read = 580,                     /* read  */
+  YYSYMBOL_write = 581,                    /* write  */
+  YYSYMBOL_servicetime = 582,              /* servicetime  */
+  YYSYMBOL_timetofullwindow = 583,         /* timetofullwindow  */
+  YYSYMBOL_utilization = 584,              /* utilization  */
+  YYSYMBOL_queuedepth = 585,               /* queuedepth  */
+  YYSYMBOL_iops = 586,                     /* iops  */
+  YYSYMBOL_fsflag = 587,                   /* fsflag  */
+  YYSYMBOL_unit = 588,                     /* unit  */
+  YYSYMBOL_permission = 589,               /* permission  */
+  YYSYMBOL_match = 590,                    /* match  */
+  YYSYMBOL_matchflagnot = 591,             /* matchflagnot  */
+  YYSYMBOL_size = 592,                     /* size  */
+  YYSYMBOL_uid = 593,                      /* uid  */
+  YYSYMBOL_euid = 594,                     /* euid  */
+  YYSYMBOL_secattr = 595,                  /* secattr  */
+  YYSYMBOL_filedescriptorssystem = 596,    /* filedescriptorssystem  */
+  YYSYMBOL_listen = 597,                   /* listen  */
+  YYSYMBOL_listenaddress = 598,            /* listenaddress  */
+  YYSYMBOL_filedescriptorsprocess = 599,   /* filedescriptorsprocess  */
+  YYSYMBOL_filedescriptorsprocesstotal = 600, /* filedescriptorsprocesstotal  */
+  YYSYMBOL_gid = 601,                      /* gid  */
+  YYSYMBOL_linkstatus = 602,               /* linkstatus  */
+  YYSYMBOL_linkspeed = 603,                /* linkspeed  */
+  YYSYMBOL_linksaturation = 604,           /* linksaturation  */
+  YYSYMBOL_upload = 605,                   /* upload  */
+  YYSYMBOL_download = 606,                 /* download  */
+  YYSYMBOL_linkcounter = 607,              /* linkcounter  */
+  YYSYMBOL_linkcountertype = 608,          /* linkcountertype  */
+  YYSYMBOL_icmptype = 609,                 /* icmptype  */
+  YYSYMBOL_reminder = 610                  /* reminder  */
 };
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
-
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-extern YYSTYPE yylval;
-
-int yyparse (void);
-
-#endif /* !YY_YY_SRC_Y_TAB_H_INCLUDED  */
 
 
 
@@ -1070,6 +1051,18 @@ typedef int_least16_t yytype_int16;
 typedef short yytype_int16;
 #endif
 
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
 #if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
 typedef __UINT_LEAST8_TYPE__ yytype_uint8;
 #elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
@@ -1129,6 +1122,7 @@ typedef int yytype_uint16;
 
 #define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
 
+
 /* Stored state numbers (used for stacks). */
 typedef yytype_int16 yy_state_t;
 
@@ -1147,6 +1141,7 @@ typedef int yy_state_fast_t;
 # endif
 #endif
 
+
 #ifndef YY_ATTRIBUTE_PURE
 # if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
 #  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
@@ -1165,17 +1160,23 @@ typedef int yy_state_fast_t;
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                            \
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
     _Pragma ("GCC diagnostic push")                                     \
     _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
 # define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
@@ -1204,7 +1205,7 @@ typedef int yy_state_fast_t;
 
 #define YY_ASSERT(E) ((void) (0 && (E)))
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -1269,8 +1270,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -1333,27 +1333,29 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  69
+#define YYFINAL  72
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1839
+#define YYLAST   2321
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  304
+#define YYNTOKENS  347
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  245
+#define YYNNTS  264
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  812
+#define YYNRULES  920
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  1537
+#define YYNSTATES  1817
 
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   552
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   595
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex, with out-of-bounds checking.  */
-#define YYTRANSLATE(YYX)                                                \
-  (0 <= (YYX) && (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex.  */
@@ -1364,14 +1366,14 @@ static const yytype_int16 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   300,     2,
-       2,     2,     2,     2,   301,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   343,     2,
+       2,     2,     2,     2,   344,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,   302,     2,   303,     2,     2,     2,     2,     2,     2,
+       2,   345,     2,   346,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   298,     2,   299,     2,     2,     2,     2,
+       2,     2,     2,   341,     2,   342,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1414,1357 +1416,1568 @@ static const yytype_int16 yytranslate[] =
      265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
      275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
      285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297
+     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
+     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
+     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   376,   376,   377,   380,   381,   384,   385,   386,   387,
-     388,   389,   390,   391,   392,   393,   394,   395,   396,   397,
-     398,   399,   400,   401,   402,   403,   404,   405,   406,   407,
-     408,   409,   410,   413,   414,   417,   418,   419,   420,   421,
-     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
-     432,   433,   434,   435,   436,   437,   438,   439,   440,   443,
-     444,   447,   448,   449,   450,   451,   452,   453,   454,   455,
-     456,   457,   458,   459,   460,   461,   462,   463,   464,   467,
-     468,   471,   472,   473,   474,   475,   476,   477,   478,   479,
-     480,   481,   482,   483,   484,   485,   486,   487,   488,   489,
-     490,   493,   494,   497,   498,   499,   500,   501,   502,   503,
-     504,   505,   506,   507,   508,   509,   510,   511,   514,   515,
+       0,   390,   390,   391,   394,   395,   398,   399,   400,   401,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,   411,
+     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   423,   424,   425,   428,   429,   432,   433,   434,   435,
+     436,   437,   438,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,   449,   450,   451,   452,   453,   454,   455,
+     456,   459,   460,   463,   464,   465,   466,   467,   468,   469,
+     470,   471,   472,   473,   474,   475,   476,   477,   478,   479,
+     480,   483,   484,   487,   488,   489,   490,   491,   492,   493,
+     494,   495,   496,   497,   498,   499,   500,   501,   502,   503,
+     506,   507,   510,   511,   512,   513,   514,   515,   516,   517,
      518,   519,   520,   521,   522,   523,   524,   525,   526,   527,
-     528,   529,   530,   533,   534,   537,   538,   539,   540,   541,
+     528,   529,   530,   531,   532,   535,   536,   539,   540,   541,
      542,   543,   544,   545,   546,   547,   548,   549,   550,   551,
-     554,   555,   558,   559,   560,   561,   562,   563,   564,   565,
-     566,   567,   568,   569,   570,   573,   574,   577,   578,   579,
+     552,   553,   554,   557,   558,   561,   562,   563,   564,   565,
+     566,   567,   568,   569,   570,   571,   572,   573,   576,   577,
      580,   581,   582,   583,   584,   585,   586,   587,   588,   589,
-     590,   591,   594,   595,   598,   599,   600,   601,   602,   603,
-     604,   605,   606,   607,   608,   611,   615,   618,   624,   634,
-     639,   642,   647,   652,   655,   658,   663,   669,   672,   673,
-     676,   679,   682,   685,   688,   691,   694,   697,   700,   703,
-     706,   709,   712,   715,   720,   725,   733,   736,   741,   744,
-     748,   754,   759,   764,   772,   775,   776,   779,   785,   786,
-     789,   792,   793,   794,   795,   798,   799,   804,   809,   812,
-     815,   816,   819,   823,   827,   831,   835,   838,   842,   845,
-     848,   851,   854,   857,   862,   868,   869,   872,   886,   893,
-     902,   903,   906,   907,   910,   917,   920,   927,   930,   937,
-     940,   947,   950,   957,   960,   967,   970,   981,   990,   997,
-    1012,  1013,  1016,  1025,  1036,  1037,  1040,  1043,  1046,  1047,
-    1048,  1049,  1052,  1079,  1080,  1083,  1084,  1085,  1086,  1087,
-    1088,  1089,  1090,  1091,  1095,  1101,  1107,  1113,  1119,  1125,
-    1126,  1129,  1134,  1139,  1143,  1147,  1153,  1154,  1157,  1158,
-    1161,  1164,  1169,  1174,  1177,  1185,  1189,  1193,  1197,  1201,
-    1201,  1208,  1208,  1215,  1215,  1222,  1222,  1229,  1236,  1237,
-    1240,  1246,  1249,  1254,  1257,  1260,  1267,  1276,  1281,  1284,
-    1289,  1294,  1299,  1307,  1313,  1328,  1333,  1339,  1347,  1350,
-    1355,  1358,  1364,  1367,  1372,  1373,  1376,  1377,  1380,  1383,
-    1388,  1392,  1396,  1399,  1404,  1407,  1412,  1417,  1420,  1425,
-    1434,  1435,  1438,  1439,  1440,  1441,  1442,  1443,  1444,  1445,
-    1446,  1447,  1448,  1451,  1458,  1459,  1462,  1463,  1464,  1465,
-    1466,  1467,  1470,  1476,  1477,  1480,  1481,  1482,  1483,  1484,
-    1487,  1493,  1498,  1503,  1510,  1511,  1514,  1515,  1516,  1517,
-    1520,  1523,  1528,  1533,  1539,  1542,  1547,  1550,  1554,  1559,
-    1560,  1563,  1564,  1567,  1572,  1575,  1578,  1581,  1584,  1587,
-    1590,  1593,  1598,  1601,  1606,  1609,  1612,  1615,  1618,  1621,
-    1624,  1628,  1631,  1634,  1638,  1641,  1644,  1649,  1652,  1655,
-    1660,  1663,  1666,  1669,  1672,  1675,  1678,  1681,  1684,  1687,
-    1690,  1693,  1698,  1706,  1716,  1717,  1720,  1723,  1726,  1729,
-    1734,  1735,  1738,  1741,  1746,  1747,  1750,  1753,  1758,  1759,
-    1762,  1765,  1768,  1781,  1787,  1796,  1799,  1804,  1809,  1810,
-    1813,  1816,  1821,  1822,  1825,  1828,  1831,  1832,  1833,  1834,
-    1835,  1836,  1839,  1849,  1852,  1857,  1861,  1867,  1872,  1878,
-    1879,  1884,  1889,  1890,  1893,  1898,  1899,  1902,  1905,  1908,
-    1911,  1915,  1919,  1923,  1927,  1931,  1935,  1939,  1943,  1947,
-    1953,  1957,  1964,  1970,  1976,  1984,  1989,  1999,  2004,  2009,
-    2012,  2017,  2020,  2025,  2028,  2033,  2036,  2041,  2044,  2049,
-    2054,  2059,  2065,  2073,  2079,  2080,  2083,  2087,  2090,  2094,
-    2099,  2102,  2105,  2106,  2109,  2110,  2111,  2112,  2113,  2114,
-    2115,  2116,  2117,  2118,  2119,  2120,  2121,  2122,  2123,  2124,
-    2125,  2126,  2127,  2128,  2129,  2130,  2131,  2132,  2133,  2134,
-    2135,  2136,  2137,  2138,  2141,  2142,  2145,  2146,  2149,  2150,
-    2151,  2152,  2155,  2159,  2163,  2169,  2172,  2175,  2181,  2184,
-    2188,  2193,  2200,  2203,  2204,  2207,  2210,  2217,  2226,  2232,
-    2233,  2236,  2237,  2238,  2239,  2240,  2241,  2242,  2245,  2251,
-    2252,  2255,  2256,  2257,  2258,  2261,  2266,  2273,  2280,  2286,
-    2292,  2298,  2304,  2310,  2316,  2322,  2328,  2334,  2339,  2344,
-    2351,  2356,  2361,  2366,  2373,  2378,  2385,  2392,  2399,  2419,
-    2420,  2421,  2424,  2425,  2429,  2434,  2439,  2446,  2451,  2456,
-    2463,  2464,  2467,  2468,  2469,  2470,  2473,  2480,  2488,  2489,
-    2490,  2491,  2492,  2493,  2494,  2495,  2498,  2499,  2500,  2501,
-    2502,  2503,  2506,  2507,  2508,  2510,  2511,  2513,  2516,  2519,
-    2527,  2530,  2533,  2537,  2540,  2543,  2546,  2551,  2562,  2573,
-    2583,  2595,  2596,  2601,  2608,  2609,  2614,  2621,  2624,  2627,
-    2630,  2635,  2639,  2646,  2652,  2653,  2654,  2657,  2664,  2671,
-    2678,  2687,  2694,  2701,  2708,  2717,  2724,  2733,  2740,  2749,
-    2756,  2765,  2771,  2772,  2773,  2774,  2775,  2778,  2783,  2790,
-    2798,  2805,  2813,  2821,  2828,  2834,  2841,  2849,  2852,  2858,
-    2864,  2871,  2877,  2884,  2890,  2897,  2900,  2905,  2911,  2919,
-    2925,  2933,  2941,  2947,  2954,  2960,  2965,  2973,  2981,  2989,
-    2997,  3005,  3013,  3023,  3031,  3039,  3047,  3055,  3063,  3073,
-    3076,  3077,  3078
+     590,   591,   592,   593,   594,   595,   598,   599,   602,   603,
+     604,   605,   606,   607,   608,   609,   610,   611,   612,   613,
+     614,   615,   618,   619,   622,   623,   624,   625,   626,   627,
+     628,   629,   630,   631,   632,   633,   634,   635,   636,   639,
+     640,   643,   644,   645,   646,   647,   648,   649,   650,   651,
+     652,   653,   656,   660,   663,   669,   679,   684,   687,   692,
+     697,   700,   703,   708,   714,   717,   718,   721,   724,   727,
+     730,   733,   736,   739,   742,   745,   748,   751,   754,   757,
+     760,   763,   769,   772,   775,   778,   781,   784,   789,   794,
+     802,   805,   810,   813,   817,   823,   828,   833,   841,   844,
+     845,   848,   854,   855,   858,   861,   862,   863,   864,   867,
+     868,   873,   878,   881,   884,   885,   888,   892,   896,   900,
+     904,   907,   911,   914,   917,   920,   923,   926,   931,   937,
+     938,   941,   955,   962,   971,   972,   975,   976,   979,   986,
+     989,   996,   999,  1006,  1009,  1016,  1019,  1026,  1029,  1036,
+    1039,  1050,  1059,  1066,  1081,  1082,  1085,  1094,  1105,  1106,
+    1109,  1112,  1115,  1116,  1117,  1118,  1121,  1148,  1149,  1152,
+    1153,  1154,  1155,  1156,  1157,  1158,  1159,  1160,  1164,  1170,
+    1176,  1182,  1188,  1194,  1195,  1198,  1203,  1208,  1212,  1216,
+    1222,  1223,  1226,  1227,  1230,  1233,  1238,  1243,  1246,  1254,
+    1258,  1262,  1266,  1270,  1270,  1277,  1277,  1284,  1284,  1291,
+    1291,  1298,  1305,  1306,  1309,  1315,  1318,  1323,  1326,  1329,
+    1336,  1345,  1350,  1355,  1358,  1363,  1368,  1373,  1381,  1387,
+    1402,  1407,  1413,  1421,  1424,  1429,  1432,  1438,  1441,  1446,
+    1447,  1450,  1451,  1454,  1457,  1462,  1466,  1470,  1473,  1478,
+    1481,  1486,  1491,  1494,  1499,  1508,  1509,  1512,  1513,  1514,
+    1515,  1516,  1517,  1518,  1519,  1520,  1521,  1522,  1523,  1524,
+    1527,  1534,  1535,  1538,  1539,  1540,  1541,  1542,  1543,  1544,
+    1545,  1548,  1554,  1555,  1558,  1559,  1560,  1561,  1562,  1563,
+    1564,  1567,  1573,  1578,  1583,  1590,  1591,  1594,  1595,  1596,
+    1597,  1600,  1603,  1608,  1613,  1619,  1622,  1627,  1630,  1634,
+    1639,  1640,  1643,  1644,  1647,  1652,  1655,  1658,  1661,  1664,
+    1667,  1670,  1673,  1678,  1682,  1685,  1690,  1693,  1696,  1699,
+    1702,  1705,  1708,  1712,  1715,  1718,  1722,  1725,  1728,  1733,
+    1736,  1739,  1744,  1747,  1750,  1753,  1756,  1759,  1762,  1765,
+    1768,  1771,  1774,  1777,  1782,  1790,  1798,  1808,  1809,  1812,
+    1815,  1818,  1821,  1826,  1827,  1830,  1833,  1838,  1839,  1842,
+    1845,  1850,  1851,  1854,  1857,  1860,  1873,  1879,  1888,  1891,
+    1896,  1901,  1902,  1905,  1908,  1913,  1914,  1917,  1920,  1923,
+    1924,  1925,  1926,  1927,  1928,  1931,  1932,  1935,  1938,  1941,
+    1944,  1947,  1948,  1949,  1950,  1953,  1963,  1966,  1971,  1975,
+    1981,  1986,  1992,  1993,  1998,  2003,  2004,  2007,  2012,  2013,
+    2016,  2019,  2022,  2025,  2029,  2033,  2037,  2041,  2045,  2049,
+    2053,  2057,  2061,  2067,  2071,  2078,  2084,  2090,  2098,  2103,
+    2113,  2118,  2123,  2126,  2131,  2134,  2139,  2142,  2147,  2150,
+    2155,  2158,  2163,  2168,  2173,  2178,  2181,  2184,  2189,  2190,
+    2191,  2192,  2193,  2194,  2195,  2198,  2204,  2212,  2218,  2219,
+    2222,  2226,  2229,  2233,  2238,  2241,  2244,  2245,  2248,  2249,
+    2250,  2251,  2252,  2253,  2254,  2255,  2256,  2257,  2258,  2259,
+    2260,  2261,  2262,  2263,  2264,  2265,  2266,  2267,  2268,  2269,
+    2270,  2271,  2272,  2273,  2274,  2275,  2276,  2277,  2280,  2281,
+    2284,  2285,  2288,  2289,  2290,  2291,  2294,  2298,  2302,  2308,
+    2311,  2314,  2320,  2323,  2327,  2332,  2339,  2342,  2343,  2346,
+    2349,  2356,  2365,  2371,  2372,  2375,  2376,  2377,  2378,  2379,
+    2380,  2381,  2384,  2390,  2391,  2394,  2395,  2396,  2397,  2398,
+    2401,  2407,  2412,  2417,  2424,  2429,  2436,  2443,  2449,  2455,
+    2461,  2467,  2473,  2479,  2485,  2491,  2497,  2502,  2507,  2514,
+    2519,  2524,  2529,  2536,  2541,  2548,  2553,  2558,  2563,  2568,
+    2573,  2578,  2583,  2590,  2597,  2604,  2624,  2625,  2626,  2629,
+    2630,  2634,  2639,  2644,  2651,  2656,  2661,  2668,  2669,  2672,
+    2673,  2674,  2675,  2678,  2685,  2693,  2694,  2695,  2696,  2697,
+    2698,  2699,  2700,  2703,  2704,  2705,  2706,  2707,  2708,  2711,
+    2712,  2713,  2715,  2716,  2718,  2721,  2724,  2732,  2735,  2738,
+    2742,  2745,  2748,  2751,  2756,  2767,  2778,  2788,  2800,  2801,
+    2806,  2813,  2814,  2819,  2826,  2829,  2832,  2835,  2840,  2844,
+    2851,  2857,  2858,  2859,  2860,  2861,  2864,  2871,  2878,  2885,
+    2892,  2902,  2910,  2917,  2924,  2931,  2940,  2947,  2954,  2961,
+    2970,  2977,  2984,  2991,  3000,  3007,  3016,  3017,  3024,  3033,
+    3042,  3051,  3057,  3058,  3059,  3060,  3061,  3064,  3069,  3076,
+    3084,  3091,  3099,  3107,  3114,  3120,  3127,  3135,  3138,  3144,
+    3150,  3157,  3163,  3170,  3176,  3183,  3186,  3191,  3197,  3205,
+    3208,  3211,  3214,  3219,  3222,  3227,  3233,  3241,  3249,  3255,
+    3262,  3268,  3273,  3281,  3289,  3297,  3305,  3313,  3321,  3331,
+    3339,  3347,  3355,  3363,  3371,  3381,  3390,  3399,  3410,  3411,
+    3412,  3413,  3414,  3415,  3416,  3417,  3418,  3421,  3424,  3425,
+    3426
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "IF", "ELSE", "THEN", "FAILED", "SET",
-  "LOGFILE", "FACILITY", "DAEMON", "SYSLOG", "MAILSERVER", "HTTPD",
-  "ALLOW", "REJECTOPT", "ADDRESS", "INIT", "TERMINAL", "BATCH", "READONLY",
-  "CLEARTEXT", "MD5HASH", "SHA1HASH", "CRYPT", "DELAY", "PEMFILE",
-  "PEMKEY", "PEMCHAIN", "ENABLE", "DISABLE", "SSLTOKEN", "CIPHER",
-  "CLIENTPEMFILE", "ALLOWSELFCERTIFICATION", "SELFSIGNED", "VERIFY",
-  "CERTIFICATE", "CACERTIFICATEFILE", "CACERTIFICATEPATH", "VALID",
-  "INTERFACE", "LINK", "PACKET", "BYTEIN", "BYTEOUT", "PACKETIN",
-  "PACKETOUT", "SPEED", "SATURATION", "UPLOAD", "DOWNLOAD", "TOTAL",
-  "IDFILE", "STATEFILE", "SEND", "EXPECT", "CYCLE", "COUNT", "REMINDER",
-  "REPEAT", "LIMITS", "SENDEXPECTBUFFER", "EXPECTBUFFER",
-  "FILECONTENTBUFFER", "HTTPCONTENTBUFFER", "PROGRAMOUTPUT",
-  "NETWORKTIMEOUT", "PROGRAMTIMEOUT", "STARTTIMEOUT", "STOPTIMEOUT",
-  "RESTARTTIMEOUT", "PIDFILE", "START", "STOP", "PATHTOK", "RSAKEY",
+  "\"end of file\"", "error", "\"invalid token\"", "IF", "ELSE", "THEN",
+  "FAILED", "SET", "LOGFILE", "FACILITY", "DAEMON", "SYSLOG", "MAILSERVER",
+  "HTTPD", "ALLOW", "REJECTOPT", "ADDRESS", "INIT", "TERMINAL", "BATCH",
+  "READONLY", "CLEARTEXT", "MD5HASH", "SHA1HASH", "SHA256HASH",
+  "XXH64HASH", "CRYPT", "DELAY", "PEMFILE", "PEMKEY", "PEMCHAIN", "ENABLE",
+  "DISABLE", "SSLTOKEN", "CIPHER", "CLIENTPEMFILE",
+  "ALLOWSELFCERTIFICATION", "SELFSIGNED", "VERIFY", "CERTIFICATE",
+  "CACERTIFICATEFILE", "CACERTIFICATEPATH", "VALID", "INTERFACE", "LINK",
+  "PACKET", "BYTEIN", "BYTEOUT", "PACKETIN", "PACKETOUT", "SPEED",
+  "SATURATION", "UPLOAD", "DOWNLOAD", "TOTAL", "DROP", "MISSED", "FIFO",
+  "CARRIER", "MULTICAST", "COLLISION", "TCPRETRANSMITS", "LISTENOVERFLOWS",
+  "LISTENDROPS", "SYNCOOKIES", "ORPHANS", "TIMEWAIT", "UDPRCVBUFERRORS",
+  "LISTENING", "LISTENQUEUE", "ESTABLISHED", "IDFILE", "STATEFILE", "SEND",
+  "EXPECT", "CYCLE", "COUNT", "REMINDER", "REPEAT", "LIMITS",
+  "SENDEXPECTBUFFER", "EXPECTBUFFER", "FILECONTENTBUFFER",
+  "HTTPCONTENTBUFFER", "PROGRAMOUTPUT", "NETWORKTIMEOUT", "PROGRAMTIMEOUT",
+  "STARTTIMEOUT", "STOPTIMEOUT", "RESTARTTIMEOUT", "CHECKSUMWORKERS",
+  "CHECKSUMIDLEIO", "FILESYSTEMTIMEOUT", "DNSTTL", "DNSNEGATIVETTL",
+  "ENTRIES", "OLDEST", "PIDFILE", "START", "STOP", "PATHTOK", "RSAKEY",
   "HOST", "HOSTNAME", "PORT", "IPV4", "IPV6", "TYPE", "UDP", "TCP",
   "TCPSSL", "PROTOCOL", "CONNECTION", "ALERT", "NOALERT", "MAILFORMAT",
-  "UNIXSOCKET", "SIGNATURE", "TIMEOUT", "RETRY", "RESTART", "CHECKSUM",
-  "EVERY", "NOTEVERY", "DEFAULT", "HTTP", "HTTPS", "APACHESTATUS", "FTP",
-  "SMTP", "SMTPS", "POP", "POPS", "IMAP", "IMAPS", "CLAMAV", "NNTP",
-  "NTP3", "MYSQL", "MYSQLS", "DNS", "WEBSOCKET", "MQTT", "SSH", "DWP",
-  "LDAP2", "LDAP3", "RDATE", "RSYNC", "TNS", "PGSQL", "POSTFIXPOLICY",
-  "SIP", "LMTP", "GPS", "RADIUS", "MEMCACHE", "REDIS", "MONGODB", "SIEVE",
-  "SPAMASSASSIN", "FAIL2BAN", "STRING", "PATH", "MAILADDR", "MAILFROM",
-  "MAILREPLYTO", "MAILSUBJECT", "MAILBODY", "SERVICENAME", "STRINGNAME",
-  "NUMBER", "PERCENT", "LOGLIMIT", "CLOSELIMIT", "DNSLIMIT",
-  "KEEPALIVELIMIT", "REPLYLIMIT", "REQUESTLIMIT", "STARTLIMIT",
-  "WAITLIMIT", "GRACEFULLIMIT", "CLEANUPLIMIT", "REAL", "CHECKPROC",
-  "CHECKFILESYS", "CHECKFILE", "CHECKDIR", "CHECKHOST", "CHECKSYSTEM",
-  "CHECKFIFO", "CHECKPROGRAM", "CHECKNET", "THREADS", "CHILDREN", "METHOD",
-  "GET", "HEAD", "STATUS", "ORIGIN", "VERSIONOPT", "READ", "WRITE",
-  "OPERATION", "SERVICETIME", "DISK", "RESOURCE", "MEMORY", "TOTALMEMORY",
-  "LOADAVG1", "LOADAVG5", "LOADAVG15", "SWAP", "MODE", "ACTIVE", "PASSIVE",
-  "MANUAL", "ONREBOOT", "NOSTART", "LASTSTATE", "CORE", "CPU", "TOTALCPU",
-  "CPUUSER", "CPUSYSTEM", "CPUWAIT", "CPUNICE", "CPUHARDIRQ", "CPUSOFTIRQ",
-  "CPUSTEAL", "CPUGUEST", "CPUGUESTNICE", "GROUP", "REQUEST", "DEPENDS",
-  "BASEDIR", "SLOT", "EVENTQUEUE", "SECRET", "HOSTHEADER", "UID", "EUID",
-  "GID", "MMONIT", "INSTANCE", "USERNAME", "PASSWORD", "TIME", "ATIME",
-  "CTIME", "MTIME", "CHANGED", "MILLISECOND", "SECOND", "MINUTE", "HOUR",
-  "DAY", "MONTH", "SSLV2", "SSLV3", "TLSV1", "TLSV11", "TLSV12", "TLSV13",
-  "CERTMD5", "AUTO", "NOSSLV2", "NOSSLV3", "NOTLSV1", "NOTLSV11",
-  "NOTLSV12", "NOTLSV13", "BYTE", "KILOBYTE", "MEGABYTE", "GIGABYTE",
-  "INODE", "SPACE", "TFREE", "PERMISSION", "SIZE", "MATCH", "NOT",
-  "IGNORE", "ACTION", "UPTIME", "EXEC", "UNMONITOR", "PING", "PING4",
-  "PING6", "ICMP", "ICMPECHO", "NONEXIST", "EXIST", "INVALID", "DATA",
-  "RECOVERED", "PASSED", "SUCCEEDED", "URL", "CONTENT", "PID", "PPID",
-  "FSFLAG", "REGISTER", "CREDENTIALS", "URLOBJECT", "ADDRESSOBJECT",
-  "TARGET", "TIMESPEC", "HTTPHEADER", "MAXFORWARD", "FIPS", "SECURITY",
-  "ATTRIBUTE", "FILEDESCRIPTORS", "GREATER", "GREATEROREQUAL", "LESS",
-  "LESSOREQUAL", "EQUAL", "NOTEQUAL", "'{'", "'}'", "':'", "'@'", "'['",
-  "']'", "$accept", "cfgfile", "statement_list", "statement",
-  "optproclist", "optproc", "optfilelist", "optfile", "optfilesyslist",
-  "optfilesys", "optdirlist", "optdir", "opthostlist", "opthost",
-  "optnetlist", "optnet", "optsystemlist", "optsystem", "optfifolist",
-  "optfifo", "optprogramlist", "optprogram", "setalert", "setdaemon",
-  "setterminal", "startdelay", "setinit", "setonreboot", "setexpectbuffer",
-  "setlimits", "limitlist", "limit", "setfips", "setlog", "seteventqueue",
-  "setidfile", "setstatefile", "setpid", "setmmonits", "mmonitlist",
-  "mmonit", "mmonitoptlist", "mmonitopt", "credentials", "setssl", "ssl",
-  "ssloptionlist", "ssloption", "sslexpire", "expireoperator",
-  "sslchecksum", "checksumoperator", "sslversionlist", "sslversion",
-  "certmd5", "setmailservers", "setmailformat", "mailserverlist",
-  "mailserver", "mailserveroptlist", "mailserveropt", "sethttpd",
-  "httpdlist", "httpdoption", "pemfile", "clientpemfile", "allowselfcert",
-  "httpdport", "httpdsocket", "httpdsocketoptionlist", "httpdsocketoption",
-  "sigenable", "sigdisable", "signature", "bindaddress", "allow", "$@1",
-  "$@2", "$@3", "$@4", "allowuserlist", "allowuser", "readonly",
-  "checkproc", "checkfile", "checkfilesys", "checkdir", "checkhost",
-  "checknet", "checksystem", "checkfifo", "checkprogram", "start", "stop",
-  "restart", "argumentlist", "useroptionlist", "argument", "useroption",
-  "username", "password", "hostname", "connection", "connectionoptlist",
+  "UNIXSOCKET", "SIGNATURE", "TIMEOUT", "RETRY", "PERSISTENT", "RESTART",
+  "CHECKSUM", "EVERY", "NOTEVERY", "DNSTIME", "CONNECTTIME",
+  "TLSHANDSHAKE", "REQUESTTIME", "FIRSTBYTE", "RESPONSETIME", "RTT",
+  "RETRANSMITS", "DEFAULT", "HTTP", "HTTPS", "APACHESTATUS", "FTP", "SMTP",
+  "SMTPS", "POP", "POPS", "IMAP", "IMAPS", "CLAMAV", "NNTP", "NTP3",
+  "MYSQL", "MYSQLS", "DNS", "WEBSOCKET", "MQTT", "HTTP2", "HEX", "SSH",
+  "DWP", "LDAP2", "LDAP3", "RDATE", "RSYNC", "TNS", "PGSQL",
+  "POSTFIXPOLICY", "SIP", "LMTP", "GPS", "RADIUS", "MEMCACHE", "REDIS",
+  "MONGODB", "SIEVE", "SPAMASSASSIN", "FAIL2BAN", "STRING", "PATH",
+  "MAILADDR", "MAILFROM", "MAILREPLYTO", "MAILSUBJECT", "MAILBODY",
+  "SERVICENAME", "STRINGNAME", "NUMBER", "PERCENT", "LOGLIMIT",
+  "CLOSELIMIT", "DNSLIMIT", "KEEPALIVELIMIT", "REPLYLIMIT", "REQUESTLIMIT",
+  "STARTLIMIT", "WAITLIMIT", "GRACEFULLIMIT", "CLEANUPLIMIT", "REAL",
+  "CHECKPROC", "CHECKFILESYS", "CHECKFILE", "CHECKDIR", "CHECKHOST",
+  "CHECKSYSTEM", "CHECKFIFO", "CHECKPROGRAM", "CHECKNET", "CHECKFILESET",
+  "THREADS", "CHILDREN", "METHOD", "GET", "HEAD", "STATUS", "ORIGIN",
+  "VERSIONOPT", "READ", "WRITE", "OPERATION", "SERVICETIME", "DISK",
+  "LATENCY", "UTILIZATION", "QUEUEDEPTH", "IOPS", "TIMETOFULL", "OVER",
+  "RESOURCE", "MEMORY", "TOTALMEMORY", "LOADAVG1", "LOADAVG5", "LOADAVG15",
+  "SWAP", "MODE", "ACTIVE", "PASSIVE", "MANUAL", "ONREBOOT", "NOSTART",
+  "LASTSTATE", "CORE", "CPU", "TOTALCPU", "CPUUSER", "CPUSYSTEM",
+  "CPUWAIT", "CPUNICE", "CPUHARDIRQ", "CPUSOFTIRQ", "CPUSTEAL", "CPUGUEST",
+  "CPUGUESTNICE", "GROUP", "REQUEST", "DEPENDS", "BASEDIR", "SLOT",
+  "EVENTQUEUE", "SECRET", "HOSTHEADER", "UID", "EUID", "GID", "MMONIT",
+  "INSTANCE", "USERNAME", "PASSWORD", "TIME", "ATIME", "CTIME", "MTIME",
+  "CHANGED", "MILLISECOND", "SECOND", "MINUTE", "HOUR", "DAY", "MONTH",
+  "SSLV2", "SSLV3", "TLSV1", "TLSV11", "TLSV12", "TLSV13", "CERTMD5",
+  "AUTO", "NOSSLV2", "NOSSLV3", "NOTLSV1", "NOTLSV11", "NOTLSV12",
+  "NOTLSV13", "BYTE", "KILOBYTE", "MEGABYTE", "GIGABYTE", "INODE", "SPACE",
+  "TFREE", "PERMISSION", "SIZE", "MATCH", "NOT", "IGNORE", "ACTION",
+  "UPTIME", "EXEC", "UNMONITOR", "PING", "PING4", "PING6", "ICMP",
+  "ICMPECHO", "NONEXIST", "EXIST", "INVALID", "DATA", "RECOVERED",
+  "PASSED", "SUCCEEDED", "URL", "CONTENT", "PID", "PPID", "FSFLAG",
+  "REGISTER", "CREDENTIALS", "URLOBJECT", "ADDRESSOBJECT", "TARGET",
+  "TIMESPEC", "HTTPHEADER", "MAXFORWARD", "FIPS", "SECURITY", "ATTRIBUTE",
+  "FILEDESCRIPTORS", "GREATER", "GREATEROREQUAL", "LESS", "LESSOREQUAL",
+  "EQUAL", "NOTEQUAL", "'{'", "'}'", "':'", "'@'", "'['", "']'", "$accept",
+  "cfgfile", "statement_list", "statement", "optproclist", "optproc",
+  "optfilelist", "optfile", "optfilesetlist", "optfileset",
+  "optfilesyslist", "optfilesys", "optdirlist", "optdir", "opthostlist",
+  "opthost", "optnetlist", "optnet", "optsystemlist", "optsystem",
+  "optfifolist", "optfifo", "optprogramlist", "optprogram", "setalert",
+  "setdaemon", "setterminal", "startdelay", "setinit", "setonreboot",
+  "setexpectbuffer", "setlimits", "limitlist", "limit", "setfips",
+  "setlog", "seteventqueue", "setidfile", "setstatefile", "setpid",
+  "setmmonits", "mmonitlist", "mmonit", "mmonitoptlist", "mmonitopt",
+  "credentials", "setssl", "ssl", "ssloptionlist", "ssloption",
+  "sslexpire", "expireoperator", "sslchecksum", "checksumoperator",
+  "sslversionlist", "sslversion", "certmd5", "setmailservers",
+  "setmailformat", "mailserverlist", "mailserver", "mailserveroptlist",
+  "mailserveropt", "sethttpd", "httpdlist", "httpdoption", "pemfile",
+  "clientpemfile", "allowselfcert", "httpdport", "httpdsocket",
+  "httpdsocketoptionlist", "httpdsocketoption", "sigenable", "sigdisable",
+  "signature", "bindaddress", "allow", "$@1", "$@2", "$@3", "$@4",
+  "allowuserlist", "allowuser", "readonly", "checkproc", "checkfile",
+  "checkfileset", "checkfilesys", "checkdir", "checkhost", "checknet",
+  "checksystem", "checkfifo", "checkprogram", "start", "stop", "restart",
+  "argumentlist", "useroptionlist", "argument", "useroption", "username",
+  "password", "hostname", "connection", "connectionoptlist",
   "connectionopt", "connectionurl", "connectionurloptlist",
   "connectionurlopt", "connectionunix", "connectionuxoptlist",
   "connectionuxopt", "icmp", "icmpoptlist", "icmpopt", "host", "port",
   "unixsocket", "ip", "type", "typeoptlist", "typeopt", "outgoing",
   "protocol", "sendexpect", "websocketlist", "websocket", "smtplist",
   "smtp", "mqttlist", "mqtt", "mysqllist", "mysql", "target", "maxforward",
-  "siplist", "sip", "httplist", "http", "status", "method", "request",
-  "responsesum", "hostheader", "httpheaderlist", "secret", "radiuslist",
-  "radius", "apache_stat_list", "apache_stat", "exist", "pid", "ppid",
-  "uptime", "icmpcount", "icmpsize", "icmptimeout", "icmpoutgoing",
-  "stoptimeout", "starttimeout", "restarttimeout", "programtimeout",
-  "nettimeout", "connectiontimeout", "retry", "actionrate", "urloption",
+  "siplist", "sip", "httplist", "http", "http2list", "http2", "status",
+  "method", "request", "responsesum", "hostheader", "httpheaderlist",
+  "secret", "radiuslist", "radius", "apache_stat_list", "apache_stat",
+  "exist", "pid", "ppid", "uptime", "icmpcount", "icmpsize", "icmptimeout",
+  "icmpoutgoing", "stoptimeout", "starttimeout", "restarttimeout",
+  "programtimeout", "nettimeout", "connectiontimeout", "retry",
+  "persistent", "timing", "timingphase", "actionrate", "urloption",
   "urloperator", "alert", "alertmail", "noalertmail", "eventoptionlist",
   "eventoption", "formatlist", "formatoptionlist", "formatoption", "every",
   "mode", "onreboot", "group", "depend", "dependlist", "dependant",
   "statusvalue", "resourceprocess", "resourceprocesslist",
   "resourceprocessopt", "resourcesystem", "resourcesystemlist",
-  "resourcesystemopt", "resourcecpuproc", "resourcecpu", "resourcecpuid",
-  "resourcemem", "resourcememproc", "resourceswap", "resourcethreads",
+  "resourcesystemopt", "resourcedirectory", "resourcedirectoryopt",
+  "resourcecpuproc", "resourcecpu", "resourcecpuid", "resourcemem",
+  "resourcememproc", "resourceswap", "resourcenetstack", "resourcethreads",
   "resourcechild", "resourceload", "resourceloadavg", "coremultiplier",
   "resourceread", "resourcewrite", "value", "timestamptype", "timestamp",
   "operator", "time", "totaltime", "currenttime", "repeat", "action",
   "action1", "action2", "rateXcycles", "rateXYcycles", "rate1", "rate2",
   "recovery", "checksum", "hashtype", "inode", "space", "read", "write",
-  "servicetime", "fsflag", "unit", "permission", "match", "matchflagnot",
-  "size", "uid", "euid", "secattr", "filedescriptorssystem",
+  "servicetime", "timetofullwindow", "utilization", "queuedepth", "iops",
+  "fsflag", "unit", "permission", "match", "matchflagnot", "size", "uid",
+  "euid", "secattr", "filedescriptorssystem", "listen", "listenaddress",
   "filedescriptorsprocess", "filedescriptorsprocesstotal", "gid",
   "linkstatus", "linkspeed", "linksaturation", "upload", "download",
-  "icmptype", "reminder", YY_NULLPTR
+  "linkcounter", "linkcountertype", "icmptype", "reminder", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_int16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   488,   489,   490,   491,   492,   493,   494,
-     495,   496,   497,   498,   499,   500,   501,   502,   503,   504,
-     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
-     515,   516,   517,   518,   519,   520,   521,   522,   523,   524,
-     525,   526,   527,   528,   529,   530,   531,   532,   533,   534,
-     535,   536,   537,   538,   539,   540,   541,   542,   543,   544,
-     545,   546,   547,   548,   549,   550,   551,   552,   123,   125,
-      58,    64,    91,    93
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF (-806)
+#define YYPACT_NINF (-940)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-732)
+#define YYTABLE_NINF (-809)
 
 #define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     408,    96,   -47,     7,    12,    17,    38,    84,   109,   131,
-     138,   136,   408,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,    82,   146,   204,  -806,  -806,   336,    88,   253,   256,
-     111,   231,   269,   281,   124,    44,   276,   158,  -806,   -57,
-      -8,   383,   385,   396,   468,  -806,   449,   452,    75,  -806,
-    -806,   756,   329,   838,   904,  1121,  1141,  1263,   904,  1407,
-     534,  -806,   434,   466,    77,  -806,  1167,  -806,  -806,  -806,
-    -806,  -806,   388,  -806,  -806,   776,  -806,  -806,  -806,   410,
-     405,  -806,   158,   283,   259,   263,  1468,   521,   445,   448,
-     417,   474,   464,   490,   496,   508,   518,   511,   513,    83,
-     518,   518,   524,   518,   -84,   380,   482,   177,   533,   525,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,   -41,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,    81,  -161,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,    94,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-      21,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,    69,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,   249,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  1419,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-     -96,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,   558,   674,  -806,   561,   528,   581,  -806,
-     647,    10,   592,   599,   651,   653,   523,   613,  -806,   650,
-     708,   693,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,    19,   107,  -806,  -806,  -806,  -806,
-    -806,   601,   615,  -806,  -806,    48,  -806,   664,  -806,   836,
-     283,   620,  -806,   776,  1468,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,   432,  -806,   750,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,   296,  -806,  -806,  -806,   240,   623,   825,   883,   883,
-     883,   883,   564,   883,   883,  -806,  -806,  -806,   883,   883,
-     498,   659,   883,   786,   883,  1462,  -806,  -806,  -806,  -806,
-    -806,  -806,   727,  -806,  -806,   447,   453,  -806,   529,   877,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-     525,  -806,   639,  1468,   521,    79,  -806,  -806,  -806,  -806,
-     239,   883,   659,   489,   883,   691,  -806,   489,   700,  -129,
-     883,   883,   883,  -169,   857,   874,   638,   -33,   918,   883,
-     883,   883,   738,   933,   883,   883,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,   883,  1213,  -806,  -806,
-     883,  -806,  -806,  -806,   883,   808,  -806,   837,  -806,   889,
-     -11,   850,  -806,  -806,  -806,  -806,  -806,  -806,   852,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,   762,   858,  -806,   856,   860,   862,   696,
-     868,   870,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,   709,   714,   717,   719,   723,   724,   732,   733,
-     735,   737,  -806,  -806,   740,   742,   746,   751,   753,   784,
-     790,   791,   793,  -806,  -806,  -806,  -806,  -806,  -806,   866,
-     869,  -806,  -806,  -806,  -806,  -806,  -806,  -806,   219,   789,
-     937,  -806,   974,   892,   156,   212,   184,  -806,  -806,  -806,
-     919,   948,   244,   307,   322,   807,   797,  1015,  -806,   883,
-     951,  -806,  -806,  -806,  -806,  -806,  -806,  -806,   952,   953,
-     -39,   -39,   883,   883,   -39,   -39,   -39,   -39,   786,   786,
-     786,   955,    33,  -806,  -806,  1097,   -34,  -806,  1107,  -806,
-     883,   979,   228,  -806,   980,   237,  -806,   982,   255,  -806,
-    -806,  -806,  1468,  1208,  -806,  -806,  -806,   983,  1034,   786,
-     786,   786,  1035,   987,  -806,  -806,   662,   988,   682,   686,
-     702,   -15,     0,     6,   786,   883,   242,   883,   -39,  -806,
-    -806,  -806,  1053,   786,   990,   992,   994,   883,   883,   786,
-     -39,   -39,   258,  -806,  1136,   -39,   996,   786,  -806,   528,
-      14,  -806,  -806,  -806,  -806,  -806,  -806,  1008,  1022,  1024,
-    1025,  1027,  1152,   106,   165,  1036,  1046,  1047,  1051,  1054,
-     828,   851,  1061,  1064,  -806,  1057,  1058,  1059,  1060,  1062,
-    1066,  1071,  1074,  1075,  -806,   945,  -806,   937,   521,  -806,
-     999,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,   786,
-     786,   786,   786,   786,   786,  -806,   757,  1076,  -806,   548,
-    1082,  1150,  -806,  -806,  -806,  -806,   388,   388,   267,   277,
-     359,   469,  1085,  1087,  1235,  1236,  1237,   574,  -806,  1186,
-     435,    56,  1098,   435,   -39,  1016,  -806,  1019,  -806,  1020,
-    -806,  1275,   937,   786,    49,  1244,  1246,  1255,   786,   388,
-     786,   786,   574,   786,   786,  -806,  -806,  -806,  -806,  1083,
-     388,  1084,   388,  1037,  1039,  1258,   293,    56,  1118,   -39,
-     530,    60,    60,    60,  1001,  -806,  1264,  1124,   117,   181,
-    1127,  1129,  1272,   600,   640,    56,  1131,   435,  1132,   786,
-    1277,   989,   989,  -806,  1146,  1027,  1027,  1027,  1152,  -806,
-    1027,  -806,  -806,  -806,  -806,   355,   366,  1138,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    1553,   388,   388,   388,   388,   681,   703,   712,   715,   718,
-    -806,   521,  -806,  -806,  1281,  1282,  1284,  1285,  1286,  1292,
-      61,   786,   786,  -806,   356,  1165,  1168,   541,  1649,  1162,
-    1164,  -806,  -806,  -806,  -806,  -806,  -806,  1309,   786,  1310,
-    1088,  1088,  1140,   388,  1147,   388,  -806,  -806,  -806,  -806,
-    -806,  -806,   435,   435,   435,  -806,  -806,  -806,  -806,  -806,
-     786,  -806,  -806,  -806,  -806,  -806,   518,  -806,  -806,  1323,
-    1326,   786,  1323,  -806,  -806,  -806,  -806,   937,   521,  1327,
-    1197,  1330,   435,   435,   435,  1341,   786,  1342,  1344,   786,
-    1348,  1349,   786,  1088,   786,  1088,   786,   786,   435,    56,
-    1209,  1350,   786,   814,   786,   786,  1220,  1217,  1218,  1219,
-    -806,  -806,  -806,  -806,  -806,  1362,  1364,  1368,  -806,    60,
-     435,   786,  1088,  1088,  1088,  1088,   241,   248,   435,  -806,
-    -806,  -806,  -806,  1369,   786,  1323,  -806,  1370,   435,  1240,
-    1243,  -806,  1027,  1027,  1027,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,   435,   435,
-     435,   435,   435,   435,    26,   489,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  1377,  1378,  1383,  1253,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  1386,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-     966,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,   -12,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  1166,  -806,   435,  1387,    92,
-    -806,  -806,  -806,  -806,  1088,  -806,  1088,  -806,  -806,  1323,
-    1388,    80,  1393,  -806,   435,  1415,  -806,   521,  -806,   435,
-     786,   435,  1323,  -806,  -806,   435,  1416,   435,   435,  1417,
-     435,   435,  1421,   786,  1423,   786,  1427,  1429,  -806,  1431,
-     786,   435,  1432,   786,   786,  1433,  1434,  -806,  -806,  1196,
-    -806,   435,   435,   435,  1435,  1323,  1436,   786,   786,   786,
-     786,   364,   368,   430,   450,  1323,   435,  1437,  -806,   435,
-    -806,  -806,  -806,  1323,  1323,  1323,  1323,  1323,  1323,  1154,
-    1307,   435,   435,   435,  -806,   435,  1458,   312,   312,  1312,
-     883,   883,   883,   883,   883,   883,   883,   883,   883,   883,
-    -806,  -806,   966,  -806,   731,   731,   -28,   -28,  1315,  1316,
-    1308,  1319,   -12,  -806,   731,    29,  1245,  -806,  1323,   435,
-    -806,  -806,  -806,  -806,  -806,   435,  1363,     8,  -806,   440,
-    1323,   435,  -806,  1323,  1454,  1323,  -806,  -806,   435,  -806,
-    -806,   435,  -806,  -806,   435,  1456,   435,  1459,   435,   435,
-     435,  1460,  1323,   435,  1461,  1466,   435,   435,  -806,  1323,
-    1323,  1323,   435,  -806,   435,  1470,  1477,  1478,  1483,   503,
-    -806,  -806,  -806,   786,   503,   786,   503,   786,   503,   786,
-    -806,  1323,   435,  1323,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  1343,  -806,  1323,  1323,  1323,  1323,  -806,  -806,  -806,
-    1336,   787,   883,   834,  1354,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  1347,  1352,  1353,  1355,  1357,
-    1360,  1365,  1373,  1374,  1379,  -806,  -806,  -806,  -806,  1404,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,   246,  1380,  -806,  -806,  -806,  1371,  -806,  -806,  -806,
-    1323,  1323,    63,  -806,   786,   786,   786,  -806,  1323,  -806,
-     435,  -806,  1323,  1323,  1323,   435,  1323,   435,  1323,  1323,
-    1323,   435,  -806,  1323,   435,   435,  1323,  1323,  -806,  -806,
-    -806,  1323,  1323,   435,   435,   435,   435,   786,  1522,   786,
-    1523,   786,  1526,   786,  1527,  -806,  1323,  -806,  1278,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  1391,  -806,  -806,  -806,
-    -192,  1392,  1395,  1400,  1401,  1402,  1403,  1409,  1410,  1411,
-    1412,    16,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  1481,
-    -806,  -806,  1535,  1555,  1557,  -806,  1323,  -806,  -806,  -806,
-    1323,  -806,  1323,  -806,  -806,  -806,  1323,  -806,  1323,  1323,
-    -806,  -806,  -806,  -806,  1323,  1323,  1323,  1323,  1558,   435,
-    1561,   435,  1562,   435,  1566,   435,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,   989,   989,  1447,  -806,   435,   435,   435,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,   435,  1323,
-     435,  1323,   435,  1323,   435,  1323,  1448,  1449,  -806,  -806,
-    -806,  -806,  -806,  1323,  -806,  1323,  -806,  1323,  -806,  1323,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806
+    1517,   166,   -99,   -33,     6,    25,   108,   111,   133,   154,
+     213,   229,   246,  1517,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,    61,   189,   233,  -940,  -940,   400,    81,
+     255,   263,   116,   296,   308,   321,   181,   -15,  -142,   182,
+    -940,   -73,   -35,   428,   470,   474,   576,  -940,   488,   499,
+      70,   508,  -940,  -940,   483,   477,  1140,  1298,  1584,  1820,
+    1847,  1865,  1883,  1895,   569,  -940,   518,   514,   -34,  -940,
+    2127,  -940,  -940,  -940,  -940,  -940,   839,  -940,  -940,   969,
+    -940,  -940,  -940,   468,   464,  -940,   182,   303,   316,   336,
+    1568,   585,   510,   512,    66,   421,   515,   519,   529,   531,
+     439,   544,   547,   552,   155,   439,   439,   553,   439,  -126,
+     415,   562,    60,   596,   577,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,   -71,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,    98,  -159,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,   243,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,   271,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,   252,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,    44,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,   738,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  1710,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,   147,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,   117,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,   593,   759,  -940,   617,  1345,
+     623,  -940,   672,     7,   634,   636,   700,   714,   501,   671,
+    -940,   668,   684,   619,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,   114,  1361,  -940,  -940,
+    -940,  -940,  -940,   551,   559,  -940,  -940,  -109,  -940,   643,
+    -940,  1628,   303,   549,  -940,   969,  1568,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,   855,  -940,   706,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,   461,  -940,  -940,  -940,  -940,   594,   556,
+     877,   877,   779,  1030,  1030,  1030,  1030,   452,  1030,  1030,
+    -940,  -940,  -940,  1030,  1030,   353,   -51,  1030,   731,  1030,
+    1809,  -940,  -940,  -940,  -940,  -940,  -940,   677,  -940,  -940,
+     527,   572,  -940,   675,   869,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,   577,  -940,   621,  1568,   585,
+     142,  -940,  -940,  -940,  -940,   165,  1030,   648,   383,  1030,
+     665,  -940,   383,   667,   648,    34,   696,   990,  1030,  1030,
+    1030,  1030,  -233,   865,  1010,   694,  1030,  1030,   674,   731,
+     238,   928,  1030,   649,   444,   639,  -940,  -940,   938,  1030,
+    1030,  1030,  1030,  1030,  1030,  1030,  1030,  1030,  1030,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,   946,
+    1030,  1863,  -940,  -940,  1030,  -940,  -940,  -940,  -940,  1030,
+     796,  -940,   847,  -940,   916,    45,   873,  -940,  -940,  -940,
+    -940,  -940,  -940,   875,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,   784,   889,
+    -940,   876,   892,   894,   728,   901,   905,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,   739,   741,   745,
+     747,   749,   751,   753,   760,   781,   790,  -940,  -940,   795,
+     806,   807,   811,   812,   817,   819,   820,   822,   827,   828,
+     829,   830,   835,  -940,  -940,  -940,  -940,  -940,  -940,   957,
+     974,  -940,  -940,  -940,  -940,  -940,  -940,  -940,   337,   971,
+    1036,  -940,  1104,   998,   -23,    96,   -30,  -940,  -940,  -940,
+    1009,  1011,   102,   113,   291,   859,   854,  1085,  -940,  1030,
+    1018,  1090,  1092,  1016,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  1025,  1028,   127,   127,  1030,  1030,   127,   127,   127,
+     127,   731,   731,   877,   731,  1029,    26,  -940,  -940,  1207,
+     134,  -940,  1208,  -940,  1030,  1033,    16,  -940,  1035,    50,
+    -940,  1037,    59,  -940,  -940,  -940,  1568,  1199,  -940,  -940,
+    -940,  -940,  -940,  1041,  1094,   731,   731,   731,  1102,  1043,
+    -940,  -940,   628,  1044,   641,   687,   695,  1030,   168,  1030,
+     191,   217,   127,   127,  1046,   731,  1030,  1030,   226,  1030,
+    1030,   127,  1030,  1055,  1059,  1239,  -940,  -940,  -940,  1144,
+     731,  1073,  -940,  -940,  -940,  1074,  -940,  -940,  -940,  -940,
+    1075,   649,   444,  1030,   731,  1080,   272,  1084,  1088,  1089,
+    1095,  1096,  1099,   127,   127,   301,  -940,  1262,   127,  1105,
+     731,  -940,  1345,     0,  -940,  -940,  -940,  -940,  -940,  -940,
+    1103,  1113,  1115,  1116,  1127,  1252,   163,   326,  1128,  1129,
+    1130,  1132,  1133,   808,   802,  1134,  1136,  -940,  1137,  1138,
+    1141,  1149,  1150,  1157,  1158,  1159,  1161,  1162,   848,  1169,
+    1171,  1172,  -940,  1045,  -940,  1036,   585,  -940,  1047,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,   731,   731,   731,
+     731,   731,   731,  -940,   748,  1173,  -940,  2046,  1176,  -940,
+    1180,  1182,  1237,  -940,  -940,  -940,  -940,   839,   839,   344,
+     345,   158,   258,  1131,  1139,  1310,  1368,  1270,  1374,   737,
+    -940,  1305,   305,    14,  1198,   305,   127,  1111,  -940,  1118,
+    -940,  1120,  -940,  1542,  1036,   731,   -13,  1388,  1389,  1390,
+     731,   839,   731,   731,   737,   731,   731,  -940,  -940,  -940,
+    -940,   360,  1185,   839,   391,  1186,   839,  1135,  1142,  1220,
+     731,   731,  1401,  1225,   411,    14,  1227,  1226,   127,   379,
+    1232,  -940,   737,   305,   130,   130,   130,  1106,  -940,  1410,
+    1234,    12,    53,  1236,  1238,  1244,  1423,  1163,   -76,  1249,
+    1163,  1163,  1163,  -940,  -940,  1163,   448,   528,    14,  1253,
+     305,  1259,   731,  1451,  1119,  1119,  -940,  1292,  1127,  1127,
+    1127,  1252,  -940,  1127,  -940,  -940,  -940,  -940,   299,   306,
+    1284,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  1510,   839,   839,   839,   839,   657,   661,
+     720,   733,   756,  -940,  -940,  -940,   783,  1197,  1200,  -940,
+     585,  -940,  -940,  1464,  1465,  1471,  1472,  1473,  1475,   405,
+     731,   731,  -940,   642,  1309,     9,   717,  2047,  1302,  1316,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  1030,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  1030,  1494,   731,
+    1030,  1030,  1495,  1163,  1163,  1289,   839,  1290,   839,  -940,
+    -940,  -940,  -940,  -940,  -940,   305,   305,  1324,   305,  -940,
+    -940,  -940,  -940,  -940,   731,  -940,  -940,  -940,  -940,  -940,
+     439,  -940,  -940,  1503,  1509,   731,  1503,  -940,  -940,  -940,
+    -940,  1036,   585,  1511,  1342,  1512,   305,   305,   305,  1518,
+     731,  1520,  1521,   731,  1522,  1523,  1260,  1251,   731,  1163,
+    1261,  1264,   731,  1163,   731,   731,   731,  1532,  1535,   305,
+     737,    14,  1359,  1538,   731,   737,   573,   731,   731,   839,
+    -940,  1503,  1372,  1364,  1365,  1367,  -940,  -940,  -940,  -940,
+    -940,  1547,  1548,  1549,  -940,   130,   305,   731,  1163,  1163,
+    1163,  1163,    86,   178,   295,   305,  -940,   731,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  1552,   731,
+    1503,  -940,  1553,   305,  1387,  1391,  -940,  1127,  1127,  1127,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,   305,   305,   305,
+     305,   305,   305,    63,   383,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  1556,  1557,  1563,  1396,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  1566,  -940,  1397,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  1873,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,    71,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    1303,  -940,  1394,   445,   305,  1572,   450,  1399,   459,  -940,
+    -940,  -940,  1163,  -940,  1163,  -940,  -940,   731,  1503,  1573,
+     -41,  1570,  -940,   305,  1577,  -940,   585,  -940,   305,   731,
+     305,  1503,  -940,  -940,   305,  1578,   305,   305,  1589,   305,
+     305,   731,   731,  1590,   731,   731,   731,  1591,   731,  1592,
+    1593,  1594,   305,   305,  -940,  1378,  1598,   731,   305,  1599,
+    1378,   731,   731,  1600,  1601,  -940,  -940,  -940,  -940,  1336,
+    -940,   305,   305,   305,  1605,  1503,  1606,   731,   731,   731,
+     731,   478,   583,   622,   664,   564,  -940,  -940,  -940,   731,
+    1503,  1608,   305,  1615,  -940,   305,  -940,  -940,  -940,  1503,
+    1503,  1503,  1503,  1503,  1503,  1300,  1463,   305,   305,   305,
+    -940,   305,  -940,  1969,   431,   431,  1476,  1030,  1030,  1030,
+    1030,  1030,  1030,  1030,  1030,  1030,  1030,  -940,  -940,  1873,
+    -940,   813,   813,   -49,   -49,  1478,  1485,  1455,  1488,    71,
+    -940,   813,   660,  -120,  1382,  -940,  -940,  1393,  1400,  1503,
+     305,    14,  1482,   731,  -940,  -940,  -940,  -940,  1663,  -940,
+     305,  1550,     2,  -940,   631,  1503,   305,  -940,  1503,  1667,
+    1503,  -940,  -940,   305,  -940,  -940,   305,  -940,  -940,  1669,
+    1674,   305,  1676,  1679,  1680,   305,  1682,   305,   305,   305,
+    1503,  1503,  1507,   731,   305,  1686,  1503,   305,   731,  1687,
+    1688,   305,   305,  -940,  1503,  1503,  1503,   305,  -940,   305,
+    1689,  1690,  1691,  1694,   564,   731,   564,   731,   564,   731,
+     564,   731,   731,  1695,  -940,   305,  1503,   305,  1503,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  1519,  -940,  1503,  1503,
+    1503,  1503,  -940,  -940,  -940,  1529,   893,  1030,   945,  1531,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    1524,  1528,  1540,  1541,  1543,  1545,  1546,  1551,  1555,  1560,
+    -940,  -940,  -940,  -940,  1607,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,   948,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,   331,  1561,  -940,  -940,  -940,  1558,
+    -940,  -940,  -940,  -940,  -940,  1503,  1725,   731,  1727,   305,
+    1503,    31,  -940,   731,   731,   731,  -940,  1503,  -940,   305,
+    -940,  1503,  1503,   305,   305,  1503,   305,   305,   305,  1503,
+     305,  1503,  1503,  1503,  -940,  -940,   737,  1730,  1503,   305,
+    -940,  1503,  1734,   305,   305,  1503,  1503,  -940,  -940,  -940,
+    1503,  1503,   305,   305,   305,   305,   731,  1739,   731,  1740,
+     731,  1743,   731,  1744,  1745,   305,  1503,  -940,  1503,  -940,
+    1477,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  1571,  -940,
+    -940,  -940,  -256,  1575,  1579,  1580,  1581,  1582,  1585,  1586,
+    1587,  1602,  1618,     3,  -940,  -940,  -135,  -940,  -940,  -940,
+    -940,  -940,   305,  1749,   305,  1503,  -940,  -940,  1681,  -940,
+    -940,  1755,  1762,  1776,  -940,  1503,  -940,  -940,  1503,  1503,
+    -940,  1503,  1503,  1503,  -940,  1503,  -940,  -940,  -940,  -940,
+     305,  -940,  1503,  -940,   305,  1503,  1503,  -940,  -940,  -940,
+    -940,  1503,  1503,  1503,  1503,  1777,   305,  1778,   305,  1779,
+     305,  1798,   305,   305,  1503,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  1119,  1119,  1632,  -940,  1503,   305,  1503,  -940,  -940,
+     305,   305,   305,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    1503,  -940,  1503,  -940,  -940,  -940,  -940,  -940,  -940,   305,
+    1503,   305,  1503,   305,  1503,   305,  1503,  1503,  -940,  1633,
+    1635,  -940,  -940,  1503,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  1503,  -940,  1503,  -940,  1503,  -940,  1503,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
        2,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     3,     4,     6,     8,     9,    20,    22,    19,
-      21,    23,    10,    11,    17,    18,    16,    12,     7,    13,
-      14,    15,    33,    59,    79,   101,   118,   133,   150,   165,
-     182,     0,     0,     0,   303,   202,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   224,   614,
-       0,     0,     0,     0,     0,   364,     0,     0,     0,     1,
-       5,    24,    25,    26,    27,    28,    32,    29,    30,    31,
-     226,   225,   200,   294,   567,   290,   302,   199,   250,   231,
-     232,   208,   762,   233,   580,     0,   203,   204,   205,     0,
-       0,   238,   234,   245,     0,     0,     0,   810,     0,     0,
+       0,     0,     0,     3,     4,     6,     8,     9,    20,    22,
+      19,    21,    23,    10,    11,    17,    18,    16,    12,     7,
+      13,    14,    15,    34,    61,    81,   100,   125,   143,   158,
+     176,   192,   209,     0,     0,     0,   337,   229,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     258,   678,     0,     0,     0,     0,     0,   399,     0,     0,
+       0,     0,     1,     5,    24,    25,    33,    26,    27,    28,
+      32,    29,    30,    31,   260,   259,   227,   328,   620,   324,
+     336,   226,   284,   265,   266,   235,   852,   267,   644,     0,
+     230,   231,   232,     0,     0,   272,   268,   279,     0,     0,
+       0,   918,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      34,    35,    36,    37,    48,    49,    50,    38,    39,    40,
-      47,    51,    52,   614,   579,    53,    54,    55,    56,    57,
-      58,    41,    42,    43,    44,    45,    46,   777,   777,    60,
-      61,    62,    63,    64,    66,    68,    67,    75,    76,    77,
-      78,    65,    72,    69,    74,    73,    70,    71,     0,    80,
-      81,    82,    83,    84,    85,    87,    86,    91,    92,    93,
-      94,    95,    96,    97,    98,    99,   100,    88,    89,    90,
-       0,   102,   103,   104,   105,   106,   108,   110,   109,   114,
-     115,   116,   117,   107,   111,   112,   113,     0,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
-     131,   132,     0,   134,   135,   136,   137,   143,   147,   144,
-     145,   146,   148,   149,   138,   139,   140,   141,   142,     0,
-     151,   152,   153,   154,   163,   155,   156,   157,   158,   159,
-     160,   161,   162,   164,   166,   167,   168,   169,   170,   172,
-     174,   173,   178,   179,   180,   181,   171,   175,   176,   177,
-       0,   183,   184,   185,   186,   187,   188,   189,   190,   191,
-     192,   193,   194,     0,     0,   198,     0,   292,     0,   291,
-     387,     0,     0,     0,     0,     0,   248,     0,   316,     0,
-       0,     0,   305,   304,   306,   307,   308,   312,   313,   330,
-     331,   309,   310,   311,     0,     0,   763,   764,   765,   766,
-     206,     0,     0,   620,   621,     0,   616,   228,   230,   237,
-     245,     0,   235,     0,     0,   598,   585,   586,   600,   601,
-     608,   606,   588,   610,   587,   609,   605,   612,   594,   596,
-     611,   602,   607,   584,   613,   591,   595,   599,   592,   597,
-     590,   589,   603,   604,   593,     0,   582,     0,   195,   353,
-     354,   355,   356,   359,   358,   357,   360,   361,   365,   378,
-     379,   565,   374,   362,   363,   430,     0,     0,   698,   698,
-     698,   698,     0,   698,   698,   679,   680,   681,   698,   698,
-       0,     0,   698,   731,   698,   731,   639,   641,   642,   643,
-     644,   645,   682,   646,   647,   561,   559,   581,   563,     0,
-     623,   624,   625,   626,   627,   628,   629,   630,   631,   635,
-     632,   633,     0,     0,   810,   744,   692,   693,   694,   695,
-     744,   698,   778,     0,   698,     0,   778,     0,     0,     0,
-     698,   698,   698,     0,   698,   698,     0,   430,     0,   698,
-     698,   698,     0,     0,   698,   698,   667,   658,   659,   660,
-     661,   662,   663,   664,   665,   666,   698,   731,   649,   654,
-     698,   652,   653,   651,   698,     0,   227,     0,   294,     0,
-       0,     0,   274,   276,   278,   280,   282,   284,     0,   286,
-     275,   277,   279,   281,   283,   285,   298,   299,   300,   301,
-     295,   296,   297,     0,     0,   288,     0,     0,     0,   347,
-     335,     0,   332,   314,   327,   329,   250,   315,   317,   319,
-     326,   328,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   247,   251,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   207,   209,   618,   619,   289,   617,     0,
-       0,   239,   241,   242,   243,   244,   236,   246,     0,     0,
-     614,   583,   811,     0,     0,     0,   565,   375,   376,   366,
-       0,     0,     0,     0,     0,     0,     0,     0,   413,   698,
-       0,   705,   699,   700,   701,   702,   703,   704,     0,     0,
-       0,     0,   698,   698,     0,     0,     0,     0,   731,   731,
-     731,     0,     0,   732,   733,     0,     0,   640,     0,   683,
-     698,     0,   561,   368,     0,   559,   370,     0,   563,   372,
-     622,   634,     0,     0,   576,   745,   746,     0,     0,   731,
-     731,   731,     0,     0,   574,   575,     0,     0,     0,     0,
-       0,     0,     0,     0,   731,   698,     0,   698,     0,   424,
-     424,   424,     0,   731,     0,     0,     0,   698,   698,   731,
-       0,     0,     0,   650,     0,     0,     0,   731,   201,   293,
-     270,   385,   384,   386,   287,   568,   388,   336,   337,   338,
-       0,     0,   351,     0,   318,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   272,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   229,     0,   615,   614,   810,   812,
-       0,   380,   382,   381,   383,   377,   367,   431,   433,   731,
-     731,   731,   731,   731,   731,   404,     0,     0,   390,   731,
-       0,     0,   676,   677,   691,   690,   762,   762,     0,     0,
-     762,   762,     0,     0,     0,     0,     0,   706,   729,     0,
-       0,   691,     0,     0,     0,     0,   369,     0,   371,     0,
-     373,     0,   614,   731,   731,     0,     0,     0,   731,   762,
-     731,   731,   706,   731,   731,   772,   771,   776,   775,   691,
-     762,   691,   762,   691,     0,     0,     0,   691,     0,     0,
-     762,   731,   731,   731,     0,   424,     0,     0,   762,   762,
-       0,     0,     0,   762,   762,   691,     0,     0,     0,   731,
-       0,   270,   270,   271,     0,     0,     0,     0,   351,   350,
-     340,   348,   352,   334,   249,     0,     0,     0,   320,   258,
-     260,   259,   257,   261,   254,   255,   252,   253,   262,   263,
-     256,   762,   762,   762,   762,     0,     0,     0,     0,     0,
-     240,   810,   196,   566,     0,     0,     0,     0,     0,     0,
-     731,   731,   731,   432,   731,     0,     0,     0,     0,     0,
-       0,   414,   415,   416,   417,   418,   419,     0,   731,     0,
-     715,   715,   691,   762,   691,   762,   671,   670,   673,   672,
-     655,   656,     0,     0,     0,   707,   708,   709,   710,   711,
-     731,   730,   724,   725,   720,   723,     0,   726,   727,   737,
-       0,   731,   737,   678,   562,   560,   564,   614,   810,     0,
-       0,     0,     0,     0,     0,     0,   731,     0,     0,   731,
-       0,     0,   731,   715,   731,   715,   731,   731,     0,   691,
-       0,     0,   731,   762,   731,   731,     0,     0,     0,     0,
-     425,   426,   427,   428,   429,     0,     0,     0,   809,   731,
-       0,   731,   715,   715,   715,   715,   762,   762,     0,   669,
-     668,   675,   674,     0,   731,   737,   657,     0,     0,     0,
-       0,   267,   342,   344,   346,   333,   349,   321,   323,   322,
-     324,   325,   273,   210,   211,   212,   213,   214,   215,   216,
-     217,   220,   221,   218,   219,   222,   223,   197,     0,     0,
-       0,     0,     0,     0,     0,     0,   409,   411,   410,   405,
-     407,   408,   406,     0,     0,     0,     0,   434,   435,   400,
-     402,   401,   391,   392,   393,   398,   394,   395,   397,   399,
-     396,     0,   482,   483,   438,   436,   439,   445,   512,   512,
-       0,   449,   490,   490,   465,   466,   452,   453,   454,   462,
-     463,   498,   498,   446,     0,   494,   471,   447,   455,   456,
-     472,   474,   475,   476,   464,   508,   477,   478,   532,   480,
-     473,   457,   467,   470,   448,     0,   570,     0,     0,     0,
-     716,   684,   687,   686,   715,   689,   715,   552,   553,   737,
-       0,   717,     0,   551,     0,     0,   638,   810,   577,     0,
-     731,     0,   737,   780,   697,     0,     0,     0,     0,     0,
-       0,     0,     0,   731,     0,   731,     0,     0,   761,     0,
-     731,     0,     0,   731,   731,     0,     0,   558,   555,     0,
-     556,     0,     0,     0,     0,   737,     0,   731,   731,   731,
-     731,     0,     0,     0,     0,   737,     0,     0,   648,     0,
-     637,   268,   269,   737,   737,   737,   737,   737,   737,   265,
-       0,     0,     0,     0,   443,     0,   437,   450,   451,     0,
-     698,   698,   698,   698,   698,   698,   698,   698,   698,   698,
-     537,   538,   444,   535,   468,   469,   459,   460,     0,     0,
-       0,     0,   481,   484,   458,   461,   479,   569,   737,     0,
-     572,   571,   685,   688,   550,     0,     0,   717,   721,     0,
-     737,     0,   578,   737,     0,   737,   768,   743,     0,   770,
-     769,     0,   774,   773,     0,     0,     0,     0,     0,     0,
-       0,     0,   737,     0,     0,     0,     0,     0,   557,   737,
-     737,   737,     0,   794,     0,     0,     0,     0,     0,     0,
-     712,   713,   714,   731,     0,   731,     0,   731,     0,   731,
-     795,   737,     0,   737,   781,   782,   783,   784,   792,   793,
-     266,     0,   573,   737,   737,   737,   737,   441,   442,   440,
-       0,     0,   698,     0,     0,   529,   514,   515,   513,   518,
-     519,   516,   517,   520,   539,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   536,   492,   493,   491,     0,
-     500,   501,   499,   488,   486,   489,   487,   485,   496,   497,
-     495,     0,     0,   510,   511,   509,     0,   534,   533,   412,
-     737,   737,     0,   722,   734,   734,   734,   789,   737,   767,
-       0,   741,   737,   737,   737,     0,   737,     0,   737,   737,
-     737,     0,   747,   737,     0,     0,   737,   737,   421,   422,
-     423,   737,   737,     0,     0,     0,     0,   731,     0,   731,
-       0,   731,     0,   731,     0,   787,   737,   636,     0,   403,
-     785,   786,   389,   527,   523,   524,     0,   526,   525,   528,
+       0,     0,     0,     0,     0,    35,    36,    37,    38,    49,
+      50,    51,    39,    40,    41,    48,    52,    53,   678,   643,
+      54,    55,    56,    57,    58,    59,    42,    43,    44,    60,
+      45,    46,    47,   867,   867,    62,    63,    64,    65,    66,
+      68,    70,    69,    77,    78,    79,    80,    67,    74,    71,
+      76,    75,    72,    73,     0,    82,    83,    84,    85,    86,
+      88,    90,    89,    96,    97,    98,    99,    87,    94,    91,
+      95,    92,    93,     0,   101,   102,   103,   104,   105,   106,
+     108,   107,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   109,   110,   111,     0,   126,
+     127,   128,   129,   130,   132,   134,   133,   138,   139,   140,
+     141,   142,   131,   135,   136,   137,     0,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,     0,   159,   160,   161,   162,   169,   173,   170,   171,
+     172,   174,   175,   163,   164,   165,   166,   167,   168,     0,
+     177,   178,   179,   180,   189,   181,   182,   183,   184,   185,
+     186,   187,   188,   190,   191,     0,   193,   194,   195,   196,
+     197,   199,   201,   200,   205,   206,   207,   208,   198,   202,
+     203,   204,     0,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   220,   221,     0,     0,   225,     0,   326,
+       0,   325,   422,     0,     0,     0,     0,     0,   282,     0,
+     350,     0,     0,     0,   339,   338,   340,   341,   342,   346,
+     347,   364,   365,   343,   344,   345,     0,     0,   853,   854,
+     855,   856,   233,     0,     0,   684,   685,     0,   680,   262,
+     264,   271,   279,     0,   269,     0,     0,   662,   649,   650,
+     664,   665,   672,   670,   652,   674,   651,   673,   669,   676,
+     658,   660,   675,   666,   671,   648,   677,   655,   659,   663,
+     656,   661,   654,   653,   667,   668,   657,     0,   646,     0,
+     222,   387,   388,   389,   390,   394,   393,   391,   395,   396,
+     400,   413,   414,   618,   409,   397,   398,   392,   471,     0,
+     883,   883,     0,   775,   775,   775,   775,     0,   775,   775,
+     756,   757,   758,   775,   775,     0,     0,   775,   808,   775,
+     808,   703,   705,   706,   707,   708,   709,   759,   710,   711,
+     614,   612,   645,   616,     0,   687,   688,   689,   690,   691,
+     692,   693,   694,   695,   699,   696,   697,     0,     0,   918,
+     821,   769,   770,   771,   772,   821,   775,   868,     0,   775,
+       0,   868,     0,     0,     0,     0,   775,   775,   775,   775,
+     775,   775,     0,   775,   775,     0,   775,   775,     0,   808,
+     471,     0,   775,   775,   775,     0,   914,   916,     0,   775,
+     775,   775,   775,   775,   775,   775,   775,   775,   775,   736,
+     727,   728,   729,   730,   731,   732,   733,   734,   735,     0,
+     775,   808,   713,   718,   775,   716,   717,   719,   715,   775,
+       0,   261,     0,   328,     0,     0,     0,   308,   310,   312,
+     314,   316,   318,     0,   320,   309,   311,   313,   315,   317,
+     319,   332,   333,   334,   335,   329,   330,   331,     0,     0,
+     322,     0,     0,     0,   381,   369,     0,   366,   348,   361,
+     363,   284,   349,   351,   353,   360,   362,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   281,   285,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   270,   506,   505,   507,   531,   791,   554,   718,     0,
-     735,   736,     0,     0,     0,   790,   737,   779,   696,   756,
-     737,   758,   737,   759,   760,   749,   737,   748,   737,   737,
-     752,   751,   420,   796,   737,   737,   737,   737,     0,     0,
-       0,     0,     0,     0,     0,     0,   788,   264,   522,   530,
-     521,   540,   541,   542,   543,   544,   545,   546,   547,   548,
-     549,   270,   270,     0,   719,     0,     0,     0,   742,   755,
-     757,   750,   754,   753,   800,   797,   806,   803,     0,   737,
-       0,   737,     0,   737,     0,   737,     0,     0,   502,   728,
-     738,   739,   740,   737,   801,   737,   798,   737,   807,   737,
-     804,   503,   504,   802,   799,   808,   805
+       0,     0,     0,   234,   236,   682,   683,   323,   681,     0,
+       0,   273,   275,   276,   277,   278,   270,   280,     0,     0,
+     678,   647,   919,     0,     0,     0,   618,   410,   411,   401,
+       0,     0,     0,     0,     0,     0,     0,     0,   452,   775,
+       0,     0,     0,     0,   782,   776,   777,   778,   779,   780,
+     781,     0,     0,     0,     0,   775,   775,     0,     0,     0,
+       0,   808,   808,   883,   808,     0,     0,   809,   810,     0,
+       0,   704,     0,   760,   775,     0,   614,   403,     0,   612,
+     405,     0,   616,   407,   686,   698,     0,     0,   640,   822,
+     823,   824,   825,     0,     0,   808,   808,   808,     0,     0,
+     638,   639,     0,     0,     0,     0,     0,   775,     0,   775,
+       0,     0,     0,     0,     0,   808,   775,   775,     0,   775,
+     775,     0,   775,     0,     0,     0,   465,   465,   465,     0,
+     808,     0,   909,   912,   913,     0,   908,   910,   911,   915,
+       0,   775,   775,   775,   808,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   714,     0,     0,     0,
+     808,   228,   327,   304,   420,   419,   421,   321,   621,   423,
+     370,   371,   372,     0,     0,   385,     0,   352,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   306,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   263,     0,   679,   678,   918,   920,     0,   415,
+     417,   416,   418,   412,   402,   472,   474,   808,   808,   808,
+     808,   808,   808,   441,     0,     0,   425,   808,     0,   884,
+       0,     0,     0,   753,   754,   768,   767,   852,   852,     0,
+       0,   852,   852,     0,     0,     0,     0,     0,     0,   783,
+     806,     0,     0,   768,     0,     0,     0,     0,   404,     0,
+     406,     0,   408,     0,   678,   808,   808,     0,     0,     0,
+     808,   852,   808,   808,   783,   808,   808,   862,   861,   866,
+     865,     0,   768,   852,     0,   768,   852,   768,     0,     0,
+     808,   808,     0,     0,     0,   768,     0,     0,     0,   852,
+       0,   721,   783,     0,   808,   808,   808,     0,   465,     0,
+       0,   852,   852,     0,     0,     0,     0,   792,   792,     0,
+     792,   792,   792,   751,   752,   792,   852,   852,   768,     0,
+       0,     0,   808,     0,   304,   304,   305,     0,     0,     0,
+       0,   385,   384,   374,   382,   386,   368,   283,     0,     0,
+       0,   354,   292,   294,   293,   291,   295,   288,   289,   286,
+     287,   296,   297,   290,   852,   852,   852,   852,     0,     0,
+       0,     0,     0,   251,   252,   253,     0,     0,     0,   274,
+     918,   223,   619,     0,     0,     0,     0,     0,     0,   808,
+     808,   808,   473,   808,     0,     0,     0,     0,     0,     0,
+     624,   628,   629,   630,   631,   632,   633,   634,   775,   453,
+     454,   455,   456,   457,   458,   459,   460,   775,     0,   808,
+     775,   775,     0,   792,   792,   768,   852,   768,   852,   740,
+     739,   742,   741,   724,   725,     0,     0,     0,     0,   784,
+     785,   786,   787,   788,   808,   807,   801,   802,   797,   800,
+       0,   803,   804,   814,     0,   808,   814,   755,   615,   613,
+     617,   678,   918,     0,     0,     0,     0,     0,     0,     0,
+     808,     0,     0,   808,     0,     0,   768,     0,   808,   792,
+     768,     0,   808,   792,   808,   808,   808,     0,     0,     0,
+     783,   768,     0,     0,   808,   783,   852,   808,   808,   852,
+     723,   814,     0,     0,     0,     0,   466,   467,   468,   469,
+     470,     0,     0,     0,   917,   808,     0,   808,   792,   792,
+     792,   792,   852,   852,     0,     0,   793,   808,   745,   746,
+     747,   748,   749,   750,   738,   737,   744,   743,     0,   808,
+     814,   726,     0,     0,     0,     0,   301,   376,   378,   380,
+     367,   383,   355,   357,   356,   358,   359,   307,   237,   238,
+     239,   240,   241,   242,   243,   244,   247,   248,   245,   246,
+     249,   250,   254,   255,   256,   257,   224,     0,     0,     0,
+       0,     0,     0,     0,     0,   448,   450,   449,   442,   444,
+     445,   446,   447,   443,     0,     0,     0,     0,   475,   476,
+     437,   439,   438,   426,   427,   428,   433,   429,   430,   432,
+     434,   435,   436,   431,     0,   524,     0,   525,   479,   477,
+     480,   486,   555,   555,     0,   490,   533,   533,   507,   508,
+     494,   495,   496,   504,   505,   541,   541,   487,     0,   537,
+     565,   513,   488,   497,   498,   514,   516,   517,   518,   506,
+     551,   519,   520,   585,   522,   515,   499,   509,   512,   489,
+       0,   623,     0,     0,     0,     0,     0,     0,     0,   761,
+     764,   763,   792,   766,   792,   605,   606,   808,   814,     0,
+     794,     0,   604,     0,     0,   702,   918,   641,     0,   808,
+       0,   814,   870,   774,     0,     0,     0,     0,     0,     0,
+       0,   808,   808,     0,   808,   808,   808,     0,   808,     0,
+       0,     0,     0,     0,   851,   846,     0,   808,     0,     0,
+     846,   808,   808,     0,     0,   722,   720,   611,   608,     0,
+     609,     0,     0,     0,     0,   814,     0,   808,   808,   808,
+     808,     0,     0,     0,     0,     0,   789,   790,   791,   808,
+     814,     0,     0,     0,   712,     0,   701,   302,   303,   814,
+     814,   814,   814,   814,   814,   299,     0,     0,     0,     0,
+     484,     0,   526,   478,   491,   492,     0,   775,   775,   775,
+     775,   775,   775,   775,   775,   775,   775,   590,   591,   485,
+     588,   510,   511,   501,   502,     0,     0,     0,     0,   523,
+     527,   500,   493,   503,   521,   622,   627,   768,     0,   814,
+       0,   768,     0,   808,   636,   635,   762,   765,     0,   603,
+       0,     0,   794,   798,     0,   814,     0,   642,   814,     0,
+     814,   858,   820,     0,   860,   859,     0,   864,   863,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     814,   814,     0,   808,     0,     0,   814,     0,   808,     0,
+       0,     0,     0,   610,   814,   814,   814,     0,   890,     0,
+       0,     0,     0,     0,     0,   808,     0,   808,     0,   808,
+       0,   808,   808,     0,   891,     0,   814,     0,   814,   871,
+     872,   873,   874,   888,   889,   300,     0,   637,   814,   814,
+     814,   814,   482,   483,   481,     0,     0,   775,     0,     0,
+     582,   557,   558,   556,   561,   562,   559,   560,   563,   592,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     589,   535,   536,   534,     0,   543,   544,   542,   531,   529,
+     532,   530,   528,   539,   540,   538,     0,   582,   567,   568,
+     566,   571,   572,   573,     0,     0,   553,   554,   552,     0,
+     587,   586,   625,   626,   451,   814,     0,   808,     0,     0,
+     814,     0,   799,   811,   811,   811,   885,   814,   857,     0,
+     818,   814,   814,     0,     0,   814,     0,     0,     0,   814,
+       0,   814,   814,   814,   849,   850,   783,     0,   814,     0,
+     826,   814,     0,     0,     0,   814,   814,   462,   463,   464,
+     814,   814,     0,     0,     0,     0,   808,     0,   808,     0,
+     808,     0,   808,     0,     0,     0,   814,   877,   814,   700,
+       0,   440,   875,   876,   424,   580,   576,   577,     0,   579,
+     578,   581,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   304,   570,   569,     0,   549,   548,   550,
+     584,   887,     0,     0,     0,   814,   607,   795,     0,   812,
+     813,     0,     0,     0,   886,   814,   869,   773,   814,   814,
+     837,   814,   814,   814,   841,   814,   844,   845,   848,   847,
+       0,   828,   814,   827,     0,   814,   814,   833,   832,   461,
+     892,   814,   814,   814,   814,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   814,   905,   878,   298,   575,   583,
+     564,   593,   594,   595,   596,   597,   598,   599,   600,   601,
+     602,   304,   304,     0,   574,   814,     0,   814,   879,   796,
+       0,     0,     0,   819,   838,   839,   836,   842,   843,   840,
+     814,   829,   814,   835,   834,   896,   893,   902,   899,     0,
+     814,     0,   814,     0,   814,     0,   814,   814,   906,     0,
+       0,   545,   880,   814,   882,   805,   815,   816,   817,   830,
+     831,   814,   897,   814,   894,   814,   903,   814,   900,   907,
+     546,   547,   881,   898,   895,   904,   901
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -806,  -806,  -806,  1560,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    1488,  -806,  -806,  1251,  -806,   -83,  1073,  -806,   710,  -806,
-    -328,  -802,  -806,  -338,  -337,  -806,  -806,  -806,  1509,  1099,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-     -79,  -805,   758,  -806,  -806,  -806,  -806,  -806,  -806,  -806,
-    -806,  -806,  1266,  1329,  1504,  -101,  -400,  -385,  -579,  -597,
-    -248,  -806,  1525,  -806,  -806,  1532,  -806,  -806,  -806,  -806,
-    -806,  -806,  -589,  -806,  -806,  -806,  -806,  -806,   726,  -806,
-    -806,  -806,   728,   729,  -806,   376,   538,  -806,  -806,  -806,
-     520,  -806,  -806,  -806,  -806,  -806,   557,  -806,  -806,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -806,   415,   754,
-    -806,  -806,  1551,  -806,  -806,  -806,  -806,   997,  1002,   991,
-    1049,  -806,  -561,  -545,  1578,   749,  -443,  1595,  1635,  -806,
-    -320,  -360,  -139,  1294,  -293,  1728,  1736,  1744,  1752,  1760,
-    -806,  1200,  -806,  -806,  -806,  1228,  -806,  -806,  1173,  -806,
-    -806,  -806,  -806,  -806,  -806,  -806,  -806,  -233,  -806,  -806,
-    -806,  -806,   907,  -329,   426,  -391,   871,  -726,  -772,   424,
-    -714,  -238,  -523,  -509,  -500,  -415,  -386,   -80,  -806,  1212,
-    -806,  -806,  -806,  -806,  -806,  -806,  -179,   579,  -806,  1506,
-    -806,   805,  -806,  -806,  -806,  -806,  -806,   832,  -806,  -806,
-    -806,  -806,  -806,  -806,  -439
+    -940,  -940,  -940,  1796,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  1704,  -940,  -940,  1439,  -940,   -84,  1221,  -940,
+     800,  -940,  -350,  -939,  -940,  -368,  -369,  -940,  -940,  -940,
+    1726,  1263,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,    10,  -925,   856,  -940,  -940,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  1412,  1565,  2157,  -121,  -449,
+    -414,  -636,  -792,  -314,  -940,  1741,  -940,  -940,  1742,  -940,
+    -940,  -940,  -940,  -940,  -940,  -669,  -940,  -940,  -940,  -940,
+    -940,   805,  -940,  -940,  -940,   809,   814,  -940,   406,   582,
+    -940,  -940,  -940,   568,  -940,  -940,  -940,  -940,  -940,   588,
+    -940,  -940,  -940,   410,   413,  -940,  -940,   416,   270,  -940,
+    -940,  -940,  -940,   432,   881,  -940,  -940,  1761,  -940,  -940,
+    -940,  -940,  1148,  1147,  1146,  1203,  -940,  -689,  -660,  -657,
+    -639,  -940,  2184,   844,  -479,  2193,  1851,  -940,  -352,  -389,
+    -147,  1483,  -331,  2202,  2211,  2220,  2229,  2238,  -940,  1384,
+    -940,  -940,  -940,  1417,  -940,  -940,  1319,  -940,  -940,  -940,
+    -940,  -940,  -940,  -940,  -940,  -940,  -940,  -940,  -252,  -940,
+    -940,  -940,  -940,  -603,  -371,   571,  -404,  -874,   -67,  -887,
+     427,  -786,  -247,  -635,  -615,  -551,  -450,  -459,   -46,  1797,
+    1398,  -940,  -940,  -940,  -940,  -940,   534,  -940,  -940,  -940,
+    -940,  -103,   654,  -940,  1711,  1800,   982,  -940,  -940,  -940,
+    1804,  -390,  -940,  -940,  1034,  -940,  -940,  -940,  -940,  -940,
+    -940,  1363,  -940,  -471
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,    11,    12,    13,    71,   130,    72,   159,    73,   179,
-      74,   201,    75,   218,    76,   233,    77,   250,    78,   264,
-      79,   281,    14,    15,    16,   295,    17,    18,    19,    20,
-     325,   564,    21,    22,    23,    24,    25,    26,    27,   102,
-     103,   339,   571,   342,    28,   516,   324,   553,  1037,  1301,
-     517,   834,   860,   518,   519,    29,    30,    84,    85,   297,
-     520,    31,    86,   313,   314,   315,   316,   317,   318,   704,
-     848,   319,   320,   321,   322,   323,   701,   835,   836,   837,
-     840,   841,   843,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,   131,   132,   133,   391,   586,   392,   588,   521,
-     522,   525,   134,   884,  1052,   135,   880,  1039,   136,   749,
-     891,   224,   811,   970,   597,   748,   598,  1053,   892,  1196,
-    1309,  1055,   893,   894,  1222,  1223,  1214,  1338,  1224,  1350,
-    1216,  1342,  1353,  1354,  1225,  1355,  1197,  1318,  1319,  1320,
-    1321,  1322,  1323,  1420,  1357,  1226,  1358,  1212,  1213,   137,
-     138,   139,   140,   971,   972,   973,   974,   636,   633,   639,
-     589,   300,   895,   896,   141,  1042,   656,   142,   143,   144,
-     375,   376,   107,   335,   336,   145,   146,   147,   148,   149,
-     440,   441,   292,   150,   415,   416,   262,   487,   488,   417,
-     489,   490,   491,   418,   492,   419,   420,   421,   422,   630,
-     423,   424,   756,   454,   171,   608,   920,  1283,  1111,  1238,
-     928,   929,  1520,   623,   624,   625,  1442,  1123,   172,   648,
-     191,   192,   193,   194,   195,   196,   330,   173,   174,   455,
-     175,   151,   152,   153,   263,   154,   155,   156,   244,   245,
-     246,   247,   248,   815,   378
+       0,    12,    13,    14,    74,   135,    75,   165,    76,   185,
+      77,   204,    78,   229,    79,   247,    80,   262,    81,   280,
+      82,   296,    83,   313,    15,    16,    17,   327,    18,    19,
+      20,    21,   357,   624,    22,    23,    24,    25,    26,    27,
+      28,   106,   107,   371,   631,   374,    29,   571,   356,   608,
+    1206,  1516,   572,   957,   983,   573,   574,    30,    31,    88,
+      89,   329,   575,    32,    90,   345,   346,   347,   348,   349,
+     350,   797,   971,   351,   352,   353,   354,   355,   794,   958,
+     959,   960,   963,   964,   966,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,   136,   137,   138,   423,   646,
+     424,   648,   576,   577,   580,   139,  1013,  1223,   140,  1009,
+    1208,   141,   847,  1029,   253,   924,  1126,   657,   846,   658,
+    1224,  1030,  1393,  1524,  1226,  1031,  1032,  1419,  1420,  1411,
+    1553,  1421,  1565,  1413,  1557,  1576,  1577,  1423,  1578,  1394,
+    1533,  1422,  1570,  1534,  1535,  1536,  1537,  1538,  1662,  1580,
+    1424,  1581,  1409,  1410,   142,   143,   144,   145,  1127,  1128,
+    1129,  1130,   700,   697,   703,   649,   332,  1033,  1034,  1035,
+    1036,  1037,   146,  1213,   722,   147,   148,   149,   407,   408,
+     111,   367,   368,   150,   151,   152,   153,   154,   475,   476,
+     324,   155,   450,   451,   292,   541,   542,   241,   509,   452,
+     543,   544,   545,   453,   546,   547,   454,   455,   456,   457,
+     694,   458,   459,   857,   489,   177,   671,  1064,  1369,  1147,
+    1443,  1072,  1073,  1796,   687,   688,   689,  1691,  1302,   178,
+     714,   216,   217,   218,   219,   220,  1473,   221,   222,   223,
+     224,   362,   179,   180,   490,   181,   156,   157,   158,   293,
+     159,   661,   160,   161,   162,   273,   274,   275,   276,   277,
+     278,   519,   928,   410
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     628,   574,   575,   312,   444,   644,   587,   735,   609,   610,
-     611,   573,   614,   615,   659,   581,   493,   616,   617,   425,
-     426,   621,   428,   626,   579,   632,   635,   459,   638,   999,
-    1000,   526,   527,   104,   528,  1006,   831,   832,  1491,  1492,
-     587,   587,   568,   587,   590,   542,   543,   544,  1339,   104,
-     397,   545,   546,   735,   547,   548,   735,   549,   550,   735,
-     653,  -731,   429,   657,   108,  1218,  1189,   109,  1236,   661,
-     662,   663,   684,   666,   668,   467,   966,   494,   674,   675,
-     676,   812,   813,   680,   681,   649,   592,   445,   594,   395,
-     768,   117,   306,    80,  1479,   682,   456,    60,  1034,   685,
-     459,   645,   646,   686,    41,   940,    42,   754,    43,    44,
-     664,  1480,   771,    45,    46,   457,   118,    96,   967,   755,
-    1438,   651,   690,   643,   755,   647,   691,    47,   692,  1112,
-     495,   799,   542,   543,   544,   396,    69,   651,   545,   546,
-    1236,   547,   548,   755,   549,   550,   801,   529,   530,    48,
-      49,    61,   803,   968,   889,   890,    62,    50,   755,    51,
-     982,    63,  1219,  1220,   755,   922,   923,   397,    52,   554,
-     298,   555,   556,   557,   558,   559,   560,   561,   562,   769,
-     924,  1143,    64,  1145,    53,  1230,    54,   925,   331,   332,
-     333,   334,   500,   501,   551,   622,  1221,  1006,  1006,  1006,
-     105,   430,   622,   764,   765,   766,   622,   622,   750,  1439,
-    1167,  1168,  1169,  1170,    83,   397,   442,   389,   390,   581,
-      81,   758,   759,   584,   984,   585,   979,   397,    65,   397,
-     669,   670,   671,   672,   785,   786,   787,    97,    98,   774,
-     397,   106,   595,   446,   447,   448,   449,   466,   110,   805,
-     435,   398,   399,    66,   493,   468,   572,   443,   816,   400,
-     401,   645,   646,   402,   822,   403,   404,   405,   406,   407,
-     460,   461,   830,   462,   806,    67,   809,   583,   411,   408,
-     409,   551,    68,   581,  1171,   568,   820,   821,    55,   872,
-     413,  1173,    82,   731,   592,   584,   594,   585,   469,   470,
-     471,   472,   732,   446,   447,   448,   449,   450,    56,   410,
-     833,   531,   833,  1351,    57,   969,  1352,   590,   552,  1040,
-     463,   631,   781,  1058,   874,   875,   876,   877,   878,   879,
-     634,   591,   157,   647,   897,  1041,   451,  1035,   452,  1059,
-     411,    83,  1232,   412,  1233,   464,   465,   567,   637,   733,
-     413,   411,   413,   926,   927,    87,   930,   453,   734,   331,
-     332,   333,   334,   413,   326,   327,   328,   329,   939,   941,
-     436,   437,  1046,   945,   414,   947,   948,    92,   950,   951,
-     845,   739,   846,  1432,    58,  1433,    88,   306,   807,   583,
-     740,    89,   961,  1034,    90,   397,   975,   976,   977,   584,
-     755,   585,   120,   121,   825,   844,   563,    93,  1310,    91,
-     993,   885,   886,   902,   997,     1,   755,    53,   122,   847,
-      94,   581,    95,   904,   123,   755,   124,   125,   326,   327,
-     328,   329,  1027,   389,   390,   755,  1047,  1048,   887,   959,
-     101,   728,   888,   584,   741,   585,  1285,  1287,  1289,   889,
-     890,   755,   584,   742,   585,   592,   593,   594,   111,   743,
-     112,   446,   447,   448,   449,  1043,  1044,  1045,   744,  1061,
-     584,   113,   585,  1210,   345,   473,   346,   347,   348,   349,
-     350,   351,  1311,  1108,   114,  1312,    99,   100,   326,   327,
-     328,   329,  1007,   649,   650,   326,   327,   328,   329,  1128,
-     213,  1008,   622,  1009,   276,  1120,   906,   294,   922,   923,
-    1279,   584,  1010,   585,  1284,   595,  1125,   126,   726,   352,
-    1313,   127,  1012,   924,   115,   353,  1314,   116,   354,   596,
-     925,  1136,   500,   501,  1139,   932,   128,  1142,   129,  1144,
-     631,  1146,  1147,   293,  1149,   296,   634,  1152,   337,  1155,
-    1156,   338,  1038,  1397,   381,   382,  1051,   343,  1399,   306,
-    1401,   344,  1403,   341,  1164,   499,  1166,     2,     3,     4,
-       5,     6,     7,     8,     9,    10,  1286,   900,   901,  1177,
-     377,   907,   909,   379,   389,   390,   380,   158,   871,   995,
-     389,   390,  1190,  1280,  1281,  1282,  1288,  1280,  1281,  1282,
-    1316,  1316,   385,   885,   886,   355,   326,   327,   328,   329,
-     946,   383,   384,   356,  1315,  1210,   908,  1336,  1336,  1340,
-    1340,   953,   637,   955,  1064,  1065,  1066,  1348,   386,  1493,
-     887,   965,  1035,   387,   888,   326,   327,   328,   329,   983,
-     985,   889,   890,   938,   990,   992,   388,   357,   393,   358,
-     394,   359,   197,   214,   360,   389,   390,   277,   735,  1280,
-    1281,  1282,   584,   427,   585,   431,   389,   390,   584,   439,
-     585,   432,   433,   434,  1117,  1118,  1119,   964,   438,  1280,
-    1281,  1282,  1013,  1014,  1015,  1016,   361,   362,  1242,  1516,
-    1517,   363,   364,   365,   622,   496,   926,   927,   366,   497,
-     367,   368,   369,   370,  1132,  1133,  1134,   498,   371,   372,
-     373,   374,  1364,  1365,  1366,  1244,   326,   327,   328,   329,
-    1148,  1237,   540,   541,  1114,   524,  1116,   523,  1255,   532,
-    1257,   580,  1280,  1281,  1282,  1261,   587,   533,  1264,  1265,
-     612,   613,  1165,   534,   584,   535,   585,   989,   500,   501,
-    1175,   537,  1275,  1276,  1277,  1278,  1002,  1003,  1004,   119,
-    1180,   502,   503,   504,   505,   506,   507,   508,   509,   510,
-     511,   512,   513,   514,   515,   618,   619,   326,   327,   328,
-     329,  1519,  1519,  1519,  1154,   654,   655,   991,   677,   678,
-    1183,  1184,  1185,  1186,  1187,  1188,   538,  1036,  1127,   790,
-     791,  1049,   915,   916,   917,   918,   919,  1172,  1174,  1325,
-    1326,  1327,  1328,  1329,  1330,  1331,  1332,  1333,  1334,   793,
-     794,   536,  1211,   795,   796,  1121,   163,   183,   205,   120,
-     121,   345,   268,   346,   347,   348,   349,   350,   351,   797,
-     798,   178,   854,   855,    53,   122,   539,   326,   327,   328,
-     329,   123,  1126,   124,   125,  1440,  1440,  1440,  1307,  1308,
-     446,   447,   448,   449,  1441,  1441,  1441,   306,  1398,  1228,
-    1400,  1231,  1402,   499,  1404,   569,   352,   176,   198,   215,
-     856,   857,   353,   278,   565,   354,  1240,   326,   327,   328,
-     329,  1243,   649,  1245,   881,   882,   582,  1247,   566,  1249,
-    1250,   577,  1252,  1253,   177,   199,   216,   200,  1017,  1018,
-     279,   120,   121,  1262,   599,  1178,   331,   332,   333,   334,
-     600,  1416,   629,  1269,  1270,  1271,    53,   122,   620,   570,
-    1019,  1020,   622,   123,   640,   124,   125,   642,  1291,  1021,
-    1022,  1293,  1023,  1024,   126,  1025,  1026,   658,   127,  1317,
-    1317,   500,   501,  1303,  1304,  1305,   660,  1306,  1414,  1415,
-     673,  1153,   355,   128,  1211,   129,  1337,  1337,  1341,  1341,
-     356,  1417,  1418,  1521,  1522,   679,  1349,   120,   121,  1443,
-    1444,   687,  1468,   688,  1470,   690,  1472,   693,  1474,   694,
-     695,  1360,    53,   122,   697,   696,   700,  1361,   698,   123,
-     699,   124,   125,  1368,   357,  -339,   358,   702,   359,   705,
-    1372,   360,   724,  1373,   706,   725,  1374,   707,  1376,   708,
-    1378,  1379,  1380,   709,   710,  1383,   126,   104,  1386,  1387,
-     127,   729,   711,   712,  1391,   713,  1392,   714,   730,  1234,
-     715,  1199,   716,   361,   362,   128,   717,   129,   363,   364,
-     365,   718,  1246,   719,  1406,   366,   737,   367,   368,   369,
-     370,   326,   327,   328,   329,   371,   372,   373,   374,   502,
-     503,   504,   505,   506,   507,   508,   509,   510,   511,   512,
-     513,   514,   515,   601,   720,  1273,   738,   746,   727,   745,
-     721,   722,   126,   723,   747,  1290,   127,   751,   752,   753,
-     601,   767,   770,  1294,  1295,  1296,  1297,  1298,  1299,   601,
-     665,   128,   773,   129,  1200,  1201,  1202,  1203,  1204,  1205,
-    1206,  1207,  1208,  1209,   217,   775,   777,   667,   779,   783,
-     784,   788,  1446,   789,   792,   814,   817,  1450,   818,  1452,
-     819,   827,   829,  1456,   232,  -341,  1458,  1459,  1359,   602,
-     603,   604,   605,   606,   607,  1464,  1465,  1466,  1467,  -343,
-    1367,  -345,   838,  1369,   839,  1371,   602,   603,   604,   605,
-     606,   607,   842,   870,   849,   602,   603,   604,   605,   606,
-     607,   301,  1382,   302,   850,   851,   500,   501,   852,  1388,
-    1389,  1390,   853,   303,   120,   121,   304,   305,   306,   858,
-     307,   308,   859,   861,   862,   863,   864,   899,   865,    53,
-     122,  1405,   866,  1407,   120,   121,   123,   867,   124,   125,
-     868,   869,   883,  1409,  1410,  1411,  1412,   873,   898,    53,
-     122,  1509,   910,  1511,   911,  1513,   123,  1515,   124,   125,
-     912,   913,   914,   921,   934,   931,   309,   935,   936,   942,
-     345,   943,   346,   347,   348,   349,   350,   351,   310,   311,
-     944,   952,   954,   958,   956,   962,   249,   957,   978,   980,
-    1523,   981,  1525,   986,  1527,   987,  1529,   988,   994,   996,
-    1436,  1437,   998,  1001,  1011,   833,  1028,  1029,  1445,  1030,
-    1031,  1032,  1447,  1448,  1449,   352,  1451,  1033,  1453,  1454,
-    1455,   353,  1062,  1457,   354,  1063,  1460,  1461,  1105,   126,
-    1106,  1462,  1463,   127,  1107,  1109,  1110,   345,  1113,   346,
-     347,   348,   349,   350,   351,  1115,  1476,  1122,   128,   126,
-     129,  1124,  1129,   127,  1130,  1131,   120,   121,   160,   180,
-     202,   219,   234,   251,   265,   282,  1135,  1137,   128,  1138,
-     129,    53,   122,  1140,  1141,  1151,  1150,  1157,   123,   622,
-     124,   125,   352,  1158,  1159,  1160,  1498,  1161,   353,  1162,
-    1499,   354,  1500,  1163,  1176,  1179,  1501,  1181,  1502,  1503,
-    1182,   355,  1191,  1192,  1504,  1505,  1506,  1507,  1193,   356,
-    1194,  1195,  1229,  1235,  1227,   474,  1239,   405,   406,   407,
-     475,   161,   181,   203,   220,   235,   252,   266,   283,   476,
-     280,   477,   478,   479,   480,   481,   482,   483,   484,   485,
-    1241,  1248,  1251,   357,  1268,   358,  1254,   359,  1256,  1524,
-     360,  1526,  1258,  1528,  1259,  1530,  1260,  1263,  1266,  1267,
-    1272,  1274,  1292,  1533,  1302,  1534,  1300,  1535,   355,  1536,
-    1324,   126,  1343,  1344,  1345,   127,   356,  1346,  1356,  1370,
-    1362,  1375,   361,   362,  1377,  1381,  1384,   363,   364,   365,
-     128,  1385,   129,  1413,   366,  1393,   367,   368,   369,   370,
-     120,   121,  1394,  1395,   371,   372,   373,   374,  1396,  1408,
-     357,  1419,   358,  1421,   359,    53,   122,   360,  1422,  1423,
-    1431,  1424,   123,  1425,   124,   125,  1426,   782,  1435,  1477,
-     345,  1427,   346,   347,   348,   349,   350,   351,   757,  1428,
-    1429,   760,   761,   762,   763,  1430,  1434,  1469,  1471,   361,
-     362,  1473,  1475,   772,   363,   364,   365,  1478,  1494,  1481,
-    1495,   366,  1482,   367,   368,   369,   370,  1483,  1484,  1485,
-    1486,   371,   372,   373,   374,   352,  1487,  1488,  1489,  1490,
-    1496,   353,  1497,  1508,   354,   397,  1510,  1512,   800,   802,
-     804,  1514,    70,   808,   937,   810,   162,   182,   204,   221,
-     236,   253,   267,   284,  1518,  1531,  1532,   823,   824,   826,
-     340,   576,   828,   299,  1050,   126,  1005,   689,  1347,   127,
-     222,   474,  1217,   405,   406,   407,   475,   223,   622,   703,
-    1054,  1215,  1056,  1057,   128,   476,   129,   477,   478,   479,
-     480,   481,   482,   483,   484,   485,  1198,  1335,   254,   780,
-     398,   399,   778,  1060,   776,   736,    59,   578,   400,   401,
-     641,   355,   402,   627,   403,   404,   405,   406,   407,   356,
-     164,   184,   206,   225,   237,   255,   269,   285,   408,   409,
-     683,  1363,   652,   949,   458,   903,   905,   165,   185,   207,
-     226,   238,   256,   270,   286,     0,     0,     0,     0,   412,
-       0,   933,     0,   357,     0,   358,     0,   359,     0,     0,
-     360,   502,   503,   504,   505,   506,   507,   508,   509,   510,
-     511,   512,   513,   514,   515,     0,     0,     0,     0,     0,
-     486,     0,     0,   960,     0,     0,   963,     0,     0,     0,
-       0,     0,   361,   362,     0,     0,     0,   363,   364,   365,
-       0,     0,     0,     0,   366,     0,   367,   368,   369,   370,
-       0,     0,     0,     0,   371,   372,   373,   374,  1067,  1068,
-    1069,  1070,  1071,  1072,  1073,  1074,  1075,  1076,  1077,  1078,
-    1079,  1080,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1088,
-    1089,  1090,  1091,  1092,  1093,  1094,  1095,  1096,  1097,  1098,
-    1099,  1100,  1101,  1102,  1103,  1104,   502,   503,   504,   505,
-     506,   507,     0,   509,   510,   511,   512,   513,   514,   515,
-     166,   186,   208,   227,   239,   257,   271,   287,   167,   187,
-     209,   228,   240,   258,   272,   288,   168,   188,   210,   229,
-     241,   259,   273,   289,   169,   189,   211,   230,   242,   260,
-     274,   290,   170,   190,   212,   231,   243,   261,   275,   291
+     692,   479,   635,   634,   460,   461,   344,   463,   708,   647,
+     833,   696,   699,   725,   702,  1164,  1165,   683,   641,  -808,
+    1093,   633,   954,   955,   639,  1751,  1752,   548,   581,   582,
+     672,   673,   674,   583,   677,   678,   628,  1441,  1171,   679,
+     680,   662,   108,   685,   108,   690,   647,   647,  1120,   647,
+     510,  1148,  1554,  1150,  1151,  1152,   464,  1138,  1153,   745,
+     833,  1084,   112,   833,   715,   113,   833,   363,   364,   365,
+     366,   858,    84,  1739,   861,   862,   863,   864,   925,   926,
+    1441,    62,   719,   100,   330,   723,   121,   874,   643,   735,
+    1740,   777,   728,   730,   731,   732,   733,   734,  1140,   738,
+     741,   870,   743,   744,   480,  1385,  1687,  -768,   751,   755,
+     760,   103,   104,   122,   717,   765,   766,   767,   768,   769,
+     770,   771,   772,   773,   774,   903,   707,   906,   908,   909,
+     910,  1361,   421,   422,   695,   916,   775,   717,   919,    87,
+     778,   491,   597,   598,   599,   779,  1122,    63,   600,   601,
+     829,   602,   603,   495,   604,   605,  1289,  1290,   470,   830,
+     492,   428,  1236,   939,   709,   710,   711,   712,   698,   686,
+     946,   947,   949,  1415,    43,   951,    44,   701,    45,    46,
+     584,   585,  1237,    47,    48,   783,    64,   709,   710,   711,
+     712,   597,   598,   599,  1739,  1146,   686,   600,   601,    49,
+     602,   603,   465,   604,   605,    65,  1123,  1574,   871,   429,
+    1575,  1754,  1324,  1688,   555,   556,  1328,   644,   784,   645,
+     785,   101,   102,  1363,   430,   431,   432,   109,   644,   477,
+     645,   865,   866,   627,   868,    85,  1335,    50,    51,   413,
+     414,  1340,  1171,  1171,  1171,    52,    72,    53,  1124,   480,
+     641,  1357,  1358,  1359,  1360,   848,  1046,  1048,   495,  1135,
+     644,   684,   645,    54,   114,   887,   888,   889,   110,   831,
+     478,   859,   860,  1077,   644,   837,   645,   495,   832,    55,
+     432,    56,  1416,  1417,   838,   912,   839,   632,    66,   548,
+     876,    67,   652,   867,   654,   840,   471,   472,  1097,   432,
+     929,  1101,   358,   359,   360,   361,   505,   628,   644,   855,
+     645,  1112,   686,    68,   936,  1116,   873,   644,   641,   645,
+    1209,   856,  1418,   901,  1229,   904,   606,   549,   856,   432,
+     953,   713,   913,   914,    69,   917,   918,   432,   920,   956,
+     650,  1049,   956,   358,   359,   360,   361,   506,   507,  1210,
+     902,   586,  1211,  1230,   883,  1001,  1231,   933,   934,   935,
+     433,   434,   856,   481,   482,   483,   484,   485,   435,   436,
+    1212,    86,   437,   905,  1232,   606,   358,   359,   360,   361,
+     438,   439,   440,   441,   442,   856,   550,  1003,  1004,  1005,
+    1006,  1007,  1008,    70,   443,   444,   486,  1038,   487,   907,
+     652,    57,   654,  1066,  1067,  1436,    87,  1437,   915,    71,
+     448,   856,   481,   482,   483,   484,   508,   488,  1068,    91,
+     856,    58,    92,  1074,   445,   432,  1069,    59,  1125,    93,
+     481,   482,   483,   484,   432,  1083,  1085,    94,   338,   713,
+    1089,  1051,  1091,  1092,  1203,  1094,  1095,   494,   358,   359,
+     360,   361,  1407,   432,   938,   446,   607,    95,   447,   448,
+    1107,  1108,   715,   716,   841,  1113,   856,   448,   358,   359,
+     360,   361,  1172,   842,  1131,  1132,  1133,  1365,    96,  1174,
+     163,  1173,    97,   948,   496,   497,   124,   498,  1175,   449,
+     499,   500,   501,   826,   641,   856,    98,    60,  1158,   756,
+     757,   758,  1162,   759,  1677,   967,  1678,   105,   481,   482,
+     483,   484,   485,   363,   364,   365,   366,   481,   482,   483,
+     484,   508,    99,  1018,  1019,  1020,  1045,  1047,   115,  1196,
+    1021,  1022,  1023,  1024,  1025,  1026,  1027,  1028,   856,   856,
+     502,   486,  1096,   494,   746,   747,   748,   749,   358,   359,
+     360,   361,   494,  1525,   856,   448,   655,  1066,  1067,  1214,
+    1215,  1216,  1117,  1234,   448,   503,   504,  1366,  1367,  1368,
+     116,   494,  1068,  1100,   117,   125,   126,  1434,   325,   643,
+    1069,   125,   126,   448,   968,   856,   969,   686,   119,  1285,
+      55,   127,   118,  1111,   415,   416,    55,   127,   128,   120,
+     129,   130,  1531,  1531,   128,   856,   129,   130,   123,  1070,
+    1071,  1307,   421,   422,  1299,  1177,   326,  1407,   328,  1551,
+    1551,  1555,  1555,   970,  1282,  1304,   373,  1427,  1076,  1563,
+    1568,  1154,  1431,  1283,   421,   422,  1286,  1287,  1526,   856,
+    1315,  1527,   369,  1318,   856,   695,   370,   197,  1323,   242,
+     595,   596,  1327,   308,  1329,  1330,  1331,   375,  1217,  1207,
+    1494,  1336,   409,  1222,  1339,   675,   676,  1343,  1344,   358,
+     359,   360,   361,   681,   682,   338,  1121,   376,  1000,   824,
+    1428,  1203,  1528,  1432,   411,  1354,   412,  1356,  1529,   417,
+     698,   761,   762,   418,   555,   556,   650,  1371,   516,   517,
+     421,   422,   419,  1160,   752,   420,   753,   754,   131,  1373,
+     651,  1156,   132,   664,   131,  1014,  1015,   425,   132,   644,
+     426,   645,   720,   721,  1204,  1386,   427,   133,   462,   134,
+     199,   225,   243,   133,  1753,   134,   309,  1082,   358,   359,
+     360,   361,  1709,   466,   511,   421,   422,  1218,  1219,  1016,
+    1366,  1367,  1368,  1017,  1043,  1044,  1341,   474,  1050,  1052,
+    1018,  1019,  1020,  1070,  1071,  1496,   551,  1021,  1022,  1023,
+    1024,  1025,  1026,  1027,  1028,   579,  1530,   473,   164,   665,
+     666,   667,   668,   669,   670,   644,   552,   645,  1090,   512,
+     513,   514,   515,   701,   467,   468,   469,   516,   517,   553,
+    1099,   892,   893,  1103,  1498,   578,   833,   587,  1295,  1296,
+     588,  1298,  1789,  1790,   895,   896,  1118,   589,   358,   359,
+     360,   361,   977,   978,   686,  1238,  1239,  1240,  1139,  1141,
+     644,   590,   645,   979,   980,  1447,  1366,  1367,  1368,  1311,
+    1312,  1313,   591,  1155,  1157,   592,  1500,  1438,   421,   422,
+     593,  1442,   652,   653,   654,  1366,  1367,  1368,   594,  1449,
+     897,   898,  1334,   358,   359,   360,   361,  1526,   899,   900,
+    1527,  1459,  1460,   637,  1462,  1463,  1464,   625,  1466,   994,
+     995,  1178,  1179,  1180,  1181,   626,   647,  1475,   642,  1355,
+     659,  1479,  1480,   660,  1366,  1367,  1368,   629,  1370,   377,
+     663,   378,   379,   380,   381,   382,   383,  1490,  1491,  1492,
+    1493,  1566,   655,   686,   727,   693,  1376,  1529,   664,  1503,
+     432,  1010,  1011,   555,   556,  1205,   656,  1182,  1183,  1220,
+    1408,  1184,  1185,   644,  1306,   645,  1366,  1367,  1368,   481,
+     482,   483,   484,  1292,   704,  1294,  1593,  1594,  1595,  1300,
+    1379,  1380,  1381,  1382,  1383,  1384,   169,   189,   208,   233,
+     684,  1204,   706,   300,   724,   664,   726,   384,  1167,  1168,
+    1169,   715,   750,   385,  1795,  1795,  1795,   386,  1689,  1689,
+    1689,  1586,   764,  1588,   665,   666,   667,   668,   669,   670,
+    1186,  1187,   742,  1540,  1541,  1542,  1543,  1544,  1545,  1546,
+    1547,  1548,  1549,  1188,  1189,  1567,   780,   518,  1059,  1060,
+    1061,  1062,  1063,  1342,   683,   377,  1345,   378,   379,   380,
+     381,   382,   383,  1617,  1523,  1522,  1190,  1191,  1622,   781,
+    1305,   665,   666,   667,   668,   669,   670,  1429,   783,  1362,
+    1364,  1435,  1690,  1690,  1690,  1637,   786,  1639,   787,  1641,
+     790,  1643,  1644,  1192,  1193,   788,  1445,   182,   201,   226,
+     244,  1448,   789,  1450,   310,   387,   791,  1452,   792,  1454,
+    1455,   793,  1457,  1458,  -373,  1346,   555,   556,   795,   388,
+    1532,  1532,   798,   384,   799,  1470,  1471,   736,   800,   385,
+     801,  1476,   802,   386,   803,  1408,   804,  1552,  1552,  1556,
+    1556,  1656,  1657,   805,  1484,  1485,  1486,  1564,  1569,   183,
+     202,   227,   245,   389,  1374,   390,   311,   391,  1659,  1660,
+     392,  1674,  1675,  1658,   806,  1506,  1797,  1798,  1508,   358,
+     359,   360,   361,   807,   664,  1692,  1693,  1683,   808,   822,
+    1518,  1519,  1520,   184,  1521,   363,   364,   365,   366,   809,
+     810,   108,   393,   394,   811,   812,   823,   395,   396,   397,
+     813,   737,   814,   815,   398,   816,   399,   400,   401,   402,
+     817,   818,   819,   820,   403,   404,   405,   406,   821,   827,
+     828,   387,   835,  1585,   843,   836,  1725,   844,  1727,   845,
+    1729,   849,  1731,  1590,   850,   388,   851,   640,   852,  1597,
+     665,   666,   667,   668,   669,   670,  1601,   853,   729,  1602,
+     854,   869,   872,   875,  1605,   877,   886,   879,  1609,   881,
+    1611,  1612,  1613,   885,   890,   891,   894,  1618,   911,   389,
+    1621,   390,   739,   391,  1625,  1626,   392,   921,   125,   126,
+    1630,   922,  1631,   377,   923,   378,   379,   380,   381,   382,
+     383,   927,  1439,    55,   127,   930,   931,   932,  1646,   664,
+    1648,   128,   937,   129,   130,  1451,   940,   950,   393,   394,
+     941,   942,   965,   395,   396,   397,  -375,   943,   944,   664,
+     398,   945,   399,   400,   401,   402,  -377,   952,  -379,   961,
+     403,   404,   405,   406,  1495,  1497,  1499,  1501,  1502,   664,
+     962,   203,   972,   973,   974,   975,   740,   976,   981,  1488,
+     982,   384,  1042,   825,  1053,  1055,   999,   385,  1002,   984,
+     985,   386,  1054,   986,  1504,   665,   666,   667,   668,   669,
+     670,   987,   988,  1509,  1510,  1511,  1512,  1513,  1514,   989,
+     990,   991,  1685,   992,   993,   665,   666,   667,   668,   669,
+     670,   996,  1695,   997,   998,  1012,  1698,  1699,  1039,  1701,
+    1702,  1703,  1040,  1705,  1041,   665,   666,   667,   668,   669,
+     670,   131,  1712,  1056,  1057,   132,  1715,  1716,   338,  1058,
+    1065,  1075,  1078,  1584,   554,  1721,  1722,  1723,  1724,  1079,
+     133,  1080,   134,  1086,  1087,  1088,   125,   126,  1734,  1596,
+    1098,  1102,  1598,  1106,  1600,  1104,  1109,  1110,  1115,   387,
+    1114,    55,   127,  1105,  1119,  1136,  1134,  1137,  1142,   128,
+    1143,   129,   130,   388,  1614,  1615,  1144,  1636,  1145,  1638,
+    1620,  1640,  1149,  1642,  1146,  1755,  1159,  1757,  1627,  1628,
+    1629,   609,  1161,   610,   611,   612,   613,   614,   615,   616,
+     617,   618,   619,   620,   621,   622,  1163,   389,   956,   390,
+    1647,   391,  1649,  1770,   392,  1166,  1176,  1772,  1194,  1197,
+    1198,  1195,  1651,  1652,  1653,  1654,  1199,  1200,  1201,  1780,
+    1202,  1782,  1235,  1784,  1280,  1786,  1787,   166,   186,   205,
+     230,   248,   263,   281,   297,   314,   393,   394,  1281,  1284,
+    1288,   395,   396,   397,  1291,  1293,  1297,  1301,   398,  1793,
+     399,   400,   401,   402,  1303,  1309,  1308,  1310,   403,   404,
+     405,   406,  1322,  1314,     1,  1316,  1317,  1319,  1320,   131,
+    1321,  1325,  1801,   132,  1803,  1326,  1805,  1332,  1807,  1681,
+    1333,   884,  1337,  1338,  1686,  1347,  1348,  1349,   133,  1350,
+     134,  1694,  1351,  1352,  1353,  1696,  1697,  1372,  1375,  1700,
+    1377,  1387,  1388,  1704,  1378,  1706,  1707,  1708,  1389,  1390,
+    1392,  1391,  1711,  1444,  1425,  1713,  1426,  1430,  1440,  1717,
+    1718,  1433,  1446,  1453,  1719,  1720,   377,   228,   378,   379,
+     380,   381,   382,   383,  1456,  1461,  1465,  1467,  1468,  1469,
+    1735,  1472,  1736,  1474,  1477,  1481,  1482,  1483,   555,   556,
+    1487,  1489,   377,  1505,   378,   379,   380,   381,   382,   383,
+    1507,   557,   558,   559,   560,   561,   562,   563,   564,   565,
+     566,   567,   568,   569,   570,  1515,  1517,  1560,  1579,  1758,
+     167,   187,   206,   231,   249,   264,   282,   298,   315,  1763,
+    1539,  1558,  1764,  1765,   384,  1766,  1767,  1768,  1559,  1769,
+     385,   338,  1561,  1582,   386,  1587,  1771,   554,  1589,  1773,
+    1774,  1583,  1599,  1591,  1603,  1775,  1776,  1777,  1778,  1604,
+     384,  1606,   125,   126,  1607,  1608,   385,  1610,  1788,  1616,
+     386,  1619,  1623,  1624,  1632,  1633,  1634,    55,   127,  1635,
+    1645,  1650,  1655,   623,  1661,   128,  1663,   129,   130,  1792,
+    1664,  1794,     2,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,  1665,  1666,  1799,  1667,  1800,  1668,  1669,  1673,
+    1682,  1680,  1684,  1670,  1802,  1710,  1804,  1671,  1806,  1714,
+    1808,  1809,  1672,  1679,  1726,  1728,   630,  1812,  1730,  1732,
+    1733,  1737,   387,  1738,  1756,  1813,  1759,  1814,  1741,  1815,
+    1760,  1816,  1742,  1743,  1744,  1745,   388,  1761,  1746,  1747,
+    1748,   520,   521,   522,   523,   524,   525,   526,   387,   430,
+     431,  1762,  1779,  1781,  1783,  1749,   557,   558,   559,   560,
+     561,   562,   388,   564,   565,   566,   567,   568,   569,   570,
+     389,  1750,   390,  1785,   391,  1791,  1810,   392,  1811,    73,
+     372,   636,   796,  1221,   331,   131,   782,  1170,  1225,   132,
+     251,   252,  1227,   246,  1414,  1562,   389,  1228,   390,  1412,
+     391,  1395,  1571,   392,   133,  1572,   134,  1676,  1573,   393,
+     394,  1550,   284,   878,   395,   396,   397,   880,   882,   834,
+     261,   398,    61,   399,   400,   401,   402,  1233,   638,   705,
+     776,   403,   404,   405,   406,   393,   394,   691,   279,  1592,
+     395,   396,   397,   198,  1478,   493,   200,   398,   763,   399,
+     400,   401,   402,   718,  1081,   294,   295,   403,   404,   405,
+     406,     0,   432,     0,     0,     0,     0,     0,   312,     0,
+       0,     0,     0,     0,   557,   558,   559,   560,   561,   562,
+     563,   564,   565,   566,   567,   568,   569,   570,   125,   126,
+       0,     0,     0,     0,   520,   521,   522,   523,   524,   525,
+     526,     0,     0,    55,   127,   527,     0,   440,   441,   442,
+     528,   128,     0,   129,   130,   125,   126,     0,     0,   529,
+       0,   530,   531,   532,   533,   534,   535,   536,   537,   538,
+      55,   127,     0,   125,   126,     0,     0,     0,   128,     0,
+     129,   130,     0,  1396,     0,     0,     0,     0,    55,   127,
+       0,   125,   126,     0,     0,     0,   128,     0,   129,   130,
+       0,   686,     0,   125,   126,     0,    55,   127,     0,     0,
+       0,     0,     0,     0,   128,     0,   129,   130,    55,   127,
+     539,     0,     0,   447,   433,   434,   128,     0,   129,   130,
+       0,     0,   435,   436,     0,     0,   437,     0,     0,     0,
+       0,     0,     0,     0,   438,   439,   440,   441,   442,     0,
+       0,     0,     0,     0,   540,   686,     0,     0,   443,   444,
+       0,   131,     0,     0,     0,   132,     0,  1397,  1398,  1399,
+    1400,  1401,  1402,  1403,  1404,  1405,  1406,     0,     0,     0,
+     133,     0,   134,     0,     0,     0,     0,     0,   131,     0,
+       0,     0,   132,     0,     0,     0,     0,     0,   527,     0,
+     440,   441,   442,   528,     0,     0,   131,   133,     0,   134,
+     132,     0,   529,     0,   530,   531,   532,   533,   534,   535,
+     536,   537,   538,     0,   131,   133,     0,   134,   132,  1014,
+    1015,     0,     0,     0,     0,     0,   131,     0,     0,     0,
+     132,     0,     0,   133,     0,   134,   555,   556,     0,     0,
+       0,   333,     0,   334,     0,   133,     0,   134,     0,     0,
+       0,     0,     0,  1016,     0,   335,     0,  1017,   336,   337,
+     338,     0,   339,   340,  1018,  1019,  1020,     0,     0,     0,
+       0,  1021,  1022,  1023,  1024,  1025,  1026,  1027,  1028,     0,
+    1241,  1242,  1243,  1244,  1245,  1246,  1247,  1248,  1249,  1250,
+    1251,  1252,  1253,  1254,  1255,  1256,  1257,  1258,  1259,  1260,
+       0,  1261,  1262,  1263,  1264,  1265,  1266,  1267,  1268,  1269,
+    1270,  1271,  1272,  1273,  1274,  1275,  1276,  1277,  1278,  1279,
+       0,     0,     0,     0,     0,     0,     0,     0,   686,     0,
+       0,   341,   168,   188,   207,   232,   250,   265,   283,   299,
+     316,     0,     0,   342,   343,   557,   558,   559,   560,   561,
+     562,   563,   564,   565,   566,   567,   568,   569,   570,   170,
+     190,   209,   234,   254,   266,   285,   301,   317,   171,   191,
+     210,   235,   255,   267,   286,   302,   318,   172,   192,   211,
+     236,   256,   268,   287,   303,   319,   173,   193,   212,   237,
+     257,   269,   288,   304,   320,   174,   194,   213,   238,   258,
+     270,   289,   305,   321,   175,   195,   214,   239,   259,   271,
+     290,   306,   322,   176,   196,   215,   240,   260,   272,   291,
+     307,   323
 };
 
 static const yytype_int16 yycheck[] =
 {
-     415,   339,   339,    86,   143,   444,   391,   586,   399,   400,
-     401,   339,   403,   404,   457,   375,   249,   408,   409,   120,
-     121,   412,   123,   414,   344,   425,   426,     6,   428,   831,
-     832,    21,    22,    90,    24,   840,    22,    23,    22,    23,
-     425,   426,   335,   428,    77,    26,    27,    28,    76,    90,
-     146,    32,    33,   632,    35,    36,   635,    38,    39,   638,
-     451,     5,   146,   454,    72,    77,    40,    75,    60,   460,
-     461,   462,   487,   464,   465,     6,    16,   173,   469,   470,
-     471,   670,   671,   474,   475,   254,   215,     6,   217,     6,
-      57,    16,    31,    11,   286,   486,   257,   144,    37,   490,
-       6,    22,    23,   494,     8,    56,    10,   146,    12,    13,
-     279,   303,   146,    17,    18,   276,    41,    73,    58,   158,
-      57,   450,    96,   443,   158,   254,   137,    31,   139,   901,
-     226,   146,    26,    27,    28,    52,     0,   466,    32,    33,
-      60,    35,    36,   158,    38,    39,   146,   137,   138,    53,
-      54,   144,   146,    93,    93,    94,   144,    61,   158,    63,
-      43,   144,   174,   175,   158,    73,    74,   146,    72,    62,
-      93,    64,    65,    66,    67,    68,    69,    70,    71,   146,
-      88,   953,   144,   955,    88,    93,    90,    95,   140,   141,
-     142,   143,   220,   221,   175,   146,   208,  1002,  1003,  1004,
-     257,   285,   146,   618,   619,   620,   146,   146,   599,   146,
-     982,   983,   984,   985,   137,   146,   257,   137,   138,   579,
-     138,   612,   613,   215,    43,   217,   815,   146,   144,   146,
-     263,   264,   265,   266,   649,   650,   651,   193,   194,   630,
-     146,   298,   275,   222,   223,   224,   225,   226,   256,   664,
-      73,   168,   169,   144,   487,     6,   339,   298,   673,   176,
-     177,    22,    23,   180,   679,   182,   183,   184,   185,   186,
-     176,   177,   687,   179,   665,   144,   667,    93,   257,   196,
-     197,   175,   144,   643,    43,   578,   677,   678,   192,   728,
-     269,    43,   146,   137,   215,   215,   217,   217,    49,    50,
-      51,    52,   146,   222,   223,   224,   225,   226,   212,   226,
-     296,   301,   296,   284,   218,   255,   287,    77,   299,   880,
-     226,    93,   642,   884,   739,   740,   741,   742,   743,   744,
-      93,    91,     3,   254,   749,   880,   255,   276,   257,   884,
-     257,   137,  1114,   260,  1116,   251,   252,   299,    93,   137,
-     269,   257,   269,   261,   262,    19,   771,   276,   146,   140,
-     141,   142,   143,   269,   247,   248,   249,   250,   783,   784,
-     193,   194,    16,   788,   291,   790,   791,   146,   793,   794,
-     215,   137,   217,   137,   288,   139,   298,    31,   146,    93,
-     146,   138,   807,    37,   138,   146,   811,   812,   813,   215,
-     158,   217,    73,    74,   146,   299,   299,   138,    96,   298,
-     825,    55,    56,   146,   829,     7,   158,    88,    89,   254,
-     139,   781,   298,   146,    95,   158,    97,    98,   247,   248,
-     249,   250,   871,   137,   138,   158,    80,    81,    82,   146,
-     282,   580,    86,   215,   137,   217,  1172,  1173,  1174,    93,
-      94,   158,   215,   146,   217,   215,   216,   217,    75,   137,
-      75,   222,   223,   224,   225,   880,   881,   882,   146,   884,
-     215,    75,   217,  1070,    42,   226,    44,    45,    46,    47,
-      48,    49,   170,   898,    16,   173,   210,   211,   247,   248,
-     249,   250,   137,   254,   255,   247,   248,   249,   250,   938,
-      74,   146,   146,   137,    78,   920,   147,    73,    73,    74,
-     146,   215,   146,   217,   146,   275,   931,   188,   299,    87,
-     208,   192,   860,    88,    75,    93,   214,    75,    96,   289,
-      95,   946,   220,   221,   949,   773,   207,   952,   209,   954,
-      93,   956,   957,     9,   959,    79,    93,   962,   138,   964,
-     965,   146,   880,  1279,   137,   138,   884,   298,  1284,    31,
-    1286,   298,  1288,   280,   979,    37,   981,   159,   160,   161,
-     162,   163,   164,   165,   166,   167,   146,   756,   757,   994,
-      59,   760,   761,   138,   137,   138,   138,   258,   727,   827,
-     137,   138,  1035,   229,   230,   231,   146,   229,   230,   231,
-    1197,  1198,   138,    55,    56,   173,   247,   248,   249,   250,
-     789,   137,   138,   181,   302,  1212,   147,  1214,  1215,  1216,
-    1217,   800,    93,   802,    83,    84,    85,  1224,   138,  1431,
-      82,   810,   276,   137,    86,   247,   248,   249,   250,   818,
-     819,    93,    94,   782,   823,   824,   138,   215,   137,   217,
-     137,   219,    73,    74,   222,   137,   138,    78,  1237,   229,
-     230,   231,   215,   139,   217,   285,   137,   138,   215,   144,
-     217,   189,   190,   191,   912,   913,   914,   147,   145,   229,
-     230,   231,   861,   862,   863,   864,   254,   255,  1127,  1491,
-    1492,   259,   260,   261,   146,   137,   261,   262,   266,    25,
-     268,   269,   270,   271,   942,   943,   944,   146,   276,   277,
-     278,   279,   272,   273,   274,  1130,   247,   248,   249,   250,
-     958,  1121,    29,    30,   903,    78,   905,   146,  1143,   137,
-    1145,   299,   229,   230,   231,  1150,  1121,   138,  1153,  1154,
-     176,   177,   980,    92,   215,    92,   217,   147,   220,   221,
-     988,   138,  1167,  1168,  1169,  1170,   835,   836,   837,     3,
-     998,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,   246,   277,   278,   247,   248,   249,
-     250,  1495,  1496,  1497,   963,   296,   297,   147,    50,    51,
-    1028,  1029,  1030,  1031,  1032,  1033,   146,   880,   937,   137,
-     138,   884,   228,   229,   230,   231,   232,   986,   987,  1200,
-    1201,  1202,  1203,  1204,  1205,  1206,  1207,  1208,  1209,   137,
-     138,   298,  1070,   137,   138,   926,    72,    73,    74,    73,
-      74,    42,    78,    44,    45,    46,    47,    48,    49,   137,
-     138,     3,    14,    15,    88,    89,   138,   247,   248,   249,
-     250,    95,   932,    97,    98,  1364,  1365,  1366,  1196,  1196,
-     222,   223,   224,   225,  1364,  1365,  1366,    31,  1283,  1107,
-    1285,  1109,  1287,    37,  1289,   211,    87,    72,    73,    74,
-      29,    30,    93,    78,   283,    96,  1124,   247,   248,   249,
-     250,  1129,   254,  1131,   137,   138,   146,  1135,   283,  1137,
-    1138,   281,  1140,  1141,    72,    73,    74,     3,   227,   228,
-      78,    73,    74,  1151,   291,   995,   140,   141,   142,   143,
-      95,  1312,   195,  1161,  1162,  1163,    88,    89,   269,    93,
-     227,   228,   146,    95,    57,    97,    98,   298,  1176,   227,
-     228,  1179,   227,   228,   188,   227,   228,   256,   192,  1197,
-    1198,   220,   221,  1191,  1192,  1193,   256,  1195,   171,   172,
-      42,   147,   173,   207,  1212,   209,  1214,  1215,  1216,  1217,
-     181,   137,   138,  1496,  1497,    42,  1224,    73,    74,  1365,
-    1366,   173,  1397,   146,  1399,    96,  1401,   137,  1403,   137,
-     228,  1229,    88,    89,   138,   137,   300,  1235,   138,    95,
-     138,    97,    98,  1241,   215,   137,   217,   137,   219,   300,
-    1248,   222,   146,  1251,   300,   146,  1254,   300,  1256,   300,
-    1258,  1259,  1260,   300,   300,  1263,   188,    90,  1266,  1267,
-     192,    57,   300,   300,  1272,   300,  1274,   300,   146,  1119,
-     300,    75,   300,   254,   255,   207,   300,   209,   259,   260,
-     261,   300,  1132,   300,  1292,   266,   137,   268,   269,   270,
-     271,   247,   248,   249,   250,   276,   277,   278,   279,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,   246,   226,   300,  1165,   138,   290,   299,   282,
-     300,   300,   188,   300,    79,  1175,   192,   146,   146,   146,
-     226,   146,     5,  1183,  1184,  1185,  1186,  1187,  1188,   226,
-     253,   207,     5,   209,   148,   149,   150,   151,   152,   153,
-     154,   155,   156,   157,     3,   146,   146,   253,   146,   146,
-      96,    96,  1370,   146,   146,    82,   146,  1375,   146,  1377,
-     146,     5,   146,  1381,     3,   137,  1384,  1385,  1228,   292,
-     293,   294,   295,   296,   297,  1393,  1394,  1395,  1396,   137,
-    1240,   137,   137,  1243,   137,  1245,   292,   293,   294,   295,
-     296,   297,    20,   228,   138,   292,   293,   294,   295,   296,
-     297,    14,  1262,    16,   138,   138,   220,   221,   137,  1269,
-    1270,  1271,   138,    26,    73,    74,    29,    30,    31,   138,
-      33,    34,   138,   146,   146,   146,   146,    57,   146,    88,
-      89,  1291,   146,  1293,    73,    74,    95,   146,    97,    98,
-     146,   146,   146,  1303,  1304,  1305,  1306,   228,   146,    88,
-      89,  1469,   147,  1471,   147,  1473,    95,  1475,    97,    98,
-       5,     5,     5,    57,   228,   147,    79,   228,   228,     5,
-      42,     5,    44,    45,    46,    47,    48,    49,    91,    92,
-       5,   178,   178,     5,   227,   147,     3,   228,   267,     5,
-    1508,   147,  1510,   146,  1512,   146,  1514,     5,   147,   147,
-    1360,  1361,     5,   137,   146,   296,     5,     5,  1368,     5,
-       5,     5,  1372,  1373,  1374,    87,  1376,     5,  1378,  1379,
-    1380,    93,   137,  1383,    96,   137,  1386,  1387,   146,   188,
-     146,  1391,  1392,   192,     5,     5,   228,    42,   178,    44,
-      45,    46,    47,    48,    49,   178,  1406,     4,   207,   188,
-     209,     5,     5,   192,   137,     5,    73,    74,    72,    73,
-      74,    75,    76,    77,    78,    79,     5,     5,   207,     5,
-     209,    88,    89,     5,     5,     5,   147,   137,    95,   146,
-      97,    98,    87,   146,   146,   146,  1446,     5,    93,     5,
-    1450,    96,  1452,     5,     5,     5,  1456,   137,  1458,  1459,
-     137,   173,     5,     5,  1464,  1465,  1466,  1467,     5,   181,
-     137,     5,     5,     5,   228,   182,     3,   184,   185,   186,
-     187,    72,    73,    74,    75,    76,    77,    78,    79,   196,
-       3,   198,   199,   200,   201,   202,   203,   204,   205,   206,
-       5,     5,     5,   215,   228,   217,     5,   219,     5,  1509,
-     222,  1511,     5,  1513,     5,  1515,     5,     5,     5,     5,
-       5,     5,     5,  1523,   137,  1525,   292,  1527,   173,  1529,
-     138,   188,   137,   137,   146,   192,   181,   138,   213,     5,
-      97,     5,   254,   255,     5,     5,     5,   259,   260,   261,
-     207,     5,   209,   137,   266,     5,   268,   269,   270,   271,
-      73,    74,     5,     5,   276,   277,   278,   279,     5,   146,
-     215,   137,   217,   146,   219,    88,    89,   222,   146,   146,
-      96,   146,    95,   146,    97,    98,   146,   299,   137,   231,
-      42,   146,    44,    45,    46,    47,    48,    49,   611,   146,
-     146,   614,   615,   616,   617,   146,   146,     5,     5,   254,
-     255,     5,     5,   626,   259,   260,   261,   146,    57,   147,
-       5,   266,   147,   268,   269,   270,   271,   147,   147,   147,
-     147,   276,   277,   278,   279,    87,   147,   147,   147,   147,
-       5,    93,     5,     5,    96,   146,     5,     5,   661,   662,
-     663,     5,    12,   666,   299,   668,    72,    73,    74,    75,
-      76,    77,    78,    79,   137,   137,   137,   680,   681,   682,
-     102,   340,   685,    84,   884,   188,   838,   498,  1222,   192,
-      75,   182,  1082,   184,   185,   186,   187,    75,   146,   536,
-     884,  1073,   884,   884,   207,   196,   209,   198,   199,   200,
-     201,   202,   203,   204,   205,   206,  1069,  1212,    77,   638,
-     168,   169,   635,   884,   632,   586,     1,   343,   176,   177,
-     440,   173,   180,   415,   182,   183,   184,   185,   186,   181,
-      72,    73,    74,    75,    76,    77,    78,    79,   196,   197,
-     487,  1237,   450,   792,   158,   758,   759,    72,    73,    74,
-      75,    76,    77,    78,    79,    -1,    -1,    -1,    -1,   260,
-      -1,   774,    -1,   215,    -1,   217,    -1,   219,    -1,    -1,
-     222,   233,   234,   235,   236,   237,   238,   239,   240,   241,
-     242,   243,   244,   245,   246,    -1,    -1,    -1,    -1,    -1,
-     291,    -1,    -1,   806,    -1,    -1,   809,    -1,    -1,    -1,
-      -1,    -1,   254,   255,    -1,    -1,    -1,   259,   260,   261,
-      -1,    -1,    -1,    -1,   266,    -1,   268,   269,   270,   271,
-      -1,    -1,    -1,    -1,   276,   277,   278,   279,    99,   100,
-     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
-     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
-     131,   132,   133,   134,   135,   136,   233,   234,   235,   236,
-     237,   238,    -1,   240,   241,   242,   243,   244,   245,   246,
-      72,    73,    74,    75,    76,    77,    78,    79,    72,    73,
-      74,    75,    76,    77,    78,    79,    72,    73,    74,    75,
-      76,    77,    78,    79,    72,    73,    74,    75,    76,    77,
-      78,    79,    72,    73,    74,    75,    76,    77,    78,    79
+     450,   148,   371,   371,   125,   126,    90,   128,   479,   423,
+     646,   460,   461,   492,   463,   954,   955,    68,   407,     5,
+     894,   371,    22,    23,   376,    22,    23,   279,    21,    22,
+     434,   435,   436,    26,   438,   439,   367,    78,   963,   443,
+     444,   431,   115,   447,   115,   449,   460,   461,   922,   463,
+       6,   938,   101,   940,   941,   942,   182,    45,   945,   509,
+     696,    74,    97,   699,   297,   100,   702,   176,   177,   178,
+     179,   674,    11,   329,   677,   678,   679,   680,   747,   748,
+      78,   180,   486,    98,   118,   489,    16,   690,   118,   322,
+     346,   541,   496,   497,   498,   499,   500,   501,    45,   503,
+     504,    75,   506,   507,     6,    42,    75,   183,   512,   513,
+     514,   253,   254,    43,   485,   519,   520,   521,   522,   523,
+     524,   525,   526,   527,   528,   728,   478,   730,   731,   732,
+     733,    45,   173,   174,   118,   738,   540,   508,   741,   173,
+     544,   300,    28,    29,    30,   549,    16,   180,    34,    35,
+     173,    37,    38,     6,    40,    41,  1043,  1044,    98,   182,
+     319,     6,   153,   766,    22,    23,    24,    25,   118,   182,
+     773,   774,   775,   102,     8,   778,    10,   118,    12,    13,
+     173,   174,   173,    17,    18,   122,   180,    22,    23,    24,
+      25,    28,    29,    30,   329,   271,   182,    34,    35,    33,
+      37,    38,   328,    40,    41,   180,    76,   327,   182,    54,
+     330,   346,  1099,   182,   263,   264,  1103,   258,   173,   260,
+     175,   236,   237,    45,    69,    70,   182,   300,   258,   300,
+     260,   681,   682,   342,   684,   174,  1110,    71,    72,   173,
+     174,  1115,  1167,  1168,  1169,    79,     0,    81,   118,     6,
+     639,  1138,  1139,  1140,  1141,   659,   859,   860,     6,   928,
+     258,   312,   260,    97,   299,   715,   716,   717,   341,   173,
+     341,   675,   676,   876,   258,   173,   260,     6,   182,   113,
+     182,   115,   211,   212,   182,   735,   173,   371,   180,   541,
+     694,   180,   258,   683,   260,   182,   236,   237,   901,   182,
+     750,   904,   290,   291,   292,   293,    54,   638,   258,   182,
+     260,   914,   182,   180,   764,   918,   182,   258,   707,   260,
+    1009,   194,   251,   727,  1013,   729,   212,   210,   194,   182,
+     780,   297,   736,   737,   180,   739,   740,   182,   742,   339,
+     102,   183,   339,   290,   291,   292,   293,    95,    96,  1009,
+     182,   344,  1009,  1013,   706,   826,  1013,   761,   762,   763,
+     205,   206,   194,   265,   266,   267,   268,   269,   213,   214,
+    1009,   182,   217,   182,  1013,   212,   290,   291,   292,   293,
+     225,   226,   227,   228,   229,   194,   269,   837,   838,   839,
+     840,   841,   842,   180,   239,   240,   298,   847,   300,   182,
+     258,   235,   260,    98,    99,  1292,   173,  1294,   182,   180,
+     312,   194,   265,   266,   267,   268,   269,   319,   113,    19,
+     194,   255,   341,   873,   269,   182,   121,   261,   298,   174,
+     265,   266,   267,   268,   182,   885,   886,   174,    33,   297,
+     890,   183,   892,   893,    39,   895,   896,   300,   290,   291,
+     292,   293,  1244,   182,   182,   300,   342,   341,   303,   312,
+     910,   911,   297,   298,   173,   915,   194,   312,   290,   291,
+     292,   293,   173,   182,   924,   925,   926,   182,   182,   173,
+       3,   182,   174,   182,   213,   214,     3,   216,   182,   334,
+     219,   220,   221,   640,   883,   194,   175,   331,   948,    55,
+      56,    57,   952,    59,   173,   342,   175,   325,   265,   266,
+     267,   268,   269,   176,   177,   178,   179,   265,   266,   267,
+     268,   269,   341,   118,   119,   120,   182,   182,   100,  1000,
+     125,   126,   127,   128,   129,   130,   131,   132,   194,   194,
+     269,   298,   182,   300,   306,   307,   308,   309,   290,   291,
+     292,   293,   300,   122,   194,   312,   318,    98,    99,  1009,
+    1010,  1011,   183,  1013,   312,   294,   295,   272,   273,   274,
+     100,   300,   113,   182,   100,    98,    99,   118,     9,   118,
+     121,    98,    99,   312,   258,   194,   260,   182,   100,  1039,
+     113,   114,    16,   182,   173,   174,   113,   114,   121,   100,
+     123,   124,  1394,  1395,   121,   194,   123,   124,   100,   304,
+     305,  1082,   173,   174,  1064,   983,    98,  1409,   104,  1411,
+    1412,  1413,  1414,   297,  1028,  1075,   323,   182,   875,  1421,
+    1422,   183,   182,  1037,   173,   174,  1040,  1041,   207,   194,
+    1090,   210,   174,  1093,   194,   118,   182,    76,  1098,    78,
+      31,    32,  1102,    82,  1104,  1105,  1106,   341,    16,  1009,
+     182,  1111,    77,  1013,  1114,   213,   214,  1117,  1118,   290,
+     291,   292,   293,   320,   321,    33,   923,   341,   825,   342,
+    1283,    39,   251,  1286,   174,  1135,   174,  1137,   257,   174,
+     118,    52,    53,   174,   263,   264,   102,  1147,    59,    60,
+     173,   174,   173,   950,    55,   174,    57,    58,   231,  1159,
+     116,   183,   235,   269,   231,    73,    74,   173,   235,   258,
+     173,   260,   339,   340,   319,  1204,   174,   250,   175,   252,
+      76,    77,    78,   250,  1673,   252,    82,   884,   290,   291,
+     292,   293,  1616,   328,     6,   173,   174,   105,   106,   107,
+     272,   273,   274,   111,   857,   858,   183,   180,   861,   862,
+     118,   119,   120,   304,   305,   182,   173,   125,   126,   127,
+     128,   129,   130,   131,   132,   103,   345,   181,   301,   335,
+     336,   337,   338,   339,   340,   258,    27,   260,   891,    51,
+      52,    53,    54,   118,   232,   233,   234,    59,    60,   182,
+     903,   173,   174,   906,   182,   182,  1442,   173,  1055,  1056,
+     174,  1058,  1751,  1752,   173,   174,   919,   117,   290,   291,
+     292,   293,    14,    15,   182,   108,   109,   110,   931,   932,
+     258,   117,   260,    31,    32,  1306,   272,   273,   274,  1086,
+    1087,  1088,   341,   946,   947,   174,   182,  1297,   173,   174,
+     182,  1300,   258,   259,   260,   272,   273,   274,   174,  1309,
+     173,   174,  1109,   290,   291,   292,   293,   207,   173,   174,
+     210,  1321,  1322,   324,  1324,  1325,  1326,   326,  1328,    31,
+      32,   984,   985,   986,   987,   326,  1300,  1337,   182,  1136,
+     334,  1341,  1342,    16,   272,   273,   274,   254,  1145,    44,
+     121,    46,    47,    48,    49,    50,    51,  1357,  1358,  1359,
+    1360,   251,   318,   182,   218,   238,  1163,   257,   269,  1369,
+     182,   173,   174,   263,   264,  1009,   332,   270,   271,  1013,
+    1244,   270,   271,   258,  1081,   260,   272,   273,   274,   265,
+     266,   267,   268,  1046,    75,  1048,   315,   316,   317,  1070,
+    1197,  1198,  1199,  1200,  1201,  1202,    75,    76,    77,    78,
+     312,   319,   341,    82,   299,   269,   299,   112,   958,   959,
+     960,   297,    44,   118,  1760,  1761,  1762,   122,  1593,  1594,
+    1595,  1431,    44,  1433,   335,   336,   337,   338,   339,   340,
+     270,   271,   298,  1397,  1398,  1399,  1400,  1401,  1402,  1403,
+    1404,  1405,  1406,   270,   271,   345,   210,   269,   271,   272,
+     273,   274,   275,  1116,    68,    44,  1119,    46,    47,    48,
+      49,    50,    51,  1473,  1393,  1393,   270,   271,  1478,   182,
+    1076,   335,   336,   337,   338,   339,   340,  1284,   122,  1142,
+    1143,  1288,  1593,  1594,  1595,  1495,   173,  1497,   173,  1499,
+     174,  1501,  1502,   270,   271,   271,  1303,    75,    76,    77,
+      78,  1308,   173,  1310,    82,   210,   174,  1314,   174,  1316,
+    1317,   343,  1319,  1320,   173,  1121,   263,   264,   173,   224,
+    1394,  1395,   343,   112,   343,  1332,  1333,   222,   343,   118,
+     343,  1338,   343,   122,   343,  1409,   343,  1411,  1412,  1413,
+    1414,   208,   209,   343,  1351,  1352,  1353,  1421,  1422,    75,
+      76,    77,    78,   258,  1160,   260,    82,   262,   173,   174,
+     265,   173,   174,  1527,   343,  1372,  1761,  1762,  1375,   290,
+     291,   292,   293,   343,   269,  1594,  1595,  1587,   343,   182,
+    1387,  1388,  1389,     3,  1391,   176,   177,   178,   179,   343,
+     343,   115,   297,   298,   343,   343,   182,   302,   303,   304,
+     343,   296,   343,   343,   309,   343,   311,   312,   313,   314,
+     343,   343,   343,   343,   319,   320,   321,   322,   343,    75,
+     182,   210,   173,  1430,   325,   174,  1636,   333,  1638,   104,
+    1640,   173,  1642,  1440,   104,   224,   104,   342,   182,  1446,
+     335,   336,   337,   338,   339,   340,  1453,   182,   218,  1456,
+     182,   182,     5,     5,  1461,   182,   122,   182,  1465,   182,
+    1467,  1468,  1469,   182,   122,   182,   182,  1474,   182,   258,
+    1477,   260,   222,   262,  1481,  1482,   265,   182,    98,    99,
+    1487,   182,  1489,    44,     5,    46,    47,    48,    49,    50,
+      51,   107,  1298,   113,   114,   182,   182,   182,  1505,   269,
+    1507,   121,   182,   123,   124,  1311,   182,     5,   297,   298,
+     182,   182,    20,   302,   303,   304,   173,   182,   182,   269,
+     309,   182,   311,   312,   313,   314,   173,   182,   173,   173,
+     319,   320,   321,   322,  1361,  1362,  1363,  1364,  1365,   269,
+     173,     3,   174,   174,   174,   173,   296,   174,   174,  1355,
+     174,   112,    75,   342,   183,     5,   271,   118,   271,   182,
+     182,   122,   183,   182,  1370,   335,   336,   337,   338,   339,
+     340,   182,   182,  1379,  1380,  1381,  1382,  1383,  1384,   182,
+     182,   182,  1589,   182,   182,   335,   336,   337,   338,   339,
+     340,   182,  1599,   182,   182,   182,  1603,  1604,   182,  1606,
+    1607,  1608,   182,  1610,   182,   335,   336,   337,   338,   339,
+     340,   231,  1619,     5,   104,   235,  1623,  1624,    33,     5,
+      75,   183,   271,  1429,    39,  1632,  1633,  1634,  1635,   271,
+     250,   271,   252,     5,     5,     5,    98,    99,  1645,  1445,
+     215,   215,  1448,   183,  1450,   270,     5,   182,   182,   210,
+     183,   113,   114,   271,   182,     5,   310,   183,   182,   121,
+     182,   123,   124,   224,  1470,  1471,   182,  1494,     5,  1496,
+    1476,  1498,   183,  1500,   271,  1682,   183,  1684,  1484,  1485,
+    1486,    80,   183,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,     5,   258,   339,   260,
+    1506,   262,  1508,  1710,   265,   173,   182,  1714,   271,     5,
+       5,   271,  1518,  1519,  1520,  1521,     5,     5,     5,  1726,
+       5,  1728,   173,  1730,   182,  1732,  1733,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,   297,   298,   182,     5,
+       5,   302,   303,   304,   215,   215,   182,     4,   309,  1756,
+     311,   312,   313,   314,     5,   173,     5,     5,   319,   320,
+     321,   322,   271,     5,     7,     5,     5,     5,     5,   231,
+     270,   270,  1779,   235,  1781,   271,  1783,     5,  1785,  1585,
+       5,   342,   183,     5,  1590,   173,   182,   182,   250,   182,
+     252,  1597,     5,     5,     5,  1601,  1602,     5,     5,  1605,
+     173,     5,     5,  1609,   173,  1611,  1612,  1613,     5,   173,
+     173,     5,  1618,     3,   271,  1621,   182,     5,     5,  1625,
+    1626,   182,     5,     5,  1630,  1631,    44,     3,    46,    47,
+      48,    49,    50,    51,     5,     5,     5,     5,     5,     5,
+    1646,   223,  1648,     5,     5,     5,     5,   271,   263,   264,
+       5,     5,    44,     5,    46,    47,    48,    49,    50,    51,
+       5,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+     285,   286,   287,   288,   289,   335,   173,   182,   256,  1685,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,  1695,
+     174,   173,  1698,  1699,   112,  1701,  1702,  1703,   173,  1705,
+     118,    33,   174,   270,   122,   183,  1712,    39,     5,  1715,
+    1716,   271,     5,   123,     5,  1721,  1722,  1723,  1724,     5,
+     112,     5,    98,    99,     5,     5,   118,     5,  1734,   182,
+     122,     5,     5,     5,     5,     5,     5,   113,   114,     5,
+       5,   182,   173,   342,   173,   121,   182,   123,   124,  1755,
+     182,  1757,   195,   196,   197,   198,   199,   200,   201,   202,
+     203,   204,   182,   182,  1770,   182,  1772,   182,   182,   122,
+       5,   173,     5,   182,  1780,     5,  1782,   182,  1784,     5,
+    1786,  1787,   182,   182,     5,     5,   118,  1793,     5,     5,
+       5,   274,   210,   182,     5,  1801,    75,  1803,   183,  1805,
+       5,  1807,   183,   183,   183,   183,   224,     5,   183,   183,
+     183,    61,    62,    63,    64,    65,    66,    67,   210,    69,
+      70,     5,     5,     5,     5,   183,   276,   277,   278,   279,
+     280,   281,   224,   283,   284,   285,   286,   287,   288,   289,
+     258,   183,   260,     5,   262,   173,   173,   265,   173,    13,
+     106,   372,   591,  1013,    88,   231,   553,   961,  1013,   235,
+      79,    79,  1013,     3,  1256,  1419,   258,  1013,   260,  1247,
+     262,  1243,  1422,   265,   250,  1422,   252,  1567,  1422,   297,
+     298,  1409,    81,   696,   302,   303,   304,   699,   702,   646,
+       3,   309,     1,   311,   312,   313,   314,  1013,   375,   475,
+     541,   319,   320,   321,   322,   297,   298,   450,     3,  1442,
+     302,   303,   304,    76,  1340,   164,    76,   309,   515,   311,
+     312,   313,   314,   485,   342,    81,     3,   319,   320,   321,
+     322,    -1,   182,    -1,    -1,    -1,    -1,    -1,     3,    -1,
+      -1,    -1,    -1,    -1,   276,   277,   278,   279,   280,   281,
+     282,   283,   284,   285,   286,   287,   288,   289,    98,    99,
+      -1,    -1,    -1,    -1,    61,    62,    63,    64,    65,    66,
+      67,    -1,    -1,   113,   114,   225,    -1,   227,   228,   229,
+     230,   121,    -1,   123,   124,    98,    99,    -1,    -1,   239,
+      -1,   241,   242,   243,   244,   245,   246,   247,   248,   249,
+     113,   114,    -1,    98,    99,    -1,    -1,    -1,   121,    -1,
+     123,   124,    -1,   100,    -1,    -1,    -1,    -1,   113,   114,
+      -1,    98,    99,    -1,    -1,    -1,   121,    -1,   123,   124,
+      -1,   182,    -1,    98,    99,    -1,   113,   114,    -1,    -1,
+      -1,    -1,    -1,    -1,   121,    -1,   123,   124,   113,   114,
+     300,    -1,    -1,   303,   205,   206,   121,    -1,   123,   124,
+      -1,    -1,   213,   214,    -1,    -1,   217,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   225,   226,   227,   228,   229,    -1,
+      -1,    -1,    -1,    -1,   334,   182,    -1,    -1,   239,   240,
+      -1,   231,    -1,    -1,    -1,   235,    -1,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,    -1,    -1,    -1,
+     250,    -1,   252,    -1,    -1,    -1,    -1,    -1,   231,    -1,
+      -1,    -1,   235,    -1,    -1,    -1,    -1,    -1,   225,    -1,
+     227,   228,   229,   230,    -1,    -1,   231,   250,    -1,   252,
+     235,    -1,   239,    -1,   241,   242,   243,   244,   245,   246,
+     247,   248,   249,    -1,   231,   250,    -1,   252,   235,    73,
+      74,    -1,    -1,    -1,    -1,    -1,   231,    -1,    -1,    -1,
+     235,    -1,    -1,   250,    -1,   252,   263,   264,    -1,    -1,
+      -1,    14,    -1,    16,    -1,   250,    -1,   252,    -1,    -1,
+      -1,    -1,    -1,   107,    -1,    28,    -1,   111,    31,    32,
+      33,    -1,    35,    36,   118,   119,   120,    -1,    -1,    -1,
+      -1,   125,   126,   127,   128,   129,   130,   131,   132,    -1,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+      -1,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   182,    -1,
+      -1,   104,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    -1,    -1,   116,   117,   276,   277,   278,   279,   280,
+     281,   282,   283,   284,   285,   286,   287,   288,   289,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    75,    76,    77,    78,    79,    80,    81,
+      82,    83
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_int16 yystos[] =
 {
-       0,     7,   159,   160,   161,   162,   163,   164,   165,   166,
-     167,   305,   306,   307,   326,   327,   328,   330,   331,   332,
-     333,   336,   337,   338,   339,   340,   341,   342,   348,   359,
-     360,   365,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,     8,    10,    12,    13,    17,    18,    31,    53,    54,
-      61,    63,    72,    88,    90,   192,   212,   218,   288,   472,
-     144,   144,   144,   144,   144,   144,   144,   144,   144,     0,
-     307,   308,   310,   312,   314,   316,   318,   320,   322,   324,
-      11,   138,   146,   137,   361,   362,   366,    19,   298,   138,
-     138,   298,   146,   138,   139,   298,    73,   193,   194,   210,
-     211,   282,   343,   344,    90,   257,   298,   476,    72,    75,
-     256,    75,    75,    75,    16,    75,    75,    16,    41,     3,
-      73,    74,    89,    95,    97,    98,   188,   192,   207,   209,
-     309,   396,   397,   398,   406,   409,   412,   453,   454,   455,
-     456,   468,   471,   472,   473,   479,   480,   481,   482,   483,
-     487,   535,   536,   537,   539,   540,   541,     3,   258,   311,
-     396,   397,   398,   453,   468,   471,   479,   480,   481,   482,
-     483,   508,   522,   531,   532,   534,   535,   541,     3,   313,
-     396,   397,   398,   453,   468,   471,   479,   480,   481,   482,
-     483,   524,   525,   526,   527,   528,   529,   531,   535,   541,
-       3,   315,   396,   397,   398,   453,   468,   471,   479,   480,
-     481,   482,   483,   508,   531,   535,   541,     3,   317,   396,
-     397,   398,   406,   409,   415,   468,   471,   479,   480,   481,
-     482,   483,     3,   319,   396,   397,   398,   468,   471,   479,
-     480,   481,   482,   483,   542,   543,   544,   545,   546,     3,
-     321,   396,   397,   398,   456,   468,   471,   479,   480,   481,
-     482,   483,   490,   538,   323,   396,   397,   398,   453,   468,
-     471,   479,   480,   481,   482,   483,   508,   531,   535,   541,
-       3,   325,   396,   397,   398,   468,   471,   479,   480,   481,
-     482,   483,   486,     9,    73,   329,    79,   363,    93,   362,
-     465,    14,    16,    26,    29,    30,    31,    33,    34,    79,
-      91,    92,   349,   367,   368,   369,   370,   371,   372,   375,
-     376,   377,   378,   379,   350,   334,   247,   248,   249,   250,
-     530,   140,   141,   142,   143,   477,   478,   138,   146,   345,
-     344,   280,   347,   298,   298,    42,    44,    45,    46,    47,
-      48,    49,    87,    93,    96,   173,   181,   215,   217,   219,
-     222,   254,   255,   259,   260,   261,   266,   268,   269,   270,
-     271,   276,   277,   278,   279,   474,   475,    59,   548,   138,
-     138,   137,   138,   137,   138,   138,   138,   137,   138,   137,
-     138,   399,   401,   137,   137,     6,    52,   146,   168,   169,
-     176,   177,   180,   182,   183,   184,   185,   186,   196,   197,
-     226,   257,   260,   269,   291,   488,   489,   493,   497,   499,
-     500,   501,   502,   504,   505,   399,   399,   139,   399,   146,
-     285,   285,   189,   190,   191,    73,   193,   194,   145,   144,
-     484,   485,   257,   298,   476,     6,   222,   223,   224,   225,
-     226,   255,   257,   276,   507,   533,   257,   276,   533,     6,
-     176,   177,   179,   226,   251,   252,   226,     6,     6,    49,
-      50,    51,    52,   226,   182,   187,   196,   198,   199,   200,
-     201,   202,   203,   204,   205,   206,   291,   491,   492,   494,
-     495,   496,   498,   501,   173,   226,   137,    25,   146,    37,
-     220,   221,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,   246,   349,   354,   357,   358,
-     364,   403,   404,   146,    78,   405,    21,    22,    24,   137,
-     138,   301,   137,   138,    92,    92,   298,   138,   146,   138,
-      29,    30,    26,    27,    28,    32,    33,    35,    36,    38,
-      39,   175,   299,   351,    62,    64,    65,    66,    67,    68,
-      69,    70,    71,   299,   335,   283,   283,   299,   478,   211,
-      93,   346,   349,   354,   357,   358,   347,   281,   477,   474,
-     299,   475,   146,    93,   215,   217,   400,   401,   402,   464,
-      77,    91,   215,   216,   217,   275,   289,   418,   420,   291,
-      95,   226,   292,   293,   294,   295,   296,   297,   509,   509,
-     509,   509,   176,   177,   509,   509,   509,   509,   277,   278,
-     269,   509,   146,   517,   518,   519,   509,   489,   519,   195,
-     503,    93,   400,   462,    93,   400,   461,    93,   400,   463,
-      57,   485,   298,   474,   548,    22,    23,   254,   523,   254,
-     255,   507,   523,   509,   296,   297,   470,   509,   256,   470,
-     256,   509,   509,   509,   279,   253,   509,   253,   509,   263,
-     264,   265,   266,    42,   509,   509,   509,    50,    51,    42,
-     509,   509,   509,   492,   519,   509,   509,   173,   146,   363,
-      96,   137,   139,   137,   137,   228,   137,   138,   138,   138,
-     300,   380,   137,   350,   373,   300,   300,   300,   300,   300,
-     300,   300,   300,   300,   300,   300,   300,   300,   300,   300,
-     300,   300,   300,   300,   146,   146,   299,   299,   476,    57,
-     146,   137,   146,   137,   146,   402,   464,   137,   138,   137,
-     146,   137,   146,   137,   146,   282,   290,    79,   419,   413,
-     509,   146,   146,   146,   146,   158,   506,   506,   509,   509,
-     506,   506,   506,   506,   519,   519,   519,   146,    57,   146,
-       5,   146,   506,     5,   509,   146,   462,   146,   461,   146,
-     463,   474,   299,   146,    96,   519,   519,   519,    96,   146,
-     137,   138,   146,   137,   138,   137,   138,   137,   138,   146,
-     506,   146,   506,   146,   506,   519,   509,   146,   506,   509,
-     506,   416,   416,   416,    82,   547,   519,   146,   146,   146,
-     509,   509,   519,   506,   506,   146,   506,     5,   506,   146,
-     519,    22,    23,   296,   355,   381,   382,   383,   137,   137,
-     384,   385,    20,   386,   299,   215,   217,   254,   374,   138,
-     138,   138,   137,   138,    14,    15,    29,    30,   138,   138,
-     356,   146,   146,   146,   146,   146,   146,   146,   146,   146,
-     228,   476,   548,   228,   519,   519,   519,   519,   519,   519,
-     410,   137,   138,   146,   407,    55,    56,    82,    86,    93,
-      94,   414,   422,   426,   427,   466,   467,   519,   146,    57,
-     530,   530,   146,   506,   146,   506,   147,   530,   147,   530,
-     147,   147,     5,     5,     5,   228,   229,   230,   231,   232,
-     510,    57,    73,    74,    88,    95,   261,   262,   514,   515,
-     519,   147,   515,   506,   228,   228,   228,   299,   476,   519,
-      56,   519,     5,     5,     5,   519,   530,   519,   519,   510,
-     519,   519,   178,   530,   178,   530,   227,   228,     5,   146,
-     506,   519,   147,   506,   147,   530,    16,    58,    93,   255,
-     417,   457,   458,   459,   460,   519,   519,   519,   267,   416,
-       5,   147,    43,   530,    43,   530,   146,   146,     5,   147,
-     530,   147,   530,   519,   147,   515,   147,   519,     5,   355,
-     355,   137,   384,   384,   384,   386,   385,   137,   146,   137,
-     146,   146,   357,   530,   530,   530,   530,   227,   228,   227,
-     228,   227,   228,   227,   228,   227,   228,   548,     5,     5,
-       5,     5,     5,     5,    37,   276,   349,   352,   354,   411,
-     466,   467,   469,   519,   519,   519,    16,    80,    81,   349,
-     352,   354,   408,   421,   422,   425,   426,   427,   466,   467,
-     469,   519,   137,   137,    83,    84,    85,    99,   100,   101,
-     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
-     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
-     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
-     132,   133,   134,   135,   136,   146,   146,     5,   519,     5,
-     228,   512,   512,   178,   530,   178,   530,   515,   515,   515,
-     519,   399,     4,   521,     5,   519,   521,   476,   548,     5,
-     137,     5,   515,   515,   515,     5,   519,     5,     5,   519,
-       5,     5,   519,   512,   519,   512,   519,   519,   515,   519,
-     147,     5,   519,   147,   530,   519,   519,   137,   146,   146,
-     146,     5,     5,     5,   519,   515,   519,   512,   512,   512,
-     512,    43,   530,    43,   530,   515,     5,   519,   521,     5,
-     515,   137,   137,   515,   515,   515,   515,   515,   515,    40,
-     470,     5,     5,     5,   137,     5,   423,   440,   440,    75,
-     148,   149,   150,   151,   152,   153,   154,   155,   156,   157,
-     403,   404,   451,   452,   430,   430,   434,   434,    77,   174,
-     175,   208,   428,   429,   432,   438,   449,   228,   515,     5,
-      93,   515,   512,   512,   521,     5,    60,   400,   513,     3,
-     515,     5,   548,   515,   519,   515,   521,   515,     5,   515,
-     515,     5,   515,   515,     5,   519,     5,   519,     5,     5,
-       5,   519,   515,     5,   519,   519,     5,     5,   228,   515,
-     515,   515,     5,   521,     5,   519,   519,   519,   519,   146,
-     229,   230,   231,   511,   146,   511,   146,   511,   146,   511,
-     521,   515,     5,   515,   521,   521,   521,   521,   521,   521,
-     292,   353,   137,   515,   515,   515,   515,   357,   358,   424,
-      96,   170,   173,   208,   214,   302,   403,   404,   441,   442,
-     443,   444,   445,   446,   138,   509,   509,   509,   509,   509,
-     509,   509,   509,   509,   509,   452,   403,   404,   431,    76,
-     403,   404,   435,   137,   137,   146,   138,   429,   403,   404,
-     433,   284,   287,   436,   437,   439,   213,   448,   450,   521,
-     515,   515,    97,   513,   272,   273,   274,   521,   515,   521,
-       5,   521,   515,   515,   515,     5,   515,     5,   515,   515,
-     515,     5,   521,   515,     5,     5,   515,   515,   521,   521,
-     521,   515,   515,     5,     5,     5,     5,   511,   519,   511,
-     519,   511,   519,   511,   519,   521,   515,   521,   146,   521,
-     521,   521,   521,   137,   171,   172,   509,   137,   138,   137,
-     447,   146,   146,   146,   146,   146,   146,   146,   146,   146,
-     146,    96,   137,   139,   146,   137,   521,   521,    57,   146,
-     517,   518,   520,   520,   520,   521,   515,   521,   521,   521,
-     515,   521,   515,   521,   521,   521,   515,   521,   515,   515,
-     521,   521,   521,   521,   515,   515,   515,   515,   519,     5,
-     519,     5,   519,     5,   519,     5,   521,   231,   146,   286,
-     303,   147,   147,   147,   147,   147,   147,   147,   147,   147,
-     147,    22,    23,   355,    57,     5,     5,     5,   521,   521,
-     521,   521,   521,   521,   521,   521,   521,   521,     5,   515,
-       5,   515,     5,   515,     5,   515,   355,   355,   137,   514,
-     516,   516,   516,   515,   521,   515,   521,   515,   521,   515,
-     521,   137,   137,   521,   521,   521,   521
+       0,     7,   195,   196,   197,   198,   199,   200,   201,   202,
+     203,   204,   348,   349,   350,   371,   372,   373,   375,   376,
+     377,   378,   381,   382,   383,   384,   385,   386,   387,   393,
+     404,   405,   410,   432,   433,   434,   435,   436,   437,   438,
+     439,   440,   441,     8,    10,    12,    13,    17,    18,    33,
+      71,    72,    79,    81,    97,   113,   115,   235,   255,   261,
+     331,   523,   180,   180,   180,   180,   180,   180,   180,   180,
+     180,   180,     0,   350,   351,   353,   355,   357,   359,   361,
+     363,   365,   367,   369,    11,   174,   182,   173,   406,   407,
+     411,    19,   341,   174,   174,   341,   182,   174,   175,   341,
+      98,   236,   237,   253,   254,   325,   388,   389,   115,   300,
+     341,   527,    97,   100,   299,   100,   100,   100,    16,   100,
+     100,    16,    43,   100,     3,    98,    99,   114,   121,   123,
+     124,   231,   235,   250,   252,   352,   442,   443,   444,   452,
+     455,   458,   501,   502,   503,   504,   519,   522,   523,   524,
+     530,   531,   532,   533,   534,   538,   593,   594,   595,   597,
+     599,   600,   601,     3,   301,   354,   442,   443,   444,   501,
+     519,   522,   530,   531,   532,   533,   534,   562,   576,   589,
+     590,   592,   593,   601,     3,   356,   442,   443,   444,   501,
+     519,   522,   530,   531,   532,   533,   534,   562,   576,   589,
+     592,   593,   601,     3,   358,   442,   443,   444,   501,   519,
+     522,   530,   531,   532,   533,   534,   578,   579,   580,   581,
+     582,   584,   585,   586,   587,   589,   593,   601,     3,   360,
+     442,   443,   444,   501,   519,   522,   530,   531,   532,   533,
+     534,   544,   562,   589,   593,   601,     3,   362,   442,   443,
+     444,   452,   455,   461,   519,   522,   530,   531,   532,   533,
+     534,     3,   364,   442,   443,   444,   519,   522,   530,   531,
+     532,   533,   534,   602,   603,   604,   605,   606,   607,     3,
+     366,   442,   443,   444,   504,   519,   522,   530,   531,   532,
+     533,   534,   541,   596,   597,     3,   368,   442,   443,   444,
+     501,   519,   522,   530,   531,   532,   533,   534,   562,   589,
+     593,   601,     3,   370,   442,   443,   444,   519,   522,   530,
+     531,   532,   533,   534,   537,     9,    98,   374,   104,   408,
+     118,   407,   513,    14,    16,    28,    31,    32,    33,    35,
+      36,   104,   116,   117,   394,   412,   413,   414,   415,   416,
+     417,   420,   421,   422,   423,   424,   395,   379,   290,   291,
+     292,   293,   588,   176,   177,   178,   179,   528,   529,   174,
+     182,   390,   389,   323,   392,   341,   341,    44,    46,    47,
+      48,    49,    50,    51,   112,   118,   122,   210,   224,   258,
+     260,   262,   265,   297,   298,   302,   303,   304,   309,   311,
+     312,   313,   314,   319,   320,   321,   322,   525,   526,    77,
+     610,   174,   174,   173,   174,   173,   174,   174,   174,   173,
+     174,   173,   174,   445,   447,   173,   173,   174,     6,    54,
+      69,    70,   182,   205,   206,   213,   214,   217,   225,   226,
+     227,   228,   229,   239,   240,   269,   300,   303,   312,   334,
+     539,   540,   546,   550,   553,   554,   555,   556,   558,   559,
+     445,   445,   175,   445,   182,   328,   328,   232,   233,   234,
+      98,   236,   237,   181,   180,   535,   536,   300,   341,   527,
+       6,   265,   266,   267,   268,   269,   298,   300,   319,   561,
+     591,   300,   319,   591,   300,     6,   213,   214,   216,   219,
+     220,   221,   269,   294,   295,    54,    95,    96,   269,   545,
+       6,     6,    51,    52,    53,    54,    59,    60,   269,   608,
+      61,    62,    63,    64,    65,    66,    67,   225,   230,   239,
+     241,   242,   243,   244,   245,   246,   247,   248,   249,   300,
+     334,   542,   543,   547,   548,   549,   551,   552,   555,   210,
+     269,   173,    27,   182,    39,   263,   264,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,   394,   399,   402,   403,   409,   449,   450,   182,   103,
+     451,    21,    22,    26,   173,   174,   344,   173,   174,   117,
+     117,   341,   174,   182,   174,    31,    32,    28,    29,    30,
+      34,    35,    37,    38,    40,    41,   212,   342,   396,    80,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,   342,   380,   326,   326,   342,   529,   254,
+     118,   391,   394,   399,   402,   403,   392,   324,   528,   525,
+     342,   526,   182,   118,   258,   260,   446,   447,   448,   512,
+     102,   116,   258,   259,   260,   318,   332,   464,   466,   334,
+      16,   598,   598,   121,   269,   335,   336,   337,   338,   339,
+     340,   563,   563,   563,   563,   213,   214,   563,   563,   563,
+     563,   320,   321,    68,   312,   563,   182,   571,   572,   573,
+     563,   540,   573,   238,   557,   118,   446,   510,   118,   446,
+     509,   118,   446,   511,    75,   536,   341,   525,   610,    22,
+      23,    24,    25,   297,   577,   297,   298,   561,   577,   563,
+     339,   340,   521,   563,   299,   521,   299,   218,   563,   218,
+     563,   563,   563,   563,   563,   322,   222,   296,   563,   222,
+     296,   563,   298,   563,   563,   573,   306,   307,   308,   309,
+      44,   563,    55,    57,    58,   563,    55,    56,    57,    59,
+     563,    52,    53,   608,    44,   563,   563,   563,   563,   563,
+     563,   563,   563,   563,   563,   563,   543,   573,   563,   563,
+     210,   182,   408,   122,   173,   175,   173,   173,   271,   173,
+     174,   174,   174,   343,   425,   173,   395,   418,   343,   343,
+     343,   343,   343,   343,   343,   343,   343,   343,   343,   343,
+     343,   343,   343,   343,   343,   343,   343,   343,   343,   343,
+     343,   343,   182,   182,   342,   342,   527,    75,   182,   173,
+     182,   173,   182,   448,   512,   173,   174,   173,   182,   173,
+     182,   173,   182,   325,   333,   104,   465,   459,   563,   173,
+     104,   104,   182,   182,   182,   182,   194,   560,   560,   563,
+     563,   560,   560,   560,   560,   573,   573,   598,   573,   182,
+      75,   182,     5,   182,   560,     5,   563,   182,   510,   182,
+     509,   182,   511,   525,   342,   182,   122,   573,   573,   573,
+     122,   182,   173,   174,   182,   173,   174,   173,   174,   173,
+     174,   563,   182,   560,   563,   182,   560,   182,   560,   560,
+     560,   182,   573,   563,   563,   182,   560,   563,   563,   560,
+     563,   182,   182,     5,   462,   462,   462,   107,   609,   573,
+     182,   182,   182,   563,   563,   563,   573,   182,   182,   560,
+     182,   182,   182,   182,   182,   182,   560,   560,   182,   560,
+       5,   560,   182,   573,    22,    23,   339,   400,   426,   427,
+     428,   173,   173,   429,   430,    20,   431,   342,   258,   260,
+     297,   419,   174,   174,   174,   173,   174,    14,    15,    31,
+      32,   174,   174,   401,   182,   182,   182,   182,   182,   182,
+     182,   182,   182,   182,    31,    32,   182,   182,   182,   271,
+     527,   610,   271,   573,   573,   573,   573,   573,   573,   456,
+     173,   174,   182,   453,    73,    74,   107,   111,   118,   119,
+     120,   125,   126,   127,   128,   129,   130,   131,   132,   460,
+     468,   472,   473,   514,   515,   516,   517,   518,   573,   182,
+     182,   182,    75,   588,   588,   182,   560,   182,   560,   183,
+     588,   183,   588,   183,   183,     5,     5,   104,     5,   271,
+     272,   273,   274,   275,   564,    75,    98,    99,   113,   121,
+     304,   305,   568,   569,   573,   183,   569,   560,   271,   271,
+     271,   342,   527,   573,    74,   573,     5,     5,     5,   573,
+     588,   573,   573,   564,   573,   573,   182,   560,   215,   588,
+     182,   560,   215,   588,   270,   271,   183,   573,   573,     5,
+     182,   182,   560,   573,   183,   182,   560,   183,   588,   182,
+     564,   569,    16,    76,   118,   298,   463,   505,   506,   507,
+     508,   573,   573,   573,   310,   462,     5,   183,    45,   588,
+      45,   588,   182,   182,   182,     5,   271,   566,   566,   183,
+     566,   566,   566,   566,   183,   588,   183,   588,   573,   183,
+     569,   183,   573,     5,   400,   400,   173,   429,   429,   429,
+     431,   430,   173,   182,   173,   182,   182,   402,   588,   588,
+     588,   588,   270,   271,   270,   271,   270,   271,   270,   271,
+     270,   271,   270,   271,   271,   271,   610,     5,     5,     5,
+       5,     5,     5,    39,   319,   394,   397,   399,   457,   514,
+     515,   516,   517,   520,   573,   573,   573,    16,   105,   106,
+     394,   397,   399,   454,   467,   468,   471,   472,   473,   514,
+     515,   516,   517,   520,   573,   173,   153,   173,   108,   109,
+     110,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+     182,   182,   563,   563,     5,   573,   563,   563,     5,   566,
+     566,   215,   588,   215,   588,   569,   569,   182,   569,   573,
+     445,     4,   575,     5,   573,   575,   527,   610,     5,   173,
+       5,   569,   569,   569,     5,   573,     5,     5,   573,     5,
+       5,   270,   271,   573,   566,   270,   271,   573,   566,   573,
+     573,   573,     5,     5,   569,   564,   573,   183,     5,   573,
+     564,   183,   588,   573,   573,   588,   575,   173,   182,   182,
+     182,     5,     5,     5,   573,   569,   573,   566,   566,   566,
+     566,    45,   588,    45,   588,   182,   272,   273,   274,   565,
+     569,   573,     5,   573,   575,     5,   569,   173,   173,   569,
+     569,   569,   569,   569,   569,    42,   521,     5,     5,     5,
+     173,     5,   173,   469,   486,   486,   100,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,   449,   450,   499,
+     500,   476,   476,   480,   480,   102,   211,   212,   251,   474,
+     475,   478,   488,   484,   497,   271,   182,   182,   560,   569,
+       5,   182,   560,   182,   118,   569,   566,   566,   573,   575,
+       5,    78,   446,   567,     3,   569,     5,   610,   569,   573,
+     569,   575,   569,     5,   569,   569,     5,   569,   569,   573,
+     573,     5,   573,   573,   573,     5,   573,     5,     5,     5,
+     569,   569,   223,   583,     5,   573,   569,     5,   583,   573,
+     573,     5,     5,   271,   569,   569,   569,     5,   575,     5,
+     573,   573,   573,   573,   182,   565,   182,   565,   182,   565,
+     182,   565,   565,   573,   575,     5,   569,     5,   569,   575,
+     575,   575,   575,   575,   575,   335,   398,   173,   569,   569,
+     569,   569,   402,   403,   470,   122,   207,   210,   251,   257,
+     345,   449,   450,   487,   490,   491,   492,   493,   494,   174,
+     563,   563,   563,   563,   563,   563,   563,   563,   563,   563,
+     500,   449,   450,   477,   101,   449,   450,   481,   173,   173,
+     182,   174,   475,   449,   450,   479,   251,   345,   449,   450,
+     489,   490,   491,   494,   327,   330,   482,   483,   485,   256,
+     496,   498,   270,   271,   575,   569,   573,   183,   573,     5,
+     569,   123,   567,   315,   316,   317,   575,   569,   575,     5,
+     575,   569,   569,     5,     5,   569,     5,     5,     5,   569,
+       5,   569,   569,   569,   575,   575,   182,   573,   569,     5,
+     575,   569,   573,     5,     5,   569,   569,   575,   575,   575,
+     569,   569,     5,     5,     5,     5,   565,   573,   565,   573,
+     565,   573,   565,   573,   573,     5,   569,   575,   569,   575,
+     182,   575,   575,   575,   575,   173,   208,   209,   563,   173,
+     174,   173,   495,   182,   182,   182,   182,   182,   182,   182,
+     182,   182,   182,   122,   173,   174,   495,   173,   175,   182,
+     173,   575,     5,   573,     5,   569,   575,    75,   182,   571,
+     572,   574,   574,   574,   575,   569,   575,   575,   569,   569,
+     575,   569,   569,   569,   575,   569,   575,   575,   575,   564,
+       5,   575,   569,   575,     5,   569,   569,   575,   575,   575,
+     575,   569,   569,   569,   569,   573,     5,   573,     5,   573,
+       5,   573,     5,     5,   569,   575,   575,   274,   182,   329,
+     346,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,    22,    23,   400,   346,   569,     5,   569,   575,    75,
+       5,     5,     5,   575,   575,   575,   575,   575,   575,   575,
+     569,   575,   569,   575,   575,   575,   575,   575,   575,     5,
+     569,     5,   569,     5,   569,     5,   569,   569,   575,   400,
+     400,   173,   575,   569,   575,   568,   570,   570,   570,   575,
+     575,   569,   575,   569,   575,   569,   575,   569,   575,   575,
+     173,   173,   575,   575,   575,   575,   575
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int16 yyr1[] =
 {
-       0,   304,   305,   305,   306,   306,   307,   307,   307,   307,
-     307,   307,   307,   307,   307,   307,   307,   307,   307,   307,
-     307,   307,   307,   307,   307,   307,   307,   307,   307,   307,
-     307,   307,   307,   308,   308,   309,   309,   309,   309,   309,
-     309,   309,   309,   309,   309,   309,   309,   309,   309,   309,
-     309,   309,   309,   309,   309,   309,   309,   309,   309,   310,
-     310,   311,   311,   311,   311,   311,   311,   311,   311,   311,
-     311,   311,   311,   311,   311,   311,   311,   311,   311,   312,
-     312,   313,   313,   313,   313,   313,   313,   313,   313,   313,
-     313,   313,   313,   313,   313,   313,   313,   313,   313,   313,
-     313,   314,   314,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   316,   316,
-     317,   317,   317,   317,   317,   317,   317,   317,   317,   317,
-     317,   317,   317,   318,   318,   319,   319,   319,   319,   319,
-     319,   319,   319,   319,   319,   319,   319,   319,   319,   319,
-     320,   320,   321,   321,   321,   321,   321,   321,   321,   321,
-     321,   321,   321,   321,   321,   322,   322,   323,   323,   323,
-     323,   323,   323,   323,   323,   323,   323,   323,   323,   323,
-     323,   323,   324,   324,   325,   325,   325,   325,   325,   325,
-     325,   325,   325,   325,   325,   326,   326,   326,   327,   328,
-     329,   329,   330,   331,   331,   331,   332,   333,   334,   334,
-     335,   335,   335,   335,   335,   335,   335,   335,   335,   335,
-     335,   335,   335,   335,   336,   337,   337,   337,   338,   338,
-     338,   339,   340,   341,   342,   343,   343,   344,   345,   345,
-     346,   346,   346,   346,   346,   347,   347,   348,   349,   349,
-     350,   350,   351,   351,   351,   351,   351,   351,   351,   351,
-     351,   351,   351,   351,   352,   353,   353,   354,   354,   354,
-     355,   355,   356,   356,   357,   357,   357,   357,   357,   357,
-     357,   357,   357,   357,   357,   357,   357,   358,   359,   360,
-     361,   361,   362,   362,   363,   363,   364,   364,   364,   364,
-     364,   364,   365,   366,   366,   367,   367,   367,   367,   367,
-     367,   367,   367,   367,   368,   369,   370,   371,   372,   373,
-     373,   374,   374,   374,   374,   374,   375,   375,   376,   376,
-     377,   377,   378,   379,   379,   379,   379,   379,   379,   380,
-     379,   381,   379,   382,   379,   383,   379,   379,   384,   384,
-     385,   386,   386,   387,   387,   387,   387,   388,   389,   389,
-     390,   391,   392,   392,   393,   394,   395,   395,   396,   396,
-     397,   397,   398,   398,   399,   399,   400,   400,   401,   401,
-     402,   402,   402,   402,   403,   403,   404,   405,   405,   406,
-     407,   407,   408,   408,   408,   408,   408,   408,   408,   408,
-     408,   408,   408,   409,   410,   410,   411,   411,   411,   411,
-     411,   411,   412,   413,   413,   414,   414,   414,   414,   414,
-     415,   415,   415,   415,   416,   416,   417,   417,   417,   417,
-     418,   418,   419,   420,   421,   421,   422,   422,   422,   423,
-     423,   424,   424,   425,   426,   426,   426,   426,   426,   426,
-     426,   426,   426,   426,   426,   426,   426,   426,   426,   426,
-     426,   426,   426,   426,   426,   426,   426,   426,   426,   426,
-     426,   426,   426,   426,   426,   426,   426,   426,   426,   426,
-     426,   426,   427,   427,   428,   428,   429,   429,   429,   429,
-     430,   430,   431,   431,   432,   432,   433,   433,   434,   434,
-     435,   435,   435,   435,   435,   436,   436,   437,   438,   438,
-     439,   439,   440,   440,   441,   441,   441,   441,   441,   441,
-     441,   441,   442,   443,   443,   444,   444,   445,   446,   447,
-     447,   448,   449,   449,   450,   451,   451,   452,   452,   452,
-     452,   452,   452,   452,   452,   452,   452,   452,   452,   452,
-     453,   453,   454,   455,   456,   457,   458,   459,   460,   461,
-     461,   462,   462,   463,   463,   464,   464,   465,   465,   466,
-     467,   468,   468,   469,   470,   470,   471,   471,   471,   471,
-     472,   473,   474,   474,   475,   475,   475,   475,   475,   475,
-     475,   475,   475,   475,   475,   475,   475,   475,   475,   475,
-     475,   475,   475,   475,   475,   475,   475,   475,   475,   475,
-     475,   475,   475,   475,   476,   476,   477,   477,   478,   478,
-     478,   478,   479,   479,   479,   480,   480,   480,   481,   481,
-     481,   482,   483,   484,   484,   485,   486,   486,   487,   488,
-     488,   489,   489,   489,   489,   489,   489,   489,   490,   491,
-     491,   492,   492,   492,   492,   493,   493,   494,   495,   495,
-     495,   495,   495,   495,   495,   495,   495,   495,   496,   496,
-     497,   497,   497,   497,   498,   498,   499,   500,   501,   502,
-     502,   502,   503,   503,   504,   504,   504,   505,   505,   505,
-     506,   506,   507,   507,   507,   507,   508,   508,   509,   509,
-     509,   509,   509,   509,   509,   509,   510,   510,   510,   510,
-     510,   510,   511,   511,   511,   512,   512,   513,   513,   513,
-     514,   514,   514,   514,   514,   514,   514,   515,   516,   517,
-     518,   519,   519,   519,   520,   520,   520,   521,   521,   521,
-     521,   522,   522,   522,   523,   523,   523,   524,   524,   524,
-     524,   525,   525,   525,   525,   526,   526,   527,   527,   528,
-     528,   529,   530,   530,   530,   530,   530,   531,   531,   532,
-     532,   532,   532,   532,   532,   532,   532,   533,   533,   534,
-     534,   535,   535,   536,   536,   537,   537,   538,   538,   539,
-     539,   540,   541,   541,   542,   543,   544,   545,   545,   545,
-     545,   545,   545,   546,   546,   546,   546,   546,   546,   547,
-     548,   548,   548
+       0,   347,   348,   348,   349,   349,   350,   350,   350,   350,
+     350,   350,   350,   350,   350,   350,   350,   350,   350,   350,
+     350,   350,   350,   350,   350,   350,   350,   350,   350,   350,
+     350,   350,   350,   350,   351,   351,   352,   352,   352,   352,
+     352,   352,   352,   352,   352,   352,   352,   352,   352,   352,
+     352,   352,   352,   352,   352,   352,   352,   352,   352,   352,
+     352,   353,   353,   354,   354,   354,   354,   354,   354,   354,
+     354,   354,   354,   354,   354,   354,   354,   354,   354,   354,
+     354,   355,   355,   356,   356,   356,   356,   356,   356,   356,
+     356,   356,   356,   356,   356,   356,   356,   356,   356,   356,
+     357,   357,   358,   358,   358,   358,   358,   358,   358,   358,
+     358,   358,   358,   358,   358,   358,   358,   358,   358,   358,
+     358,   358,   358,   358,   358,   359,   359,   360,   360,   360,
+     360,   360,   360,   360,   360,   360,   360,   360,   360,   360,
+     360,   360,   360,   361,   361,   362,   362,   362,   362,   362,
+     362,   362,   362,   362,   362,   362,   362,   362,   363,   363,
+     364,   364,   364,   364,   364,   364,   364,   364,   364,   364,
+     364,   364,   364,   364,   364,   364,   365,   365,   366,   366,
+     366,   366,   366,   366,   366,   366,   366,   366,   366,   366,
+     366,   366,   367,   367,   368,   368,   368,   368,   368,   368,
+     368,   368,   368,   368,   368,   368,   368,   368,   368,   369,
+     369,   370,   370,   370,   370,   370,   370,   370,   370,   370,
+     370,   370,   371,   371,   371,   372,   373,   374,   374,   375,
+     376,   376,   376,   377,   378,   379,   379,   380,   380,   380,
+     380,   380,   380,   380,   380,   380,   380,   380,   380,   380,
+     380,   380,   380,   380,   380,   380,   380,   380,   381,   382,
+     382,   382,   383,   383,   383,   384,   385,   386,   387,   388,
+     388,   389,   390,   390,   391,   391,   391,   391,   391,   392,
+     392,   393,   394,   394,   395,   395,   396,   396,   396,   396,
+     396,   396,   396,   396,   396,   396,   396,   396,   397,   398,
+     398,   399,   399,   399,   400,   400,   401,   401,   402,   402,
+     402,   402,   402,   402,   402,   402,   402,   402,   402,   402,
+     402,   403,   404,   405,   406,   406,   407,   407,   408,   408,
+     409,   409,   409,   409,   409,   409,   410,   411,   411,   412,
+     412,   412,   412,   412,   412,   412,   412,   412,   413,   414,
+     415,   416,   417,   418,   418,   419,   419,   419,   419,   419,
+     420,   420,   421,   421,   422,   422,   423,   424,   424,   424,
+     424,   424,   424,   425,   424,   426,   424,   427,   424,   428,
+     424,   424,   429,   429,   430,   431,   431,   432,   432,   432,
+     432,   433,   434,   435,   435,   436,   437,   438,   438,   439,
+     440,   441,   441,   442,   442,   443,   443,   444,   444,   445,
+     445,   446,   446,   447,   447,   448,   448,   448,   448,   449,
+     449,   450,   451,   451,   452,   453,   453,   454,   454,   454,
+     454,   454,   454,   454,   454,   454,   454,   454,   454,   454,
+     455,   456,   456,   457,   457,   457,   457,   457,   457,   457,
+     457,   458,   459,   459,   460,   460,   460,   460,   460,   460,
+     460,   461,   461,   461,   461,   462,   462,   463,   463,   463,
+     463,   464,   464,   465,   466,   467,   467,   468,   468,   468,
+     469,   469,   470,   470,   471,   472,   472,   472,   472,   472,
+     472,   472,   472,   472,   472,   472,   472,   472,   472,   472,
+     472,   472,   472,   472,   472,   472,   472,   472,   472,   472,
+     472,   472,   472,   472,   472,   472,   472,   472,   472,   472,
+     472,   472,   472,   472,   473,   473,   473,   474,   474,   475,
+     475,   475,   475,   476,   476,   477,   477,   478,   478,   479,
+     479,   480,   480,   481,   481,   481,   481,   481,   482,   482,
+     483,   484,   484,   485,   485,   486,   486,   487,   487,   487,
+     487,   487,   487,   487,   487,   488,   488,   489,   489,   489,
+     489,   489,   489,   489,   489,   490,   491,   491,   492,   492,
+     493,   494,   495,   495,   496,   497,   497,   498,   499,   499,
+     500,   500,   500,   500,   500,   500,   500,   500,   500,   500,
+     500,   500,   500,   501,   501,   502,   503,   504,   505,   506,
+     507,   508,   509,   509,   510,   510,   511,   511,   512,   512,
+     513,   513,   514,   515,   516,   517,   517,   517,   518,   518,
+     518,   518,   518,   518,   518,   519,   519,   520,   521,   521,
+     522,   522,   522,   522,   523,   524,   525,   525,   526,   526,
+     526,   526,   526,   526,   526,   526,   526,   526,   526,   526,
+     526,   526,   526,   526,   526,   526,   526,   526,   526,   526,
+     526,   526,   526,   526,   526,   526,   526,   526,   527,   527,
+     528,   528,   529,   529,   529,   529,   530,   530,   530,   531,
+     531,   531,   532,   532,   532,   533,   534,   535,   535,   536,
+     537,   537,   538,   539,   539,   540,   540,   540,   540,   540,
+     540,   540,   541,   542,   542,   543,   543,   543,   543,   543,
+     544,   545,   545,   545,   546,   546,   547,   548,   548,   548,
+     548,   548,   548,   548,   548,   548,   548,   549,   549,   550,
+     550,   550,   550,   551,   551,   552,   552,   552,   552,   552,
+     552,   552,   552,   553,   554,   555,   556,   556,   556,   557,
+     557,   558,   558,   558,   559,   559,   559,   560,   560,   561,
+     561,   561,   561,   562,   562,   563,   563,   563,   563,   563,
+     563,   563,   563,   564,   564,   564,   564,   564,   564,   565,
+     565,   565,   566,   566,   567,   567,   567,   568,   568,   568,
+     568,   568,   568,   568,   569,   570,   571,   572,   573,   573,
+     573,   574,   574,   574,   575,   575,   575,   575,   576,   576,
+     576,   577,   577,   577,   577,   577,   578,   578,   578,   578,
+     578,   579,   579,   579,   579,   579,   580,   580,   580,   580,
+     581,   581,   581,   581,   582,   582,   583,   583,   584,   585,
+     586,   587,   588,   588,   588,   588,   588,   589,   589,   590,
+     590,   590,   590,   590,   590,   590,   590,   591,   591,   592,
+     592,   593,   593,   594,   594,   595,   595,   596,   596,   597,
+     597,   597,   597,   598,   598,   599,   599,   600,   601,   601,
+     602,   603,   604,   605,   605,   605,   605,   605,   605,   606,
+     606,   606,   606,   606,   606,   607,   607,   607,   608,   608,
+     608,   608,   608,   608,   608,   608,   608,   609,   610,   610,
+     610
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr2[] =
 {
        0,     2,     0,     1,     1,     2,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     0,     2,     1,     1,     1,     1,     1,
+       2,     2,     2,     2,     0,     2,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     0,     2,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     0,     2,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     0,     2,     1,     1,     1,     1,     1,
+       1,     0,     2,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        0,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     0,     2,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     0,     2,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     2,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     2,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     0,     2,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     4,     7,     8,     4,     3,
-       0,     3,     2,     3,     3,     3,     4,     5,     0,     2,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     2,     3,     3,     5,     4,     6,
-       4,     3,     3,     3,     3,     2,     3,     2,     0,     2,
-       3,     1,     1,     1,     1,     0,     2,     5,     1,     4,
-       0,     2,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     5,     0,     1,     4,     5,     5,
-       0,     1,     0,     2,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     2,     5,     5,
-       1,     2,     2,     4,     0,     2,     1,     1,     1,     1,
-       1,     1,     3,     0,     2,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     2,     2,     1,     2,     3,     0,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       1,     1,     2,     5,     4,     2,     3,     3,     3,     0,
-       4,     0,     5,     0,     5,     0,     5,     2,     1,     2,
-       1,     0,     1,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     2,     4,     5,     6,     3,     4,
-       3,     4,     3,     4,     1,     2,     1,     2,     1,     1,
-       2,     2,     2,     2,     2,     2,     2,     0,     2,     9,
-       0,     2,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     9,     0,     2,     1,     1,     1,     1,
-       1,     1,     8,     0,     2,     1,     1,     1,     1,     1,
-       9,     8,     8,     8,     0,     2,     1,     1,     1,     1,
-       0,     2,     2,     2,     1,     1,     2,     3,     2,     0,
-       2,     1,     1,     2,     3,     2,     2,     2,     2,     2,
-       3,     3,     2,     2,     2,     2,     2,     2,     3,     3,
-       3,     3,     2,     2,     2,     2,     2,     2,     3,     3,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     3,
-       2,     3,     2,     2,     1,     2,     2,     2,     2,     2,
-       0,     2,     1,     1,     0,     2,     1,     1,     0,     2,
-       1,     1,     4,     5,     5,     2,     2,     2,     0,     2,
-       1,     1,     0,     2,     1,     1,     1,     1,     1,     1,
-       1,     3,     3,     2,     2,     2,     2,     2,     2,     0,
-       2,     2,     0,     2,     1,     1,     2,     1,     1,     2,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     4,     7,     8,     4,     3,     0,     3,     2,
+       3,     3,     3,     4,     5,     0,     2,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       7,     6,     6,     6,     9,     2,     2,     3,     2,     0,
-       3,     0,     3,     0,     3,     0,     3,     0,     3,     3,
-       2,     7,     7,     3,     1,     1,     3,     6,     7,     1,
-       2,     2,     1,     2,     1,     1,     1,     1,     1,     1,
+       4,     3,     3,     3,     4,     4,     4,     4,     2,     3,
+       3,     5,     4,     6,     4,     3,     3,     3,     3,     2,
+       3,     2,     0,     2,     3,     1,     1,     1,     1,     0,
+       2,     5,     1,     4,     0,     2,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     5,     0,
+       1,     4,     5,     5,     0,     1,     0,     2,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     2,     5,     5,     1,     2,     2,     4,     0,     2,
+       1,     1,     1,     1,     1,     1,     3,     0,     2,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
+       1,     2,     3,     0,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     1,     1,     2,     5,     4,     2,
+       3,     3,     3,     0,     4,     0,     5,     0,     5,     0,
+       5,     2,     1,     2,     1,     0,     1,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     2,
+       4,     5,     6,     3,     4,     3,     4,     3,     4,     1,
+       2,     1,     2,     1,     1,     2,     2,     2,     2,     2,
+       2,     2,     0,     2,     9,     0,     2,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       9,     0,     2,     1,     1,     1,     1,     1,     1,     1,
+       1,     8,     0,     2,     1,     1,     1,     1,     1,     1,
+       1,     9,     8,     8,     8,     0,     2,     1,     1,     1,
+       1,     0,     2,     2,     2,     1,     1,     2,     3,     2,
+       0,     2,     1,     1,     2,     3,     2,     2,     2,     2,
+       2,     3,     3,     3,     2,     2,     2,     2,     2,     2,
+       3,     3,     3,     3,     2,     2,     2,     2,     2,     2,
+       3,     3,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     3,     2,     3,     2,     2,     3,     1,     2,     2,
+       2,     2,     2,     0,     2,     1,     1,     0,     2,     1,
+       1,     0,     2,     1,     1,     4,     5,     5,     2,     2,
+       2,     0,     2,     1,     1,     0,     2,     1,     1,     1,
+       1,     1,     1,     1,     3,     0,     2,     1,     1,     2,
+       2,     1,     1,     1,     3,     3,     2,     2,     2,     2,
+       2,     2,     0,     2,     2,     0,     2,     1,     1,     2,
+       1,     1,     2,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     7,     6,     6,     6,     9,     2,     2,
+       3,     2,     0,     3,     0,     3,     0,     3,     0,     3,
+       0,     3,     3,     2,     1,     4,     4,     3,     1,     1,
+       1,     1,     1,     1,     1,     7,     7,     3,     1,     1,
+       3,     6,     7,     1,     2,     2,     1,     2,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     4,     1,     2,     2,     2,
-       1,     1,     3,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     1,     2,     1,     8,     6,     6,     1,
-       2,     1,     1,     1,     1,     1,     1,     1,     6,     1,
-       2,     1,     1,     1,     1,     4,     4,     4,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     4,     4,
-       4,     4,     4,     4,     4,     4,     3,     3,     4,     1,
-       1,     1,     0,     1,     5,     6,     5,     5,     6,     5,
-       1,     1,     1,     1,     1,     1,     9,     6,     0,     1,
-       1,     1,     1,     1,     1,     1,     0,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     1,     0,     3,     4,
-       1,     3,     4,     1,     1,     1,     1,     1,     1,     2,
-       3,     0,     1,     1,     0,     1,     1,     0,     6,     6,
-       6,     8,    10,     7,     0,     1,     1,     8,     9,     9,
-      10,     9,     9,    10,    10,    10,     9,    10,     9,     9,
-       9,     6,     0,     1,     1,     1,     1,     8,     7,     7,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       1,     2,     2,     2,     1,     1,     3,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     1,     2,     1,
+       8,     6,     6,     1,     2,     1,     1,     1,     1,     1,
+       1,     1,     6,     1,     2,     1,     1,     1,     1,     1,
+       6,     3,     5,     4,     4,     4,     4,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     3,     3,     3,     3,     4,     1,     1,     1,     0,
+       1,     5,     6,     5,     5,     6,     5,     1,     1,     1,
+       1,     1,     1,     9,     6,     0,     1,     1,     1,     1,
+       1,     1,     1,     0,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     1,     0,     3,     4,     1,     3,     4,
+       1,     1,     1,     1,     1,     1,     2,     3,     0,     1,
+       1,     0,     1,     1,     0,     6,     6,     6,     8,    10,
+       7,     0,     1,     1,     1,     1,     8,     9,     9,    10,
+      11,    11,     9,     9,    10,    10,    10,     9,    10,    10,
+      10,     9,    10,    10,     9,     9,     0,     3,     9,     8,
+       8,     6,     0,     1,     1,     1,     1,     8,     7,     7,
        7,     4,     4,     7,     7,     4,     4,     0,     1,     9,
-       6,     8,     8,     8,     8,     9,     9,     8,     9,     8,
-       9,     9,     8,     8,     7,     7,     9,    10,    11,    12,
-      10,    11,    12,    10,    11,    12,    10,    11,    12,     2,
-       0,     2,     3
+       6,     8,     8,     8,     8,     9,     9,     8,     9,    10,
+      11,    12,    11,     0,     2,     8,     9,     9,     8,     8,
+       7,     7,     9,    10,    11,    12,    10,    11,    12,    10,
+      11,    12,    10,    11,    12,     9,    10,    11,     2,     2,
+       2,     2,     2,     2,     1,     2,     1,     2,     0,     2,
+       3
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
@@ -2786,10 +2999,9 @@ static const yytype_int8 yyr2[] =
       }                                                           \
   while (0)
 
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -2806,19 +3018,16 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value); \
+                  Kind, Value); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -2829,18 +3038,15 @@ do {                                                                      \
 `-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
   FILE *yyoutput = yyo;
-  YYUSE (yyoutput);
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyo, yytoknum[yytype], *yyvaluep);
-# endif
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
@@ -2850,12 +3056,13 @@ yy_symbol_value_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep)
 `---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyo, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
   YYFPRINTF (yyo, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyo, yytype, yyvaluep);
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
   YYFPRINTF (yyo, ")");
 }
 
@@ -2888,7 +3095,8 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
   int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
@@ -2900,9 +3108,8 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, int yyrule)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[+yyssp[yyi + 1 - yynrhs]],
-                       &yyvsp[(yyi + 1) - (yynrhs)]
-                                              );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -2917,8 +3124,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -2941,259 +3148,30 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
-#  else
-/* Return the length of YYSTR.  */
-static YYPTRDIFF_T
-yystrlen (const char *yystr)
-{
-  YYPTRDIFF_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYPTRDIFF_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYPTRDIFF_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            else
-              goto append;
-
-          append:
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (yyres)
-    return yystpcpy (yyres, yystr) - yyres;
-  else
-    return yystrlen (yystr);
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
-                yy_state_t *yyssp, int yytoken)
-{
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat: reported tokens (one for the "unexpected",
-     one per "expected"). */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Actual size of YYARG. */
-  int yycount = 0;
-  /* Cumulated lengths of YYARG.  */
-  YYPTRDIFF_T yysize = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[+*yyssp];
-      YYPTRDIFF_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-      yysize = yysize0;
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYPTRDIFF_T yysize1
-                    = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-                    yysize = yysize1;
-                  else
-                    return 2;
-                }
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-    default: /* Avoid compiler warnings. */
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  {
-    /* Don't count the "%s"s in the final size, but reserve room for
-       the terminator.  */
-    YYPTRDIFF_T yysize1 = yysize + (yystrlen (yyformat) - 2 * yycount) + 1;
-    if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-      yysize = yysize1;
-    else
-      return 2;
-  }
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          ++yyp;
-          ++yyformat;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -3202,6 +3180,8 @@ YYSTYPE yylval;
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -3209,43 +3189,36 @@ int yynerrs;
 int
 yyparse (void)
 {
-    yy_state_fast_t yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
     yy_state_t yyssa[YYINITDEPTH];
-    yy_state_t *yyss;
-    yy_state_t *yyssp;
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    /* The semantic value stack.  */
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
-
-    YYPTRDIFF_T yystacksize;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -3253,16 +3226,10 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
 
@@ -3284,10 +3251,11 @@ yysetstate:
   YY_IGNORE_USELESS_CAST_BEGIN
   *yyssp = YY_CAST (yy_state_t, yystate);
   YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
 #if !defined yyoverflow && !defined YYSTACK_RELOCATE
-    goto yyexhaustedlab;
+    YYNOMEM;
 #else
     {
       /* Get the current used size of the three stacks, in elements.  */
@@ -3315,7 +3283,7 @@ yysetstate:
 # else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
@@ -3326,10 +3294,10 @@ yysetstate:
           YY_CAST (union yyalloc *,
                    YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
-# undef YYSTACK_RELOCATE
+#  undef YYSTACK_RELOCATE
         if (yyss1 != yyssa)
           YYSTACK_FREE (yyss1);
       }
@@ -3348,6 +3316,7 @@ yysetstate:
     }
 #endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
+
   if (yystate == YYFINAL)
     YYACCEPT;
 
@@ -3368,18 +3337,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -3448,34 +3428,34 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-  case 195:
-#line 611 "src/p.y"
+  case 222: /* setalert: SET alertmail formatlist reminder  */
+#line 656 "src/p.y"
                                                     {
                         mailset.events = Event_All;
                         addmail((yyvsp[-2].string), &mailset, &Run.maillist);
                   }
-#line 3458 "src/y.tab.c"
+#line 3438 "src/y.tab.c"
     break;
 
-  case 196:
-#line 615 "src/p.y"
+  case 223: /* setalert: SET alertmail '{' eventoptionlist '}' formatlist reminder  */
+#line 660 "src/p.y"
                                                                             {
                         addmail((yyvsp[-5].string), &mailset, &Run.maillist);
                   }
-#line 3466 "src/y.tab.c"
+#line 3446 "src/y.tab.c"
     break;
 
-  case 197:
-#line 618 "src/p.y"
+  case 224: /* setalert: SET alertmail NOT '{' eventoptionlist '}' formatlist reminder  */
+#line 663 "src/p.y"
                                                                                 {
                         mailset.events = ~mailset.events;
                         addmail((yyvsp[-6].string), &mailset, &Run.maillist);
                   }
-#line 3475 "src/y.tab.c"
+#line 3455 "src/y.tab.c"
     break;
 
-  case 198:
-#line 624 "src/p.y"
+  case 225: /* setdaemon: SET DAEMON NUMBER startdelay  */
+#line 669 "src/p.y"
                                                {
                         if (! (Run.flags & Run_Daemon) || ihp.daemon) {
                                 ihp.daemon     = true;
@@ -3484,196 +3464,255 @@ yyreduce:
                                 Run.startdelay = (yyvsp[0].number);
                         }
                   }
-#line 3488 "src/y.tab.c"
+#line 3468 "src/y.tab.c"
     break;
 
-  case 199:
-#line 634 "src/p.y"
+  case 226: /* setterminal: SET TERMINAL BATCH  */
+#line 679 "src/p.y"
                                      {
                         Run.flags |= Run_Batch;
                   }
-#line 3496 "src/y.tab.c"
+#line 3476 "src/y.tab.c"
     break;
 
-  case 200:
-#line 639 "src/p.y"
+  case 227: /* startdelay: %empty  */
+#line 684 "src/p.y"
                               {
                         (yyval.number) = 0;
                   }
-#line 3504 "src/y.tab.c"
+#line 3484 "src/y.tab.c"
     break;
 
-  case 201:
-#line 642 "src/p.y"
+  case 228: /* startdelay: START DELAY NUMBER  */
+#line 687 "src/p.y"
                                      {
                         (yyval.number) = (yyvsp[0].number);
                   }
-#line 3512 "src/y.tab.c"
+#line 3492 "src/y.tab.c"
     break;
 
-  case 202:
-#line 647 "src/p.y"
+  case 229: /* setinit: SET INIT  */
+#line 692 "src/p.y"
                            {
                         Run.flags |= Run_Foreground;
                   }
-#line 3520 "src/y.tab.c"
+#line 3500 "src/y.tab.c"
     break;
 
-  case 203:
-#line 652 "src/p.y"
+  case 230: /* setonreboot: SET ONREBOOT START  */
+#line 697 "src/p.y"
                                      {
                         Run.onreboot = Onreboot_Start;
                   }
-#line 3528 "src/y.tab.c"
+#line 3508 "src/y.tab.c"
     break;
 
-  case 204:
-#line 655 "src/p.y"
+  case 231: /* setonreboot: SET ONREBOOT NOSTART  */
+#line 700 "src/p.y"
                                        {
                         Run.onreboot = Onreboot_Nostart;
                   }
-#line 3536 "src/y.tab.c"
+#line 3516 "src/y.tab.c"
     break;
 
-  case 205:
-#line 658 "src/p.y"
+  case 232: /* setonreboot: SET ONREBOOT LASTSTATE  */
+#line 703 "src/p.y"
                                          {
                         Run.onreboot = Onreboot_Laststate;
                   }
-#line 3544 "src/y.tab.c"
+#line 3524 "src/y.tab.c"
     break;
 
-  case 206:
-#line 663 "src/p.y"
+  case 233: /* setexpectbuffer: SET EXPECTBUFFER NUMBER unit  */
+#line 708 "src/p.y"
                                                {
                         // Note: deprecated (replaced by "set limits" statement's "sendExpectBuffer" option)
                         Run.limits.sendExpectBuffer = (yyvsp[-1].number) * (yyvsp[0].number);
                   }
-#line 3553 "src/y.tab.c"
+#line 3533 "src/y.tab.c"
     break;
 
-  case 210:
-#line 676 "src/p.y"
+  case 237: /* limit: SENDEXPECTBUFFER ':' NUMBER unit  */
+#line 721 "src/p.y"
                                                    {
                         Run.limits.sendExpectBuffer = (yyvsp[-1].number) * (yyvsp[0].number);
                   }
-#line 3561 "src/y.tab.c"
+#line 3541 "src/y.tab.c"
     break;
 
-  case 211:
-#line 679 "src/p.y"
+  case 238: /* limit: FILECONTENTBUFFER ':' NUMBER unit  */
+#line 724 "src/p.y"
                                                     {
                         Run.limits.fileContentBuffer = (yyvsp[-1].number) * (yyvsp[0].number);
                   }
-#line 3569 "src/y.tab.c"
+#line 3549 "src/y.tab.c"
     break;
 
-  case 212:
-#line 682 "src/p.y"
+  case 239: /* limit: HTTPCONTENTBUFFER ':' NUMBER unit  */
+#line 727 "src/p.y"
                                                     {
                         Run.limits.httpContentBuffer = (yyvsp[-1].number) * (yyvsp[0].number);
                   }
-#line 3577 "src/y.tab.c"
+#line 3557 "src/y.tab.c"
     break;
 
-  case 213:
-#line 685 "src/p.y"
+  case 240: /* limit: PROGRAMOUTPUT ':' NUMBER unit  */
+#line 730 "src/p.y"
                                                 {
                         Run.limits.programOutput = (yyvsp[-1].number) * (yyvsp[0].number);
                   }
-#line 3585 "src/y.tab.c"
+#line 3565 "src/y.tab.c"
     break;
 
-  case 214:
-#line 688 "src/p.y"
+  case 241: /* limit: NETWORKTIMEOUT ':' NUMBER MILLISECOND  */
+#line 733 "src/p.y"
                                                         {
                         Run.limits.networkTimeout = (yyvsp[-1].number);
                   }
-#line 3593 "src/y.tab.c"
+#line 3573 "src/y.tab.c"
     break;
 
-  case 215:
-#line 691 "src/p.y"
+  case 242: /* limit: NETWORKTIMEOUT ':' NUMBER SECOND  */
+#line 736 "src/p.y"
                                                    {
                         Run.limits.networkTimeout = (yyvsp[-1].number) * 1000;
                   }
-#line 3601 "src/y.tab.c"
+#line 3581 "src/y.tab.c"
     break;
 
-  case 216:
-#line 694 "src/p.y"
+  case 243: /* limit: PROGRAMTIMEOUT ':' NUMBER MILLISECOND  */
+#line 739 "src/p.y"
                                                         {
                         Run.limits.programTimeout = (yyvsp[-1].number);
                   }
-#line 3609 "src/y.tab.c"
+#line 3589 "src/y.tab.c"
     break;
 
-  case 217:
-#line 697 "src/p.y"
+  case 244: /* limit: PROGRAMTIMEOUT ':' NUMBER SECOND  */
+#line 742 "src/p.y"
                                                    {
                         Run.limits.programTimeout = (yyvsp[-1].number) * 1000;
                   }
-#line 3617 "src/y.tab.c"
+#line 3597 "src/y.tab.c"
     break;
 
-  case 218:
-#line 700 "src/p.y"
+  case 245: /* limit: STOPTIMEOUT ':' NUMBER MILLISECOND  */
+#line 745 "src/p.y"
                                                      {
                         Run.limits.stopTimeout = (yyvsp[-1].number);
                   }
-#line 3625 "src/y.tab.c"
+#line 3605 "src/y.tab.c"
     break;
 
-  case 219:
-#line 703 "src/p.y"
+  case 246: /* limit: STOPTIMEOUT ':' NUMBER SECOND  */
+#line 748 "src/p.y"
                                                 {
                         Run.limits.stopTimeout = (yyvsp[-1].number) * 1000;
                   }
-#line 3633 "src/y.tab.c"
+#line 3613 "src/y.tab.c"
     break;
 
-  case 220:
-#line 706 "src/p.y"
+  case 247: /* limit: STARTTIMEOUT ':' NUMBER MILLISECOND  */
+#line 751 "src/p.y"
                                                       {
                         Run.limits.startTimeout = (yyvsp[-1].number);
                   }
-#line 3641 "src/y.tab.c"
+#line 3621 "src/y.tab.c"
     break;
 
-  case 221:
-#line 709 "src/p.y"
+  case 248: /* limit: STARTTIMEOUT ':' NUMBER SECOND  */
+#line 754 "src/p.y"
                                                  {
                         Run.limits.startTimeout = (yyvsp[-1].number) * 1000;
                   }
-#line 3649 "src/y.tab.c"
+#line 3629 "src/y.tab.c"
     break;
 
-  case 222:
-#line 712 "src/p.y"
+  case 249: /* limit: RESTARTTIMEOUT ':' NUMBER MILLISECOND  */
+#line 757 "src/p.y"
                                                         {
                         Run.limits.restartTimeout = (yyvsp[-1].number);
                   }
-#line 3657 "src/y.tab.c"
+#line 3637 "src/y.tab.c"
     break;
 
-  case 223:
-#line 715 "src/p.y"
+  case 250: /* limit: RESTARTTIMEOUT ':' NUMBER SECOND  */
+#line 760 "src/p.y"
                                                    {
                         Run.limits.restartTimeout = (yyvsp[-1].number) * 1000;
                   }
-#line 3665 "src/y.tab.c"
+#line 3645 "src/y.tab.c"
+    break;
+
+  case 251: /* limit: CHECKSUMWORKERS ':' NUMBER  */
+#line 763 "src/p.y"
+                                             {
+                        if ((yyvsp[0].number) > 64)
+                                yyerror2("The number of checksum workers must be between 0 and 64");
+                        else
+                                Run.limits.checksumWorkers = (yyvsp[0].number);
+                  }
+#line 3656 "src/y.tab.c"
+    break;
+
+  case 252: /* limit: CHECKSUMIDLEIO ':' ENABLE  */
+#line 769 "src/p.y"
+                                            {
+                        Run.limits.checksumIdleIO = true;
+                  }
+#line 3664 "src/y.tab.c"
+    break;
+
+  case 253: /* limit: CHECKSUMIDLEIO ':' DISABLE  */
+#line 772 "src/p.y"
+                                             {
+                        Run.limits.checksumIdleIO = false;
+                  }
+#line 3672 "src/y.tab.c"
+    break;
+
+  case 254: /* limit: FILESYSTEMTIMEOUT ':' NUMBER MILLISECOND  */
+#line 775 "src/p.y"
+                                                           {
+                        Run.limits.filesystemTimeout = (yyvsp[-1].number);
+                  }
+#line 3680 "src/y.tab.c"
+    break;
+
+  case 255: /* limit: FILESYSTEMTIMEOUT ':' NUMBER SECOND  */
+#line 778 "src/p.y"
+                                                      {
+                        Run.limits.filesystemTimeout = (yyvsp[-1].number) * 1000;
+                  }
+#line 3688 "src/y.tab.c"
+    break;
+
+  case 256: /* limit: DNSTTL ':' NUMBER SECOND  */
+#line 781 "src/p.y"
+                                           {
+                        Run.limits.dnsTtl = (yyvsp[-1].number);
+                  }
+#line 3696 "src/y.tab.c"
+    break;
+
+  case 257: /* limit: DNSNEGATIVETTL ':' NUMBER SECOND  */
+#line 784 "src/p.y"
+                                                   {
+                        Run.limits.dnsNegativeTtl = (yyvsp[-1].number);
+                  }
+#line 3704 "src/y.tab.c"
     break;
 
-  case 224:
-#line 720 "src/p.y"
+  case 258: /* setfips: SET FIPS  */
+#line 789 "src/p.y"
                            {
                         Run.flags |= Run_FipsEnabled;
                   }
-#line 3673 "src/y.tab.c"
+#line 3712 "src/y.tab.c"
     break;
 
-  case 225:
-#line 725 "src/p.y"
+  case 259: /* setlog: SET LOGFILE PATH  */
+#line 794 "src/p.y"
                                      {
                         if (! Run.files.log || ihp.logfile) {
                                 ihp.logfile = true;
@@ -3682,231 +3721,231 @@ yyreduce:
                                 Run.flags |= Run_Log;
                         }
                   }
-#line 3686 "src/y.tab.c"
+#line 3725 "src/y.tab.c"
     break;
 
-  case 226:
-#line 733 "src/p.y"
+  case 260: /* setlog: SET LOGFILE SYSLOG  */
+#line 802 "src/p.y"
                                      {
                         setsyslog(NULL);
                   }
-#line 3694 "src/y.tab.c"
+#line 3733 "src/y.tab.c"
     break;
 
-  case 227:
-#line 736 "src/p.y"
+  case 261: /* setlog: SET LOGFILE SYSLOG FACILITY STRING  */
+#line 805 "src/p.y"
                                                      {
                         setsyslog((yyvsp[0].string)); FREE((yyvsp[0].string));
                   }
-#line 3702 "src/y.tab.c"
+#line 3741 "src/y.tab.c"
     break;
 
-  case 228:
-#line 741 "src/p.y"
+  case 262: /* seteventqueue: SET EVENTQUEUE BASEDIR PATH  */
+#line 810 "src/p.y"
                                               {
                         Run.eventlist_dir = (yyvsp[0].string);
                   }
-#line 3710 "src/y.tab.c"
+#line 3749 "src/y.tab.c"
     break;
 
-  case 229:
-#line 744 "src/p.y"
+  case 263: /* seteventqueue: SET EVENTQUEUE BASEDIR PATH SLOT NUMBER  */
+#line 813 "src/p.y"
                                                           {
                         Run.eventlist_dir = (yyvsp[-2].string);
                         Run.eventlist_slots = (yyvsp[0].number);
                   }
-#line 3719 "src/y.tab.c"
+#line 3758 "src/y.tab.c"
     break;
 
-  case 230:
-#line 748 "src/p.y"
+  case 264: /* seteventqueue: SET EVENTQUEUE SLOT NUMBER  */
+#line 817 "src/p.y"
                                              {
                         Run.eventlist_dir = Str_dup(MYEVENTLISTBASE);
                         Run.eventlist_slots = (yyvsp[0].number);
                   }
-#line 3728 "src/y.tab.c"
+#line 3767 "src/y.tab.c"
     break;
 
-  case 231:
-#line 754 "src/p.y"
+  case 265: /* setidfile: SET IDFILE PATH  */
+#line 823 "src/p.y"
                                   {
                         Run.files.id = (yyvsp[0].string);
                   }
-#line 3736 "src/y.tab.c"
+#line 3775 "src/y.tab.c"
     break;
 
-  case 232:
-#line 759 "src/p.y"
+  case 266: /* setstatefile: SET STATEFILE PATH  */
+#line 828 "src/p.y"
                                      {
                         Run.files.state = (yyvsp[0].string);
                   }
-#line 3744 "src/y.tab.c"
+#line 3783 "src/y.tab.c"
     break;
 
-  case 233:
-#line 764 "src/p.y"
+  case 267: /* setpid: SET PIDFILE PATH  */
+#line 833 "src/p.y"
                                    {
                         if (! Run.files.pid || ihp.pidfile) {
                                 ihp.pidfile = true;
                                 setpidfile((yyvsp[0].string));
                         }
                   }
-#line 3755 "src/y.tab.c"
+#line 3794 "src/y.tab.c"
     break;
 
-  case 237:
-#line 779 "src/p.y"
+  case 271: /* mmonit: URLOBJECT mmonitoptlist  */
+#line 848 "src/p.y"
                                           {
                         mmonitset.url = (yyvsp[-1].url);
                         addmmonit(&mmonitset);
                   }
-#line 3764 "src/y.tab.c"
+#line 3803 "src/y.tab.c"
     break;
 
-  case 240:
-#line 789 "src/p.y"
+  case 274: /* mmonitopt: TIMEOUT NUMBER SECOND  */
+#line 858 "src/p.y"
                                         {
                         mmonitset.timeout = (yyvsp[-1].number) * 1000; // net timeout is in milliseconds internally
                   }
-#line 3772 "src/y.tab.c"
+#line 3811 "src/y.tab.c"
     break;
 
-  case 246:
-#line 799 "src/p.y"
+  case 280: /* credentials: REGISTER CREDENTIALS  */
+#line 868 "src/p.y"
                                        {
                         Run.flags &= ~Run_MmonitCredentials;
                   }
-#line 3780 "src/y.tab.c"
+#line 3819 "src/y.tab.c"
     break;
 
-  case 247:
-#line 804 "src/p.y"
+  case 281: /* setssl: SET SSLTOKEN '{' ssloptionlist '}'  */
+#line 873 "src/p.y"
                                                      {
                         _setSSLOptions(&(Run.ssl));
                   }
-#line 3788 "src/y.tab.c"
+#line 3827 "src/y.tab.c"
     break;
 
-  case 248:
-#line 809 "src/p.y"
+  case 282: /* ssl: SSLTOKEN  */
+#line 878 "src/p.y"
                            {
                         sslset.flags = SSL_Enabled;
                   }
-#line 3796 "src/y.tab.c"
+#line 3835 "src/y.tab.c"
     break;
 
-  case 252:
-#line 819 "src/p.y"
+  case 286: /* ssloption: VERIFY ':' ENABLE  */
+#line 888 "src/p.y"
                                     {
                         sslset.flags = SSL_Enabled;
                         sslset.verify = true;
                   }
-#line 3805 "src/y.tab.c"
+#line 3844 "src/y.tab.c"
     break;
 
-  case 253:
-#line 823 "src/p.y"
+  case 287: /* ssloption: VERIFY ':' DISABLE  */
+#line 892 "src/p.y"
                                      {
                         sslset.flags = SSL_Enabled;
                         sslset.verify = false;
                   }
-#line 3814 "src/y.tab.c"
+#line 3853 "src/y.tab.c"
     break;
 
-  case 254:
-#line 827 "src/p.y"
+  case 288: /* ssloption: SELFSIGNED ':' ALLOW  */
+#line 896 "src/p.y"
                                        {
                         sslset.flags = SSL_Enabled;
                         sslset.allowSelfSigned = true;
                   }
-#line 3823 "src/y.tab.c"
+#line 3862 "src/y.tab.c"
     break;
 
-  case 255:
-#line 831 "src/p.y"
+  case 289: /* ssloption: SELFSIGNED ':' REJECTOPT  */
+#line 900 "src/p.y"
                                            {
                         sslset.flags = SSL_Enabled;
                         sslset.allowSelfSigned = false;
                   }
-#line 3832 "src/y.tab.c"
+#line 3871 "src/y.tab.c"
     break;
 
-  case 256:
-#line 835 "src/p.y"
+  case 290: /* ssloption: VERSIONOPT ':' sslversionlist  */
+#line 904 "src/p.y"
                                                 {
                         sslset.flags = SSL_Enabled;
                   }
-#line 3840 "src/y.tab.c"
+#line 3879 "src/y.tab.c"
     break;
 
-  case 257:
-#line 838 "src/p.y"
+  case 291: /* ssloption: CIPHER ':' STRING  */
+#line 907 "src/p.y"
                                     {
                         FREE(sslset.ciphers);
                         sslset.ciphers = (yyvsp[0].string);
                   }
-#line 3849 "src/y.tab.c"
+#line 3888 "src/y.tab.c"
     break;
 
-  case 258:
-#line 842 "src/p.y"
+  case 292: /* ssloption: PEMFILE ':' PATH  */
+#line 911 "src/p.y"
                                    {
                         _setPEM(&(sslset.pemfile), (yyvsp[0].string), "SSL server PEM file", true);
                   }
-#line 3857 "src/y.tab.c"
+#line 3896 "src/y.tab.c"
     break;
 
-  case 259:
-#line 845 "src/p.y"
+  case 293: /* ssloption: PEMCHAIN ':' PATH  */
+#line 914 "src/p.y"
                                     {
                         _setPEM(&(sslset.pemchain), (yyvsp[0].string), "SSL certificate chain PEM file", true);
                   }
-#line 3865 "src/y.tab.c"
+#line 3904 "src/y.tab.c"
     break;
 
-  case 260:
-#line 848 "src/p.y"
+  case 294: /* ssloption: PEMKEY ':' PATH  */
+#line 917 "src/p.y"
                                   {
                         _setPEM(&(sslset.pemkey), (yyvsp[0].string), "SSL server private key PEM file", true);
                   }
-#line 3873 "src/y.tab.c"
+#line 3912 "src/y.tab.c"
     break;
 
-  case 261:
-#line 851 "src/p.y"
+  case 295: /* ssloption: CLIENTPEMFILE ':' PATH  */
+#line 920 "src/p.y"
                                          {
                         _setPEM(&(sslset.clientpemfile), (yyvsp[0].string), "SSL client PEM file", true);
                   }
-#line 3881 "src/y.tab.c"
+#line 3920 "src/y.tab.c"
     break;
 
-  case 262:
-#line 854 "src/p.y"
+  case 296: /* ssloption: CACERTIFICATEFILE ':' PATH  */
+#line 923 "src/p.y"
                                              {
                         _setPEM(&(sslset.CACertificateFile), (yyvsp[0].string), "SSL CA certificates file", true);
                   }
-#line 3889 "src/y.tab.c"
+#line 3928 "src/y.tab.c"
     break;
 
-  case 263:
-#line 857 "src/p.y"
+  case 297: /* ssloption: CACERTIFICATEPATH ':' PATH  */
+#line 926 "src/p.y"
                                              {
                         _setPEM(&(sslset.CACertificatePath), (yyvsp[0].string), "SSL CA certificates directory", false);
                   }
-#line 3897 "src/y.tab.c"
+#line 3936 "src/y.tab.c"
     break;
 
-  case 264:
-#line 862 "src/p.y"
+  case 298: /* sslexpire: CERTIFICATE VALID expireoperator NUMBER DAY  */
+#line 931 "src/p.y"
                                                               {
                         sslset.flags = SSL_Enabled;
                         portset.target.net.ssl.certificate.minimumDays = (yyvsp[-1].number);
                   }
-#line 3906 "src/y.tab.c"
+#line 3945 "src/y.tab.c"
     break;
 
-  case 267:
-#line 872 "src/p.y"
+  case 301: /* sslchecksum: CERTIFICATE CHECKSUM checksumoperator STRING  */
+#line 941 "src/p.y"
                                                                {
                         sslset.flags = SSL_Enabled;
                         sslset.checksum = (yyvsp[0].string);
@@ -3921,11 +3960,11 @@ yyreduce:
                                         yyerror2("Unknown checksum type: [%s] is not MD5 nor SHA1", sslset.checksum);
                         }
                   }
-#line 3925 "src/y.tab.c"
+#line 3964 "src/y.tab.c"
     break;
 
-  case 268:
-#line 886 "src/p.y"
+  case 302: /* sslchecksum: CERTIFICATE CHECKSUM MD5HASH checksumoperator STRING  */
+#line 955 "src/p.y"
                                                                        {
                         sslset.flags = SSL_Enabled;
                         sslset.checksum = (yyvsp[0].string);
@@ -3933,11 +3972,11 @@ yyreduce:
                                 yyerror2("Unknown checksum type: [%s] is not MD5", sslset.checksum);
                         sslset.checksumType = Hash_Md5;
                   }
-#line 3937 "src/y.tab.c"
+#line 3976 "src/y.tab.c"
     break;
 
-  case 269:
-#line 893 "src/p.y"
+  case 303: /* sslchecksum: CERTIFICATE CHECKSUM SHA1HASH checksumoperator STRING  */
+#line 962 "src/p.y"
                                                                         {
                         sslset.flags = SSL_Enabled;
                         sslset.checksum = (yyvsp[0].string);
@@ -3945,11 +3984,11 @@ yyreduce:
                                 yyerror2("Unknown checksum type: [%s] is not SHA1", sslset.checksum);
                         sslset.checksumType = Hash_Sha1;
                   }
-#line 3949 "src/y.tab.c"
+#line 3988 "src/y.tab.c"
     break;
 
-  case 274:
-#line 910 "src/p.y"
+  case 308: /* sslversion: SSLV2  */
+#line 979 "src/p.y"
                         {
 #if defined OPENSSL_NO_SSL2 || ! defined HAVE_SSLV2 || ! defined HAVE_OPENSSL
                         yyerror("Your SSL Library does not support SSL version 2");
@@ -3957,19 +3996,19 @@ yyreduce:
                         _setSSLVersion(SSL_V2);
 #endif
                   }
-#line 3961 "src/y.tab.c"
+#line 4000 "src/y.tab.c"
     break;
 
-  case 275:
-#line 917 "src/p.y"
+  case 309: /* sslversion: NOSSLV2  */
+#line 986 "src/p.y"
                           {
                         _unsetSSLVersion(SSL_V2);
                   }
-#line 3969 "src/y.tab.c"
+#line 4008 "src/y.tab.c"
     break;
 
-  case 276:
-#line 920 "src/p.y"
+  case 310: /* sslversion: SSLV3  */
+#line 989 "src/p.y"
                         {
 #if defined OPENSSL_NO_SSL3 || ! defined HAVE_OPENSSL
                         yyerror("Your SSL Library does not support SSL version 3");
@@ -3977,19 +4016,19 @@ yyreduce:
                         _setSSLVersion(SSL_V3);
 #endif
                   }
-#line 3981 "src/y.tab.c"
+#line 4020 "src/y.tab.c"
     break;
 
-  case 277:
-#line 927 "src/p.y"
+  case 311: /* sslversion: NOSSLV3  */
+#line 996 "src/p.y"
                           {
                         _unsetSSLVersion(SSL_V3);
                   }
-#line 3989 "src/y.tab.c"
+#line 4028 "src/y.tab.c"
     break;
 
-  case 278:
-#line 930 "src/p.y"
+  case 312: /* sslversion: TLSV1  */
+#line 999 "src/p.y"
                         {
 #if defined OPENSSL_NO_TLS1_METHOD || ! defined HAVE_OPENSSL
                         yyerror("Your SSL Library does not support TLS version 1.0");
@@ -3997,19 +4036,19 @@ yyreduce:
                         _setSSLVersion(SSL_TLSV1);
 #endif
                   }
-#line 4001 "src/y.tab.c"
+#line 4040 "src/y.tab.c"
     break;
 
-  case 279:
-#line 937 "src/p.y"
+  case 313: /* sslversion: NOTLSV1  */
+#line 1006 "src/p.y"
                           {
                         _unsetSSLVersion(SSL_TLSV1);
                   }
-#line 4009 "src/y.tab.c"
+#line 4048 "src/y.tab.c"
     break;
 
-  case 280:
-#line 940 "src/p.y"
+  case 314: /* sslversion: TLSV11  */
+#line 1009 "src/p.y"
                          {
 #if defined OPENSSL_NO_TLS1_1_METHOD || ! defined HAVE_TLSV1_1 || ! defined HAVE_OPENSSL
                         yyerror("Your SSL Library does not support TLS version 1.1");
@@ -4017,19 +4056,19 @@ yyreduce:
                         _setSSLVersion(SSL_TLSV11);
 #endif
                 }
-#line 4021 "src/y.tab.c"
+#line 4060 "src/y.tab.c"
     break;
 
-  case 281:
-#line 947 "src/p.y"
+  case 315: /* sslversion: NOTLSV11  */
+#line 1016 "src/p.y"
                            {
                         _unsetSSLVersion(SSL_TLSV11);
                   }
-#line 4029 "src/y.tab.c"
+#line 4068 "src/y.tab.c"
     break;
 
-  case 282:
-#line 950 "src/p.y"
+  case 316: /* sslversion: TLSV12  */
+#line 1019 "src/p.y"
                          {
 #if defined OPENSSL_NO_TLS1_2_METHOD || ! defined HAVE_TLSV1_2 || ! defined HAVE_OPENSSL
                         yyerror("Your SSL Library does not support TLS version 1.2");
@@ -4037,19 +4076,19 @@ yyreduce:
                         _setSSLVersion(SSL_TLSV12);
 #endif
                 }
-#line 4041 "src/y.tab.c"
+#line 4080 "src/y.tab.c"
     break;
 
-  case 283:
-#line 957 "src/p.y"
+  case 317: /* sslversion: NOTLSV12  */
+#line 1026 "src/p.y"
                            {
                         _unsetSSLVersion(SSL_TLSV12);
                   }
-#line 4049 "src/y.tab.c"
+#line 4088 "src/y.tab.c"
     break;
 
-  case 284:
-#line 960 "src/p.y"
+  case 318: /* sslversion: TLSV13  */
+#line 1029 "src/p.y"
                          {
 #if defined OPENSSL_NO_TLS1_3_METHOD || ! defined HAVE_TLSV1_3 || ! defined HAVE_OPENSSL
                         yyerror("Your SSL Library does not support TLS version 1.3");
@@ -4057,19 +4096,19 @@ yyreduce:
                         _setSSLVersion(SSL_TLSV13);
 #endif
                 }
-#line 4061 "src/y.tab.c"
+#line 4100 "src/y.tab.c"
     break;
 
-  case 285:
-#line 967 "src/p.y"
+  case 319: /* sslversion: NOTLSV13  */
+#line 1036 "src/p.y"
                            {
                         _unsetSSLVersion(SSL_TLSV13);
                   }
-#line 4069 "src/y.tab.c"
+#line 4108 "src/y.tab.c"
     break;
 
-  case 286:
-#line 970 "src/p.y"
+  case 320: /* sslversion: AUTO  */
+#line 1039 "src/p.y"
                        {
                         // Enable just TLS 1.2 and 1.3 by default
 #if ! defined OPENSSL_NO_TLS1_2_METHOD && defined HAVE_TLSV1_2 && defined HAVE_OPENSSL
@@ -4079,11 +4118,11 @@ yyreduce:
                         _setSSLVersion(SSL_TLSV13);
 #endif
                   }
-#line 4083 "src/y.tab.c"
+#line 4122 "src/y.tab.c"
     break;
 
-  case 287:
-#line 981 "src/p.y"
+  case 321: /* certmd5: CERTMD5 STRING  */
+#line 1050 "src/p.y"
                                  { // Backward compatibility
                         sslset.flags = SSL_Enabled;
                         sslset.checksum = (yyvsp[0].string);
@@ -4091,21 +4130,21 @@ yyreduce:
                                 yyerror2("Unknown checksum type: [%s] is not MD5", sslset.checksum);
                         sslset.checksumType = Hash_Md5;
                   }
-#line 4095 "src/y.tab.c"
+#line 4134 "src/y.tab.c"
     break;
 
-  case 288:
-#line 990 "src/p.y"
+  case 322: /* setmailservers: SET MAILSERVER mailserverlist nettimeout hostname  */
+#line 1059 "src/p.y"
                                                                     {
                         if (((yyvsp[-1].number)) > SMTP_TIMEOUT)
                                 Run.mailserver_timeout = (yyvsp[-1].number);
                         Run.mail_hostname = (yyvsp[0].string);
                   }
-#line 4105 "src/y.tab.c"
+#line 4144 "src/y.tab.c"
     break;
 
-  case 289:
-#line 997 "src/p.y"
+  case 323: /* setmailformat: SET MAILFORMAT '{' formatoptionlist '}'  */
+#line 1066 "src/p.y"
                                                           {
                         if (mailset.from) {
                                 Run.MailFormat.from = mailset.from;
@@ -4119,11 +4158,11 @@ yyreduce:
                         Run.MailFormat.message = mailset.message ?  mailset.message : Str_dup(ALERT_MESSAGE);
                         reset_mailset();
                   }
-#line 4123 "src/y.tab.c"
+#line 4162 "src/y.tab.c"
     break;
 
-  case 292:
-#line 1016 "src/p.y"
+  case 326: /* mailserver: STRING mailserveroptlist  */
+#line 1085 "src/p.y"
                                            {
                         /* Restore the current text overridden by lookahead */
                         FREE(argyytext);
@@ -4133,11 +4172,11 @@ yyreduce:
                         mailserverset.port = PORT_SMTP;
                         addmailserver(&mailserverset);
                   }
-#line 4137 "src/y.tab.c"
+#line 4176 "src/y.tab.c"
     break;
 
-  case 293:
-#line 1025 "src/p.y"
+  case 327: /* mailserver: STRING PORT NUMBER mailserveroptlist  */
+#line 1094 "src/p.y"
                                                        {
                         /* Restore the current text overridden by lookahead */
                         FREE(argyytext);
@@ -4147,27 +4186,27 @@ yyreduce:
                         mailserverset.port = (yyvsp[-1].number);
                         addmailserver(&mailserverset);
                   }
-#line 4151 "src/y.tab.c"
+#line 4190 "src/y.tab.c"
     break;
 
-  case 296:
-#line 1040 "src/p.y"
+  case 330: /* mailserveropt: username  */
+#line 1109 "src/p.y"
                            {
                         mailserverset.username = (yyvsp[0].string);
                   }
-#line 4159 "src/y.tab.c"
+#line 4198 "src/y.tab.c"
     break;
 
-  case 297:
-#line 1043 "src/p.y"
+  case 331: /* mailserveropt: password  */
+#line 1112 "src/p.y"
                            {
                         mailserverset.password = (yyvsp[0].string);
                   }
-#line 4167 "src/y.tab.c"
+#line 4206 "src/y.tab.c"
     break;
 
-  case 302:
-#line 1052 "src/p.y"
+  case 336: /* sethttpd: SET HTTPD httpdlist  */
+#line 1121 "src/p.y"
                                       {
                         if (sslset.flags & SSL_Enabled) {
 #ifdef HAVE_OPENSSL
@@ -4193,133 +4232,133 @@ yyreduce:
 #endif
                         }
                   }
-#line 4197 "src/y.tab.c"
+#line 4236 "src/y.tab.c"
     break;
 
-  case 314:
-#line 1095 "src/p.y"
+  case 348: /* pemfile: PEMFILE PATH  */
+#line 1164 "src/p.y"
                                {
                         _setPEM(&(sslset.pemfile), (yyvsp[0].string), "SSL server PEM file", true);
                   }
-#line 4205 "src/y.tab.c"
+#line 4244 "src/y.tab.c"
     break;
 
-  case 315:
-#line 1101 "src/p.y"
+  case 349: /* clientpemfile: CLIENTPEMFILE PATH  */
+#line 1170 "src/p.y"
                                      {
                         _setPEM(&(sslset.clientpemfile), (yyvsp[0].string), "SSL client PEM file", true);
                   }
-#line 4213 "src/y.tab.c"
+#line 4252 "src/y.tab.c"
     break;
 
-  case 316:
-#line 1107 "src/p.y"
+  case 350: /* allowselfcert: ALLOWSELFCERTIFICATION  */
+#line 1176 "src/p.y"
                                          {
                         sslset.flags = SSL_Enabled;
                         sslset.allowSelfSigned = true;
                   }
-#line 4222 "src/y.tab.c"
+#line 4261 "src/y.tab.c"
     break;
 
-  case 317:
-#line 1113 "src/p.y"
+  case 351: /* httpdport: PORT NUMBER  */
+#line 1182 "src/p.y"
                               {
                         Run.httpd.flags |= Httpd_Net;
                         Run.httpd.socket.net.port = (yyvsp[0].number);
                   }
-#line 4231 "src/y.tab.c"
+#line 4270 "src/y.tab.c"
     break;
 
-  case 318:
-#line 1119 "src/p.y"
+  case 352: /* httpdsocket: UNIXSOCKET PATH httpdsocketoptionlist  */
+#line 1188 "src/p.y"
                                                         {
                         Run.httpd.flags |= Httpd_Unix;
                         Run.httpd.socket.unix.path = (yyvsp[-1].string);
                   }
-#line 4240 "src/y.tab.c"
+#line 4279 "src/y.tab.c"
     break;
 
-  case 321:
-#line 1129 "src/p.y"
+  case 355: /* httpdsocketoption: UID STRING  */
+#line 1198 "src/p.y"
                                {
                         Run.httpd.flags |= Httpd_UnixUid;
                         Run.httpd.socket.unix.uid = get_uid((yyvsp[0].string), 0);
                         FREE((yyvsp[0].string));
                     }
-#line 4250 "src/y.tab.c"
+#line 4289 "src/y.tab.c"
     break;
 
-  case 322:
-#line 1134 "src/p.y"
+  case 356: /* httpdsocketoption: GID STRING  */
+#line 1203 "src/p.y"
                                {
                         Run.httpd.flags |= Httpd_UnixGid;
                         Run.httpd.socket.unix.gid = get_gid((yyvsp[0].string), 0);
                         FREE((yyvsp[0].string));
                     }
-#line 4260 "src/y.tab.c"
+#line 4299 "src/y.tab.c"
     break;
 
-  case 323:
-#line 1139 "src/p.y"
+  case 357: /* httpdsocketoption: UID NUMBER  */
+#line 1208 "src/p.y"
                                {
                         Run.httpd.flags |= Httpd_UnixUid;
                         Run.httpd.socket.unix.uid = get_uid(NULL, (yyvsp[0].number));
                     }
-#line 4269 "src/y.tab.c"
+#line 4308 "src/y.tab.c"
     break;
 
-  case 324:
-#line 1143 "src/p.y"
+  case 358: /* httpdsocketoption: GID NUMBER  */
+#line 1212 "src/p.y"
                                {
                         Run.httpd.flags |= Httpd_UnixGid;
                         Run.httpd.socket.unix.gid = get_gid(NULL, (yyvsp[0].number));
                     }
-#line 4278 "src/y.tab.c"
+#line 4317 "src/y.tab.c"
     break;
 
-  case 325:
-#line 1147 "src/p.y"
+  case 359: /* httpdsocketoption: PERMISSION NUMBER  */
+#line 1216 "src/p.y"
                                       {
                         Run.httpd.flags |= Httpd_UnixPermission;
                         Run.httpd.socket.unix.permission = check_perm((yyvsp[0].number));
                     }
-#line 4287 "src/y.tab.c"
+#line 4326 "src/y.tab.c"
     break;
 
-  case 330:
-#line 1161 "src/p.y"
+  case 364: /* signature: sigenable  */
+#line 1230 "src/p.y"
                              {
                         Run.httpd.flags |= Httpd_Signature;
                   }
-#line 4295 "src/y.tab.c"
+#line 4334 "src/y.tab.c"
     break;
 
-  case 331:
-#line 1164 "src/p.y"
+  case 365: /* signature: sigdisable  */
+#line 1233 "src/p.y"
                              {
                         Run.httpd.flags &= ~Httpd_Signature;
                   }
-#line 4303 "src/y.tab.c"
+#line 4342 "src/y.tab.c"
     break;
 
-  case 332:
-#line 1169 "src/p.y"
+  case 366: /* bindaddress: ADDRESS STRING  */
+#line 1238 "src/p.y"
                                  {
                         Run.httpd.socket.net.address = (yyvsp[0].string);
                   }
-#line 4311 "src/y.tab.c"
+#line 4350 "src/y.tab.c"
     break;
 
-  case 333:
-#line 1174 "src/p.y"
+  case 367: /* allow: ALLOW STRING ':' STRING readonly  */
+#line 1243 "src/p.y"
                                                  {
                         addcredentials((yyvsp[-3].string), (yyvsp[-1].string), Digest_Cleartext, (yyvsp[0].number));
                   }
-#line 4319 "src/y.tab.c"
+#line 4358 "src/y.tab.c"
     break;
 
-  case 334:
-#line 1177 "src/p.y"
+  case 368: /* allow: ALLOW '@' STRING readonly  */
+#line 1246 "src/p.y"
                                            {
 #ifdef HAVE_LIBPAM
                         addpamauth((yyvsp[-1].string), (yyvsp[0].number));
@@ -4328,166 +4367,166 @@ yyreduce:
                         FREE((yyvsp[-1].string));
 #endif
                   }
-#line 4332 "src/y.tab.c"
+#line 4371 "src/y.tab.c"
     break;
 
-  case 335:
-#line 1185 "src/p.y"
+  case 369: /* allow: ALLOW PATH  */
+#line 1254 "src/p.y"
                              {
                         addhtpasswdentry((yyvsp[0].string), NULL, Digest_Cleartext);
                         FREE((yyvsp[0].string));
                   }
-#line 4341 "src/y.tab.c"
+#line 4380 "src/y.tab.c"
     break;
 
-  case 336:
-#line 1189 "src/p.y"
+  case 370: /* allow: ALLOW CLEARTEXT PATH  */
+#line 1258 "src/p.y"
                                        {
                         addhtpasswdentry((yyvsp[0].string), NULL, Digest_Cleartext);
                         FREE((yyvsp[0].string));
                   }
-#line 4350 "src/y.tab.c"
+#line 4389 "src/y.tab.c"
     break;
 
-  case 337:
-#line 1193 "src/p.y"
+  case 371: /* allow: ALLOW MD5HASH PATH  */
+#line 1262 "src/p.y"
                                      {
                         addhtpasswdentry((yyvsp[0].string), NULL, Digest_Md5);
                         FREE((yyvsp[0].string));
                   }
-#line 4359 "src/y.tab.c"
+#line 4398 "src/y.tab.c"
     break;
 
-  case 338:
-#line 1197 "src/p.y"
+  case 372: /* allow: ALLOW CRYPT PATH  */
+#line 1266 "src/p.y"
                                    {
                         addhtpasswdentry((yyvsp[0].string), NULL, Digest_Crypt);
                         FREE((yyvsp[0].string));
                   }
-#line 4368 "src/y.tab.c"
+#line 4407 "src/y.tab.c"
     break;
 
-  case 339:
-#line 1201 "src/p.y"
+  case 373: /* $@1: %empty  */
+#line 1270 "src/p.y"
                              {
                         htpasswd_file = (yyvsp[0].string);
                         digesttype = Digest_Cleartext;
                   }
-#line 4377 "src/y.tab.c"
+#line 4416 "src/y.tab.c"
     break;
 
-  case 340:
-#line 1205 "src/p.y"
+  case 374: /* allow: ALLOW PATH $@1 allowuserlist  */
+#line 1274 "src/p.y"
                                 {
                         FREE(htpasswd_file);
                   }
-#line 4385 "src/y.tab.c"
+#line 4424 "src/y.tab.c"
     break;
 
-  case 341:
-#line 1208 "src/p.y"
+  case 375: /* $@2: %empty  */
+#line 1277 "src/p.y"
                                        {
                         htpasswd_file = (yyvsp[0].string);
                         digesttype = Digest_Cleartext;
                   }
-#line 4394 "src/y.tab.c"
+#line 4433 "src/y.tab.c"
     break;
 
-  case 342:
-#line 1212 "src/p.y"
+  case 376: /* allow: ALLOW CLEARTEXT PATH $@2 allowuserlist  */
+#line 1281 "src/p.y"
                                 {
                         FREE(htpasswd_file);
                   }
-#line 4402 "src/y.tab.c"
+#line 4441 "src/y.tab.c"
     break;
 
-  case 343:
-#line 1215 "src/p.y"
+  case 377: /* $@3: %empty  */
+#line 1284 "src/p.y"
                                      {
                         htpasswd_file = (yyvsp[0].string);
                         digesttype = Digest_Md5;
                   }
-#line 4411 "src/y.tab.c"
+#line 4450 "src/y.tab.c"
     break;
 
-  case 344:
-#line 1219 "src/p.y"
+  case 378: /* allow: ALLOW MD5HASH PATH $@3 allowuserlist  */
+#line 1288 "src/p.y"
                                 {
                         FREE(htpasswd_file);
                   }
-#line 4419 "src/y.tab.c"
+#line 4458 "src/y.tab.c"
     break;
 
-  case 345:
-#line 1222 "src/p.y"
+  case 379: /* $@4: %empty  */
+#line 1291 "src/p.y"
                                    {
                         htpasswd_file = (yyvsp[0].string);
                         digesttype = Digest_Crypt;
                   }
-#line 4428 "src/y.tab.c"
+#line 4467 "src/y.tab.c"
     break;
 
-  case 346:
-#line 1226 "src/p.y"
+  case 380: /* allow: ALLOW CRYPT PATH $@4 allowuserlist  */
+#line 1295 "src/p.y"
                                 {
                         FREE(htpasswd_file);
                   }
-#line 4436 "src/y.tab.c"
+#line 4475 "src/y.tab.c"
     break;
 
-  case 347:
-#line 1229 "src/p.y"
+  case 381: /* allow: ALLOW STRING  */
+#line 1298 "src/p.y"
                                {
                         if (! Engine_addAllow((yyvsp[0].string)))
                                 yywarning2("invalid allow option: %s", (yyvsp[0].string));
                         FREE((yyvsp[0].string));
                   }
-#line 4446 "src/y.tab.c"
+#line 4485 "src/y.tab.c"
     break;
 
-  case 350:
-#line 1240 "src/p.y"
+  case 384: /* allowuser: STRING  */
+#line 1309 "src/p.y"
                          {
                         addhtpasswdentry(htpasswd_file, (yyvsp[0].string), digesttype);
                         FREE((yyvsp[0].string));
                   }
-#line 4455 "src/y.tab.c"
+#line 4494 "src/y.tab.c"
     break;
 
-  case 351:
-#line 1246 "src/p.y"
+  case 385: /* readonly: %empty  */
+#line 1315 "src/p.y"
                               {
                         (yyval.number) = false;
                   }
-#line 4463 "src/y.tab.c"
+#line 4502 "src/y.tab.c"
     break;
 
-  case 352:
-#line 1249 "src/p.y"
+  case 386: /* readonly: READONLY  */
+#line 1318 "src/p.y"
                            {
                         (yyval.number) = true;
                   }
-#line 4471 "src/y.tab.c"
+#line 4510 "src/y.tab.c"
     break;
 
-  case 353:
-#line 1254 "src/p.y"
+  case 387: /* checkproc: CHECKPROC SERVICENAME PIDFILE PATH  */
+#line 1323 "src/p.y"
                                                      {
                         createservice(Service_Process, (yyvsp[-2].string), (yyvsp[0].string), check_process);
                   }
-#line 4479 "src/y.tab.c"
+#line 4518 "src/y.tab.c"
     break;
 
-  case 354:
-#line 1257 "src/p.y"
+  case 388: /* checkproc: CHECKPROC SERVICENAME PATHTOK PATH  */
+#line 1326 "src/p.y"
                                                      {
                         createservice(Service_Process, (yyvsp[-2].string), (yyvsp[0].string), check_process);
                   }
-#line 4487 "src/y.tab.c"
+#line 4526 "src/y.tab.c"
     break;
 
-  case 355:
-#line 1260 "src/p.y"
+  case 389: /* checkproc: CHECKPROC SERVICENAME MATCH STRING  */
+#line 1329 "src/p.y"
                                                      {
                         createservice(Service_Process, (yyvsp[-2].string), (yyvsp[0].string), check_process);
                         matchset.ignore = false;
@@ -4495,11 +4534,11 @@ yyreduce:
                         matchset.match_string = Str_dup((yyvsp[0].string));
                         addmatch(&matchset, Action_Ignored, 0);
                   }
-#line 4499 "src/y.tab.c"
+#line 4538 "src/y.tab.c"
     break;
 
-  case 356:
-#line 1267 "src/p.y"
+  case 390: /* checkproc: CHECKPROC SERVICENAME MATCH PATH  */
+#line 1336 "src/p.y"
                                                    {
                         createservice(Service_Process, (yyvsp[-2].string), (yyvsp[0].string), check_process);
                         matchset.ignore = false;
@@ -4507,51 +4546,59 @@ yyreduce:
                         matchset.match_string = Str_dup((yyvsp[0].string));
                         addmatch(&matchset, Action_Ignored, 0);
                   }
-#line 4511 "src/y.tab.c"
+#line 4550 "src/y.tab.c"
     break;
 
-  case 357:
-#line 1276 "src/p.y"
+  case 391: /* checkfile: CHECKFILE SERVICENAME PATHTOK PATH  */
+#line 1345 "src/p.y"
                                                      {
                         createservice(Service_File, (yyvsp[-2].string), (yyvsp[0].string), check_file);
                   }
-#line 4519 "src/y.tab.c"
+#line 4558 "src/y.tab.c"
     break;
 
-  case 358:
-#line 1281 "src/p.y"
+  case 392: /* checkfileset: CHECKFILESET SERVICENAME PATHTOK PATH  */
+#line 1350 "src/p.y"
+                                                        {
+                        createservice(Service_Fileset, (yyvsp[-2].string), (yyvsp[0].string), check_fileset);
+                  }
+#line 4566 "src/y.tab.c"
+    break;
+
+  case 393: /* checkfilesys: CHECKFILESYS SERVICENAME PATHTOK PATH  */
+#line 1355 "src/p.y"
                                                         {
                         createservice(Service_Filesystem, (yyvsp[-2].string), (yyvsp[0].string), check_filesystem);
                   }
-#line 4527 "src/y.tab.c"
+#line 4574 "src/y.tab.c"
     break;
 
-  case 359:
-#line 1284 "src/p.y"
+  case 394: /* checkfilesys: CHECKFILESYS SERVICENAME PATHTOK STRING  */
+#line 1358 "src/p.y"
                                                           {
                         createservice(Service_Filesystem, (yyvsp[-2].string), (yyvsp[0].string), check_filesystem);
                   }
-#line 4535 "src/y.tab.c"
+#line 4582 "src/y.tab.c"
     break;
 
-  case 360:
-#line 1289 "src/p.y"
+  case 395: /* checkdir: CHECKDIR SERVICENAME PATHTOK PATH  */
+#line 1363 "src/p.y"
                                                     {
                         createservice(Service_Directory, (yyvsp[-2].string), (yyvsp[0].string), check_directory);
                   }
-#line 4543 "src/y.tab.c"
+#line 4590 "src/y.tab.c"
     break;
 
-  case 361:
-#line 1294 "src/p.y"
+  case 396: /* checkhost: CHECKHOST SERVICENAME ADDRESS STRING  */
+#line 1368 "src/p.y"
                                                        {
                         createservice(Service_Host, (yyvsp[-2].string), (yyvsp[0].string), check_remote_host);
                   }
-#line 4551 "src/y.tab.c"
+#line 4598 "src/y.tab.c"
     break;
 
-  case 362:
-#line 1299 "src/p.y"
+  case 397: /* checknet: CHECKNET SERVICENAME ADDRESS STRING  */
+#line 1373 "src/p.y"
                                                       {
                         if (Link_isGetByAddressSupported()) {
                                 createservice(Service_Net, (yyvsp[-2].string), (yyvsp[0].string), check_net);
@@ -4560,20 +4607,20 @@ yyreduce:
                                 yyerror("Network monitoring by IP address is not supported on this platform, please use 'check network <foo> with interface <bar>' instead");
                         }
                   }
-#line 4564 "src/y.tab.c"
+#line 4611 "src/y.tab.c"
     break;
 
-  case 363:
-#line 1307 "src/p.y"
+  case 398: /* checknet: CHECKNET SERVICENAME INTERFACE STRING  */
+#line 1381 "src/p.y"
                                                         {
                         createservice(Service_Net, (yyvsp[-2].string), (yyvsp[0].string), check_net);
                         current->inf.net->stats = Link_createForInterface((yyvsp[0].string));
                   }
-#line 4573 "src/y.tab.c"
+#line 4620 "src/y.tab.c"
     break;
 
-  case 364:
-#line 1313 "src/p.y"
+  case 399: /* checksystem: CHECKSYSTEM SERVICENAME  */
+#line 1387 "src/p.y"
                                           {
                         char *servicename = (yyvsp[0].string);
                         if (Str_sub(servicename, "$HOST")) {
@@ -4587,179 +4634,179 @@ yyreduce:
                         }
                         Run.system = createservice(Service_System, servicename, NULL, check_system); // The name given in the 'check system' statement overrides system hostname
                   }
-#line 4591 "src/y.tab.c"
+#line 4638 "src/y.tab.c"
     break;
 
-  case 365:
-#line 1328 "src/p.y"
+  case 400: /* checkfifo: CHECKFIFO SERVICENAME PATHTOK PATH  */
+#line 1402 "src/p.y"
                                                      {
                         createservice(Service_Fifo, (yyvsp[-2].string), (yyvsp[0].string), check_fifo);
                   }
-#line 4599 "src/y.tab.c"
+#line 4646 "src/y.tab.c"
     break;
 
-  case 366:
-#line 1333 "src/p.y"
+  case 401: /* checkprogram: CHECKPROGRAM SERVICENAME PATHTOK argumentlist programtimeout  */
+#line 1407 "src/p.y"
                                                                                {
                         createservice(Service_Program, (yyvsp[-3].string), NULL, check_program);
                         current->program->timeout = (yyvsp[0].number);
                         current->program->lastOutput = StringBuffer_create(64);
                         current->program->inprogressOutput = StringBuffer_create(64);
                  }
-#line 4610 "src/y.tab.c"
+#line 4657 "src/y.tab.c"
     break;
 
-  case 367:
-#line 1339 "src/p.y"
+  case 402: /* checkprogram: CHECKPROGRAM SERVICENAME PATHTOK argumentlist useroptionlist programtimeout  */
+#line 1413 "src/p.y"
                                                                                               {
                         createservice(Service_Program, (yyvsp[-4].string), NULL, check_program);
                         current->program->timeout = (yyvsp[0].number);
                         current->program->lastOutput = StringBuffer_create(64);
                         current->program->inprogressOutput = StringBuffer_create(64);
                  }
-#line 4621 "src/y.tab.c"
+#line 4668 "src/y.tab.c"
     break;
 
-  case 368:
-#line 1347 "src/p.y"
+  case 403: /* start: START argumentlist starttimeout  */
+#line 1421 "src/p.y"
                                                   {
                         addcommand(START, (yyvsp[0].number));
                   }
-#line 4629 "src/y.tab.c"
+#line 4676 "src/y.tab.c"
     break;
 
-  case 369:
-#line 1350 "src/p.y"
+  case 404: /* start: START argumentlist useroptionlist starttimeout  */
+#line 1424 "src/p.y"
                                                                  {
                         addcommand(START, (yyvsp[0].number));
                   }
-#line 4637 "src/y.tab.c"
+#line 4684 "src/y.tab.c"
     break;
 
-  case 370:
-#line 1355 "src/p.y"
+  case 405: /* stop: STOP argumentlist stoptimeout  */
+#line 1429 "src/p.y"
                                                 {
                         addcommand(STOP, (yyvsp[0].number));
                   }
-#line 4645 "src/y.tab.c"
+#line 4692 "src/y.tab.c"
     break;
 
-  case 371:
-#line 1358 "src/p.y"
+  case 406: /* stop: STOP argumentlist useroptionlist stoptimeout  */
+#line 1432 "src/p.y"
                                                                {
                         addcommand(STOP, (yyvsp[0].number));
                   }
-#line 4653 "src/y.tab.c"
+#line 4700 "src/y.tab.c"
     break;
 
-  case 372:
-#line 1364 "src/p.y"
+  case 407: /* restart: RESTART argumentlist restarttimeout  */
+#line 1438 "src/p.y"
                                                       {
                         addcommand(RESTART, (yyvsp[0].number));
                   }
-#line 4661 "src/y.tab.c"
+#line 4708 "src/y.tab.c"
     break;
 
-  case 373:
-#line 1367 "src/p.y"
+  case 408: /* restart: RESTART argumentlist useroptionlist restarttimeout  */
+#line 1441 "src/p.y"
                                                                      {
                         addcommand(RESTART, (yyvsp[0].number));
                   }
-#line 4669 "src/y.tab.c"
+#line 4716 "src/y.tab.c"
     break;
 
-  case 378:
-#line 1380 "src/p.y"
+  case 413: /* argument: STRING  */
+#line 1454 "src/p.y"
                          {
                         addargument((yyvsp[0].string));
                   }
-#line 4677 "src/y.tab.c"
+#line 4724 "src/y.tab.c"
     break;
 
-  case 379:
-#line 1383 "src/p.y"
+  case 414: /* argument: PATH  */
+#line 1457 "src/p.y"
                        {
                         addargument((yyvsp[0].string));
                   }
-#line 4685 "src/y.tab.c"
+#line 4732 "src/y.tab.c"
     break;
 
-  case 380:
-#line 1388 "src/p.y"
+  case 415: /* useroption: UID STRING  */
+#line 1462 "src/p.y"
                              {
                         addeuid(get_uid((yyvsp[0].string), 0));
                         FREE((yyvsp[0].string));
                   }
-#line 4694 "src/y.tab.c"
+#line 4741 "src/y.tab.c"
     break;
 
-  case 381:
-#line 1392 "src/p.y"
+  case 416: /* useroption: GID STRING  */
+#line 1466 "src/p.y"
                              {
                         addegid(get_gid((yyvsp[0].string), 0));
                         FREE((yyvsp[0].string));
                   }
-#line 4703 "src/y.tab.c"
+#line 4750 "src/y.tab.c"
     break;
 
-  case 382:
-#line 1396 "src/p.y"
+  case 417: /* useroption: UID NUMBER  */
+#line 1470 "src/p.y"
                              {
                         addeuid(get_uid(NULL, (yyvsp[0].number)));
                   }
-#line 4711 "src/y.tab.c"
+#line 4758 "src/y.tab.c"
     break;
 
-  case 383:
-#line 1399 "src/p.y"
+  case 418: /* useroption: GID NUMBER  */
+#line 1473 "src/p.y"
                              {
                         addegid(get_gid(NULL, (yyvsp[0].number)));
                   }
-#line 4719 "src/y.tab.c"
+#line 4766 "src/y.tab.c"
     break;
 
-  case 384:
-#line 1404 "src/p.y"
+  case 419: /* username: USERNAME MAILADDR  */
+#line 1478 "src/p.y"
                                     {
                         (yyval.string) = (yyvsp[0].string);
                   }
-#line 4727 "src/y.tab.c"
+#line 4774 "src/y.tab.c"
     break;
 
-  case 385:
-#line 1407 "src/p.y"
+  case 420: /* username: USERNAME STRING  */
+#line 1481 "src/p.y"
                                   {
                         (yyval.string) = (yyvsp[0].string);
                   }
-#line 4735 "src/y.tab.c"
+#line 4782 "src/y.tab.c"
     break;
 
-  case 386:
-#line 1412 "src/p.y"
+  case 421: /* password: PASSWORD STRING  */
+#line 1486 "src/p.y"
                                   {
                         (yyval.string) = (yyvsp[0].string);
                   }
-#line 4743 "src/y.tab.c"
+#line 4790 "src/y.tab.c"
     break;
 
-  case 387:
-#line 1417 "src/p.y"
+  case 422: /* hostname: %empty  */
+#line 1491 "src/p.y"
                                   {
                         (yyval.string) = NULL;
                   }
-#line 4751 "src/y.tab.c"
+#line 4798 "src/y.tab.c"
     break;
 
-  case 388:
-#line 1420 "src/p.y"
+  case 423: /* hostname: HOSTNAME STRING  */
+#line 1494 "src/p.y"
                                   {
                         (yyval.string) = (yyvsp[0].string);
                   }
-#line 4759 "src/y.tab.c"
+#line 4806 "src/y.tab.c"
     break;
 
-  case 389:
-#line 1425 "src/p.y"
+  case 424: /* connection: IF FAILED host port connectionoptlist rate1 THEN action1 recovery  */
+#line 1499 "src/p.y"
                                                                                     {
                         /* This is a workaround to support content match without having to create an URL object. 'urloption' creates the Request_T object we need minus the URL object, but with enough information to perform content test.
                            TODO: Parser is in need of refactoring */
@@ -4767,573 +4814,595 @@ yyreduce:
                         addeventaction(&(portset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addport(&(current->portlist), &portset);
                   }
-#line 4771 "src/y.tab.c"
+#line 4818 "src/y.tab.c"
     break;
 
-  case 403:
-#line 1451 "src/p.y"
+  case 440: /* connectionurl: IF FAILED URL URLOBJECT connectionurloptlist rate1 THEN action1 recovery  */
+#line 1527 "src/p.y"
                                                                                            {
                         prepare_urlrequest((yyvsp[-5].url));
                         addeventaction(&(portset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addport(&(current->portlist), &portset);
                   }
-#line 4781 "src/y.tab.c"
+#line 4828 "src/y.tab.c"
     break;
 
-  case 412:
-#line 1470 "src/p.y"
+  case 451: /* connectionunix: IF FAILED unixsocket connectionuxoptlist rate1 THEN action1 recovery  */
+#line 1548 "src/p.y"
                                                                                        {
                         addeventaction(&(portset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addport(&(current->socketlist), &portset);
                   }
-#line 4790 "src/y.tab.c"
+#line 4837 "src/y.tab.c"
     break;
 
-  case 420:
-#line 1487 "src/p.y"
+  case 461: /* icmp: IF FAILED ICMP icmptype icmpoptlist rate1 THEN action1 recovery  */
+#line 1567 "src/p.y"
                                                                                   {
                         icmpset.family = Socket_Ip;
                         icmpset.type = (yyvsp[-5].number);
                         addeventaction(&(icmpset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addicmp(&icmpset);
                   }
-#line 4801 "src/y.tab.c"
+#line 4848 "src/y.tab.c"
     break;
 
-  case 421:
-#line 1493 "src/p.y"
+  case 462: /* icmp: IF FAILED PING icmpoptlist rate1 THEN action1 recovery  */
+#line 1573 "src/p.y"
                                                                          {
                         icmpset.family = Socket_Ip;
                         addeventaction(&(icmpset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addicmp(&icmpset);
                  }
-#line 4811 "src/y.tab.c"
+#line 4858 "src/y.tab.c"
     break;
 
-  case 422:
-#line 1498 "src/p.y"
+  case 463: /* icmp: IF FAILED PING4 icmpoptlist rate1 THEN action1 recovery  */
+#line 1578 "src/p.y"
                                                                           {
                         icmpset.family = Socket_Ip4;
                         addeventaction(&(icmpset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addicmp(&icmpset);
                  }
-#line 4821 "src/y.tab.c"
+#line 4868 "src/y.tab.c"
     break;
 
-  case 423:
-#line 1503 "src/p.y"
+  case 464: /* icmp: IF FAILED PING6 icmpoptlist rate1 THEN action1 recovery  */
+#line 1583 "src/p.y"
                                                                           {
                         icmpset.family = Socket_Ip6;
                         addeventaction(&(icmpset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addicmp(&icmpset);
                  }
-#line 4831 "src/y.tab.c"
+#line 4878 "src/y.tab.c"
     break;
 
-  case 430:
-#line 1520 "src/p.y"
+  case 471: /* host: %empty  */
+#line 1600 "src/p.y"
                               {
                         portset.hostname = Str_dup(current->type == Service_Host ? current->path : LOCALHOST);
                   }
-#line 4839 "src/y.tab.c"
+#line 4886 "src/y.tab.c"
     break;
 
-  case 431:
-#line 1523 "src/p.y"
+  case 472: /* host: HOST STRING  */
+#line 1603 "src/p.y"
                               {
                         portset.hostname = (yyvsp[0].string);
                   }
-#line 4847 "src/y.tab.c"
+#line 4894 "src/y.tab.c"
     break;
 
-  case 432:
-#line 1528 "src/p.y"
+  case 473: /* port: PORT NUMBER  */
+#line 1608 "src/p.y"
                               {
                         portset.target.net.port = (yyvsp[0].number);
                   }
-#line 4855 "src/y.tab.c"
+#line 4902 "src/y.tab.c"
     break;
 
-  case 433:
-#line 1533 "src/p.y"
+  case 474: /* unixsocket: UNIXSOCKET PATH  */
+#line 1613 "src/p.y"
                                   {
                         portset.family = Socket_Unix;
                         portset.target.unix.pathname = (yyvsp[0].string);
                   }
-#line 4864 "src/y.tab.c"
+#line 4911 "src/y.tab.c"
     break;
 
-  case 434:
-#line 1539 "src/p.y"
+  case 475: /* ip: IPV4  */
+#line 1619 "src/p.y"
                        {
                         portset.family = Socket_Ip4;
                   }
-#line 4872 "src/y.tab.c"
+#line 4919 "src/y.tab.c"
     break;
 
-  case 435:
-#line 1542 "src/p.y"
+  case 476: /* ip: IPV6  */
+#line 1622 "src/p.y"
                        {
                         portset.family = Socket_Ip6;
                   }
-#line 4880 "src/y.tab.c"
+#line 4927 "src/y.tab.c"
     break;
 
-  case 436:
-#line 1547 "src/p.y"
+  case 477: /* type: TYPE TCP  */
+#line 1627 "src/p.y"
                            {
                         portset.type = Socket_Tcp;
                   }
-#line 4888 "src/y.tab.c"
+#line 4935 "src/y.tab.c"
     break;
 
-  case 437:
-#line 1550 "src/p.y"
+  case 478: /* type: TYPE TCPSSL typeoptlist  */
+#line 1630 "src/p.y"
                                           { // The typelist is kept for backward compatibility (replaced by ssloptionlist)
                         portset.type = Socket_Tcp;
                         sslset.flags = SSL_Enabled;
                   }
-#line 4897 "src/y.tab.c"
+#line 4944 "src/y.tab.c"
     break;
 
-  case 438:
-#line 1554 "src/p.y"
+  case 479: /* type: TYPE UDP  */
+#line 1634 "src/p.y"
                            {
                         portset.type = Socket_Udp;
                   }
-#line 4905 "src/y.tab.c"
+#line 4952 "src/y.tab.c"
     break;
 
-  case 443:
-#line 1567 "src/p.y"
+  case 484: /* outgoing: ADDRESS STRING  */
+#line 1647 "src/p.y"
                                  {
                         _parseOutgoingAddress((yyvsp[0].string), &(portset.outgoing));
                   }
-#line 4913 "src/y.tab.c"
+#line 4960 "src/y.tab.c"
     break;
 
-  case 444:
-#line 1572 "src/p.y"
+  case 485: /* protocol: PROTOCOL APACHESTATUS apache_stat_list  */
+#line 1652 "src/p.y"
                                                          {
                         portset.protocol = Protocol_get(Protocol_APACHESTATUS);
                   }
-#line 4921 "src/y.tab.c"
+#line 4968 "src/y.tab.c"
     break;
 
-  case 445:
-#line 1575 "src/p.y"
+  case 486: /* protocol: PROTOCOL DEFAULT  */
+#line 1655 "src/p.y"
                                    {
                         portset.protocol = Protocol_get(Protocol_DEFAULT);
                   }
-#line 4929 "src/y.tab.c"
+#line 4976 "src/y.tab.c"
     break;
 
-  case 446:
-#line 1578 "src/p.y"
+  case 487: /* protocol: PROTOCOL DNS  */
+#line 1658 "src/p.y"
                                {
                         portset.protocol = Protocol_get(Protocol_DNS);
                   }
-#line 4937 "src/y.tab.c"
+#line 4984 "src/y.tab.c"
     break;
 
-  case 447:
-#line 1581 "src/p.y"
+  case 488: /* protocol: PROTOCOL DWP  */
+#line 1661 "src/p.y"
                                 {
                         portset.protocol = Protocol_get(Protocol_DWP);
                   }
-#line 4945 "src/y.tab.c"
+#line 4992 "src/y.tab.c"
     break;
 
-  case 448:
-#line 1584 "src/p.y"
+  case 489: /* protocol: PROTOCOL FAIL2BAN  */
+#line 1664 "src/p.y"
                                     {
                         portset.protocol = Protocol_get(Protocol_FAIL2BAN);
                 }
-#line 4953 "src/y.tab.c"
+#line 5000 "src/y.tab.c"
     break;
 
-  case 449:
-#line 1587 "src/p.y"
+  case 490: /* protocol: PROTOCOL FTP  */
+#line 1667 "src/p.y"
                                {
                         portset.protocol = Protocol_get(Protocol_FTP);
                   }
-#line 4961 "src/y.tab.c"
+#line 5008 "src/y.tab.c"
     break;
 
-  case 450:
-#line 1590 "src/p.y"
+  case 491: /* protocol: PROTOCOL HTTP httplist  */
+#line 1670 "src/p.y"
                                          {
                         portset.protocol = Protocol_get(Protocol_HTTP);
                   }
-#line 4969 "src/y.tab.c"
+#line 5016 "src/y.tab.c"
     break;
 
-  case 451:
-#line 1593 "src/p.y"
+  case 492: /* protocol: PROTOCOL HTTPS httplist  */
+#line 1673 "src/p.y"
                                           {
                         sslset.flags = SSL_Enabled;
                         portset.type = Socket_Tcp;
                         portset.protocol = Protocol_get(Protocol_HTTP);
                  }
-#line 4979 "src/y.tab.c"
+#line 5026 "src/y.tab.c"
     break;
 
-  case 452:
-#line 1598 "src/p.y"
+  case 493: /* protocol: PROTOCOL HTTP2 http2list  */
+#line 1678 "src/p.y"
+                                           {
+                        portset.type = Socket_Tcp;
+                        portset.protocol = Protocol_get(Protocol_HTTP2);
+                  }
+#line 5035 "src/y.tab.c"
+    break;
+
+  case 494: /* protocol: PROTOCOL IMAP  */
+#line 1682 "src/p.y"
                                 {
                         portset.protocol = Protocol_get(Protocol_IMAP);
                   }
-#line 4987 "src/y.tab.c"
+#line 5043 "src/y.tab.c"
     break;
 
-  case 453:
-#line 1601 "src/p.y"
+  case 495: /* protocol: PROTOCOL IMAPS  */
+#line 1685 "src/p.y"
                                  {
                         sslset.flags = SSL_Enabled;
                         portset.type = Socket_Tcp;
                         portset.protocol = Protocol_get(Protocol_IMAP);
                   }
-#line 4997 "src/y.tab.c"
+#line 5053 "src/y.tab.c"
     break;
 
-  case 454:
-#line 1606 "src/p.y"
+  case 496: /* protocol: PROTOCOL CLAMAV  */
+#line 1690 "src/p.y"
                                   {
                         portset.protocol = Protocol_get(Protocol_CLAMAV);
                   }
-#line 5005 "src/y.tab.c"
+#line 5061 "src/y.tab.c"
     break;
 
-  case 455:
-#line 1609 "src/p.y"
+  case 497: /* protocol: PROTOCOL LDAP2  */
+#line 1693 "src/p.y"
                                  {
                         portset.protocol = Protocol_get(Protocol_LDAP2);
                   }
-#line 5013 "src/y.tab.c"
+#line 5069 "src/y.tab.c"
     break;
 
-  case 456:
-#line 1612 "src/p.y"
+  case 498: /* protocol: PROTOCOL LDAP3  */
+#line 1696 "src/p.y"
                                  {
                         portset.protocol = Protocol_get(Protocol_LDAP3);
                   }
-#line 5021 "src/y.tab.c"
+#line 5077 "src/y.tab.c"
     break;
 
-  case 457:
-#line 1615 "src/p.y"
+  case 499: /* protocol: PROTOCOL MONGODB  */
+#line 1699 "src/p.y"
                                     {
                         portset.protocol = Protocol_get(Protocol_MONGODB);
                   }
-#line 5029 "src/y.tab.c"
+#line 5085 "src/y.tab.c"
     break;
 
-  case 458:
-#line 1618 "src/p.y"
+  case 500: /* protocol: PROTOCOL MQTT mqttlist  */
+#line 1702 "src/p.y"
                                          {
                         portset.protocol = Protocol_get(Protocol_MQTT);
                   }
-#line 5037 "src/y.tab.c"
+#line 5093 "src/y.tab.c"
     break;
 
-  case 459:
-#line 1621 "src/p.y"
+  case 501: /* protocol: PROTOCOL MYSQL mysqllist  */
+#line 1705 "src/p.y"
                                            {
                         portset.protocol = Protocol_get(Protocol_MYSQL);
                   }
-#line 5045 "src/y.tab.c"
+#line 5101 "src/y.tab.c"
     break;
 
-  case 460:
-#line 1624 "src/p.y"
+  case 502: /* protocol: PROTOCOL MYSQLS mysqllist  */
+#line 1708 "src/p.y"
                                             {
                         sslset.flags = SSL_StartTLS;
                         portset.protocol = Protocol_get(Protocol_MYSQL);
                   }
-#line 5054 "src/y.tab.c"
+#line 5110 "src/y.tab.c"
     break;
 
-  case 461:
-#line 1628 "src/p.y"
+  case 503: /* protocol: PROTOCOL SIP siplist  */
+#line 1712 "src/p.y"
                                        {
                         portset.protocol = Protocol_get(Protocol_SIP);
                   }
-#line 5062 "src/y.tab.c"
+#line 5118 "src/y.tab.c"
     break;
 
-  case 462:
-#line 1631 "src/p.y"
+  case 504: /* protocol: PROTOCOL NNTP  */
+#line 1715 "src/p.y"
                                 {
                         portset.protocol = Protocol_get(Protocol_NNTP);
                   }
-#line 5070 "src/y.tab.c"
+#line 5126 "src/y.tab.c"
     break;
 
-  case 463:
-#line 1634 "src/p.y"
+  case 505: /* protocol: PROTOCOL NTP3  */
+#line 1718 "src/p.y"
                                  {
                         portset.protocol = Protocol_get(Protocol_NTP3);
                         portset.type = Socket_Udp;
                   }
-#line 5079 "src/y.tab.c"
+#line 5135 "src/y.tab.c"
     break;
 
-  case 464:
-#line 1638 "src/p.y"
+  case 506: /* protocol: PROTOCOL POSTFIXPOLICY  */
+#line 1722 "src/p.y"
                                          {
                         portset.protocol = Protocol_get(Protocol_POSTFIXPOLICY);
                   }
-#line 5087 "src/y.tab.c"
+#line 5143 "src/y.tab.c"
     break;
 
-  case 465:
-#line 1641 "src/p.y"
+  case 507: /* protocol: PROTOCOL POP  */
+#line 1725 "src/p.y"
                                {
                         portset.protocol = Protocol_get(Protocol_POP);
                   }
-#line 5095 "src/y.tab.c"
+#line 5151 "src/y.tab.c"
     break;
 
-  case 466:
-#line 1644 "src/p.y"
+  case 508: /* protocol: PROTOCOL POPS  */
+#line 1728 "src/p.y"
                                 {
                         sslset.flags = SSL_Enabled;
                         portset.type = Socket_Tcp;
                         portset.protocol = Protocol_get(Protocol_POP);
                   }
-#line 5105 "src/y.tab.c"
+#line 5161 "src/y.tab.c"
     break;
 
-  case 467:
-#line 1649 "src/p.y"
+  case 509: /* protocol: PROTOCOL SIEVE  */
+#line 1733 "src/p.y"
                                  {
                         portset.protocol = Protocol_get(Protocol_SIEVE);
                   }
-#line 5113 "src/y.tab.c"
+#line 5169 "src/y.tab.c"
     break;
 
-  case 468:
-#line 1652 "src/p.y"
+  case 510: /* protocol: PROTOCOL SMTP smtplist  */
+#line 1736 "src/p.y"
                                          {
                         portset.protocol = Protocol_get(Protocol_SMTP);
                   }
-#line 5121 "src/y.tab.c"
+#line 5177 "src/y.tab.c"
     break;
 
-  case 469:
-#line 1655 "src/p.y"
+  case 511: /* protocol: PROTOCOL SMTPS smtplist  */
+#line 1739 "src/p.y"
                                           {
                         sslset.flags = SSL_Enabled;
                         portset.type = Socket_Tcp;
                         portset.protocol = Protocol_get(Protocol_SMTP);
                  }
-#line 5131 "src/y.tab.c"
+#line 5187 "src/y.tab.c"
     break;
 
-  case 470:
-#line 1660 "src/p.y"
+  case 512: /* protocol: PROTOCOL SPAMASSASSIN  */
+#line 1744 "src/p.y"
                                         {
                         portset.protocol = Protocol_get(Protocol_SPAMASSASSIN);
                   }
-#line 5139 "src/y.tab.c"
+#line 5195 "src/y.tab.c"
     break;
 
-  case 471:
-#line 1663 "src/p.y"
+  case 513: /* protocol: PROTOCOL SSH  */
+#line 1747 "src/p.y"
                                 {
                         portset.protocol = Protocol_get(Protocol_SSH);
                   }
-#line 5147 "src/y.tab.c"
+#line 5203 "src/y.tab.c"
     break;
 
-  case 472:
-#line 1666 "src/p.y"
+  case 514: /* protocol: PROTOCOL RDATE  */
+#line 1750 "src/p.y"
                                  {
                         portset.protocol = Protocol_get(Protocol_RDATE);
                   }
-#line 5155 "src/y.tab.c"
+#line 5211 "src/y.tab.c"
     break;
 
-  case 473:
-#line 1669 "src/p.y"
+  case 515: /* protocol: PROTOCOL REDIS  */
+#line 1753 "src/p.y"
                                   {
                         portset.protocol = Protocol_get(Protocol_REDIS);
                   }
-#line 5163 "src/y.tab.c"
+#line 5219 "src/y.tab.c"
     break;
 
-  case 474:
-#line 1672 "src/p.y"
+  case 516: /* protocol: PROTOCOL RSYNC  */
+#line 1756 "src/p.y"
                                  {
                         portset.protocol = Protocol_get(Protocol_RSYNC);
                   }
-#line 5171 "src/y.tab.c"
+#line 5227 "src/y.tab.c"
     break;
 
-  case 475:
-#line 1675 "src/p.y"
+  case 517: /* protocol: PROTOCOL TNS  */
+#line 1759 "src/p.y"
                                {
                         portset.protocol = Protocol_get(Protocol_TNS);
                   }
-#line 5179 "src/y.tab.c"
+#line 5235 "src/y.tab.c"
     break;
 
-  case 476:
-#line 1678 "src/p.y"
+  case 518: /* protocol: PROTOCOL PGSQL  */
+#line 1762 "src/p.y"
                                  {
                         portset.protocol = Protocol_get(Protocol_PGSQL);
                   }
-#line 5187 "src/y.tab.c"
+#line 5243 "src/y.tab.c"
     break;
 
-  case 477:
-#line 1681 "src/p.y"
+  case 519: /* protocol: PROTOCOL LMTP  */
+#line 1765 "src/p.y"
                                 {
                         portset.protocol = Protocol_get(Protocol_LMTP);
                   }
-#line 5195 "src/y.tab.c"
+#line 5251 "src/y.tab.c"
     break;
 
-  case 478:
-#line 1684 "src/p.y"
+  case 520: /* protocol: PROTOCOL GPS  */
+#line 1768 "src/p.y"
                                {
                         portset.protocol = Protocol_get(Protocol_GPS);
                   }
-#line 5203 "src/y.tab.c"
+#line 5259 "src/y.tab.c"
     break;
 
-  case 479:
-#line 1687 "src/p.y"
+  case 521: /* protocol: PROTOCOL RADIUS radiuslist  */
+#line 1771 "src/p.y"
                                              {
                         portset.protocol = Protocol_get(Protocol_RADIUS);
                   }
-#line 5211 "src/y.tab.c"
+#line 5267 "src/y.tab.c"
     break;
 
-  case 480:
-#line 1690 "src/p.y"
+  case 522: /* protocol: PROTOCOL MEMCACHE  */
+#line 1774 "src/p.y"
                                     {
                         portset.protocol = Protocol_get(Protocol_MEMCACHE);
                   }
-#line 5219 "src/y.tab.c"
+#line 5275 "src/y.tab.c"
     break;
 
-  case 481:
-#line 1693 "src/p.y"
+  case 523: /* protocol: PROTOCOL WEBSOCKET websocketlist  */
+#line 1777 "src/p.y"
                                                    {
                         portset.protocol = Protocol_get(Protocol_WEBSOCKET);
                   }
-#line 5227 "src/y.tab.c"
+#line 5283 "src/y.tab.c"
     break;
 
-  case 482:
-#line 1698 "src/p.y"
+  case 524: /* sendexpect: SEND STRING  */
+#line 1782 "src/p.y"
                               {
                         if (portset.protocol->check == check_default || portset.protocol->check == check_generic) {
                                 portset.protocol = Protocol_get(Protocol_GENERIC);
-                                addgeneric(&portset, (yyvsp[0].string), NULL);
+                                addgeneric(&portset, (yyvsp[0].string), NULL, false);
                         } else {
                                 yyerror("The SEND statement is not allowed in the %s protocol context", portset.protocol->name);
                         }
                   }
-#line 5240 "src/y.tab.c"
+#line 5296 "src/y.tab.c"
     break;
 
-  case 483:
-#line 1706 "src/p.y"
+  case 525: /* sendexpect: EXPECT STRING  */
+#line 1790 "src/p.y"
                                 {
                         if (portset.protocol->check == check_default || portset.protocol->check == check_generic) {
                                 portset.protocol = Protocol_get(Protocol_GENERIC);
-                                addgeneric(&portset, NULL, (yyvsp[0].string));
+                                addgeneric(&portset, NULL, (yyvsp[0].string), false);
                         } else {
                                 yyerror("The EXPECT statement is not allowed in the %s protocol context", portset.protocol->name);
                         }
                   }
-#line 5253 "src/y.tab.c"
+#line 5309 "src/y.tab.c"
     break;
 
-  case 486:
-#line 1720 "src/p.y"
+  case 526: /* sendexpect: EXPECT HEX STRING  */
+#line 1798 "src/p.y"
+                                    {
+                        if (portset.protocol->check == check_default || portset.protocol->check == check_generic) {
+                                portset.protocol = Protocol_get(Protocol_GENERIC);
+                                addgeneric(&portset, NULL, (yyvsp[0].string), true);
+                        } else {
+                                yyerror("The EXPECT statement is not allowed in the %s protocol context", portset.protocol->name);
+                        }
+                  }
+#line 5322 "src/y.tab.c"
+    break;
+
+  case 529: /* websocket: ORIGIN STRING  */
+#line 1812 "src/p.y"
                                 {
                         portset.parameters.websocket.origin = (yyvsp[0].string);
                   }
-#line 5261 "src/y.tab.c"
+#line 5330 "src/y.tab.c"
     break;
 
-  case 487:
-#line 1723 "src/p.y"
+  case 530: /* websocket: REQUEST PATH  */
+#line 1815 "src/p.y"
                                {
                         portset.parameters.websocket.request = (yyvsp[0].string);
                   }
-#line 5269 "src/y.tab.c"
+#line 5338 "src/y.tab.c"
     break;
 
-  case 488:
-#line 1726 "src/p.y"
+  case 531: /* websocket: HOST STRING  */
+#line 1818 "src/p.y"
                               {
                         portset.parameters.websocket.host = (yyvsp[0].string);
                   }
-#line 5277 "src/y.tab.c"
+#line 5346 "src/y.tab.c"
     break;
 
-  case 489:
-#line 1729 "src/p.y"
+  case 532: /* websocket: VERSIONOPT NUMBER  */
+#line 1821 "src/p.y"
                                     {
                         portset.parameters.websocket.version = (yyvsp[0].number);
                   }
-#line 5285 "src/y.tab.c"
+#line 5354 "src/y.tab.c"
     break;
 
-  case 492:
-#line 1738 "src/p.y"
+  case 535: /* smtp: username  */
+#line 1830 "src/p.y"
                            {
                         portset.parameters.smtp.username = (yyvsp[0].string);
                   }
-#line 5293 "src/y.tab.c"
+#line 5362 "src/y.tab.c"
     break;
 
-  case 493:
-#line 1741 "src/p.y"
+  case 536: /* smtp: password  */
+#line 1833 "src/p.y"
                            {
                         portset.parameters.smtp.password = (yyvsp[0].string);
                   }
-#line 5301 "src/y.tab.c"
+#line 5370 "src/y.tab.c"
     break;
 
-  case 496:
-#line 1750 "src/p.y"
+  case 539: /* mqtt: username  */
+#line 1842 "src/p.y"
                            {
                         portset.parameters.mqtt.username = (yyvsp[0].string);
                   }
-#line 5309 "src/y.tab.c"
+#line 5378 "src/y.tab.c"
     break;
 
-  case 497:
-#line 1753 "src/p.y"
+  case 540: /* mqtt: password  */
+#line 1845 "src/p.y"
                            {
                         portset.parameters.mqtt.password = (yyvsp[0].string);
                   }
-#line 5317 "src/y.tab.c"
+#line 5386 "src/y.tab.c"
     break;
 
-  case 500:
-#line 1762 "src/p.y"
+  case 543: /* mysql: username  */
+#line 1854 "src/p.y"
                            {
                         portset.parameters.mysql.username = (yyvsp[0].string);
                   }
-#line 5325 "src/y.tab.c"
+#line 5394 "src/y.tab.c"
     break;
 
-  case 501:
-#line 1765 "src/p.y"
+  case 544: /* mysql: password  */
+#line 1857 "src/p.y"
                            {
                         portset.parameters.mysql.password = (yyvsp[0].string);
                   }
-#line 5333 "src/y.tab.c"
+#line 5402 "src/y.tab.c"
     break;
 
-  case 502:
-#line 1768 "src/p.y"
+  case 545: /* mysql: RSAKEY CHECKSUM checksumoperator STRING  */
+#line 1860 "src/p.y"
                                                           {
                         portset.parameters.mysql.rsaChecksum = (yyvsp[0].string);
                         switch (cleanup_hash_string(portset.parameters.mysql.rsaChecksum)) {
@@ -5347,89 +5416,121 @@ yyreduce:
                                         yyerror2("Unknown checksum type: [%s] is not MD5 nor SHA1", portset.parameters.mysql.rsaChecksum);
                         }
                   }
-#line 5351 "src/y.tab.c"
+#line 5420 "src/y.tab.c"
     break;
 
-  case 503:
-#line 1781 "src/p.y"
+  case 546: /* mysql: RSAKEY CHECKSUM MD5HASH checksumoperator STRING  */
+#line 1873 "src/p.y"
                                                                   {
                         portset.parameters.mysql.rsaChecksum = (yyvsp[0].string);
                         if (cleanup_hash_string(portset.parameters.mysql.rsaChecksum) != 32)
                                 yyerror2("Unknown checksum type: [%s] is not MD5", portset.parameters.mysql.rsaChecksum);
                         portset.parameters.mysql.rsaChecksumType = Hash_Md5;
                   }
-#line 5362 "src/y.tab.c"
+#line 5431 "src/y.tab.c"
     break;
 
-  case 504:
-#line 1787 "src/p.y"
+  case 547: /* mysql: RSAKEY CHECKSUM SHA1HASH checksumoperator STRING  */
+#line 1879 "src/p.y"
                                                                    {
                         portset.parameters.mysql.rsaChecksum = (yyvsp[0].string);
                         if (cleanup_hash_string(portset.parameters.mysql.rsaChecksum) != 40)
                                 yyerror2("Unknown checksum type: [%s] is not SHA1", portset.parameters.mysql.rsaChecksum);
                         portset.parameters.mysql.rsaChecksumType = Hash_Sha1;
                   }
-#line 5373 "src/y.tab.c"
+#line 5442 "src/y.tab.c"
     break;
 
-  case 505:
-#line 1796 "src/p.y"
+  case 548: /* target: TARGET MAILADDR  */
+#line 1888 "src/p.y"
                                   {
                         (yyval.string) = (yyvsp[0].string);
                   }
-#line 5381 "src/y.tab.c"
+#line 5450 "src/y.tab.c"
     break;
 
-  case 506:
-#line 1799 "src/p.y"
+  case 549: /* target: TARGET STRING  */
+#line 1891 "src/p.y"
                                 {
                         (yyval.string) = (yyvsp[0].string);
                   }
-#line 5389 "src/y.tab.c"
+#line 5458 "src/y.tab.c"
     break;
 
-  case 507:
-#line 1804 "src/p.y"
+  case 550: /* maxforward: MAXFORWARD NUMBER  */
+#line 1896 "src/p.y"
                                     {
                         (yyval.number) = verifyMaxForward((yyvsp[0].number));
                   }
-#line 5397 "src/y.tab.c"
+#line 5466 "src/y.tab.c"
     break;
 
-  case 510:
-#line 1813 "src/p.y"
+  case 553: /* sip: target  */
+#line 1905 "src/p.y"
                          {
                         portset.parameters.sip.target = (yyvsp[0].string);
                   }
-#line 5405 "src/y.tab.c"
+#line 5474 "src/y.tab.c"
     break;
 
-  case 511:
-#line 1816 "src/p.y"
+  case 554: /* sip: maxforward  */
+#line 1908 "src/p.y"
                              {
                         portset.parameters.sip.maxforward = (yyvsp[0].number);
                   }
-#line 5413 "src/y.tab.c"
+#line 5482 "src/y.tab.c"
     break;
 
-  case 514:
-#line 1825 "src/p.y"
+  case 557: /* http: username  */
+#line 1917 "src/p.y"
                            {
                         portset.parameters.http.username = (yyvsp[0].string);
                   }
-#line 5421 "src/y.tab.c"
+#line 5490 "src/y.tab.c"
     break;
 
-  case 515:
-#line 1828 "src/p.y"
+  case 558: /* http: password  */
+#line 1920 "src/p.y"
                            {
                         portset.parameters.http.password = (yyvsp[0].string);
                   }
-#line 5429 "src/y.tab.c"
+#line 5498 "src/y.tab.c"
+    break;
+
+  case 567: /* http2: username  */
+#line 1935 "src/p.y"
+                           {
+                        portset.parameters.http.username = (yyvsp[0].string);
+                  }
+#line 5506 "src/y.tab.c"
     break;
 
-  case 522:
-#line 1839 "src/p.y"
+  case 568: /* http2: password  */
+#line 1938 "src/p.y"
+                           {
+                        portset.parameters.http.password = (yyvsp[0].string);
+                  }
+#line 5514 "src/y.tab.c"
+    break;
+
+  case 569: /* http2: REQUEST PATH  */
+#line 1941 "src/p.y"
+                               {
+                        addhttp2stream(&portset, (yyvsp[0].string));
+                  }
+#line 5522 "src/y.tab.c"
+    break;
+
+  case 570: /* http2: REQUEST STRING  */
+#line 1944 "src/p.y"
+                                 {
+                        addhttp2stream(&portset, (yyvsp[0].string));
+                  }
+#line 5530 "src/y.tab.c"
+    break;
+
+  case 575: /* status: STATUS operator NUMBER  */
+#line 1953 "src/p.y"
                                          {
                         if ((yyvsp[0].number) < 0) {
                                 yyerror2("The status value must be greater or equal to 0");
@@ -5438,255 +5539,255 @@ yyreduce:
                         portset.parameters.http.status = (yyvsp[0].number);
                         portset.parameters.http.hasStatus = true;
                   }
-#line 5442 "src/y.tab.c"
+#line 5543 "src/y.tab.c"
     break;
 
-  case 523:
-#line 1849 "src/p.y"
+  case 576: /* method: METHOD GET  */
+#line 1963 "src/p.y"
                              {
                         portset.parameters.http.method = Http_Get;
                   }
-#line 5450 "src/y.tab.c"
+#line 5551 "src/y.tab.c"
     break;
 
-  case 524:
-#line 1852 "src/p.y"
+  case 577: /* method: METHOD HEAD  */
+#line 1966 "src/p.y"
                               {
                         portset.parameters.http.method = Http_Head;
                   }
-#line 5458 "src/y.tab.c"
+#line 5559 "src/y.tab.c"
     break;
 
-  case 525:
-#line 1857 "src/p.y"
+  case 578: /* request: REQUEST PATH  */
+#line 1971 "src/p.y"
                                {
                         portset.parameters.http.request = Util_urlEncode((yyvsp[0].string), false);
                         FREE((yyvsp[0].string));
                   }
-#line 5467 "src/y.tab.c"
+#line 5568 "src/y.tab.c"
     break;
 
-  case 526:
-#line 1861 "src/p.y"
+  case 579: /* request: REQUEST STRING  */
+#line 1975 "src/p.y"
                                  {
                         portset.parameters.http.request = Util_urlEncode((yyvsp[0].string), false);
                         FREE((yyvsp[0].string));
                   }
-#line 5476 "src/y.tab.c"
+#line 5577 "src/y.tab.c"
     break;
 
-  case 527:
-#line 1867 "src/p.y"
+  case 580: /* responsesum: CHECKSUM STRING  */
+#line 1981 "src/p.y"
                                   {
                         portset.parameters.http.checksum = (yyvsp[0].string);
                   }
-#line 5484 "src/y.tab.c"
+#line 5585 "src/y.tab.c"
     break;
 
-  case 528:
-#line 1872 "src/p.y"
+  case 581: /* hostheader: HOSTHEADER STRING  */
+#line 1986 "src/p.y"
                                     {
                         addhttpheader(&portset, Str_cat("Host:%s", (yyvsp[0].string)));
                         FREE((yyvsp[0].string));
                   }
-#line 5493 "src/y.tab.c"
+#line 5594 "src/y.tab.c"
     break;
 
-  case 530:
-#line 1879 "src/p.y"
+  case 583: /* httpheaderlist: httpheaderlist HTTPHEADER  */
+#line 1993 "src/p.y"
                                             {
                         addhttpheader(&portset, (yyvsp[0].string));
                  }
-#line 5501 "src/y.tab.c"
+#line 5602 "src/y.tab.c"
     break;
 
-  case 531:
-#line 1884 "src/p.y"
+  case 584: /* secret: SECRET STRING  */
+#line 1998 "src/p.y"
                                 {
                         (yyval.string) = (yyvsp[0].string);
                   }
-#line 5509 "src/y.tab.c"
+#line 5610 "src/y.tab.c"
     break;
 
-  case 534:
-#line 1893 "src/p.y"
+  case 587: /* radius: secret  */
+#line 2007 "src/p.y"
                          {
                         portset.parameters.radius.secret = (yyvsp[0].string);
                   }
-#line 5517 "src/y.tab.c"
+#line 5618 "src/y.tab.c"
     break;
 
-  case 537:
-#line 1902 "src/p.y"
+  case 590: /* apache_stat: username  */
+#line 2016 "src/p.y"
                            {
                         portset.parameters.apachestatus.username = (yyvsp[0].string);
                   }
-#line 5525 "src/y.tab.c"
+#line 5626 "src/y.tab.c"
     break;
 
-  case 538:
-#line 1905 "src/p.y"
+  case 591: /* apache_stat: password  */
+#line 2019 "src/p.y"
                            {
                         portset.parameters.apachestatus.password = (yyvsp[0].string);
                   }
-#line 5533 "src/y.tab.c"
+#line 5634 "src/y.tab.c"
     break;
 
-  case 539:
-#line 1908 "src/p.y"
+  case 592: /* apache_stat: PATHTOK PATH  */
+#line 2022 "src/p.y"
                                {
                         portset.parameters.apachestatus.path = (yyvsp[0].string);
                   }
-#line 5541 "src/y.tab.c"
+#line 5642 "src/y.tab.c"
     break;
 
-  case 540:
-#line 1911 "src/p.y"
+  case 593: /* apache_stat: LOGLIMIT operator NUMBER PERCENT  */
+#line 2025 "src/p.y"
                                                    {
                         portset.parameters.apachestatus.loglimitOP = (yyvsp[-2].number);
                         portset.parameters.apachestatus.loglimit = (yyvsp[-1].number);
                   }
-#line 5550 "src/y.tab.c"
+#line 5651 "src/y.tab.c"
     break;
 
-  case 541:
-#line 1915 "src/p.y"
+  case 594: /* apache_stat: CLOSELIMIT operator NUMBER PERCENT  */
+#line 2029 "src/p.y"
                                                      {
                         portset.parameters.apachestatus.closelimitOP = (yyvsp[-2].number);
                         portset.parameters.apachestatus.closelimit = (yyvsp[-1].number);
                   }
-#line 5559 "src/y.tab.c"
+#line 5660 "src/y.tab.c"
     break;
 
-  case 542:
-#line 1919 "src/p.y"
+  case 595: /* apache_stat: DNSLIMIT operator NUMBER PERCENT  */
+#line 2033 "src/p.y"
                                                    {
                         portset.parameters.apachestatus.dnslimitOP = (yyvsp[-2].number);
                         portset.parameters.apachestatus.dnslimit = (yyvsp[-1].number);
                   }
-#line 5568 "src/y.tab.c"
+#line 5669 "src/y.tab.c"
     break;
 
-  case 543:
-#line 1923 "src/p.y"
+  case 596: /* apache_stat: KEEPALIVELIMIT operator NUMBER PERCENT  */
+#line 2037 "src/p.y"
                                                          {
                         portset.parameters.apachestatus.keepalivelimitOP = (yyvsp[-2].number);
                         portset.parameters.apachestatus.keepalivelimit = (yyvsp[-1].number);
                   }
-#line 5577 "src/y.tab.c"
+#line 5678 "src/y.tab.c"
     break;
 
-  case 544:
-#line 1927 "src/p.y"
+  case 597: /* apache_stat: REPLYLIMIT operator NUMBER PERCENT  */
+#line 2041 "src/p.y"
                                                      {
                         portset.parameters.apachestatus.replylimitOP = (yyvsp[-2].number);
                         portset.parameters.apachestatus.replylimit = (yyvsp[-1].number);
                   }
-#line 5586 "src/y.tab.c"
+#line 5687 "src/y.tab.c"
     break;
 
-  case 545:
-#line 1931 "src/p.y"
+  case 598: /* apache_stat: REQUESTLIMIT operator NUMBER PERCENT  */
+#line 2045 "src/p.y"
                                                        {
                         portset.parameters.apachestatus.requestlimitOP = (yyvsp[-2].number);
                         portset.parameters.apachestatus.requestlimit = (yyvsp[-1].number);
                   }
-#line 5595 "src/y.tab.c"
+#line 5696 "src/y.tab.c"
     break;
 
-  case 546:
-#line 1935 "src/p.y"
+  case 599: /* apache_stat: STARTLIMIT operator NUMBER PERCENT  */
+#line 2049 "src/p.y"
                                                      {
                         portset.parameters.apachestatus.startlimitOP = (yyvsp[-2].number);
                         portset.parameters.apachestatus.startlimit = (yyvsp[-1].number);
                   }
-#line 5604 "src/y.tab.c"
+#line 5705 "src/y.tab.c"
     break;
 
-  case 547:
-#line 1939 "src/p.y"
+  case 600: /* apache_stat: WAITLIMIT operator NUMBER PERCENT  */
+#line 2053 "src/p.y"
                                                     {
                         portset.parameters.apachestatus.waitlimitOP = (yyvsp[-2].number);
                         portset.parameters.apachestatus.waitlimit = (yyvsp[-1].number);
                   }
-#line 5613 "src/y.tab.c"
+#line 5714 "src/y.tab.c"
     break;
 
-  case 548:
-#line 1943 "src/p.y"
+  case 601: /* apache_stat: GRACEFULLIMIT operator NUMBER PERCENT  */
+#line 2057 "src/p.y"
                                                         {
                         portset.parameters.apachestatus.gracefullimitOP = (yyvsp[-2].number);
                         portset.parameters.apachestatus.gracefullimit = (yyvsp[-1].number);
                   }
-#line 5622 "src/y.tab.c"
+#line 5723 "src/y.tab.c"
     break;
 
-  case 549:
-#line 1947 "src/p.y"
+  case 602: /* apache_stat: CLEANUPLIMIT operator NUMBER PERCENT  */
+#line 2061 "src/p.y"
                                                        {
                         portset.parameters.apachestatus.cleanuplimitOP = (yyvsp[-2].number);
                         portset.parameters.apachestatus.cleanuplimit = (yyvsp[-1].number);
                   }
-#line 5631 "src/y.tab.c"
+#line 5732 "src/y.tab.c"
     break;
 
-  case 550:
-#line 1953 "src/p.y"
+  case 603: /* exist: IF NOT EXIST rate1 THEN action1 recovery  */
+#line 2067 "src/p.y"
                                                            {
                         addeventaction(&(nonexistset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addnonexist(&nonexistset);
                   }
-#line 5640 "src/y.tab.c"
+#line 5741 "src/y.tab.c"
     break;
 
-  case 551:
-#line 1957 "src/p.y"
+  case 604: /* exist: IF EXIST rate1 THEN action1 recovery  */
+#line 2071 "src/p.y"
                                                        {
                         addeventaction(&(existset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addexist(&existset);
                   }
-#line 5649 "src/y.tab.c"
+#line 5750 "src/y.tab.c"
     break;
 
-  case 552:
-#line 1964 "src/p.y"
+  case 605: /* pid: IF CHANGED PID rate1 THEN action1  */
+#line 2078 "src/p.y"
                                                     {
                         addeventaction(&(pidset).action, (yyvsp[0].number), Action_Ignored);
                         addpid(&pidset);
                   }
-#line 5658 "src/y.tab.c"
+#line 5759 "src/y.tab.c"
     break;
 
-  case 553:
-#line 1970 "src/p.y"
+  case 606: /* ppid: IF CHANGED PPID rate1 THEN action1  */
+#line 2084 "src/p.y"
                                                      {
                         addeventaction(&(ppidset).action, (yyvsp[0].number), Action_Ignored);
                         addppid(&ppidset);
                   }
-#line 5667 "src/y.tab.c"
+#line 5768 "src/y.tab.c"
     break;
 
-  case 554:
-#line 1976 "src/p.y"
+  case 607: /* uptime: IF UPTIME operator NUMBER time rate1 THEN action1 recovery  */
+#line 2090 "src/p.y"
                                                                              {
                         uptimeset.operator = (yyvsp[-6].number);
                         uptimeset.uptime = ((unsigned long long)(yyvsp[-5].number) * (yyvsp[-4].number));
                         addeventaction(&(uptimeset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         adduptime(&uptimeset);
                   }
-#line 5678 "src/y.tab.c"
+#line 5779 "src/y.tab.c"
     break;
 
-  case 555:
-#line 1984 "src/p.y"
+  case 608: /* icmpcount: COUNT NUMBER  */
+#line 2098 "src/p.y"
                                {
                         icmpset.count = (yyvsp[0].number);
                  }
-#line 5686 "src/y.tab.c"
+#line 5787 "src/y.tab.c"
     break;
 
-  case 556:
-#line 1989 "src/p.y"
+  case 609: /* icmpsize: SIZE NUMBER  */
+#line 2103 "src/p.y"
                               {
                         icmpset.size = (yyvsp[0].number);
                         if (icmpset.size < 8) {
@@ -5695,508 +5796,582 @@ yyreduce:
                                 yyerror2("The maximum ping size is 1492 bytes");
                         }
                  }
-#line 5699 "src/y.tab.c"
+#line 5800 "src/y.tab.c"
     break;
 
-  case 557:
-#line 1999 "src/p.y"
+  case 610: /* icmptimeout: TIMEOUT NUMBER SECOND  */
+#line 2113 "src/p.y"
                                         {
                         icmpset.timeout = (yyvsp[-1].number) * 1000; // timeout is in milliseconds internally
                     }
-#line 5707 "src/y.tab.c"
+#line 5808 "src/y.tab.c"
     break;
 
-  case 558:
-#line 2004 "src/p.y"
+  case 611: /* icmpoutgoing: ADDRESS STRING  */
+#line 2118 "src/p.y"
                                  {
                         _parseOutgoingAddress((yyvsp[0].string), &(icmpset.outgoing));
                   }
-#line 5715 "src/y.tab.c"
+#line 5816 "src/y.tab.c"
     break;
 
-  case 559:
-#line 2009 "src/p.y"
+  case 612: /* stoptimeout: %empty  */
+#line 2123 "src/p.y"
                               {
                         (yyval.number) = Run.limits.stopTimeout;
                   }
-#line 5723 "src/y.tab.c"
+#line 5824 "src/y.tab.c"
     break;
 
-  case 560:
-#line 2012 "src/p.y"
+  case 613: /* stoptimeout: TIMEOUT NUMBER SECOND  */
+#line 2126 "src/p.y"
                                         {
                         (yyval.number) = (yyvsp[-1].number) * 1000; // milliseconds internally
                   }
-#line 5731 "src/y.tab.c"
+#line 5832 "src/y.tab.c"
     break;
 
-  case 561:
-#line 2017 "src/p.y"
+  case 614: /* starttimeout: %empty  */
+#line 2131 "src/p.y"
                               {
                         (yyval.number) = Run.limits.startTimeout;
                   }
-#line 5739 "src/y.tab.c"
+#line 5840 "src/y.tab.c"
     break;
 
-  case 562:
-#line 2020 "src/p.y"
+  case 615: /* starttimeout: TIMEOUT NUMBER SECOND  */
+#line 2134 "src/p.y"
                                         {
                         (yyval.number) = (yyvsp[-1].number) * 1000; // milliseconds internally
                   }
-#line 5747 "src/y.tab.c"
+#line 5848 "src/y.tab.c"
     break;
 
-  case 563:
-#line 2025 "src/p.y"
+  case 616: /* restarttimeout: %empty  */
+#line 2139 "src/p.y"
                               {
                         (yyval.number) = Run.limits.restartTimeout;
                   }
-#line 5755 "src/y.tab.c"
+#line 5856 "src/y.tab.c"
     break;
 
-  case 564:
-#line 2028 "src/p.y"
+  case 617: /* restarttimeout: TIMEOUT NUMBER SECOND  */
+#line 2142 "src/p.y"
                                         {
                         (yyval.number) = (yyvsp[-1].number) * 1000; // milliseconds internally
                   }
-#line 5763 "src/y.tab.c"
+#line 5864 "src/y.tab.c"
     break;
 
-  case 565:
-#line 2033 "src/p.y"
+  case 618: /* programtimeout: %empty  */
+#line 2147 "src/p.y"
                               {
                         (yyval.number) = Run.limits.programTimeout;
                   }
-#line 5771 "src/y.tab.c"
+#line 5872 "src/y.tab.c"
     break;
 
-  case 566:
-#line 2036 "src/p.y"
+  case 619: /* programtimeout: TIMEOUT NUMBER SECOND  */
+#line 2150 "src/p.y"
                                         {
                         (yyval.number) = (yyvsp[-1].number) * 1000; // milliseconds internally
                   }
-#line 5779 "src/y.tab.c"
+#line 5880 "src/y.tab.c"
     break;
 
-  case 567:
-#line 2041 "src/p.y"
+  case 620: /* nettimeout: %empty  */
+#line 2155 "src/p.y"
                               {
                         (yyval.number) = Run.limits.networkTimeout;
                   }
-#line 5787 "src/y.tab.c"
+#line 5888 "src/y.tab.c"
     break;
 
-  case 568:
-#line 2044 "src/p.y"
+  case 621: /* nettimeout: TIMEOUT NUMBER SECOND  */
+#line 2158 "src/p.y"
                                         {
                         (yyval.number) = (yyvsp[-1].number) * 1000; // net timeout is in milliseconds internally
                   }
-#line 5795 "src/y.tab.c"
+#line 5896 "src/y.tab.c"
     break;
 
-  case 569:
-#line 2049 "src/p.y"
+  case 622: /* connectiontimeout: TIMEOUT NUMBER SECOND  */
+#line 2163 "src/p.y"
                                           {
                         portset.timeout = (yyvsp[-1].number) * 1000; // timeout is in milliseconds internally
                     }
-#line 5803 "src/y.tab.c"
+#line 5904 "src/y.tab.c"
     break;
 
-  case 570:
-#line 2054 "src/p.y"
+  case 623: /* retry: RETRY NUMBER  */
+#line 2168 "src/p.y"
                                {
                         portset.retry = (yyvsp[0].number);
                   }
-#line 5811 "src/y.tab.c"
+#line 5912 "src/y.tab.c"
+    break;
+
+  case 624: /* persistent: PERSISTENT  */
+#line 2173 "src/p.y"
+                             {
+                        portset.persistent = true;
+                  }
+#line 5920 "src/y.tab.c"
     break;
 
-  case 571:
-#line 2059 "src/p.y"
+  case 625: /* timing: timingphase operator NUMBER MILLISECOND  */
+#line 2178 "src/p.y"
+                                                          {
+                        addtiming((yyvsp[-3].number), (yyvsp[-2].number), (yyvsp[-1].number));
+                  }
+#line 5928 "src/y.tab.c"
+    break;
+
+  case 626: /* timing: timingphase operator value SECOND  */
+#line 2181 "src/p.y"
+                                                    {
+                        addtiming((yyvsp[-3].number), (yyvsp[-2].number), (yyvsp[-1].real) * 1000.);
+                  }
+#line 5936 "src/y.tab.c"
+    break;
+
+  case 627: /* timing: RETRANSMITS operator NUMBER  */
+#line 2184 "src/p.y"
+                                              {
+                        addtiming(Timing_Retransmits, (yyvsp[-1].number), (yyvsp[0].number));
+                  }
+#line 5944 "src/y.tab.c"
+    break;
+
+  case 628: /* timingphase: DNSTIME  */
+#line 2189 "src/p.y"
+                               { (yyval.number) = Timing_Dns; }
+#line 5950 "src/y.tab.c"
+    break;
+
+  case 629: /* timingphase: CONNECTTIME  */
+#line 2190 "src/p.y"
+                               { (yyval.number) = Timing_Connect; }
+#line 5956 "src/y.tab.c"
+    break;
+
+  case 630: /* timingphase: TLSHANDSHAKE  */
+#line 2191 "src/p.y"
+                               { (yyval.number) = Timing_Tls; }
+#line 5962 "src/y.tab.c"
+    break;
+
+  case 631: /* timingphase: REQUESTTIME  */
+#line 2192 "src/p.y"
+                               { (yyval.number) = Timing_Request; }
+#line 5968 "src/y.tab.c"
+    break;
+
+  case 632: /* timingphase: FIRSTBYTE  */
+#line 2193 "src/p.y"
+                               { (yyval.number) = Timing_FirstByte; }
+#line 5974 "src/y.tab.c"
+    break;
+
+  case 633: /* timingphase: RESPONSETIME  */
+#line 2194 "src/p.y"
+                               { (yyval.number) = Timing_Total; }
+#line 5980 "src/y.tab.c"
+    break;
+
+  case 634: /* timingphase: RTT  */
+#line 2195 "src/p.y"
+                               { (yyval.number) = Timing_Rtt; }
+#line 5986 "src/y.tab.c"
+    break;
+
+  case 635: /* actionrate: IF NUMBER RESTART NUMBER CYCLE THEN action1  */
+#line 2198 "src/p.y"
                                                               {
                         actionrateset.count = (yyvsp[-5].number);
                         actionrateset.cycle = (yyvsp[-3].number);
                         addeventaction(&(actionrateset).action, (yyvsp[0].number), Action_Alert);
                         addactionrate(&actionrateset);
                   }
-#line 5822 "src/y.tab.c"
+#line 5997 "src/y.tab.c"
     break;
 
-  case 572:
-#line 2065 "src/p.y"
+  case 636: /* actionrate: IF NUMBER RESTART NUMBER CYCLE THEN TIMEOUT  */
+#line 2204 "src/p.y"
                                                               {
                         actionrateset.count = (yyvsp[-5].number);
                         actionrateset.cycle = (yyvsp[-3].number);
                         addeventaction(&(actionrateset).action, Action_Unmonitor, Action_Alert);
                         addactionrate(&actionrateset);
                   }
-#line 5833 "src/y.tab.c"
+#line 6008 "src/y.tab.c"
     break;
 
-  case 573:
-#line 2073 "src/p.y"
+  case 637: /* urloption: CONTENT urloperator STRING  */
+#line 2212 "src/p.y"
                                              {
                         seturlrequest((yyvsp[-1].number), (yyvsp[0].string));
                         FREE((yyvsp[0].string));
                   }
-#line 5842 "src/y.tab.c"
+#line 6017 "src/y.tab.c"
     break;
 
-  case 574:
-#line 2079 "src/p.y"
+  case 638: /* urloperator: EQUAL  */
+#line 2218 "src/p.y"
                            { (yyval.number) = Operator_Equal; }
-#line 5848 "src/y.tab.c"
+#line 6023 "src/y.tab.c"
     break;
 
-  case 575:
-#line 2080 "src/p.y"
+  case 639: /* urloperator: NOTEQUAL  */
+#line 2219 "src/p.y"
                            { (yyval.number) = Operator_NotEqual; }
-#line 5854 "src/y.tab.c"
+#line 6029 "src/y.tab.c"
     break;
 
-  case 576:
-#line 2083 "src/p.y"
+  case 640: /* alert: alertmail formatlist reminder  */
+#line 2222 "src/p.y"
                                                 {
                         mailset.events = Event_All;
                         addmail((yyvsp[-2].string), &mailset, &current->maillist);
                   }
-#line 5863 "src/y.tab.c"
+#line 6038 "src/y.tab.c"
     break;
 
-  case 577:
-#line 2087 "src/p.y"
+  case 641: /* alert: alertmail '{' eventoptionlist '}' formatlist reminder  */
+#line 2226 "src/p.y"
                                                                         {
                         addmail((yyvsp[-5].string), &mailset, &current->maillist);
                   }
-#line 5871 "src/y.tab.c"
+#line 6046 "src/y.tab.c"
     break;
 
-  case 578:
-#line 2090 "src/p.y"
+  case 642: /* alert: alertmail NOT '{' eventoptionlist '}' formatlist reminder  */
+#line 2229 "src/p.y"
                                                                             {
                         mailset.events = ~mailset.events;
                         addmail((yyvsp[-6].string), &mailset, &current->maillist);
                   }
-#line 5880 "src/y.tab.c"
+#line 6055 "src/y.tab.c"
     break;
 
-  case 579:
-#line 2094 "src/p.y"
+  case 643: /* alert: noalertmail  */
+#line 2233 "src/p.y"
                               {
                         addmail((yyvsp[0].string), &mailset, &current->maillist);
                   }
-#line 5888 "src/y.tab.c"
+#line 6063 "src/y.tab.c"
     break;
 
-  case 580:
-#line 2099 "src/p.y"
+  case 644: /* alertmail: ALERT MAILADDR  */
+#line 2238 "src/p.y"
                                  { (yyval.string) = (yyvsp[0].string); }
-#line 5894 "src/y.tab.c"
+#line 6069 "src/y.tab.c"
     break;
 
-  case 581:
-#line 2102 "src/p.y"
+  case 645: /* noalertmail: NOALERT MAILADDR  */
+#line 2241 "src/p.y"
                                    { (yyval.string) = (yyvsp[0].string); }
-#line 5900 "src/y.tab.c"
+#line 6075 "src/y.tab.c"
     break;
 
-  case 584:
-#line 2109 "src/p.y"
+  case 648: /* eventoption: ACTION  */
+#line 2248 "src/p.y"
                                   { mailset.events |= Event_Action; }
-#line 5906 "src/y.tab.c"
+#line 6081 "src/y.tab.c"
     break;
 
-  case 585:
-#line 2110 "src/p.y"
+  case 649: /* eventoption: BYTEIN  */
+#line 2249 "src/p.y"
                                   { mailset.events |= Event_ByteIn; }
-#line 5912 "src/y.tab.c"
+#line 6087 "src/y.tab.c"
     break;
 
-  case 586:
-#line 2111 "src/p.y"
+  case 650: /* eventoption: BYTEOUT  */
+#line 2250 "src/p.y"
                                   { mailset.events |= Event_ByteOut; }
-#line 5918 "src/y.tab.c"
+#line 6093 "src/y.tab.c"
     break;
 
-  case 587:
-#line 2112 "src/p.y"
+  case 651: /* eventoption: CHECKSUM  */
+#line 2251 "src/p.y"
                                   { mailset.events |= Event_Checksum; }
-#line 5924 "src/y.tab.c"
+#line 6099 "src/y.tab.c"
     break;
 
-  case 588:
-#line 2113 "src/p.y"
+  case 652: /* eventoption: CONNECTION  */
+#line 2252 "src/p.y"
                                   { mailset.events |= Event_Connection; }
-#line 5930 "src/y.tab.c"
+#line 6105 "src/y.tab.c"
     break;
 
-  case 589:
-#line 2114 "src/p.y"
+  case 653: /* eventoption: CONTENT  */
+#line 2253 "src/p.y"
                                   { mailset.events |= Event_Content; }
-#line 5936 "src/y.tab.c"
+#line 6111 "src/y.tab.c"
     break;
 
-  case 590:
-#line 2115 "src/p.y"
+  case 654: /* eventoption: DATA  */
+#line 2254 "src/p.y"
                                   { mailset.events |= Event_Data; }
-#line 5942 "src/y.tab.c"
+#line 6117 "src/y.tab.c"
     break;
 
-  case 591:
-#line 2116 "src/p.y"
+  case 655: /* eventoption: EXEC  */
+#line 2255 "src/p.y"
                                   { mailset.events |= Event_Exec; }
-#line 5948 "src/y.tab.c"
+#line 6123 "src/y.tab.c"
     break;
 
-  case 592:
-#line 2117 "src/p.y"
+  case 656: /* eventoption: EXIST  */
+#line 2256 "src/p.y"
                                   { mailset.events |= Event_Exist; }
-#line 5954 "src/y.tab.c"
+#line 6129 "src/y.tab.c"
     break;
 
-  case 593:
-#line 2118 "src/p.y"
+  case 657: /* eventoption: FSFLAG  */
+#line 2257 "src/p.y"
                                   { mailset.events |= Event_FsFlag; }
-#line 5960 "src/y.tab.c"
+#line 6135 "src/y.tab.c"
     break;
 
-  case 594:
-#line 2119 "src/p.y"
+  case 658: /* eventoption: GID  */
+#line 2258 "src/p.y"
                                   { mailset.events |= Event_Gid; }
-#line 5966 "src/y.tab.c"
+#line 6141 "src/y.tab.c"
     break;
 
-  case 595:
-#line 2120 "src/p.y"
+  case 659: /* eventoption: ICMP  */
+#line 2259 "src/p.y"
                                   { mailset.events |= Event_Icmp; }
-#line 5972 "src/y.tab.c"
+#line 6147 "src/y.tab.c"
     break;
 
-  case 596:
-#line 2121 "src/p.y"
+  case 660: /* eventoption: INSTANCE  */
+#line 2260 "src/p.y"
                                   { mailset.events |= Event_Instance; }
-#line 5978 "src/y.tab.c"
+#line 6153 "src/y.tab.c"
     break;
 
-  case 597:
-#line 2122 "src/p.y"
+  case 661: /* eventoption: INVALID  */
+#line 2261 "src/p.y"
                                   { mailset.events |= Event_Invalid; }
-#line 5984 "src/y.tab.c"
+#line 6159 "src/y.tab.c"
     break;
 
-  case 598:
-#line 2123 "src/p.y"
+  case 662: /* eventoption: LINK  */
+#line 2262 "src/p.y"
                                   { mailset.events |= Event_Link; }
-#line 5990 "src/y.tab.c"
+#line 6165 "src/y.tab.c"
     break;
 
-  case 599:
-#line 2124 "src/p.y"
+  case 663: /* eventoption: NONEXIST  */
+#line 2263 "src/p.y"
                                   { mailset.events |= Event_NonExist; }
-#line 5996 "src/y.tab.c"
+#line 6171 "src/y.tab.c"
     break;
 
-  case 600:
-#line 2125 "src/p.y"
+  case 664: /* eventoption: PACKETIN  */
+#line 2264 "src/p.y"
                                   { mailset.events |= Event_PacketIn; }
-#line 6002 "src/y.tab.c"
+#line 6177 "src/y.tab.c"
     break;
 
-  case 601:
-#line 2126 "src/p.y"
+  case 665: /* eventoption: PACKETOUT  */
+#line 2265 "src/p.y"
                                   { mailset.events |= Event_PacketOut; }
-#line 6008 "src/y.tab.c"
+#line 6183 "src/y.tab.c"
     break;
 
-  case 602:
-#line 2127 "src/p.y"
+  case 666: /* eventoption: PERMISSION  */
+#line 2266 "src/p.y"
                                   { mailset.events |= Event_Permission; }
-#line 6014 "src/y.tab.c"
+#line 6189 "src/y.tab.c"
     break;
 
-  case 603:
-#line 2128 "src/p.y"
+  case 667: /* eventoption: PID  */
+#line 2267 "src/p.y"
                                   { mailset.events |= Event_Pid; }
-#line 6020 "src/y.tab.c"
+#line 6195 "src/y.tab.c"
     break;
 
-  case 604:
-#line 2129 "src/p.y"
+  case 668: /* eventoption: PPID  */
+#line 2268 "src/p.y"
                                   { mailset.events |= Event_PPid; }
-#line 6026 "src/y.tab.c"
+#line 6201 "src/y.tab.c"
     break;
 
-  case 605:
-#line 2130 "src/p.y"
+  case 669: /* eventoption: RESOURCE  */
+#line 2269 "src/p.y"
                                   { mailset.events |= Event_Resource; }
-#line 6032 "src/y.tab.c"
+#line 6207 "src/y.tab.c"
     break;
 
-  case 606:
-#line 2131 "src/p.y"
+  case 670: /* eventoption: SATURATION  */
+#line 2270 "src/p.y"
                                   { mailset.events |= Event_Saturation; }
-#line 6038 "src/y.tab.c"
+#line 6213 "src/y.tab.c"
     break;
 
-  case 607:
-#line 2132 "src/p.y"
+  case 671: /* eventoption: SIZE  */
+#line 2271 "src/p.y"
                                   { mailset.events |= Event_Size; }
-#line 6044 "src/y.tab.c"
+#line 6219 "src/y.tab.c"
     break;
 
-  case 608:
-#line 2133 "src/p.y"
+  case 672: /* eventoption: SPEED  */
+#line 2272 "src/p.y"
                                   { mailset.events |= Event_Speed; }
-#line 6050 "src/y.tab.c"
+#line 6225 "src/y.tab.c"
     break;
 
-  case 609:
-#line 2134 "src/p.y"
+  case 673: /* eventoption: STATUS  */
+#line 2273 "src/p.y"
                                   { mailset.events |= Event_Status; }
-#line 6056 "src/y.tab.c"
+#line 6231 "src/y.tab.c"
     break;
 
-  case 610:
-#line 2135 "src/p.y"
+  case 674: /* eventoption: TIMEOUT  */
+#line 2274 "src/p.y"
                                   { mailset.events |= Event_Timeout; }
-#line 6062 "src/y.tab.c"
+#line 6237 "src/y.tab.c"
     break;
 
-  case 611:
-#line 2136 "src/p.y"
+  case 675: /* eventoption: TIME  */
+#line 2275 "src/p.y"
                                   { mailset.events |= Event_Timestamp; }
-#line 6068 "src/y.tab.c"
+#line 6243 "src/y.tab.c"
     break;
 
-  case 612:
-#line 2137 "src/p.y"
+  case 676: /* eventoption: UID  */
+#line 2276 "src/p.y"
                                   { mailset.events |= Event_Uid; }
-#line 6074 "src/y.tab.c"
+#line 6249 "src/y.tab.c"
     break;
 
-  case 613:
-#line 2138 "src/p.y"
+  case 677: /* eventoption: UPTIME  */
+#line 2277 "src/p.y"
                                   { mailset.events |= Event_Uptime; }
-#line 6080 "src/y.tab.c"
+#line 6255 "src/y.tab.c"
     break;
 
-  case 618:
-#line 2149 "src/p.y"
+  case 682: /* formatoption: MAILFROM ADDRESSOBJECT  */
+#line 2288 "src/p.y"
                                          { mailset.from = (yyvsp[-1].address); }
-#line 6086 "src/y.tab.c"
+#line 6261 "src/y.tab.c"
     break;
 
-  case 619:
-#line 2150 "src/p.y"
+  case 683: /* formatoption: MAILREPLYTO ADDRESSOBJECT  */
+#line 2289 "src/p.y"
                                             { mailset.replyto = (yyvsp[-1].address); }
-#line 6092 "src/y.tab.c"
+#line 6267 "src/y.tab.c"
     break;
 
-  case 620:
-#line 2151 "src/p.y"
+  case 684: /* formatoption: MAILSUBJECT  */
+#line 2290 "src/p.y"
                               { mailset.subject = (yyvsp[0].string); }
-#line 6098 "src/y.tab.c"
+#line 6273 "src/y.tab.c"
     break;
 
-  case 621:
-#line 2152 "src/p.y"
+  case 685: /* formatoption: MAILBODY  */
+#line 2291 "src/p.y"
                            { mailset.message = (yyvsp[0].string); }
-#line 6104 "src/y.tab.c"
+#line 6279 "src/y.tab.c"
     break;
 
-  case 622:
-#line 2155 "src/p.y"
+  case 686: /* every: EVERY NUMBER CYCLE  */
+#line 2294 "src/p.y"
                                      {
                         current->every.type = Every_SkipCycles;
                         current->every.spec.cycle.counter = current->every.spec.cycle.number = (yyvsp[-1].number);
                  }
-#line 6113 "src/y.tab.c"
+#line 6288 "src/y.tab.c"
     break;
 
-  case 623:
-#line 2159 "src/p.y"
+  case 687: /* every: EVERY TIMESPEC  */
+#line 2298 "src/p.y"
                                  {
                         current->every.type = Every_Cron;
                         current->every.spec.cron = (yyvsp[0].string);
                  }
-#line 6122 "src/y.tab.c"
+#line 6297 "src/y.tab.c"
     break;
 
-  case 624:
-#line 2163 "src/p.y"
+  case 688: /* every: NOTEVERY TIMESPEC  */
+#line 2302 "src/p.y"
                                     {
                         current->every.type = Every_NotInCron;
                         current->every.spec.cron = (yyvsp[0].string);
                  }
-#line 6131 "src/y.tab.c"
+#line 6306 "src/y.tab.c"
     break;
 
-  case 625:
-#line 2169 "src/p.y"
+  case 689: /* mode: MODE ACTIVE  */
+#line 2308 "src/p.y"
                               {
                         current->mode = Monitor_Active;
                   }
-#line 6139 "src/y.tab.c"
+#line 6314 "src/y.tab.c"
     break;
 
-  case 626:
-#line 2172 "src/p.y"
+  case 690: /* mode: MODE PASSIVE  */
+#line 2311 "src/p.y"
                                {
                         current->mode = Monitor_Passive;
                   }
-#line 6147 "src/y.tab.c"
+#line 6322 "src/y.tab.c"
     break;
 
-  case 627:
-#line 2175 "src/p.y"
+  case 691: /* mode: MODE MANUAL  */
+#line 2314 "src/p.y"
                               {
                         // Deprecated since monit 5.18
                         current->onreboot = Onreboot_Laststate;
                   }
-#line 6156 "src/y.tab.c"
+#line 6331 "src/y.tab.c"
     break;
 
-  case 628:
-#line 2181 "src/p.y"
+  case 692: /* onreboot: ONREBOOT START  */
+#line 2320 "src/p.y"
                                  {
                         current->onreboot = Onreboot_Start;
                   }
-#line 6164 "src/y.tab.c"
+#line 6339 "src/y.tab.c"
     break;
 
-  case 629:
-#line 2184 "src/p.y"
+  case 693: /* onreboot: ONREBOOT NOSTART  */
+#line 2323 "src/p.y"
                                    {
                         current->onreboot = Onreboot_Nostart;
                         current->monitor = Monitor_Not;
                   }
-#line 6173 "src/y.tab.c"
+#line 6348 "src/y.tab.c"
     break;
 
-  case 630:
-#line 2188 "src/p.y"
+  case 694: /* onreboot: ONREBOOT LASTSTATE  */
+#line 2327 "src/p.y"
                                      {
                         current->onreboot = Onreboot_Laststate;
                   }
-#line 6181 "src/y.tab.c"
+#line 6356 "src/y.tab.c"
     break;
 
-  case 631:
-#line 2193 "src/p.y"
+  case 695: /* group: GROUP STRINGNAME  */
+#line 2332 "src/p.y"
                                    {
                         addservicegroup((yyvsp[0].string));
                         FREE((yyvsp[0].string));
                   }
-#line 6190 "src/y.tab.c"
+#line 6365 "src/y.tab.c"
     break;
 
-  case 635:
-#line 2207 "src/p.y"
+  case 699: /* dependant: SERVICENAME  */
+#line 2346 "src/p.y"
                               { adddependant((yyvsp[0].string)); }
-#line 6196 "src/y.tab.c"
+#line 6371 "src/y.tab.c"
     break;
 
-  case 636:
-#line 2210 "src/p.y"
+  case 700: /* statusvalue: IF STATUS operator NUMBER rate1 THEN action1 recovery  */
+#line 2349 "src/p.y"
                                                                         {
                         statusset.initialized = true;
                         statusset.operator = (yyvsp[-5].number);
@@ -6204,11 +6379,11 @@ yyreduce:
                         addeventaction(&(statusset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addstatus(&statusset);
                    }
-#line 6208 "src/y.tab.c"
+#line 6383 "src/y.tab.c"
     break;
 
-  case 637:
-#line 2217 "src/p.y"
+  case 701: /* statusvalue: IF CHANGED STATUS rate1 THEN action1  */
+#line 2356 "src/p.y"
                                                        {
                         statusset.initialized = false;
                         statusset.operator = Operator_Changed;
@@ -6216,266 +6391,385 @@ yyreduce:
                         addeventaction(&(statusset).action, (yyvsp[0].number), Action_Ignored);
                         addstatus(&statusset);
                    }
-#line 6220 "src/y.tab.c"
+#line 6395 "src/y.tab.c"
     break;
 
-  case 638:
-#line 2226 "src/p.y"
+  case 702: /* resourceprocess: IF resourceprocesslist rate1 THEN action1 recovery  */
+#line 2365 "src/p.y"
                                                                      {
                         addeventaction(&(resourceset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addresource(&resourceset);
                    }
-#line 6229 "src/y.tab.c"
+#line 6404 "src/y.tab.c"
     break;
 
-  case 648:
-#line 2245 "src/p.y"
+  case 712: /* resourcesystem: IF resourcesystemlist rate1 THEN action1 recovery  */
+#line 2384 "src/p.y"
                                                                     {
                         addeventaction(&(resourceset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addresource(&resourceset);
                    }
-#line 6238 "src/y.tab.c"
+#line 6413 "src/y.tab.c"
     break;
 
-  case 655:
-#line 2261 "src/p.y"
+  case 720: /* resourcedirectory: IF resourcedirectoryopt rate1 THEN action1 recovery  */
+#line 2401 "src/p.y"
+                                                                        {
+                        addeventaction(&(resourceset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                        addresource(&resourceset);
+                   }
+#line 6422 "src/y.tab.c"
+    break;
+
+  case 721: /* resourcedirectoryopt: ENTRIES operator NUMBER  */
+#line 2407 "src/p.y"
+                                               {
+                        resourceset.resource_id = Resource_DirectoryEntries;
+                        resourceset.operator = (yyvsp[-1].number);
+                        resourceset.limit = (yyvsp[0].number);
+                     }
+#line 6432 "src/y.tab.c"
+    break;
+
+  case 722: /* resourcedirectoryopt: TOTAL SIZE operator NUMBER unit  */
+#line 2412 "src/p.y"
+                                                       {
+                        resourceset.resource_id = Resource_DirectorySize;
+                        resourceset.operator = (yyvsp[-2].number);
+                        resourceset.limit = (double)(yyvsp[-1].number) * (yyvsp[0].number);
+                     }
+#line 6442 "src/y.tab.c"
+    break;
+
+  case 723: /* resourcedirectoryopt: OLDEST operator NUMBER time  */
+#line 2417 "src/p.y"
+                                                   {
+                        resourceset.resource_id = Resource_DirectoryOldest;
+                        resourceset.operator = (yyvsp[-2].number);
+                        resourceset.limit = (double)(yyvsp[-1].number) * (yyvsp[0].number);
+                     }
+#line 6452 "src/y.tab.c"
+    break;
+
+  case 724: /* resourcecpuproc: CPU operator value PERCENT  */
+#line 2424 "src/p.y"
                                              {
                         resourceset.resource_id = Resource_CpuPercent;
                         resourceset.operator = (yyvsp[-2].number);
                         resourceset.limit = (yyvsp[-1].real);
                   }
-#line 6248 "src/y.tab.c"
+#line 6462 "src/y.tab.c"
     break;
 
-  case 656:
-#line 2266 "src/p.y"
+  case 725: /* resourcecpuproc: TOTALCPU operator value PERCENT  */
+#line 2429 "src/p.y"
                                                   {
                         resourceset.resource_id = Resource_CpuPercentTotal;
                         resourceset.operator = (yyvsp[-2].number);
                         resourceset.limit = (yyvsp[-1].real);
                   }
-#line 6258 "src/y.tab.c"
+#line 6472 "src/y.tab.c"
     break;
 
-  case 657:
-#line 2273 "src/p.y"
+  case 726: /* resourcecpu: resourcecpuid operator value PERCENT  */
+#line 2436 "src/p.y"
                                                        {
                         resourceset.resource_id = (yyvsp[-3].number);
                         resourceset.operator = (yyvsp[-2].number);
                         resourceset.limit = (yyvsp[-1].real);
                   }
-#line 6268 "src/y.tab.c"
+#line 6482 "src/y.tab.c"
     break;
 
-  case 658:
-#line 2280 "src/p.y"
+  case 727: /* resourcecpuid: CPUUSER  */
+#line 2443 "src/p.y"
                           {
                         if (systeminfo.statisticsAvailable & Statistics_CpuUser)
                                 (yyval.number) = Resource_CpuUser;
                         else
                                 yywarning2("The CPU user usage statistics is not available on this system\n");
                   }
-#line 6279 "src/y.tab.c"
+#line 6493 "src/y.tab.c"
     break;
 
-  case 659:
-#line 2286 "src/p.y"
+  case 728: /* resourcecpuid: CPUSYSTEM  */
+#line 2449 "src/p.y"
                             {
                         if (systeminfo.statisticsAvailable & Statistics_CpuSystem)
                                 (yyval.number) = Resource_CpuSystem;
                         else
                                 yywarning2("The CPU system usage statistics is not available on this system\n");
                   }
-#line 6290 "src/y.tab.c"
+#line 6504 "src/y.tab.c"
     break;
 
-  case 660:
-#line 2292 "src/p.y"
+  case 729: /* resourcecpuid: CPUWAIT  */
+#line 2455 "src/p.y"
                           {
                         if (systeminfo.statisticsAvailable & Statistics_CpuIOWait)
                                 (yyval.number) = Resource_CpuWait;
                         else
                                 yywarning2("The CPU I/O wait usage statistics is not available on this system\n");
                   }
-#line 6301 "src/y.tab.c"
+#line 6515 "src/y.tab.c"
     break;
 
-  case 661:
-#line 2298 "src/p.y"
+  case 730: /* resourcecpuid: CPUNICE  */
+#line 2461 "src/p.y"
                           {
                         if (systeminfo.statisticsAvailable & Statistics_CpuNice)
                                 (yyval.number) = Resource_CpuNice;
                         else
                                 yywarning2("The CPU nice usage statistics is not available on this system\n");
                   }
-#line 6312 "src/y.tab.c"
+#line 6526 "src/y.tab.c"
     break;
 
-  case 662:
-#line 2304 "src/p.y"
+  case 731: /* resourcecpuid: CPUHARDIRQ  */
+#line 2467 "src/p.y"
                              {
                         if (systeminfo.statisticsAvailable & Statistics_CpuHardIRQ)
                                 (yyval.number) = Resource_CpuHardIRQ;
                         else
                                 yywarning2("The CPU hardware IRQ usage statistics is not available on this system\n");
                   }
-#line 6323 "src/y.tab.c"
+#line 6537 "src/y.tab.c"
     break;
 
-  case 663:
-#line 2310 "src/p.y"
+  case 732: /* resourcecpuid: CPUSOFTIRQ  */
+#line 2473 "src/p.y"
                              {
                         if (systeminfo.statisticsAvailable & Statistics_CpuSoftIRQ)
                                 (yyval.number) = Resource_CpuSoftIRQ;
                         else
                                 yywarning2("The CPU software IRQ usage statistics is not available on this system\n");
                   }
-#line 6334 "src/y.tab.c"
+#line 6548 "src/y.tab.c"
     break;
 
-  case 664:
-#line 2316 "src/p.y"
+  case 733: /* resourcecpuid: CPUSTEAL  */
+#line 2479 "src/p.y"
                            {
                         if (systeminfo.statisticsAvailable & Statistics_CpuSteal)
                                 (yyval.number) = Resource_CpuSteal;
                         else
                                 yywarning2("The CPU steal usage statistics is not available on this system\n");
                   }
-#line 6345 "src/y.tab.c"
+#line 6559 "src/y.tab.c"
     break;
 
-  case 665:
-#line 2322 "src/p.y"
+  case 734: /* resourcecpuid: CPUGUEST  */
+#line 2485 "src/p.y"
                            {
                         if (systeminfo.statisticsAvailable & Statistics_CpuGuest)
                                 (yyval.number) = Resource_CpuGuest;
                         else
                                 yywarning2("The CPU guest usage statistics is not available on this system\n");
                   }
-#line 6356 "src/y.tab.c"
+#line 6570 "src/y.tab.c"
     break;
 
-  case 666:
-#line 2328 "src/p.y"
+  case 735: /* resourcecpuid: CPUGUESTNICE  */
+#line 2491 "src/p.y"
                                {
                         if (systeminfo.statisticsAvailable & Statistics_CpuGuestNice)
                                 (yyval.number) = Resource_CpuGuestNice;
                         else
                                 yywarning2("The CPU guest nice usage statistics is not available on this system\n");
                   }
-#line 6367 "src/y.tab.c"
+#line 6581 "src/y.tab.c"
     break;
 
-  case 667:
-#line 2334 "src/p.y"
+  case 736: /* resourcecpuid: CPU  */
+#line 2497 "src/p.y"
                       {
                         (yyval.number) = Resource_CpuPercent;
                   }
-#line 6375 "src/y.tab.c"
+#line 6589 "src/y.tab.c"
     break;
 
-  case 668:
-#line 2339 "src/p.y"
+  case 737: /* resourcemem: MEMORY operator value unit  */
+#line 2502 "src/p.y"
                                              {
                         resourceset.resource_id = Resource_MemoryKbyte;
                         resourceset.operator = (yyvsp[-2].number);
                         resourceset.limit = (yyvsp[-1].real) * (yyvsp[0].number);
                   }
-#line 6385 "src/y.tab.c"
+#line 6599 "src/y.tab.c"
     break;
 
-  case 669:
-#line 2344 "src/p.y"
+  case 738: /* resourcemem: MEMORY operator value PERCENT  */
+#line 2507 "src/p.y"
                                                 {
                         resourceset.resource_id = Resource_MemoryPercent;
                         resourceset.operator = (yyvsp[-2].number);
                         resourceset.limit = (yyvsp[-1].real);
                   }
-#line 6395 "src/y.tab.c"
+#line 6609 "src/y.tab.c"
     break;
 
-  case 670:
-#line 2351 "src/p.y"
+  case 739: /* resourcememproc: MEMORY operator value unit  */
+#line 2514 "src/p.y"
                                              {
                         resourceset.resource_id = Resource_MemoryKbyte;
                         resourceset.operator = (yyvsp[-2].number);
                         resourceset.limit = (yyvsp[-1].real) * (yyvsp[0].number);
                   }
-#line 6405 "src/y.tab.c"
+#line 6619 "src/y.tab.c"
     break;
 
-  case 671:
-#line 2356 "src/p.y"
+  case 740: /* resourcememproc: MEMORY operator value PERCENT  */
+#line 2519 "src/p.y"
                                                 {
                         resourceset.resource_id = Resource_MemoryPercent;
                         resourceset.operator = (yyvsp[-2].number);
                         resourceset.limit = (yyvsp[-1].real);
                   }
-#line 6415 "src/y.tab.c"
+#line 6629 "src/y.tab.c"
     break;
 
-  case 672:
-#line 2361 "src/p.y"
+  case 741: /* resourcememproc: TOTALMEMORY operator value unit  */
+#line 2524 "src/p.y"
                                                   {
                         resourceset.resource_id = Resource_MemoryKbyteTotal;
                         resourceset.operator = (yyvsp[-2].number);
                         resourceset.limit = (yyvsp[-1].real) * (yyvsp[0].number);
                   }
-#line 6425 "src/y.tab.c"
+#line 6639 "src/y.tab.c"
     break;
 
-  case 673:
-#line 2366 "src/p.y"
+  case 742: /* resourcememproc: TOTALMEMORY operator value PERCENT  */
+#line 2529 "src/p.y"
                                                       {
                         resourceset.resource_id = Resource_MemoryPercentTotal;
                         resourceset.operator = (yyvsp[-2].number);
                         resourceset.limit = (yyvsp[-1].real);
                   }
-#line 6435 "src/y.tab.c"
+#line 6649 "src/y.tab.c"
     break;
 
-  case 674:
-#line 2373 "src/p.y"
+  case 743: /* resourceswap: SWAP operator value unit  */
+#line 2536 "src/p.y"
                                            {
                         resourceset.resource_id = Resource_SwapKbyte;
                         resourceset.operator = (yyvsp[-2].number);
                         resourceset.limit = (yyvsp[-1].real) * (yyvsp[0].number);
                   }
-#line 6445 "src/y.tab.c"
+#line 6659 "src/y.tab.c"
     break;
 
-  case 675:
-#line 2378 "src/p.y"
+  case 744: /* resourceswap: SWAP operator value PERCENT  */
+#line 2541 "src/p.y"
                                               {
                         resourceset.resource_id = Resource_SwapPercent;
                         resourceset.operator = (yyvsp[-2].number);
                         resourceset.limit = (yyvsp[-1].real);
                   }
-#line 6455 "src/y.tab.c"
+#line 6669 "src/y.tab.c"
     break;
 
-  case 676:
-#line 2385 "src/p.y"
+  case 745: /* resourcenetstack: TCPRETRANSMITS operator NUMBER currenttime  */
+#line 2548 "src/p.y"
+                                                              {
+                        resourceset.resource_id = Resource_TcpRetransmits;
+                        resourceset.operator = (yyvsp[-2].number);
+                        resourceset.limit = (yyvsp[-1].number);
+                  }
+#line 6679 "src/y.tab.c"
+    break;
+
+  case 746: /* resourcenetstack: TCPRETRANSMITS operator value PERCENT  */
+#line 2553 "src/p.y"
+                                                        {
+                        resourceset.resource_id = Resource_TcpRetransmitsPercent;
+                        resourceset.operator = (yyvsp[-2].number);
+                        resourceset.limit = (yyvsp[-1].real);
+                  }
+#line 6689 "src/y.tab.c"
+    break;
+
+  case 747: /* resourcenetstack: LISTENOVERFLOWS operator NUMBER currenttime  */
+#line 2558 "src/p.y"
+                                                              {
+                        resourceset.resource_id = Resource_TcpListenOverflows;
+                        resourceset.operator = (yyvsp[-2].number);
+                        resourceset.limit = (yyvsp[-1].number);
+                  }
+#line 6699 "src/y.tab.c"
+    break;
+
+  case 748: /* resourcenetstack: LISTENDROPS operator NUMBER currenttime  */
+#line 2563 "src/p.y"
+                                                          {
+                        resourceset.resource_id = Resource_TcpListenDrops;
+                        resourceset.operator = (yyvsp[-2].number);
+                        resourceset.limit = (yyvsp[-1].number);
+                  }
+#line 6709 "src/y.tab.c"
+    break;
+
+  case 749: /* resourcenetstack: SYNCOOKIES operator NUMBER currenttime  */
+#line 2568 "src/p.y"
+                                                         {
+                        resourceset.resource_id = Resource_TcpSynCookies;
+                        resourceset.operator = (yyvsp[-2].number);
+                        resourceset.limit = (yyvsp[-1].number);
+                  }
+#line 6719 "src/y.tab.c"
+    break;
+
+  case 750: /* resourcenetstack: UDPRCVBUFERRORS operator NUMBER currenttime  */
+#line 2573 "src/p.y"
+                                                              {
+                        resourceset.resource_id = Resource_UdpReceiveBufferErrors;
+                        resourceset.operator = (yyvsp[-2].number);
+                        resourceset.limit = (yyvsp[-1].number);
+                  }
+#line 6729 "src/y.tab.c"
+    break;
+
+  case 751: /* resourcenetstack: ORPHANS operator NUMBER  */
+#line 2578 "src/p.y"
+                                          {
+                        resourceset.resource_id = Resource_TcpOrphans;
+                        resourceset.operator = (yyvsp[-1].number);
+                        resourceset.limit = (yyvsp[0].number);
+                  }
+#line 6739 "src/y.tab.c"
+    break;
+
+  case 752: /* resourcenetstack: TIMEWAIT operator NUMBER  */
+#line 2583 "src/p.y"
+                                           {
+                        resourceset.resource_id = Resource_TcpTimeWait;
+                        resourceset.operator = (yyvsp[-1].number);
+                        resourceset.limit = (yyvsp[0].number);
+                  }
+#line 6749 "src/y.tab.c"
+    break;
+
+  case 753: /* resourcethreads: THREADS operator NUMBER  */
+#line 2590 "src/p.y"
                                           {
                         resourceset.resource_id = Resource_Threads;
                         resourceset.operator = (yyvsp[-1].number);
                         resourceset.limit = (yyvsp[0].number);
                   }
-#line 6465 "src/y.tab.c"
+#line 6759 "src/y.tab.c"
     break;
 
-  case 677:
-#line 2392 "src/p.y"
+  case 754: /* resourcechild: CHILDREN operator NUMBER  */
+#line 2597 "src/p.y"
                                            {
                         resourceset.resource_id = Resource_Children;
                         resourceset.operator = (yyvsp[-1].number);
                         resourceset.limit = (yyvsp[0].number);
                   }
-#line 6475 "src/y.tab.c"
+#line 6769 "src/y.tab.c"
     break;
 
-  case 678:
-#line 2399 "src/p.y"
+  case 755: /* resourceload: resourceloadavg coremultiplier operator value  */
+#line 2604 "src/p.y"
                                                                 {
                         switch ((yyvsp[-3].number)) {
                                 case Resource_LoadAverage1m:
@@ -6494,137 +6788,137 @@ yyreduce:
                         resourceset.operator = (yyvsp[-1].number);
                         resourceset.limit = (yyvsp[0].real);
                   }
-#line 6498 "src/y.tab.c"
+#line 6792 "src/y.tab.c"
     break;
 
-  case 679:
-#line 2419 "src/p.y"
+  case 756: /* resourceloadavg: LOADAVG1  */
+#line 2624 "src/p.y"
                             { (yyval.number) = Resource_LoadAverage1m; }
-#line 6504 "src/y.tab.c"
+#line 6798 "src/y.tab.c"
     break;
 
-  case 680:
-#line 2420 "src/p.y"
+  case 757: /* resourceloadavg: LOADAVG5  */
+#line 2625 "src/p.y"
                             { (yyval.number) = Resource_LoadAverage5m; }
-#line 6510 "src/y.tab.c"
+#line 6804 "src/y.tab.c"
     break;
 
-  case 681:
-#line 2421 "src/p.y"
+  case 758: /* resourceloadavg: LOADAVG15  */
+#line 2626 "src/p.y"
                             { (yyval.number) = Resource_LoadAverage15m; }
-#line 6516 "src/y.tab.c"
+#line 6810 "src/y.tab.c"
     break;
 
-  case 682:
-#line 2424 "src/p.y"
+  case 759: /* coremultiplier: %empty  */
+#line 2629 "src/p.y"
                               { (yyval.number) = 1; }
-#line 6522 "src/y.tab.c"
+#line 6816 "src/y.tab.c"
     break;
 
-  case 683:
-#line 2425 "src/p.y"
+  case 760: /* coremultiplier: CORE  */
+#line 2630 "src/p.y"
                               { (yyval.number) = systeminfo.cpu.count; }
-#line 6528 "src/y.tab.c"
+#line 6822 "src/y.tab.c"
     break;
 
-  case 684:
-#line 2429 "src/p.y"
+  case 761: /* resourceread: READ operator value unit currenttime  */
+#line 2634 "src/p.y"
                                                        {
                         resourceset.resource_id = Resource_ReadBytes;
                         resourceset.operator = (yyvsp[-3].number);
                         resourceset.limit = (yyvsp[-2].real) * (yyvsp[-1].number);
                   }
-#line 6538 "src/y.tab.c"
+#line 6832 "src/y.tab.c"
     break;
 
-  case 685:
-#line 2434 "src/p.y"
+  case 762: /* resourceread: DISK READ operator value unit currenttime  */
+#line 2639 "src/p.y"
                                                             {
                         resourceset.resource_id = Resource_ReadBytesPhysical;
                         resourceset.operator = (yyvsp[-3].number);
                         resourceset.limit = (yyvsp[-2].real) * (yyvsp[-1].number);
                   }
-#line 6548 "src/y.tab.c"
+#line 6842 "src/y.tab.c"
     break;
 
-  case 686:
-#line 2439 "src/p.y"
+  case 763: /* resourceread: DISK READ operator NUMBER OPERATION  */
+#line 2644 "src/p.y"
                                                       {
                         resourceset.resource_id = Resource_ReadOperations;
                         resourceset.operator = (yyvsp[-2].number);
                         resourceset.limit = (yyvsp[-1].number);
                   }
-#line 6558 "src/y.tab.c"
+#line 6852 "src/y.tab.c"
     break;
 
-  case 687:
-#line 2446 "src/p.y"
+  case 764: /* resourcewrite: WRITE operator value unit currenttime  */
+#line 2651 "src/p.y"
                                                         {
                         resourceset.resource_id = Resource_WriteBytes;
                         resourceset.operator = (yyvsp[-3].number);
                         resourceset.limit = (yyvsp[-2].real) * (yyvsp[-1].number);
                   }
-#line 6568 "src/y.tab.c"
+#line 6862 "src/y.tab.c"
     break;
 
-  case 688:
-#line 2451 "src/p.y"
+  case 765: /* resourcewrite: DISK WRITE operator value unit currenttime  */
+#line 2656 "src/p.y"
                                                              {
                         resourceset.resource_id = Resource_WriteBytesPhysical;
                         resourceset.operator = (yyvsp[-3].number);
                         resourceset.limit = (yyvsp[-2].real) * (yyvsp[-1].number);
                   }
-#line 6578 "src/y.tab.c"
+#line 6872 "src/y.tab.c"
     break;
 
-  case 689:
-#line 2456 "src/p.y"
+  case 766: /* resourcewrite: DISK WRITE operator NUMBER OPERATION  */
+#line 2661 "src/p.y"
                                                        {
                         resourceset.resource_id = Resource_WriteOperations;
                         resourceset.operator = (yyvsp[-2].number);
                         resourceset.limit = (yyvsp[-1].number);
                   }
-#line 6588 "src/y.tab.c"
+#line 6882 "src/y.tab.c"
     break;
 
-  case 690:
-#line 2463 "src/p.y"
+  case 767: /* value: REAL  */
+#line 2668 "src/p.y"
                        { (yyval.real) = (yyvsp[0].real); }
-#line 6594 "src/y.tab.c"
+#line 6888 "src/y.tab.c"
     break;
 
-  case 691:
-#line 2464 "src/p.y"
+  case 768: /* value: NUMBER  */
+#line 2669 "src/p.y"
                          { (yyval.real) = (float) (yyvsp[0].number); }
-#line 6600 "src/y.tab.c"
+#line 6894 "src/y.tab.c"
     break;
 
-  case 692:
-#line 2467 "src/p.y"
+  case 769: /* timestamptype: TIME  */
+#line 2672 "src/p.y"
                         { (yyval.number) = Timestamp_Default; }
-#line 6606 "src/y.tab.c"
+#line 6900 "src/y.tab.c"
     break;
 
-  case 693:
-#line 2468 "src/p.y"
+  case 770: /* timestamptype: ATIME  */
+#line 2673 "src/p.y"
                         { (yyval.number) = Timestamp_Access; }
-#line 6612 "src/y.tab.c"
+#line 6906 "src/y.tab.c"
     break;
 
-  case 694:
-#line 2469 "src/p.y"
+  case 771: /* timestamptype: CTIME  */
+#line 2674 "src/p.y"
                         { (yyval.number) = Timestamp_Change; }
-#line 6618 "src/y.tab.c"
+#line 6912 "src/y.tab.c"
     break;
 
-  case 695:
-#line 2470 "src/p.y"
+  case 772: /* timestamptype: MTIME  */
+#line 2675 "src/p.y"
                         { (yyval.number) = Timestamp_Modification; }
-#line 6624 "src/y.tab.c"
+#line 6918 "src/y.tab.c"
     break;
 
-  case 696:
-#line 2473 "src/p.y"
+  case 773: /* timestamp: IF timestamptype operator NUMBER time rate1 THEN action1 recovery  */
+#line 2678 "src/p.y"
                                                                                     {
                         timestampset.type = (yyvsp[-7].number);
                         timestampset.operator = (yyvsp[-6].number);
@@ -6632,219 +6926,219 @@ yyreduce:
                         addeventaction(&(timestampset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addtimestamp(&timestampset);
                   }
-#line 6636 "src/y.tab.c"
+#line 6930 "src/y.tab.c"
     break;
 
-  case 697:
-#line 2480 "src/p.y"
+  case 774: /* timestamp: IF CHANGED timestamptype rate1 THEN action1  */
+#line 2685 "src/p.y"
                                                               {
                         timestampset.type = (yyvsp[-3].number);
                         timestampset.test_changes = true;
                         addeventaction(&(timestampset).action, (yyvsp[0].number), Action_Ignored);
                         addtimestamp(&timestampset);
                   }
-#line 6647 "src/y.tab.c"
+#line 6941 "src/y.tab.c"
     break;
 
-  case 698:
-#line 2488 "src/p.y"
+  case 775: /* operator: %empty  */
+#line 2693 "src/p.y"
                                  { (yyval.number) = Operator_Equal; }
-#line 6653 "src/y.tab.c"
+#line 6947 "src/y.tab.c"
     break;
 
-  case 699:
-#line 2489 "src/p.y"
+  case 776: /* operator: GREATER  */
+#line 2694 "src/p.y"
                                  { (yyval.number) = Operator_Greater; }
-#line 6659 "src/y.tab.c"
+#line 6953 "src/y.tab.c"
     break;
 
-  case 700:
-#line 2490 "src/p.y"
+  case 777: /* operator: GREATEROREQUAL  */
+#line 2695 "src/p.y"
                                  { (yyval.number) = Operator_GreaterOrEqual; }
-#line 6665 "src/y.tab.c"
+#line 6959 "src/y.tab.c"
     break;
 
-  case 701:
-#line 2491 "src/p.y"
+  case 778: /* operator: LESS  */
+#line 2696 "src/p.y"
                                  { (yyval.number) = Operator_Less; }
-#line 6671 "src/y.tab.c"
+#line 6965 "src/y.tab.c"
     break;
 
-  case 702:
-#line 2492 "src/p.y"
+  case 779: /* operator: LESSOREQUAL  */
+#line 2697 "src/p.y"
                                  { (yyval.number) = Operator_LessOrEqual; }
-#line 6677 "src/y.tab.c"
+#line 6971 "src/y.tab.c"
     break;
 
-  case 703:
-#line 2493 "src/p.y"
+  case 780: /* operator: EQUAL  */
+#line 2698 "src/p.y"
                                  { (yyval.number) = Operator_Equal; }
-#line 6683 "src/y.tab.c"
+#line 6977 "src/y.tab.c"
     break;
 
-  case 704:
-#line 2494 "src/p.y"
+  case 781: /* operator: NOTEQUAL  */
+#line 2699 "src/p.y"
                                  { (yyval.number) = Operator_NotEqual; }
-#line 6689 "src/y.tab.c"
+#line 6983 "src/y.tab.c"
     break;
 
-  case 705:
-#line 2495 "src/p.y"
+  case 782: /* operator: CHANGED  */
+#line 2700 "src/p.y"
                                  { (yyval.number) = Operator_Changed; }
-#line 6695 "src/y.tab.c"
+#line 6989 "src/y.tab.c"
     break;
 
-  case 706:
-#line 2498 "src/p.y"
+  case 783: /* time: %empty  */
+#line 2703 "src/p.y"
                               { (yyval.number) = Time_Second; }
-#line 6701 "src/y.tab.c"
+#line 6995 "src/y.tab.c"
     break;
 
-  case 707:
-#line 2499 "src/p.y"
+  case 784: /* time: SECOND  */
+#line 2704 "src/p.y"
                               { (yyval.number) = Time_Second; }
-#line 6707 "src/y.tab.c"
+#line 7001 "src/y.tab.c"
     break;
 
-  case 708:
-#line 2500 "src/p.y"
+  case 785: /* time: MINUTE  */
+#line 2705 "src/p.y"
                               { (yyval.number) = Time_Minute; }
-#line 6713 "src/y.tab.c"
+#line 7007 "src/y.tab.c"
     break;
 
-  case 709:
-#line 2501 "src/p.y"
+  case 786: /* time: HOUR  */
+#line 2706 "src/p.y"
                               { (yyval.number) = Time_Hour; }
-#line 6719 "src/y.tab.c"
+#line 7013 "src/y.tab.c"
     break;
 
-  case 710:
-#line 2502 "src/p.y"
+  case 787: /* time: DAY  */
+#line 2707 "src/p.y"
                               { (yyval.number) = Time_Day; }
-#line 6725 "src/y.tab.c"
+#line 7019 "src/y.tab.c"
     break;
 
-  case 711:
-#line 2503 "src/p.y"
+  case 788: /* time: MONTH  */
+#line 2708 "src/p.y"
                               { (yyval.number) = Time_Month; }
-#line 6731 "src/y.tab.c"
+#line 7025 "src/y.tab.c"
     break;
 
-  case 712:
-#line 2506 "src/p.y"
+  case 789: /* totaltime: MINUTE  */
+#line 2711 "src/p.y"
                               { (yyval.number) = Time_Minute; }
-#line 6737 "src/y.tab.c"
+#line 7031 "src/y.tab.c"
     break;
 
-  case 713:
-#line 2507 "src/p.y"
+  case 790: /* totaltime: HOUR  */
+#line 2712 "src/p.y"
                               { (yyval.number) = Time_Hour; }
-#line 6743 "src/y.tab.c"
+#line 7037 "src/y.tab.c"
     break;
 
-  case 714:
-#line 2508 "src/p.y"
+  case 791: /* totaltime: DAY  */
+#line 2713 "src/p.y"
                               { (yyval.number) = Time_Day; }
-#line 6749 "src/y.tab.c"
+#line 7043 "src/y.tab.c"
     break;
 
-  case 715:
-#line 2510 "src/p.y"
+  case 792: /* currenttime: %empty  */
+#line 2715 "src/p.y"
                               { (yyval.number) = Time_Second; }
-#line 6755 "src/y.tab.c"
+#line 7049 "src/y.tab.c"
     break;
 
-  case 716:
-#line 2511 "src/p.y"
+  case 793: /* currenttime: SECOND  */
+#line 2716 "src/p.y"
                               { (yyval.number) = Time_Second; }
-#line 6761 "src/y.tab.c"
+#line 7055 "src/y.tab.c"
     break;
 
-  case 717:
-#line 2513 "src/p.y"
+  case 794: /* repeat: %empty  */
+#line 2718 "src/p.y"
                               {
                         repeat = 0;
                   }
-#line 6769 "src/y.tab.c"
+#line 7063 "src/y.tab.c"
     break;
 
-  case 718:
-#line 2516 "src/p.y"
+  case 795: /* repeat: REPEAT EVERY CYCLE  */
+#line 2721 "src/p.y"
                                      {
                         repeat = 1;
                   }
-#line 6777 "src/y.tab.c"
+#line 7071 "src/y.tab.c"
     break;
 
-  case 719:
-#line 2519 "src/p.y"
+  case 796: /* repeat: REPEAT EVERY NUMBER CYCLE  */
+#line 2724 "src/p.y"
                                             {
                         if ((yyvsp[-1].number) < 0) {
                                 yyerror2("The number of repeat cycles must be greater or equal to 0");
                         }
                         repeat = (yyvsp[-1].number);
                   }
-#line 6788 "src/y.tab.c"
+#line 7082 "src/y.tab.c"
     break;
 
-  case 720:
-#line 2527 "src/p.y"
+  case 797: /* action: ALERT  */
+#line 2732 "src/p.y"
                         {
                         (yyval.number) = Action_Alert;
                   }
-#line 6796 "src/y.tab.c"
+#line 7090 "src/y.tab.c"
     break;
 
-  case 721:
-#line 2530 "src/p.y"
+  case 798: /* action: EXEC argumentlist repeat  */
+#line 2735 "src/p.y"
                                            {
                         (yyval.number) = Action_Exec;
                   }
-#line 6804 "src/y.tab.c"
+#line 7098 "src/y.tab.c"
     break;
 
-  case 722:
-#line 2534 "src/p.y"
+  case 799: /* action: EXEC argumentlist useroptionlist repeat  */
+#line 2739 "src/p.y"
                   {
                         (yyval.number) = Action_Exec;
                   }
-#line 6812 "src/y.tab.c"
+#line 7106 "src/y.tab.c"
     break;
 
-  case 723:
-#line 2537 "src/p.y"
+  case 800: /* action: RESTART  */
+#line 2742 "src/p.y"
                           {
                         (yyval.number) = Action_Restart;
                   }
-#line 6820 "src/y.tab.c"
+#line 7114 "src/y.tab.c"
     break;
 
-  case 724:
-#line 2540 "src/p.y"
+  case 801: /* action: START  */
+#line 2745 "src/p.y"
                         {
                         (yyval.number) = Action_Start;
                   }
-#line 6828 "src/y.tab.c"
+#line 7122 "src/y.tab.c"
     break;
 
-  case 725:
-#line 2543 "src/p.y"
+  case 802: /* action: STOP  */
+#line 2748 "src/p.y"
                        {
                         (yyval.number) = Action_Stop;
                   }
-#line 6836 "src/y.tab.c"
+#line 7130 "src/y.tab.c"
     break;
 
-  case 726:
-#line 2546 "src/p.y"
+  case 803: /* action: UNMONITOR  */
+#line 2751 "src/p.y"
                             {
                         (yyval.number) = Action_Unmonitor;
                   }
-#line 6844 "src/y.tab.c"
+#line 7138 "src/y.tab.c"
     break;
 
-  case 727:
-#line 2551 "src/p.y"
+  case 804: /* action1: action  */
+#line 2756 "src/p.y"
                          {
                         (yyval.number) = (yyvsp[0].number);
                         if ((yyvsp[0].number) == Action_Exec && command) {
@@ -6854,11 +7148,11 @@ yyreduce:
                                 command = NULL;
                         }
                   }
-#line 6858 "src/y.tab.c"
+#line 7152 "src/y.tab.c"
     break;
 
-  case 728:
-#line 2562 "src/p.y"
+  case 805: /* action2: action  */
+#line 2767 "src/p.y"
                          {
                         (yyval.number) = (yyvsp[0].number);
                         if ((yyvsp[0].number) == Action_Exec && command) {
@@ -6868,11 +7162,11 @@ yyreduce:
                                 command = NULL;
                         }
                   }
-#line 6872 "src/y.tab.c"
+#line 7166 "src/y.tab.c"
     break;
 
-  case 729:
-#line 2573 "src/p.y"
+  case 806: /* rateXcycles: NUMBER CYCLE  */
+#line 2778 "src/p.y"
                                {
                         if ((yyvsp[-1].number) < 1 || (unsigned long)(yyvsp[-1].number) > BITMAP_MAX) {
                                 yyerror2("The number of cycles must be between 1 and %zu", BITMAP_MAX);
@@ -6881,11 +7175,11 @@ yyreduce:
                                 rate.cycles = (yyvsp[-1].number);
                         }
                   }
-#line 6885 "src/y.tab.c"
+#line 7179 "src/y.tab.c"
     break;
 
-  case 730:
-#line 2583 "src/p.y"
+  case 807: /* rateXYcycles: NUMBER NUMBER CYCLE  */
+#line 2788 "src/p.y"
                                       {
                         if ((yyvsp[-1].number) < 1 || (unsigned long)(yyvsp[-1].number) > BITMAP_MAX) {
                                 yyerror2("The number of cycles must be between 1 and %zu", BITMAP_MAX);
@@ -6896,131 +7190,143 @@ yyreduce:
                                 rate.cycles = (yyvsp[-1].number);
                         }
                   }
-#line 6900 "src/y.tab.c"
+#line 7194 "src/y.tab.c"
     break;
 
-  case 732:
-#line 2596 "src/p.y"
+  case 809: /* rate1: rateXcycles  */
+#line 2801 "src/p.y"
                               {
                         rate1.count = rate.count;
                         rate1.cycles = rate.cycles;
                         reset_rateset(&rate);
                   }
-#line 6910 "src/y.tab.c"
+#line 7204 "src/y.tab.c"
     break;
 
-  case 733:
-#line 2601 "src/p.y"
+  case 810: /* rate1: rateXYcycles  */
+#line 2806 "src/p.y"
                                {
                         rate1.count = rate.count;
                         rate1.cycles = rate.cycles;
                         reset_rateset(&rate);
                 }
-#line 6920 "src/y.tab.c"
+#line 7214 "src/y.tab.c"
     break;
 
-  case 735:
-#line 2609 "src/p.y"
+  case 812: /* rate2: rateXcycles  */
+#line 2814 "src/p.y"
                               {
                         rate2.count = rate.count;
                         rate2.cycles = rate.cycles;
                         reset_rateset(&rate);
                   }
-#line 6930 "src/y.tab.c"
+#line 7224 "src/y.tab.c"
     break;
 
-  case 736:
-#line 2614 "src/p.y"
+  case 813: /* rate2: rateXYcycles  */
+#line 2819 "src/p.y"
                                {
                         rate2.count = rate.count;
                         rate2.cycles = rate.cycles;
                         reset_rateset(&rate);
                 }
-#line 6940 "src/y.tab.c"
+#line 7234 "src/y.tab.c"
     break;
 
-  case 737:
-#line 2621 "src/p.y"
+  case 814: /* recovery: %empty  */
+#line 2826 "src/p.y"
                               {
                         (yyval.number) = Action_Alert;
                   }
-#line 6948 "src/y.tab.c"
+#line 7242 "src/y.tab.c"
     break;
 
-  case 738:
-#line 2624 "src/p.y"
+  case 815: /* recovery: ELSE IF RECOVERED rate2 THEN action2  */
+#line 2829 "src/p.y"
                                                        {
                         (yyval.number) = (yyvsp[0].number);
                   }
-#line 6956 "src/y.tab.c"
+#line 7250 "src/y.tab.c"
     break;
 
-  case 739:
-#line 2627 "src/p.y"
+  case 816: /* recovery: ELSE IF PASSED rate2 THEN action2  */
+#line 2832 "src/p.y"
                                                     {
                         (yyval.number) = (yyvsp[0].number);
                   }
-#line 6964 "src/y.tab.c"
+#line 7258 "src/y.tab.c"
     break;
 
-  case 740:
-#line 2630 "src/p.y"
+  case 817: /* recovery: ELSE IF SUCCEEDED rate2 THEN action2  */
+#line 2835 "src/p.y"
                                                        {
                         (yyval.number) = (yyvsp[0].number);
                   }
-#line 6972 "src/y.tab.c"
+#line 7266 "src/y.tab.c"
     break;
 
-  case 741:
-#line 2635 "src/p.y"
+  case 818: /* checksum: IF FAILED hashtype CHECKSUM rate1 THEN action1 recovery  */
+#line 2840 "src/p.y"
                                                                           {
                         addeventaction(&(checksumset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addchecksum(&checksumset);
                   }
-#line 6981 "src/y.tab.c"
+#line 7275 "src/y.tab.c"
     break;
 
-  case 742:
-#line 2640 "src/p.y"
+  case 819: /* checksum: IF FAILED hashtype CHECKSUM EXPECT STRING rate1 THEN action1 recovery  */
+#line 2845 "src/p.y"
                            {
                         snprintf(checksumset.hash, sizeof(checksumset.hash), "%s", (yyvsp[-4].string));
                         FREE((yyvsp[-4].string));
                         addeventaction(&(checksumset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addchecksum(&checksumset);
                   }
-#line 6992 "src/y.tab.c"
+#line 7286 "src/y.tab.c"
     break;
 
-  case 743:
-#line 2646 "src/p.y"
+  case 820: /* checksum: IF CHANGED hashtype CHECKSUM rate1 THEN action1  */
+#line 2851 "src/p.y"
                                                                   {
                         checksumset.test_changes = true;
                         addeventaction(&(checksumset).action, (yyvsp[0].number), Action_Ignored);
                         addchecksum(&checksumset);
                   }
-#line 7002 "src/y.tab.c"
+#line 7296 "src/y.tab.c"
     break;
 
-  case 744:
-#line 2652 "src/p.y"
+  case 821: /* hashtype: %empty  */
+#line 2857 "src/p.y"
                               { checksumset.type = Hash_Unknown; }
-#line 7008 "src/y.tab.c"
+#line 7302 "src/y.tab.c"
+    break;
+
+  case 822: /* hashtype: MD5HASH  */
+#line 2858 "src/p.y"
+                              { checksumset.type = Hash_Md5; }
+#line 7308 "src/y.tab.c"
+    break;
+
+  case 823: /* hashtype: SHA1HASH  */
+#line 2859 "src/p.y"
+                              { checksumset.type = Hash_Sha1; }
+#line 7314 "src/y.tab.c"
     break;
 
-  case 745:
-#line 2653 "src/p.y"
-                              { checksumset.type = Hash_Md5; }
-#line 7014 "src/y.tab.c"
+  case 824: /* hashtype: SHA256HASH  */
+#line 2860 "src/p.y"
+                              { checksumset.type = Hash_Sha256; }
+#line 7320 "src/y.tab.c"
     break;
 
-  case 746:
-#line 2654 "src/p.y"
-                              { checksumset.type = Hash_Sha1; }
-#line 7020 "src/y.tab.c"
+  case 825: /* hashtype: XXH64HASH  */
+#line 2861 "src/p.y"
+                              { checksumset.type = Hash_Xxh64; }
+#line 7326 "src/y.tab.c"
     break;
 
-  case 747:
-#line 2657 "src/p.y"
+  case 826: /* inode: IF INODE operator NUMBER rate1 THEN action1 recovery  */
+#line 2864 "src/p.y"
                                                                        {
                         filesystemset.resource = Resource_Inode;
                         filesystemset.operator = (yyvsp[-5].number);
@@ -7028,11 +7334,11 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7032 "src/y.tab.c"
+#line 7338 "src/y.tab.c"
     break;
 
-  case 748:
-#line 2664 "src/p.y"
+  case 827: /* inode: IF INODE operator value PERCENT rate1 THEN action1 recovery  */
+#line 2871 "src/p.y"
                                                                               {
                         filesystemset.resource = Resource_Inode;
                         filesystemset.operator = (yyvsp[-6].number);
@@ -7040,11 +7346,11 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7044 "src/y.tab.c"
+#line 7350 "src/y.tab.c"
     break;
 
-  case 749:
-#line 2671 "src/p.y"
+  case 828: /* inode: IF INODE TFREE operator NUMBER rate1 THEN action1 recovery  */
+#line 2878 "src/p.y"
                                                                              {
                         filesystemset.resource = Resource_InodeFree;
                         filesystemset.operator = (yyvsp[-5].number);
@@ -7052,11 +7358,11 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7056 "src/y.tab.c"
+#line 7362 "src/y.tab.c"
     break;
 
-  case 750:
-#line 2678 "src/p.y"
+  case 829: /* inode: IF INODE TFREE operator value PERCENT rate1 THEN action1 recovery  */
+#line 2885 "src/p.y"
                                                                                     {
                         filesystemset.resource = Resource_InodeFree;
                         filesystemset.operator = (yyvsp[-6].number);
@@ -7064,11 +7370,37 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7068 "src/y.tab.c"
+#line 7374 "src/y.tab.c"
+    break;
+
+  case 830: /* inode: IF INODE TIMETOFULL operator NUMBER time timetofullwindow rate1 THEN action1 recovery  */
+#line 2892 "src/p.y"
+                                                                                                        {
+                        filesystemset.resource = Resource_InodeTimeToFull;
+                        filesystemset.operator = (yyvsp[-7].number);
+                        filesystemset.limit_absolute = (yyvsp[-6].number) * (yyvsp[-5].number);
+                        filesystemset.window = (yyvsp[-4].number) ? (yyvsp[-4].number) : filesystemset.limit_absolute;
+                        addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                        addfilesystem(&filesystemset);
+                  }
+#line 7387 "src/y.tab.c"
+    break;
+
+  case 831: /* space: IF SPACE TIMETOFULL operator NUMBER time timetofullwindow rate1 THEN action1 recovery  */
+#line 2902 "src/p.y"
+                                                                                                        {
+                        filesystemset.resource = Resource_SpaceTimeToFull;
+                        filesystemset.operator = (yyvsp[-7].number);
+                        filesystemset.limit_absolute = (yyvsp[-6].number) * (yyvsp[-5].number);
+                        filesystemset.window = (yyvsp[-4].number) ? (yyvsp[-4].number) : filesystemset.limit_absolute;
+                        addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                        addfilesystem(&filesystemset);
+                  }
+#line 7400 "src/y.tab.c"
     break;
 
-  case 751:
-#line 2687 "src/p.y"
+  case 832: /* space: IF SPACE operator value unit rate1 THEN action1 recovery  */
+#line 2910 "src/p.y"
                                                                            {
                         filesystemset.resource = Resource_Space;
                         filesystemset.operator = (yyvsp[-6].number);
@@ -7076,11 +7408,11 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7080 "src/y.tab.c"
+#line 7412 "src/y.tab.c"
     break;
 
-  case 752:
-#line 2694 "src/p.y"
+  case 833: /* space: IF SPACE operator value PERCENT rate1 THEN action1 recovery  */
+#line 2917 "src/p.y"
                                                                               {
                         filesystemset.resource = Resource_Space;
                         filesystemset.operator = (yyvsp[-6].number);
@@ -7088,11 +7420,11 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7092 "src/y.tab.c"
+#line 7424 "src/y.tab.c"
     break;
 
-  case 753:
-#line 2701 "src/p.y"
+  case 834: /* space: IF SPACE TFREE operator value unit rate1 THEN action1 recovery  */
+#line 2924 "src/p.y"
                                                                                  {
                         filesystemset.resource = Resource_SpaceFree;
                         filesystemset.operator = (yyvsp[-6].number);
@@ -7100,11 +7432,11 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7104 "src/y.tab.c"
+#line 7436 "src/y.tab.c"
     break;
 
-  case 754:
-#line 2708 "src/p.y"
+  case 835: /* space: IF SPACE TFREE operator value PERCENT rate1 THEN action1 recovery  */
+#line 2931 "src/p.y"
                                                                                     {
                         filesystemset.resource = Resource_SpaceFree;
                         filesystemset.operator = (yyvsp[-6].number);
@@ -7112,11 +7444,11 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7116 "src/y.tab.c"
+#line 7448 "src/y.tab.c"
     break;
 
-  case 755:
-#line 2717 "src/p.y"
+  case 836: /* read: IF READ operator value unit currenttime rate1 THEN action1 recovery  */
+#line 2940 "src/p.y"
                                                                                       {
                         filesystemset.resource = Resource_ReadBytes;
                         filesystemset.operator = (yyvsp[-7].number);
@@ -7124,11 +7456,11 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7128 "src/y.tab.c"
+#line 7460 "src/y.tab.c"
     break;
 
-  case 756:
-#line 2724 "src/p.y"
+  case 837: /* read: IF READ operator NUMBER OPERATION rate1 THEN action1 recovery  */
+#line 2947 "src/p.y"
                                                                                 {
                         filesystemset.resource = Resource_ReadOperations;
                         filesystemset.operator = (yyvsp[-6].number);
@@ -7136,11 +7468,35 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7140 "src/y.tab.c"
+#line 7472 "src/y.tab.c"
+    break;
+
+  case 838: /* read: IF READ LATENCY operator NUMBER MILLISECOND rate1 THEN action1 recovery  */
+#line 2954 "src/p.y"
+                                                                                          {
+                        filesystemset.resource = Resource_ReadLatency;
+                        filesystemset.operator = (yyvsp[-6].number);
+                        filesystemset.limit_absolute = (yyvsp[-5].number);
+                        addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                        addfilesystem(&filesystemset);
+                  }
+#line 7484 "src/y.tab.c"
+    break;
+
+  case 839: /* read: IF READ LATENCY operator value SECOND rate1 THEN action1 recovery  */
+#line 2961 "src/p.y"
+                                                                                    {
+                        filesystemset.resource = Resource_ReadLatency;
+                        filesystemset.operator = (yyvsp[-6].number);
+                        filesystemset.limit_absolute = (yyvsp[-5].real) * 1000;
+                        addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                        addfilesystem(&filesystemset);
+                  }
+#line 7496 "src/y.tab.c"
     break;
 
-  case 757:
-#line 2733 "src/p.y"
+  case 840: /* write: IF WRITE operator value unit currenttime rate1 THEN action1 recovery  */
+#line 2970 "src/p.y"
                                                                                        {
                         filesystemset.resource = Resource_WriteBytes;
                         filesystemset.operator = (yyvsp[-7].number);
@@ -7148,11 +7504,11 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7152 "src/y.tab.c"
+#line 7508 "src/y.tab.c"
     break;
 
-  case 758:
-#line 2740 "src/p.y"
+  case 841: /* write: IF WRITE operator NUMBER OPERATION rate1 THEN action1 recovery  */
+#line 2977 "src/p.y"
                                                                                  {
                         filesystemset.resource = Resource_WriteOperations;
                         filesystemset.operator = (yyvsp[-6].number);
@@ -7160,11 +7516,35 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7164 "src/y.tab.c"
+#line 7520 "src/y.tab.c"
+    break;
+
+  case 842: /* write: IF WRITE LATENCY operator NUMBER MILLISECOND rate1 THEN action1 recovery  */
+#line 2984 "src/p.y"
+                                                                                           {
+                        filesystemset.resource = Resource_WriteLatency;
+                        filesystemset.operator = (yyvsp[-6].number);
+                        filesystemset.limit_absolute = (yyvsp[-5].number);
+                        addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                        addfilesystem(&filesystemset);
+                  }
+#line 7532 "src/y.tab.c"
+    break;
+
+  case 843: /* write: IF WRITE LATENCY operator value SECOND rate1 THEN action1 recovery  */
+#line 2991 "src/p.y"
+                                                                                     {
+                        filesystemset.resource = Resource_WriteLatency;
+                        filesystemset.operator = (yyvsp[-6].number);
+                        filesystemset.limit_absolute = (yyvsp[-5].real) * 1000;
+                        addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                        addfilesystem(&filesystemset);
+                  }
+#line 7544 "src/y.tab.c"
     break;
 
-  case 759:
-#line 2749 "src/p.y"
+  case 844: /* servicetime: IF SERVICETIME operator NUMBER MILLISECOND rate1 THEN action1 recovery  */
+#line 3000 "src/p.y"
                                                                                          {
                         filesystemset.resource = Resource_ServiceTime;
                         filesystemset.operator = (yyvsp[-6].number);
@@ -7172,11 +7552,11 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7176 "src/y.tab.c"
+#line 7556 "src/y.tab.c"
     break;
 
-  case 760:
-#line 2756 "src/p.y"
+  case 845: /* servicetime: IF SERVICETIME operator value SECOND rate1 THEN action1 recovery  */
+#line 3007 "src/p.y"
                                                                                    {
                         filesystemset.resource = Resource_ServiceTime;
                         filesystemset.operator = (yyvsp[-6].number);
@@ -7184,70 +7564,122 @@ yyreduce:
                         addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addfilesystem(&filesystemset);
                   }
-#line 7188 "src/y.tab.c"
+#line 7568 "src/y.tab.c"
+    break;
+
+  case 846: /* timetofullwindow: %empty  */
+#line 3016 "src/p.y"
+                              { (yyval.number) = 0; }
+#line 7574 "src/y.tab.c"
+    break;
+
+  case 847: /* timetofullwindow: OVER NUMBER time  */
+#line 3017 "src/p.y"
+                                   {
+                        if ((yyvsp[-1].number) <= 0)
+                                yyerror2("The time-to-full window must be greater than 0");
+                        (yyval.number) = (yyvsp[-1].number) * (yyvsp[0].number);
+                  }
+#line 7584 "src/y.tab.c"
+    break;
+
+  case 848: /* utilization: IF UTILIZATION operator value PERCENT rate1 THEN action1 recovery  */
+#line 3024 "src/p.y"
+                                                                                    {
+                        filesystemset.resource = Resource_Utilization;
+                        filesystemset.operator = (yyvsp[-6].number);
+                        filesystemset.limit_percent = (yyvsp[-5].real);
+                        addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                        addfilesystem(&filesystemset);
+                  }
+#line 7596 "src/y.tab.c"
+    break;
+
+  case 849: /* queuedepth: IF QUEUEDEPTH operator value rate1 THEN action1 recovery  */
+#line 3033 "src/p.y"
+                                                                           {
+                        filesystemset.resource = Resource_QueueDepth;
+                        filesystemset.operator = (yyvsp[-5].number);
+                        filesystemset.limit_percent = (yyvsp[-4].real);
+                        addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                        addfilesystem(&filesystemset);
+                  }
+#line 7608 "src/y.tab.c"
+    break;
+
+  case 850: /* iops: IF IOPS operator NUMBER rate1 THEN action1 recovery  */
+#line 3042 "src/p.y"
+                                                                      {
+                        filesystemset.resource = Resource_Iops;
+                        filesystemset.operator = (yyvsp[-5].number);
+                        filesystemset.limit_absolute = (yyvsp[-4].number);
+                        addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                        addfilesystem(&filesystemset);
+                  }
+#line 7620 "src/y.tab.c"
     break;
 
-  case 761:
-#line 2765 "src/p.y"
+  case 851: /* fsflag: IF CHANGED FSFLAG rate1 THEN action1  */
+#line 3051 "src/p.y"
                                                        {
                         addeventaction(&(fsflagset).action, (yyvsp[0].number), Action_Ignored);
                         addfsflag(&fsflagset);
                   }
-#line 7197 "src/y.tab.c"
+#line 7629 "src/y.tab.c"
     break;
 
-  case 762:
-#line 2771 "src/p.y"
+  case 852: /* unit: %empty  */
+#line 3057 "src/p.y"
                                { (yyval.number) = Unit_Byte; }
-#line 7203 "src/y.tab.c"
+#line 7635 "src/y.tab.c"
     break;
 
-  case 763:
-#line 2772 "src/p.y"
+  case 853: /* unit: BYTE  */
+#line 3058 "src/p.y"
                                { (yyval.number) = Unit_Byte; }
-#line 7209 "src/y.tab.c"
+#line 7641 "src/y.tab.c"
     break;
 
-  case 764:
-#line 2773 "src/p.y"
+  case 854: /* unit: KILOBYTE  */
+#line 3059 "src/p.y"
                                { (yyval.number) = Unit_Kilobyte; }
-#line 7215 "src/y.tab.c"
+#line 7647 "src/y.tab.c"
     break;
 
-  case 765:
-#line 2774 "src/p.y"
+  case 855: /* unit: MEGABYTE  */
+#line 3060 "src/p.y"
                                { (yyval.number) = Unit_Megabyte; }
-#line 7221 "src/y.tab.c"
+#line 7653 "src/y.tab.c"
     break;
 
-  case 766:
-#line 2775 "src/p.y"
+  case 856: /* unit: GIGABYTE  */
+#line 3061 "src/p.y"
                                { (yyval.number) = Unit_Gigabyte; }
-#line 7227 "src/y.tab.c"
+#line 7659 "src/y.tab.c"
     break;
 
-  case 767:
-#line 2778 "src/p.y"
+  case 857: /* permission: IF FAILED PERMISSION NUMBER rate1 THEN action1 recovery  */
+#line 3064 "src/p.y"
                                                                           {
                         permset.perm = check_perm((yyvsp[-4].number));
                         addeventaction(&(permset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addperm(&permset);
                   }
-#line 7237 "src/y.tab.c"
+#line 7669 "src/y.tab.c"
     break;
 
-  case 768:
-#line 2783 "src/p.y"
+  case 858: /* permission: IF CHANGED PERMISSION rate1 THEN action1 recovery  */
+#line 3069 "src/p.y"
                                                                     {
                         permset.test_changes = true;
                         addeventaction(&(permset).action, (yyvsp[-1].number), Action_Ignored);
                         addperm(&permset);
                   }
-#line 7247 "src/y.tab.c"
+#line 7679 "src/y.tab.c"
     break;
 
-  case 769:
-#line 2790 "src/p.y"
+  case 859: /* match: IF CONTENT urloperator PATH rate1 THEN action1  */
+#line 3076 "src/p.y"
                                                                  {
                         matchset.not = (yyvsp[-4].number) == Operator_Equal ? false : true;
                         matchset.ignore = false;
@@ -7256,11 +7688,11 @@ yyreduce:
                         addmatchpath(&matchset, (yyvsp[0].number));
                         FREE((yyvsp[-3].string));
                   }
-#line 7260 "src/y.tab.c"
+#line 7692 "src/y.tab.c"
     break;
 
-  case 770:
-#line 2798 "src/p.y"
+  case 860: /* match: IF CONTENT urloperator STRING rate1 THEN action1  */
+#line 3084 "src/p.y"
                                                                    {
                         matchset.not = (yyvsp[-4].number) == Operator_Equal ? false : true;
                         matchset.ignore = false;
@@ -7268,11 +7700,11 @@ yyreduce:
                         matchset.match_string = (yyvsp[-3].string);
                         addmatch(&matchset, (yyvsp[0].number), 0);
                   }
-#line 7272 "src/y.tab.c"
+#line 7704 "src/y.tab.c"
     break;
 
-  case 771:
-#line 2805 "src/p.y"
+  case 861: /* match: IGNORE CONTENT urloperator PATH  */
+#line 3091 "src/p.y"
                                                   {
                         matchset.not = (yyvsp[-1].number) == Operator_Equal ? false : true;
                         matchset.ignore = true;
@@ -7281,11 +7713,11 @@ yyreduce:
                         addmatchpath(&matchset, Action_Ignored);
                         FREE((yyvsp[0].string));
                   }
-#line 7285 "src/y.tab.c"
+#line 7717 "src/y.tab.c"
     break;
 
-  case 772:
-#line 2813 "src/p.y"
+  case 862: /* match: IGNORE CONTENT urloperator STRING  */
+#line 3099 "src/p.y"
                                                     {
                         matchset.not = (yyvsp[-1].number) == Operator_Equal ? false : true;
                         matchset.ignore = true;
@@ -7293,11 +7725,11 @@ yyreduce:
                         matchset.match_string = (yyvsp[0].string);
                         addmatch(&matchset, Action_Ignored, 0);
                   }
-#line 7297 "src/y.tab.c"
+#line 7729 "src/y.tab.c"
     break;
 
-  case 773:
-#line 2821 "src/p.y"
+  case 863: /* match: IF matchflagnot MATCH PATH rate1 THEN action1  */
+#line 3107 "src/p.y"
                                                                 {
                         matchset.ignore = false;
                         matchset.match_path = (yyvsp[-3].string);
@@ -7305,22 +7737,22 @@ yyreduce:
                         addmatchpath(&matchset, (yyvsp[0].number));
                         FREE((yyvsp[-3].string));
                   }
-#line 7309 "src/y.tab.c"
+#line 7741 "src/y.tab.c"
     break;
 
-  case 774:
-#line 2828 "src/p.y"
+  case 864: /* match: IF matchflagnot MATCH STRING rate1 THEN action1  */
+#line 3114 "src/p.y"
                                                                   {
                         matchset.ignore = false;
                         matchset.match_path = NULL;
                         matchset.match_string = (yyvsp[-3].string);
                         addmatch(&matchset, (yyvsp[0].number), 0);
                   }
-#line 7320 "src/y.tab.c"
+#line 7752 "src/y.tab.c"
     break;
 
-  case 775:
-#line 2834 "src/p.y"
+  case 865: /* match: IGNORE matchflagnot MATCH PATH  */
+#line 3120 "src/p.y"
                                                  {
                         matchset.ignore = true;
                         matchset.match_path = (yyvsp[0].string);
@@ -7328,222 +7760,270 @@ yyreduce:
                         addmatchpath(&matchset, Action_Ignored);
                         FREE((yyvsp[0].string));
                   }
-#line 7332 "src/y.tab.c"
+#line 7764 "src/y.tab.c"
     break;
 
-  case 776:
-#line 2841 "src/p.y"
+  case 866: /* match: IGNORE matchflagnot MATCH STRING  */
+#line 3127 "src/p.y"
                                                    {
                         matchset.ignore = true;
                         matchset.match_path = NULL;
                         matchset.match_string = (yyvsp[0].string);
                         addmatch(&matchset, Action_Ignored, 0);
                   }
-#line 7343 "src/y.tab.c"
+#line 7775 "src/y.tab.c"
     break;
 
-  case 777:
-#line 2849 "src/p.y"
+  case 867: /* matchflagnot: %empty  */
+#line 3135 "src/p.y"
                               {
                         matchset.not = false;
                   }
-#line 7351 "src/y.tab.c"
+#line 7783 "src/y.tab.c"
     break;
 
-  case 778:
-#line 2852 "src/p.y"
+  case 868: /* matchflagnot: NOT  */
+#line 3138 "src/p.y"
                       {
                         matchset.not = true;
                   }
-#line 7359 "src/y.tab.c"
+#line 7791 "src/y.tab.c"
     break;
 
-  case 779:
-#line 2858 "src/p.y"
+  case 869: /* size: IF SIZE operator NUMBER unit rate1 THEN action1 recovery  */
+#line 3144 "src/p.y"
                                                                            {
                         sizeset.operator = (yyvsp[-6].number);
                         sizeset.size = ((unsigned long long)(yyvsp[-5].number) * (yyvsp[-4].number));
                         addeventaction(&(sizeset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addsize(&sizeset);
                   }
-#line 7370 "src/y.tab.c"
+#line 7802 "src/y.tab.c"
     break;
 
-  case 780:
-#line 2864 "src/p.y"
+  case 870: /* size: IF CHANGED SIZE rate1 THEN action1  */
+#line 3150 "src/p.y"
                                                      {
                         sizeset.test_changes = true;
                         addeventaction(&(sizeset).action, (yyvsp[0].number), Action_Ignored);
                         addsize(&sizeset);
                   }
-#line 7380 "src/y.tab.c"
+#line 7812 "src/y.tab.c"
     break;
 
-  case 781:
-#line 2871 "src/p.y"
+  case 871: /* uid: IF FAILED UID STRING rate1 THEN action1 recovery  */
+#line 3157 "src/p.y"
                                                                    {
                         uidset.uid = get_uid((yyvsp[-4].string), 0);
                         addeventaction(&(uidset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         current->uid = adduid(&uidset);
                         FREE((yyvsp[-4].string));
                   }
-#line 7391 "src/y.tab.c"
+#line 7823 "src/y.tab.c"
     break;
 
-  case 782:
-#line 2877 "src/p.y"
+  case 872: /* uid: IF FAILED UID NUMBER rate1 THEN action1 recovery  */
+#line 3163 "src/p.y"
                                                                    {
                     uidset.uid = get_uid(NULL, (yyvsp[-4].number));
                     addeventaction(&(uidset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     current->uid = adduid(&uidset);
                   }
-#line 7401 "src/y.tab.c"
+#line 7833 "src/y.tab.c"
     break;
 
-  case 783:
-#line 2884 "src/p.y"
+  case 873: /* euid: IF FAILED EUID STRING rate1 THEN action1 recovery  */
+#line 3170 "src/p.y"
                                                                     {
                         uidset.uid = get_uid((yyvsp[-4].string), 0);
                         addeventaction(&(uidset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         current->euid = adduid(&uidset);
                         FREE((yyvsp[-4].string));
                   }
-#line 7412 "src/y.tab.c"
+#line 7844 "src/y.tab.c"
     break;
 
-  case 784:
-#line 2890 "src/p.y"
+  case 874: /* euid: IF FAILED EUID NUMBER rate1 THEN action1 recovery  */
+#line 3176 "src/p.y"
                                                                     {
                         uidset.uid = get_uid(NULL, (yyvsp[-4].number));
                         addeventaction(&(uidset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         current->euid = adduid(&uidset);
                   }
-#line 7422 "src/y.tab.c"
+#line 7854 "src/y.tab.c"
     break;
 
-  case 785:
-#line 2897 "src/p.y"
+  case 875: /* secattr: IF FAILED SECURITY ATTRIBUTE STRING rate1 THEN action1 recovery  */
+#line 3183 "src/p.y"
                                                                                   {
                         addsecurityattribute((yyvsp[-4].string), (yyvsp[-1].number), (yyvsp[0].number));
                   }
-#line 7430 "src/y.tab.c"
+#line 7862 "src/y.tab.c"
     break;
 
-  case 786:
-#line 2900 "src/p.y"
+  case 876: /* secattr: IF FAILED SECURITY ATTRIBUTE PATH rate1 THEN action1 recovery  */
+#line 3186 "src/p.y"
                                                                                 {
                         addsecurityattribute((yyvsp[-4].string), (yyvsp[-1].number), (yyvsp[0].number));
                   }
-#line 7438 "src/y.tab.c"
+#line 7870 "src/y.tab.c"
     break;
 
-  case 787:
-#line 2905 "src/p.y"
+  case 877: /* filedescriptorssystem: IF FILEDESCRIPTORS operator NUMBER rate1 THEN action1 recovery  */
+#line 3191 "src/p.y"
                                                                                        {
                         if (systeminfo.statisticsAvailable & Statistics_FiledescriptorsPerSystem)
                                 addfiledescriptors((yyvsp[-5].number), false, (long long)(yyvsp[-4].number), -1., (yyvsp[-1].number), (yyvsp[0].number));
                         else
                                 yywarning("The per-system filedescriptors statistics is not available on this system\n");
                   }
-#line 7449 "src/y.tab.c"
+#line 7881 "src/y.tab.c"
     break;
 
-  case 788:
-#line 2911 "src/p.y"
+  case 878: /* filedescriptorssystem: IF FILEDESCRIPTORS operator value PERCENT rate1 THEN action1 recovery  */
+#line 3197 "src/p.y"
                                                                                         {
                         if (systeminfo.statisticsAvailable & Statistics_FiledescriptorsPerSystem)
                                 addfiledescriptors((yyvsp[-6].number), false, -1LL, (yyvsp[-5].real), (yyvsp[-1].number), (yyvsp[0].number));
                         else
                                 yywarning("The per-system filedescriptors statistics is not available on this system\n");
                   }
-#line 7460 "src/y.tab.c"
+#line 7892 "src/y.tab.c"
+    break;
+
+  case 879: /* listen: IF NOT LISTENING listenaddress PORT NUMBER rate1 THEN action1 recovery  */
+#line 3205 "src/p.y"
+                                                                                         {
+                        addlisten(ListenTest_Exist, (yyvsp[-6].string), (yyvsp[-4].number), Operator_Equal, -1LL, -1., (yyvsp[-1].number), (yyvsp[0].number));
+                  }
+#line 7900 "src/y.tab.c"
+    break;
+
+  case 880: /* listen: IF LISTENQUEUE listenaddress PORT NUMBER operator NUMBER rate1 THEN action1 recovery  */
+#line 3208 "src/p.y"
+                                                                                                       {
+                        addlisten(ListenTest_Queue, (yyvsp[-8].string), (yyvsp[-6].number), (yyvsp[-5].number), (long long)(yyvsp[-4].number), -1., (yyvsp[-1].number), (yyvsp[0].number));
+                  }
+#line 7908 "src/y.tab.c"
+    break;
+
+  case 881: /* listen: IF LISTENQUEUE listenaddress PORT NUMBER operator value PERCENT rate1 THEN action1 recovery  */
+#line 3211 "src/p.y"
+                                                                                                              {
+                        addlisten(ListenTest_Queue, (yyvsp[-9].string), (yyvsp[-7].number), (yyvsp[-6].number), -1LL, (yyvsp[-5].real), (yyvsp[-1].number), (yyvsp[0].number));
+                  }
+#line 7916 "src/y.tab.c"
+    break;
+
+  case 882: /* listen: IF ESTABLISHED listenaddress PORT NUMBER operator NUMBER rate1 THEN action1 recovery  */
+#line 3214 "src/p.y"
+                                                                                                       {
+                        addlisten(ListenTest_Established, (yyvsp[-8].string), (yyvsp[-6].number), (yyvsp[-5].number), (long long)(yyvsp[-4].number), -1., (yyvsp[-1].number), (yyvsp[0].number));
+                  }
+#line 7924 "src/y.tab.c"
+    break;
+
+  case 883: /* listenaddress: %empty  */
+#line 3219 "src/p.y"
+                              {
+                        (yyval.string) = NULL;
+                  }
+#line 7932 "src/y.tab.c"
+    break;
+
+  case 884: /* listenaddress: ADDRESS STRING  */
+#line 3222 "src/p.y"
+                                 {
+                        (yyval.string) = (yyvsp[0].string);
+                  }
+#line 7940 "src/y.tab.c"
     break;
 
-  case 789:
-#line 2919 "src/p.y"
+  case 885: /* filedescriptorsprocess: IF FILEDESCRIPTORS operator NUMBER rate1 THEN action1 recovery  */
+#line 3227 "src/p.y"
                                                                                         {
                         if (systeminfo.statisticsAvailable & Statistics_FiledescriptorsPerProcess)
                                 addfiledescriptors((yyvsp[-5].number), false, (long long)(yyvsp[-4].number), -1., (yyvsp[-1].number), (yyvsp[0].number));
                         else
                                 yywarning("The per-process filedescriptors statistics is not available on this system\n");
                   }
-#line 7471 "src/y.tab.c"
+#line 7951 "src/y.tab.c"
     break;
 
-  case 790:
-#line 2925 "src/p.y"
+  case 886: /* filedescriptorsprocess: IF FILEDESCRIPTORS operator value PERCENT rate1 THEN action1 recovery  */
+#line 3233 "src/p.y"
                                                                                         {
                         if (systeminfo.statisticsAvailable & Statistics_FiledescriptorsPerProcessMax)
                                 addfiledescriptors((yyvsp[-6].number), false, -1LL, (yyvsp[-5].real), (yyvsp[-1].number), (yyvsp[0].number));
                         else
                                 yywarning("The per-process filedescriptors maximum is not exposed on this system, so we cannot compute usage %%, please use the test with absolute value\n");
                   }
-#line 7482 "src/y.tab.c"
+#line 7962 "src/y.tab.c"
     break;
 
-  case 791:
-#line 2933 "src/p.y"
+  case 887: /* filedescriptorsprocesstotal: IF TOTAL FILEDESCRIPTORS operator NUMBER rate1 THEN action1 recovery  */
+#line 3241 "src/p.y"
                                                                                                    {
                         if (systeminfo.statisticsAvailable & Statistics_FiledescriptorsPerProcess)
                                 addfiledescriptors((yyvsp[-5].number), true, (long long)(yyvsp[-4].number), -1., (yyvsp[-1].number), (yyvsp[0].number));
                         else
                                 yywarning("The per-process filedescriptors statistics is not available on this system\n");
                   }
-#line 7493 "src/y.tab.c"
+#line 7973 "src/y.tab.c"
     break;
 
-  case 792:
-#line 2941 "src/p.y"
+  case 888: /* gid: IF FAILED GID STRING rate1 THEN action1 recovery  */
+#line 3249 "src/p.y"
                                                                    {
                         gidset.gid = get_gid((yyvsp[-4].string), 0);
                         addeventaction(&(gidset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         current->gid = addgid(&gidset);
                         FREE((yyvsp[-4].string));
                   }
-#line 7504 "src/y.tab.c"
+#line 7984 "src/y.tab.c"
     break;
 
-  case 793:
-#line 2947 "src/p.y"
+  case 889: /* gid: IF FAILED GID NUMBER rate1 THEN action1 recovery  */
+#line 3255 "src/p.y"
                                                                    {
                         gidset.gid = get_gid(NULL, (yyvsp[-4].number));
                         addeventaction(&(gidset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         current->gid = addgid(&gidset);
                   }
-#line 7514 "src/y.tab.c"
+#line 7994 "src/y.tab.c"
     break;
 
-  case 794:
-#line 2954 "src/p.y"
+  case 890: /* linkstatus: IF FAILED LINK rate1 THEN action1 recovery  */
+#line 3262 "src/p.y"
                                                           {
                         addeventaction(&(linkstatusset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addlinkstatus(current, &linkstatusset);
                   }
-#line 7523 "src/y.tab.c"
+#line 8003 "src/y.tab.c"
     break;
 
-  case 795:
-#line 2960 "src/p.y"
+  case 891: /* linkspeed: IF CHANGED LINK rate1 THEN action1 recovery  */
+#line 3268 "src/p.y"
                                                            {
                         addeventaction(&(linkspeedset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addlinkspeed(current, &linkspeedset);
                   }
-#line 7532 "src/y.tab.c"
+#line 8012 "src/y.tab.c"
     break;
 
-  case 796:
-#line 2965 "src/p.y"
+  case 892: /* linksaturation: IF SATURATION operator NUMBER PERCENT rate1 THEN action1 recovery  */
+#line 3273 "src/p.y"
                                                                                    {
                         linksaturationset.operator = (yyvsp[-6].number);
                         linksaturationset.limit = (unsigned long long)(yyvsp[-5].number);
                         addeventaction(&(linksaturationset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addlinksaturation(current, &linksaturationset);
                   }
-#line 7543 "src/y.tab.c"
+#line 8023 "src/y.tab.c"
     break;
 
-  case 797:
-#line 2973 "src/p.y"
+  case 893: /* upload: IF UPLOAD operator NUMBER unit currenttime rate1 THEN action1 recovery  */
+#line 3281 "src/p.y"
                                                                                          {
                         bandwidthset.operator = (yyvsp[-7].number);
                         bandwidthset.limit = ((unsigned long long)(yyvsp[-6].number) * (yyvsp[-5].number));
@@ -7552,11 +8032,11 @@ yyreduce:
                         addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addbandwidth(&(current->uploadbyteslist), &bandwidthset);
                   }
-#line 7556 "src/y.tab.c"
+#line 8036 "src/y.tab.c"
     break;
 
-  case 798:
-#line 2981 "src/p.y"
+  case 894: /* upload: IF TOTAL UPLOAD operator NUMBER unit totaltime rate1 THEN action1 recovery  */
+#line 3289 "src/p.y"
                                                                                              {
                         bandwidthset.operator = (yyvsp[-7].number);
                         bandwidthset.limit = ((unsigned long long)(yyvsp[-6].number) * (yyvsp[-5].number));
@@ -7565,11 +8045,11 @@ yyreduce:
                         addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addbandwidth(&(current->uploadbyteslist), &bandwidthset);
                   }
-#line 7569 "src/y.tab.c"
+#line 8049 "src/y.tab.c"
     break;
 
-  case 799:
-#line 2989 "src/p.y"
+  case 895: /* upload: IF TOTAL UPLOAD operator NUMBER unit NUMBER totaltime rate1 THEN action1 recovery  */
+#line 3297 "src/p.y"
                                                                                                     {
                         bandwidthset.operator = (yyvsp[-8].number);
                         bandwidthset.limit = ((unsigned long long)(yyvsp[-7].number) * (yyvsp[-6].number));
@@ -7578,11 +8058,11 @@ yyreduce:
                         addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addbandwidth(&(current->uploadbyteslist), &bandwidthset);
                   }
-#line 7582 "src/y.tab.c"
+#line 8062 "src/y.tab.c"
     break;
 
-  case 800:
-#line 2997 "src/p.y"
+  case 896: /* upload: IF UPLOAD operator NUMBER PACKET currenttime rate1 THEN action1 recovery  */
+#line 3305 "src/p.y"
                                                                                            {
                         bandwidthset.operator = (yyvsp[-7].number);
                         bandwidthset.limit = (unsigned long long)(yyvsp[-6].number);
@@ -7591,11 +8071,11 @@ yyreduce:
                         addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addbandwidth(&(current->uploadpacketslist), &bandwidthset);
                   }
-#line 7595 "src/y.tab.c"
+#line 8075 "src/y.tab.c"
     break;
 
-  case 801:
-#line 3005 "src/p.y"
+  case 897: /* upload: IF TOTAL UPLOAD operator NUMBER PACKET totaltime rate1 THEN action1 recovery  */
+#line 3313 "src/p.y"
                                                                                                {
                         bandwidthset.operator = (yyvsp[-7].number);
                         bandwidthset.limit = (unsigned long long)(yyvsp[-6].number);
@@ -7604,11 +8084,11 @@ yyreduce:
                         addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addbandwidth(&(current->uploadpacketslist), &bandwidthset);
                   }
-#line 7608 "src/y.tab.c"
+#line 8088 "src/y.tab.c"
     break;
 
-  case 802:
-#line 3013 "src/p.y"
+  case 898: /* upload: IF TOTAL UPLOAD operator NUMBER PACKET NUMBER totaltime rate1 THEN action1 recovery  */
+#line 3321 "src/p.y"
                                                                                                       {
                         bandwidthset.operator = (yyvsp[-8].number);
                         bandwidthset.limit = (unsigned long long)(yyvsp[-7].number);
@@ -7617,11 +8097,11 @@ yyreduce:
                         addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addbandwidth(&(current->uploadpacketslist), &bandwidthset);
                   }
-#line 7621 "src/y.tab.c"
+#line 8101 "src/y.tab.c"
     break;
 
-  case 803:
-#line 3023 "src/p.y"
+  case 899: /* download: IF DOWNLOAD operator NUMBER unit currenttime rate1 THEN action1 recovery  */
+#line 3331 "src/p.y"
                                                                                            {
                         bandwidthset.operator = (yyvsp[-7].number);
                         bandwidthset.limit = ((unsigned long long)(yyvsp[-6].number) * (yyvsp[-5].number));
@@ -7630,11 +8110,11 @@ yyreduce:
                         addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addbandwidth(&(current->downloadbyteslist), &bandwidthset);
                   }
-#line 7634 "src/y.tab.c"
+#line 8114 "src/y.tab.c"
     break;
 
-  case 804:
-#line 3031 "src/p.y"
+  case 900: /* download: IF TOTAL DOWNLOAD operator NUMBER unit totaltime rate1 THEN action1 recovery  */
+#line 3339 "src/p.y"
                                                                                                {
                         bandwidthset.operator = (yyvsp[-7].number);
                         bandwidthset.limit = ((unsigned long long)(yyvsp[-6].number) * (yyvsp[-5].number));
@@ -7643,11 +8123,11 @@ yyreduce:
                         addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addbandwidth(&(current->downloadbyteslist), &bandwidthset);
                   }
-#line 7647 "src/y.tab.c"
+#line 8127 "src/y.tab.c"
     break;
 
-  case 805:
-#line 3039 "src/p.y"
+  case 901: /* download: IF TOTAL DOWNLOAD operator NUMBER unit NUMBER totaltime rate1 THEN action1 recovery  */
+#line 3347 "src/p.y"
                                                                                                       {
                         bandwidthset.operator = (yyvsp[-8].number);
                         bandwidthset.limit = ((unsigned long long)(yyvsp[-7].number) * (yyvsp[-6].number));
@@ -7656,11 +8136,11 @@ yyreduce:
                         addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addbandwidth(&(current->downloadbyteslist), &bandwidthset);
                   }
-#line 7660 "src/y.tab.c"
+#line 8140 "src/y.tab.c"
     break;
 
-  case 806:
-#line 3047 "src/p.y"
+  case 902: /* download: IF DOWNLOAD operator NUMBER PACKET currenttime rate1 THEN action1 recovery  */
+#line 3355 "src/p.y"
                                                                                              {
                         bandwidthset.operator = (yyvsp[-7].number);
                         bandwidthset.limit = (unsigned long long)(yyvsp[-6].number);
@@ -7669,11 +8149,11 @@ yyreduce:
                         addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addbandwidth(&(current->downloadpacketslist), &bandwidthset);
                   }
-#line 7673 "src/y.tab.c"
+#line 8153 "src/y.tab.c"
     break;
 
-  case 807:
-#line 3055 "src/p.y"
+  case 903: /* download: IF TOTAL DOWNLOAD operator NUMBER PACKET totaltime rate1 THEN action1 recovery  */
+#line 3363 "src/p.y"
                                                                                                  {
                         bandwidthset.operator = (yyvsp[-7].number);
                         bandwidthset.limit = (unsigned long long)(yyvsp[-6].number);
@@ -7682,11 +8162,11 @@ yyreduce:
                         addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addbandwidth(&(current->downloadpacketslist), &bandwidthset);
                   }
-#line 7686 "src/y.tab.c"
+#line 8166 "src/y.tab.c"
     break;
 
-  case 808:
-#line 3063 "src/p.y"
+  case 904: /* download: IF TOTAL DOWNLOAD operator NUMBER PACKET NUMBER totaltime rate1 THEN action1 recovery  */
+#line 3371 "src/p.y"
                                                                                                         {
                         bandwidthset.operator = (yyvsp[-8].number);
                         bandwidthset.limit = (unsigned long long)(yyvsp[-7].number);
@@ -7695,35 +8175,131 @@ yyreduce:
                         addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addbandwidth(&(current->downloadpacketslist), &bandwidthset);
                   }
-#line 7699 "src/y.tab.c"
+#line 8179 "src/y.tab.c"
+    break;
+
+  case 905: /* linkcounter: IF linkcountertype operator NUMBER currenttime rate1 THEN action1 recovery  */
+#line 3381 "src/p.y"
+                                                                                             {
+                        bandwidthset.counter = (yyvsp[-7].number);
+                        bandwidthset.operator = (yyvsp[-6].number);
+                        bandwidthset.limit = (unsigned long long)(yyvsp[-5].number);
+                        bandwidthset.rangecount = 1;
+                        bandwidthset.range = (yyvsp[-4].number);
+                        addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                        addbandwidth(&(current->linkcounterlist), &bandwidthset);
+                  }
+#line 8193 "src/y.tab.c"
+    break;
+
+  case 906: /* linkcounter: IF TOTAL linkcountertype operator NUMBER totaltime rate1 THEN action1 recovery  */
+#line 3390 "src/p.y"
+                                                                                                 {
+                        bandwidthset.counter = (yyvsp[-7].number);
+                        bandwidthset.operator = (yyvsp[-6].number);
+                        bandwidthset.limit = (unsigned long long)(yyvsp[-5].number);
+                        bandwidthset.rangecount = 1;
+                        bandwidthset.range = (yyvsp[-4].number);
+                        addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                        addbandwidth(&(current->linkcounterlist), &bandwidthset);
+                  }
+#line 8207 "src/y.tab.c"
+    break;
+
+  case 907: /* linkcounter: IF TOTAL linkcountertype operator NUMBER NUMBER totaltime rate1 THEN action1 recovery  */
+#line 3399 "src/p.y"
+                                                                                                        {
+                        bandwidthset.counter = (yyvsp[-8].number);
+                        bandwidthset.operator = (yyvsp[-7].number);
+                        bandwidthset.limit = (unsigned long long)(yyvsp[-6].number);
+                        bandwidthset.rangecount = (yyvsp[-5].number);
+                        bandwidthset.range = (yyvsp[-4].number);
+                        addeventaction(&(bandwidthset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                        addbandwidth(&(current->linkcounterlist), &bandwidthset);
+                  }
+#line 8221 "src/y.tab.c"
+    break;
+
+  case 908: /* linkcountertype: DOWNLOAD DROP  */
+#line 3410 "src/p.y"
+                                      { (yyval.number) = LinkCounter_DropsIn; }
+#line 8227 "src/y.tab.c"
+    break;
+
+  case 909: /* linkcountertype: UPLOAD DROP  */
+#line 3411 "src/p.y"
+                                      { (yyval.number) = LinkCounter_DropsOut; }
+#line 8233 "src/y.tab.c"
+    break;
+
+  case 910: /* linkcountertype: DOWNLOAD MISSED  */
+#line 3412 "src/p.y"
+                                      { (yyval.number) = LinkCounter_MissedIn; }
+#line 8239 "src/y.tab.c"
+    break;
+
+  case 911: /* linkcountertype: DOWNLOAD FIFO  */
+#line 3413 "src/p.y"
+                                      { (yyval.number) = LinkCounter_FifoIn; }
+#line 8245 "src/y.tab.c"
+    break;
+
+  case 912: /* linkcountertype: UPLOAD FIFO  */
+#line 3414 "src/p.y"
+                                      { (yyval.number) = LinkCounter_FifoOut; }
+#line 8251 "src/y.tab.c"
+    break;
+
+  case 913: /* linkcountertype: UPLOAD CARRIER  */
+#line 3415 "src/p.y"
+                                      { (yyval.number) = LinkCounter_CarrierOut; }
+#line 8257 "src/y.tab.c"
+    break;
+
+  case 914: /* linkcountertype: MULTICAST  */
+#line 3416 "src/p.y"
+                                      { (yyval.number) = LinkCounter_MulticastIn; }
+#line 8263 "src/y.tab.c"
+    break;
+
+  case 915: /* linkcountertype: DOWNLOAD MULTICAST  */
+#line 3417 "src/p.y"
+                                      { (yyval.number) = LinkCounter_MulticastIn; }
+#line 8269 "src/y.tab.c"
+    break;
+
+  case 916: /* linkcountertype: COLLISION  */
+#line 3418 "src/p.y"
+                                      { (yyval.number) = LinkCounter_Collisions; }
+#line 8275 "src/y.tab.c"
     break;
 
-  case 809:
-#line 3073 "src/p.y"
+  case 917: /* icmptype: TYPE ICMPECHO  */
+#line 3421 "src/p.y"
                                 { (yyval.number) = ICMP_ECHO; }
-#line 7705 "src/y.tab.c"
+#line 8281 "src/y.tab.c"
     break;
 
-  case 810:
-#line 3076 "src/p.y"
+  case 918: /* reminder: %empty  */
+#line 3424 "src/p.y"
                                         { mailset.reminder = 0; }
-#line 7711 "src/y.tab.c"
+#line 8287 "src/y.tab.c"
     break;
 
-  case 811:
-#line 3077 "src/p.y"
+  case 919: /* reminder: REMINDER NUMBER  */
+#line 3425 "src/p.y"
                                         { mailset.reminder = (yyvsp[0].number); }
-#line 7717 "src/y.tab.c"
+#line 8293 "src/y.tab.c"
     break;
 
-  case 812:
-#line 3078 "src/p.y"
+  case 920: /* reminder: REMINDER NUMBER CYCLE  */
+#line 3426 "src/p.y"
                                         { mailset.reminder = (yyvsp[-1].number); }
-#line 7723 "src/y.tab.c"
+#line 8299 "src/y.tab.c"
     break;
 
 
-#line 7727 "src/y.tab.c"
+#line 8303 "src/y.tab.c"
 
       default: break;
     }
@@ -7738,11 +8314,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
@@ -7766,50 +8341,14 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = YY_CAST (char *, YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -7842,6 +8381,7 @@ yyerrorlab:
      label yyerrorlab therefore never appears in user code.  */
   if (0)
     YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -7858,13 +8398,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -7878,7 +8419,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -7890,7 +8431,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -7901,7 +8442,7 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
 /*-----------------------------------.
@@ -7909,24 +8450,22 @@ yyacceptlab:
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
 
-/*-----------------------------------------------------.
-| yyreturn -- parsing is finished, return the result.  |
-`-----------------------------------------------------*/
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -7942,20 +8481,18 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[+*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 3081 "src/p.y"
+
+#line 3429 "src/p.y"
 
 
 
@@ -8097,6 +8634,11 @@ static void preparse() {
         Run.limits.stopTimeout       = LIMIT_STOPTIMEOUT;
         Run.limits.startTimeout      = LIMIT_STARTTIMEOUT;
         Run.limits.restartTimeout    = LIMIT_RESTARTTIMEOUT;
+        Run.limits.checksumWorkers   = LIMIT_CHECKSUMWORKERS;
+        Run.limits.checksumIdleIO    = false;
+        Run.limits.filesystemTimeout = LIMIT_FILESYSTEMTIMEOUT;
+        Run.limits.dnsTtl            = LIMIT_DNSTTL;
+        Run.limits.dnsNegativeTtl    = LIMIT_DNSNEGATIVETTL;
         Run.onreboot                 = Onreboot_Start;
         Run.mmonitcredentials        = NULL;
         Run.httpd.flags              = Httpd_Disabled | Httpd_Signature;
@@ -8209,6 +8751,9 @@ static void postparse() {
         /* Check the sanity of any dependency graph */
         check_depend();
 
+        /* Probe identical connection tests once per cycle */
+        shareprobes();
+
 #if defined HAVE_OPENSSL && defined OPENSSL_FIPS
         Ssl_setFipsMode(Run.flags & Run_FipsEnabled);
 #endif
@@ -8257,6 +8802,9 @@ static Service_T createservice(Service_Type type, char *name, char *value, State
                 case Service_File:
                         NEW(current->inf.file);
                         break;
+                case Service_Fileset:
+                        NEW(current->inf.fileset);
+                        break;
                 case Service_Filesystem:
                         NEW(current->inf.filesystem);
                         break;
@@ -8367,6 +8915,7 @@ static void addservice(Service_T s) {
                 case Service_Directory:
                 case Service_Fifo:
                 case Service_File:
+                case Service_Fileset:
                 case Service_Process:
                         if (! s->nonexistlist && ! s->existlist) {
                                 // Add existence test if not defined
@@ -8469,6 +9018,22 @@ static void addport(Port_T *list, Port_T port) {
 
         if (port->protocol->check == check_radius && port->type != Socket_Udp)
                 yyerror("Radius protocol test supports UDP only");
+        if (port->persistent) {
+                if (! port->protocol->ping)
+                        yyerror2("Persistent connection is not supported by the %s protocol test", port->protocol->name);
+                else if (port->type != Socket_Tcp)
+                        yyerror("Persistent connection requires TCP");
+                else if (port->protocol->check == check_mysql && ! port->parameters.mysql.username)
+                        yyerror("Persistent MySQL connection requires credentials, the server closes connections which didn't log in");
+        }
+        for (TimingLimit_T t = port->timinglist; t; t = t->next) {
+                if (port->family == Socket_Unix && (t->type == Timing_Dns || t->type == Timing_Tls || t->type == Timing_Rtt || t->type == Timing_Retransmits))
+                        yyerror2("The %s test is not supported for unix sockets", timingnames[t->type]);
+                else if (t->type == Timing_Tls && ! sslset.flags)
+                        yyerror2("The %s test requires TLS", timingnames[t->type]);
+                else if ((t->type == Timing_Rtt || t->type == Timing_Retransmits) && port->type != Socket_Tcp)
+                        yyerror2("The %s test requires TCP", timingnames[t->type]);
+        }
 
         Port_T p;
         NEW(p);
@@ -8479,10 +9044,14 @@ static void addport(Port_T *list, Port_T port) {
         p->action             = port->action;
         p->timeout            = port->timeout;
         p->retry              = port->retry;
+        p->persistent         = port->persistent;
+        p->timinglist         = port->timinglist;
         p->protocol           = port->protocol;
         p->hostname           = port->hostname;
         p->url_request        = port->url_request;
         p->outgoing           = port->outgoing;
+        for (int i = 0; i <= Timing_Last; i++)
+                p->timing[i] = -1.;
         if (p->family == Socket_Unix) {
                 p->target.unix.pathname = port->target.unix.pathname;
         } else {
@@ -8493,6 +9062,9 @@ static void addport(Port_T *list, Port_T port) {
                         if (sslset.flags && (p->target.net.port == 25 || p->target.net.port == 143 || p->target.net.port == 587))
                                 sslset.flags = SSL_StartTLS;
                         _setSSLOptions(&(p->target.net.ssl.options));
+                        // HTTP/2 over TLS is negotiated using the ALPN extension
+                        if (p->protocol->check == check_http2)
+                                p->target.net.ssl.options.alpn = "h2";
 #else
                         yyerror("SSL check cannot be activated -- Monit was not built with SSL support");
 #endif
@@ -8507,6 +9079,10 @@ static void addport(Port_T *list, Port_T port) {
                                 p->parameters.http.hashtype = Hash_Md5;
                         else if (strlen(p->parameters.http.checksum) == 40)
                                 p->parameters.http.hashtype = Hash_Sha1;
+                        else if (strlen(p->parameters.http.checksum) == 64)
+                                p->parameters.http.hashtype = Hash_Sha256;
+                        else if (strlen(p->parameters.http.checksum) == 16)
+                                p->parameters.http.hashtype = Hash_Xxh64;
                         else
                                 yyerror2("invalid checksum [%s]", p->parameters.http.checksum);
                 } else {
@@ -8520,6 +9096,12 @@ static void addport(Port_T *list, Port_T port) {
                                 yyerror2("if response content or checksum test is enabled, the HEAD method is not allowed");
                         }
                 }
+        } else if (p->protocol->check == check_http2) {
+                if (! p->parameters.http.method)
+                        p->parameters.http.method = Http_Get;
+                // Test the root document if no request is defined
+                if (! p->parameters.http.streams)
+                        addhttp2stream(p, Str_dup("/"));
         } else if (p->protocol->check == check_mysql) {
                 if (p->parameters.mysql.rsaChecksum) {
                         if (! p->parameters.mysql.username)
@@ -8538,6 +9120,23 @@ static void addport(Port_T *list, Port_T port) {
 }
 
 
+/*
+ * Add a connection phase timing limit to the current port
+ */
+static void addtiming(Timing_Type type, Operator_Type operator, double limit) {
+        TimingLimit_T t;
+        NEW(t);
+        t->type = type;
+        t->operator = operator;
+        t->limit = limit;
+        // Append the limit, so the rules are reported in the configured order
+        TimingLimit_T *last = &(portset.timinglist);
+        while (*last)
+                last = &((*last)->next);
+        *last = t;
+}
+
+
 static void addhttpheader(Port_T port, const char *header) {
         if (! port->parameters.http.headers) {
                 port->parameters.http.headers = List_new();
@@ -8549,12 +9148,30 @@ static void addhttpheader(Port_T port, const char *header) {
 }
 
 
+/*
+ * Append the HTTP/2 request stream to the current port
+ */
+static void addhttp2stream(Port_T port, char *request) {
+        Http2Stream_T s;
+        NEW(s);
+        s->request = Util_urlEncode(request, false);
+        s->status = -1;
+        s->response = -1.;
+        FREE(request);
+        // Append the stream, so the requests are sent in the configured order
+        Http2Stream_T *last = &port->parameters.http.streams;
+        while (*last)
+                last = &(*last)->next;
+        *last = s;
+}
+
+
 /*
  * Add a new resource object to the current service resource list
  */
 static void addresource(Resource_T rr) {
         ASSERT(rr);
-        if (Run.flags & Run_ProcessEngineEnabled) {
+        if (Run.flags & Run_ProcessEngineEnabled || current->type == Service_Directory) {
                 Resource_T r;
                 NEW(r);
                 r->resource_id = rr->resource_id;
@@ -8755,9 +9372,12 @@ static void addchecksum(Checksum_T cs) {
         if (STR_UNDEF(cs->hash)) {
                 if (cs->type == Hash_Unknown)
                         cs->type = Hash_Default;
-                if (! (Checksum_getChecksum(current->path, cs->type, cs->hash, sizeof(cs->hash)))) {
+                if (current->type == Service_Fileset) {
+                        /* Each file of the set takes its first checksum as the reference value */
+                        cs->initialized = false;
+                } else if (! (Checksum_getChecksum(current->path, cs->type, cs->hash, sizeof(cs->hash)))) {
                         /* If the file doesn't exist, set dummy value */
-                        snprintf(cs->hash, sizeof(cs->hash), cs->type == Hash_Md5 ? "00000000000000000000000000000000" : "0000000000000000000000000000000000000000");
+                        snprintf(cs->hash, sizeof(cs->hash), "%0*d", Checksum_length(cs->type) * 2, 0);
                         cs->initialized = false;
                         yywarning2("Cannot compute a checksum for file %s", current->path);
                 }
@@ -8769,12 +9389,16 @@ static void addchecksum(Checksum_T cs) {
                         cs->type = Hash_Md5;
                 } else if (len == 40) {
                         cs->type = Hash_Sha1;
+                } else if (len == 64) {
+                        cs->type = Hash_Sha256;
+                } else if (len == 16) {
+                        cs->type = Hash_Xxh64;
                 } else {
                         yyerror2("Unknown checksum type [%s] for file %s", cs->hash, current->path);
                         reset_checksumset();
                         return;
                 }
-        } else if ((cs->type == Hash_Md5 && len != 32) || (cs->type == Hash_Sha1 && len != 40)) {
+        } else if (len != Checksum_length(cs->type) * 2 && ! (len == 0 && current->type == Service_Fileset)) {
                 yyerror2("Invalid checksum [%s] for file %s", cs->hash, current->path);
                 reset_checksumset();
                 return;
@@ -8891,6 +9515,7 @@ static void addbandwidth(Bandwidth_T *list, Bandwidth_T b) {
                 bandwidth->limit = b->limit;
                 bandwidth->rangecount = b->rangecount;
                 bandwidth->range = b->range;
+                bandwidth->counter = b->counter;
                 bandwidth->action = b->action;
                 bandwidth->next = *list;
                 *list = bandwidth;
@@ -9050,6 +9675,7 @@ static void addfilesystem(FileSystem_T ds) {
         dev->operator           = ds->operator;
         dev->limit_absolute     = ds->limit_absolute;
         dev->limit_percent      = ds->limit_percent;
+        dev->window             = ds->window;
         dev->action             = ds->action;
 
         dev->next               = current->filesystemlist;
@@ -9078,6 +9704,8 @@ static void addicmp(Icmp_T is) {
         icmp->outgoing     = is->outgoing;
         icmp->is_available = Connection_Init;
         icmp->response     = -1;
+        icmp->jitter       = -1;
+        icmp->loss         = -1;
 
         icmp->next         = current->icmplist;
         current->icmplist  = icmp;
@@ -9128,7 +9756,7 @@ static void addeventaction(EventAction_T *_ea, Action_Type failed, Action_Type s
 /*
  * Add a generic protocol handler to
  */
-static void addgeneric(Port_T port, char *send, char *expect) {
+static void addgeneric(Port_T port, char *send, char *expect, bool hex) {
         Generic_T g = port->parameters.generic.sendexpect;
         if (! g) {
                 NEW(g);
@@ -9142,6 +9770,28 @@ static void addgeneric(Port_T port, char *send, char *expect) {
         if (send) {
                 g->send = send;
                 g->expect = NULL;
+        } else if (expect && hex) {
+                // Hex digits, optionally separated by whitespace, for example "0d 0a"
+                g->bytes = CALLOC(1, strlen(expect) / 2 + 1);
+                int digits = 0;
+                char *c = expect;
+                for (; *c; c++) {
+                        if (isspace((unsigned char)*c))
+                                continue;
+                        if (! isxdigit((unsigned char)*c)) {
+                                yyerror2("Invalid hex digit '%c' in the expected data", *c);
+                                break;
+                        }
+                        int value = isdigit((unsigned char)*c) ? *c - '0' : tolower((unsigned char)*c) - 'a' + 10;
+                        if (digits++ % 2)
+                                g->bytes[g->length++] |= value;
+                        else
+                                g->bytes[g->length] = value << 4;
+                }
+                if (! *c && (digits == 0 || digits % 2))
+                        yyerror2("The expected hex data must have an even number of digits");
+                FREE(expect);
+                g->send = NULL;
         } else if (expect) {
                 int reg_return;
                 NEW(g->expect);
@@ -9838,6 +10488,7 @@ static void reset_filesystemset() {
         filesystemset.operator = Operator_Equal;
         filesystemset.limit_absolute = -1;
         filesystemset.limit_percent = -1.;
+        filesystemset.window = 0;
         filesystemset.action = NULL;
 }
 
@@ -9898,6 +10549,128 @@ static int check_perm(int perm) {
 }
 
 
+static bool _isSameSSL(SslOptions_T a, SslOptions_T b) {
+        return a->flags == b->flags &&
+               a->version == b->version &&
+               a->verify == b->verify &&
+               a->allowSelfSigned == b->allowSelfSigned &&
+               a->checksumType == b->checksumType &&
+               IS(NVLSTR(a->checksum), NVLSTR(b->checksum)) &&
+               IS(NVLSTR(a->clientpemfile), NVLSTR(b->clientpemfile)) &&
+               IS(NVLSTR(a->ciphers), NVLSTR(b->ciphers)) &&
+               IS(NVLSTR(a->CACertificateFile), NVLSTR(b->CACertificateFile)) &&
+               IS(NVLSTR(a->CACertificatePath), NVLSTR(b->CACertificatePath));
+}
+
+
+static bool _isSameList(List_T a, List_T b) {
+        if (! a || ! b)
+                return a == b;
+        if (List_length(a) != List_length(b))
+                return false;
+        for (list_t x = a->head, y = b->head; x && y; x = x->next, y = y->next)
+                if (! IS(x->e, y->e))
+                        return false;
+        return true;
+}
+
+
+/*
+ * Return true if the port tests are identical, so one probe result can be
+ * used for both. Tests with response expectations given as regular
+ * expressions (content and send/expect tests) are never considered identical,
+ * as the compiled expressions cannot be compared. HTTP/2 tests keep the result
+ * of each stream in the port, so they are not shared either.
+ */
+static bool _isSameProbe(Port_T a, Port_T b) {
+        if (a->family != b->family || a->type != b->type || a->protocol != b->protocol || a->timeout != b->timeout || a->retry != b->retry || a->persistent != b->persistent)
+                return false;
+        if ((a->url_request && a->url_request->regex) || (b->url_request && b->url_request->regex))
+                return false;
+        if (a->url_request || b->url_request) {
+                if (! a->url_request || ! b->url_request || ! a->url_request->url || ! b->url_request->url || ! IS(a->url_request->url->url, b->url_request->url->url))
+                        return false;
+        }
+        if (a->family == Socket_Unix) {
+                if (! IS(a->target.unix.pathname, b->target.unix.pathname))
+                        return false;
+        } else {
+                if (! IS(a->hostname, b->hostname) || a->target.net.port != b->target.net.port || ! IS(NVLSTR(a->outgoing.ip), NVLSTR(b->outgoing.ip)))
+                        return false;
+                if (! _isSameSSL(&(a->target.net.ssl.options), &(b->target.net.ssl.options)))
+                        return false;
+        }
+        if (a->protocol->check == check_http) {
+                return a->parameters.http.method == b->parameters.http.method &&
+                       a->parameters.http.hasStatus == b->parameters.http.hasStatus &&
+                       a->parameters.http.operator == b->parameters.http.operator &&
+                       a->parameters.http.status == b->parameters.http.status &&
+                       IS(NVLSTR(a->parameters.http.username), NVLSTR(b->parameters.http.username)) &&
+                       IS(NVLSTR(a->parameters.http.password), NVLSTR(b->parameters.http.password)) &&
+                       IS(NVLSTR(a->parameters.http.request), NVLSTR(b->parameters.http.request)) &&
+                       IS(NVLSTR(a->parameters.http.checksum), NVLSTR(b->parameters.http.checksum)) &&
+                       a->parameters.http.hashtype == b->parameters.http.hashtype &&
+                       _isSameList(a->parameters.http.headers, b->parameters.http.headers);
+        } else if (a->protocol->check == check_generic || a->protocol->check == check_apache_status || a->protocol->check == check_http2) {
+                return false;
+        } else if (a->protocol->check == check_mqtt) {
+                return IS(NVLSTR(a->parameters.mqtt.username), NVLSTR(b->parameters.mqtt.username)) &&
+                       IS(NVLSTR(a->parameters.mqtt.password), NVLSTR(b->parameters.mqtt.password));
+        } else if (a->protocol->check == check_mysql) {
+                return IS(NVLSTR(a->parameters.mysql.username), NVLSTR(b->parameters.mysql.username)) &&
+                       IS(NVLSTR(a->parameters.mysql.password), NVLSTR(b->parameters.mysql.password)) &&
+                       IS(NVLSTR(a->parameters.mysql.rsaChecksum), NVLSTR(b->parameters.mysql.rsaChecksum));
+        } else if (a->protocol->check == check_radius) {
+                return IS(NVLSTR(a->parameters.radius.secret), NVLSTR(b->parameters.radius.secret));
+        } else if (a->protocol->check == check_sip) {
+                return a->parameters.sip.maxforward == b->parameters.sip.maxforward &&
+                       IS(NVLSTR(a->parameters.sip.target), NVLSTR(b->parameters.sip.target));
+        } else if (a->protocol->check == check_smtp) {
+                return IS(NVLSTR(a->parameters.smtp.username), NVLSTR(b->parameters.smtp.username)) &&
+                       IS(NVLSTR(a->parameters.smtp.password), NVLSTR(b->parameters.smtp.password));
+        } else if (a->protocol->check == check_websocket) {
+                return a->parameters.websocket.version == b->parameters.websocket.version &&
+                       IS(NVLSTR(a->parameters.websocket.host), NVLSTR(b->parameters.websocket.host)) &&
+                       IS(NVLSTR(a->parameters.websocket.origin), NVLSTR(b->parameters.websocket.origin)) &&
+                       IS(NVLSTR(a->parameters.websocket.request), NVLSTR(b->parameters.websocket.request));
+        }
+        return true;
+}
+
+
+static void _shareProbe(Port_T port) {
+        for (Service_T s = servicelist; s; s = s->next) {
+                for (Port_T p = (port->family == Socket_Unix ? s->socketlist : s->portlist); p; p = p->next) {
+                        if (p == port)
+                                return; // The ports are compared with the preceding ones only
+                        if (_isSameProbe(p, port)) {
+                                if (! p->probe) {
+                                        NEW(p->probe);
+                                        p->probe->references = 1;
+                                }
+                                port->probe = p->probe;
+                                port->probe->references++;
+                                return;
+                        }
+                }
+        }
+}
+
+
+/*
+ * Find the identical port tests across services, so the endpoint is probed
+ * once per cycle and the result is used by all services referencing it
+ */
+static void shareprobes() {
+        for (Service_T s = servicelist; s; s = s->next) {
+                for (Port_T p = s->portlist; p; p = p->next)
+                        _shareProbe(p);
+                for (Port_T p = s->socketlist; p; p = p->next)
+                        _shareProbe(p);
+        }
+}
+
+
 /*
  * Check the dependency graph for errors
  * by doing a topological sort, thereby finding any cycles.
@@ -10081,6 +10854,35 @@ static void addsecurityattribute(char *value, Action_Type failed, Action_Type su
         current->secattrlist = attr;
 }
 
+static void addlisten(ListenTest_Type type, char *address, int port, Operator_Type operator, long long value_absolute, float value_percent, Action_Type failed, Action_Type succeeded) {
+        if (! Listen_isSupported()) {
+                yywarning("The listen test is not supported on this system\n");
+                FREE(address);
+                return;
+        }
+        if (port < 1 || port > 65535)
+                yyerror2("Listen port %d is out of range", port);
+        Listen_T l;
+        NEW(l);
+        addeventaction(&(l->action), failed, succeeded);
+        l->type = type;
+        l->address = address;
+        if (address) {
+                // Resolve the local address once, the test runs every cycle
+                struct addrinfo hints = {.ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM};
+                int status = getaddrinfo(address, NULL, &hints, &(l->addresses));
+                if (status)
+                        yyerror2("Cannot resolve listen address %s -- %s", address, status == EAI_SYSTEM ? STRERROR : gai_strerror(status));
+        }
+        l->port = port;
+        l->operator = operator;
+        l->limit_absolute = value_absolute;
+        l->limit_percent = value_percent;
+        l->info.queue = l->info.backlog = l->info.established = -1LL;
+        l->next = current->listenlist;
+        current->listenlist = l;
+}
+
 static void addfiledescriptors(Operator_Type operator, bool total, long long value_absolute, float value_percent, Action_Type failed, Action_Type succeeded) {
         Filedescriptors_T fds;
         NEW(fds);
@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.5.1.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -31,8 +31,9 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
 
 #ifndef YY_YY_SRC_Y_TAB_H_INCLUDED
 # define YY_YY_SRC_Y_TAB_H_INCLUDED
@@ -44,309 +45,361 @@
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    IF = 258,
-    ELSE = 259,
-    THEN = 260,
-    FAILED = 261,
-    SET = 262,
-    LOGFILE = 263,
-    FACILITY = 264,
-    DAEMON = 265,
-    SYSLOG = 266,
-    MAILSERVER = 267,
-    HTTPD = 268,
-    ALLOW = 269,
-    REJECTOPT = 270,
-    ADDRESS = 271,
-    INIT = 272,
-    TERMINAL = 273,
-    BATCH = 274,
-    READONLY = 275,
-    CLEARTEXT = 276,
-    MD5HASH = 277,
-    SHA1HASH = 278,
-    CRYPT = 279,
-    DELAY = 280,
-    PEMFILE = 281,
-    PEMKEY = 282,
-    PEMCHAIN = 283,
-    ENABLE = 284,
-    DISABLE = 285,
-    SSLTOKEN = 286,
-    CIPHER = 287,
-    CLIENTPEMFILE = 288,
-    ALLOWSELFCERTIFICATION = 289,
-    SELFSIGNED = 290,
-    VERIFY = 291,
-    CERTIFICATE = 292,
-    CACERTIFICATEFILE = 293,
-    CACERTIFICATEPATH = 294,
-    VALID = 295,
-    INTERFACE = 296,
-    LINK = 297,
-    PACKET = 298,
-    BYTEIN = 299,
-    BYTEOUT = 300,
-    PACKETIN = 301,
-    PACKETOUT = 302,
-    SPEED = 303,
-    SATURATION = 304,
-    UPLOAD = 305,
-    DOWNLOAD = 306,
-    TOTAL = 307,
-    IDFILE = 308,
-    STATEFILE = 309,
-    SEND = 310,
-    EXPECT = 311,
-    CYCLE = 312,
-    COUNT = 313,
-    REMINDER = 314,
-    REPEAT = 315,
-    LIMITS = 316,
-    SENDEXPECTBUFFER = 317,
-    EXPECTBUFFER = 318,
-    FILECONTENTBUFFER = 319,
-    HTTPCONTENTBUFFER = 320,
-    PROGRAMOUTPUT = 321,
-    NETWORKTIMEOUT = 322,
-    PROGRAMTIMEOUT = 323,
-    STARTTIMEOUT = 324,
-    STOPTIMEOUT = 325,
-    RESTARTTIMEOUT = 326,
-    PIDFILE = 327,
-    START = 328,
-    STOP = 329,
-    PATHTOK = 330,
-    RSAKEY = 331,
-    HOST = 332,
-    HOSTNAME = 333,
-    PORT = 334,
-    IPV4 = 335,
-    IPV6 = 336,
-    TYPE = 337,
-    UDP = 338,
-    TCP = 339,
-    TCPSSL = 340,
-    PROTOCOL = 341,
-    CONNECTION = 342,
-    ALERT = 343,
-    NOALERT = 344,
-    MAILFORMAT = 345,
-    UNIXSOCKET = 346,
-    SIGNATURE = 347,
-    TIMEOUT = 348,
-    RETRY = 349,
-    RESTART = 350,
-    CHECKSUM = 351,
-    EVERY = 352,
-    NOTEVERY = 353,
-    DEFAULT = 354,
-    HTTP = 355,
-    HTTPS = 356,
-    APACHESTATUS = 357,
-    FTP = 358,
-    SMTP = 359,
-    SMTPS = 360,
-    POP = 361,
-    POPS = 362,
-    IMAP = 363,
-    IMAPS = 364,
-    CLAMAV = 365,
-    NNTP = 366,
-    NTP3 = 367,
-    MYSQL = 368,
-    MYSQLS = 369,
-    DNS = 370,
-    WEBSOCKET = 371,
-    MQTT = 372,
-    SSH = 373,
-    DWP = 374,
-    LDAP2 = 375,
-    LDAP3 = 376,
-    RDATE = 377,
-    RSYNC = 378,
-    TNS = 379,
-    PGSQL = 380,
-    POSTFIXPOLICY = 381,
-    SIP = 382,
-    LMTP = 383,
-    GPS = 384,
-    RADIUS = 385,
-    MEMCACHE = 386,
-    REDIS = 387,
-    MONGODB = 388,
-    SIEVE = 389,
-    SPAMASSASSIN = 390,
-    FAIL2BAN = 391,
-    STRING = 392,
-    PATH = 393,
-    MAILADDR = 394,
-    MAILFROM = 395,
-    MAILREPLYTO = 396,
-    MAILSUBJECT = 397,
-    MAILBODY = 398,
-    SERVICENAME = 399,
-    STRINGNAME = 400,
-    NUMBER = 401,
-    PERCENT = 402,
-    LOGLIMIT = 403,
-    CLOSELIMIT = 404,
-    DNSLIMIT = 405,
-    KEEPALIVELIMIT = 406,
-    REPLYLIMIT = 407,
-    REQUESTLIMIT = 408,
-    STARTLIMIT = 409,
-    WAITLIMIT = 410,
-    GRACEFULLIMIT = 411,
-    CLEANUPLIMIT = 412,
-    REAL = 413,
-    CHECKPROC = 414,
-    CHECKFILESYS = 415,
-    CHECKFILE = 416,
-    CHECKDIR = 417,
-    CHECKHOST = 418,
-    CHECKSYSTEM = 419,
-    CHECKFIFO = 420,
-    CHECKPROGRAM = 421,
-    CHECKNET = 422,
-    THREADS = 423,
-    CHILDREN = 424,
-    METHOD = 425,
-    GET = 426,
-    HEAD = 427,
-    STATUS = 428,
-    ORIGIN = 429,
-    VERSIONOPT = 430,
-    READ = 431,
-    WRITE = 432,
-    OPERATION = 433,
-    SERVICETIME = 434,
-    DISK = 435,
-    RESOURCE = 436,
-    MEMORY = 437,
-    TOTALMEMORY = 438,
-    LOADAVG1 = 439,
-    LOADAVG5 = 440,
-    LOADAVG15 = 441,
-    SWAP = 442,
-    MODE = 443,
-    ACTIVE = 444,
-    PASSIVE = 445,
-    MANUAL = 446,
-    ONREBOOT = 447,
-    NOSTART = 448,
-    LASTSTATE = 449,
-    CORE = 450,
-    CPU = 451,
-    TOTALCPU = 452,
-    CPUUSER = 453,
-    CPUSYSTEM = 454,
-    CPUWAIT = 455,
-    CPUNICE = 456,
-    CPUHARDIRQ = 457,
-    CPUSOFTIRQ = 458,
-    CPUSTEAL = 459,
-    CPUGUEST = 460,
-    CPUGUESTNICE = 461,
-    GROUP = 462,
-    REQUEST = 463,
-    DEPENDS = 464,
-    BASEDIR = 465,
-    SLOT = 466,
-    EVENTQUEUE = 467,
-    SECRET = 468,
-    HOSTHEADER = 469,
-    UID = 470,
-    EUID = 471,
-    GID = 472,
-    MMONIT = 473,
-    INSTANCE = 474,
-    USERNAME = 475,
-    PASSWORD = 476,
-    TIME = 477,
-    ATIME = 478,
-    CTIME = 479,
-    MTIME = 480,
-    CHANGED = 481,
-    MILLISECOND = 482,
-    SECOND = 483,
-    MINUTE = 484,
-    HOUR = 485,
-    DAY = 486,
-    MONTH = 487,
-    SSLV2 = 488,
-    SSLV3 = 489,
-    TLSV1 = 490,
-    TLSV11 = 491,
-    TLSV12 = 492,
-    TLSV13 = 493,
-    CERTMD5 = 494,
-    AUTO = 495,
-    NOSSLV2 = 496,
-    NOSSLV3 = 497,
-    NOTLSV1 = 498,
-    NOTLSV11 = 499,
-    NOTLSV12 = 500,
-    NOTLSV13 = 501,
-    BYTE = 502,
-    KILOBYTE = 503,
-    MEGABYTE = 504,
-    GIGABYTE = 505,
-    INODE = 506,
-    SPACE = 507,
-    TFREE = 508,
-    PERMISSION = 509,
-    SIZE = 510,
-    MATCH = 511,
-    NOT = 512,
-    IGNORE = 513,
-    ACTION = 514,
-    UPTIME = 515,
-    EXEC = 516,
-    UNMONITOR = 517,
-    PING = 518,
-    PING4 = 519,
-    PING6 = 520,
-    ICMP = 521,
-    ICMPECHO = 522,
-    NONEXIST = 523,
-    EXIST = 524,
-    INVALID = 525,
-    DATA = 526,
-    RECOVERED = 527,
-    PASSED = 528,
-    SUCCEEDED = 529,
-    URL = 530,
-    CONTENT = 531,
-    PID = 532,
-    PPID = 533,
-    FSFLAG = 534,
-    REGISTER = 535,
-    CREDENTIALS = 536,
-    URLOBJECT = 537,
-    ADDRESSOBJECT = 538,
-    TARGET = 539,
-    TIMESPEC = 540,
-    HTTPHEADER = 541,
-    MAXFORWARD = 542,
-    FIPS = 543,
-    SECURITY = 544,
-    ATTRIBUTE = 545,
-    FILEDESCRIPTORS = 546,
-    GREATER = 547,
-    GREATEROREQUAL = 548,
-    LESS = 549,
-    LESSOREQUAL = 550,
-    EQUAL = 551,
-    NOTEQUAL = 552
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    IF = 258,                      /* IF  */
+    ELSE = 259,                    /* ELSE  */
+    THEN = 260,                    /* THEN  */
+    FAILED = 261,                  /* FAILED  */
+    SET = 262,                     /* SET  */
+    LOGFILE = 263,                 /* LOGFILE  */
+    FACILITY = 264,                /* FACILITY  */
+    DAEMON = 265,                  /* DAEMON  */
+    SYSLOG = 266,                  /* SYSLOG  */
+    MAILSERVER = 267,              /* MAILSERVER  */
+    HTTPD = 268,                   /* HTTPD  */
+    ALLOW = 269,                   /* ALLOW  */
+    REJECTOPT = 270,               /* REJECTOPT  */
+    ADDRESS = 271,                 /* ADDRESS  */
+    INIT = 272,                    /* INIT  */
+    TERMINAL = 273,                /* TERMINAL  */
+    BATCH = 274,                   /* BATCH  */
+    READONLY = 275,                /* READONLY  */
+    CLEARTEXT = 276,               /* CLEARTEXT  */
+    MD5HASH = 277,                 /* MD5HASH  */
+    SHA1HASH = 278,                /* SHA1HASH  */
+    SHA256HASH = 279,              /* SHA256HASH  */
+    XXH64HASH = 280,               /* XXH64HASH  */
+    CRYPT = 281,                   /* CRYPT  */
+    DELAY = 282,                   /* DELAY  */
+    PEMFILE = 283,                 /* PEMFILE  */
+    PEMKEY = 284,                  /* PEMKEY  */
+    PEMCHAIN = 285,                /* PEMCHAIN  */
+    ENABLE = 286,                  /* ENABLE  */
+    DISABLE = 287,                 /* DISABLE  */
+    SSLTOKEN = 288,                /* SSLTOKEN  */
+    CIPHER = 289,                  /* CIPHER  */
+    CLIENTPEMFILE = 290,           /* CLIENTPEMFILE  */
+    ALLOWSELFCERTIFICATION = 291,  /* ALLOWSELFCERTIFICATION  */
+    SELFSIGNED = 292,              /* SELFSIGNED  */
+    VERIFY = 293,                  /* VERIFY  */
+    CERTIFICATE = 294,             /* CERTIFICATE  */
+    CACERTIFICATEFILE = 295,       /* CACERTIFICATEFILE  */
+    CACERTIFICATEPATH = 296,       /* CACERTIFICATEPATH  */
+    VALID = 297,                   /* VALID  */
+    INTERFACE = 298,               /* INTERFACE  */
+    LINK = 299,                    /* LINK  */
+    PACKET = 300,                  /* PACKET  */
+    BYTEIN = 301,                  /* BYTEIN  */
+    BYTEOUT = 302,                 /* BYTEOUT  */
+    PACKETIN = 303,                /* PACKETIN  */
+    PACKETOUT = 304,               /* PACKETOUT  */
+    SPEED = 305,                   /* SPEED  */
+    SATURATION = 306,              /* SATURATION  */
+    UPLOAD = 307,                  /* UPLOAD  */
+    DOWNLOAD = 308,                /* DOWNLOAD  */
+    TOTAL = 309,                   /* TOTAL  */
+    DROP = 310,                    /* DROP  */
+    MISSED = 311,                  /* MISSED  */
+    FIFO = 312,                    /* FIFO  */
+    CARRIER = 313,                 /* CARRIER  */
+    MULTICAST = 314,               /* MULTICAST  */
+    COLLISION = 315,               /* COLLISION  */
+    TCPRETRANSMITS = 316,          /* TCPRETRANSMITS  */
+    LISTENOVERFLOWS = 317,         /* LISTENOVERFLOWS  */
+    LISTENDROPS = 318,             /* LISTENDROPS  */
+    SYNCOOKIES = 319,              /* SYNCOOKIES  */
+    ORPHANS = 320,                 /* ORPHANS  */
+    TIMEWAIT = 321,                /* TIMEWAIT  */
+    UDPRCVBUFERRORS = 322,         /* UDPRCVBUFERRORS  */
+    LISTENING = 323,               /* LISTENING  */
+    LISTENQUEUE = 324,             /* LISTENQUEUE  */
+    ESTABLISHED = 325,             /* ESTABLISHED  */
+    IDFILE = 326,                  /* IDFILE  */
+    STATEFILE = 327,               /* STATEFILE  */
+    SEND = 328,                    /* SEND  */
+    EXPECT = 329,                  /* EXPECT  */
+    CYCLE = 330,                   /* CYCLE  */
+    COUNT = 331,                   /* COUNT  */
+    REMINDER = 332,                /* REMINDER  */
+    REPEAT = 333,                  /* REPEAT  */
+    LIMITS = 334,                  /* LIMITS  */
+    SENDEXPECTBUFFER = 335,        /* SENDEXPECTBUFFER  */
+    EXPECTBUFFER = 336,            /* EXPECTBUFFER  */
+    FILECONTENTBUFFER = 337,       /* FILECONTENTBUFFER  */
+    HTTPCONTENTBUFFER = 338,       /* HTTPCONTENTBUFFER  */
+    PROGRAMOUTPUT = 339,           /* PROGRAMOUTPUT  */
+    NETWORKTIMEOUT = 340,          /* NETWORKTIMEOUT  */
+    PROGRAMTIMEOUT = 341,          /* PROGRAMTIMEOUT  */
+    STARTTIMEOUT = 342,            /* STARTTIMEOUT  */
+    STOPTIMEOUT = 343,             /* STOPTIMEOUT  */
+    RESTARTTIMEOUT = 344,          /* RESTARTTIMEOUT  */
+    CHECKSUMWORKERS = 345,         /* CHECKSUMWORKERS  */
+    CHECKSUMIDLEIO = 346,          /* CHECKSUMIDLEIO  */
+    FILESYSTEMTIMEOUT = 347,       /* FILESYSTEMTIMEOUT  */
+    DNSTTL = 348,                  /* DNSTTL  */
+    DNSNEGATIVETTL = 349,          /* DNSNEGATIVETTL  */
+    ENTRIES = 350,                 /* ENTRIES  */
+    OLDEST = 351,                  /* OLDEST  */
+    PIDFILE = 352,                 /* PIDFILE  */
+    START = 353,                   /* START  */
+    STOP = 354,                    /* STOP  */
+    PATHTOK = 355,                 /* PATHTOK  */
+    RSAKEY = 356,                  /* RSAKEY  */
+    HOST = 357,                    /* HOST  */
+    HOSTNAME = 358,                /* HOSTNAME  */
+    PORT = 359,                    /* PORT  */
+    IPV4 = 360,                    /* IPV4  */
+    IPV6 = 361,                    /* IPV6  */
+    TYPE = 362,                    /* TYPE  */
+    UDP = 363,                     /* UDP  */
+    TCP = 364,                     /* TCP  */
+    TCPSSL = 365,                  /* TCPSSL  */
+    PROTOCOL = 366,                /* PROTOCOL  */
+    CONNECTION = 367,              /* CONNECTION  */
+    ALERT = 368,                   /* ALERT  */
+    NOALERT = 369,                 /* NOALERT  */
+    MAILFORMAT = 370,              /* MAILFORMAT  */
+    UNIXSOCKET = 371,              /* UNIXSOCKET  */
+    SIGNATURE = 372,               /* SIGNATURE  */
+    TIMEOUT = 373,                 /* TIMEOUT  */
+    RETRY = 374,                   /* RETRY  */
+    PERSISTENT = 375,              /* PERSISTENT  */
+    RESTART = 376,                 /* RESTART  */
+    CHECKSUM = 377,                /* CHECKSUM  */
+    EVERY = 378,                   /* EVERY  */
+    NOTEVERY = 379,                /* NOTEVERY  */
+    DNSTIME = 380,                 /* DNSTIME  */
+    CONNECTTIME = 381,             /* CONNECTTIME  */
+    TLSHANDSHAKE = 382,            /* TLSHANDSHAKE  */
+    REQUESTTIME = 383,             /* REQUESTTIME  */
+    FIRSTBYTE = 384,               /* FIRSTBYTE  */
+    RESPONSETIME = 385,            /* RESPONSETIME  */
+    RTT = 386,                     /* RTT  */
+    RETRANSMITS = 387,             /* RETRANSMITS  */
+    DEFAULT = 388,                 /* DEFAULT  */
+    HTTP = 389,                    /* HTTP  */
+    HTTPS = 390,                   /* HTTPS  */
+    APACHESTATUS = 391,            /* APACHESTATUS  */
+    FTP = 392,                     /* FTP  */
+    SMTP = 393,                    /* SMTP  */
+    SMTPS = 394,                   /* SMTPS  */
+    POP = 395,                     /* POP  */
+    POPS = 396,                    /* POPS  */
+    IMAP = 397,                    /* IMAP  */
+    IMAPS = 398,                   /* IMAPS  */
+    CLAMAV = 399,                  /* CLAMAV  */
+    NNTP = 400,                    /* NNTP  */
+    NTP3 = 401,                    /* NTP3  */
+    MYSQL = 402,                   /* MYSQL  */
+    MYSQLS = 403,                  /* MYSQLS  */
+    DNS = 404,                     /* DNS  */
+    WEBSOCKET = 405,               /* WEBSOCKET  */
+    MQTT = 406,                    /* MQTT  */
+    HTTP2 = 407,                   /* HTTP2  */
+    HEX = 408,                     /* HEX  */
+    SSH = 409,                     /* SSH  */
+    DWP = 410,                     /* DWP  */
+    LDAP2 = 411,                   /* LDAP2  */
+    LDAP3 = 412,                   /* LDAP3  */
+    RDATE = 413,                   /* RDATE  */
+    RSYNC = 414,                   /* RSYNC  */
+    TNS = 415,                     /* TNS  */
+    PGSQL = 416,                   /* PGSQL  */
+    POSTFIXPOLICY = 417,           /* POSTFIXPOLICY  */
+    SIP = 418,                     /* SIP  */
+    LMTP = 419,                    /* LMTP  */
+    GPS = 420,                     /* GPS  */
+    RADIUS = 421,                  /* RADIUS  */
+    MEMCACHE = 422,                /* MEMCACHE  */
+    REDIS = 423,                   /* REDIS  */
+    MONGODB = 424,                 /* MONGODB  */
+    SIEVE = 425,                   /* SIEVE  */
+    SPAMASSASSIN = 426,            /* SPAMASSASSIN  */
+    FAIL2BAN = 427,                /* FAIL2BAN  */
+    STRING = 428,                  /* STRING  */
+    PATH = 429,                    /* PATH  */
+    MAILADDR = 430,                /* MAILADDR  */
+    MAILFROM = 431,                /* MAILFROM  */
+    MAILREPLYTO = 432,             /* MAILREPLYTO  */
+    MAILSUBJECT = 433,             /* MAILSUBJECT  */
+    MAILBODY = 434,                /* MAILBODY  */
+    SERVICENAME = 435,             /* SERVICENAME  */
+    STRINGNAME = 436,              /* STRINGNAME  */
+    NUMBER = 437,                  /* NUMBER  */
+    PERCENT = 438,                 /* PERCENT  */
+    LOGLIMIT = 439,                /* LOGLIMIT  */
+    CLOSELIMIT = 440,              /* CLOSELIMIT  */
+    DNSLIMIT = 441,                /* DNSLIMIT  */
+    KEEPALIVELIMIT = 442,          /* KEEPALIVELIMIT  */
+    REPLYLIMIT = 443,              /* REPLYLIMIT  */
+    REQUESTLIMIT = 444,            /* REQUESTLIMIT  */
+    STARTLIMIT = 445,              /* STARTLIMIT  */
+    WAITLIMIT = 446,               /* WAITLIMIT  */
+    GRACEFULLIMIT = 447,           /* GRACEFULLIMIT  */
+    CLEANUPLIMIT = 448,            /* CLEANUPLIMIT  */
+    REAL = 449,                    /* REAL  */
+    CHECKPROC = 450,               /* CHECKPROC  */
+    CHECKFILESYS = 451,            /* CHECKFILESYS  */
+    CHECKFILE = 452,               /* CHECKFILE  */
+    CHECKDIR = 453,                /* CHECKDIR  */
+    CHECKHOST = 454,               /* CHECKHOST  */
+    CHECKSYSTEM = 455,             /* CHECKSYSTEM  */
+    CHECKFIFO = 456,               /* CHECKFIFO  */
+    CHECKPROGRAM = 457,            /* CHECKPROGRAM  */
+    CHECKNET = 458,                /* CHECKNET  */
+    CHECKFILESET = 459,            /* CHECKFILESET  */
+    THREADS = 460,                 /* THREADS  */
+    CHILDREN = 461,                /* CHILDREN  */
+    METHOD = 462,                  /* METHOD  */
+    GET = 463,                     /* GET  */
+    HEAD = 464,                    /* HEAD  */
+    STATUS = 465,                  /* STATUS  */
+    ORIGIN = 466,                  /* ORIGIN  */
+    VERSIONOPT = 467,              /* VERSIONOPT  */
+    READ = 468,                    /* READ  */
+    WRITE = 469,                   /* WRITE  */
+    OPERATION = 470,               /* OPERATION  */
+    SERVICETIME = 471,             /* SERVICETIME  */
+    DISK = 472,                    /* DISK  */
+    LATENCY = 473,                 /* LATENCY  */
+    UTILIZATION = 474,             /* UTILIZATION  */
+    QUEUEDEPTH = 475,              /* QUEUEDEPTH  */
+    IOPS = 476,                    /* IOPS  */
+    TIMETOFULL = 477,              /* TIMETOFULL  */
+    OVER = 478,                    /* OVER  */
+    RESOURCE = 479,                /* RESOURCE  */
+    MEMORY = 480,                  /* MEMORY  */
+    TOTALMEMORY = 481,             /* TOTALMEMORY  */
+    LOADAVG1 = 482,                /* LOADAVG1  */
+    LOADAVG5 = 483,                /* LOADAVG5  */
+    LOADAVG15 = 484,               /* LOADAVG15  */
+    SWAP = 485,                    /* SWAP  */
+    MODE = 486,                    /* MODE  */
+    ACTIVE = 487,                  /* ACTIVE  */
+    PASSIVE = 488,                 /* PASSIVE  */
+    MANUAL = 489,                  /* MANUAL  */
+    ONREBOOT = 490,                /* ONREBOOT  */
+    NOSTART = 491,                 /* NOSTART  */
+    LASTSTATE = 492,               /* LASTSTATE  */
+    CORE = 493,                    /* CORE  */
+    CPU = 494,                     /* CPU  */
+    TOTALCPU = 495,                /* TOTALCPU  */
+    CPUUSER = 496,                 /* CPUUSER  */
+    CPUSYSTEM = 497,               /* CPUSYSTEM  */
+    CPUWAIT = 498,                 /* CPUWAIT  */
+    CPUNICE = 499,                 /* CPUNICE  */
+    CPUHARDIRQ = 500,              /* CPUHARDIRQ  */
+    CPUSOFTIRQ = 501,              /* CPUSOFTIRQ  */
+    CPUSTEAL = 502,                /* CPUSTEAL  */
+    CPUGUEST = 503,                /* CPUGUEST  */
+    CPUGUESTNICE = 504,            /* CPUGUESTNICE  */
+    GROUP = 505,                   /* GROUP  */
+    REQUEST = 506,                 /* REQUEST  */
+    DEPENDS = 507,                 /* DEPENDS  */
+    BASEDIR = 508,                 /* BASEDIR  */
+    SLOT = 509,                    /* SLOT  */
+    EVENTQUEUE = 510,              /* EVENTQUEUE  */
+    SECRET = 511,                  /* SECRET  */
+    HOSTHEADER = 512,              /* HOSTHEADER  */
+    UID = 513,                     /* UID  */
+    EUID = 514,                    /* EUID  */
+    GID = 515,                     /* GID  */
+    MMONIT = 516,                  /* MMONIT  */
+    INSTANCE = 517,                /* INSTANCE  */
+    USERNAME = 518,                /* USERNAME  */
+    PASSWORD = 519,                /* PASSWORD  */
+    TIME = 520,                    /* TIME  */
+    ATIME = 521,                   /* ATIME  */
+    CTIME = 522,                   /* CTIME  */
+    MTIME = 523,                   /* MTIME  */
+    CHANGED = 524,                 /* CHANGED  */
+    MILLISECOND = 525,             /* MILLISECOND  */
+    SECOND = 526,                  /* SECOND  */
+    MINUTE = 527,                  /* MINUTE  */
+    HOUR = 528,                    /* HOUR  */
+    DAY = 529,                     /* DAY  */
+    MONTH = 530,                   /* MONTH  */
+    SSLV2 = 531,                   /* SSLV2  */
+    SSLV3 = 532,                   /* SSLV3  */
+    TLSV1 = 533,                   /* TLSV1  */
+    TLSV11 = 534,                  /* TLSV11  */
+    TLSV12 = 535,                  /* TLSV12  */
+    TLSV13 = 536,                  /* TLSV13  */
+    CERTMD5 = 537,                 /* CERTMD5  */
+    AUTO = 538,                    /* AUTO  */
+    NOSSLV2 = 539,                 /* NOSSLV2  */
+    NOSSLV3 = 540,                 /* NOSSLV3  */
+    NOTLSV1 = 541,                 /* NOTLSV1  */
+    NOTLSV11 = 542,                /* NOTLSV11  */
+    NOTLSV12 = 543,                /* NOTLSV12  */
+    NOTLSV13 = 544,                /* NOTLSV13  */
+    BYTE = 545,                    /* BYTE  */
+    KILOBYTE = 546,                /* KILOBYTE  */
+    MEGABYTE = 547,                /* MEGABYTE  */
+    GIGABYTE = 548,                /* GIGABYTE  */
+    INODE = 549,                   /* INODE  */
+    SPACE = 550,                   /* SPACE  */
+    TFREE = 551,                   /* TFREE  */
+    PERMISSION = 552,              /* PERMISSION  */
+    SIZE = 553,                    /* SIZE  */
+    MATCH = 554,                   /* MATCH  */
+    NOT = 555,                     /* NOT  */
+    IGNORE = 556,                  /* IGNORE  */
+    ACTION = 557,                  /* ACTION  */
+    UPTIME = 558,                  /* UPTIME  */
+    EXEC = 559,                    /* EXEC  */
+    UNMONITOR = 560,               /* UNMONITOR  */
+    PING = 561,                    /* PING  */
+    PING4 = 562,                   /* PING4  */
+    PING6 = 563,                   /* PING6  */
+    ICMP = 564,                    /* ICMP  */
+    ICMPECHO = 565,                /* ICMPECHO  */
+    NONEXIST = 566,                /* NONEXIST  */
+    EXIST = 567,                   /* EXIST  */
+    INVALID = 568,                 /* INVALID  */
+    DATA = 569,                    /* DATA  */
+    RECOVERED = 570,               /* RECOVERED  */
+    PASSED = 571,                  /* PASSED  */
+    SUCCEEDED = 572,               /* SUCCEEDED  */
+    URL = 573,                     /* URL  */
+    CONTENT = 574,                 /* CONTENT  */
+    PID = 575,                     /* PID  */
+    PPID = 576,                    /* PPID  */
+    FSFLAG = 577,                  /* FSFLAG  */
+    REGISTER = 578,                /* REGISTER  */
+    CREDENTIALS = 579,             /* CREDENTIALS  */
+    URLOBJECT = 580,               /* URLOBJECT  */
+    ADDRESSOBJECT = 581,           /* ADDRESSOBJECT  */
+    TARGET = 582,                  /* TARGET  */
+    TIMESPEC = 583,                /* TIMESPEC  */
+    HTTPHEADER = 584,              /* HTTPHEADER  */
+    MAXFORWARD = 585,              /* MAXFORWARD  */
+    FIPS = 586,                    /* FIPS  */
+    SECURITY = 587,                /* SECURITY  */
+    ATTRIBUTE = 588,               /* ATTRIBUTE  */
+    FILEDESCRIPTORS = 589,         /* FILEDESCRIPTORS  */
+    GREATER = 590,                 /* GREATER  */
+    GREATEROREQUAL = 591,          /* GREATEROREQUAL  */
+    LESS = 592,                    /* LESS  */
+    LESSOREQUAL = 593,             /* LESSOREQUAL  */
+    EQUAL = 594,                   /* EQUAL  */
+    NOTEQUAL = 595                 /* NOTEQUAL  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define IF 258
 #define ELSE 259
 #define THEN 260
@@ -368,286 +421,329 @@ extern int yydebug;
 #define CLEARTEXT 276
 #define MD5HASH 277
 #define SHA1HASH 278
-#define CRYPT 279
-#define DELAY 280
-#define PEMFILE 281
-#define PEMKEY 282
-#define PEMCHAIN 283
-#define ENABLE 284
-#define DISABLE 285
-#define SSLTOKEN 286
-#define CIPHER 287
-#define CLIENTPEMFILE 288
-#define ALLOWSELFCERTIFICATION 289
-#define SELFSIGNED 290
-#define VERIFY 291
-#define CERTIFICATE 292
-#define CACERTIFICATEFILE 293
-#define CACERTIFICATEPATH 294
-#define VALID 295
-#define INTERFACE 296
-#define LINK 297
-#define PACKET 298
-#define BYTEIN 299
-#define BYTEOUT 300
-#define PACKETIN 301
-#define PACKETOUT 302
-#define SPEED 303
-#define SATURATION 304
-#define UPLOAD 305
-#define DOWNLOAD 306
-#define TOTAL 307
-#define IDFILE 308
-#define STATEFILE 309
-#define SEND 310
-#define EXPECT 311
-#define CYCLE 312
-#define COUNT 313
-#define REMINDER 314
-#define REPEAT 315
-#define LIMITS 316
-#define SENDEXPECTBUFFER 317
-#define EXPECTBUFFER 318
-#define FILECONTENTBUFFER 319
-#define HTTPCONTENTBUFFER 320
-#define PROGRAMOUTPUT 321
-#define NETWORKTIMEOUT 322
-#define PROGRAMTIMEOUT 323
-#define STARTTIMEOUT 324
-#define STOPTIMEOUT 325
-#define RESTARTTIMEOUT 326
-#define PIDFILE 327
-#define START 328
-#define STOP 329
-#define PATHTOK 330
-#define RSAKEY 331
-#define HOST 332
-#define HOSTNAME 333
-#define PORT 334
-#define IPV4 335
-#define IPV6 336
-#define TYPE 337
-#define UDP 338
-#define TCP 339
-#define TCPSSL 340
-#define PROTOCOL 341
-#define CONNECTION 342
-#define ALERT 343
-#define NOALERT 344
-#define MAILFORMAT 345
-#define UNIXSOCKET 346
-#define SIGNATURE 347
-#define TIMEOUT 348
-#define RETRY 349
-#define RESTART 350
-#define CHECKSUM 351
-#define EVERY 352
-#define NOTEVERY 353
-#define DEFAULT 354
-#define HTTP 355
-#define HTTPS 356
-#define APACHESTATUS 357
-#define FTP 358
-#define SMTP 359
-#define SMTPS 360
-#define POP 361
-#define POPS 362
-#define IMAP 363
-#define IMAPS 364
-#define CLAMAV 365
-#define NNTP 366
-#define NTP3 367
-#define MYSQL 368
-#define MYSQLS 369
-#define DNS 370
-#define WEBSOCKET 371
-#define MQTT 372
-#define SSH 373
-#define DWP 374
-#define LDAP2 375
-#define LDAP3 376
-#define RDATE 377
-#define RSYNC 378
-#define TNS 379
-#define PGSQL 380
-#define POSTFIXPOLICY 381
-#define SIP 382
-#define LMTP 383
-#define GPS 384
-#define RADIUS 385
-#define MEMCACHE 386
-#define REDIS 387
-#define MONGODB 388
-#define SIEVE 389
-#define SPAMASSASSIN 390
-#define FAIL2BAN 391
-#define STRING 392
-#define PATH 393
-#define MAILADDR 394
-#define MAILFROM 395
-#define MAILREPLYTO 396
-#define MAILSUBJECT 397
-#define MAILBODY 398
-#define SERVICENAME 399
-#define STRINGNAME 400
-#define NUMBER 401
-#define PERCENT 402
-#define LOGLIMIT 403
-#define CLOSELIMIT 404
-#define DNSLIMIT 405
-#define KEEPALIVELIMIT 406
-#define REPLYLIMIT 407
-#define REQUESTLIMIT 408
-#define STARTLIMIT 409
-#define WAITLIMIT 410
-#define GRACEFULLIMIT 411
-#define CLEANUPLIMIT 412
-#define REAL 413
-#define CHECKPROC 414
-#define CHECKFILESYS 415
-#define CHECKFILE 416
-#define CHECKDIR 417
-#define CHECKHOST 418
-#define CHECKSYSTEM 419
-#define CHECKFIFO 420
-#define CHECKPROGRAM 421
-#define CHECKNET 422
-#define THREADS 423
-#define CHILDREN 424
-#define METHOD 425
-#define GET 426
-#define HEAD 427
-#define STATUS 428
-#define ORIGIN 429
-#define VERSIONOPT 430
-#define READ 431
-#define WRITE 432
-#define OPERATION 433
-#define SERVICETIME 434
-#define DISK 435
-#define RESOURCE 436
-#define MEMORY 437
-#define TOTALMEMORY 438
-#define LOADAVG1 439
-#define LOADAVG5 440
-#define LOADAVG15 441
-#define SWAP 442
-#define MODE 443
-#define ACTIVE 444
-#define PASSIVE 445
-#define MANUAL 446
-#define ONREBOOT 447
-#define NOSTART 448
-#define LASTSTATE 449
-#define CORE 450
-#define CPU 451
-#define TOTALCPU 452
-#define CPUUSER 453
-#define CPUSYSTEM 454
-#define CPUWAIT 455
-#define CPUNICE 456
-#define CPUHARDIRQ 457
-#define CPUSOFTIRQ 458
-#define CPUSTEAL 459
-#define CPUGUEST 460
-#define CPUGUESTNICE 461
-#define GROUP 462
-#define REQUEST 463
-#define DEPENDS 464
-#define BASEDIR 465
-#define SLOT 466
-#define EVENTQUEUE 467
-#define SECRET 468
-#define HOSTHEADER 469
-#define UID 470
-#define EUID 471
-#define GID 472
-#define MMONIT 473
-#define INSTANCE 474
-#define USERNAME 475
-#define PASSWORD 476
-#define TIME 477
-#define ATIME 478
-#define CTIME 479
-#define MTIME 480
-#define CHANGED 481
-#define MILLISECOND 482
-#define SECOND 483
-#define MINUTE 484
-#define HOUR 485
-#define DAY 486
-#define MONTH 487
-#define SSLV2 488
-#define SSLV3 489
-#define TLSV1 490
-#define TLSV11 491
-#define TLSV12 492
-#define TLSV13 493
-#define CERTMD5 494
-#define AUTO 495
-#define NOSSLV2 496
-#define NOSSLV3 497
-#define NOTLSV1 498
-#define NOTLSV11 499
-#define NOTLSV12 500
-#define NOTLSV13 501
-#define BYTE 502
-#define KILOBYTE 503
-#define MEGABYTE 504
-#define GIGABYTE 505
-#define INODE 506
-#define SPACE 507
-#define TFREE 508
-#define PERMISSION 509
-#define SIZE 510
-#define MATCH 511
-#define NOT 512
-#define IGNORE 513
-#define ACTION 514
-#define UPTIME 515
-#define EXEC 516
-#define UNMONITOR 517
-#define PING 518
-#define PING4 519
-#define PING6 520
-#define ICMP 521
-#define ICMPECHO 522
-#define NONEXIST 523
-#define EXIST 524
-#define INVALID 525
-#define DATA 526
-#define RECOVERED 527
-#define PASSED 528
-#define SUCCEEDED 529
-#define URL 530
-#define CONTENT 531
-#define PID 532
-#define PPID 533
-#define FSFLAG 534
-#define REGISTER 535
-#define CREDENTIALS 536
-#define URLOBJECT 537
-#define ADDRESSOBJECT 538
-#define TARGET 539
-#define TIMESPEC 540
-#define HTTPHEADER 541
-#define MAXFORWARD 542
-#define FIPS 543
-#define SECURITY 544
-#define ATTRIBUTE 545
-#define FILEDESCRIPTORS 546
-#define GREATER 547
-#define GREATEROREQUAL 548
-#define LESS 549
-#define LESSOREQUAL 550
-#define EQUAL 551
-#define NOTEQUAL 552
+#define SHA256HASH 279
+#define XXH64HASH 280
+#define CRYPT 281
+#define DELAY 282
+#define PEMFILE 283
+#define PEMKEY 284
+#define PEMCHAIN 285
+#define ENABLE 286
+#define DISABLE 287
+#define SSLTOKEN 288
+#define CIPHER 289
+#define CLIENTPEMFILE 290
+#define ALLOWSELFCERTIFICATION 291
+#define SELFSIGNED 292
+#define VERIFY 293
+#define CERTIFICATE 294
+#define CACERTIFICATEFILE 295
+#define CACERTIFICATEPATH 296
+#define VALID 297
+#define INTERFACE 298
+#define LINK 299
+#define PACKET 300
+#define BYTEIN 301
+#define BYTEOUT 302
+#define PACKETIN 303
+#define PACKETOUT 304
+#define SPEED 305
+#define SATURATION 306
+#define UPLOAD 307
+#define DOWNLOAD 308
+#define TOTAL 309
+#define DROP 310
+#define MISSED 311
+#define FIFO 312
+#define CARRIER 313
+#define MULTICAST 314
+#define COLLISION 315
+#define TCPRETRANSMITS 316
+#define LISTENOVERFLOWS 317
+#define LISTENDROPS 318
+#define SYNCOOKIES 319
+#define ORPHANS 320
+#define TIMEWAIT 321
+#define UDPRCVBUFERRORS 322
+#define LISTENING 323
+#define LISTENQUEUE 324
+#define ESTABLISHED 325
+#define IDFILE 326
+#define STATEFILE 327
+#define SEND 328
+#define EXPECT 329
+#define CYCLE 330
+#define COUNT 331
+#define REMINDER 332
+#define REPEAT 333
+#define LIMITS 334
+#define SENDEXPECTBUFFER 335
+#define EXPECTBUFFER 336
+#define FILECONTENTBUFFER 337
+#define HTTPCONTENTBUFFER 338
+#define PROGRAMOUTPUT 339
+#define NETWORKTIMEOUT 340
+#define PROGRAMTIMEOUT 341
+#define STARTTIMEOUT 342
+#define STOPTIMEOUT 343
+#define RESTARTTIMEOUT 344
+#define CHECKSUMWORKERS 345
+#define CHECKSUMIDLEIO 346
+#define FILESYSTEMTIMEOUT 347
+#define DNSTTL 348
+#define DNSNEGATIVETTL 349
+#define ENTRIES 350
+#define OLDEST 351
+#define PIDFILE 352
+#define START 353
+#define STOP 354
+#define PATHTOK 355
+#define RSAKEY 356
+#define HOST 357
+#define HOSTNAME 358
+#define PORT 359
+#define IPV4 360
+#define IPV6 361
+#define TYPE 362
+#define UDP 363
+#define TCP 364
+#define TCPSSL 365
+#define PROTOCOL 366
+#define CONNECTION 367
+#define ALERT 368
+#define NOALERT 369
+#define MAILFORMAT 370
+#define UNIXSOCKET 371
+#define SIGNATURE 372
+#define TIMEOUT 373
+#define RETRY 374
+#define PERSISTENT 375
+#define RESTART 376
+#define CHECKSUM 377
+#define EVERY 378
+#define NOTEVERY 379
+#define DNSTIME 380
+#define CONNECTTIME 381
+#define TLSHANDSHAKE 382
+#define REQUESTTIME 383
+#define FIRSTBYTE 384
+#define RESPONSETIME 385
+#define RTT 386
+#define RETRANSMITS 387
+#define DEFAULT 388
+#define HTTP 389
+#define HTTPS 390
+#define APACHESTATUS 391
+#define FTP 392
+#define SMTP 393
+#define SMTPS 394
+#define POP 395
+#define POPS 396
+#define IMAP 397
+#define IMAPS 398
+#define CLAMAV 399
+#define NNTP 400
+#define NTP3 401
+#define MYSQL 402
+#define MYSQLS 403
+#define DNS 404
+#define WEBSOCKET 405
+#define MQTT 406
+#define HTTP2 407
+#define HEX 408
+#define SSH 409
+#define DWP 410
+#define LDAP2 411
+#define LDAP3 412
+#define RDATE 413
+#define RSYNC 414
+#define TNS 415
+#define PGSQL 416
+#define POSTFIXPOLICY 417
+#define SIP 418
+#define LMTP 419
+#define GPS 420
+#define RADIUS 421
+#define MEMCACHE 422
+#define REDIS 423
+#define MONGODB 424
+#define SIEVE 425
+#define SPAMASSASSIN 426
+#define FAIL2BAN 427
+#define STRING 428
+#define PATH 429
+#define MAILADDR 430
+#define MAILFROM 431
+#define MAILREPLYTO 432
+#define MAILSUBJECT 433
+#define MAILBODY 434
+#define SERVICENAME 435
+#define STRINGNAME 436
+#define NUMBER 437
+#define PERCENT 438
+#define LOGLIMIT 439
+#define CLOSELIMIT 440
+#define DNSLIMIT 441
+#define KEEPALIVELIMIT 442
+#define REPLYLIMIT 443
+#define REQUESTLIMIT 444
+#define STARTLIMIT 445
+#define WAITLIMIT 446
+#define GRACEFULLIMIT 447
+#define CLEANUPLIMIT 448
+#define REAL 449
+#define CHECKPROC 450
+#define CHECKFILESYS 451
+#define CHECKFILE 452
+#define CHECKDIR 453
+#define CHECKHOST 454
+#define CHECKSYSTEM 455
+#define CHECKFIFO 456
+#define CHECKPROGRAM 457
+#define CHECKNET 458
+#define CHECKFILESET 459
+#define THREADS 460
+#define CHILDREN 461
+#define METHOD 462
+#define GET 463
+#define HEAD 464
+#define STATUS 465
+#define ORIGIN 466
+#define VERSIONOPT 467
+#define READ 468
+#define WRITE 469
+#define OPERATION 470
+#define SERVICETIME 471
+#define DISK 472
+#define LATENCY 473
+#define UTILIZATION 474
+#define QUEUEDEPTH 475
+#define IOPS 476
+#define TIMETOFULL 477
+#define OVER 478
+#define RESOURCE 479
+#define MEMORY 480
+#define TOTALMEMORY 481
+#define LOADAVG1 482
+#define LOADAVG5 483
+#define LOADAVG15 484
+#define SWAP 485
+#define MODE 486
+#define ACTIVE 487
+#define PASSIVE 488
+#define MANUAL 489
+#define ONREBOOT 490
+#define NOSTART 491
+#define LASTSTATE 492
+#define CORE 493
+#define CPU 494
+#define TOTALCPU 495
+#define CPUUSER 496
+#define CPUSYSTEM 497
+#define CPUWAIT 498
+#define CPUNICE 499
+#define CPUHARDIRQ 500
+#define CPUSOFTIRQ 501
+#define CPUSTEAL 502
+#define CPUGUEST 503
+#define CPUGUESTNICE 504
+#define GROUP 505
+#define REQUEST 506
+#define DEPENDS 507
+#define BASEDIR 508
+#define SLOT 509
+#define EVENTQUEUE 510
+#define SECRET 511
+#define HOSTHEADER 512
+#define UID 513
+#define EUID 514
+#define GID 515
+#define MMONIT 516
+#define INSTANCE 517
+#define USERNAME 518
+#define PASSWORD 519
+#define TIME 520
+#define ATIME 521
+#define CTIME 522
+#define MTIME 523
+#define CHANGED 524
+#define MILLISECOND 525
+#define SECOND 526
+#define MINUTE 527
+#define HOUR 528
+#define DAY 529
+#define MONTH 530
+#define SSLV2 531
+#define SSLV3 532
+#define TLSV1 533
+#define TLSV11 534
+#define TLSV12 535
+#define TLSV13 536
+#define CERTMD5 537
+#define AUTO 538
+#define NOSSLV2 539
+#define NOSSLV3 540
+#define NOTLSV1 541
+#define NOTLSV11 542
+#define NOTLSV12 543
+#define NOTLSV13 544
+#define BYTE 545
+#define KILOBYTE 546
+#define MEGABYTE 547
+#define GIGABYTE 548
+#define INODE 549
+#define SPACE 550
+#define TFREE 551
+#define PERMISSION 552
+#define SIZE 553
+#define MATCH 554
+#define NOT 555
+#define IGNORE 556
+#define ACTION 557
+#define UPTIME 558
+#define EXEC 559
+#define UNMONITOR 560
+#define PING 561
+#define PING4 562
+#define PING6 563
+#define ICMP 564
+#define ICMPECHO 565
+#define NONEXIST 566
+#define EXIST 567
+#define INVALID 568
+#define DATA 569
+#define RECOVERED 570
+#define PASSED 571
+#define SUCCEEDED 572
+#define URL 573
+#define CONTENT 574
+#define PID 575
+#define PPID 576
+#define FSFLAG 577
+#define REGISTER 578
+#define CREDENTIALS 579
+#define URLOBJECT 580
+#define ADDRESSOBJECT 581
+#define TARGET 582
+#define TIMESPEC 583
+#define HTTPHEADER 584
+#define MAXFORWARD 585
+#define FIPS 586
+#define SECURITY 587
+#define ATTRIBUTE 588
+#define FILEDESCRIPTORS 589
+#define GREATER 590
+#define GREATEROREQUAL 591
+#define LESS 592
+#define LESSOREQUAL 593
+#define EQUAL 594
+#define NOTEQUAL 595
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 322 "src/p.y"
+#line 328 "src/p.y"
 
         URL_T url;
         Address_T address;
@@ -655,7 +751,7 @@ union YYSTYPE
         int   number;
         char *string;
 
-#line 659 "src/y.tab.h"
+#line 755 "src/y.tab.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -666,6 +762,8 @@ typedef union YYSTYPE YYSTYPE;
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_SRC_Y_TAB_H_INCLUDED  */
@@ -0,0 +1,147 @@
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "Stub.h"
+
+/**
+ * Generic send/expect protocol test (src/protocols/generic.c) against a
+ * stub server which sends the replies in several segments.
+ */
+
+
+// Delay between the segments of a reply [μs]
+#define SEGMENTDELAY 50000
+
+
+static const char *smtp =
+        "    expect \"^220.*\"\n"
+        "    send \"HELO localhost\\r\\n\"\n"
+        "    expect \"^250.*\"\n";
+
+
+static void _send(Stub_T S, const char *segment) {
+        Stub_write(S, segment, strlen(segment));
+        usleep(SEGMENTDELAY);
+}
+
+
+static bool _readLine(Stub_T S, char *line, size_t size) {
+        for (size_t n = 0; n + 1 < size; n++) {
+                if (! Stub_read(S, line + n, 1))
+                        return false;
+                if (line[n] == '\n') {
+                        line[n + 1] = 0;
+                        return true;
+                }
+        }
+        return false;
+}
+
+
+static void _reply(Stub_T S, const char *banner[], const char *reply[]) {
+        char line[256];
+        for (int i = 0; banner[i]; i++)
+                _send(S, banner[i]);
+        if (_readLine(S, line, sizeof(line)) && strcmp(line, "HELO localhost\r\n") == 0) {
+                for (int i = 0; reply[i]; i++)
+                        _send(S, reply[i]);
+        }
+        Stub_drain(S);
+}
+
+
+// The banner line split across segments: the rest of the line must not precede the reply to HELO
+static void _splitLine(Stub_T S) {
+        _reply(S, (const char *[]){"220 mail.example", " ESMTP ready\r\n", NULL}, (const char *[]){"250 ", "mail.example\r\n", NULL});
+}
+
+
+// The rest of a multiline banner arrives with the end of the matched line
+static void _multiLine(Stub_T S) {
+        _reply(S, (const char *[]){"220-mail.example", " ESMTP\r\n220 ready\r\n", NULL}, (const char *[]){"250-mail.example\r\n", "250 SIZE 1000000\r\n", NULL});
+}
+
+
+static void _rejected(Stub_T S) {
+        _reply(S, (const char *[]){"220 mail.example", " ESMTP ready\r\n", NULL}, (const char *[]){"550 denied\r\n", NULL});
+}
+
+
+static void _binary(Stub_T S) {
+        _send(S, "\x12");
+        _send(S, "\x34\x81");
+        _send(S, "\x80");
+        Stub_drain(S);
+}
+
+
+static char *_test(const char *monit, void (*handler)(Stub_T S), const char *sendexpect) {
+        Stub_T S = Stub_new(NULL, NULL);
+        Stub_serve(S, handler);
+        char checks[1024];
+        snprintf(checks, sizeof(checks), "check host stub with address 127.0.0.1\n  if failed port %d\n%s  then alert\n", Stub_port(S), sendexpect);
+        char *output = Stub_monit(monit, checks);
+        Stub_free(&S);
+        return output;
+}
+
+
+static void _assertSucceeded(char *output) {
+        if (! strstr(output, "'stub' succeeded testing protocol [generic]")) {
+                printf("%s", output);
+                fflush(stdout);
+                assert(! "protocol test failed");
+        }
+        free(output);
+}
+
+
+static void _assertFailed(char *output, const char *error) {
+        if (! strstr(output, "'stub' failed protocol test [generic]") || ! strstr(output, error)) {
+                printf("%s", output);
+                fflush(stdout);
+                assert(! "expected protocol test failure not found");
+        }
+        printf("\tResult: %s\n", error);
+        free(output);
+}
+
+
+int main(int argc, char **argv) {
+        const char *monit = argc > 1 ? argv[1] : "../monit";
+
+        printf("============> Start Generic Tests\n\n");
+
+        printf("=> Test1: reply line split across segments\n");
+        {
+                _assertSucceeded(_test(monit, _splitLine, smtp));
+        }
+        printf("=> Test1: OK\n\n");
+
+        printf("=> Test2: multiline reply\n");
+        {
+                _assertSucceeded(_test(monit, _multiLine, smtp));
+        }
+        printf("=> Test2: OK\n\n");
+
+        printf("=> Test3: unexpected reply\n");
+        {
+                _assertFailed(_test(monit, _rejected, smtp), "GENERIC: received unexpected data [550 denied]");
+        }
+        printf("=> Test3: OK\n\n");
+
+        printf("=> Test4: bytes split across segments\n");
+        {
+                _assertSucceeded(_test(monit, _binary, "    expect hex \"12 34 81 80\"\n"));
+        }
+        printf("=> Test4: OK\n\n");
+
+        printf("============> Generic Tests: OK\n\n");
+
+        return 0;
+}
@@ -0,0 +1,201 @@
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+
+#include "Stub.h"
+
+/**
+ * HTTP/2 protocol test (src/protocols/http2.c) against a stub server.
+ *
+ * The response header blocks were encoded by nghttp2, they use Huffman
+ * coded strings and the dynamic table, so they are decoded correctly
+ * only if the client keeps the HPACK state across the streams.
+ */
+
+
+#define FRAME_DATA         0x0
+#define FRAME_HEADERS      0x1
+#define FRAME_RSTSTREAM    0x3
+#define FRAME_SETTINGS     0x4
+#define FRAME_PING         0x6
+#define FRAME_GOAWAY       0x7
+#define FRAME_CONTINUATION 0x9
+
+#define FLAG_ENDSTREAM     0x1
+#define FLAG_ENDHEADERS    0x4
+
+
+// :status 302 (Huffman coded, added to the dynamic table), location /b
+static const unsigned char block1[] = {0x48, 0x82, 0x64, 0x02, 0x0f, 0x1f, 0x02, 0x2f, 0x62};
+// :status 204, x-stub: multiplexed (Huffman coded name and value, added to the dynamic table)
+static const unsigned char block2[] = {0x89, 0x40, 0x85, 0xf2, 0xb2, 0x13, 0x6c, 0x7f, 0x88, 0xa6, 0xda, 0x12, 0x6a, 0xe8, 0x2f, 0x92, 0xc9};
+// :status 200, x-stub: multiplexed (dynamic table index 62), server: stub (Huffman coded), location /b
+static const unsigned char block3[] = {0x88, 0xbe, 0x76, 0x83, 0x42, 0x6d, 0x8f, 0x0f, 0x1f, 0x02, 0x2f, 0x62};
+
+
+static int streams;
+
+
+static void _frame(Stub_T S, int type, int flags, unsigned int id, const void *payload, size_t length) {
+        unsigned char header[9] = {length >> 16, length >> 8, length, type, flags, id >> 24, id >> 16, id >> 8, id};
+        Stub_write(S, header, sizeof(header));
+        if (length)
+                Stub_write(S, payload, length);
+}
+
+
+static void _goAway(Stub_T S, unsigned int last, unsigned int error) {
+        unsigned char payload[8] = {last >> 24, last >> 16, last >> 8, last, error >> 24, error >> 16, error >> 8, error};
+        _frame(S, FRAME_GOAWAY, 0, 0, payload, sizeof(payload));
+}
+
+
+// Read the client preface and the frames until the requests of all streams were received
+static bool _readRequests(Stub_T S) {
+        unsigned char buffer[16384 + 9];
+        if (! Stub_read(S, buffer, 24) || memcmp(buffer, "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n", 24))
+                return false;
+        for (int requests = 0; requests < streams; ) {
+                if (! Stub_read(S, buffer, 9))
+                        return false;
+                size_t length = buffer[0] << 16 | buffer[1] << 8 | buffer[2];
+                if (buffer[3] == FRAME_HEADERS)
+                        requests++;
+                if (length > 16384 || ! Stub_read(S, buffer + 9, length))
+                        return false;
+        }
+        _frame(S, FRAME_SETTINGS, 0, 0, NULL, 0);
+        return true;
+}
+
+
+// Responses out of order, a header block split to CONTINUATION, a PING between the responses
+static void _multiplexed(Stub_T S) {
+        if (_readRequests(S)) {
+                _frame(S, FRAME_HEADERS, FLAG_ENDHEADERS, 3, block1, sizeof(block1));
+                _frame(S, FRAME_HEADERS, FLAG_ENDSTREAM, 5, block2, 3);
+                _frame(S, FRAME_CONTINUATION, FLAG_ENDHEADERS, 5, block2 + 3, sizeof(block2) - 3);
+                _frame(S, FRAME_PING, 0, 0, "stubping", 8);
+                _frame(S, FRAME_HEADERS, FLAG_ENDHEADERS | FLAG_ENDSTREAM, 1, block3, sizeof(block3));
+                _frame(S, FRAME_DATA, FLAG_ENDSTREAM, 3, "moved", 5);
+                Stub_drain(S);
+        }
+}
+
+
+static void _resetStream(Stub_T S) {
+        if (_readRequests(S)) {
+                _frame(S, FRAME_HEADERS, FLAG_ENDHEADERS | FLAG_ENDSTREAM, 1, block1, sizeof(block1));
+                _frame(S, FRAME_RSTSTREAM, 0, 3, (unsigned char[]){0, 0, 0, 7}, 4); // REFUSED_STREAM
+                Stub_drain(S);
+        }
+}
+
+
+static void _goAwayGraceful(Stub_T S) {
+        if (_readRequests(S)) {
+                _frame(S, FRAME_HEADERS, FLAG_ENDHEADERS | FLAG_ENDSTREAM, 1, block1, sizeof(block1));
+                _goAway(S, 1, 0); // NO_ERROR, streams above 1 were not processed
+                Stub_drain(S);
+        }
+}
+
+
+static void _goAwayError(Stub_T S) {
+        if (_readRequests(S)) {
+                _goAway(S, 0, 0xb); // ENHANCE_YOUR_CALM
+                Stub_drain(S);
+        }
+}
+
+
+static char *_test(const char *monit, const char *certificate, const char *alpn, void (*handler)(Stub_T S), int count, const char *options) {
+        streams = count;
+        Stub_T S = Stub_new(certificate, alpn);
+        Stub_serve(S, handler);
+        char checks[1024];
+        snprintf(checks, sizeof(checks), "check host stub with address 127.0.0.1\n  if failed port %d %s protocol http2 %s then alert\n", Stub_port(S), certificate ? "with ssl" : "", options);
+        char *output = Stub_monit(monit, checks);
+        Stub_free(&S);
+        return output;
+}
+
+
+static void _assertSucceeded(char *output) {
+        if (! strstr(output, "'stub' succeeded testing protocol [HTTP2]")) {
+                printf("%s", output);
+                fflush(stdout);
+                assert(! "protocol test failed");
+        }
+        free(output);
+}
+
+
+static void _assertFailed(char *output, const char *error) {
+        if (! strstr(output, "'stub' failed protocol test [HTTP2]") || ! strstr(output, error)) {
+                printf("%s", output);
+                fflush(stdout);
+                assert(! "expected protocol test failure not found");
+        }
+        printf("\tResult: %s", error);
+        free(output);
+}
+
+
+int main(int argc, char **argv) {
+        const char *monit = argc > 1 ? argv[1] : "../monit";
+
+        printf("============> Start HTTP2 Tests\n\n");
+
+        printf("=> Test1: h2c with prior knowledge, multiplexed streams\n");
+        {
+                _assertSucceeded(_test(monit, NULL, NULL, _multiplexed, 3, "request \"/a\" request \"/b\" request \"/c\""));
+        }
+        printf("=> Test1: OK\n\n");
+
+        printf("=> Test2: status of each stream\n");
+        {
+                // The responses of the streams /a, /b and /c are 200, 302 and 204
+                _assertFailed(_test(monit, NULL, NULL, _multiplexed, 3, "request \"/a\" request \"/b\" request \"/c\" status < 300"), "HTTP2 error: /b returned status 302\n");
+        }
+        printf("=> Test2: OK\n\n");
+
+        printf("=> Test3: RST_STREAM\n");
+        {
+                _assertFailed(_test(monit, NULL, NULL, _resetStream, 2, "request \"/a\" request \"/b\""), "HTTP2 error: /b stream reset by the server -- REFUSED_STREAM\n");
+        }
+        printf("=> Test3: OK\n\n");
+
+        printf("=> Test4: GOAWAY without error\n");
+        {
+                _assertFailed(_test(monit, NULL, NULL, _goAwayGraceful, 3, "request \"/a\" request \"/b\" request \"/c\""), "HTTP2 error: /b stream reset by the server -- REFUSED_STREAM, /c stream reset by the server -- REFUSED_STREAM\n");
+        }
+        printf("=> Test4: OK\n\n");
+
+        printf("=> Test5: GOAWAY with error\n");
+        {
+                _assertFailed(_test(monit, NULL, NULL, _goAwayError, 1, "request \"/\""), "HTTP2 error: the server closed the connection -- ENHANCE_YOUR_CALM\n");
+        }
+        printf("=> Test5: OK\n\n");
+
+#ifdef HAVE_OPENSSL
+        printf("=> Test6: h2 negotiated by ALPN\n");
+        {
+                _assertSucceeded(_test(monit, "data/server.pem", "h2", _multiplexed, 3, "request \"/a\" request \"/b\" request \"/c\""));
+        }
+        printf("=> Test6: OK\n\n");
+
+        printf("=> Test7: TLS server without h2\n");
+        {
+                _assertFailed(_test(monit, "data/server.pem", "http/1.1", _multiplexed, 3, "request \"/a\" request \"/b\" request \"/c\""), "the server doesn't support the h2 application protocol\n");
+        }
+        printf("=> Test7: OK\n\n");
+#endif
+
+        printf("============> HTTP2 Tests: OK\n\n");
+
+        return 0;
+}
@@ -0,0 +1,206 @@
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#ifdef HAVE_OPENSSL
+#include <openssl/ssl.h>
+#endif
+
+#include "Stub.h"
+
+
+struct Stub_T {
+        int server;
+        int client;
+        int port;
+        const char *alpn;
+        void (*handler)(Stub_T S);
+        pthread_t thread;
+        bool running;
+#ifdef HAVE_OPENSSL
+        SSL_CTX *ctx;
+        SSL *ssl;
+#endif
+};
+
+
+#ifdef HAVE_OPENSSL
+static int _selectProtocol(__attribute__ ((unused)) SSL *ssl, const unsigned char **out, unsigned char *outlen, const unsigned char *in, unsigned int inlen, void *arg) {
+        Stub_T S = arg;
+        size_t length = strlen(S->alpn);
+        for (unsigned int i = 0; i < inlen; i += in[i] + 1) {
+                if (in[i] == length && i + 1 + length <= inlen && memcmp(in + i + 1, S->alpn, length) == 0) {
+                        *out = in + i + 1;
+                        *outlen = in[i];
+                        return SSL_TLSEXT_ERR_OK;
+                }
+        }
+        return SSL_TLSEXT_ERR_NOACK;
+}
+#endif
+
+
+static void *_serve(void *arg) {
+        Stub_T S = arg;
+        struct timeval timeout = {.tv_sec = 10};
+        if ((S->client = accept(S->server, NULL, NULL)) < 0)
+                return NULL;
+        setsockopt(S->client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+#ifdef HAVE_OPENSSL
+        if (S->ctx) {
+                S->ssl = SSL_new(S->ctx);
+                SSL_set_fd(S->ssl, S->client);
+                if (SSL_accept(S->ssl) != 1)
+                        goto done;
+        }
+#endif
+        S->handler(S);
+#ifdef HAVE_OPENSSL
+done:
+        if (S->ssl) {
+                SSL_shutdown(S->ssl);
+                SSL_free(S->ssl);
+                S->ssl = NULL;
+        }
+#endif
+        close(S->client);
+        return NULL;
+}
+
+
+Stub_T Stub_new(const char *certificate, const char *alpn) {
+        Stub_T S = calloc(1, sizeof(*S));
+        assert(S);
+        S->alpn = alpn;
+        S->server = socket(AF_INET, SOCK_STREAM, 0);
+        assert(S->server >= 0);
+        struct sockaddr_in addr = {.sin_family = AF_INET, .sin_addr.s_addr = htonl(INADDR_LOOPBACK)};
+        socklen_t length = sizeof(addr);
+        assert(bind(S->server, (struct sockaddr *)&addr, sizeof(addr)) == 0);
+        assert(listen(S->server, 1) == 0);
+        assert(getsockname(S->server, (struct sockaddr *)&addr, &length) == 0);
+        S->port = ntohs(addr.sin_port);
+        if (certificate) {
+#ifdef HAVE_OPENSSL
+                S->ctx = SSL_CTX_new(SSLv23_server_method());
+                assert(S->ctx);
+                assert(SSL_CTX_use_certificate_chain_file(S->ctx, certificate) == 1);
+                assert(SSL_CTX_use_PrivateKey_file(S->ctx, certificate, SSL_FILETYPE_PEM) == 1);
+                if (alpn)
+                        SSL_CTX_set_alpn_select_cb(S->ctx, _selectProtocol, S);
+#else
+                assert(! "TLS is not supported");
+#endif
+        }
+        return S;
+}
+
+
+void Stub_serve(Stub_T S, void (*handler)(Stub_T S)) {
+        assert(S);
+        assert(handler);
+        S->handler = handler;
+        assert(pthread_create(&S->thread, NULL, _serve, S) == 0);
+        S->running = true;
+}
+
+
+void Stub_free(Stub_T *S) {
+        assert(S && *S);
+        // Unblock accept if the client didn't connect
+        shutdown((*S)->server, SHUT_RDWR);
+        if ((*S)->running)
+                pthread_join((*S)->thread, NULL);
+        close((*S)->server);
+#ifdef HAVE_OPENSSL
+        if ((*S)->ctx)
+                SSL_CTX_free((*S)->ctx);
+#endif
+        free(*S);
+        *S = NULL;
+}
+
+
+int Stub_port(Stub_T S) {
+        assert(S);
+        return S->port;
+}
+
+
+bool Stub_read(Stub_T S, void *buffer, size_t length) {
+        for (size_t n = 0; n < length; ) {
+                ssize_t rv;
+#ifdef HAVE_OPENSSL
+                if (S->ssl)
+                        rv = SSL_read(S->ssl, (char *)buffer + n, (int)(length - n));
+                else
+#endif
+                        rv = read(S->client, (char *)buffer + n, length - n);
+                if (rv <= 0)
+                        return false;
+                n += rv;
+        }
+        return true;
+}
+
+
+void Stub_write(Stub_T S, const void *buffer, size_t length) {
+#ifdef HAVE_OPENSSL
+        if (S->ssl) {
+                SSL_write(S->ssl, buffer, (int)length);
+                return;
+        }
+#endif
+        ssize_t rv = write(S->client, buffer, length);
+        (void)rv;
+}
+
+
+void Stub_drain(Stub_T S) {
+        char c;
+        while (Stub_read(S, &c, 1))
+                ;
+}
+
+
+char *Stub_monit(const char *monit, const char *checks) {
+        char dir[] = "/tmp/stubXXXXXX";
+        assert(mkdtemp(dir));
+        char path[256];
+        snprintf(path, sizeof(path), "%s/monitrc", dir);
+        FILE *f = fopen(path, "w");
+        assert(f);
+        fprintf(f, "set idfile %s/id\nset statefile %s/state\nset pidfile %s/pid\n%s", dir, dir, dir, checks);
+        fclose(f);
+        chmod(path, 0600);
+        char command[512];
+        snprintf(command, sizeof(command), "%s -c %s -v validate 2>&1", monit, path);
+        FILE *p = popen(command, "r");
+        assert(p);
+        size_t size = 4096, length = 0;
+        char *output = malloc(size);
+        assert(output);
+        size_t n;
+        while ((n = fread(output + length, 1, size - length - 1, p)) > 0) {
+                length += n;
+                if (size - length < 1024) {
+                        size *= 2;
+                        output = realloc(output, size);
+                        assert(output);
+                }
+        }
+        output[length] = 0;
+        pclose(p);
+        snprintf(command, sizeof(command), "rm -rf %s", dir);
+        assert(system(command) == 0);
+        return output;
+}
@@ -0,0 +1,80 @@
+#ifndef STUB_H
+#define STUB_H
+
+#include <stdbool.h>
+#include <sys/types.h>
+
+/**
+ * Stub server for the protocol tests. The server listens on an ephemeral
+ * port of the loopback interface and serves one connection by the given
+ * handler in a background thread, so the protocol test can be run by the
+ * monit binary against it.
+ */
+
+
+typedef struct Stub_T *Stub_T;
+
+
+/**
+ * Create a stub server listening on 127.0.0.1
+ * @param certificate PEM file with the server certificate and key if the
+ * connection should use TLS, otherwise NULL
+ * @param alpn Application protocol the server selects (if offered by the
+ * client) or NULL if ALPN is not supported
+ * @return The stub server
+ */
+Stub_T Stub_new(const char *certificate, const char *alpn);
+
+
+/**
+ * Accept one connection in a background thread and pass it to the handler
+ * @param S The stub server
+ * @param handler The function serving the connection
+ */
+void Stub_serve(Stub_T S, void (*handler)(Stub_T S));
+
+
+/**
+ * Wait for the handler to finish and free the stub server
+ * @param S The stub server reference
+ */
+void Stub_free(Stub_T *S);
+
+
+/**
+ * @param S The stub server
+ * @return The listening port
+ */
+int Stub_port(Stub_T S);
+
+
+/**
+ * Read exactly length bytes from the connection
+ * @return true on success, false on EOF or error
+ */
+bool Stub_read(Stub_T S, void *buffer, size_t length);
+
+
+/**
+ * Write the buffer to the connection
+ */
+void Stub_write(Stub_T S, const void *buffer, size_t length);
+
+
+/**
+ * Read and discard data until the client closes the connection
+ */
+void Stub_drain(Stub_T S);
+
+
+/**
+ * Run one validate cycle of the monit binary with the given service
+ * checks and return its verbose output
+ * @param monit Path to the monit binary
+ * @param checks Service entries for the control file
+ * @return The output, must be freed by the caller
+ */
+char *Stub_monit(const char *monit, const char *checks);
+
+
+#endif
@@ -0,0 +1,7 @@
+#!/bin/sh
+
+PATH="$PATH:."
+export PATH
+
+GenericTest ../monit && \
+Http2Test ../monit